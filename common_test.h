@@ -116,8 +116,9 @@ float l2_err(float *test, float *ref, int len)
             sup1ulps++;
     }
 
-    sup1ulps_percent = (float) sup1ulps / (float) len * 100.0f;
-    l2_rel_err =  sqrtf(l2_rel_err)/sqrtf(sum);
+    sup1ulps_percent = (len > 0) ? (float) sup1ulps / (float) len * 100.0f : 0.0f;
+    // absolute error when the reference is empty or all zeros
+    l2_rel_err = (sum > 0.0f) ? sqrtf(l2_rel_err) / sqrtf(sum) : sqrtf(l2_rel_err);
     printf("L2 REL ERR %0.9g SUP_1ULPS %2.4g %% \n", l2_rel_err, sup1ulps_percent);
     return l2_rel_err;
 }
@@ -137,8 +138,9 @@ double l2_errd(double *test, double *ref, int len)
             sup1ulps++;
     }
 
-    sup1ulps_percent = (float) sup1ulps / (float) len * 100.0f;
-    l2_rel_err =  sqrt(l2_rel_err)/sqrt(sum);
+    sup1ulps_percent = (len > 0) ? (float) sup1ulps / (float) len * 100.0f : 0.0f;
+    // absolute error when the reference is empty or all zeros
+    l2_rel_err = (sum > 0.0) ? sqrt(l2_rel_err) / sqrt(sum) : sqrt(l2_rel_err);
     printf("L2 REL ERR %0.18g SUP_1ULPS %2.4g %% \n", l2_rel_err, sup1ulps_percent);
     return l2_rel_err;
 }
@@ -188,6 +190,48 @@ float l2_err_i32(int32_t *test, int32_t *ref, int len)
     return l2_rel_err;
 }
 
+// differences are taken modulo 2^64, so that wrapped results are compared exactly
+double l2_err_i64(int64_t *test, int64_t *ref, int len)
+{
+    double l2_rel_err = 0.0;
+    double sum = 0.0;
+
+    for (int i = 0; i < len; i++) {
+        double diff = (double) (int64_t) ((uint64_t) ref[i] - (uint64_t) test[i]);
+        l2_rel_err += diff * diff;
+        sum += (double) ref[i] * (double) ref[i];
+    }
+
+    l2_rel_err = sqrt(l2_rel_err) / sqrt(sum);
+    printf("L2 REL ERR %0.9g\n", l2_rel_err);
+    return l2_rel_err;
+}
+
+// Relative errors of the mean, variance, skewness and kurtosis
+void print_moments(const char *name, moments_t *ref, moments_t *test)
+{
+    printf("%s n %.0f mean %.12g var %.12g skew %.9g kurt %.9g || REL ERR mean %0.9g var %0.9g skew %0.9g kurt %0.9g\n", name, test->n,
+           moments_mean(test), moments_variance(test, 1), moments_skewness(test), moments_kurtosis(test),
+           fabs(moments_mean(test) - moments_mean(ref)) / fabs(moments_mean(ref)),
+           fabs(moments_variance(test, 1) - moments_variance(ref, 1)) / fabs(moments_variance(ref, 1)),
+           fabs(moments_skewness(test) - moments_skewness(ref)) / fabs(moments_skewness(ref)),
+           fabs(moments_kurtosis(test) - moments_kurtosis(ref)) / fabs(moments_kurtosis(ref)));
+}
+
+// Number of bins of test differing from ref, and total counts
+void print_hist(const char *name, uint32_t *ref, uint32_t *test, int nb_bins)
+{
+    int nb_diff = 0;
+    uint64_t total_ref = 0, total_test = 0;
+    for (int i = 0; i < nb_bins; i++) {
+        if (ref[i] != test[i])
+            nb_diff++;
+        total_ref += ref[i];
+        total_test += test[i];
+    }
+    printf("%s bins %d total %lu (ref %lu) || DIFF BINS %d\n", name, nb_bins, (unsigned long) total_test, (unsigned long) total_ref, nb_diff);
+}
+
 #ifdef IPP
 void init_ipp(void){
     IppStatus status;
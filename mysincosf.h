@@ -21,6 +21,8 @@ static inline int mysincosf(float xx, float *s, float *c)
         x = -xx;
     }
     if (x > T24M1) {
+        *s = 0.0f;
+        *c = 0.0f;
         return (0.0f);
     }
     z = FOPI * x; /* integer part of x/(PI/4) */
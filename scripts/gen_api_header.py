@@ -0,0 +1,172 @@
+#!/usr/bin/env python3
+#
+# Project : SIMD_Utils
+# Version : 0.2.6
+# Author  : JishinMaster
+# Licence : BSD-2
+#
+# Generates simd_utils_api.h, the prototypes of every function defined with SIMD_UTILS_API,
+# under the same preprocessor conditions as their definitions in simd_utils.h and the headers it includes.
+#
+# usage : gen_api_header.py [--check] [directory]
+#   --check : do not write simd_utils_api.h, exit with 1 if it is not up to date
+
+import os
+import re
+import sys
+
+OUTPUT = "simd_utils_api.h"
+
+# conditions which do not change the set of functions of the library
+IGNORED_CONDITIONS = re.compile(r"__cplusplus|SIMD_UTILS_EXTERN|SIMD_UTILS_IMPL")
+
+HEADER = """/*
+ * Project : SIMD_Utils
+ * Version : 0.2.6
+ * Author  : JishinMaster
+ * Licence : BSD-2
+ */
+
+#pragma once
+
+/* Prototypes of the functions of the library mode (SIMD_UTILS_EXTERN, see simd_utils.h).
+ * Generated by scripts/gen_api_header.py from the SIMD_UTILS_API definitions, do not edit. */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "simd_utils_types.h"
+"""
+
+
+def strip_comments(line):
+    line = re.sub(r"/\*.*?\*/", "", line)
+    return line.split("//")[0].strip()
+
+
+class Condition:
+    """One level of #if/#elif/#else, as a C expression (None when ignored)"""
+
+    def __init__(self, expr):
+        self.previous = []
+        self.expr = expr
+        self.ignored = expr is not None and IGNORED_CONDITIONS.search(expr) is not None
+
+    def elif_(self, expr):
+        self.previous.append(self.expr)
+        self.expr = expr
+        self.ignored = self.ignored or IGNORED_CONDITIONS.search(expr) is not None
+
+    def else_(self):
+        self.previous.append(self.expr)
+        self.expr = None
+
+    def text(self):
+        if self.ignored:
+            return None
+        terms = [negate(e) for e in self.previous] + ([self.expr] if self.expr is not None else [])
+        return " && ".join(terms)
+
+
+def negate(expr):
+    if expr.startswith("!defined(") or expr.startswith("!("):
+        return expr[1:]
+    if expr.startswith("defined(") or expr.startswith("("):
+        return "!" + expr
+    return "!(%s)" % expr
+
+
+def directive_expr(directive, arg):
+    if directive in ("ifdef", "ifndef"):
+        expr = ("" if directive == "ifdef" else "!") + "defined(%s)" % arg
+    else:
+        expr = "(%s)" % arg if re.search(r"\s", arg) else arg
+    # with DISPATCH, the AVX backends are compiled with #pragma GCC target, which defines the target macros
+    return expr.replace("defined(__AVX2__)", "(defined(__AVX2__) || defined(DISPATCH))")
+
+
+def parse(directory, filename, stack, out):
+    with open(os.path.join(directory, filename)) as f:
+        text = f.read()
+    # drop the block comments, which may contain directives, keeping the line numbers
+    text = re.sub(r"/\*.*?\*/", lambda m: "\n" * m.group(0).count("\n"), text, flags=re.S)
+    lines = text.split("\n")
+    i = 0
+    while i < len(lines):
+        line = lines[i]
+        if line.lstrip().startswith("#"):
+            while line.endswith("\\") and i + 1 < len(lines):
+                i += 1
+                line = line[:-1] + " " + lines[i].strip()
+            m = re.match(r"\s*#\s*(\w+)\s*(.*)$", line)
+            directive, arg = m.group(1), strip_comments(m.group(2))
+            if directive in ("if", "ifdef", "ifndef"):
+                stack.append(Condition(directive_expr(directive, arg)))
+            elif directive == "elif":
+                stack[-1].elif_(directive_expr("if", arg))
+            elif directive == "else":
+                stack[-1].else_()
+            elif directive == "endif":
+                stack.pop()
+            elif directive == "include":
+                inc = re.match(r'"(simd_utils_\w+\.h)"', arg)
+                if inc and inc.group(1) not in ("simd_utils_constants.h", "simd_utils_types.h", OUTPUT):
+                    parse(directory, inc.group(1), stack, out)
+        elif line.startswith("SIMD_UTILS_API "):
+            signature = line[len("SIMD_UTILS_API "):]
+            while signature.count("(") == 0 or signature.count("(") != signature.count(")"):
+                i += 1
+                signature += " " + lines[i].strip()
+            signature = re.sub(r"\)\s*\{.*$", ")", signature)
+            signature = re.sub(r"\s+", " ", signature).strip()
+            signature = re.sub(r"^([^(]*\w) \(", r"\1(", signature)
+            conditions = [c.text() for c in stack]
+            conditions = [c for c in conditions if c]
+            out.append((filename, conditions, signature + ";"))
+        i += 1
+
+
+def generate(directory):
+    prototypes = []
+    parse(directory, "simd_utils.h", [], prototypes)
+
+    text = [HEADER.rstrip("\n")]
+    current = None
+    for filename, conditions, prototype in prototypes:
+        if "0" in conditions or "!(1)" in conditions or "!1" in conditions:  # #if 0
+            continue
+        conditions = [c for c in conditions if c not in ("1", "!(0)", "!0")]
+        if (filename, conditions) != current:
+            if current is not None and current[1]:
+                text.append("#endif")
+            if current is None or filename != current[0]:
+                text.append("\n// %s" % filename)
+            if conditions:
+                text.append("#if " + " && ".join(conditions))
+            current = (filename, conditions)
+        text.append(prototype)
+    if current is not None and current[1]:
+        text.append("#endif")
+    return "\n".join(text) + "\n"
+
+
+def main():
+    args = sys.argv[1:]
+    check = "--check" in args
+    args = [a for a in args if a != "--check"]
+    directory = args[0] if args else os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+    path = os.path.join(directory, OUTPUT)
+    content = generate(directory)
+    if check:
+        with open(path) as f:
+            if f.read() != content:
+                print("%s is not up to date, run scripts/gen_api_header.py" % path)
+                return 1
+        return 0
+    with open(path, "w") as f:
+        f.write(content)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
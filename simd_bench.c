@@ -0,0 +1,410 @@
+/*
+ * Project : SIMD_Utils
+ * Version : 0.2.6
+ * Author  : JishinMaster
+ * Licence : BSD-2
+ */
+
+/* Benchmark suite : each kernel is run on a sweep of lengths (from L1 to DRAM sizes)
+ * and offsets, and reports median/p99 time, cycles per element and GB/s compared
+ * to a memcpy of the same size (roofline), as text, CSV or JSON.
+ *
+ * Usage : simd_bench [-f text|csv|json] [-k filter] [-l len,len,...] [-o offset,offset,...]
+ *                    [-a alignment] [-r repetitions] [-g ghz]
+ * e.g gcc -DSSE -DAVX -DAVX512 -DFMA -march=native -O3 simd_bench.c -o simd_bench -lm
+ *     ./simd_bench -f csv -k exp > exp.csv
+ */
+
+#include "common_test.h"
+
+#include <stdint.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAS_TSC
+#endif
+
+#define BENCH_MAX_LENS 32
+#define BENCH_MAX_OFFSETS 16
+#define BENCH_MAX_REPS 1001
+// minimum number of elements processed per sample, so that small lengths stay measurable
+#define BENCH_MIN_ELT_PER_SAMPLE 65536
+
+typedef enum {
+    BenchUnary = 0,  // f(src, dst, len)
+    BenchBinary,     // f(src1, src2, dst, len)
+    BenchSincos,     // f(src, dst1, dst2, len)
+    BenchReduce,     // f(src, &result, len)
+    BenchMemcpy      // memcpy(dst, src, len * 4)
+} BenchKernelType;
+
+typedef struct {
+    const char *name;
+    const char *isa;
+    BenchKernelType type;
+    void *func;
+    int bytes_per_elt;  // bytes read + written per element
+} bench_kernel_t;
+
+typedef enum {
+    BenchText = 0,
+    BenchCsv,
+    BenchJson
+} BenchFormat;
+
+typedef struct {
+    double median_ns;
+    double p99_ns;
+    double min_ns;
+    double cycles;  // median cycles for the whole call
+} bench_stats_t;
+
+#define BENCH_UNARY(fn, isa) {#fn, isa, BenchUnary, (void *) fn, 8}
+#define BENCH_BINARY(fn, isa) {#fn, isa, BenchBinary, (void *) fn, 12}
+#define BENCH_SINCOS(fn, isa) {#fn, isa, BenchSincos, (void *) fn, 12}
+#define BENCH_REDUCE(fn, isa) {#fn, isa, BenchReduce, (void *) fn, 4}
+
+static bench_kernel_t bench_kernels[] = {
+    {"memcpy", "C", BenchMemcpy, NULL, 8},
+    BENCH_UNARY(copyf_C, "C"),
+    BENCH_BINARY(addf_c, "C"),
+    BENCH_UNARY(expf_C, "C"),
+    BENCH_UNARY(lnf_C, "C"),
+    BENCH_REDUCE(sumf_C, "C"),
+#if defined(SSE)
+    BENCH_UNARY(copy128f, "SSE"),
+    BENCH_BINARY(add128f, "SSE"),
+    BENCH_BINARY(mul128f, "SSE"),
+    BENCH_UNARY(sqrt128f, "SSE"),
+    BENCH_UNARY(exp128f, "SSE"),
+    BENCH_UNARY(ln128f, "SSE"),
+    BENCH_UNARY(log10128f, "SSE"),
+    BENCH_UNARY(tanh128f, "SSE"),
+    BENCH_UNARY(sin128f, "SSE"),
+    BENCH_SINCOS(sincos128f, "SSE"),
+    BENCH_BINARY(atan2128f, "SSE"),
+    BENCH_REDUCE(sum128f, "SSE"),
+#endif
+#if defined(AVX)
+    BENCH_UNARY(copy256f, "AVX"),
+    BENCH_BINARY(add256f, "AVX"),
+    BENCH_BINARY(mul256f, "AVX"),
+    BENCH_UNARY(sqrt256f, "AVX"),
+    BENCH_UNARY(exp256f, "AVX"),
+    BENCH_UNARY(ln256f, "AVX"),
+    BENCH_UNARY(log10256f, "AVX"),
+    BENCH_UNARY(tanh256f, "AVX"),
+    BENCH_UNARY(sin256f, "AVX"),
+    BENCH_SINCOS(sincos256f, "AVX"),
+    BENCH_BINARY(atan2256f, "AVX"),
+    BENCH_REDUCE(sum256f, "AVX"),
+#endif
+#if defined(AVX512)
+    BENCH_UNARY(copy512f, "AVX512"),
+    BENCH_BINARY(add512f, "AVX512"),
+    BENCH_BINARY(mul512f, "AVX512"),
+    BENCH_UNARY(sqrt512f, "AVX512"),
+    BENCH_UNARY(exp512f, "AVX512"),
+    BENCH_UNARY(ln512f, "AVX512"),
+    BENCH_UNARY(log10512f, "AVX512"),
+    BENCH_UNARY(tanh512f, "AVX512"),
+    BENCH_UNARY(sin512f, "AVX512"),
+    BENCH_SINCOS(sincos512f, "AVX512"),
+    BENCH_BINARY(atan2512f, "AVX512"),
+    BENCH_REDUCE(sum512f, "AVX512"),
+#endif
+#if defined(ICC)
+    BENCH_UNARY(exp128f_svml, "SVML"),
+    BENCH_UNARY(ln128f_svml, "SVML"),
+    BENCH_UNARY(sin128f_svml, "SVML"),
+    BENCH_SINCOS(sincos128f_svml, "SVML"),
+    BENCH_BINARY(atan2128f_svml, "SVML"),
+#if defined(AVX)
+    BENCH_UNARY(exp256f_svml, "SVML"),
+    BENCH_UNARY(ln256f_svml, "SVML"),
+    BENCH_UNARY(sin256f_svml, "SVML"),
+    BENCH_SINCOS(sincos256f_svml, "SVML"),
+    BENCH_BINARY(atan2256f_svml, "SVML"),
+#endif
+#if defined(AVX512)
+    BENCH_UNARY(exp512f_svml, "SVML"),
+    BENCH_UNARY(ln512f_svml, "SVML"),
+    BENCH_UNARY(sin512f_svml, "SVML"),
+    BENCH_SINCOS(sincos512f_svml, "SVML"),
+    BENCH_BINARY(atan2512f_svml, "SVML"),
+#endif
+#endif /* ICC */
+#if defined(AMDLIBM)
+    BENCH_UNARY(exp128f_amdlibm, "AMDLIBM"),
+    BENCH_UNARY(ln128f_amdlibm, "AMDLIBM"),
+    BENCH_UNARY(sin128f_amdlibm, "AMDLIBM"),
+    BENCH_SINCOS(sincos128f_amdlibm, "AMDLIBM"),
+    BENCH_BINARY(atan2128f_amdlibm, "AMDLIBM"),
+#if defined(AVX)
+    BENCH_UNARY(exp256f_amdlibm, "AMDLIBM"),
+    BENCH_UNARY(ln256f_amdlibm, "AMDLIBM"),
+    BENCH_UNARY(sin256f_amdlibm, "AMDLIBM"),
+    BENCH_SINCOS(sincos256f_amdlibm, "AMDLIBM"),
+#endif
+#if defined(AVX512)
+    BENCH_UNARY(exp512f_amdlibm, "AMDLIBM"),
+    BENCH_UNARY(ln512f_amdlibm, "AMDLIBM"),
+    BENCH_UNARY(sin512f_amdlibm, "AMDLIBM"),
+    BENCH_SINCOS(sincos512f_amdlibm, "AMDLIBM"),
+    BENCH_BINARY(atan2512f_amdlibm, "AMDLIBM"),
+#endif
+#endif /* AMDLIBM */
+#if defined(RISCV)
+    BENCH_UNARY(copyf_vec, "RISCV"),
+    BENCH_BINARY(addf_vec, "RISCV"),
+    BENCH_BINARY(mulf_vec, "RISCV"),
+    BENCH_UNARY(sqrtf_vec, "RISCV"),
+    BENCH_UNARY(expf_vec, "RISCV"),
+    BENCH_UNARY(lnf_vec, "RISCV"),
+    BENCH_UNARY(tanhf_vec, "RISCV"),
+    BENCH_UNARY(sinf_vec, "RISCV"),
+    BENCH_SINCOS(sincosf_vec, "RISCV"),
+    BENCH_BINARY(atan2f_vec, "RISCV"),
+    BENCH_REDUCE(sumf_vec, "RISCV"),
+#endif
+};
+
+static inline uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+static inline uint64_t bench_cycles(void)
+{
+#ifdef BENCH_HAS_TSC
+    return __rdtsc();  // reference cycles, not core cycles when turbo is enabled
+#else
+    return 0;
+#endif
+}
+
+static int bench_cmp_double(const void *a, const void *b)
+{
+    double da = *(const double *) a, db = *(const double *) b;
+    return (da > db) - (da < db);
+}
+
+static inline void bench_call(bench_kernel_t *k, float *src1, float *src2, float *dst1, float *dst2, int len)
+{
+    float result;
+
+    switch (k->type) {
+    case BenchUnary:
+        ((void (*)(float *, float *, int)) k->func)(src1, dst1, len);
+        break;
+    case BenchBinary:
+        ((void (*)(float *, float *, float *, int)) k->func)(src1, src2, dst1, len);
+        break;
+    case BenchSincos:
+        ((void (*)(float *, float *, float *, int)) k->func)(src1, dst1, dst2, len);
+        break;
+    case BenchReduce:
+        ((void (*)(float *, float *, int)) k->func)(src1, &result, len);
+        dst1[0] = result;  // keeps the call from being optimized out
+        break;
+    case BenchMemcpy:
+        memcpy(dst1, src1, len * sizeof(float));
+        break;
+    }
+}
+
+static void bench_run(bench_kernel_t *k, float *src1, float *src2, float *dst1, float *dst2, int len, int reps, double *samples, double *cycles, bench_stats_t *stats)
+{
+    int inner = BENCH_MIN_ELT_PER_SAMPLE / len;
+    if (inner < 1)
+        inner = 1;
+
+    bench_call(k, src1, src2, dst1, dst2, len);  // warm up
+
+    for (int r = 0; r < reps; r++) {
+        uint64_t c0 = bench_cycles();
+        uint64_t t0 = bench_now_ns();
+        for (int i = 0; i < inner; i++)
+            bench_call(k, src1, src2, dst1, dst2, len);
+        uint64_t t1 = bench_now_ns();
+        uint64_t c1 = bench_cycles();
+        samples[r] = (double) (t1 - t0) / (double) inner;
+        cycles[r] = (double) (c1 - c0) / (double) inner;
+    }
+
+    qsort(samples, reps, sizeof(double), bench_cmp_double);
+    qsort(cycles, reps, sizeof(double), bench_cmp_double);
+    int p99 = (int) ceil(0.99 * reps) - 1;
+    stats->median_ns = samples[reps / 2];
+    stats->p99_ns = samples[p99];
+    stats->min_ns = samples[0];
+    stats->cycles = cycles[reps / 2];
+}
+
+static int bench_parse_list(const char *str, int *list, int max)
+{
+    int n = 0;
+    const char *p = str;
+    while (*p && n < max) {
+        list[n++] = atoi(p);
+        p = strchr(p, ',');
+        if (p == NULL)
+            break;
+        p++;
+    }
+    return n;
+}
+
+static void bench_usage(void)
+{
+    printf("Usage simd_bench : [-f text|csv|json] [-k filter] [-l len,len,...] [-o offset,offset,...] [-a alignment] [-r repetitions] [-g ghz]\n");
+}
+
+int main(int argc, char **argv)
+{
+    BenchFormat format = BenchText;
+    const char *filter = NULL;
+    // lengths in floats : 4KB (L1), 64KB (L2), 1MB (L2/L3), 8MB (L3), 64MB (DRAM) per array
+    int lens[BENCH_MAX_LENS] = {1024, 16384, 262144, 2097152, 16777216};
+    int nb_lens = 5;
+    int offsets[BENCH_MAX_OFFSETS] = {0, 1};
+    int nb_offsets = 2;
+    int align = 64;
+    int reps = 31;
+    double ghz = 0.0;  // if set, cycles are computed from time instead of the TSC
+
+    for (int i = 1; i < argc; i++) {
+        if ((strcmp(argv[i], "-h") == 0) || (i + 1 >= argc)) {
+            bench_usage();
+            return (strcmp(argv[i], "-h") == 0) ? 0 : -1;
+        }
+        char *opt = argv[i++];
+        char *val = argv[i];
+        if (strcmp(opt, "-f") == 0) {
+            if (strcmp(val, "csv") == 0)
+                format = BenchCsv;
+            else if (strcmp(val, "json") == 0)
+                format = BenchJson;
+            else
+                format = BenchText;
+        } else if (strcmp(opt, "-k") == 0) {
+            filter = val;
+        } else if (strcmp(opt, "-l") == 0) {
+            nb_lens = bench_parse_list(val, lens, BENCH_MAX_LENS);
+        } else if (strcmp(opt, "-o") == 0) {
+            nb_offsets = bench_parse_list(val, offsets, BENCH_MAX_OFFSETS);
+        } else if (strcmp(opt, "-a") == 0) {
+            align = atoi(val);
+        } else if (strcmp(opt, "-r") == 0) {
+            reps = atoi(val);
+        } else if (strcmp(opt, "-g") == 0) {
+            ghz = atof(val);
+        } else {
+            bench_usage();
+            return -1;
+        }
+    }
+
+    if (reps < 1)
+        reps = 1;
+    if (reps > BENCH_MAX_REPS)
+        reps = BENCH_MAX_REPS;
+
+    int max_len = 0, max_offset = 0;
+    for (int i = 0; i < nb_lens; i++)
+        if (lens[i] > max_len)
+            max_len = lens[i];
+    for (int i = 0; i < nb_offsets; i++)
+        if (offsets[i] > max_offset)
+            max_offset = offsets[i];
+
+    float *buf[4];
+    size_t buf_size = (size_t) (max_len + max_offset) * sizeof(float);
+    for (int b = 0; b < 4; b++) {
+        buf[b] = NULL;
+        if (posix_memalign((void **) &buf[b], align, buf_size) != 0 || buf[b] == NULL) {
+            printf("posix_memalign buf[%d] failed\n", b);
+            return -1;
+        }
+    }
+
+    // positive inputs so that ln, sqrt and log10 stay in their domain
+    for (int i = 0; i < max_len + max_offset; i++) {
+        buf[0][i] = 0.1f + (float) (rand() % 10000) / 1000.0f;
+        buf[1][i] = 0.1f + (float) (rand() % 10000) / 1000.0f;
+    }
+    memset(buf[2], 0, buf_size);
+    memset(buf[3], 0, buf_size);
+
+    double *samples = (double *) malloc(reps * sizeof(double));
+    double *cycles = (double *) malloc(reps * sizeof(double));
+    int nb_kernels = sizeof(bench_kernels) / sizeof(bench_kernels[0]);
+    int first = 1;
+
+    if (format == BenchCsv)
+        printf("kernel,isa,len,offset,median_ns,p99_ns,min_ns,cycles_per_elt,elt_per_cycle,gbps,roofline_pct\n");
+    else if (format == BenchJson)
+        printf("{\"alignment\": %d, \"repetitions\": %d, \"results\": [\n", align, reps);
+    else
+        printf("%-22s %-8s %10s %6s %12s %12s %10s %10s %8s %8s\n", "kernel", "isa", "len", "offset", "median_ns", "p99_ns",
+               "cyc/elt", "elt/cyc", "GB/s", "roof%");
+
+    for (int l = 0; l < nb_lens; l++) {
+        int len = lens[l];
+        for (int o = 0; o < nb_offsets; o++) {
+            int offset = offsets[o];
+            float *src1 = buf[0] + offset, *src2 = buf[1] + offset;
+            float *dst1 = buf[2] + offset, *dst2 = buf[3] + offset;
+            bench_stats_t roof;
+
+            // memcpy of the same length gives the achievable bandwidth at this size
+            bench_run(&bench_kernels[0], src1, src2, dst1, dst2, len, reps, samples, cycles, &roof);
+            double roof_gbps = (double) bench_kernels[0].bytes_per_elt * len / roof.median_ns;
+
+            for (int k = 0; k < nb_kernels; k++) {
+                bench_kernel_t *kernel = &bench_kernels[k];
+                bench_stats_t stats;
+
+                if (filter && (strstr(kernel->name, filter) == NULL))
+                    continue;
+
+                if (k == 0)
+                    stats = roof;
+                else
+                    bench_run(kernel, src1, src2, dst1, dst2, len, reps, samples, cycles, &stats);
+
+                double gbps = (double) kernel->bytes_per_elt * len / stats.median_ns;
+                double cyc = (ghz > 0.0) ? stats.median_ns * ghz : stats.cycles;
+                double cyc_per_elt = cyc / len;
+                double elt_per_cyc = (cyc > 0.0) ? len / cyc : 0.0;
+                double roof_pct = 100.0 * gbps / roof_gbps;
+
+                if (format == BenchCsv) {
+                    printf("%s,%s,%d,%d,%.1f,%.1f,%.1f,%.4f,%.4f,%.3f,%.1f\n", kernel->name, kernel->isa, len, offset, stats.median_ns,
+                           stats.p99_ns, stats.min_ns, cyc_per_elt, elt_per_cyc, gbps, roof_pct);
+                } else if (format == BenchJson) {
+                    printf("%s  {\"kernel\": \"%s\", \"isa\": \"%s\", \"len\": %d, \"offset\": %d, \"median_ns\": %.1f, \"p99_ns\": %.1f, "
+                           "\"min_ns\": %.1f, \"cycles_per_elt\": %.4f, \"elt_per_cycle\": %.4f, \"gbps\": %.3f, \"roofline_pct\": %.1f}",
+                           first ? "" : ",\n", kernel->name, kernel->isa, len, offset, stats.median_ns, stats.p99_ns, stats.min_ns,
+                           cyc_per_elt, elt_per_cyc, gbps, roof_pct);
+                } else {
+                    printf("%-22s %-8s %10d %6d %12.1f %12.1f %10.4f %10.4f %8.3f %8.1f\n", kernel->name, kernel->isa, len, offset,
+                           stats.median_ns, stats.p99_ns, cyc_per_elt, elt_per_cyc, gbps, roof_pct);
+                }
+                first = 0;
+            }
+        }
+    }
+
+    if (format == BenchJson)
+        printf("\n]}\n");
+
+    free(samples);
+    free(cycles);
+    for (int b = 0; b < 4; b++)
+        free(buf[b]);
+
+    return 0;
+}
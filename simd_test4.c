@@ -9,6 +9,41 @@
 
 #include <strings.h>
 
+#if defined(THREADPOOL) && defined(AVX)
+// one of the application threads submitting jobs to the pool at the same time
+typedef struct {
+    int *count;  // number of times each element was processed by the job
+    int len;
+    int loop;
+    int errors;  // jobs which did not process each element once
+} concurrent_caller_t;
+
+// sleeps so that the job of the other caller is submitted while this one is running
+static void concurrent_task(void *arg, int start, int end)
+{
+    concurrent_caller_t *c = (concurrent_caller_t *) arg;
+    for (int i = start; i < end; i++)
+        c->count[i]++;
+    usleep(50);
+}
+
+static void *concurrent_caller(void *arg)
+{
+    concurrent_caller_t *c = (concurrent_caller_t *) arg;
+    for (int l = 0; l < c->loop; l++) {
+        memset(c->count, 0, c->len * sizeof(int));
+        threadpool_parallel_for(concurrent_task, c, c->len, 256);
+        for (int i = 0; i < c->len; i++) {
+            if (c->count[i] != 1) {
+                c->errors++;
+                break;
+            }
+        }
+    }
+    return NULL;
+}
+#endif
+
 int main(int argc, char **argv)
 {
 #ifdef IPP
@@ -682,6 +717,68 @@ int main(int argc, char **argv)
 #endif
 #endif
 
+#ifdef AVX512
+    clock_gettime(CLOCK_REALTIME, &start);
+    copy512s(inout_i1, inout_i2, len);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = (stop.tv_sec - start.tv_sec) + (stop.tv_nsec - start.tv_nsec) * 1e-9;
+    printf("copy512s %d BW %lf GB/s\n", len, (GB / elapsed));
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        copy512s(inout_i1, inout_i2, len);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) + (stop.tv_nsec - start.tv_nsec) * 1e-9) / (double) loop;
+    printf("copy512s %d BW %lf GB/s\n", len, (GB / elapsed));
+
+    l2_err_i32(inout_i2, inout_iref, len);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    fast_copy512s(inout_i1, inout_i2, len);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = (stop.tv_sec - start.tv_sec) + (stop.tv_nsec - start.tv_nsec) * 1e-9;
+    printf("fast_copy512s %d BW %lf GB/s\n", len, (GB / elapsed));
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        fast_copy512s(inout_i1, inout_i2, len);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) + (stop.tv_nsec - start.tv_nsec) * 1e-9) / (double) loop;
+    printf("fast_copy512s %d BW %lf GB/s\n", len, (GB / elapsed));
+
+    l2_err_i32(inout_i2, inout_iref, len);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    fast_copy512s_2(inout_i1, inout_i2, len);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = (stop.tv_sec - start.tv_sec) + (stop.tv_nsec - start.tv_nsec) * 1e-9;
+    printf("fast_copy512s_2 %d BW %lf GB/s\n", len, (GB / elapsed));
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        fast_copy512s_2(inout_i1, inout_i2, len);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) + (stop.tv_nsec - start.tv_nsec) * 1e-9) / (double) loop;
+    printf("fast_copy512s_2 %d BW %lf GB/s\n", len, (GB / elapsed));
+
+    l2_err_i32(inout_i2, inout_iref, len);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    fast_copy512s_4(inout_i1, inout_i2, len);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = (stop.tv_sec - start.tv_sec) + (stop.tv_nsec - start.tv_nsec) * 1e-9;
+    printf("fast_copy512s_4 %d BW %lf GB/s\n", len, (GB / elapsed));
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        fast_copy512s_4(inout_i1, inout_i2, len);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) + (stop.tv_nsec - start.tv_nsec) * 1e-9) / (double) loop;
+    printf("fast_copy512s_4 %d BW %lf GB/s\n", len, (GB / elapsed));
+
+    l2_err_i32(inout_i2, inout_iref, len);
+#endif
+
     printf("\n");
     ////////////////////////////////////////////////// MODFF ////////////////////////////////////////////////////////////////////
     printf("MODFF\n");
@@ -1901,6 +1998,4472 @@ int main(int argc, char **argv)
 	printf("%lu %lu\n",lengthstr_ref, lengthstr_ref);
 #endif
 
+    printf("\n");
+    ////////////////////////////////////////////////// PIPELINE ////////////////////////////////////////////////////////////////////
+    printf("PIPELINE\n");
+
+    for (int i = 0; i < len; i++) {
+        inout[i] = (float) (rand() % 8000) / 1000.0f - 4.0f;
+        inout2[i] = (float) (rand() % 8000) / 1000.0f + 0.5f;
+    }
+
+    pipeline_op_t pipe_ops[4];
+    pipe_ops[0].op = PipeMulC;
+    pipe_ops[0].value = 0.5f;
+    pipe_ops[1].op = PipeAddC;
+    pipe_ops[1].value = -1.0f;
+    pipe_ops[2].op = PipeMul;
+    pipe_ops[2].src = inout2;
+    pipe_ops[3].op = PipeExp;
+    float pipe_sum_ref, pipe_sum;
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    pipelinef_C(inout, inout_ref, len, pipe_ops, 4);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = (stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3;
+    printf("pipelinef_C %d %lf\n", len, elapsed);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        pipelinef_sum_C(inout, &pipe_sum_ref, len, pipe_ops, 4);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("pipelinef_sum_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    pipeline128f(inout, inout3, len, pipe_ops, 4);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = (stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3;
+    printf("pipeline128f %d %lf\n", len, elapsed);
+    l2_err(inout_ref, inout3, len);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        mulc128f(inout, 0.5f, inout3, len);
+        addc128f(inout3, -1.0f, inout3, len);
+        mul128f(inout3, inout2, inout3, len);
+        exp128f(inout3, inout3, len);
+        sum128f(inout3, &pipe_sum, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("mulc/addc/mul/exp/sum128f %d %lf\n", len, elapsed);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        pipeline128f_sum(inout, &pipe_sum, len, pipe_ops, 4);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("pipeline128f_sum %d %lf\n", len, elapsed);
+    printf("%g %g\n", pipe_sum_ref, pipe_sum);
+#endif
+
+#if defined(AVX)
+    clock_gettime(CLOCK_REALTIME, &start);
+    pipeline256f(inout, inout3, len, pipe_ops, 4);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = (stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3;
+    printf("pipeline256f %d %lf\n", len, elapsed);
+    l2_err(inout_ref, inout3, len);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        mulc256f(inout, 0.5f, inout3, len);
+        addc256f(inout3, -1.0f, inout3, len);
+        mul256f(inout3, inout2, inout3, len);
+        exp256f(inout3, inout3, len);
+        sum256f(inout3, &pipe_sum, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("mulc/addc/mul/exp/sum256f %d %lf\n", len, elapsed);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        pipeline256f_sum(inout, &pipe_sum, len, pipe_ops, 4);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("pipeline256f_sum %d %lf\n", len, elapsed);
+    printf("%g %g\n", pipe_sum_ref, pipe_sum);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    pipeline512f(inout, inout3, len, pipe_ops, 4);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = (stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3;
+    printf("pipeline512f %d %lf\n", len, elapsed);
+    l2_err(inout_ref, inout3, len);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        mulc512f(inout, 0.5f, inout3, len);
+        addc512f(inout3, -1.0f, inout3, len);
+        mul512f(inout3, inout2, inout3, len);
+        exp512f(inout3, inout3, len);
+        sum512f(inout3, &pipe_sum, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("mulc/addc/mul/exp/sum512f %d %lf\n", len, elapsed);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        pipeline512f_sum(inout, &pipe_sum, len, pipe_ops, 4);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("pipeline512f_sum %d %lf\n", len, elapsed);
+    printf("%g %g\n", pipe_sum_ref, pipe_sum);
+#endif
+
+    printf("\n");
+    ////////////////////////////////////////////////// FFT ////////////////////////////////////////////////////////////////////
+    printf("FFT\n");
+
+    // the plans only exist for power of 2 sizes (at least 2 for the real ones)
+    int bad_fft_sizes[] = {0, 1, 3, 6, 12, 100};
+    for (int i = 0; i < (int) (sizeof(bad_fft_sizes) / sizeof(bad_fft_sizes[0])); i++) {
+        int n = bad_fft_sizes[i];
+        fft_plan32_t *plan32 = (n == 1) ? NULL : fft_plan32_create(n);
+        fft_plan32_t *rplan32 = rfft_plan32_create(n);
+        fft_plan64_t *plan64 = (n == 1) ? NULL : fft_plan64_create(n);
+        fft_plan64_t *rplan64 = rfft_plan64_create(n);
+        if (plan32 || rplan32 || plan64 || rplan64) {
+            printf("FFT plans created for an unsupported size %d\n", n);
+            return -1;
+        }
+    }
+
+    // complex transform of fft_len points and real transform of fft_len points, within len floats
+    int fft_len = 1;
+    while (4 * fft_len <= (len - offset))
+        fft_len *= 2;
+    fft_plan32_t *fft_plan = fft_plan32_create(fft_len);
+    fft_plan32_t *rfft_plan = rfft_plan32_create(fft_len);
+    fft_plan64_t *fft_plan64 = fft_plan64_create(fft_len);
+    fft_plan64_t *rfft_plan64 = rfft_plan64_create(fft_len);
+
+    if (!fft_plan || !rfft_plan || !fft_plan64 || !rfft_plan64) {
+        printf("FFT skipped, %d points\n", fft_len);
+    } else {
+        for (int i = 0; i < 2 * fft_len; i++) {
+            inout[i] = (float) (rand() % 8000) / 1000.0f - 4.0f;
+            inoutd[i] = (double) (rand() % 8000) / 1000.0 - 4.0;
+        }
+
+        fftf_C(fft_plan, (complex32_t *) inout, (complex32_t *) inout_ref);
+        rfftf_C(rfft_plan, inout, (complex32_t *) inout2_ref);
+        fftd_C(fft_plan64, (complex64_t *) inoutd, (complex64_t *) inoutd_ref);
+        rfftd_C(rfft_plan64, inoutd, (complex64_t *) inoutd2_ref);
+
+        clock_gettime(CLOCK_REALTIME, &start);
+        for (l = 0; l < loop; l++)
+            fftf_C(fft_plan, (complex32_t *) inout, (complex32_t *) inout_ref);
+        clock_gettime(CLOCK_REALTIME, &stop);
+        elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+        printf("fftf_C %d %lf\n", fft_len, elapsed);
+
+        // ifft(fft(x)) = fft_len * x
+        ifftf_C(fft_plan, (complex32_t *) inout_ref, (complex32_t *) inout3);
+        for (int i = 0; i < 2 * fft_len; i++)
+            inout3[i] /= (float) fft_len;
+        printf("ifftf_C ");
+        l2_err(inout3, inout, 2 * fft_len);
+
+#if defined(SSE)
+        clock_gettime(CLOCK_REALTIME, &start);
+        for (l = 0; l < loop; l++)
+            fft128f(fft_plan, (complex32_t *) inout, (complex32_t *) inout3);
+        clock_gettime(CLOCK_REALTIME, &stop);
+        elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+        printf("fft128f %d %lf\n", fft_len, elapsed);
+        l2_err(inout3, inout_ref, 2 * fft_len);
+
+        ifft128f(fft_plan, (complex32_t *) inout_ref, (complex32_t *) inout3);
+        for (int i = 0; i < 2 * fft_len; i++)
+            inout3[i] /= (float) fft_len;
+        printf("ifft128f ");
+        l2_err(inout3, inout, 2 * fft_len);
+
+        cplxtorealf_C((complex32_t *) inout, inout4, inout4 + fft_len, fft_len);
+        fft128f_split(fft_plan, inout4, inout4 + fft_len, inout5, inout5 + fft_len);
+        realtocplx_C(inout5, inout5 + fft_len, (complex32_t *) inout3, fft_len);
+        printf("fft128f_split ");
+        l2_err(inout3, inout_ref, 2 * fft_len);
+
+        clock_gettime(CLOCK_REALTIME, &start);
+        for (l = 0; l < loop; l++)
+            rfft128f(rfft_plan, inout, (complex32_t *) inout3);
+        clock_gettime(CLOCK_REALTIME, &stop);
+        elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+        printf("rfft128f %d %lf\n", fft_len, elapsed);
+        l2_err(inout3, inout2_ref, fft_len + 2);
+
+        irfft128f(rfft_plan, (complex32_t *) inout2_ref, inout3);
+        for (int i = 0; i < fft_len; i++)
+            inout3[i] /= (float) fft_len;
+        printf("irfft128f ");
+        l2_err(inout3, inout, fft_len);
+
+        fft128d(fft_plan64, (complex64_t *) inoutd, (complex64_t *) inoutd3);
+        printf("fft128d ");
+        l2_errd(inoutd3, inoutd_ref, 2 * fft_len);
+
+        rfft128d(rfft_plan64, inoutd, (complex64_t *) inoutd3);
+        printf("rfft128d ");
+        l2_errd(inoutd3, inoutd2_ref, fft_len + 2);
+
+        irfft128d(rfft_plan64, (complex64_t *) inoutd2_ref, inoutd3);
+        for (int i = 0; i < fft_len; i++)
+            inoutd3[i] /= (double) fft_len;
+        printf("irfft128d ");
+        l2_errd(inoutd3, inoutd, fft_len);
+#endif
+
+#if defined(AVX)
+        clock_gettime(CLOCK_REALTIME, &start);
+        for (l = 0; l < loop; l++)
+            fft256f(fft_plan, (complex32_t *) inout, (complex32_t *) inout3);
+        clock_gettime(CLOCK_REALTIME, &stop);
+        elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+        printf("fft256f %d %lf\n", fft_len, elapsed);
+        l2_err(inout3, inout_ref, 2 * fft_len);
+
+        ifft256f(fft_plan, (complex32_t *) inout_ref, (complex32_t *) inout3);
+        for (int i = 0; i < 2 * fft_len; i++)
+            inout3[i] /= (float) fft_len;
+        printf("ifft256f ");
+        l2_err(inout3, inout, 2 * fft_len);
+
+        cplxtorealf_C((complex32_t *) inout, inout4, inout4 + fft_len, fft_len);
+        fft256f_split(fft_plan, inout4, inout4 + fft_len, inout5, inout5 + fft_len);
+        realtocplx_C(inout5, inout5 + fft_len, (complex32_t *) inout3, fft_len);
+        printf("fft256f_split ");
+        l2_err(inout3, inout_ref, 2 * fft_len);
+
+        clock_gettime(CLOCK_REALTIME, &start);
+        for (l = 0; l < loop; l++)
+            rfft256f(rfft_plan, inout, (complex32_t *) inout3);
+        clock_gettime(CLOCK_REALTIME, &stop);
+        elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+        printf("rfft256f %d %lf\n", fft_len, elapsed);
+        l2_err(inout3, inout2_ref, fft_len + 2);
+
+        irfft256f(rfft_plan, (complex32_t *) inout2_ref, inout3);
+        for (int i = 0; i < fft_len; i++)
+            inout3[i] /= (float) fft_len;
+        printf("irfft256f ");
+        l2_err(inout3, inout, fft_len);
+
+        fft256d(fft_plan64, (complex64_t *) inoutd, (complex64_t *) inoutd3);
+        printf("fft256d ");
+        l2_errd(inoutd3, inoutd_ref, 2 * fft_len);
+
+        rfft256d(rfft_plan64, inoutd, (complex64_t *) inoutd3);
+        printf("rfft256d ");
+        l2_errd(inoutd3, inoutd2_ref, fft_len + 2);
+
+        irfft256d(rfft_plan64, (complex64_t *) inoutd2_ref, inoutd3);
+        for (int i = 0; i < fft_len; i++)
+            inoutd3[i] /= (double) fft_len;
+        printf("irfft256d ");
+        l2_errd(inoutd3, inoutd, fft_len);
+#endif
+
+#if defined(AVX512)
+        clock_gettime(CLOCK_REALTIME, &start);
+        for (l = 0; l < loop; l++)
+            fft512f(fft_plan, (complex32_t *) inout, (complex32_t *) inout3);
+        clock_gettime(CLOCK_REALTIME, &stop);
+        elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+        printf("fft512f %d %lf\n", fft_len, elapsed);
+        l2_err(inout3, inout_ref, 2 * fft_len);
+
+        ifft512f(fft_plan, (complex32_t *) inout_ref, (complex32_t *) inout3);
+        for (int i = 0; i < 2 * fft_len; i++)
+            inout3[i] /= (float) fft_len;
+        printf("ifft512f ");
+        l2_err(inout3, inout, 2 * fft_len);
+
+        cplxtorealf_C((complex32_t *) inout, inout4, inout4 + fft_len, fft_len);
+        fft512f_split(fft_plan, inout4, inout4 + fft_len, inout5, inout5 + fft_len);
+        realtocplx_C(inout5, inout5 + fft_len, (complex32_t *) inout3, fft_len);
+        printf("fft512f_split ");
+        l2_err(inout3, inout_ref, 2 * fft_len);
+
+        clock_gettime(CLOCK_REALTIME, &start);
+        for (l = 0; l < loop; l++)
+            rfft512f(rfft_plan, inout, (complex32_t *) inout3);
+        clock_gettime(CLOCK_REALTIME, &stop);
+        elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+        printf("rfft512f %d %lf\n", fft_len, elapsed);
+        l2_err(inout3, inout2_ref, fft_len + 2);
+
+        irfft512f(rfft_plan, (complex32_t *) inout2_ref, inout3);
+        for (int i = 0; i < fft_len; i++)
+            inout3[i] /= (float) fft_len;
+        printf("irfft512f ");
+        l2_err(inout3, inout, fft_len);
+
+        fft512d(fft_plan64, (complex64_t *) inoutd, (complex64_t *) inoutd3);
+        printf("fft512d ");
+        l2_errd(inoutd3, inoutd_ref, 2 * fft_len);
+
+        rfft512d(rfft_plan64, inoutd, (complex64_t *) inoutd3);
+        printf("rfft512d ");
+        l2_errd(inoutd3, inoutd2_ref, fft_len + 2);
+
+        irfft512d(rfft_plan64, (complex64_t *) inoutd2_ref, inoutd3);
+        for (int i = 0; i < fft_len; i++)
+            inoutd3[i] /= (double) fft_len;
+        printf("irfft512d ");
+        l2_errd(inoutd3, inoutd, fft_len);
+#endif
+    }
+
+    fft_plan32_destroy(fft_plan);
+    fft_plan32_destroy(rfft_plan);
+    fft_plan64_destroy(fft_plan64);
+    fft_plan64_destroy(rfft_plan64);
+
+    printf("\n");
+    ////////////////////////////////////////////////// FIR ////////////////////////////////////////////////////////////////////
+    printf("FIR\n");
+
+    // fir_len input samples, processed in two calls to check the delay line
+    int fir_len = (len - offset) / 8;
+    int fir_cut = fir_len / 3;
+    int fir_taps = 37;
+    int fir_out_ref, fir_out;
+    float fir_h[37];
+    complex32_t fir_hc[37];
+    for (int k = 0; k < fir_taps; k++) {
+        fir_h[k] = (float) (rand() % 8000) / 8000.0f - 0.5f;
+        fir_hc[k].re = fir_h[k];
+        fir_hc[k].im = (float) (rand() % 8000) / 8000.0f - 0.5f;
+    }
+    fir32_t *fir = fir32_create(fir_h, fir_taps, 1, 1);
+    fir32_t *fir_dec = fir32_create(fir_h, fir_taps, 1, 3);
+    fir32_t *fir_interp = fir32_create(fir_h, fir_taps, 4, 1);
+    fir32_t *fir_cplx = fir32_create_cplx(fir_hc, fir_taps, 1, 3);
+
+    for (int i = 0; i < 2 * fir_len; i++)
+        inout[i] = (float) (rand() % 8000) / 1000.0f - 4.0f;
+    for (int i = 0; i < fir_len; i++) {
+        inout2[i] = inout[2 * i];
+        inout2[fir_len + i] = inout[2 * i + 1];
+    }
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        fir32_reset(fir);
+        firf_C(fir, inout, inout_ref, fir_len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("firf_C %d %d taps %lf\n", fir_len, fir_taps, elapsed);
+
+    // references of the decimation, interpolation and complex filters
+    fir32_reset(fir_dec);
+    fir_out_ref = firf_C(fir_dec, inout, inout4, fir_len);
+    fir32_reset(fir_interp);
+    firf_C(fir_interp, inout, inout2_ref, fir_len);
+    fir32_reset(fir_cplx);
+    firf_cplx_C(fir_cplx, (complex32_t *) inout, (complex32_t *) inout5, fir_len);
+    fir32_reset(fir_cplx);
+    firf_split_C(fir_cplx, inout2, inout2 + fir_len, inout6, inout6 + fir_len, fir_len);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        fir32_reset(fir);
+        fir128f(fir, inout, inout3, fir_len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("fir128f %d %d taps %lf\n", fir_len, fir_taps, elapsed);
+    l2_err(inout3, inout_ref, fir_len);
+
+    fir32_reset(fir);
+    fir_out = fir128f(fir, inout, inout3, fir_cut);
+    fir_out += fir128f(fir, inout + fir_cut, inout3 + fir_out, fir_len - fir_cut);
+    printf("fir128f two calls %d ", fir_out);
+    l2_err(inout3, inout_ref, fir_len);
+
+    fir32_reset(fir_dec);
+    fir_out = fir128f(fir_dec, inout, inout3, fir_cut);
+    fir_out += fir128f(fir_dec, inout + fir_cut, inout3 + fir_out, fir_len - fir_cut);
+    printf("fir128f decimation by 3 %d ", fir_out);
+    l2_err(inout3, inout4, fir_out_ref);
+
+    fir32_reset(fir_interp);
+    fir_out = fir128f(fir_interp, inout, inout_ref + fir_len, fir_cut);
+    fir_out += fir128f(fir_interp, inout + fir_cut, inout_ref + fir_len + fir_out, fir_len - fir_cut);
+    printf("fir128f interpolation by 4 %d ", fir_out);
+    l2_err(inout_ref + fir_len, inout2_ref, 4 * fir_len);
+
+    fir32_reset(fir_cplx);
+    fir_out = fir128f_cplx(fir_cplx, (complex32_t *) inout, (complex32_t *) inout3, fir_cut);
+    fir_out += fir128f_cplx(fir_cplx, (complex32_t *) inout + fir_cut, (complex32_t *) inout3 + fir_out, fir_len - fir_cut);
+    printf("fir128f_cplx decimation by 3 %d ", fir_out);
+    l2_err(inout3, inout5, 2 * fir_out);
+
+    fir32_reset(fir_cplx);
+    fir_out = fir128f_split(fir_cplx, inout2, inout2 + fir_len, inout3, inout3 + fir_len, fir_cut);
+    fir_out += fir128f_split(fir_cplx, inout2 + fir_cut, inout2 + fir_len + fir_cut, inout3 + fir_out, inout3 + fir_len + fir_out, fir_len - fir_cut);
+    printf("fir128f_split decimation by 3 %d ", fir_out);
+    l2_err(inout3, inout6, fir_out);
+    l2_err(inout3 + fir_len, inout6 + fir_len, fir_out);
+#endif
+
+#if defined(AVX)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        fir32_reset(fir);
+        fir256f(fir, inout, inout3, fir_len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("fir256f %d %d taps %lf\n", fir_len, fir_taps, elapsed);
+    l2_err(inout3, inout_ref, fir_len);
+
+    fir32_reset(fir);
+    fir_out = fir256f(fir, inout, inout3, fir_cut);
+    fir_out += fir256f(fir, inout + fir_cut, inout3 + fir_out, fir_len - fir_cut);
+    printf("fir256f two calls %d ", fir_out);
+    l2_err(inout3, inout_ref, fir_len);
+
+    fir32_reset(fir_dec);
+    fir_out = fir256f(fir_dec, inout, inout3, fir_cut);
+    fir_out += fir256f(fir_dec, inout + fir_cut, inout3 + fir_out, fir_len - fir_cut);
+    printf("fir256f decimation by 3 %d ", fir_out);
+    l2_err(inout3, inout4, fir_out_ref);
+
+    fir32_reset(fir_interp);
+    fir_out = fir256f(fir_interp, inout, inout_ref + fir_len, fir_cut);
+    fir_out += fir256f(fir_interp, inout + fir_cut, inout_ref + fir_len + fir_out, fir_len - fir_cut);
+    printf("fir256f interpolation by 4 %d ", fir_out);
+    l2_err(inout_ref + fir_len, inout2_ref, 4 * fir_len);
+
+    fir32_reset(fir_cplx);
+    fir_out = fir256f_cplx(fir_cplx, (complex32_t *) inout, (complex32_t *) inout3, fir_cut);
+    fir_out += fir256f_cplx(fir_cplx, (complex32_t *) inout + fir_cut, (complex32_t *) inout3 + fir_out, fir_len - fir_cut);
+    printf("fir256f_cplx decimation by 3 %d ", fir_out);
+    l2_err(inout3, inout5, 2 * fir_out);
+
+    fir32_reset(fir_cplx);
+    fir_out = fir256f_split(fir_cplx, inout2, inout2 + fir_len, inout3, inout3 + fir_len, fir_cut);
+    fir_out += fir256f_split(fir_cplx, inout2 + fir_cut, inout2 + fir_len + fir_cut, inout3 + fir_out, inout3 + fir_len + fir_out, fir_len - fir_cut);
+    printf("fir256f_split decimation by 3 %d ", fir_out);
+    l2_err(inout3, inout6, fir_out);
+    l2_err(inout3 + fir_len, inout6 + fir_len, fir_out);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        fir32_reset(fir);
+        fir512f(fir, inout, inout3, fir_len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("fir512f %d %d taps %lf\n", fir_len, fir_taps, elapsed);
+    l2_err(inout3, inout_ref, fir_len);
+
+    fir32_reset(fir);
+    fir_out = fir512f(fir, inout, inout3, fir_cut);
+    fir_out += fir512f(fir, inout + fir_cut, inout3 + fir_out, fir_len - fir_cut);
+    printf("fir512f two calls %d ", fir_out);
+    l2_err(inout3, inout_ref, fir_len);
+
+    fir32_reset(fir_dec);
+    fir_out = fir512f(fir_dec, inout, inout3, fir_cut);
+    fir_out += fir512f(fir_dec, inout + fir_cut, inout3 + fir_out, fir_len - fir_cut);
+    printf("fir512f decimation by 3 %d ", fir_out);
+    l2_err(inout3, inout4, fir_out_ref);
+
+    fir32_reset(fir_interp);
+    fir_out = fir512f(fir_interp, inout, inout_ref + fir_len, fir_cut);
+    fir_out += fir512f(fir_interp, inout + fir_cut, inout_ref + fir_len + fir_out, fir_len - fir_cut);
+    printf("fir512f interpolation by 4 %d ", fir_out);
+    l2_err(inout_ref + fir_len, inout2_ref, 4 * fir_len);
+
+    fir32_reset(fir_cplx);
+    fir_out = fir512f_cplx(fir_cplx, (complex32_t *) inout, (complex32_t *) inout3, fir_cut);
+    fir_out += fir512f_cplx(fir_cplx, (complex32_t *) inout + fir_cut, (complex32_t *) inout3 + fir_out, fir_len - fir_cut);
+    printf("fir512f_cplx decimation by 3 %d ", fir_out);
+    l2_err(inout3, inout5, 2 * fir_out);
+
+    fir32_reset(fir_cplx);
+    fir_out = fir512f_split(fir_cplx, inout2, inout2 + fir_len, inout3, inout3 + fir_len, fir_cut);
+    fir_out += fir512f_split(fir_cplx, inout2 + fir_cut, inout2 + fir_len + fir_cut, inout3 + fir_out, inout3 + fir_len + fir_out, fir_len - fir_cut);
+    printf("fir512f_split decimation by 3 %d ", fir_out);
+    l2_err(inout3, inout6, fir_out);
+    l2_err(inout3 + fir_len, inout6 + fir_len, fir_out);
+#endif
+
+    fir32_destroy(fir);
+    fir32_destroy(fir_dec);
+    fir32_destroy(fir_interp);
+    fir32_destroy(fir_cplx);
+
+    printf("\n");
+    ////////////////////////////////////////////////// IIR ////////////////////////////////////////////////////////////////////
+    printf("IIR\n");
+
+    // 2 biquads, on a single channel (len frames) and on 20 interleaved channels (len / 20 frames)
+    float iir_coefs[10] = {0.0675f, 0.135f, 0.0675f, -1.143f, 0.4128f, 1.0f, -1.8f, 0.9f, -1.6f, 0.7f};
+    int iir_len = len - offset;
+    int iir_chans = 20;
+    int iir_frames = iir_len / iir_chans;
+    int iir_cut = iir_frames / 3;
+    float iir_err = 0.0f;  // sum of the L2 errors, NaN if a filter blew up
+    iir32_t *iir = iir32_create(iir_coefs, 2, 1);
+    iir32_t *iir_multi = iir32_create(iir_coefs, 2, iir_chans);
+
+    for (int i = 0; i < iir_len; i++)
+        inout[i] = (float) (rand() % 8000) / 1000.0f - 4.0f;
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        iir32_reset(iir);
+        iirf_C(iir, inout, inout_ref, iir_len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("iirf_C %d %lf\n", iir_len, elapsed);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        iir32_reset(iir_multi);
+        iirf_C(iir_multi, inout, inout2_ref, iir_frames);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("iirf_C %d channels %d %lf\n", iir_chans, iir_frames, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        iir32_reset(iir);
+        iir128f(iir, inout, inout3, iir_len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("iir128f %d %lf\n", iir_len, elapsed);
+    iir_err += l2_err(inout3, inout_ref, iir_len);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        iir32_reset(iir_multi);
+        iir128f(iir_multi, inout, inout3, iir_frames);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("iir128f %d channels %d %lf\n", iir_chans, iir_frames, elapsed);
+    iir_err += l2_err(inout3, inout2_ref, iir_frames * iir_chans);
+
+    iir32_reset(iir_multi);
+    iir128f(iir_multi, inout, inout3, iir_cut);
+    iir128f(iir_multi, inout + iir_cut * iir_chans, inout3 + iir_cut * iir_chans, iir_frames - iir_cut);
+    printf("iir128f %d channels two calls ", iir_chans);
+    iir_err += l2_err(inout3, inout2_ref, iir_frames * iir_chans);
+#endif
+
+#if defined(AVX)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        iir32_reset(iir);
+        iir256f(iir, inout, inout3, iir_len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("iir256f %d %lf\n", iir_len, elapsed);
+    iir_err += l2_err(inout3, inout_ref, iir_len);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        iir32_reset(iir_multi);
+        iir256f(iir_multi, inout, inout3, iir_frames);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("iir256f %d channels %d %lf\n", iir_chans, iir_frames, elapsed);
+    iir_err += l2_err(inout3, inout2_ref, iir_frames * iir_chans);
+
+    iir32_reset(iir_multi);
+    iir256f(iir_multi, inout, inout3, iir_cut);
+    iir256f(iir_multi, inout + iir_cut * iir_chans, inout3 + iir_cut * iir_chans, iir_frames - iir_cut);
+    printf("iir256f %d channels two calls ", iir_chans);
+    iir_err += l2_err(inout3, inout2_ref, iir_frames * iir_chans);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        iir32_reset(iir);
+        iir512f(iir, inout, inout3, iir_len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("iir512f %d %lf\n", iir_len, elapsed);
+    iir_err += l2_err(inout3, inout_ref, iir_len);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        iir32_reset(iir_multi);
+        iir512f(iir_multi, inout, inout3, iir_frames);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("iir512f %d channels %d %lf\n", iir_chans, iir_frames, elapsed);
+    iir_err += l2_err(inout3, inout2_ref, iir_frames * iir_chans);
+
+    iir32_reset(iir_multi);
+    iir512f(iir_multi, inout, inout3, iir_cut);
+    iir512f(iir_multi, inout + iir_cut * iir_chans, inout3 + iir_cut * iir_chans, iir_frames - iir_cut);
+    printf("iir512f %d channels two calls ", iir_chans);
+    iir_err += l2_err(inout3, inout2_ref, iir_frames * iir_chans);
+#endif
+
+    iir32_destroy(iir);
+    iir32_destroy(iir_multi);
+    if (!isfinite(iir_err)) {
+        printf("IIR L2 error is not finite\n");
+        return -1;
+    }
+
+    printf("\n");
+    ////////////////////////////////////////////////// CONV ////////////////////////////////////////////////////////////////////
+    printf("CONV\n");
+
+    // direct form (17 taps) and overlap-save (300 taps), processed in two calls
+    int conv_len = (len - offset) / 2;
+    int conv_cut = conv_len / 3;
+    float conv_h[2 * 300];
+    double conv_hd[300];
+    for (int k = 0; k < 2 * 300; k++)
+        conv_h[k] = (float) (rand() % 8000) / 8000.0f - 0.5f;
+    for (int k = 0; k < 300; k++)
+        conv_hd[k] = (double) conv_h[k];
+    conv32_t *conv = conv32_create(conv_h, 17);
+    conv32_t *xcorr = xcorr32_create(conv_h, 300);
+    conv32_t *xcorr_cplx = xcorr32_create_cplx((complex32_t *) conv_h, 300);
+    conv64_t *convd = conv64_create(conv_hd, 300);
+
+    for (int i = 0; i < 2 * conv_len; i++) {
+        inout[i] = (float) (rand() % 8000) / 1000.0f - 4.0f;
+        inoutd[i] = (double) (rand() % 8000) / 1000.0 - 4.0;
+    }
+
+    convf_C(conv, inout, inout4, conv_len);
+    convf_cplx_C(xcorr_cplx, (complex32_t *) inout, (complex32_t *) inout2_ref, conv_len);
+    convd_C(convd, inoutd, inoutd_ref, conv_len);
+    cplxvecmuld_C((complex64_t *) inoutd, (complex64_t *) inoutd_ref, (complex64_t *) inoutd2_ref, conv_len);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        conv32_reset(xcorr);
+        convf_C(xcorr, inout, inout_ref, conv_len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("convf_C xcorr %d 300 taps %lf\n", conv_len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        conv32_reset(xcorr);
+        conv128f(xcorr, inout, inout3, conv_len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("conv128f xcorr %d 300 taps %lf\n", conv_len, elapsed);
+    l2_err(inout3, inout_ref, conv_len);
+
+    conv32_reset(conv);
+    conv128f(conv, inout, inout3, conv_cut);
+    conv128f(conv, inout + conv_cut, inout3 + conv_cut, conv_len - conv_cut);
+    printf("conv128f 17 taps two calls ");
+    l2_err(inout3, inout4, conv_len);
+
+    conv32_reset(xcorr_cplx);
+    conv128f_cplx(xcorr_cplx, (complex32_t *) inout, (complex32_t *) inout3, conv_cut);
+    conv128f_cplx(xcorr_cplx, (complex32_t *) inout + conv_cut, (complex32_t *) inout3 + conv_cut, conv_len - conv_cut);
+    printf("conv128f_cplx xcorr 300 taps two calls ");
+    l2_err(inout3, inout2_ref, 2 * conv_len);
+
+    conv64_reset(convd);
+    conv128d(convd, inoutd, inoutd3, conv_cut);
+    conv128d(convd, inoutd + conv_cut, inoutd3 + conv_cut, conv_len - conv_cut);
+    printf("conv128d 300 taps two calls ");
+    l2_errd(inoutd3, inoutd_ref, conv_len);
+
+    cplxvecmul128d((complex64_t *) inoutd, (complex64_t *) inoutd_ref, (complex64_t *) inoutd3, conv_len);
+    printf("cplxvecmul128d ");
+    l2_errd(inoutd3, inoutd2_ref, 2 * conv_len);
+#endif
+
+#if defined(AVX)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        conv32_reset(xcorr);
+        conv256f(xcorr, inout, inout3, conv_len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("conv256f xcorr %d 300 taps %lf\n", conv_len, elapsed);
+    l2_err(inout3, inout_ref, conv_len);
+
+    conv32_reset(conv);
+    conv256f(conv, inout, inout3, conv_cut);
+    conv256f(conv, inout + conv_cut, inout3 + conv_cut, conv_len - conv_cut);
+    printf("conv256f 17 taps two calls ");
+    l2_err(inout3, inout4, conv_len);
+
+    conv32_reset(xcorr_cplx);
+    conv256f_cplx(xcorr_cplx, (complex32_t *) inout, (complex32_t *) inout3, conv_cut);
+    conv256f_cplx(xcorr_cplx, (complex32_t *) inout + conv_cut, (complex32_t *) inout3 + conv_cut, conv_len - conv_cut);
+    printf("conv256f_cplx xcorr 300 taps two calls ");
+    l2_err(inout3, inout2_ref, 2 * conv_len);
+
+    conv64_reset(convd);
+    conv256d(convd, inoutd, inoutd3, conv_cut);
+    conv256d(convd, inoutd + conv_cut, inoutd3 + conv_cut, conv_len - conv_cut);
+    printf("conv256d 300 taps two calls ");
+    l2_errd(inoutd3, inoutd_ref, conv_len);
+
+    cplxvecmul256d((complex64_t *) inoutd, (complex64_t *) inoutd_ref, (complex64_t *) inoutd3, conv_len);
+    printf("cplxvecmul256d ");
+    l2_errd(inoutd3, inoutd2_ref, 2 * conv_len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        conv32_reset(xcorr);
+        conv512f(xcorr, inout, inout3, conv_len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("conv512f xcorr %d 300 taps %lf\n", conv_len, elapsed);
+    l2_err(inout3, inout_ref, conv_len);
+
+    conv32_reset(conv);
+    conv512f(conv, inout, inout3, conv_cut);
+    conv512f(conv, inout + conv_cut, inout3 + conv_cut, conv_len - conv_cut);
+    printf("conv512f 17 taps two calls ");
+    l2_err(inout3, inout4, conv_len);
+
+    conv32_reset(xcorr_cplx);
+    conv512f_cplx(xcorr_cplx, (complex32_t *) inout, (complex32_t *) inout3, conv_cut);
+    conv512f_cplx(xcorr_cplx, (complex32_t *) inout + conv_cut, (complex32_t *) inout3 + conv_cut, conv_len - conv_cut);
+    printf("conv512f_cplx xcorr 300 taps two calls ");
+    l2_err(inout3, inout2_ref, 2 * conv_len);
+
+    conv64_reset(convd);
+    conv512d(convd, inoutd, inoutd3, conv_cut);
+    conv512d(convd, inoutd + conv_cut, inoutd3 + conv_cut, conv_len - conv_cut);
+    printf("conv512d 300 taps two calls ");
+    l2_errd(inoutd3, inoutd_ref, conv_len);
+
+    cplxvecmul512d((complex64_t *) inoutd, (complex64_t *) inoutd_ref, (complex64_t *) inoutd3, conv_len);
+    printf("cplxvecmul512d ");
+    l2_errd(inoutd3, inoutd2_ref, 2 * conv_len);
+#endif
+
+    conv32_destroy(conv);
+    conv32_destroy(xcorr);
+    conv32_destroy(xcorr_cplx);
+    conv64_destroy(convd);
+
+    printf("\n");
+    ////////////////////////////////////////////////// LOC ////////////////////////////////////////////////////////////////////
+    printf("LOC\n");
+
+    // small range of values so that the extrema appear several times (the first one is returned)
+    for (int i = 0; i < len; i++) {
+        int r = rand() % 2000 - 1000;
+        inout[i] = (float) r;
+        inoutd[i] = (double) r;
+        inout_i1[i] = r * 1000;
+        inout_s1[i] = (int16_t) r;
+    }
+
+    float loc_min_ref, loc_max_ref, loc_min, loc_max;
+    double locd_min_ref, locd_max_ref, locd_min, locd_max;
+    int32_t locs_min_ref, locs_max_ref, locs_min, locs_max;
+    int16_t loc16s_min_ref, loc16s_max_ref, loc16s_min, loc16s_max;
+    int loc_min_idx_ref, loc_max_idx_ref, loc_min_idx, loc_max_idx;
+    int locd_min_idx_ref, locd_max_idx_ref, locs_min_idx_ref, locs_max_idx_ref, loc16s_min_idx_ref, loc16s_max_idx_ref;
+
+    minmaxlocd_C(inoutd, len, &locd_min_ref, &locd_min_idx_ref, &locd_max_ref, &locd_max_idx_ref);
+    minmaxlocs_C(inout_i1, len, &locs_min_ref, &locs_min_idx_ref, &locs_max_ref, &locs_max_idx_ref);
+    minmaxloc16s_C(inout_s1, len, &loc16s_min_ref, &loc16s_min_idx_ref, &loc16s_max_ref, &loc16s_max_idx_ref);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        minmaxlocf_C(inout, len, &loc_min_ref, &loc_min_idx_ref, &loc_max_ref, &loc_max_idx_ref);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("minmaxlocf_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        minmaxloc128f(inout, len, &loc_min, &loc_min_idx, &loc_max, &loc_max_idx);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("minmaxloc128f %d %lf\n", len, elapsed);
+    printf("%f %d %f %d || %f %d %f %d\n", loc_min_ref, loc_min_idx_ref, loc_max_ref, loc_max_idx_ref, loc_min, loc_min_idx, loc_max, loc_max_idx);
+
+    maxloc128f(inout, &loc_max, &loc_max_idx, len);
+    minloc128f(inout, &loc_min, &loc_min_idx, len);
+    printf("maxloc128f minloc128f %d %d || %d %d\n", loc_max_idx_ref, loc_min_idx_ref, loc_max_idx, loc_min_idx);
+
+    minmaxloc128d(inoutd, len, &locd_min, &loc_min_idx, &locd_max, &loc_max_idx);
+    printf("minmaxloc128d %lf %d %lf %d || %lf %d %lf %d\n", locd_min_ref, locd_min_idx_ref, locd_max_ref, locd_max_idx_ref, locd_min, loc_min_idx, locd_max, loc_max_idx);
+
+    minmaxloc128s(inout_i1, len, &locs_min, &loc_min_idx, &locs_max, &loc_max_idx);
+    printf("minmaxloc128s %d %d %d %d || %d %d %d %d\n", locs_min_ref, locs_min_idx_ref, locs_max_ref, locs_max_idx_ref, locs_min, loc_min_idx, locs_max, loc_max_idx);
+
+    minmaxloc16s_128s(inout_s1, len, &loc16s_min, &loc_min_idx, &loc16s_max, &loc_max_idx);
+    printf("minmaxloc16s_128s %d %d %d %d || %d %d %d %d\n", loc16s_min_ref, loc16s_min_idx_ref, loc16s_max_ref, loc16s_max_idx_ref, loc16s_min, loc_min_idx, loc16s_max, loc_max_idx);
+#endif
+
+#if defined(AVX)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        minmaxloc256f(inout, len, &loc_min, &loc_min_idx, &loc_max, &loc_max_idx);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("minmaxloc256f %d %lf\n", len, elapsed);
+    printf("%f %d %f %d || %f %d %f %d\n", loc_min_ref, loc_min_idx_ref, loc_max_ref, loc_max_idx_ref, loc_min, loc_min_idx, loc_max, loc_max_idx);
+
+    maxloc256f(inout, &loc_max, &loc_max_idx, len);
+    minloc256f(inout, &loc_min, &loc_min_idx, len);
+    printf("maxloc256f minloc256f %d %d || %d %d\n", loc_max_idx_ref, loc_min_idx_ref, loc_max_idx, loc_min_idx);
+
+    minmaxloc256d(inoutd, len, &locd_min, &loc_min_idx, &locd_max, &loc_max_idx);
+    printf("minmaxloc256d %lf %d %lf %d || %lf %d %lf %d\n", locd_min_ref, locd_min_idx_ref, locd_max_ref, locd_max_idx_ref, locd_min, loc_min_idx, locd_max, loc_max_idx);
+
+    minmaxloc256s(inout_i1, len, &locs_min, &loc_min_idx, &locs_max, &loc_max_idx);
+    printf("minmaxloc256s %d %d %d %d || %d %d %d %d\n", locs_min_ref, locs_min_idx_ref, locs_max_ref, locs_max_idx_ref, locs_min, loc_min_idx, locs_max, loc_max_idx);
+
+    minmaxloc16s_256s(inout_s1, len, &loc16s_min, &loc_min_idx, &loc16s_max, &loc_max_idx);
+    printf("minmaxloc16s_256s %d %d %d %d || %d %d %d %d\n", loc16s_min_ref, loc16s_min_idx_ref, loc16s_max_ref, loc16s_max_idx_ref, loc16s_min, loc_min_idx, loc16s_max, loc_max_idx);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        minmaxloc512f(inout, len, &loc_min, &loc_min_idx, &loc_max, &loc_max_idx);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("minmaxloc512f %d %lf\n", len, elapsed);
+    printf("%f %d %f %d || %f %d %f %d\n", loc_min_ref, loc_min_idx_ref, loc_max_ref, loc_max_idx_ref, loc_min, loc_min_idx, loc_max, loc_max_idx);
+
+    maxloc512f(inout, &loc_max, &loc_max_idx, len);
+    minloc512f(inout, &loc_min, &loc_min_idx, len);
+    printf("maxloc512f minloc512f %d %d || %d %d\n", loc_max_idx_ref, loc_min_idx_ref, loc_max_idx, loc_min_idx);
+
+    minmaxloc512d(inoutd, len, &locd_min, &loc_min_idx, &locd_max, &loc_max_idx);
+    printf("minmaxloc512d %lf %d %lf %d || %lf %d %lf %d\n", locd_min_ref, locd_min_idx_ref, locd_max_ref, locd_max_idx_ref, locd_min, loc_min_idx, locd_max, loc_max_idx);
+
+    minmaxloc512s(inout_i1, len, &locs_min, &loc_min_idx, &locs_max, &loc_max_idx);
+    printf("minmaxloc512s %d %d %d %d || %d %d %d %d\n", locs_min_ref, locs_min_idx_ref, locs_max_ref, locs_max_idx_ref, locs_min, loc_min_idx, locs_max, loc_max_idx);
+
+    minmaxloc16s_512s(inout_s1, len, &loc16s_min, &loc_min_idx, &loc16s_max, &loc_max_idx);
+    printf("minmaxloc16s_512s %d %d %d %d || %d %d %d %d\n", loc16s_min_ref, loc16s_min_idx_ref, loc16s_max_ref, loc16s_max_idx_ref, loc16s_min, loc_min_idx, loc16s_max, loc_max_idx);
+#endif
+
+    printf("\n");
+    ////////////////////////////////////////////////// SUM ////////////////////////////////////////////////////////////////////
+    printf("SUM\n");
+
+    // large offset so that the plain sums lose the low bits of the values
+    for (int i = 0; i < len; i++) {
+        inout[i] = 1000.0f + (float) (rand() % 1000) * 0.001f;
+        inout2[i] = (float) (rand() % 1000) * 0.001f;
+        inoutd[i] = 1e10 + (double) (rand() % 1000) * 0.001;
+        inoutd2[i] = (double) (rand() % 1000) * 0.001;
+    }
+
+    float sum_ref, sum_res, sum_kahan, sum_pairwise, dot_ref;
+    double sumd_ref, sumd_res, sumd_kahan, sumd_pairwise, dotd_ref;
+    complex32_t dotc_ref, dotc_res, dotc_kahan, dotc_pairwise;
+    complex64_t dotcd_ref, dotcd_kahan, dotcd_pairwise;
+
+    meanf_C_precise(inout, &sum_ref, len);
+    sum_ref *= (float) len;
+    dotf_C_precise(inout, inout2, len, &dot_ref);
+    dotcf_C_precise((complex32_t *) inout, (complex32_t *) inout2, len / 2, &dotc_ref);
+    sumkahand_C(inoutd, &sumd_ref, len);
+    dotkahand_C(inoutd, inoutd2, len, &dotd_ref);
+    dotckahand_C((complex64_t *) inoutd, (complex64_t *) inoutd2, len / 2, &dotcd_ref);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        sumf_C(inout, &sum_res, len);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sumf_C %d %lf\n", len, elapsed);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        sumkahanf_C(inout, &sum_kahan, len);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sumkahanf_C %d %lf\n", len, elapsed);
+    printf("sumf_C %.9g || plain %.9g kahan %.9g\n", sum_ref, sum_res, sum_kahan);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        sum128f(inout, &sum_res, len);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sum128f %d %lf\n", len, elapsed);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        sumkahan128f(inout, &sum_kahan, len);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sumkahan128f %d %lf\n", len, elapsed);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        sumpairwise128f(inout, &sum_pairwise, len);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sumpairwise128f %d %lf\n", len, elapsed);
+    printf("sum128f %.9g || plain %.9g kahan %.9g pairwise %.9g\n", sum_ref, sum_res, sum_kahan, sum_pairwise);
+
+    dot128f(inout, inout2, len, &sum_res);
+    dotkahan128f(inout, inout2, len, &sum_kahan);
+    dotpairwise128f(inout, inout2, len, &sum_pairwise);
+    printf("dot128f %.9g || plain %.9g kahan %.9g pairwise %.9g\n", dot_ref, sum_res, sum_kahan, sum_pairwise);
+
+    dotc128f((complex32_t *) inout, (complex32_t *) inout2, len / 2, &dotc_res);
+    dotckahan128f((complex32_t *) inout, (complex32_t *) inout2, len / 2, &dotc_kahan);
+    dotcpairwise128f((complex32_t *) inout, (complex32_t *) inout2, len / 2, &dotc_pairwise);
+    printf("dotc128f %.9g %.9g || plain %.9g %.9g kahan %.9g %.9g pairwise %.9g %.9g\n", dotc_ref.re, dotc_ref.im, dotc_res.re, dotc_res.im,
+           dotc_kahan.re, dotc_kahan.im, dotc_pairwise.re, dotc_pairwise.im);
+
+    sum128d(inoutd, &sumd_res, len);
+    sumkahan128d(inoutd, &sumd_kahan, len);
+    sumpairwise128d(inoutd, &sumd_pairwise, len);
+    printf("sum128d %.17g || plain %.17g kahan %.17g pairwise %.17g\n", sumd_ref, sumd_res, sumd_kahan, sumd_pairwise);
+
+    dot128d(inoutd, inoutd2, len, &sumd_res);
+    dotkahan128d(inoutd, inoutd2, len, &sumd_kahan);
+    dotpairwise128d(inoutd, inoutd2, len, &sumd_pairwise);
+    printf("dot128d %.17g || plain %.17g kahan %.17g pairwise %.17g\n", dotd_ref, sumd_res, sumd_kahan, sumd_pairwise);
+
+    dotckahan128d((complex64_t *) inoutd, (complex64_t *) inoutd2, len / 2, &dotcd_kahan);
+    dotcpairwise128d((complex64_t *) inoutd, (complex64_t *) inoutd2, len / 2, &dotcd_pairwise);
+    printf("dotc128d %.17g %.17g || kahan %.17g %.17g pairwise %.17g %.17g\n", dotcd_ref.re, dotcd_ref.im, dotcd_kahan.re, dotcd_kahan.im,
+           dotcd_pairwise.re, dotcd_pairwise.im);
+#endif
+
+#if defined(AVX)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        sum256f(inout, &sum_res, len);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sum256f %d %lf\n", len, elapsed);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        sumkahan256f(inout, &sum_kahan, len);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sumkahan256f %d %lf\n", len, elapsed);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        sumpairwise256f(inout, &sum_pairwise, len);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sumpairwise256f %d %lf\n", len, elapsed);
+    printf("sum256f %.9g || plain %.9g kahan %.9g pairwise %.9g\n", sum_ref, sum_res, sum_kahan, sum_pairwise);
+
+    dot256f(inout, inout2, len, &sum_res);
+    dotkahan256f(inout, inout2, len, &sum_kahan);
+    dotpairwise256f(inout, inout2, len, &sum_pairwise);
+    printf("dot256f %.9g || plain %.9g kahan %.9g pairwise %.9g\n", dot_ref, sum_res, sum_kahan, sum_pairwise);
+
+    dotc256f((complex32_t *) inout, (complex32_t *) inout2, len / 2, &dotc_res);
+    dotckahan256f((complex32_t *) inout, (complex32_t *) inout2, len / 2, &dotc_kahan);
+    dotcpairwise256f((complex32_t *) inout, (complex32_t *) inout2, len / 2, &dotc_pairwise);
+    printf("dotc256f %.9g %.9g || plain %.9g %.9g kahan %.9g %.9g pairwise %.9g %.9g\n", dotc_ref.re, dotc_ref.im, dotc_res.re, dotc_res.im,
+           dotc_kahan.re, dotc_kahan.im, dotc_pairwise.re, dotc_pairwise.im);
+
+    sum256d(inoutd, &sumd_res, len);
+    sumkahan256d(inoutd, &sumd_kahan, len);
+    sumpairwise256d(inoutd, &sumd_pairwise, len);
+    printf("sum256d %.17g || plain %.17g kahan %.17g pairwise %.17g\n", sumd_ref, sumd_res, sumd_kahan, sumd_pairwise);
+
+    dot256d(inoutd, inoutd2, len, &sumd_res);
+    dotkahan256d(inoutd, inoutd2, len, &sumd_kahan);
+    dotpairwise256d(inoutd, inoutd2, len, &sumd_pairwise);
+    printf("dot256d %.17g || plain %.17g kahan %.17g pairwise %.17g\n", dotd_ref, sumd_res, sumd_kahan, sumd_pairwise);
+
+    dotckahan256d((complex64_t *) inoutd, (complex64_t *) inoutd2, len / 2, &dotcd_kahan);
+    dotcpairwise256d((complex64_t *) inoutd, (complex64_t *) inoutd2, len / 2, &dotcd_pairwise);
+    printf("dotc256d %.17g %.17g || kahan %.17g %.17g pairwise %.17g %.17g\n", dotcd_ref.re, dotcd_ref.im, dotcd_kahan.re, dotcd_kahan.im,
+           dotcd_pairwise.re, dotcd_pairwise.im);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        sum512f(inout, &sum_res, len);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sum512f %d %lf\n", len, elapsed);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        sumkahan512f(inout, &sum_kahan, len);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sumkahan512f %d %lf\n", len, elapsed);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        sumpairwise512f(inout, &sum_pairwise, len);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sumpairwise512f %d %lf\n", len, elapsed);
+    printf("sum512f %.9g || plain %.9g kahan %.9g pairwise %.9g\n", sum_ref, sum_res, sum_kahan, sum_pairwise);
+
+    dot512f(inout, inout2, len, &sum_res);
+    dotkahan512f(inout, inout2, len, &sum_kahan);
+    dotpairwise512f(inout, inout2, len, &sum_pairwise);
+    printf("dot512f %.9g || plain %.9g kahan %.9g pairwise %.9g\n", dot_ref, sum_res, sum_kahan, sum_pairwise);
+
+    dotc512f((complex32_t *) inout, (complex32_t *) inout2, len / 2, &dotc_res);
+    dotckahan512f((complex32_t *) inout, (complex32_t *) inout2, len / 2, &dotc_kahan);
+    dotcpairwise512f((complex32_t *) inout, (complex32_t *) inout2, len / 2, &dotc_pairwise);
+    printf("dotc512f %.9g %.9g || plain %.9g %.9g kahan %.9g %.9g pairwise %.9g %.9g\n", dotc_ref.re, dotc_ref.im, dotc_res.re, dotc_res.im,
+           dotc_kahan.re, dotc_kahan.im, dotc_pairwise.re, dotc_pairwise.im);
+
+    sum512d(inoutd, &sumd_res, len);
+    sumkahan512d(inoutd, &sumd_kahan, len);
+    sumpairwise512d(inoutd, &sumd_pairwise, len);
+    printf("sum512d %.17g || plain %.17g kahan %.17g pairwise %.17g\n", sumd_ref, sumd_res, sumd_kahan, sumd_pairwise);
+
+    dot512d(inoutd, inoutd2, len, &sumd_res);
+    dotkahan512d(inoutd, inoutd2, len, &sumd_kahan);
+    dotpairwise512d(inoutd, inoutd2, len, &sumd_pairwise);
+    printf("dot512d %.17g || plain %.17g kahan %.17g pairwise %.17g\n", dotd_ref, sumd_res, sumd_kahan, sumd_pairwise);
+
+    dotckahan512d((complex64_t *) inoutd, (complex64_t *) inoutd2, len / 2, &dotcd_kahan);
+    dotcpairwise512d((complex64_t *) inoutd, (complex64_t *) inoutd2, len / 2, &dotcd_pairwise);
+    printf("dotc512d %.17g %.17g || kahan %.17g %.17g pairwise %.17g %.17g\n", dotcd_ref.re, dotcd_ref.im, dotcd_kahan.re, dotcd_kahan.im,
+           dotcd_pairwise.re, dotcd_pairwise.im);
+#endif
+
+    printf("\n");
+    ////////////////////////////////////////////////// MOMENTS ////////////////////////////////////////////////////////////////////
+    printf("MOMENTS\n");
+
+    // large mean and small variance, where the textbook sum of squares loses every digit
+    for (int i = 0; i < len; i++) {
+        float x = (float) (rand() % 1000) * 0.001f;
+        inout[i] = 1000.0f + x * x;
+        inoutd[i] = (double) inout[i];
+    }
+
+    moments_t mom_ref, mom_res, mom_half;
+    moments_init(&mom_ref);
+    momentsd_C(inoutd, len, &mom_ref);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        moments_init(&mom_res);
+        momentsf_C(inout, len, &mom_res);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("momentsf_C %d %lf\n", len, elapsed);
+    print_moments("momentsf_C", &mom_ref, &mom_res);
+
+#if defined(SSE)
+    moments_init(&mom_res);
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        moments_init(&mom_res);
+        moments128f(inout, len, &mom_res);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("moments128f %d %lf\n", len, elapsed);
+    print_moments("moments128f", &mom_ref, &mom_res);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        moments_init(&mom_res);
+        moments128d(inoutd, len, &mom_res);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("moments128d %d %lf\n", len, elapsed);
+    print_moments("moments128d", &mom_ref, &mom_res);
+
+    // moments of the two halves merged
+    moments_init(&mom_res);
+    moments_init(&mom_half);
+    moments128d(inoutd, len / 2, &mom_res);
+    moments128d(inoutd + len / 2, len - len / 2, &mom_half);
+    moments_merge(&mom_res, &mom_half);
+    print_moments("moments_merge", &mom_ref, &mom_res);
+#endif
+
+#if defined(AVX)
+    moments_init(&mom_res);
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        moments_init(&mom_res);
+        moments256f(inout, len, &mom_res);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("moments256f %d %lf\n", len, elapsed);
+    print_moments("moments256f", &mom_ref, &mom_res);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        moments_init(&mom_res);
+        moments256d(inoutd, len, &mom_res);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("moments256d %d %lf\n", len, elapsed);
+    print_moments("moments256d", &mom_ref, &mom_res);
+
+    // moments of the two halves merged
+    moments_init(&mom_res);
+    moments_init(&mom_half);
+    moments256d(inoutd, len / 2, &mom_res);
+    moments256d(inoutd + len / 2, len - len / 2, &mom_half);
+    moments_merge(&mom_res, &mom_half);
+    print_moments("moments_merge", &mom_ref, &mom_res);
+#endif
+
+#if defined(AVX512)
+    moments_init(&mom_res);
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        moments_init(&mom_res);
+        moments512f(inout, len, &mom_res);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("moments512f %d %lf\n", len, elapsed);
+    print_moments("moments512f", &mom_ref, &mom_res);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        moments_init(&mom_res);
+        moments512d(inoutd, len, &mom_res);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("moments512d %d %lf\n", len, elapsed);
+    print_moments("moments512d", &mom_ref, &mom_res);
+
+    // moments of the two halves merged
+    moments_init(&mom_res);
+    moments_init(&mom_half);
+    moments512d(inoutd, len / 2, &mom_res);
+    moments512d(inoutd + len / 2, len - len / 2, &mom_half);
+    moments_merge(&mom_res, &mom_half);
+    print_moments("moments_merge", &mom_ref, &mom_res);
+#endif
+
+    printf("\n");
+    ////////////////////////////////////////////////// HISTOGRAM ////////////////////////////////////////////////////////////////////
+    printf("HISTOGRAM\n");
+
+    // flat areas (runs of the same value) and values outside of the bins
+    uint32_t hist_ref[256], hist_res[256];
+    float hist_edges[65];
+    for (int i = 0; i < len; i++) {
+        int run = (i / 16) % 4 == 0;
+        int value = run ? 7 : (rand() % 2000) - 1000;
+        inout_u1[i] = (uint8_t) (run ? 7 : rand());
+        inout_s1[i] = (int16_t) value;
+        inout_i1[i] = value * 1000;
+        inout[i] = (float) value * 0.0011f;
+    }
+    for (int i = 0; i <= 64; i++) {
+        float x = (float) (i - 32) / 32.0f;
+        hist_edges[i] = x * fabsf(x);  // finer bins around 0
+    }
+
+    memset(hist_ref, 0, sizeof(hist_ref));
+    histogramu8_C(inout_u1, len, hist_ref);
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memset(hist_res, 0, sizeof(hist_res));
+        histogramu8_C(inout_u1, len, hist_res);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("histogramu8_C %d %lf\n", len, elapsed);
+    print_hist("histogramu8_C", hist_ref, hist_res, 256);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memset(hist_res, 0, sizeof(hist_res));
+        histogramu8_128(inout_u1, len, hist_res);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("histogramu8_128 %d %lf\n", len, elapsed);
+    print_hist("histogramu8_128", hist_ref, hist_res, 256);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memset(hist_res, 0, sizeof(hist_res));
+        histogramu8_256(inout_u1, len, hist_res);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("histogramu8_256 %d %lf\n", len, elapsed);
+    print_hist("histogramu8_256", hist_ref, hist_res, 256);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memset(hist_res, 0, sizeof(hist_res));
+        histogramu8_512(inout_u1, len, hist_res);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("histogramu8_512 %d %lf\n", len, elapsed);
+    print_hist("histogramu8_512", hist_ref, hist_res, 256);
+#endif
+
+    memset(hist_ref, 0, sizeof(hist_ref));
+    histogram16s_C(inout_s1, len, -800, 4, 100, hist_ref);
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memset(hist_res, 0, sizeof(hist_res));
+        histogram16s_C(inout_s1, len, -800, 4, 100, hist_res);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("histogram16s_C %d %lf\n", len, elapsed);
+    print_hist("histogram16s_C", hist_ref, hist_res, 100);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memset(hist_res, 0, sizeof(hist_res));
+        histogram16s_128s(inout_s1, len, -800, 4, 100, hist_res);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("histogram16s_128s %d %lf\n", len, elapsed);
+    print_hist("histogram16s_128s", hist_ref, hist_res, 100);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memset(hist_res, 0, sizeof(hist_res));
+        histogram16s_256s(inout_s1, len, -800, 4, 100, hist_res);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("histogram16s_256s %d %lf\n", len, elapsed);
+    print_hist("histogram16s_256s", hist_ref, hist_res, 100);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memset(hist_res, 0, sizeof(hist_res));
+        histogram16s_512s(inout_s1, len, -800, 4, 100, hist_res);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("histogram16s_512s %d %lf\n", len, elapsed);
+    print_hist("histogram16s_512s", hist_ref, hist_res, 100);
+#endif
+
+    memset(hist_ref, 0, sizeof(hist_ref));
+    histograms_C(inout_i1, len, -800000, 14, 100, hist_ref);
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memset(hist_res, 0, sizeof(hist_res));
+        histograms_C(inout_i1, len, -800000, 14, 100, hist_res);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("histograms_C %d %lf\n", len, elapsed);
+    print_hist("histograms_C", hist_ref, hist_res, 100);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memset(hist_res, 0, sizeof(hist_res));
+        histogram128s(inout_i1, len, -800000, 14, 100, hist_res);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("histogram128s %d %lf\n", len, elapsed);
+    print_hist("histogram128s", hist_ref, hist_res, 100);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memset(hist_res, 0, sizeof(hist_res));
+        histogram256s(inout_i1, len, -800000, 14, 100, hist_res);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("histogram256s %d %lf\n", len, elapsed);
+    print_hist("histogram256s", hist_ref, hist_res, 100);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memset(hist_res, 0, sizeof(hist_res));
+        histogram512s(inout_i1, len, -800000, 14, 100, hist_res);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("histogram512s %d %lf\n", len, elapsed);
+    print_hist("histogram512s", hist_ref, hist_res, 100);
+#endif
+
+    memset(hist_ref, 0, sizeof(hist_ref));
+    histogramf_C(inout, len, -1.0f, 1.0f, 100, hist_ref);
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memset(hist_res, 0, sizeof(hist_res));
+        histogramf_C(inout, len, -1.0f, 1.0f, 100, hist_res);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("histogramf_C %d %lf\n", len, elapsed);
+    print_hist("histogramf_C", hist_ref, hist_res, 100);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memset(hist_res, 0, sizeof(hist_res));
+        histogram128f(inout, len, -1.0f, 1.0f, 100, hist_res);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("histogram128f %d %lf\n", len, elapsed);
+    print_hist("histogram128f", hist_ref, hist_res, 100);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memset(hist_res, 0, sizeof(hist_res));
+        histogram256f(inout, len, -1.0f, 1.0f, 100, hist_res);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("histogram256f %d %lf\n", len, elapsed);
+    print_hist("histogram256f", hist_ref, hist_res, 100);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memset(hist_res, 0, sizeof(hist_res));
+        histogram512f(inout, len, -1.0f, 1.0f, 100, hist_res);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("histogram512f %d %lf\n", len, elapsed);
+    print_hist("histogram512f", hist_ref, hist_res, 100);
+#endif
+
+    memset(hist_ref, 0, sizeof(hist_ref));
+    histogramf_edges_C(inout, len, hist_edges, 64, hist_ref);
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memset(hist_res, 0, sizeof(hist_res));
+        histogramf_edges_C(inout, len, hist_edges, 64, hist_res);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("histogramf_edges_C %d %lf\n", len, elapsed);
+    print_hist("histogramf_edges_C", hist_ref, hist_res, 64);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memset(hist_res, 0, sizeof(hist_res));
+        histogram128f_edges(inout, len, hist_edges, 64, hist_res);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("histogram128f_edges %d %lf\n", len, elapsed);
+    print_hist("histogram128f_edges", hist_ref, hist_res, 64);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memset(hist_res, 0, sizeof(hist_res));
+        histogram256f_edges(inout, len, hist_edges, 64, hist_res);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("histogram256f_edges %d %lf\n", len, elapsed);
+    print_hist("histogram256f_edges", hist_ref, hist_res, 64);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memset(hist_res, 0, sizeof(hist_res));
+        histogram512f_edges(inout, len, hist_edges, 64, hist_res);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("histogram512f_edges %d %lf\n", len, elapsed);
+    print_hist("histogram512f_edges", hist_ref, hist_res, 64);
+#endif
+
+    printf("\n");
+    ////////////////////////////////////////////////// PREFIX SUM ////////////////////////////////////////////////////////////////////
+    printf("PREFIX SUM\n");
+
+    for (int i = 0; i < len; i++) {
+        inout[i] = (float) (rand() % 1000) * 0.001f;
+        inout_i1[i] = rand() % 2000 - 1000;
+        inout_s1[i] = (int16_t) (rand() % 200 - 100);
+    }
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        prefixsumf_C(inout, inout_ref, len, NULL);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("prefixsumf_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        prefixsum128f(inout, inout2, len, NULL);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("prefixsum128f %d %lf\n", len, elapsed);
+    l2_err(inout_ref, inout2, len);
+#endif
+
+#if defined(AVX)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        prefixsum256f(inout, inout2, len, NULL);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("prefixsum256f %d %lf\n", len, elapsed);
+    l2_err(inout_ref, inout2, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        prefixsum512f(inout, inout2, len, NULL);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("prefixsum512f %d %lf\n", len, elapsed);
+    l2_err(inout_ref, inout2, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        prefixsumf_excl_C(inout, inout_ref, len, NULL);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("prefixsumf_excl_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        prefixsum128f_excl(inout, inout2, len, NULL);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("prefixsum128f_excl %d %lf\n", len, elapsed);
+    l2_err(inout_ref, inout2, len);
+#endif
+
+#if defined(AVX)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        prefixsum256f_excl(inout, inout2, len, NULL);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("prefixsum256f_excl %d %lf\n", len, elapsed);
+    l2_err(inout_ref, inout2, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        prefixsum512f_excl(inout, inout2, len, NULL);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("prefixsum512f_excl %d %lf\n", len, elapsed);
+    l2_err(inout_ref, inout2, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        difff_C(inout, inout_ref, len, NULL);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("difff_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        diff128f(inout, inout2, len, NULL);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("diff128f %d %lf\n", len, elapsed);
+    l2_err(inout_ref, inout2, len);
+#endif
+
+#if defined(AVX)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        diff256f(inout, inout2, len, NULL);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("diff256f %d %lf\n", len, elapsed);
+    l2_err(inout_ref, inout2, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        diff512f(inout, inout2, len, NULL);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("diff512f %d %lf\n", len, elapsed);
+    l2_err(inout_ref, inout2, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        prefixsums_C(inout_i1, inout_iref, len, NULL);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("prefixsums_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        prefixsum128s(inout_i1, inout_i2, len, NULL);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("prefixsum128s %d %lf\n", len, elapsed);
+    l2_err_i32(inout_iref, inout_i2, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        prefixsum256s(inout_i1, inout_i2, len, NULL);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("prefixsum256s %d %lf\n", len, elapsed);
+    l2_err_i32(inout_iref, inout_i2, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        prefixsum512s(inout_i1, inout_i2, len, NULL);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("prefixsum512s %d %lf\n", len, elapsed);
+    l2_err_i32(inout_iref, inout_i2, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        prefixsum16s_C(inout_s1, inout_sref, len, NULL);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("prefixsum16s_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        prefixsum16s_128s(inout_s1, inout_s2, len, NULL);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("prefixsum16s_128s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s2, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        prefixsum16s_256s(inout_s1, inout_s2, len, NULL);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("prefixsum16s_256s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s2, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        prefixsum16s_512s(inout_s1, inout_s2, len, NULL);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("prefixsum16s_512s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s2, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        diff16s_C(inout_s1, inout_sref, len, NULL);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("diff16s_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        diff16s_128s(inout_s1, inout_s2, len, NULL);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("diff16s_128s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s2, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        diff16s_256s(inout_s1, inout_s2, len, NULL);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("diff16s_256s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s2, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        diff16s_512s(inout_s1, inout_s2, len, NULL);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("diff16s_512s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s2, len);
+#endif
+
+    printf("\n");
+    ////////////////////////////////////////////////// SORT ////////////////////////////////////////////////////////////////////
+    printf("SORT\n");
+
+    for (int i = 0; i < len; i++) {
+        inout[i] = (float) (rand() % 100000) * 0.01f - 500.0f;
+        inoutd[i] = (double) (rand() % 100000) * 0.01 - 500.0;
+        inout_i1[i] = rand() - RAND_MAX / 2;
+    }
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memcpy(inout_ref, inout, len * sizeof(float));
+        sortf_C(inout_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sortf_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memcpy(inout2, inout, len * sizeof(float));
+        sort128f(inout2, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sort128f %d %lf\n", len, elapsed);
+    l2_err(inout_ref, inout2, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memcpy(inout2, inout, len * sizeof(float));
+        sort256f(inout2, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sort256f %d %lf\n", len, elapsed);
+    l2_err(inout_ref, inout2, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memcpy(inout2, inout, len * sizeof(float));
+        sort512f(inout2, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sort512f %d %lf\n", len, elapsed);
+    l2_err(inout_ref, inout2, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memcpy(inoutd_ref, inoutd, len * sizeof(double));
+        sortd_C(inoutd_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sortd_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memcpy(inoutd2, inoutd, len * sizeof(double));
+        sort128d(inoutd2, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sort128d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memcpy(inoutd2, inoutd, len * sizeof(double));
+        sort256d(inoutd2, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sort256d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memcpy(inoutd2, inoutd, len * sizeof(double));
+        sort512d(inoutd2, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sort512d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memcpy(inout_iref, inout_i1, len * sizeof(int32_t));
+        sorts_C(inout_iref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sorts_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memcpy(inout_i3, inout_i1, len * sizeof(int32_t));
+        sort128s(inout_i3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sort128s %d %lf\n", len, elapsed);
+    l2_err_i32(inout_iref, inout_i3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memcpy(inout_i3, inout_i1, len * sizeof(int32_t));
+        sort256s(inout_i3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sort256s %d %lf\n", len, elapsed);
+    l2_err_i32(inout_iref, inout_i3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memcpy(inout_i3, inout_i1, len * sizeof(int32_t));
+        sort512s(inout_i3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sort512s %d %lf\n", len, elapsed);
+    l2_err_i32(inout_iref, inout_i3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memcpy(inout_ref, inout, len * sizeof(float));
+        for (int i = 0; i < len; i++)
+            inout_iref[i] = i;
+        sortf_kv_C(inout_ref, inout_iref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sortf_kv_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memcpy(inout2, inout, len * sizeof(float));
+        for (int i = 0; i < len; i++)
+            inout_i2[i] = i;
+        sort128f_kv(inout2, inout_i2, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sort128f_kv %d %lf\n", len, elapsed);
+    l2_err(inout_ref, inout2, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memcpy(inout2, inout, len * sizeof(float));
+        for (int i = 0; i < len; i++)
+            inout_i2[i] = i;
+        sort256f_kv(inout2, inout_i2, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sort256f_kv %d %lf\n", len, elapsed);
+    l2_err(inout_ref, inout2, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        memcpy(inout2, inout, len * sizeof(float));
+        for (int i = 0; i < len; i++)
+            inout_i2[i] = i;
+        sort512f_kv(inout2, inout_i2, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sort512f_kv %d %lf\n", len, elapsed);
+    l2_err(inout_ref, inout2, len);
+#endif
+
+    printf("\n");
+    ////////////////////////////////////////////////// TOP K ////////////////////////////////////////////////////////////////////
+    printf("TOP K\n");
+
+    for (int i = 0; i < len; i++) {
+        inout[i] = (float) (rand() % 100000) * 0.01f - 500.0f;
+        inout_i1[i] = rand() - RAND_MAX / 2;
+    }
+
+    {
+        int k = (len < 64) ? len : 64;
+
+        clock_gettime(CLOCK_REALTIME, &start);
+        for (l = 0; l < loop; l++) {
+            topkf_C(inout, len, k, inout_ref, inout_iref);
+        }
+        clock_gettime(CLOCK_REALTIME, &stop);
+        elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+        printf("topkf_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+        clock_gettime(CLOCK_REALTIME, &start);
+        for (l = 0; l < loop; l++) {
+            topk128f(inout, len, k, inout2, inout_i2);
+        }
+        clock_gettime(CLOCK_REALTIME, &stop);
+        elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+        printf("topk128f %d %lf\n", len, elapsed);
+        l2_err(inout_ref, inout2, k);
+        l2_err_i32(inout_iref, inout_i2, k);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+        clock_gettime(CLOCK_REALTIME, &start);
+        for (l = 0; l < loop; l++) {
+            topk256f(inout, len, k, inout2, inout_i2);
+        }
+        clock_gettime(CLOCK_REALTIME, &stop);
+        elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+        printf("topk256f %d %lf\n", len, elapsed);
+        l2_err(inout_ref, inout2, k);
+        l2_err_i32(inout_iref, inout_i2, k);
+#endif
+
+#if defined(AVX512)
+        clock_gettime(CLOCK_REALTIME, &start);
+        for (l = 0; l < loop; l++) {
+            topk512f(inout, len, k, inout2, inout_i2);
+        }
+        clock_gettime(CLOCK_REALTIME, &stop);
+        elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+        printf("topk512f %d %lf\n", len, elapsed);
+        l2_err(inout_ref, inout2, k);
+        l2_err_i32(inout_iref, inout_i2, k);
+#endif
+
+        clock_gettime(CLOCK_REALTIME, &start);
+        for (l = 0; l < loop; l++) {
+            bottomkf_C(inout, len, k, inout_ref, inout_iref);
+        }
+        clock_gettime(CLOCK_REALTIME, &stop);
+        elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+        printf("bottomkf_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+        clock_gettime(CLOCK_REALTIME, &start);
+        for (l = 0; l < loop; l++) {
+            bottomk128f(inout, len, k, inout2, inout_i2);
+        }
+        clock_gettime(CLOCK_REALTIME, &stop);
+        elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+        printf("bottomk128f %d %lf\n", len, elapsed);
+        l2_err(inout_ref, inout2, k);
+        l2_err_i32(inout_iref, inout_i2, k);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+        clock_gettime(CLOCK_REALTIME, &start);
+        for (l = 0; l < loop; l++) {
+            bottomk256f(inout, len, k, inout2, inout_i2);
+        }
+        clock_gettime(CLOCK_REALTIME, &stop);
+        elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+        printf("bottomk256f %d %lf\n", len, elapsed);
+        l2_err(inout_ref, inout2, k);
+        l2_err_i32(inout_iref, inout_i2, k);
+#endif
+
+#if defined(AVX512)
+        clock_gettime(CLOCK_REALTIME, &start);
+        for (l = 0; l < loop; l++) {
+            bottomk512f(inout, len, k, inout2, inout_i2);
+        }
+        clock_gettime(CLOCK_REALTIME, &stop);
+        elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+        printf("bottomk512f %d %lf\n", len, elapsed);
+        l2_err(inout_ref, inout2, k);
+        l2_err_i32(inout_iref, inout_i2, k);
+#endif
+
+        clock_gettime(CLOCK_REALTIME, &start);
+        for (l = 0; l < loop; l++) {
+            topks_C(inout_i1, len, k, inout_iref, inout_i3);
+        }
+        clock_gettime(CLOCK_REALTIME, &stop);
+        elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+        printf("topks_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+        clock_gettime(CLOCK_REALTIME, &start);
+        for (l = 0; l < loop; l++) {
+            topk128s(inout_i1, len, k, inout_i2, inout_i3);
+        }
+        clock_gettime(CLOCK_REALTIME, &stop);
+        elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+        printf("topk128s %d %lf\n", len, elapsed);
+        l2_err_i32(inout_iref, inout_i2, k);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+        clock_gettime(CLOCK_REALTIME, &start);
+        for (l = 0; l < loop; l++) {
+            topk256s(inout_i1, len, k, inout_i2, inout_i3);
+        }
+        clock_gettime(CLOCK_REALTIME, &stop);
+        elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+        printf("topk256s %d %lf\n", len, elapsed);
+        l2_err_i32(inout_iref, inout_i2, k);
+#endif
+
+#if defined(AVX512)
+        clock_gettime(CLOCK_REALTIME, &start);
+        for (l = 0; l < loop; l++) {
+            topk512s(inout_i1, len, k, inout_i2, inout_i3);
+        }
+        clock_gettime(CLOCK_REALTIME, &stop);
+        elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+        printf("topk512s %d %lf\n", len, elapsed);
+        l2_err_i32(inout_iref, inout_i2, k);
+#endif
+
+        clock_gettime(CLOCK_REALTIME, &start);
+        for (l = 0; l < loop; l++) {
+            memcpy(inout_ref, inout, len * sizeof(float));
+            partialsortf_C(inout_ref, len, k);
+        }
+        clock_gettime(CLOCK_REALTIME, &stop);
+        elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+        printf("partialsortf_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+        clock_gettime(CLOCK_REALTIME, &start);
+        for (l = 0; l < loop; l++) {
+            memcpy(inout2, inout, len * sizeof(float));
+            partialsort128f(inout2, len, k);
+        }
+        clock_gettime(CLOCK_REALTIME, &stop);
+        elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+        printf("partialsort128f %d %lf\n", len, elapsed);
+        l2_err(inout_ref, inout2, k);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+        clock_gettime(CLOCK_REALTIME, &start);
+        for (l = 0; l < loop; l++) {
+            memcpy(inout2, inout, len * sizeof(float));
+            partialsort256f(inout2, len, k);
+        }
+        clock_gettime(CLOCK_REALTIME, &stop);
+        elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+        printf("partialsort256f %d %lf\n", len, elapsed);
+        l2_err(inout_ref, inout2, k);
+#endif
+
+#if defined(AVX512)
+        clock_gettime(CLOCK_REALTIME, &start);
+        for (l = 0; l < loop; l++) {
+            memcpy(inout2, inout, len * sizeof(float));
+            partialsort512f(inout2, len, k);
+        }
+        clock_gettime(CLOCK_REALTIME, &stop);
+        elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+        printf("partialsort512f %d %lf\n", len, elapsed);
+        l2_err(inout_ref, inout2, k);
+#endif
+    }
+
+    printf("\n");
+    ////////////////////////////////////////////////// SOFTMAX DOUBLE ////////////////////////////////////////////////////////////////
+    printf("SOFTMAX DOUBLE\n");
+
+    for (int i = 0; i < len; i++) {
+        inoutd[i] = (double) (rand() % 100000) * 0.001 - 50.0;
+    }
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        softmaxd_C(inoutd, inoutd_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("softmaxd_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        softmax128d(inoutd, inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("softmax128d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        softmax256d(inoutd, inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("softmax256d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        softmax512d(inoutd, inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("softmax512d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+    printf("\n");
+    ////////////////////////////////////////////////// COMPLEX DOUBLE ////////////////////////////////////////////////////////////////
+    printf("COMPLEX DOUBLE\n");
+
+    for (int i = 0; i < 2 * len; i++) {
+        inoutd[i] = (double) (rand() % 100000) * 0.001 - 50.0;
+        inoutd2[i] = (double) (rand() % 100000) * 0.001 - 50.0;
+    }
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cplxconjvecmuld_C((complex64_t *) inoutd, (complex64_t *) inoutd2, (complex64_t *) inoutd_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cplxconjvecmuld_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cplxconjvecmul128d((complex64_t *) inoutd, (complex64_t *) inoutd2, (complex64_t *) inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cplxconjvecmul128d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, 2 * len);
+#endif
+
+#if defined(AVX)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cplxconjvecmul256d((complex64_t *) inoutd, (complex64_t *) inoutd2, (complex64_t *) inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cplxconjvecmul256d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, 2 * len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cplxconjvecmul512d((complex64_t *) inoutd, (complex64_t *) inoutd2, (complex64_t *) inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cplxconjvecmul512d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, 2 * len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cplxvecdivd_C((complex64_t *) inoutd, (complex64_t *) inoutd2, (complex64_t *) inoutd_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cplxvecdivd_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cplxvecdiv128d((complex64_t *) inoutd, (complex64_t *) inoutd2, (complex64_t *) inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cplxvecdiv128d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, 2 * len);
+#endif
+
+#if defined(AVX)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cplxvecdiv256d((complex64_t *) inoutd, (complex64_t *) inoutd2, (complex64_t *) inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cplxvecdiv256d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, 2 * len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cplxvecdiv512d((complex64_t *) inoutd, (complex64_t *) inoutd2, (complex64_t *) inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cplxvecdiv512d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, 2 * len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cplxconjd_C((complex64_t *) inoutd, (complex64_t *) inoutd_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cplxconjd_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cplxconj128d((complex64_t *) inoutd, (complex64_t *) inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cplxconj128d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, 2 * len);
+#endif
+
+#if defined(AVX)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cplxconj256d((complex64_t *) inoutd, (complex64_t *) inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cplxconj256d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, 2 * len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cplxconj512d((complex64_t *) inoutd, (complex64_t *) inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cplxconj512d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, 2 * len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cplxvecmuld_C_split(inoutd, inoutd + len, inoutd2, inoutd2 + len, inoutd_ref, inoutd_ref + len, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cplxvecmuld_C_split %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cplxvecmul128d_split(inoutd, inoutd + len, inoutd2, inoutd2 + len, inoutd2_ref, inoutd2_ref + len, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cplxvecmul128d_split %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, 2 * len);
+#endif
+
+#if defined(AVX)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cplxvecmul256d_split(inoutd, inoutd + len, inoutd2, inoutd2 + len, inoutd2_ref, inoutd2_ref + len, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cplxvecmul256d_split %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, 2 * len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cplxvecmul512d_split(inoutd, inoutd + len, inoutd2, inoutd2 + len, inoutd2_ref, inoutd2_ref + len, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cplxvecmul512d_split %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, 2 * len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cplxconjvecmuld_C_split(inoutd, inoutd + len, inoutd2, inoutd2 + len, inoutd_ref, inoutd_ref + len, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cplxconjvecmuld_C_split %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cplxconjvecmul128d_split(inoutd, inoutd + len, inoutd2, inoutd2 + len, inoutd2_ref, inoutd2_ref + len, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cplxconjvecmul128d_split %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, 2 * len);
+#endif
+
+#if defined(AVX)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cplxconjvecmul256d_split(inoutd, inoutd + len, inoutd2, inoutd2 + len, inoutd2_ref, inoutd2_ref + len, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cplxconjvecmul256d_split %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, 2 * len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cplxconjvecmul512d_split(inoutd, inoutd + len, inoutd2, inoutd2 + len, inoutd2_ref, inoutd2_ref + len, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cplxconjvecmul512d_split %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, 2 * len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cplxvecdivd_C_split(inoutd, inoutd + len, inoutd2, inoutd2 + len, inoutd_ref, inoutd_ref + len, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cplxvecdivd_C_split %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cplxvecdiv128d_split(inoutd, inoutd + len, inoutd2, inoutd2 + len, inoutd2_ref, inoutd2_ref + len, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cplxvecdiv128d_split %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, 2 * len);
+#endif
+
+#if defined(AVX)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cplxvecdiv256d_split(inoutd, inoutd + len, inoutd2, inoutd2 + len, inoutd2_ref, inoutd2_ref + len, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cplxvecdiv256d_split %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, 2 * len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cplxvecdiv512d_split(inoutd, inoutd + len, inoutd2, inoutd2 + len, inoutd2_ref, inoutd2_ref + len, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cplxvecdiv512d_split %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, 2 * len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        magnituded_C_interleaved((complex64_t *) inoutd, inoutd_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("magnituded_C_interleaved %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        magnitude128d_interleaved((complex64_t *) inoutd, inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("magnitude128d_interleaved %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+#if defined(AVX)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        magnitude256d_interleaved((complex64_t *) inoutd, inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("magnitude256d_interleaved %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        magnitude512d_interleaved((complex64_t *) inoutd, inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("magnitude512d_interleaved %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        magnituded_C_split(inoutd, inoutd + len, inoutd_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("magnituded_C_split %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        magnitude128d_split(inoutd, inoutd + len, inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("magnitude128d_split %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+#if defined(AVX)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        magnitude256d_split(inoutd, inoutd + len, inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("magnitude256d_split %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        magnitude512d_split(inoutd, inoutd + len, inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("magnitude512d_split %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        powerspectd_C_interleaved((complex64_t *) inoutd, inoutd_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("powerspectd_C_interleaved %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        powerspect128d_interleaved((complex64_t *) inoutd, inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("powerspect128d_interleaved %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+#if defined(AVX)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        powerspect256d_interleaved((complex64_t *) inoutd, inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("powerspect256d_interleaved %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        powerspect512d_interleaved((complex64_t *) inoutd, inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("powerspect512d_interleaved %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        powerspectd_C_split(inoutd, inoutd + len, inoutd_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("powerspectd_C_split %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        powerspect128d_split(inoutd, inoutd + len, inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("powerspect128d_split %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+#if defined(AVX)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        powerspect256d_split(inoutd, inoutd + len, inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("powerspect256d_split %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        powerspect512d_split(inoutd, inoutd + len, inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("powerspect512d_split %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+    printf("\n");
+    ////////////////////////////////////////////////// THRESHOLD DOUBLE ////////////////////////////////////////////////////////////////
+    printf("THRESHOLD DOUBLE\n");
+
+    for (int i = 0; i < len; i++) {
+        inoutd[i] = (double) (rand() % 100000) * 0.001 - 50.0;
+        inoutd2[i] = (double) (rand() % 100000) * 0.001 - 50.0;
+    }
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        fabsd_C(inoutd, inoutd_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("fabsd_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        fabs128d(inoutd, inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("fabs128d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+#if defined(AVX)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        fabs256d(inoutd, inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("fabs256d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        fabs512d(inoutd, inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("fabs512d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        maxeveryd_c(inoutd, inoutd2, inoutd_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("maxeveryd_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        maxevery128d(inoutd, inoutd2, inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("maxevery128d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+#if defined(AVX)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        maxevery256d(inoutd, inoutd2, inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("maxevery256d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        maxevery512d(inoutd, inoutd2, inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("maxevery512d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        mineveryd_c(inoutd, inoutd2, inoutd_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("mineveryd_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        minevery128d(inoutd, inoutd2, inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("minevery128d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+#if defined(AVX)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        minevery256d(inoutd, inoutd2, inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("minevery256d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        minevery512d(inoutd, inoutd2, inoutd2_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("minevery512d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold_gt_d_C(inoutd, inoutd_ref, len, 10.0);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold_gt_d_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold128_gt_d(inoutd, inoutd2_ref, len, 10.0);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold128_gt_d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+#if defined(AVX)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold256_gt_d(inoutd, inoutd2_ref, len, 10.0);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold256_gt_d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold512_gt_d(inoutd, inoutd2_ref, len, 10.0);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold512_gt_d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold_gtabs_d_C(inoutd, inoutd_ref, len, 10.0);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold_gtabs_d_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold128_gtabs_d(inoutd, inoutd2_ref, len, 10.0);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold128_gtabs_d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+#if defined(AVX)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold256_gtabs_d(inoutd, inoutd2_ref, len, 10.0);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold256_gtabs_d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold512_gtabs_d(inoutd, inoutd2_ref, len, 10.0);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold512_gtabs_d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold_lt_d_C(inoutd, inoutd_ref, len, 10.0);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold_lt_d_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold128_lt_d(inoutd, inoutd2_ref, len, 10.0);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold128_lt_d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+#if defined(AVX)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold256_lt_d(inoutd, inoutd2_ref, len, 10.0);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold256_lt_d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold512_lt_d(inoutd, inoutd2_ref, len, 10.0);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold512_lt_d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold_ltabs_d_C(inoutd, inoutd_ref, len, 10.0);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold_ltabs_d_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold128_ltabs_d(inoutd, inoutd2_ref, len, 10.0);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold128_ltabs_d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+#if defined(AVX)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold256_ltabs_d(inoutd, inoutd2_ref, len, 10.0);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold256_ltabs_d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold512_ltabs_d(inoutd, inoutd2_ref, len, 10.0);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold512_ltabs_d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold_ltval_gtval_d_C(inoutd, inoutd_ref, len, -10.0, -20.0, 10.0, 20.0);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold_ltval_gtval_d_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold128_ltval_gtval_d(inoutd, inoutd2_ref, len, -10.0, -20.0, 10.0, 20.0);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold128_ltval_gtval_d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+#if defined(AVX)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold256_ltval_gtval_d(inoutd, inoutd2_ref, len, -10.0, -20.0, 10.0, 20.0);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold256_ltval_gtval_d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold512_ltval_gtval_d(inoutd, inoutd2_ref, len, -10.0, -20.0, 10.0, 20.0);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold512_ltval_gtval_d %d %lf\n", len, elapsed);
+    l2_errd(inoutd_ref, inoutd2_ref, len);
+#endif
+
+    printf("\n");
+    ////////////////////////////////////////////////// INT16 UINT8 ////////////////////////////////////////////////////////////////
+    printf("INT16 UINT8\n");
+
+    for (int i = 0; i < len; i++) {
+        inout_s1[i] = (int16_t) (rand() % 65536 - 32768);
+        inout_s2[i] = (int16_t) (rand() % 65536 - 32768);
+        inout_u1[i] = (uint8_t) (rand() % 256);
+        inout_u2[i] = (uint8_t) (rand() % 256);
+    }
+    inout_s1[0] = INT16_MIN;
+    inout_s2[0] = INT16_MIN;
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        addsat16s_c(inout_s1, inout_s2, inout_sref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("addsat16s_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        addsat16s_128s(inout_s1, inout_s2, inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("addsat16s_128s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        addsat16s_256s(inout_s1, inout_s2, inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("addsat16s_256s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        addsat16s_512s(inout_s1, inout_s2, inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("addsat16s_512s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        subsat16s_c(inout_s1, inout_s2, inout_sref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("subsat16s_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        subsat16s_128s(inout_s1, inout_s2, inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("subsat16s_128s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        subsat16s_256s(inout_s1, inout_s2, inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("subsat16s_256s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        subsat16s_512s(inout_s1, inout_s2, inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("subsat16s_512s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        mulhi16s_c(inout_s1, inout_s2, inout_sref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("mulhi16s_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        mulhi16s_128s(inout_s1, inout_s2, inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("mulhi16s_128s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        mulhi16s_256s(inout_s1, inout_s2, inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("mulhi16s_256s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        mulhi16s_512s(inout_s1, inout_s2, inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("mulhi16s_512s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        mulhrs16s_c(inout_s1, inout_s2, inout_sref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("mulhrs16s_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        mulhrs16s_128s(inout_s1, inout_s2, inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("mulhrs16s_128s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        mulhrs16s_256s(inout_s1, inout_s2, inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("mulhrs16s_256s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        mulhrs16s_512s(inout_s1, inout_s2, inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("mulhrs16s_512s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        maxevery16s_c(inout_s1, inout_s2, inout_sref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("maxevery16s_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        maxevery16s_128s(inout_s1, inout_s2, inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("maxevery16s_128s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        maxevery16s_256s(inout_s1, inout_s2, inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("maxevery16s_256s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        maxevery16s_512s(inout_s1, inout_s2, inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("maxevery16s_512s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        minevery16s_c(inout_s1, inout_s2, inout_sref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("minevery16s_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        minevery16s_128s(inout_s1, inout_s2, inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("minevery16s_128s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        minevery16s_256s(inout_s1, inout_s2, inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("minevery16s_256s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        minevery16s_512s(inout_s1, inout_s2, inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("minevery16s_512s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        abs16s_c(inout_s1, inout_sref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("abs16s_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        abs16s_128s(inout_s1, inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("abs16s_128s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        abs16s_256s(inout_s1, inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("abs16s_256s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        abs16s_512s(inout_s1, inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("abs16s_512s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold_gt16s_c(inout_s1, inout_sref, len, 1000);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold_gt16s_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold_gt16s_128s(inout_s1, inout_s3, len, 1000);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold_gt16s_128s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold_gt16s_256s(inout_s1, inout_s3, len, 1000);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold_gt16s_256s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold_gt16s_512s(inout_s1, inout_s3, len, 1000);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold_gt16s_512s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold_lt16s_c(inout_s1, inout_sref, len, -1000);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold_lt16s_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold_lt16s_128s(inout_s1, inout_s3, len, -1000);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold_lt16s_128s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold_lt16s_256s(inout_s1, inout_s3, len, -1000);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold_lt16s_256s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold_lt16s_512s(inout_s1, inout_s3, len, -1000);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold_lt16s_512s %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        convertU8ToInt16_C(inout_u1, inout_sref, len, 3);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("convertU8ToInt16_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        convertU8ToInt16_128(inout_u1, inout_s3, len, 3);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("convertU8ToInt16_128 %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        convertU8ToInt16_256(inout_u1, inout_s3, len, 3);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("convertU8ToInt16_256 %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        convertU8ToInt16_512(inout_u1, inout_s3, len, 3);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("convertU8ToInt16_512 %d %lf\n", len, elapsed);
+    l2_err_i16(inout_sref, inout_s3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        addsatu8_c(inout_u1, inout_u2, (uint8_t *) inout_sref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("addsatu8_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        addsatu8_128(inout_u1, inout_u2, (uint8_t *) inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("addsatu8_128 %d %lf\n", len, elapsed);
+    l2_err_u8((uint8_t *) inout_sref, (uint8_t *) inout_s3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        addsatu8_256(inout_u1, inout_u2, (uint8_t *) inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("addsatu8_256 %d %lf\n", len, elapsed);
+    l2_err_u8((uint8_t *) inout_sref, (uint8_t *) inout_s3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        addsatu8_512(inout_u1, inout_u2, (uint8_t *) inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("addsatu8_512 %d %lf\n", len, elapsed);
+    l2_err_u8((uint8_t *) inout_sref, (uint8_t *) inout_s3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        subsatu8_c(inout_u1, inout_u2, (uint8_t *) inout_sref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("subsatu8_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        subsatu8_128(inout_u1, inout_u2, (uint8_t *) inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("subsatu8_128 %d %lf\n", len, elapsed);
+    l2_err_u8((uint8_t *) inout_sref, (uint8_t *) inout_s3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        subsatu8_256(inout_u1, inout_u2, (uint8_t *) inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("subsatu8_256 %d %lf\n", len, elapsed);
+    l2_err_u8((uint8_t *) inout_sref, (uint8_t *) inout_s3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        subsatu8_512(inout_u1, inout_u2, (uint8_t *) inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("subsatu8_512 %d %lf\n", len, elapsed);
+    l2_err_u8((uint8_t *) inout_sref, (uint8_t *) inout_s3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        absdiffu8_c(inout_u1, inout_u2, (uint8_t *) inout_sref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("absdiffu8_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        absdiffu8_128(inout_u1, inout_u2, (uint8_t *) inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("absdiffu8_128 %d %lf\n", len, elapsed);
+    l2_err_u8((uint8_t *) inout_sref, (uint8_t *) inout_s3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        absdiffu8_256(inout_u1, inout_u2, (uint8_t *) inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("absdiffu8_256 %d %lf\n", len, elapsed);
+    l2_err_u8((uint8_t *) inout_sref, (uint8_t *) inout_s3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        absdiffu8_512(inout_u1, inout_u2, (uint8_t *) inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("absdiffu8_512 %d %lf\n", len, elapsed);
+    l2_err_u8((uint8_t *) inout_sref, (uint8_t *) inout_s3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        maxeveryu8_c(inout_u1, inout_u2, (uint8_t *) inout_sref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("maxeveryu8_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        maxeveryu8_128(inout_u1, inout_u2, (uint8_t *) inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("maxeveryu8_128 %d %lf\n", len, elapsed);
+    l2_err_u8((uint8_t *) inout_sref, (uint8_t *) inout_s3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        maxeveryu8_256(inout_u1, inout_u2, (uint8_t *) inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("maxeveryu8_256 %d %lf\n", len, elapsed);
+    l2_err_u8((uint8_t *) inout_sref, (uint8_t *) inout_s3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        maxeveryu8_512(inout_u1, inout_u2, (uint8_t *) inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("maxeveryu8_512 %d %lf\n", len, elapsed);
+    l2_err_u8((uint8_t *) inout_sref, (uint8_t *) inout_s3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        mineveryu8_c(inout_u1, inout_u2, (uint8_t *) inout_sref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("mineveryu8_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        mineveryu8_128(inout_u1, inout_u2, (uint8_t *) inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("mineveryu8_128 %d %lf\n", len, elapsed);
+    l2_err_u8((uint8_t *) inout_sref, (uint8_t *) inout_s3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        mineveryu8_256(inout_u1, inout_u2, (uint8_t *) inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("mineveryu8_256 %d %lf\n", len, elapsed);
+    l2_err_u8((uint8_t *) inout_sref, (uint8_t *) inout_s3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        mineveryu8_512(inout_u1, inout_u2, (uint8_t *) inout_s3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("mineveryu8_512 %d %lf\n", len, elapsed);
+    l2_err_u8((uint8_t *) inout_sref, (uint8_t *) inout_s3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold_gtu8_c(inout_u1, (uint8_t *) inout_sref, len, 200);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold_gtu8_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold_gtu8_128(inout_u1, (uint8_t *) inout_s3, len, 200);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold_gtu8_128 %d %lf\n", len, elapsed);
+    l2_err_u8((uint8_t *) inout_sref, (uint8_t *) inout_s3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold_gtu8_256(inout_u1, (uint8_t *) inout_s3, len, 200);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold_gtu8_256 %d %lf\n", len, elapsed);
+    l2_err_u8((uint8_t *) inout_sref, (uint8_t *) inout_s3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold_gtu8_512(inout_u1, (uint8_t *) inout_s3, len, 200);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold_gtu8_512 %d %lf\n", len, elapsed);
+    l2_err_u8((uint8_t *) inout_sref, (uint8_t *) inout_s3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold_ltu8_c(inout_u1, (uint8_t *) inout_sref, len, 50);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold_ltu8_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold_ltu8_128(inout_u1, (uint8_t *) inout_s3, len, 50);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold_ltu8_128 %d %lf\n", len, elapsed);
+    l2_err_u8((uint8_t *) inout_sref, (uint8_t *) inout_s3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold_ltu8_256(inout_u1, (uint8_t *) inout_s3, len, 50);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold_ltu8_256 %d %lf\n", len, elapsed);
+    l2_err_u8((uint8_t *) inout_sref, (uint8_t *) inout_s3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        threshold_ltu8_512(inout_u1, (uint8_t *) inout_s3, len, 50);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threshold_ltu8_512 %d %lf\n", len, elapsed);
+    l2_err_u8((uint8_t *) inout_sref, (uint8_t *) inout_s3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        convertInt16ToU8_C(inout_s1, (uint8_t *) inout_sref, len, 4);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("convertInt16ToU8_C %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        convertInt16ToU8_128(inout_s1, (uint8_t *) inout_s3, len, 4);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("convertInt16ToU8_128 %d %lf\n", len, elapsed);
+    l2_err_u8((uint8_t *) inout_sref, (uint8_t *) inout_s3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        convertInt16ToU8_256(inout_s1, (uint8_t *) inout_s3, len, 4);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("convertInt16ToU8_256 %d %lf\n", len, elapsed);
+    l2_err_u8((uint8_t *) inout_sref, (uint8_t *) inout_s3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        convertInt16ToU8_512(inout_s1, (uint8_t *) inout_s3, len, 4);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("convertInt16ToU8_512 %d %lf\n", len, elapsed);
+    l2_err_u8((uint8_t *) inout_sref, (uint8_t *) inout_s3, len);
+#endif
+
+    printf("\n");
+    ////////////////////////////////////////////////// INT64 ////////////////////////////////////////////////////////////////
+    printf("INT64\n");
+
+    int64_t sum64_ref, sum64, min64_ref, max64_ref, min64, max64;
+    uint64_t minu64_ref, maxu64_ref, minu64, maxu64;
+
+    for (int i = 0; i < len; i++) {
+        ((int64_t *) inoutd)[i] = (int64_t) (((uint64_t) rand() << 42) ^ ((uint64_t) rand() << 21) ^ (uint64_t) rand());
+        ((int64_t *) inoutd2)[i] = (int64_t) (((uint64_t) rand() << 42) ^ ((uint64_t) rand() << 21) ^ (uint64_t) rand());
+    }
+    ((int64_t *) inoutd)[0] = INT64_MIN;
+    ((int64_t *) inoutd2)[len - 1] = INT64_MAX;
+    ((int64_t *) inoutd2)[len / 2] = ((int64_t *) inoutd)[len / 2];
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        add64s_c((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("add64s_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        add64s_128s((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("add64s_128s %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        add64s_256s((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("add64s_256s %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        add64s_512s((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("add64s_512s %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        sub64s_c((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sub64s_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        sub64s_128s((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sub64s_128s %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        sub64s_256s((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sub64s_256s %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        sub64s_512s((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sub64s_512s %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        mul64s_c((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("mul64s_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        mul64s_128s((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("mul64s_128s %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        mul64s_256s((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("mul64s_256s %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        mul64s_512s((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("mul64s_512s %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        maxevery64s_c((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("maxevery64s_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        maxevery64s_128s((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("maxevery64s_128s %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        maxevery64s_256s((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("maxevery64s_256s %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        maxevery64s_512s((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("maxevery64s_512s %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        minevery64s_c((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("minevery64s_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        minevery64s_128s((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("minevery64s_128s %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        minevery64s_256s((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("minevery64s_256s %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        minevery64s_512s((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("minevery64s_512s %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        maxeveryu64_c((uint64_t *) inoutd, (uint64_t *) inoutd2, (uint64_t *) inoutd_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("maxeveryu64_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        maxeveryu64_128((uint64_t *) inoutd, (uint64_t *) inoutd2, (uint64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("maxeveryu64_128 %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        maxeveryu64_256((uint64_t *) inoutd, (uint64_t *) inoutd2, (uint64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("maxeveryu64_256 %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        maxeveryu64_512((uint64_t *) inoutd, (uint64_t *) inoutd2, (uint64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("maxeveryu64_512 %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        mineveryu64_c((uint64_t *) inoutd, (uint64_t *) inoutd2, (uint64_t *) inoutd_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("mineveryu64_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        mineveryu64_128((uint64_t *) inoutd, (uint64_t *) inoutd2, (uint64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("mineveryu64_128 %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        mineveryu64_256((uint64_t *) inoutd, (uint64_t *) inoutd2, (uint64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("mineveryu64_256 %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        mineveryu64_512((uint64_t *) inoutd, (uint64_t *) inoutd2, (uint64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("mineveryu64_512 %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cmpeq64s_c((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cmpeq64s_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cmpeq64s_128s((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cmpeq64s_128s %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cmpeq64s_256s((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cmpeq64s_256s %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cmpeq64s_512s((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cmpeq64s_512s %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cmpgt64s_c((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cmpgt64s_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cmpgt64s_128s((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cmpgt64s_128s %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cmpgt64s_256s((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cmpgt64s_256s %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cmpgt64s_512s((int64_t *) inoutd, (int64_t *) inoutd2, (int64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cmpgt64s_512s %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cmpgtu64_c((uint64_t *) inoutd, (uint64_t *) inoutd2, (uint64_t *) inoutd_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cmpgtu64_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cmpgtu64_128((uint64_t *) inoutd, (uint64_t *) inoutd2, (uint64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cmpgtu64_128 %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cmpgtu64_256((uint64_t *) inoutd, (uint64_t *) inoutd2, (uint64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cmpgtu64_256 %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        cmpgtu64_512((uint64_t *) inoutd, (uint64_t *) inoutd2, (uint64_t *) inoutd3, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("cmpgtu64_512 %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        sll64s_c((int64_t *) inoutd, (int64_t *) inoutd_ref, len, 13);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sll64s_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        sll64s_128s((int64_t *) inoutd, (int64_t *) inoutd3, len, 13);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sll64s_128s %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        sll64s_256s((int64_t *) inoutd, (int64_t *) inoutd3, len, 13);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sll64s_256s %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        sll64s_512s((int64_t *) inoutd, (int64_t *) inoutd3, len, 13);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sll64s_512s %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        sra64s_c((int64_t *) inoutd, (int64_t *) inoutd_ref, len, 13);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sra64s_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        sra64s_128s((int64_t *) inoutd, (int64_t *) inoutd3, len, 13);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sra64s_128s %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        sra64s_256s((int64_t *) inoutd, (int64_t *) inoutd3, len, 13);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sra64s_256s %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        sra64s_512s((int64_t *) inoutd, (int64_t *) inoutd3, len, 13);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sra64s_512s %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        srlu64_c((uint64_t *) inoutd, (uint64_t *) inoutd_ref, len, 13);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("srlu64_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        srlu64_128((uint64_t *) inoutd, (uint64_t *) inoutd3, len, 13);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("srlu64_128 %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        srlu64_256((uint64_t *) inoutd, (uint64_t *) inoutd3, len, 13);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("srlu64_256 %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        srlu64_512((uint64_t *) inoutd, (uint64_t *) inoutd3, len, 13);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("srlu64_512 %d %lf\n", len, elapsed);
+    l2_err_i64((int64_t *) inoutd_ref, (int64_t *) inoutd3, len);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        sum64s_c((int64_t *) inoutd, &sum64_ref, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sum64s_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        sum64s_128s((int64_t *) inoutd, &sum64, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sum64s_128s %d %lf\n", len, elapsed);
+    printf("%lld || %lld\n", (long long) sum64_ref, (long long) sum64);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        sum64s_256s((int64_t *) inoutd, &sum64, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sum64s_256s %d %lf\n", len, elapsed);
+    printf("%lld || %lld\n", (long long) sum64_ref, (long long) sum64);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        sum64s_512s((int64_t *) inoutd, &sum64, len);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sum64s_512s %d %lf\n", len, elapsed);
+    printf("%lld || %lld\n", (long long) sum64_ref, (long long) sum64);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        minmax64s_c((int64_t *) inoutd, len, &min64_ref, &max64_ref);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("minmax64s_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        minmax64s_128s((int64_t *) inoutd, len, &min64, &max64);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("minmax64s_128s %d %lf\n", len, elapsed);
+    printf("%lld %lld || %lld %lld\n", (long long) min64_ref, (long long) min64, (long long) max64_ref, (long long) max64);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        minmax64s_256s((int64_t *) inoutd, len, &min64, &max64);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("minmax64s_256s %d %lf\n", len, elapsed);
+    printf("%lld %lld || %lld %lld\n", (long long) min64_ref, (long long) min64, (long long) max64_ref, (long long) max64);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        minmax64s_512s((int64_t *) inoutd, len, &min64, &max64);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("minmax64s_512s %d %lf\n", len, elapsed);
+    printf("%lld %lld || %lld %lld\n", (long long) min64_ref, (long long) min64, (long long) max64_ref, (long long) max64);
+#endif
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        minmaxu64_c((uint64_t *) inoutd, len, &minu64_ref, &maxu64_ref);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("minmaxu64_c %d %lf\n", len, elapsed);
+
+#if defined(SSE)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        minmaxu64_128((uint64_t *) inoutd, len, &minu64, &maxu64);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("minmaxu64_128 %d %lf\n", len, elapsed);
+    printf("%llu %llu || %llu %llu\n", (unsigned long long) minu64_ref, (unsigned long long) minu64, (unsigned long long) maxu64_ref, (unsigned long long) maxu64);
+#endif
+
+#if defined(AVX) && defined(__AVX2__)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        minmaxu64_256((uint64_t *) inoutd, len, &minu64, &maxu64);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("minmaxu64_256 %d %lf\n", len, elapsed);
+    printf("%llu %llu || %llu %llu\n", (unsigned long long) minu64_ref, (unsigned long long) minu64, (unsigned long long) maxu64_ref, (unsigned long long) maxu64);
+#endif
+
+#if defined(AVX512)
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++) {
+        minmaxu64_512((uint64_t *) inoutd, len, &minu64, &maxu64);
+    }
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("minmaxu64_512 %d %lf\n", len, elapsed);
+    printf("%llu %llu || %llu %llu\n", (unsigned long long) minu64_ref, (unsigned long long) minu64, (unsigned long long) maxu64_ref, (unsigned long long) maxu64);
+#endif
+
+#ifdef DISPATCH
+    printf("\n");
+    ////////////////////////////////////////////////// DISPATCH ////////////////////////////////////////////////////////////////////
+    printf("DISPATCH\n");
+
+    printf("CPU isa %s, selected isa %s\n", simd_utils_isa_name(simd_utils_cpu_isa()), simd_utils_isa_name(simd_utils_dispatch_isa()));
+
+    for (int i = 0; i < len; i++) {
+        inout[i] = (float) (rand() % 8000) / 1000.0f - 4.0f;
+        inout2[i] = (float) (rand() % 8000) / 1000.0f - 4.0f;
+    }
+
+    addf_c(inout, inout2, inout_ref, len);
+    expf_C(inout, inout2_ref, len);
+
+    for (int isa = SimdIsaSSE; isa <= simd_utils_cpu_isa(); isa++) {
+        simd_utils_dispatch_init(isa);
+
+        clock_gettime(CLOCK_REALTIME, &start);
+        addf_vec(inout, inout2, inout3, len);
+        clock_gettime(CLOCK_REALTIME, &stop);
+        elapsed = (stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3;
+        printf("addf_vec (%s) %d %lf\n", simd_utils_isa_name(simd_utils_dispatch_isa()), len, elapsed);
+
+        clock_gettime(CLOCK_REALTIME, &start);
+        for (l = 0; l < loop; l++)
+            addf_vec(inout, inout2, inout3, len);
+        clock_gettime(CLOCK_REALTIME, &stop);
+        elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+        printf("addf_vec (%s) %d %lf\n", simd_utils_isa_name(simd_utils_dispatch_isa()), len, elapsed);
+        l2_err(inout_ref, inout3, len);
+
+        clock_gettime(CLOCK_REALTIME, &start);
+        for (l = 0; l < loop; l++)
+            expf_vec(inout, inout3, len);
+        clock_gettime(CLOCK_REALTIME, &stop);
+        elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+        printf("expf_vec (%s) %d %lf\n", simd_utils_isa_name(simd_utils_dispatch_isa()), len, elapsed);
+        l2_err(inout2_ref, inout3, len);
+
+        float sum_ref, sum_vec;
+        sumf_C(inout, &sum_ref, len);
+        sumf_vec(inout, &sum_vec, len);
+        printf("sumf_vec (%s) %f %f\n", simd_utils_isa_name(simd_utils_dispatch_isa()), sum_ref, sum_vec);
+    }
+
+    simd_utils_dispatch_init(0);
+#endif
+
+#if defined(THREADPOOL) && defined(AVX)
+    printf("\n");
+    ////////////////////////////////////////////////// THREADPOOL ////////////////////////////////////////////////////////////////////
+    printf("THREADPOOL\n");
+
+    // at least 4 threads to exercise the stealing even on small machines
+    printf("threadpool_init %d threads\n", threadpool_init(4));
+
+    for (int i = 0; i < len; i++) {
+        inout[i] = (float) (rand() % 8000) / 1000.0f - 4.0f;
+        inout2[i] = (float) (rand() % 8000) / 1000.0f - 4.0f;
+    }
+
+    add256f(inout, inout2, inout_ref, len);
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        add256f(inout, inout2, inout_ref, len);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("add256f %d %lf\n", len, elapsed);
+
+    // small min_len so that the call is split even for the default test sizes
+    threadpool_binaryf(add256f, inout, inout2, inout3, len, 256);
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        threadpool_binaryf(add256f, inout, inout2, inout3, len, 256);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threadpool_binaryf add256f %d %lf\n", len, elapsed);
+    l2_err(inout_ref, inout3, len);
+
+    sincos256f(inout, inout_ref, inout2_ref, len);
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        sincos256f(inout, inout_ref, inout2_ref, len);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("sincos256f %d %lf\n", len, elapsed);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        threadpool_sincosf(sincos256f, inout, inout3, inout4, len, 256);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threadpool_sincosf sincos256f %d %lf\n", len, elapsed);
+    l2_err(inout_ref, inout3, len);
+    l2_err(inout2_ref, inout4, len);
+
+#if defined(AVX512)
+    exp512f(inout, inout_ref, len);
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        exp512f(inout, inout_ref, len);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("exp512f %d %lf\n", len, elapsed);
+
+    clock_gettime(CLOCK_REALTIME, &start);
+    for (l = 0; l < loop; l++)
+        threadpool_unaryf(exp512f, inout, inout3, len, THREADPOOL_MIN_LEN_COMPUTE);
+    clock_gettime(CLOCK_REALTIME, &stop);
+    elapsed = ((stop.tv_sec - start.tv_sec) * 1e6 + (stop.tv_nsec - start.tv_nsec) * 1e-3) / (double) loop;
+    printf("threadpool_unaryf exp512f %d %lf\n", len, elapsed);
+    l2_err(inout_ref, inout3, len);
+#endif
+
+    for (int i = 0; i < len; i++) {
+        inoutd[i] = (double) (rand() % 8000) / 1000.0 - 4.0;
+        inoutd2[i] = (double) (rand() % 8000) / 1000.0 - 4.0;
+    }
+    add256d(inoutd, inoutd2, inoutd_ref, len);
+    threadpool_binaryd(add256d, inoutd, inoutd2, inoutd3, len, 256);
+    printf("threadpool_binaryd add256d %d\n", len);
+    l2_errd(inoutd_ref, inoutd3, len);
+
+    // two callers sharing the pool, the one finding it busy runs its job alone
+    concurrent_caller_t callers[2] = {{inout_i1, len, 100, 0}, {inout_i2, len, 100, 0}};
+    pthread_t caller_threads[2];
+    for (int i = 0; i < 2; i++)
+        pthread_create(&caller_threads[i], NULL, concurrent_caller, &callers[i]);
+    for (int i = 0; i < 2; i++)
+        pthread_join(caller_threads[i], NULL);
+    printf("threadpool_parallel_for 2 concurrent callers %d wrong jobs %d %d\n", len, callers[0].errors, callers[1].errors);
+    if (callers[0].errors || callers[1].errors)
+        return -1;
+
+    moments_t mom_pool, mom_seq;
+    moments_init(&mom_seq);
+    moments256d(inoutd, len, &mom_seq);
+    moments_init(&mom_pool);
+    threadpool_momentsd(moments256d, inoutd, len, &mom_pool, 256);
+    print_moments("threadpool_momentsd moments256d", &mom_seq, &mom_pool);
+
+    prefixsum256d(inoutd, inoutd_ref, len, NULL);
+    threadpool_prefixsumd(prefixsum256d, inoutd, inoutd3, len, NULL, 256);
+    printf("threadpool_prefixsumd prefixsum256d %d\n", len);
+    l2_errd(inoutd_ref, inoutd3, len);
+
+    threadpool_destroy();
+#endif
+
     inout -= offset;
     inout2 -= offset;
     inout3 -= offset;
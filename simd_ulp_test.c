@@ -0,0 +1,440 @@
+/*
+ * Project : SIMD_Utils
+ * Version : 0.2.6
+ * Author  : JishinMaster
+ * Licence : BSD-2
+ */
+
+/* ULP accuracy test : each vector function is compared to its double precision
+ * reference (*_C_precise for floats, long double libm for doubles) on its whole
+ * input domain, and the program fails (returns 1) if a function misses its accuracy target.
+ *
+ * Float inputs are walked in the order of their bit patterns, every stride-th float
+ * between the bounds (stride 1 with -e is exhaustive). Double inputs are sampled the same way.
+ *
+ * Usage : simd_ulp_test [-e] [-n samples] [-k filter] [-v]
+ * e.g gcc -DSSE -DAVX -DAVX512 -DFMA -march=native -O3 simd_ulp_test.c -o simd_ulp_test -lm
+ */
+
+#include "common_test.h"
+
+#include <float.h>
+#include <stdint.h>
+
+#define ULP_BLOCK 4096
+#define ULP_MAX_REPORT 5  // number of failing inputs printed per function
+
+typedef enum {
+    UlpUnaryf = 0,  // f(src, dst, len)
+    UlpBinaryf,     // f(src1, src2, dst, len)
+    UlpSincosf,     // f(src, dst_sin, dst_cos, len)
+    UlpUnaryd,
+    UlpBinaryd,
+    UlpSincosd
+} UlpFuncType;
+
+typedef struct {
+    const char *name;
+    UlpFuncType type;
+    void *func;
+    void *ref;
+    double lo;  // input domain, also used for the second input of binary functions
+    double hi;
+    double min_abs;   // smaller inputs (in magnitude) are replaced by +/-min_abs
+    int64_t max_ulp;  // budget, the accuracy target of the function
+} ulp_test_t;
+
+typedef struct {
+    int64_t max_ulp;
+    double max_ulp_in1;
+    double max_ulp_in2;
+    long nb_tested;
+    long nb_fail;
+} ulp_result_t;
+
+////////// long double references for the double precision functions //////////
+#define ULP_REF_UNARYD(name, fn)                                  \
+    static void name(double *src, double *dst, int len)           \
+    {                                                             \
+        for (int i = 0; i < len; i++)                             \
+            dst[i] = (double) fn((long double) src[i]);           \
+    }
+
+ULP_REF_UNARYD(expd_ref, expl)
+ULP_REF_UNARYD(lnd_ref, logl)
+ULP_REF_UNARYD(sqrtd_ref, sqrtl)
+ULP_REF_UNARYD(atand_ref, atanl)
+ULP_REF_UNARYD(asind_ref, asinl)
+ULP_REF_UNARYD(tand_ref, tanl)
+ULP_REF_UNARYD(log2d_ref, log2l)
+ULP_REF_UNARYD(log10d_ref, log10l)
+ULP_REF_UNARYD(sinhd_ref, sinhl)
+ULP_REF_UNARYD(coshd_ref, coshl)
+ULP_REF_UNARYD(tanhd_ref, tanhl)
+ULP_REF_UNARYD(asinhd_ref, asinhl)
+ULP_REF_UNARYD(acoshd_ref, acoshl)
+ULP_REF_UNARYD(atanhd_ref, atanhl)
+ULP_REF_UNARYD(cbrtd_ref, cbrtl)
+ULP_REF_UNARYD(acosd_ref, acosl)
+
+static void sigmoidd_ref(double *src, double *dst, int len)
+{
+    for (int i = 0; i < len; i++)
+        dst[i] = (double) (1.0L / (1.0L + expl(-(long double) src[i])));
+}
+
+static void divd_ref(double *src1, double *src2, double *dst, int len)
+{
+    for (int i = 0; i < len; i++)
+        dst[i] = (double) ((long double) src1[i] / (long double) src2[i]);
+}
+
+static void atan2d_ref(double *src1, double *src2, double *dst, int len)
+{
+    for (int i = 0; i < len; i++)
+        dst[i] = (double) atan2l((long double) src1[i], (long double) src2[i]);
+}
+
+static void sincosd_ref(double *src, double *dst_sin, double *dst_cos, int len)
+{
+    for (int i = 0; i < len; i++) {
+        dst_sin[i] = (double) sinl((long double) src[i]);
+        dst_cos[i] = (double) cosl((long double) src[i]);
+    }
+}
+
+#define ULP_TEST(type, fn, ref, lo, hi, min_abs, ulp) {#fn, type, (void *) fn, (void *) ref, lo, hi, min_abs, ulp}
+// denormals are not supported by the vector functions
+#define ULP_UNARYF(fn, ref, lo, hi, ulp) ULP_TEST(UlpUnaryf, fn, ref, lo, hi, FLT_MIN, ulp)
+#define ULP_BINARYF(fn, ref, lo, hi, ulp) ULP_TEST(UlpBinaryf, fn, ref, lo, hi, FLT_MIN, ulp)
+#define ULP_SINCOSF(fn, ref, lo, hi, ulp) ULP_TEST(UlpSincosf, fn, ref, lo, hi, FLT_MIN, ulp)
+#define ULP_UNARYD(fn, ref, lo, hi, ulp) ULP_TEST(UlpUnaryd, fn, ref, lo, hi, DBL_MIN, ulp)
+#define ULP_BINARYD(fn, ref, lo, hi, ulp) ULP_TEST(UlpBinaryd, fn, ref, lo, hi, DBL_MIN, ulp)
+#define ULP_SINCOSD(fn, ref, lo, hi, ulp) ULP_TEST(UlpSincosd, fn, ref, lo, hi, DBL_MIN, ulp)
+
+/* Accuracy targets in ULP, after the IPP accuracy classes (number of correct bits of the significand) :
+ * - A24/A53 (1 ULP) for the correctly rounded operations (sqrt, div)
+ * - A21/A50 (8 ULP) for the math functions
+ * - A11 (8192 ULP) for the float functions which do not reach A21 by design : sin, cos and tan
+ *   close to the zeros of large inputs, where the range reduction error is large compared to the
+ *   result, and atanh on SSE/AVX, which divides with the 12 bits _mm_rcp_ps.
+ * The double tan returns x for |x| < 1e-7 like cephes, which is off by x^3/3, i.e up to 30 ULP.
+ * They are targets, not the errors of the current implementations, so that a less accurate
+ * change is reported only when it misses the target of the function. */
+#define ULP_A24 1
+#define ULP_A21 8
+#define ULP_A11 8192
+#define ULP_A53 1
+#define ULP_A50 8
+#define ULP_TAND_CUTOFF 32
+
+/* Float functions of a backend, W being 128, 256 or 512 */
+#define ULP_FLOAT_TESTS(W, atanh_ulp)                                                       \
+    ULP_UNARYF(exp##W##f, expf_C_precise, -87.0, 88.0, ULP_A21),                            \
+    ULP_UNARYF(ln##W##f, lnf_C_precise, FLT_MIN, FLT_MAX, ULP_A21),                         \
+    ULP_UNARYF(log2##W##f, log2f_C_precise, FLT_MIN, FLT_MAX, ULP_A21),                     \
+    ULP_UNARYF(log2##W##f_precise, log2f_C_precise, FLT_MIN, FLT_MAX, ULP_A21),             \
+    ULP_UNARYF(log10##W##f, log10f_C_precise, FLT_MIN, FLT_MAX, ULP_A21),                   \
+    ULP_UNARYF(log10##W##f_precise, log10f_C_precise, FLT_MIN, FLT_MAX, ULP_A21),           \
+    ULP_TEST(UlpUnaryf, cbrt##W##f, cbrtf_C_precise, -1e27, 1e27, 1e-27, ULP_A21),          \
+    ULP_UNARYF(sqrt##W##f, sqrtf_C_precise, 0.0, FLT_MAX, ULP_A24),                         \
+    ULP_UNARYF(asin##W##f, asinf_C_precise, -1.0, 1.0, ULP_A21),                            \
+    ULP_UNARYF(atan##W##f, atanf_C_precise, -FLT_MAX, FLT_MAX, ULP_A21),                    \
+    ULP_UNARYF(tan##W##f, tanf_C_precise, -1024.0, 1024.0, ULP_A11),                        \
+    ULP_UNARYF(tanh##W##f, tanhf_C_precise, -20.0, 20.0, ULP_A21),                          \
+    ULP_UNARYF(sinh##W##f, sinhf_C_precise, -88.0, 88.0, ULP_A21),                          \
+    ULP_UNARYF(cosh##W##f, coshf_C_precise, -88.0, 88.0, ULP_A21),                          \
+    ULP_UNARYF(atanh##W##f, atanhf_C_precise, -0.99999994, 0.99999994, atanh_ulp),          \
+    ULP_UNARYF(asinh##W##f, asinhf_C_precise, -1e18, 1e18, ULP_A21),                        \
+    ULP_UNARYF(acosh##W##f, acoshf_C_precise, 1.0, 1e18, ULP_A21),                          \
+    ULP_UNARYF(sin##W##f, sinf_C_precise, -1024.0, 1024.0, ULP_A11),                        \
+    ULP_UNARYF(cos##W##f, cosf_C_precise, -1024.0, 1024.0, ULP_A11),                        \
+    ULP_SINCOSF(sincos##W##f, sincosf_C_precise, -1024.0, 1024.0, ULP_A11),                 \
+    ULP_BINARYF(div##W##f, divf_C_precise, -1e18, 1e18, ULP_A24),                           \
+    ULP_BINARYF(atan2##W##f, atan2f_C_precise, -1e18, 1e18, ULP_A21)
+
+#define ULP_DOUBLE_TESTS(W)                                                                 \
+    ULP_UNARYD(exp##W##d, expd_ref, -708.0, 709.0, ULP_A50),                                \
+    ULP_UNARYD(ln##W##d, lnd_ref, DBL_MIN, DBL_MAX, ULP_A50),                               \
+    ULP_UNARYD(sqrt##W##d, sqrtd_ref, 0.0, DBL_MAX, ULP_A53),                               \
+    ULP_UNARYD(atan##W##d, atand_ref, -DBL_MAX, DBL_MAX, ULP_A50),                          \
+    ULP_UNARYD(asin##W##d, asind_ref, -1.0, 1.0, ULP_A50),                                  \
+    ULP_UNARYD(tan##W##d, tand_ref, -1e6, 1e6, ULP_TAND_CUTOFF),                            \
+    ULP_UNARYD(log2##W##d, log2d_ref, DBL_MIN, DBL_MAX, ULP_A50),                           \
+    ULP_UNARYD(log10##W##d, log10d_ref, DBL_MIN, DBL_MAX, ULP_A50),                         \
+    ULP_UNARYD(sinh##W##d, sinhd_ref, -709.0, 709.0, ULP_A50),                              \
+    ULP_UNARYD(cosh##W##d, coshd_ref, -709.0, 709.0, ULP_A50),                              \
+    ULP_UNARYD(tanh##W##d, tanhd_ref, -30.0, 30.0, ULP_A50),                                \
+    ULP_UNARYD(asinh##W##d, asinhd_ref, -DBL_MAX, DBL_MAX, ULP_A50),                        \
+    ULP_UNARYD(acosh##W##d, acoshd_ref, 1.0, DBL_MAX, ULP_A50),                             \
+    ULP_UNARYD(atanh##W##d, atanhd_ref, -0.9999999999999999, 0.9999999999999999, ULP_A50),  \
+    ULP_UNARYD(cbrt##W##d, cbrtd_ref, -DBL_MAX, DBL_MAX, ULP_A50),                          \
+    ULP_UNARYD(acos##W##d, acosd_ref, -1.0, 1.0, ULP_A50),                                  \
+    ULP_UNARYD(sigmoid##W##d, sigmoidd_ref, -708.0, 708.0, ULP_A50),                        \
+    ULP_SINCOSD(sincos##W##d, sincosd_ref, -1e6, 1e6, ULP_A50),                             \
+    ULP_BINARYD(div##W##d, divd_ref, -1e300, 1e300, ULP_A53),                               \
+    ULP_TEST(UlpBinaryd, atan2##W##d, atan2d_ref, -1e150, 1e150, 1e-150, ULP_A50)
+
+static ulp_test_t ulp_tests[] = {
+#if defined(SSE)
+    ULP_FLOAT_TESTS(128, ULP_A11),
+    ULP_DOUBLE_TESTS(128),
+#endif
+#if defined(AVX)
+    ULP_FLOAT_TESTS(256, ULP_A11),
+    ULP_DOUBLE_TESTS(256),
+#endif
+#if defined(AVX512)
+    ULP_FLOAT_TESTS(512, ULP_A21),
+    ULP_DOUBLE_TESTS(512),
+#endif
+#if defined(RISCV)
+    ULP_UNARYF(expf_vec, expf_C_precise, -87.0, 88.0, ULP_A21),
+    ULP_UNARYF(lnf_vec, lnf_C_precise, FLT_MIN, FLT_MAX, ULP_A21),
+    ULP_UNARYF(log2f_vec, log2f_C_precise, FLT_MIN, FLT_MAX, ULP_A21),
+    ULP_UNARYF(log10f_vec, log10f_C_precise, FLT_MIN, FLT_MAX, ULP_A21),
+    ULP_UNARYF(cbrtf_vec, cbrtf_C_precise, -FLT_MAX, FLT_MAX, ULP_A21),
+    ULP_UNARYF(sqrtf_vec, sqrtf_C_precise, 0.0, FLT_MAX, ULP_A24),
+    ULP_UNARYF(asinf_vec, asinf_C_precise, -1.0, 1.0, ULP_A21),
+    ULP_UNARYF(atanf_vec, atanf_C_precise, -FLT_MAX, FLT_MAX, ULP_A21),
+    ULP_UNARYF(tanf_vec, tanf_C_precise, -1024.0, 1024.0, ULP_A11),
+    ULP_UNARYF(tanhf_vec, tanhf_C_precise, -20.0, 20.0, ULP_A21),
+    ULP_UNARYF(sinhf_vec, sinhf_C_precise, -88.0, 88.0, ULP_A21),
+    ULP_UNARYF(coshf_vec, coshf_C_precise, -88.0, 88.0, ULP_A21),
+    ULP_UNARYF(atanhf_vec, atanhf_C_precise, -0.99999994, 0.99999994, ULP_A21),
+    ULP_UNARYF(asinhf_vec, asinhf_C_precise, -1e18, 1e18, ULP_A21),
+    ULP_UNARYF(acoshf_vec, acoshf_C_precise, 1.0, 1e18, ULP_A21),
+    ULP_UNARYF(sinf_vec, sinf_C_precise, -1024.0, 1024.0, ULP_A11),
+    ULP_UNARYF(cosf_vec, cosf_C_precise, -1024.0, 1024.0, ULP_A11),
+    ULP_SINCOSF(sincosf_vec, sincosf_C_precise, -1024.0, 1024.0, ULP_A11),
+    ULP_BINARYF(divf_vec, divf_C_precise, -1e18, 1e18, ULP_A24),
+    ULP_BINARYF(atan2f_vec, atan2f_C_precise, -1e18, 1e18, ULP_A21),
+    ULP_UNARYD(expd_vec, expd_ref, -708.0, 709.0, ULP_A50),
+    ULP_UNARYD(sqrtd_vec, sqrtd_ref, 0.0, DBL_MAX, ULP_A53),
+    ULP_UNARYD(atand_vec, atand_ref, -DBL_MAX, DBL_MAX, ULP_A50),
+    ULP_UNARYD(asind_vec, asind_ref, -1.0, 1.0, ULP_A50),
+    ULP_SINCOSD(sincosd_vec, sincosd_ref, -1e6, 1e6, ULP_A50),
+    ULP_BINARYD(divd_vec, divd_ref, -1e300, 1e300, ULP_A53),
+    ULP_BINARYD(atan2d_vec, atan2d_ref, -1e300, 1e300, ULP_A50),
+#endif
+};
+
+/* Maps floats/doubles to integers in the same order, so that the difference
+ * of two values is their distance in ULP, even across zero. */
+static inline int64_t ulp_order32(float x)
+{
+    int32_t i;
+    memcpy(&i, &x, sizeof(float));
+    return (i < 0) ? (int64_t) INT32_MIN - (int64_t) i : (int64_t) i;
+}
+
+static inline float ulp_from_order32(int64_t o)
+{
+    int32_t i = (o < 0) ? (int32_t) ((int64_t) INT32_MIN - o) : (int32_t) o;
+    float x;
+    memcpy(&x, &i, sizeof(float));
+    return x;
+}
+
+static inline int64_t ulp_order64(double x)
+{
+    int64_t i;
+    memcpy(&i, &x, sizeof(double));
+    return (i < 0) ? INT64_MIN - i : i;
+}
+
+static inline double ulp_from_order64(int64_t o)
+{
+    int64_t i = (o < 0) ? INT64_MIN - o : o;
+    double x;
+    memcpy(&x, &i, sizeof(double));
+    return x;
+}
+
+static inline int64_t ulp_dist32(float test, float ref)
+{
+    if (isnan(test) || isnan(ref))
+        return (isnan(test) && isnan(ref)) ? 0 : INT64_MAX;
+    int64_t d = ulp_order32(test) - ulp_order32(ref);
+    return (d < 0) ? -d : d;
+}
+
+static inline int64_t ulp_dist64(double test, double ref)
+{
+    if (isnan(test) || isnan(ref))
+        return (isnan(test) && isnan(ref)) ? 0 : INT64_MAX;
+    int64_t a = ulp_order64(test), b = ulp_order64(ref);
+    uint64_t d = (a > b) ? (uint64_t) a - (uint64_t) b : (uint64_t) b - (uint64_t) a;
+    return (d > (uint64_t) INT64_MAX) ? INT64_MAX : (int64_t) d;
+}
+
+static void ulp_check(ulp_test_t *t, ulp_result_t *res, int64_t dist, double in1, double in2, double test, double ref, int verbose)
+{
+    res->nb_tested++;
+    if (dist > res->max_ulp) {
+        res->max_ulp = dist;
+        res->max_ulp_in1 = in1;
+        res->max_ulp_in2 = in2;
+    }
+    if (dist > t->max_ulp) {
+        if ((res->nb_fail < ULP_MAX_REPORT) || verbose)
+            printf("  %s(%.9g, %.9g) = %.17g, expected %.17g (%lld ULP)\n", t->name, in1, in2, test, ref, (long long) dist);
+        res->nb_fail++;
+    }
+}
+
+/* Runs the function on every stride-th value of its domain.
+ * The second input of binary functions is drawn at random in the same domain. */
+static void ulp_run(ulp_test_t *t, ulp_result_t *res, long nb_samples, void **buf, int verbose)
+{
+    int is_double = (t->type >= UlpUnaryd);
+    int64_t lo = is_double ? ulp_order64(t->lo) : ulp_order32((float) t->lo);
+    int64_t hi = is_double ? ulp_order64(t->hi) : ulp_order32((float) t->hi);
+    uint64_t range = (uint64_t) hi - (uint64_t) lo;
+    uint64_t stride = 1;
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+
+    if ((nb_samples > 0) && (range / (uint64_t) nb_samples > 1))
+        stride = range / (uint64_t) nb_samples;
+
+    memset(res, 0, sizeof(ulp_result_t));
+
+    float *inf1 = (float *) buf[0], *inf2 = (float *) buf[1];
+    float *outf1 = (float *) buf[2], *outf2 = (float *) buf[3];
+    float *reff1 = (float *) buf[4], *reff2 = (float *) buf[5];
+    double *ind1 = (double *) buf[0], *ind2 = (double *) buf[1];
+    double *outd1 = (double *) buf[2], *outd2 = (double *) buf[3];
+    double *refd1 = (double *) buf[4], *refd2 = (double *) buf[5];
+
+    uint64_t pos = 0;  // offset from lo
+    int done = 0;
+    while (!done) {
+        int len = 0;
+        for (; (len < ULP_BLOCK) && !done; len++) {
+            // xorshift64
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            int64_t o = (int64_t) ((uint64_t) lo + pos);
+            int64_t o2 = (int64_t) ((uint64_t) lo + seed % (range + 1));
+            if (is_double) {
+                ind1[len] = ulp_from_order64(o);
+                ind2[len] = ulp_from_order64(o2);
+                if (fabs(ind1[len]) < t->min_abs)
+                    ind1[len] = copysign(t->min_abs, ind1[len]);
+                if (fabs(ind2[len]) < t->min_abs)
+                    ind2[len] = copysign(t->min_abs, ind2[len]);
+            } else {
+                inf1[len] = ulp_from_order32(o);
+                inf2[len] = ulp_from_order32(o2);
+                if (fabsf(inf1[len]) < (float) t->min_abs)
+                    inf1[len] = copysignf((float) t->min_abs, inf1[len]);
+                if (fabsf(inf2[len]) < (float) t->min_abs)
+                    inf2[len] = copysignf((float) t->min_abs, inf2[len]);
+            }
+            if (range - pos < stride)
+                done = 1;
+            else
+                pos += stride;
+        }
+
+        switch (t->type) {
+        case UlpUnaryf:
+            ((void (*)(float *, float *, int)) t->ref)(inf1, reff1, len);
+            ((void (*)(float *, float *, int)) t->func)(inf1, outf1, len);
+            for (int i = 0; i < len; i++)
+                ulp_check(t, res, ulp_dist32(outf1[i], reff1[i]), inf1[i], 0.0, outf1[i], reff1[i], verbose);
+            break;
+        case UlpBinaryf:
+            ((void (*)(float *, float *, float *, int)) t->ref)(inf1, inf2, reff1, len);
+            ((void (*)(float *, float *, float *, int)) t->func)(inf1, inf2, outf1, len);
+            for (int i = 0; i < len; i++)
+                ulp_check(t, res, ulp_dist32(outf1[i], reff1[i]), inf1[i], inf2[i], outf1[i], reff1[i], verbose);
+            break;
+        case UlpSincosf:
+            ((void (*)(float *, float *, float *, int)) t->ref)(inf1, reff1, reff2, len);
+            ((void (*)(float *, float *, float *, int)) t->func)(inf1, outf1, outf2, len);
+            for (int i = 0; i < len; i++) {
+                ulp_check(t, res, ulp_dist32(outf1[i], reff1[i]), inf1[i], 0.0, outf1[i], reff1[i], verbose);
+                ulp_check(t, res, ulp_dist32(outf2[i], reff2[i]), inf1[i], 0.0, outf2[i], reff2[i], verbose);
+            }
+            break;
+        case UlpUnaryd:
+            ((void (*)(double *, double *, int)) t->ref)(ind1, refd1, len);
+            ((void (*)(double *, double *, int)) t->func)(ind1, outd1, len);
+            for (int i = 0; i < len; i++)
+                ulp_check(t, res, ulp_dist64(outd1[i], refd1[i]), ind1[i], 0.0, outd1[i], refd1[i], verbose);
+            break;
+        case UlpBinaryd:
+            ((void (*)(double *, double *, double *, int)) t->ref)(ind1, ind2, refd1, len);
+            ((void (*)(double *, double *, double *, int)) t->func)(ind1, ind2, outd1, len);
+            for (int i = 0; i < len; i++)
+                ulp_check(t, res, ulp_dist64(outd1[i], refd1[i]), ind1[i], ind2[i], outd1[i], refd1[i], verbose);
+            break;
+        case UlpSincosd:
+            ((void (*)(double *, double *, double *, int)) t->ref)(ind1, refd1, refd2, len);
+            ((void (*)(double *, double *, double *, int)) t->func)(ind1, outd1, outd2, len);
+            for (int i = 0; i < len; i++) {
+                ulp_check(t, res, ulp_dist64(outd1[i], refd1[i]), ind1[i], 0.0, outd1[i], refd1[i], verbose);
+                ulp_check(t, res, ulp_dist64(outd2[i], refd2[i]), ind1[i], 0.0, outd2[i], refd2[i], verbose);
+            }
+            break;
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    long nb_samples = 1 << 22;  // per function, 0 for exhaustive
+    const char *filter = NULL;
+    int verbose = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-e") == 0) {
+            nb_samples = 0;
+        } else if ((strcmp(argv[i], "-n") == 0) && (i + 1 < argc)) {
+            nb_samples = atol(argv[++i]);
+        } else if ((strcmp(argv[i], "-k") == 0) && (i + 1 < argc)) {
+            filter = argv[++i];
+        } else if (strcmp(argv[i], "-v") == 0) {
+            verbose = 1;
+        } else {
+            printf("Usage simd_ulp_test : [-e] [-n samples] [-k filter] [-v]\n");
+            return -1;
+        }
+    }
+
+    void *buf[6];
+    for (int b = 0; b < 6; b++) {
+        buf[b] = NULL;
+        if (posix_memalign(&buf[b], 64, ULP_BLOCK * sizeof(double)) != 0 || buf[b] == NULL) {
+            printf("posix_memalign buf[%d] failed\n", b);
+            return -1;
+        }
+    }
+
+    int nb_tests = sizeof(ulp_tests) / sizeof(ulp_tests[0]);
+    int nb_run = 0, nb_failed = 0;
+
+    printf("%-24s %12s %12s %8s %24s %12s\n", "function", "tested", "failed", "max_ulp", "at", "budget");
+    for (int t = 0; t < nb_tests; t++) {
+        ulp_result_t res;
+
+        if (filter && (strstr(ulp_tests[t].name, filter) == NULL))
+            continue;
+
+        ulp_run(&ulp_tests[t], &res, nb_samples, buf, verbose);
+        nb_run++;
+        printf("%-24s %12ld %12ld %8lld %24.17g %12lld %s\n", ulp_tests[t].name, res.nb_tested, res.nb_fail, (long long) res.max_ulp,
+               res.max_ulp_in1, (long long) ulp_tests[t].max_ulp, res.nb_fail ? "FAILED" : "OK");
+        if (res.nb_fail)
+            nb_failed++;
+    }
+
+    printf("%d/%d functions within their ULP budget\n", nb_run - nb_failed, nb_run);
+
+    for (int b = 0; b < 6; b++)
+        free(buf[b]);
+
+    return (nb_failed > 0) ? 1 : 0;
+}
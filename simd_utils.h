@@ -15,6 +15,48 @@ extern "C" {
 #define MINOR_VERSION 2
 #define SUB_VERSION 6
 
+/* DISPATCH builds all the x86 backends in the same binary, each one with
+ * its own target options, and selects one at runtime (see simd_utils_dispatch.h).
+ * FMA is then only enabled for the AVX and AVX512 backends. */
+#ifdef DISPATCH
+#if !defined(__GNUC__) || defined(__clang__) || defined(__INTEL_COMPILER) || defined(ARM)
+#error "DISPATCH is only supported with GCC on x86 targets"
+#endif
+#ifndef SSE
+#define SSE
+#endif
+#ifndef AVX
+#define AVX
+#endif
+#ifndef AVX512
+#define AVX512
+#endif
+#ifdef FMA
+#undef FMA
+#endif
+#endif /* DISPATCH */
+
+/* Library mode : with SIMD_UTILS_EXTERN, simd_utils.h only declares the functions
+ * (see simd_utils_api.h), which are defined once, either by the prebuilt simd_utils
+ * library or by a single translation unit of the application defining SIMD_UTILS_IMPL
+ * before including simd_utils.h (see simd_utils_lib.c).
+ * Without any of them, every function is static inline, as usual. */
+#if defined(SIMD_UTILS_EXTERN) && !defined(SIMD_UTILS_IMPL)
+
+#include "simd_utils_api.h"
+
+#ifdef THREADPOOL
+#include "simd_utils_threadpool.h"
+#endif
+
+#else /* SIMD_UTILS_EXTERN */
+
+#ifdef SIMD_UTILS_IMPL
+#define SIMD_UTILS_API
+#else
+#define SIMD_UTILS_API static inline
+#endif
+
 #ifdef OMP
 #include <omp.h>
 #endif
@@ -86,11 +128,41 @@ static inline int areAligned3(uintptr_t ptr1, uintptr_t ptr2, uintptr_t ptr3, si
 }
 
 
-static inline void simd_utils_get_version(void)
+SIMD_UTILS_API void simd_utils_get_version(void)
 {
     printf("Simd Utils Version : %d.%d.%d\n", MAJOR_VERSION, MINOR_VERSION, SUB_VERSION);
 }
 
+/* Non temporal (streaming) stores.
+ * When the output of copy, set, zero or of a unary math kernel (sqrt, fabs, exp, ln, log2, log10,
+ * sin, cos, tan) is at least simd_stream_threshold bytes and aligned, it is written with
+ * _mm_stream_ps/_mm256_stream_ps/_mm512_stream_ps, bypassing the caches : no read for ownership
+ * of the destination and no eviction of the working set. The default is about the size of a
+ * last level cache, the output of such a call would not stay in cache anyway.
+ * simd_set_stream_threshold(0) streams every aligned call, SIMD_STREAM_NEVER disables streaming.
+ * The threshold is a static variable : each translation unit has its own (the library has one).
+ */
+#ifndef SIMD_STREAM_THRESHOLD
+#define SIMD_STREAM_THRESHOLD (16 * 1024 * 1024)
+#endif
+
+static size_t simd_stream_threshold = SIMD_STREAM_THRESHOLD;
+
+SIMD_UTILS_API void simd_set_stream_threshold(size_t bytes)
+{
+    simd_stream_threshold = bytes;
+}
+
+SIMD_UTILS_API size_t simd_get_stream_threshold(void)
+{
+    return simd_stream_threshold;
+}
+
+static inline int simd_use_stream(int len, size_t elt_size)
+{
+    return ((size_t) len * elt_size) >= simd_stream_threshold;
+}
+
 
 //  Produce value of bit n.  n must be less than 32.
 #define Bit(n)  ((uint32_t) 1 << (n))
@@ -211,20 +283,31 @@ static inline uint16_t float2half_rn (float a)
     return ir;
 }
 
-static inline void fp32tofp16_C (float* src, uint16_t* dst, size_t len)
+SIMD_UTILS_API void fp32tofp16_C (float* src, uint16_t* dst, size_t len)
 {
-	for (int i = 0; i < len; i ++) {
+	for (size_t i = 0; i < len; i ++) {
         dst[i] = float2half_rn(src[i]);	
 	}
 }
 
-static inline void fp16tofp32_C (uint16_t* src, float* dst, size_t len)
+SIMD_UTILS_API void fp16tofp32_C (uint16_t* src, float* dst, size_t len)
 {
-	for (int i = 0; i < len; i ++) {
+	for (size_t i = 0; i < len; i ++) {
 		dst[i] = uint32_as_float(Float16ToFloat32(src[i]));
 	}
 }
 
+#include "simd_utils_fft.h"
+#include "simd_utils_fir.h"
+#include "simd_utils_iir.h"
+#include "simd_utils_conv.h"
+#include "simd_utils_loc.h"
+#include "simd_utils_sum.h"
+#include "simd_utils_moments.h"
+#include "simd_utils_hist.h"
+#include "simd_utils_sort.h"
+#include "simd_utils_topk.h"
+
 #ifdef SSE
 
 #ifdef NO_SSE3
@@ -562,6 +645,24 @@ static inline __m128d _mm_fnmadd_pd_custom(__m128d a, __m128d b, __m128d c)
 #endif /* FMA */
 }
 
+static inline __m128d _mm_fmaddsub_pd_custom(__m128d a, __m128d b, __m128d c)
+{
+#ifndef FMA  // Haswell comes with avx2 and fma
+    return _mm_addsub_pd(_mm_mul_pd(a, b), c);
+#else  /* FMA */
+    return _mm_fmaddsub_pd(a, b, c);
+#endif /* FMA */
+}
+
+static inline __m128d _mm_fmsubadd_pd_custom(__m128d a, __m128d b, __m128d c)
+{
+#ifndef FMA  // Haswell comes with avx2 and fma
+    return _mm_addsub_pd(_mm_mul_pd(a, b), _mm_xor_pd(c, *(v2sd *) _pd_negative_mask));
+#else  /* FMA */
+    return _mm_fmsubadd_pd(a, b, c);
+#endif /* FMA */
+}
+
 //B is a scalar, some optimizations for ARM NEON
 static inline __m128d _mm_fmadd1_pd_custom(__m128d a, __m128d b, __m128d c)
 {
@@ -635,6 +736,49 @@ static inline v2sid _mm_cvtpd_epi64_custom(v2sd x)
 #endif // ARM
 }
 
+// 64 bits integer operations missing before AVX-512 :
+// low 64 bits of the product from three 32x32 bits products,
+// unsigned comparison through a flip of the sign bit, arithmetic shift from the sign mask
+static inline v2sid _mm_mullo_epi64_custom(v2sid a, v2sid b)
+{
+    v2sid lo = _mm_mul_epu32(a, b);
+    v2sid cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), b), _mm_mul_epu32(a, _mm_srli_epi64(b, 32)));
+    return _mm_add_epi64(lo, _mm_slli_epi64(cross, 32));
+}
+
+static inline v2sid _mm_cmpgt_epu64_custom(v2sid a, v2sid b)
+{
+    const v2sid sign = _mm_set1_epi64x(INT64_MIN);
+    return _mm_cmpgt_epi64(_mm_xor_si128(a, sign), _mm_xor_si128(b, sign));
+}
+
+static inline v2sid _mm_max_epi64_custom(v2sid a, v2sid b)
+{
+    return _mm_blendv_epi8(b, a, _mm_cmpgt_epi64(a, b));
+}
+
+static inline v2sid _mm_min_epi64_custom(v2sid a, v2sid b)
+{
+    return _mm_blendv_epi8(a, b, _mm_cmpgt_epi64(a, b));
+}
+
+static inline v2sid _mm_max_epu64_custom(v2sid a, v2sid b)
+{
+    return _mm_blendv_epi8(b, a, _mm_cmpgt_epu64_custom(a, b));
+}
+
+static inline v2sid _mm_min_epu64_custom(v2sid a, v2sid b)
+{
+    return _mm_blendv_epi8(a, b, _mm_cmpgt_epu64_custom(a, b));
+}
+
+// a shift by 64 gives 0, which covers imm == 0
+static inline v2sid _mm_srai_epi64_custom(v2sid a, int imm)
+{
+    v2sid sign = _mm_cmpgt_epi64(_mm_setzero_si128(), a);
+    return _mm_or_si128(_mm_srli_epi64(a, imm), _mm_slli_epi64(sign, 64 - imm));
+}
+
 #include "simd_utils_sse_double.h"
 
 #include "simd_utils_sse_float.h"
@@ -645,6 +789,17 @@ static inline v2sid _mm_cvtpd_epi64_custom(v2sd x)
 
 #ifdef AVX
 
+#ifdef DISPATCH
+#pragma GCC push_options
+#pragma GCC target("avx2,fma,f16c")
+#define FMA
+// g++ does not update the target macros after #pragma GCC target
+#if defined(__cplusplus) && !defined(__AVX2__)
+#define __AVX2__ 1
+#define DISPATCH_UNDEF_AVX2
+#endif
+#endif
+
 #ifndef __clang__
 #ifndef __INTEL_COMPILER
 #ifndef __cplusplus                                       // TODO : it seems to be defined with G++ 9.2 and not GCC 9.2
@@ -701,6 +856,24 @@ static inline __m256d _mm256_fnmadd_pd_custom(__m256d a, __m256d b, __m256d c)
 #endif /* FMA */
 }
 
+static inline __m256d _mm256_fmaddsub_pd_custom(__m256d a, __m256d b, __m256d c)
+{
+#ifndef FMA  // Haswell comes with avx2 and fma
+    return _mm256_addsub_pd(_mm256_mul_pd(a, b), c);
+#else  /* FMA */
+    return _mm256_fmaddsub_pd(a, b, c);
+#endif /* FMA */
+}
+
+static inline __m256d _mm256_fmsubadd_pd_custom(__m256d a, __m256d b, __m256d c)
+{
+#ifndef FMA  // Haswell comes with avx2 and fma
+    return _mm256_addsub_pd(_mm256_mul_pd(a, b), _mm256_xor_pd(c, *(v4sd *) _pd256_negative_mask));
+#else  /* FMA */
+    return _mm256_fmsubadd_pd(a, b, c);
+#endif /* FMA */
+}
+
 // https://stackoverflow.com/questions/41144668/how-to-efficiently-perform-double-int64-conversions-with-sse-avx
 //  Only works for inputs in the range: [-2^51, 2^51]
 static inline __m256i _mm256_cvtpd_epi64_custom(__m256d x)
@@ -731,6 +904,47 @@ static inline v4sd _mm256_cvtepi64_pd_signed_custom(v4sid x)
     return _mm256_sub_pd(_mm256_castsi256_pd(x), *(v4sd *) _pd256_epi64_mask);
 }
 
+// AVX2 versions of the SSE 64 bits integer helpers
+static inline v4sid _mm256_mullo_epi64_custom(v4sid a, v4sid b)
+{
+    v4sid lo = _mm256_mul_epu32(a, b);
+    v4sid cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b), _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+    return _mm256_add_epi64(lo, _mm256_slli_epi64(cross, 32));
+}
+
+static inline v4sid _mm256_cmpgt_epu64_custom(v4sid a, v4sid b)
+{
+    const v4sid sign = _mm256_set1_epi64x(INT64_MIN);
+    return _mm256_cmpgt_epi64(_mm256_xor_si256(a, sign), _mm256_xor_si256(b, sign));
+}
+
+static inline v4sid _mm256_max_epi64_custom(v4sid a, v4sid b)
+{
+    return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b));
+}
+
+static inline v4sid _mm256_min_epi64_custom(v4sid a, v4sid b)
+{
+    return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b));
+}
+
+static inline v4sid _mm256_max_epu64_custom(v4sid a, v4sid b)
+{
+    return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epu64_custom(a, b));
+}
+
+static inline v4sid _mm256_min_epu64_custom(v4sid a, v4sid b)
+{
+    return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epu64_custom(a, b));
+}
+
+// a shift by 64 gives 0, which covers imm == 0
+static inline v4sid _mm256_srai_epi64_custom(v4sid a, int imm)
+{
+    v4sid sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), a);
+    return _mm256_or_si256(_mm256_srli_epi64(a, imm), _mm256_slli_epi64(sign, 64 - imm));
+}
+
 #include "avx_mathfun.h"
 
 static inline v8sfx2 _mm256_load2_ps(float const *mem_addr)
@@ -819,10 +1033,19 @@ static inline void _mm256_store2u_pd(double *mem_addr, v4sdx2 a)
 
 #include "simd_utils_avx_strings.h"
 
+#ifdef DISPATCH
+#pragma GCC pop_options
+#endif
+
 #endif /* AVX */
 
 #ifdef AVX512
 
+#ifdef DISPATCH
+#pragma GCC push_options
+#pragma GCC target("avx2,fma,f16c,avx512f,avx512dq,avx512cd,avx512bw,avx512vl")
+#endif
+
 static const float _ps512_conj_mask[16] __attribute__((aligned(64))) = {1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f,
                                                                         1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f};
 
@@ -851,6 +1074,67 @@ static inline __m512d _mm512_fnmadd_pd_custom(__m512d a, __m512d b, __m512d c)
     return _mm512_fnmadd_pd(a, b, c);
 }
 
+static inline __m512d _mm512_fmaddsub_pd_custom(__m512d a, __m512d b, __m512d c)
+{
+    return _mm512_fmaddsub_pd(a, b, c);
+}
+
+static inline __m512d _mm512_fmsubadd_pd_custom(__m512d a, __m512d b, __m512d c)
+{
+    return _mm512_fmsubadd_pd(a, b, c);
+}
+
+/* Masks of the tails of the 512 bits loops : the first min(remaining, number of lanes) lanes are set.
+ * The masked loads do not fault on the masked out lanes, so the tails are done with one or two
+ * masked iterations of the vector code instead of a scalar loop */
+static inline __mmask16 tail_mask16(int remaining)
+{
+    if (remaining <= 0)
+        return 0;
+    return (remaining >= 16) ? (__mmask16) 0xFFFF : (__mmask16) ((1U << remaining) - 1U);
+}
+
+static inline __mmask8 tail_mask8(int remaining)
+{
+    if (remaining <= 0)
+        return 0;
+    return (remaining >= 8) ? (__mmask8) 0xFF : (__mmask8) ((1U << remaining) - 1U);
+}
+
+static inline __mmask32 tail_mask32(int remaining)
+{
+    if (remaining <= 0)
+        return 0;
+    return (remaining >= 32) ? (__mmask32) 0xFFFFFFFF : (__mmask32) ((1U << remaining) - 1U);
+}
+
+static inline __mmask64 tail_mask64(int remaining)
+{
+    if (remaining <= 0)
+        return 0;
+    return (remaining >= 64) ? (__mmask64) 0xFFFFFFFFFFFFFFFFULL : (__mmask64) ((1ULL << remaining) - 1ULL);
+}
+
+// hist[bins[k]] += 1 for the lanes k of mask, several lanes can hold the same bin (see simd_utils_hist.h)
+static inline void hist_add512(uint32_t *hist, v16si bins, __mmask16 mask)
+{
+    bins = _mm512_mask_mov_epi32(_mm512_set1_epi32(-1), mask, bins);  // no conflict with the unused lanes
+    v16si conf = _mm512_conflict_epi32(bins);                           // previous lanes with the same bin
+#ifdef __AVX512VPOPCNTDQ__
+    v16si count = _mm512_popcnt_epi32(conf);
+#else
+    v16si count = _mm512_sub_epi32(conf, _mm512_and_si512(_mm512_srli_epi32(conf, 1), _mm512_set1_epi32(0x55555555)));
+    count = _mm512_add_epi32(_mm512_and_si512(count, _mm512_set1_epi32(0x33333333)),
+                             _mm512_and_si512(_mm512_srli_epi32(count, 2), _mm512_set1_epi32(0x33333333)));
+    count = _mm512_and_si512(_mm512_add_epi32(count, _mm512_srli_epi32(count, 4)), _mm512_set1_epi32(0x0F0F0F0F));
+    count = _mm512_and_si512(_mm512_add_epi32(count, _mm512_srli_epi32(count, 8)), _mm512_set1_epi32(0x1F));  // conf < 2^15
+#endif
+    v16si counters = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, bins, (const int *) hist, 4);
+    counters = _mm512_add_epi32(counters, _mm512_add_epi32(count, _mm512_set1_epi32(1)));
+    // the scatter writes the lanes in order, the last lane of each bin holds the total count
+    _mm512_mask_i32scatter_epi32((int *) hist, mask, bins, counters, 4);
+}
+
 #include "avx512_mathfun.h"
 
 static inline v16sfx2 _mm512_load2_ps(float const *mem_addr)
@@ -889,6 +1173,25 @@ static inline void _mm512_store2u_ps(float *mem_addr, v16sfx2 a)
     _mm512_storeu_ps(mem_addr + AVX512_LEN_FLOAT, tmp2);
 }
 
+// loads/stores the first 'remaining' complex of an interleaved array (remaining < AVX512_LEN_FLOAT)
+static inline v16sfx2 _mm512_maskz_load2u_ps(int remaining, float const *mem_addr)
+{
+    v16sf vec1 = _mm512_maskz_loadu_ps(tail_mask16(2 * remaining), mem_addr);
+    v16sf vec2 = _mm512_maskz_loadu_ps(tail_mask16(2 * remaining - AVX512_LEN_FLOAT), mem_addr + AVX512_LEN_FLOAT);
+    v16sfx2 ret;
+    ret.val[0] = _mm512_permutex2var_ps(vec2, *(v16si *) _pi32_512_idx_re, vec1);
+    ret.val[1] = _mm512_permutex2var_ps(vec2, *(v16si *) _pi32_512_idx_im, vec1);
+    return ret;
+}
+
+static inline void _mm512_mask_store2u_ps(float *mem_addr, int remaining, v16sfx2 a)
+{
+    v16sf tmp1 = _mm512_permutex2var_ps(a.val[1], *(v16si *) _pi32_512_idx_cplx_lo, a.val[0]);
+    v16sf tmp2 = _mm512_permutex2var_ps(a.val[1], *(v16si *) _pi32_512_idx_cplx_hi, a.val[0]);
+    _mm512_mask_storeu_ps(mem_addr, tail_mask16(2 * remaining), tmp1);
+    _mm512_mask_storeu_ps(mem_addr + AVX512_LEN_FLOAT, tail_mask16(2 * remaining - AVX512_LEN_FLOAT), tmp2);
+}
+
 static inline v8sdx2 _mm512_load2_pd(double const *mem_addr)
 {
     v8sd vec1 = _mm512_load_pd(mem_addr);                      // load 0 1 2 3 4 5 6 7
@@ -925,13 +1228,48 @@ static inline void _mm512_store2u_pd(double *mem_addr, v8sdx2 a)
     _mm512_storeu_pd(mem_addr + AVX512_LEN_DOUBLE, tmp2);
 }
 
+static inline v8sdx2 _mm512_maskz_load2u_pd(int remaining, double const *mem_addr)
+{
+    v8sd vec1 = _mm512_maskz_loadu_pd(tail_mask8(2 * remaining), mem_addr);
+    v8sd vec2 = _mm512_maskz_loadu_pd(tail_mask8(2 * remaining - AVX512_LEN_DOUBLE), mem_addr + AVX512_LEN_DOUBLE);
+    v8sdx2 ret;
+    ret.val[0] = _mm512_permutex2var_pd(vec2, *(v8sid *) _pi64_512_idx_re, vec1);
+    ret.val[1] = _mm512_permutex2var_pd(vec2, *(v8sid *) _pi64_512_idx_im, vec1);
+    return ret;
+}
+
+static inline void _mm512_mask_store2u_pd(double *mem_addr, int remaining, v8sdx2 a)
+{
+    v8sd tmp1 = _mm512_permutex2var_pd(a.val[1], *(v8sid *) _pi64_512_idx_cplx_lo, a.val[0]);
+    v8sd tmp2 = _mm512_permutex2var_pd(a.val[1], *(v8sid *) _pi64_512_idx_cplx_hi, a.val[0]);
+    _mm512_mask_storeu_pd(mem_addr, tail_mask8(2 * remaining), tmp1);
+    _mm512_mask_storeu_pd(mem_addr + AVX512_LEN_DOUBLE, tail_mask8(2 * remaining - AVX512_LEN_DOUBLE), tmp2);
+}
+
 #include "simd_utils_avx512_double.h"
 #include "simd_utils_avx512_float.h"
 #include "simd_utils_avx512_int32.h"
 #include "simd_utils_avx512_strings.h"
 
+#ifdef DISPATCH
+#pragma GCC pop_options
+#endif
+
 #endif /* AVX512 */
 
+#ifdef DISPATCH
+#undef FMA
+#ifdef DISPATCH_UNDEF_AVX2
+#undef __AVX2__
+#undef DISPATCH_UNDEF_AVX2
+#endif
+#include "simd_utils_dispatch.h"
+#endif
+
+#ifdef THREADPOOL
+#include "simd_utils_threadpool.h"
+#endif
+
 #ifdef ICC
 #include "simd_utils_svml.h"
 #endif
@@ -1106,7 +1444,7 @@ static inline void aligned_free(void *p)
 
 
 //////////  C Test functions ////////////////
-static inline void log10f_C(float *src, float *dst, int len)
+SIMD_UTILS_API void log10f_C(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1115,7 +1453,7 @@ static inline void log10f_C(float *src, float *dst, int len)
         dst[i] = log10f(src[i]);
 }
 
-static inline void log10f_C_precise(float *src, float *dst, int len)
+SIMD_UTILS_API void log10f_C_precise(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1126,7 +1464,7 @@ static inline void log10f_C_precise(float *src, float *dst, int len)
     }
 }
 
-static inline void log2f_C(float *src, float *dst, int len)
+SIMD_UTILS_API void log2f_C(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1135,7 +1473,7 @@ static inline void log2f_C(float *src, float *dst, int len)
         dst[i] = log2f(src[i]);
 }
 
-static inline void log2f_C_precise(float *src, float *dst, int len)
+SIMD_UTILS_API void log2f_C_precise(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1146,7 +1484,7 @@ static inline void log2f_C_precise(float *src, float *dst, int len)
     }
 }
 
-static inline void lnf_C(float *src, float *dst, int len)
+SIMD_UTILS_API void lnf_C(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1155,7 +1493,7 @@ static inline void lnf_C(float *src, float *dst, int len)
         dst[i] = logf(src[i]);
 }
 
-static inline void lnf_C_precise(float *src, float *dst, int len)
+SIMD_UTILS_API void lnf_C_precise(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1166,7 +1504,7 @@ static inline void lnf_C_precise(float *src, float *dst, int len)
     }
 }
 
-static inline void ln_C(double *src, double *dst, int len)
+SIMD_UTILS_API void ln_C(double *src, double *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1176,7 +1514,7 @@ static inline void ln_C(double *src, double *dst, int len)
 }
 
 
-static inline void expf_C(float *src, float *dst, int len)
+SIMD_UTILS_API void expf_C(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1186,7 +1524,7 @@ static inline void expf_C(float *src, float *dst, int len)
     }
 }
 
-static inline void expf_C_precise(float *src, float *dst, int len)
+SIMD_UTILS_API void expf_C_precise(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1197,7 +1535,7 @@ static inline void expf_C_precise(float *src, float *dst, int len)
     }
 }
 
-static inline void exp_C(double *src, double *dst, int len)
+SIMD_UTILS_API void exp_C(double *src, double *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1207,7 +1545,107 @@ static inline void exp_C(double *src, double *dst, int len)
     }
 }
 
-static inline void cbrtf_C(float *src, float *dst, int len)
+SIMD_UTILS_API void log2d_C(double *src, double *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = log2(src[i]);
+    }
+}
+
+SIMD_UTILS_API void log10d_C(double *src, double *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = log10(src[i]);
+    }
+}
+
+SIMD_UTILS_API void sinhd_C(double *src, double *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = sinh(src[i]);
+    }
+}
+
+SIMD_UTILS_API void coshd_C(double *src, double *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = cosh(src[i]);
+    }
+}
+
+SIMD_UTILS_API void tanhd_C(double *src, double *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = tanh(src[i]);
+    }
+}
+
+SIMD_UTILS_API void asinhd_C(double *src, double *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = asinh(src[i]);
+    }
+}
+
+SIMD_UTILS_API void acoshd_C(double *src, double *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = acosh(src[i]);
+    }
+}
+
+SIMD_UTILS_API void atanhd_C(double *src, double *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = atanh(src[i]);
+    }
+}
+
+SIMD_UTILS_API void cbrtd_C(double *src, double *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = cbrt(src[i]);
+    }
+}
+
+SIMD_UTILS_API void acosd_C(double *src, double *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = acos(src[i]);
+    }
+}
+
+SIMD_UTILS_API void cbrtf_C(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1217,7 +1655,7 @@ static inline void cbrtf_C(float *src, float *dst, int len)
     }
 }
 
-static inline void cbrtf_C_precise(float *src, float *dst, int len)
+SIMD_UTILS_API void cbrtf_C_precise(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1228,7 +1666,7 @@ static inline void cbrtf_C_precise(float *src, float *dst, int len)
     }
 }
 
-static inline void fabsf_C(float *src, float *dst, int len)
+SIMD_UTILS_API void fabsf_C(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1238,7 +1676,7 @@ static inline void fabsf_C(float *src, float *dst, int len)
     }
 }
 
-static inline void setf_C(float *dst, float value, int len)
+SIMD_UTILS_API void setf_C(float *dst, float value, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1248,7 +1686,7 @@ static inline void setf_C(float *dst, float value, int len)
     }
 }
 
-static inline void zerof_C(float *dst, int len)
+SIMD_UTILS_API void zerof_C(float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1258,7 +1696,7 @@ static inline void zerof_C(float *dst, int len)
     }
 }
 
-static inline void copyf_C(float *src, float *dst, int len)
+SIMD_UTILS_API void copyf_C(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1268,7 +1706,7 @@ static inline void copyf_C(float *src, float *dst, int len)
     }
 }
 
-static inline void addcf_C(float *src, float value, float *dst, int len)
+SIMD_UTILS_API void addcf_C(float *src, float value, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1278,7 +1716,7 @@ static inline void addcf_C(float *src, float value, float *dst, int len)
     }
 }
 
-static inline void addcs_C(int32_t *src, int32_t value, int32_t *dst, int len)
+SIMD_UTILS_API void addcs_C(int32_t *src, int32_t value, int32_t *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1288,7 +1726,7 @@ static inline void addcs_C(int32_t *src, int32_t value, int32_t *dst, int len)
     }
 }
 
-static inline void mulf_C(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void mulf_C(float *src1, float *src2, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1298,7 +1736,7 @@ static inline void mulf_C(float *src1, float *src2, float *dst, int len)
     }
 }
 
-static inline void mulcf_C(float *src, float value, float *dst, int len)
+SIMD_UTILS_API void mulcf_C(float *src, float value, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1308,7 +1746,7 @@ static inline void mulcf_C(float *src, float value, float *dst, int len)
     }
 }
 
-static inline void muladdf_C(float *_a, float *_b, float *_c, float *dst, int len)
+SIMD_UTILS_API void muladdf_C(float *_a, float *_b, float *_c, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1318,7 +1756,7 @@ static inline void muladdf_C(float *_a, float *_b, float *_c, float *dst, int le
     }
 }
 
-static inline void mulcaddf_C(float *_a, float _b, float *_c, float *dst, int len)
+SIMD_UTILS_API void mulcaddf_C(float *_a, float _b, float *_c, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1328,7 +1766,7 @@ static inline void mulcaddf_C(float *_a, float _b, float *_c, float *dst, int le
     }
 }
 
-static inline void mulcaddcf_C(float *_a, float _b, float _c, float *dst, int len)
+SIMD_UTILS_API void mulcaddcf_C(float *_a, float _b, float _c, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1338,14 +1776,14 @@ static inline void mulcaddcf_C(float *_a, float _b, float _c, float *dst, int le
     }
 }
 
-static inline void muladdcf_C(float *_a, float *_b, float _c, float *dst, int len)
+SIMD_UTILS_API void muladdcf_C(float *_a, float *_b, float _c, float *dst, int len)
 {
     for (int i = 0; i < len; i++) {
         dst[i] = _a[i] * _b[i] + _c;
     }
 }
 
-static inline void muls_c(int32_t *a, int32_t *b, int32_t *c, int len)
+SIMD_UTILS_API void muls_c(int32_t *a, int32_t *b, int32_t *c, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1355,7 +1793,7 @@ static inline void muls_c(int32_t *a, int32_t *b, int32_t *c, int len)
     }
 }
 
-static inline void divf_C(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void divf_C(float *src1, float *src2, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1365,7 +1803,7 @@ static inline void divf_C(float *src1, float *src2, float *dst, int len)
     }
 }
 
-static inline void divf_C_precise(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void divf_C_precise(float *src1, float *src2, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1377,7 +1815,7 @@ static inline void divf_C_precise(float *src1, float *src2, float *dst, int len)
     }
 }
 
-static inline void cplxtorealf_C(complex32_t *src, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxtorealf_C(complex32_t *src, float *dstRe, float *dstIm, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1388,7 +1826,7 @@ static inline void cplxtorealf_C(complex32_t *src, float *dstRe, float *dstIm, i
     }
 }
 
-static inline void realtocplx_C(float *srcRe, float *srcIm, complex32_t *dst, int len)
+SIMD_UTILS_API void realtocplx_C(float *srcRe, float *srcIm, complex32_t *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1399,7 +1837,7 @@ static inline void realtocplx_C(float *srcRe, float *srcIm, complex32_t *dst, in
     }
 }
 
-static inline void cplxtoreald_C(complex64_t *src, double *dstRe, double *dstIm, int len)
+SIMD_UTILS_API void cplxtoreald_C(complex64_t *src, double *dstRe, double *dstIm, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1410,7 +1848,7 @@ static inline void cplxtoreald_C(complex64_t *src, double *dstRe, double *dstIm,
     }
 }
 
-static inline void realtocplxd_C(double *srcRe, double *srcIm, complex64_t *dst, int len)
+SIMD_UTILS_API void realtocplxd_C(double *srcRe, double *srcIm, complex64_t *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1421,7 +1859,7 @@ static inline void realtocplxd_C(double *srcRe, double *srcIm, complex64_t *dst,
     }
 }
 
-static inline void convert_64f32f_C(double *src, float *dst, int len)
+SIMD_UTILS_API void convert_64f32f_C(double *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1431,7 +1869,7 @@ static inline void convert_64f32f_C(double *src, float *dst, int len)
     }
 }
 
-static inline void convert_32f64f_C(float *src, double *dst, int len)
+SIMD_UTILS_API void convert_32f64f_C(float *src, double *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1441,7 +1879,7 @@ static inline void convert_32f64f_C(float *src, double *dst, int len)
     }
 }
 
-static inline void convertFloat32ToU8_C(float *src, uint8_t *dst, int len, int rounding_mode, int scale_factor)
+SIMD_UTILS_API void convertFloat32ToU8_C(float *src, uint8_t *dst, int len, int rounding_mode, int scale_factor)
 {
     float scale_fact_mult = 1.0f / (float) (1 << scale_factor);
 
@@ -1474,7 +1912,7 @@ static inline void convertFloat32ToU8_C(float *src, uint8_t *dst, int len, int r
     fesetround(rounding_ori);
 }
 
-static inline void convertFloat32ToI16_C(float *src, int16_t *dst, int len, int rounding_mode, int scale_factor)
+SIMD_UTILS_API void convertFloat32ToI16_C(float *src, int16_t *dst, int len, int rounding_mode, int scale_factor)
 {
     float scale_fact_mult = 1.0f / (float) (1 << scale_factor);
 
@@ -1510,7 +1948,7 @@ static inline void convertFloat32ToI16_C(float *src, int16_t *dst, int len, int
     fesetround(rounding_ori);
 }
 
-static inline void convertFloat32ToU16_C(float *src, uint16_t *dst, int len, int rounding_mode, int scale_factor)
+SIMD_UTILS_API void convertFloat32ToU16_C(float *src, uint16_t *dst, int len, int rounding_mode, int scale_factor)
 {
     float scale_fact_mult = 1.0f / (float) (1 << scale_factor);
 
@@ -1545,7 +1983,7 @@ static inline void convertFloat32ToU16_C(float *src, uint16_t *dst, int len, int
     fesetround(rounding_ori);
 }
 
-static inline void convertInt16ToFloat32_C(int16_t *src, float *dst, int len, int scale_factor)
+SIMD_UTILS_API void convertInt16ToFloat32_C(int16_t *src, float *dst, int len, int scale_factor)
 {
     float scale_fact_mult = 1.0f / (float) (1 << scale_factor);
 
@@ -1558,7 +1996,7 @@ static inline void convertInt16ToFloat32_C(int16_t *src, float *dst, int len, in
 }
 
 // Allow for integer up to 24bits without overflow
-static inline void convertInt32ToFloat32_C(int32_t *src, float *dst, int len, int scale_factor)
+SIMD_UTILS_API void convertInt32ToFloat32_C(int32_t *src, float *dst, int len, int scale_factor)
 {
     float scale_fact_mult = 1.0f / (float) (1 << scale_factor);
 
@@ -1570,7 +2008,7 @@ static inline void convertInt32ToFloat32_C(int32_t *src, float *dst, int len, in
     }
 }
 
-static inline void threshold_gt_f_C(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold_gt_f_C(float *src, float *dst, int len, float value)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1580,7 +2018,7 @@ static inline void threshold_gt_f_C(float *src, float *dst, int len, float value
     }
 }
 
-static inline void threshold_gtabs_f_C(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold_gtabs_f_C(float *src, float *dst, int len, float value)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1594,7 +2032,7 @@ static inline void threshold_gtabs_f_C(float *src, float *dst, int len, float va
     }
 }
 
-static inline void threshold_lt_f_C(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold_lt_f_C(float *src, float *dst, int len, float value)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1604,7 +2042,7 @@ static inline void threshold_lt_f_C(float *src, float *dst, int len, float value
     }
 }
 
-static inline void threshold_ltabs_f_C(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold_ltabs_f_C(float *src, float *dst, int len, float value)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1618,7 +2056,7 @@ static inline void threshold_ltabs_f_C(float *src, float *dst, int len, float va
     }
 }
 
-static inline void threshold_ltval_gtval_f_C(float *src, float *dst, int len, float ltlevel, float ltvalue, float gtlevel, float gtvalue)
+SIMD_UTILS_API void threshold_ltval_gtval_f_C(float *src, float *dst, int len, float ltlevel, float ltvalue, float gtlevel, float gtvalue)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1629,7 +2067,7 @@ static inline void threshold_ltval_gtval_f_C(float *src, float *dst, int len, fl
     }
 }
 
-static inline void magnitudef_C_interleaved(complex32_t *src, float *dst, int len)
+SIMD_UTILS_API void magnitudef_C_interleaved(complex32_t *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1639,7 +2077,7 @@ static inline void magnitudef_C_interleaved(complex32_t *src, float *dst, int le
     }
 }
 
-static inline void magnitudef_C_interleaved_precise(complex32_t *src, float *dst, int len)
+SIMD_UTILS_API void magnitudef_C_interleaved_precise(complex32_t *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1651,7 +2089,7 @@ static inline void magnitudef_C_interleaved_precise(complex32_t *src, float *dst
     }
 }
 
-static inline void magnitudef_C_split(float *srcRe, float *srcIm, float *dst, int len)
+SIMD_UTILS_API void magnitudef_C_split(float *srcRe, float *srcIm, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1661,7 +2099,7 @@ static inline void magnitudef_C_split(float *srcRe, float *srcIm, float *dst, in
     }
 }
 
-static inline void magnitudef_C_split_precise(float *srcRe, float *srcIm, float *dst, int len)
+SIMD_UTILS_API void magnitudef_C_split_precise(float *srcRe, float *srcIm, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1673,7 +2111,7 @@ static inline void magnitudef_C_split_precise(float *srcRe, float *srcIm, float
     }
 }
 
-static inline void powerspectf_C_split(float *srcRe, float *srcIm, float *dst, int len)
+SIMD_UTILS_API void powerspectf_C_split(float *srcRe, float *srcIm, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1683,7 +2121,7 @@ static inline void powerspectf_C_split(float *srcRe, float *srcIm, float *dst, i
     }
 }
 
-static inline void powerspectf_C_split_precise(float *srcRe, float *srcIm, float *dst, int len)
+SIMD_UTILS_API void powerspectf_C_split_precise(float *srcRe, float *srcIm, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1695,7 +2133,7 @@ static inline void powerspectf_C_split_precise(float *srcRe, float *srcIm, float
     }
 }
 
-static inline void powerspectf_C_interleaved(complex32_t *src, float *dst, int len)
+SIMD_UTILS_API void powerspectf_C_interleaved(complex32_t *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1705,7 +2143,7 @@ static inline void powerspectf_C_interleaved(complex32_t *src, float *dst, int l
     }
 }
 
-static inline void powerspectf_C_interleaved_precise(complex32_t *src, float *dst, int len)
+SIMD_UTILS_API void powerspectf_C_interleaved_precise(complex32_t *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1717,7 +2155,7 @@ static inline void powerspectf_C_interleaved_precise(complex32_t *src, float *ds
     }
 }
 
-static inline void meanf_C(float *src, float *dst, int len)
+SIMD_UTILS_API void meanf_C(float *src, float *dst, int len)
 {
     float acc = 0.0f;
     int i;
@@ -1734,7 +2172,7 @@ static inline void meanf_C(float *src, float *dst, int len)
     *dst = acc;
 }
 
-static inline void meanf_C_precise(float *src, float *dst, int len)
+SIMD_UTILS_API void meanf_C_precise(float *src, float *dst, int len)
 {
     double acc = 0.0;
     int i;
@@ -1752,7 +2190,7 @@ static inline void meanf_C_precise(float *src, float *dst, int len)
     *dst = (float) acc;
 }
 
-static inline void sumf_C(float *src, float *dst, int len)
+SIMD_UTILS_API void sumf_C(float *src, float *dst, int len)
 {
     float tmp_acc = 0.0f;
 
@@ -1762,42 +2200,93 @@ static inline void sumf_C(float *src, float *dst, int len)
     *dst = tmp_acc;
 }
 
-static inline void maxlocf_C(float *src, float *max, int *idx, int len)
+SIMD_UTILS_API void sumkahanf_C(float *src, float *dst, int len)
 {
-    float max_val = src[0];
-    int i;
-    int max_idx;
-    for (i = 1; i < len; i++) {
-        if (src[i] > max_val) {
-            max_val = src[i];
-            max_idx = i;
-        }
+    float tmp_acc = 0.0f;
+    float tmp_cor = 0.0f;
+
+    for (int i = 0; i < len; i++) {
+        kahan_addf(&tmp_acc, &tmp_cor, src[i]);
     }
-    *idx = max_idx;
-    *max = max_val;
+    *dst = tmp_acc + tmp_cor;
 }
 
-static inline void flipf_C(float *src, float *dst, int len)
+SIMD_UTILS_API void sumd_C(double *src, double *dst, int len)
 {
-#ifdef OMP
-#pragma omp simd
-#endif
+    double tmp_acc = 0.0;
+
     for (int i = 0; i < len; i++) {
-        dst[len - i - 1] = src[i];
+        tmp_acc += src[i];
     }
+    *dst = tmp_acc;
 }
 
-static inline void flips_C(int32_t *src, int32_t *dst, int len)
+SIMD_UTILS_API void sumkahand_C(double *src, double *dst, int len)
 {
-#ifdef OMP
-#pragma omp simd
+    double tmp_acc = 0.0;
+    double tmp_cor = 0.0;
+
+    for (int i = 0; i < len; i++) {
+        kahan_addd(&tmp_acc, &tmp_cor, src[i]);
+    }
+    *dst = tmp_acc + tmp_cor;
+}
+
+SIMD_UTILS_API void maxlocf_C(float *src, float *max, int *idx, int len)
+{
+    float max_val = src[0];
+    int max_idx = 0;
+    for (int i = 1; i < len; i++) {
+        if (src[i] > max_val) {
+            max_val = src[i];
+            max_idx = i;
+        }
+    }
+    *idx = max_idx;
+    *max = max_val;
+}
+
+SIMD_UTILS_API void minlocf_C(float *src, float *min, int *idx, int len)
+{
+    float min_val = src[0];
+    int min_idx = 0;
+    for (int i = 1; i < len; i++) {
+        if (src[i] < min_val) {
+            min_val = src[i];
+            min_idx = i;
+        }
+    }
+    *idx = min_idx;
+    *min = min_val;
+}
+
+SIMD_UTILS_API void minmaxlocf_C(float *src, int len, float *min_value, int *min_idx, float *max_value, int *max_idx)
+{
+    minlocf_C(src, min_value, min_idx, len);
+    maxlocf_C(src, max_value, max_idx, len);
+}
+
+SIMD_UTILS_API void flipf_C(float *src, float *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[len - i - 1] = src[i];
+    }
+}
+
+SIMD_UTILS_API void flips_C(int32_t *src, int32_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
 #endif
     for (int i = 0; i < len; i++) {
         dst[len - i - 1] = src[i];
     }
 }
 
-static inline void asinf_C(float *src, float *dst, int len)
+SIMD_UTILS_API void asinf_C(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1807,7 +2296,7 @@ static inline void asinf_C(float *src, float *dst, int len)
     }
 }
 
-static inline void asinf_C_precise(float *src, float *dst, int len)
+SIMD_UTILS_API void asinf_C_precise(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1818,7 +2307,7 @@ static inline void asinf_C_precise(float *src, float *dst, int len)
     }
 }
 
-static inline void asin_C(double *src, double *dst, int len)
+SIMD_UTILS_API void asin_C(double *src, double *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1828,7 +2317,7 @@ static inline void asin_C(double *src, double *dst, int len)
     }
 }
 
-static inline void tanf_C(float *src, float *dst, int len)
+SIMD_UTILS_API void tanf_C(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1838,7 +2327,7 @@ static inline void tanf_C(float *src, float *dst, int len)
     }
 }
 
-static inline void tanf_C_precise(float *src, float *dst, int len)
+SIMD_UTILS_API void tanf_C_precise(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1849,7 +2338,7 @@ static inline void tanf_C_precise(float *src, float *dst, int len)
     }
 }
 
-static inline void tan_C(double *src, double *dst, int len)
+SIMD_UTILS_API void tan_C(double *src, double *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1859,7 +2348,7 @@ static inline void tan_C(double *src, double *dst, int len)
     }
 }
 
-static inline void tanhf_C(float *src, float *dst, int len)
+SIMD_UTILS_API void tanhf_C(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1869,7 +2358,7 @@ static inline void tanhf_C(float *src, float *dst, int len)
     }
 }
 
-static inline void tanhf_C_precise(float *src, float *dst, int len)
+SIMD_UTILS_API void tanhf_C_precise(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1880,7 +2369,7 @@ static inline void tanhf_C_precise(float *src, float *dst, int len)
     }
 }
 
-static inline void sinhf_C(float *src, float *dst, int len)
+SIMD_UTILS_API void sinhf_C(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1890,7 +2379,7 @@ static inline void sinhf_C(float *src, float *dst, int len)
     }
 }
 
-static inline void sinhf_C_precise(float *src, float *dst, int len)
+SIMD_UTILS_API void sinhf_C_precise(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1901,7 +2390,7 @@ static inline void sinhf_C_precise(float *src, float *dst, int len)
     }
 }
 
-static inline void coshf_C(float *src, float *dst, int len)
+SIMD_UTILS_API void coshf_C(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1911,7 +2400,7 @@ static inline void coshf_C(float *src, float *dst, int len)
     }
 }
 
-static inline void coshf_C_precise(float *src, float *dst, int len)
+SIMD_UTILS_API void coshf_C_precise(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1922,7 +2411,7 @@ static inline void coshf_C_precise(float *src, float *dst, int len)
     }
 }
 
-static inline void atanhf_C(float *src, float *dst, int len)
+SIMD_UTILS_API void atanhf_C(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1932,7 +2421,7 @@ static inline void atanhf_C(float *src, float *dst, int len)
     }
 }
 
-static inline void atanhf_C_precise(float *src, float *dst, int len)
+SIMD_UTILS_API void atanhf_C_precise(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1943,7 +2432,7 @@ static inline void atanhf_C_precise(float *src, float *dst, int len)
     }
 }
 
-static inline void asinhf_C(float *src, float *dst, int len)
+SIMD_UTILS_API void asinhf_C(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1953,7 +2442,7 @@ static inline void asinhf_C(float *src, float *dst, int len)
     }
 }
 
-static inline void asinhf_C_precise(float *src, float *dst, int len)
+SIMD_UTILS_API void asinhf_C_precise(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1964,7 +2453,7 @@ static inline void asinhf_C_precise(float *src, float *dst, int len)
     }
 }
 
-static inline void acoshf_C(float *src, float *dst, int len)
+SIMD_UTILS_API void acoshf_C(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1974,7 +2463,7 @@ static inline void acoshf_C(float *src, float *dst, int len)
     }
 }
 
-static inline void acoshf_C_precise(float *src, float *dst, int len)
+SIMD_UTILS_API void acoshf_C_precise(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1985,7 +2474,7 @@ static inline void acoshf_C_precise(float *src, float *dst, int len)
     }
 }
 
-static inline void atan_C(double *src, double *dst, int len)
+SIMD_UTILS_API void atan_C(double *src, double *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -1995,7 +2484,7 @@ static inline void atan_C(double *src, double *dst, int len)
     }
 }
 
-static inline void atanf_C(float *src, float *dst, int len)
+SIMD_UTILS_API void atanf_C(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2005,7 +2494,7 @@ static inline void atanf_C(float *src, float *dst, int len)
     }
 }
 
-static inline void atanf_C_precise(float *src, float *dst, int len)
+SIMD_UTILS_API void atanf_C_precise(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2016,7 +2505,7 @@ static inline void atanf_C_precise(float *src, float *dst, int len)
     }
 }
 
-static inline void atan2f_C(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void atan2f_C(float *src1, float *src2, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2026,7 +2515,7 @@ static inline void atan2f_C(float *src1, float *src2, float *dst, int len)
     }
 }
 
-static inline void atan2f_C_precise(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void atan2f_C_precise(float *src1, float *src2, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2038,7 +2527,7 @@ static inline void atan2f_C_precise(float *src1, float *src2, float *dst, int le
     }
 }
 
-static inline void atan2f_interleaved_C(complex32_t *src, float *dst, int len)
+SIMD_UTILS_API void atan2f_interleaved_C(complex32_t *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2048,7 +2537,7 @@ static inline void atan2f_interleaved_C(complex32_t *src, float *dst, int len)
     }
 }
 
-static inline void atan2f_interleaved_C_precise(complex32_t *src, float *dst, int len)
+SIMD_UTILS_API void atan2f_interleaved_C_precise(complex32_t *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2060,7 +2549,7 @@ static inline void atan2f_interleaved_C_precise(complex32_t *src, float *dst, in
     }
 }
 
-static inline void atan2_C(double *src1, double *src2, double *dst, int len)
+SIMD_UTILS_API void atan2_C(double *src1, double *src2, double *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2070,7 +2559,7 @@ static inline void atan2_C(double *src1, double *src2, double *dst, int len)
     }
 }
 
-static inline void atan2_interleaved_C(complex64_t *src, double *dst, int len)
+SIMD_UTILS_API void atan2_interleaved_C(complex64_t *src, double *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2080,7 +2569,7 @@ static inline void atan2_interleaved_C(complex64_t *src, double *dst, int len)
     }
 }
 
-static inline void sinf_C(float *src, float *dst, int len)
+SIMD_UTILS_API void sinf_C(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2090,7 +2579,7 @@ static inline void sinf_C(float *src, float *dst, int len)
     }
 }
 
-static inline void sinf_C_precise(float *src, float *dst, int len)
+SIMD_UTILS_API void sinf_C_precise(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2101,7 +2590,7 @@ static inline void sinf_C_precise(float *src, float *dst, int len)
     }
 }
 
-static inline void cosf_C(float *src, float *dst, int len)
+SIMD_UTILS_API void cosf_C(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2111,7 +2600,7 @@ static inline void cosf_C(float *src, float *dst, int len)
     }
 }
 
-static inline void cosf_C_precise(float *src, float *dst, int len)
+SIMD_UTILS_API void cosf_C_precise(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2122,7 +2611,7 @@ static inline void cosf_C_precise(float *src, float *dst, int len)
     }
 }
 
-static inline void sincosf_C(float *src, float *dst_sin, float *dst_cos, int len)
+SIMD_UTILS_API void sincosf_C(float *src, float *dst_sin, float *dst_cos, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2132,7 +2621,7 @@ static inline void sincosf_C(float *src, float *dst_sin, float *dst_cos, int len
     }
 }
 
-static inline void sincosf_C_precise(float *src, float *dst_sin, float *dst_cos, int len)
+SIMD_UTILS_API void sincosf_C_precise(float *src, float *dst_sin, float *dst_cos, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2144,7 +2633,7 @@ static inline void sincosf_C_precise(float *src, float *dst_sin, float *dst_cos,
     }
 }
 
-static inline void sincosd_C(double *src, double *dst_sin, double *dst_cos, int len)
+SIMD_UTILS_API void sincosd_C(double *src, double *dst_sin, double *dst_cos, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2156,7 +2645,7 @@ static inline void sincosd_C(double *src, double *dst_sin, double *dst_cos, int
 }
 
 #if 0  // TODO : long double is C standard but not IEEE, not the same length with different OS/Architecture
-static inline void sincosd_C_precise(double *src, double *dst_sin, double *dst_cos, int len)
+SIMD_UTILS_API void sincosd_C_precise(double *src, double *dst_sin, double *dst_cos, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2170,7 +2659,7 @@ static inline void sincosd_C_precise(double *src, double *dst_sin, double *dst_c
 #endif
 
 // e^ix = cos(x) + i*sin(x)
-static inline void sincosf_C_interleaved(float *src, complex32_t *dst, int len)
+SIMD_UTILS_API void sincosf_C_interleaved(float *src, complex32_t *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2180,7 +2669,7 @@ static inline void sincosf_C_interleaved(float *src, complex32_t *dst, int len)
     }
 }
 
-static inline void sincosf_C_interleaved_precise(float *src, complex32_t *dst, int len)
+SIMD_UTILS_API void sincosf_C_interleaved_precise(float *src, complex32_t *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2192,7 +2681,7 @@ static inline void sincosf_C_interleaved_precise(float *src, complex32_t *dst, i
     }
 }
 
-static inline void sincosd_C_interleaved(double *src, complex64_t *dst, int len)
+SIMD_UTILS_API void sincosd_C_interleaved(double *src, complex64_t *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2203,7 +2692,7 @@ static inline void sincosd_C_interleaved(double *src, complex64_t *dst, int len)
     }
 }
 
-static inline void sqrtf_C(float *src, float *dst, int len)
+SIMD_UTILS_API void sqrtf_C(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2213,7 +2702,7 @@ static inline void sqrtf_C(float *src, float *dst, int len)
     }
 }
 
-static inline void sqrtf_C_precise(float *src, float *dst, int len)
+SIMD_UTILS_API void sqrtf_C_precise(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2224,7 +2713,7 @@ static inline void sqrtf_C_precise(float *src, float *dst, int len)
     }
 }
 
-static inline void modff_C(float *src, float *integer, float *remainder, int len)
+SIMD_UTILS_API void modff_C(float *src, float *integer, float *remainder, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2234,7 +2723,7 @@ static inline void modff_C(float *src, float *integer, float *remainder, int len
     }
 }
 
-static inline void floorf_C(float *src, float *dst, int len)
+SIMD_UTILS_API void floorf_C(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2244,7 +2733,7 @@ static inline void floorf_C(float *src, float *dst, int len)
     }
 }
 
-static inline void ceilf_C(float *src, float *dst, int len)
+SIMD_UTILS_API void ceilf_C(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2254,7 +2743,7 @@ static inline void ceilf_C(float *src, float *dst, int len)
     }
 }
 
-static inline void roundf_C(float *src, float *dst, int len)
+SIMD_UTILS_API void roundf_C(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2264,7 +2753,7 @@ static inline void roundf_C(float *src, float *dst, int len)
     }
 }
 
-static inline void rintf_C(float *src, float *dst, int len)
+SIMD_UTILS_API void rintf_C(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2275,7 +2764,7 @@ static inline void rintf_C(float *src, float *dst, int len)
 }
 
 
-static inline void truncf_C(float *src, float *dst, int len)
+SIMD_UTILS_API void truncf_C(float *src, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2285,7 +2774,7 @@ static inline void truncf_C(float *src, float *dst, int len)
     }
 }
 
-static inline void floord_C(double *src, double *dst, int len)
+SIMD_UTILS_API void floord_C(double *src, double *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2295,7 +2784,7 @@ static inline void floord_C(double *src, double *dst, int len)
     }
 }
 
-static inline void ceild_C(double *src, double *dst, int len)
+SIMD_UTILS_API void ceild_C(double *src, double *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2305,7 +2794,7 @@ static inline void ceild_C(double *src, double *dst, int len)
     }
 }
 
-static inline void roundd_C(double *src, double *dst, int len)
+SIMD_UTILS_API void roundd_C(double *src, double *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2315,7 +2804,7 @@ static inline void roundd_C(double *src, double *dst, int len)
     }
 }
 
-static inline void rintd_C(double *src, double *dst, int len)
+SIMD_UTILS_API void rintd_C(double *src, double *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2325,7 +2814,7 @@ static inline void rintd_C(double *src, double *dst, int len)
     }
 }
 
-static inline void truncd_C(double *src, double *dst, int len)
+SIMD_UTILS_API void truncd_C(double *src, double *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2335,7 +2824,7 @@ static inline void truncd_C(double *src, double *dst, int len)
     }
 }
 
-static inline void cplxvecdiv_C(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxvecdiv_C(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2347,7 +2836,7 @@ static inline void cplxvecdiv_C(complex32_t *src1, complex32_t *src2, complex32_
     }
 }
 
-static inline void cplxvecdiv_C_precise(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxvecdiv_C_precise(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2364,7 +2853,7 @@ static inline void cplxvecdiv_C_precise(complex32_t *src1, complex32_t *src2, co
 }
 
 
-static inline void cplxvecdiv_C_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxvecdiv_C_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2376,7 +2865,7 @@ static inline void cplxvecdiv_C_split(float *src1Re, float *src1Im, float *src2R
     }
 }
 
-static inline void cplxvecdiv_C_split_precise(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxvecdiv_C_split_precise(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2392,7 +2881,7 @@ static inline void cplxvecdiv_C_split_precise(float *src1Re, float *src1Im, floa
     }
 }
 
-static inline void cplxvecmul_C(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxvecmul_C(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2403,7 +2892,7 @@ static inline void cplxvecmul_C(complex32_t *src1, complex32_t *src2, complex32_
     }
 }
 
-static inline void cplxvecmul_C_precise(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxvecmul_C_precise(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2418,7 +2907,7 @@ static inline void cplxvecmul_C_precise(complex32_t *src1, complex32_t *src2, co
     }
 }
 
-static inline void cplxvecmul_C_unrolled8(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxvecmul_C_unrolled8(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
 {
     int stop_len = len / 8;
     stop_len *= 8;
@@ -2450,7 +2939,7 @@ static inline void cplxvecmul_C_unrolled8(complex32_t *src1, complex32_t *src2,
     }
 }
 
-static inline void cplxvecmul_C_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxvecmul_C_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2461,7 +2950,7 @@ static inline void cplxvecmul_C_split(float *src1Re, float *src1Im, float *src2R
     }
 }
 
-static inline void cplxvecmul_C_split_precise(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxvecmul_C_split_precise(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2476,7 +2965,7 @@ static inline void cplxvecmul_C_split_precise(float *src1Re, float *src1Im, floa
     }
 }
 
-static inline void cplxconjvecmul_C(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxconjvecmul_C(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2487,7 +2976,7 @@ static inline void cplxconjvecmul_C(complex32_t *src1, complex32_t *src2, comple
     }
 }
 
-static inline void cplxconjvecmul_C_precise(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxconjvecmul_C_precise(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2505,7 +2994,7 @@ static inline void cplxconjvecmul_C_precise(complex32_t *src1, complex32_t *src2
     }
 }
 
-static inline void cplxconjvecmul_C_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxconjvecmul_C_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2516,7 +3005,7 @@ static inline void cplxconjvecmul_C_split(float *src1Re, float *src1Im, float *s
     }
 }
 
-static inline void cplxconjvecmul_C_split_precise(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxconjvecmul_C_split_precise(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2534,7 +3023,7 @@ static inline void cplxconjvecmul_C_split_precise(float *src1Re, float *src1Im,
     }
 }
 
-static inline void cplxconj_C(complex32_t *src, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxconj_C(complex32_t *src, complex32_t *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2545,7 +3034,7 @@ static inline void cplxconj_C(complex32_t *src, complex32_t *dst, int len)
     }
 }
 
-static inline void dotf_C(float *src1, float *src2, int len, float *dst)
+SIMD_UTILS_API void dotf_C(float *src1, float *src2, int len, float *dst)
 {
     float tmp_acc = 0.0f;
 #ifdef OMP
@@ -2557,7 +3046,7 @@ static inline void dotf_C(float *src1, float *src2, int len, float *dst)
     *dst = tmp_acc;
 }
 
-static inline void dotf_C_precise(float *src1, float *src2, int len, float *dst)
+SIMD_UTILS_API void dotf_C_precise(float *src1, float *src2, int len, float *dst)
 {
     double tmp_acc = 0.0;
 #ifdef OMP
@@ -2569,7 +3058,7 @@ static inline void dotf_C_precise(float *src1, float *src2, int len, float *dst)
     *dst = (float) tmp_acc;
 }
 
-static inline void dotcf_C(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst)
+SIMD_UTILS_API void dotcf_C(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst)
 {
     complex32_t dst_tmp;
 	dst_tmp.re = 0.0f;
@@ -2587,7 +3076,7 @@ static inline void dotcf_C(complex32_t *src1, complex32_t *src2, int len, comple
     dst->im = dst_tmp.im;
 }
 
-static inline void dotcf_C_precise(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst)
+SIMD_UTILS_API void dotcf_C_precise(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst)
 {
     complex64_t dst_tmp;
 	dst_tmp.re = 0.0;
@@ -2606,381 +3095,403 @@ static inline void dotcf_C_precise(complex32_t *src1, complex32_t *src2, int len
     dst->im = (float) dst_tmp.im;
 }
 
-static inline void vectorSlopef_C(float *dst, int len, float offset, float slope)
+SIMD_UTILS_API void dotkahanf_C(float *src1, float *src2, int len, float *dst)
 {
-#ifdef OMP
-#pragma omp simd
-#endif
+    float tmp_acc = 0.0f;
+    float tmp_cor = 0.0f;
+
     for (int i = 0; i < len; i++) {
-        dst[i] = (float) i * slope + offset;
+        kahan_addf(&tmp_acc, &tmp_cor, src1[i] * src2[i]);
     }
+    *dst = tmp_acc + tmp_cor;
 }
 
-static inline void vectorSloped_C(double *dst, int len, double offset, double slope)
+SIMD_UTILS_API void dotckahanf_C(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst)
 {
-#ifdef OMP
-#pragma omp simd
-#endif
+    complex32_t dst_tmp = {0.0f, 0.0f};
+    complex32_t dst_cor = {0.0f, 0.0f};
+
     for (int i = 0; i < len; i++) {
-        dst[i] = (double) i * slope + offset;
+        kahan_addf(&dst_tmp.re, &dst_cor.re, src1[i].re * src2[i].re - (src1[i].im * src2[i].im));
+        kahan_addf(&dst_tmp.im, &dst_cor.im, src1[i].re * src2[i].im + (src2[i].re * src1[i].im));
     }
+
+    dst->re = dst_tmp.re + dst_cor.re;
+    dst->im = dst_tmp.im + dst_cor.im;
 }
 
-static inline void vectorSlopes_C(int32_t *dst, int len, int32_t offset, int32_t slope)
+SIMD_UTILS_API void dotd_C(double *src1, double *src2, int len, double *dst)
 {
+    double tmp_acc = 0.0;
 #ifdef OMP
 #pragma omp simd
 #endif
     for (int i = 0; i < len; i++) {
-        dst[i] = (int32_t) i * slope + offset;
+        tmp_acc += src1[i] * src2[i];
     }
+    *dst = tmp_acc;
 }
 
-static inline void maxeveryf_c(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void dotkahand_C(double *src1, double *src2, int len, double *dst)
 {
-#ifdef OMP
-#pragma omp simd
-#endif
+    double tmp_acc = 0.0;
+    double tmp_cor = 0.0;
+
     for (int i = 0; i < len; i++) {
-        dst[i] = src1[i] > src2[i] ? src1[i] : src2[i];
+        kahan_addd(&tmp_acc, &tmp_cor, src1[i] * src2[i]);
     }
+    *dst = tmp_acc + tmp_cor;
 }
 
-static inline void mineveryf_c(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void dotcd_C(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst)
 {
+    complex64_t dst_tmp;
+    dst_tmp.re = 0.0;
+    dst_tmp.im = 0.0;
+
 #ifdef OMP
 #pragma omp simd
 #endif
     for (int i = 0; i < len; i++) {
-        dst[i] = src1[i] < src2[i] ? src1[i] : src2[i];
+        dst_tmp.re += src1[i].re * src2[i].re - (src1[i].im * src2[i].im);
+        dst_tmp.im += src1[i].re * src2[i].im + (src2[i].re * src1[i].im);
     }
+
+    dst->re = dst_tmp.re;
+    dst->im = dst_tmp.im;
 }
 
-static inline void minmaxf_c(float *src, int len, float *min_value, float *max_value)
+SIMD_UTILS_API void dotckahand_C(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst)
 {
-    float min_tmp = src[0];
-    float max_tmp = src[0];
+    complex64_t dst_tmp = {0.0, 0.0};
+    complex64_t dst_cor = {0.0, 0.0};
 
-#ifdef OMP
-#pragma omp simd
-#endif
-    for (int i = 1; i < len; i++) {
-        max_tmp = max_tmp > src[i] ? max_tmp : src[i];
-        min_tmp = min_tmp < src[i] ? min_tmp : src[i];
+    for (int i = 0; i < len; i++) {
+        kahan_addd(&dst_tmp.re, &dst_cor.re, src1[i].re * src2[i].re - (src1[i].im * src2[i].im));
+        kahan_addd(&dst_tmp.im, &dst_cor.im, src1[i].re * src2[i].im + (src2[i].re * src1[i].im));
     }
 
-    *max_value = max_tmp;
-    *min_value = min_tmp;
+    dst->re = dst_tmp.re + dst_cor.re;
+    dst->im = dst_tmp.im + dst_cor.im;
 }
 
-static inline void addf_c(float *a, float *b, float *c, int len)
+// Welford update of the moments with each element
+SIMD_UTILS_API void momentsf_C(float *src, int len, moments_t *m)
 {
-#ifdef OMP
-#pragma omp simd
-#endif
     for (int i = 0; i < len; i++) {
-        c[i] = a[i] + b[i];
+        double n1 = m->n;
+        double n = n1 + 1.0;
+        double delta = (double) src[i] - m->mean;
+        double delta_n = delta / n;
+        double delta_n2 = delta_n * delta_n;
+        double term1 = delta * delta_n * n1;
+        m->mean += delta_n;
+        m->m4 += term1 * delta_n2 * (n * n - 3.0 * n + 3.0) + 6.0 * delta_n2 * m->m2 - 4.0 * delta_n * m->m3;
+        m->m3 += term1 * delta_n * (n - 2.0) - 3.0 * delta_n * m->m2;
+        m->m2 += term1;
+        m->n = n;
     }
 }
 
-static inline void adds_c(int32_t *a, int32_t *b, int32_t *c, int len)
+SIMD_UTILS_API void momentsd_C(double *src, int len, moments_t *m)
 {
-#ifdef OMP
-#pragma omp simd
-#endif
     for (int i = 0; i < len; i++) {
-        c[i] = a[i] + b[i];
+        double n1 = m->n;
+        double n = n1 + 1.0;
+        double delta = src[i] - m->mean;
+        double delta_n = delta / n;
+        double delta_n2 = delta_n * delta_n;
+        double term1 = delta * delta_n * n1;
+        m->mean += delta_n;
+        m->m4 += term1 * delta_n2 * (n * n - 3.0 * n + 3.0) + 6.0 * delta_n2 * m->m2 - 4.0 * delta_n * m->m3;
+        m->m3 += term1 * delta_n * (n - 2.0) - 3.0 * delta_n * m->m2;
+        m->m2 += term1;
+        m->n = n;
     }
 }
 
-
-static inline void subf_c(float *a, float *b, float *c, int len)
+SIMD_UTILS_API void histogramu8_C(uint8_t *src, int len, uint32_t *hist)
 {
-#ifdef OMP
-#pragma omp simd
-#endif
     for (int i = 0; i < len; i++) {
-        c[i] = a[i] - b[i];
+        hist[src[i]]++;
     }
 }
 
-static inline void subcrevf_C(float *src, float value, float *dst, int len)
+SIMD_UTILS_API void histogram16s_C(int16_t *src, int len, int16_t low, int shift, int nb_bins, uint32_t *hist)
 {
     for (int i = 0; i < len; i++) {
-        dst[i] = value - src[i];
+        int32_t bin = hist_bini((int32_t) src[i], (int32_t) low, shift, nb_bins);
+        if (bin < nb_bins)
+            hist[bin]++;
     }
 }
 
-static inline void subs_c(int32_t *a, int32_t *b, int32_t *c, int len)
+SIMD_UTILS_API void histograms_C(int32_t *src, int len, int32_t low, int shift, int nb_bins, uint32_t *hist)
 {
-#ifdef OMP
-#pragma omp simd
-#endif
     for (int i = 0; i < len; i++) {
-        c[i] = a[i] - b[i];
+        int32_t bin = hist_bini(src[i], low, shift, nb_bins);
+        if (bin < nb_bins)
+            hist[bin]++;
     }
 }
 
-/*static inline void orf_c(float *a, float *b, float *c, int len)
+SIMD_UTILS_API void histogramf_C(float *src, int len, float low, float high, int nb_bins, uint32_t *hist)
 {
-#ifdef OMP
-#pragma omp simd
-#endif
+    float scale = hist_scalef(low, high, nb_bins);
     for (int i = 0; i < len; i++) {
-        c[i] = a[i] | b[i];
+        int32_t bin = hist_binf(src[i], low, high, scale, nb_bins);
+        if (bin < nb_bins)
+            hist[bin]++;
     }
-}*/
+}
 
-static inline void setd_C(double *dst, double value, int len)
+SIMD_UTILS_API void histogramf_edges_C(float *src, int len, float *edges, int nb_bins, uint32_t *hist)
 {
-#ifdef OMP
-#pragma omp simd
-#endif
+    int step = hist_edges_step(nb_bins);
     for (int i = 0; i < len; i++) {
-        dst[i] = value;
+        int32_t bin = hist_bin_edgesf(src[i], edges, nb_bins, step);
+        if (bin < nb_bins)
+            hist[bin]++;
     }
 }
 
-static inline void zerod_C(double *dst, int len)
+/* Prefix sums (prefixsumXf, prefixsumXf_excl) and differences (diffXf), and their double,
+ * int32 and int16 versions.
+ * prefixsum : dst[i] = carry + src[0] + ... + src[i], prefixsum_excl : dst[i] = carry + src[0] + ... + src[i - 1].
+ * carry (NULL for 0) gets the total, so that consecutive calls continue the sums of a stream.
+ * diff : dst[i] = src[i] - src[i - 1], src[-1] being *prev (NULL for 0), which gets src[len - 1] :
+ * diff is the inverse of prefixsum. src and dst can be the same array.
+ * The sums of the lanes of the vectors are computed with log2(lanes) shifts and adds, then
+ * the carry is added, so the float and double results differ from the C versions by rounding.
+ * The int32 and int16 sums wrap around. */
+SIMD_UTILS_API void prefixsumf_C(float *src, float *dst, int len, float *carry)
 {
-#ifdef OMP
-#pragma omp simd
-#endif
+    float carry_tmp = carry ? *carry : 0.0f;
     for (int i = 0; i < len; i++) {
-        dst[i] = 0.0;
+        float x = src[i];
+        carry_tmp = carry_tmp + x;
+        dst[i] = carry_tmp;
     }
+    if (carry)
+        *carry = carry_tmp;
 }
 
-static inline void copyd_C(double *src, double *dst, int len)
+SIMD_UTILS_API void prefixsumf_excl_C(float *src, float *dst, int len, float *carry)
 {
-#ifdef OMP
-#pragma omp simd
-#endif
+    float carry_tmp = carry ? *carry : 0.0f;
     for (int i = 0; i < len; i++) {
-        dst[i] = src[i];
+        float x = src[i];
+        dst[i] = carry_tmp;
+        carry_tmp = carry_tmp + x;
     }
+    if (carry)
+        *carry = carry_tmp;
 }
 
-static inline void copys_C(int32_t *src, int32_t *dst, int len)
+SIMD_UTILS_API void difff_C(float *src, float *dst, int len, float *prev)
 {
-#ifdef OMP
-#pragma omp simd
-#endif
+    float prev_tmp = prev ? *prev : 0.0f;
     for (int i = 0; i < len; i++) {
-        dst[i] = src[i];
+        float x = src[i];
+        dst[i] = x - prev_tmp;
+        prev_tmp = x;
     }
+    if (prev)
+        *prev = prev_tmp;
 }
 
-static inline void sqrtd_C(double *src, double *dst, int len)
+SIMD_UTILS_API void prefixsumd_C(double *src, double *dst, int len, double *carry)
 {
-#ifdef OMP
-#pragma omp simd
-#endif
+    double carry_tmp = carry ? *carry : 0.0;
     for (int i = 0; i < len; i++) {
-        dst[i] = sqrt(src[i]);
+        double x = src[i];
+        carry_tmp = carry_tmp + x;
+        dst[i] = carry_tmp;
     }
+    if (carry)
+        *carry = carry_tmp;
 }
 
-static inline void addd_c(double *a, double *b, double *c, int len)
+SIMD_UTILS_API void prefixsumd_excl_C(double *src, double *dst, int len, double *carry)
 {
-#ifdef OMP
-#pragma omp simd
-#endif
+    double carry_tmp = carry ? *carry : 0.0;
     for (int i = 0; i < len; i++) {
-        c[i] = a[i] + b[i];
+        double x = src[i];
+        dst[i] = carry_tmp;
+        carry_tmp = carry_tmp + x;
     }
+    if (carry)
+        *carry = carry_tmp;
 }
 
-static inline void muld_c(double *a, double *b, double *c, int len)
+SIMD_UTILS_API void diffd_C(double *src, double *dst, int len, double *prev)
 {
-#ifdef OMP
-#pragma omp simd
-#endif
+    double prev_tmp = prev ? *prev : 0.0;
     for (int i = 0; i < len; i++) {
-        c[i] = a[i] * b[i];
+        double x = src[i];
+        dst[i] = x - prev_tmp;
+        prev_tmp = x;
     }
+    if (prev)
+        *prev = prev_tmp;
 }
 
-static inline void subd_c(double *a, double *b, double *c, int len)
+SIMD_UTILS_API void prefixsums_C(int32_t *src, int32_t *dst, int len, int32_t *carry)
 {
-#ifdef OMP
-#pragma omp simd
-#endif
+    int32_t carry_tmp = carry ? *carry : 0;
     for (int i = 0; i < len; i++) {
-        c[i] = a[i] - b[i];
+        int32_t x = src[i];
+        carry_tmp = (int32_t) ((uint32_t) carry_tmp + (uint32_t) x);
+        dst[i] = carry_tmp;
     }
+    if (carry)
+        *carry = carry_tmp;
 }
 
-static inline void divd_c(double *a, double *b, double *c, int len)
+SIMD_UTILS_API void prefixsums_excl_C(int32_t *src, int32_t *dst, int len, int32_t *carry)
 {
-#ifdef OMP
-#pragma omp simd
-#endif
+    int32_t carry_tmp = carry ? *carry : 0;
     for (int i = 0; i < len; i++) {
-        c[i] = a[i] / b[i];
+        int32_t x = src[i];
+        dst[i] = carry_tmp;
+        carry_tmp = (int32_t) ((uint32_t) carry_tmp + (uint32_t) x);
     }
+    if (carry)
+        *carry = carry_tmp;
 }
 
-static inline void mulcd_C(double *src, double value, double *dst, int len)
+SIMD_UTILS_API void diffs_C(int32_t *src, int32_t *dst, int len, int32_t *prev)
 {
-#ifdef OMP
-#pragma omp simd
-#endif
+    int32_t prev_tmp = prev ? *prev : 0;
     for (int i = 0; i < len; i++) {
-        dst[i] = src[i] * value;
+        int32_t x = src[i];
+        dst[i] = (int32_t) ((uint32_t) x - (uint32_t) prev_tmp);
+        prev_tmp = x;
     }
+    if (prev)
+        *prev = prev_tmp;
 }
 
-static inline void muladdd_C(double *_a, double *_b, double *_c, double *dst, int len)
+SIMD_UTILS_API void prefixsum16s_C(int16_t *src, int16_t *dst, int len, int16_t *carry)
 {
+    int16_t carry_tmp = carry ? *carry : 0;
     for (int i = 0; i < len; i++) {
-        dst[i] = _a[i] * _b[i] + _c[i];
+        int16_t x = src[i];
+        carry_tmp = (int16_t) (carry_tmp + x);
+        dst[i] = carry_tmp;
     }
+    if (carry)
+        *carry = carry_tmp;
 }
 
-static inline void mulcaddd_C(double *_a, double _b, double *_c, double *dst, int len)
+SIMD_UTILS_API void prefixsum16s_excl_C(int16_t *src, int16_t *dst, int len, int16_t *carry)
 {
+    int16_t carry_tmp = carry ? *carry : 0;
     for (int i = 0; i < len; i++) {
-        dst[i] = _a[i] * _b + _c[i];
+        int16_t x = src[i];
+        dst[i] = carry_tmp;
+        carry_tmp = (int16_t) (carry_tmp + x);
     }
+    if (carry)
+        *carry = carry_tmp;
 }
 
-static inline void mulcaddcd_C(double *_a, double _b, double _c, double *dst, int len)
+SIMD_UTILS_API void diff16s_C(int16_t *src, int16_t *dst, int len, int16_t *prev)
 {
+    int16_t prev_tmp = prev ? *prev : 0;
     for (int i = 0; i < len; i++) {
-        dst[i] = _a[i] * _b + _c;
+        int16_t x = src[i];
+        dst[i] = (int16_t) (x - prev_tmp);
+        prev_tmp = x;
     }
+    if (prev)
+        *prev = prev_tmp;
 }
 
-static inline void muladdcd_C(double *_a, double *_b, double _c, double *dst, int len)
+// quicksort with scalar partitions, insertion sorts below 16 elements (see simd_utils_sort.h)
+SIMD_UTILS_API void sortf_C(float *src, int len)
 {
-    for (int i = 0; i < len; i++) {
-        dst[i] = _a[i] * _b[i] + _c;
-    }
+    sort_runf(src, len, 16, sort_partitionf, insertion_sortf);
 }
 
-static inline void addcd_C(double *src, double value, double *dst, int len)
+SIMD_UTILS_API void sortd_C(double *src, int len)
 {
-#ifdef OMP
-#pragma omp simd
-#endif
-    for (int i = 0; i < len; i++) {
-        dst[i] = src[i] + value;
-    }
+    sort_rund(src, len, 16, sort_partitiond, insertion_sortd);
 }
 
-static inline void ors_C(int32_t *a, int32_t *b, int32_t *c, int len)
+SIMD_UTILS_API void sorts_C(int32_t *src, int len)
 {
-#ifdef OMP
-#pragma omp simd
-#endif
-    for (int i = 0; i < len; i++) {
-        c[i] = a[i] | b[i];
-    }
+    sort_runs(src, len, 16, sort_partitions, insertion_sorts);
 }
 
-/*static inline void andf_C(float *a, float *b, float *c, int len)
+SIMD_UTILS_API void sortf_kv_C(float *keys, int32_t *values, int len)
 {
-#ifdef OMP
-#pragma omp simd
-#endif
-    for (int i = 0; i < len; i++) {
-        c[i] = a[i] & b[i];
-    }
-}*/
+    sort_runf_kv(keys, values, len, 16, sort_partitionf_kv, insertion_sortf_kv);
+}
 
-static inline void ands_C(int32_t *a, int32_t *b, int32_t *c, int len)
+// the k smallest elements sorted at the beginning of src (see simd_utils_sort.h)
+SIMD_UTILS_API void partialsortf_C(float *src, int len, int k)
 {
-#ifdef OMP
-#pragma omp simd
-#endif
-    for (int i = 0; i < len; i++) {
-        c[i] = a[i] & b[i];
-    }
+    partialsort_runf(src, len, k, 16, sort_partitionf, insertion_sortf);
 }
 
-static inline void sigmoidf_C(float *src, float *dst, int len)
+SIMD_UTILS_API void partialsorts_C(int32_t *src, int len, int k)
 {
-#ifdef OMP
-#pragma omp simd
-#endif
-    for (int i = 0; i < len; i++) {
-        dst[i] = 1.0f / (1.0f + expf(-src[i]));
-    }
+    partialsort_runs(src, len, k, 16, sort_partitions, insertion_sorts);
 }
 
-// parametric ReLU
-// simple ReLU can be expressed as threshold_lt with value = 0
-static inline void PReluf_C(float *src, float *dst, float alpha, int len)
+// k largest (topk) or smallest (bottomk) elements with their indices (see simd_utils_topk.h)
+SIMD_UTILS_API void topkf_C(float *src, int len, int k, float *dst, int32_t *idx)
 {
-#ifdef OMP
-#pragma omp simd
-#endif
-    for (int i = 0; i < len; i++) {
-        if (src[i] > 0.0f)
-            dst[i] = src[i];
-        else
-            dst[i] = alpha * src[i];
-    }
+    topk_runf(src, len, k, dst, idx, 1, filter_gtf);
 }
 
-static inline void softmaxf_C(float *src, float *dst, int len)
+SIMD_UTILS_API void bottomkf_C(float *src, int len, int k, float *dst, int32_t *idx)
 {
-    float acc = 0.0f;
+    topk_runf(src, len, k, dst, idx, 0, filter_ltf);
+}
 
-#ifdef OMP
-#pragma omp simd reduction(+ \
-                           : acc)
-#endif
-    for (int i = 0; i < len; i++) {
-        dst[i] = expf(src[i]);
-        acc += dst[i];
-    }
+SIMD_UTILS_API void topks_C(int32_t *src, int len, int k, int32_t *dst, int32_t *idx)
+{
+    topk_runs(src, len, k, dst, idx, 1, filter_gts);
+}
 
-#ifdef OMP
-#pragma omp simd
-#endif
-    for (int i = 0; i < len; i++) {
-        dst[i] /= acc;
-    }
+SIMD_UTILS_API void bottomks_C(int32_t *src, int len, int k, int32_t *dst, int32_t *idx)
+{
+    topk_runs(src, len, k, dst, idx, 0, filter_lts);
 }
 
-static inline void absdiff16s_c(int16_t *a, int16_t *b, int16_t *c, int len)
+SIMD_UTILS_API void vectorSlopef_C(float *dst, int len, float offset, float slope)
 {
 #ifdef OMP
 #pragma omp simd
 #endif
     for (int i = 0; i < len; i++) {
-        c[i] = abs(a[i] - b[i]);
+        dst[i] = (float) i * slope + offset;
     }
 }
 
-static inline void sum16s32s_C(int16_t *src, int len, int32_t *dst, int scale_factor)
+SIMD_UTILS_API void vectorSloped_C(double *dst, int len, double offset, double slope)
 {
-    int32_t tmp_acc = 0;
-    int16_t scale = 1 << scale_factor;
 #ifdef OMP
 #pragma omp simd
 #endif
     for (int i = 0; i < len; i++) {
-        tmp_acc += (int32_t) src[i];
+        dst[i] = (double) i * slope + offset;
     }
-
-    tmp_acc /= scale;
-    *dst = tmp_acc;
 }
 
-static inline void powerspect16s_c_interleaved(complex16s_t *src, int32_t *dst, int len)
+SIMD_UTILS_API void vectorSlopes_C(int32_t *dst, int len, int32_t offset, int32_t slope)
 {
 #ifdef OMP
 #pragma omp simd
 #endif
     for (int i = 0; i < len; i++) {
-        dst[i] = (int32_t) src[i].re * (int32_t) src[i].re + (int32_t) src[i].im * (int32_t) src[i].im;
+        dst[i] = (int32_t) i * slope + offset;
     }
 }
 
-static inline void maxeverys_c(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+SIMD_UTILS_API void maxeveryf_c(float *src1, float *src2, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -2990,7 +3501,7 @@ static inline void maxeverys_c(int32_t *src1, int32_t *src2, int32_t *dst, int l
     }
 }
 
-static inline void mineverys_c(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+SIMD_UTILS_API void mineveryf_c(float *src1, float *src2, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -3000,10 +3511,10 @@ static inline void mineverys_c(int32_t *src1, int32_t *src2, int32_t *dst, int l
     }
 }
 
-static inline void minmaxs_c(int32_t *src, int len, int32_t *min_value, int32_t *max_value)
+SIMD_UTILS_API void minmaxf_c(float *src, int len, float *min_value, float *max_value)
 {
-    int32_t min_tmp = src[0];
-    int32_t max_tmp = src[0];
+    float min_tmp = src[0];
+    float max_tmp = src[0];
 
 #ifdef OMP
 #pragma omp simd
@@ -3017,41 +3528,1011 @@ static inline void minmaxs_c(int32_t *src, int len, int32_t *min_value, int32_t
     *min_value = min_tmp;
 }
 
-static inline void threshold_gt_s_C(int32_t *src, int32_t *dst, int len, int32_t value)
+SIMD_UTILS_API void minmaxd_c(double *src, int len, double *min_value, double *max_value)
 {
+    double min_tmp = src[0];
+    double max_tmp = src[0];
+
 #ifdef OMP
 #pragma omp simd
 #endif
-    for (int i = 0; i < len; i++) {
-        dst[i] = src[i] < value ? src[i] : value;
+    for (int i = 1; i < len; i++) {
+        max_tmp = max_tmp > src[i] ? max_tmp : src[i];
+        min_tmp = min_tmp < src[i] ? min_tmp : src[i];
     }
+
+    *max_value = max_tmp;
+    *min_value = min_tmp;
 }
 
-static inline void threshold_gtabs_s_C(int32_t *src, int32_t *dst, int len, int32_t value)
+SIMD_UTILS_API void maxlocd_C(double *src, double *max, int *idx, int len)
 {
-#ifdef OMP
-#pragma omp simd
-#endif
-    for (int i = 0; i < len; i++) {
-        if (src[i] >= 0) {
-            dst[i] = src[i] > value ? value : src[i];
-        } else {
-            dst[i] = src[i] < (-value) ? (-value) : src[i];
+    double max_val = src[0];
+    int max_idx = 0;
+    for (int i = 1; i < len; i++) {
+        if (src[i] > max_val) {
+            max_val = src[i];
+            max_idx = i;
         }
     }
+    *idx = max_idx;
+    *max = max_val;
 }
 
-static inline void threshold_lt_s_C(int32_t *src, int32_t *dst, int len, int32_t value)
+SIMD_UTILS_API void minlocd_C(double *src, double *min, int *idx, int len)
 {
-#ifdef OMP
-#pragma omp simd
-#endif
-    for (int i = 0; i < len; i++) {
+    double min_val = src[0];
+    int min_idx = 0;
+    for (int i = 1; i < len; i++) {
+        if (src[i] < min_val) {
+            min_val = src[i];
+            min_idx = i;
+        }
+    }
+    *idx = min_idx;
+    *min = min_val;
+}
+
+SIMD_UTILS_API void minmaxlocd_C(double *src, int len, double *min_value, int *min_idx, double *max_value, int *max_idx)
+{
+    minlocd_C(src, min_value, min_idx, len);
+    maxlocd_C(src, max_value, max_idx, len);
+}
+
+SIMD_UTILS_API void maxeveryd_c(double *src1, double *src2, double *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src1[i] > src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void mineveryd_c(double *src1, double *src2, double *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src1[i] < src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void threshold_gt_d_C(double *src, double *dst, int len, double value)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src[i] < value ? src[i] : value;
+    }
+}
+
+SIMD_UTILS_API void threshold_gtabs_d_C(double *src, double *dst, int len, double value)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        if (src[i] >= 0.0) {
+            dst[i] = src[i] > value ? value : src[i];
+        } else {
+            dst[i] = src[i] < (-value) ? (-value) : src[i];
+        }
+    }
+}
+
+SIMD_UTILS_API void threshold_lt_d_C(double *src, double *dst, int len, double value)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src[i] > value ? src[i] : value;
+    }
+}
+
+SIMD_UTILS_API void threshold_ltabs_d_C(double *src, double *dst, int len, double value)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        if (src[i] >= 0.0) {
+            dst[i] = src[i] < value ? value : src[i];
+        } else {
+            dst[i] = src[i] > (-value) ? (-value) : src[i];
+        }
+    }
+}
+
+SIMD_UTILS_API void threshold_ltval_gtval_d_C(double *src, double *dst, int len, double ltlevel, double ltvalue, double gtlevel, double gtvalue)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src[i] < ltlevel ? ltvalue : src[i];
+        dst[i] = dst[i] > gtlevel ? gtvalue : dst[i];
+    }
+}
+
+SIMD_UTILS_API void addf_c(float *a, float *b, float *c, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        c[i] = a[i] + b[i];
+    }
+}
+
+SIMD_UTILS_API void adds_c(int32_t *a, int32_t *b, int32_t *c, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        c[i] = a[i] + b[i];
+    }
+}
+
+
+SIMD_UTILS_API void subf_c(float *a, float *b, float *c, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        c[i] = a[i] - b[i];
+    }
+}
+
+SIMD_UTILS_API void subcrevf_C(float *src, float value, float *dst, int len)
+{
+    for (int i = 0; i < len; i++) {
+        dst[i] = value - src[i];
+    }
+}
+
+SIMD_UTILS_API void subs_c(int32_t *a, int32_t *b, int32_t *c, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        c[i] = a[i] - b[i];
+    }
+}
+
+/*static inline void orf_c(float *a, float *b, float *c, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        c[i] = a[i] | b[i];
+    }
+}*/
+
+SIMD_UTILS_API void setd_C(double *dst, double value, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = value;
+    }
+}
+
+SIMD_UTILS_API void zerod_C(double *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = 0.0;
+    }
+}
+
+SIMD_UTILS_API void copyd_C(double *src, double *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src[i];
+    }
+}
+
+SIMD_UTILS_API void copys_C(int32_t *src, int32_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src[i];
+    }
+}
+
+SIMD_UTILS_API void sqrtd_C(double *src, double *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = sqrt(src[i]);
+    }
+}
+
+SIMD_UTILS_API void fabsd_C(double *src, double *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = fabs(src[i]);
+    }
+}
+
+SIMD_UTILS_API void addd_c(double *a, double *b, double *c, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        c[i] = a[i] + b[i];
+    }
+}
+
+SIMD_UTILS_API void muld_c(double *a, double *b, double *c, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        c[i] = a[i] * b[i];
+    }
+}
+
+SIMD_UTILS_API void subd_c(double *a, double *b, double *c, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        c[i] = a[i] - b[i];
+    }
+}
+
+SIMD_UTILS_API void divd_c(double *a, double *b, double *c, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        c[i] = a[i] / b[i];
+    }
+}
+
+SIMD_UTILS_API void mulcd_C(double *src, double value, double *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src[i] * value;
+    }
+}
+
+SIMD_UTILS_API void muladdd_C(double *_a, double *_b, double *_c, double *dst, int len)
+{
+    for (int i = 0; i < len; i++) {
+        dst[i] = _a[i] * _b[i] + _c[i];
+    }
+}
+
+SIMD_UTILS_API void mulcaddd_C(double *_a, double _b, double *_c, double *dst, int len)
+{
+    for (int i = 0; i < len; i++) {
+        dst[i] = _a[i] * _b + _c[i];
+    }
+}
+
+SIMD_UTILS_API void mulcaddcd_C(double *_a, double _b, double _c, double *dst, int len)
+{
+    for (int i = 0; i < len; i++) {
+        dst[i] = _a[i] * _b + _c;
+    }
+}
+
+SIMD_UTILS_API void muladdcd_C(double *_a, double *_b, double _c, double *dst, int len)
+{
+    for (int i = 0; i < len; i++) {
+        dst[i] = _a[i] * _b[i] + _c;
+    }
+}
+
+SIMD_UTILS_API void addcd_C(double *src, double value, double *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src[i] + value;
+    }
+}
+
+SIMD_UTILS_API void ors_C(int32_t *a, int32_t *b, int32_t *c, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        c[i] = a[i] | b[i];
+    }
+}
+
+/*static inline void andf_C(float *a, float *b, float *c, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        c[i] = a[i] & b[i];
+    }
+}*/
+
+SIMD_UTILS_API void ands_C(int32_t *a, int32_t *b, int32_t *c, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        c[i] = a[i] & b[i];
+    }
+}
+
+SIMD_UTILS_API void sigmoidf_C(float *src, float *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = 1.0f / (1.0f + expf(-src[i]));
+    }
+}
+
+SIMD_UTILS_API void sigmoidd_C(double *src, double *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = 1.0 / (1.0 + exp(-src[i]));
+    }
+}
+
+// parametric ReLU
+// simple ReLU can be expressed as threshold_lt with value = 0
+SIMD_UTILS_API void PReluf_C(float *src, float *dst, float alpha, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        if (src[i] > 0.0f)
+            dst[i] = src[i];
+        else
+            dst[i] = alpha * src[i];
+    }
+}
+
+SIMD_UTILS_API void softmaxf_C(float *src, float *dst, int len)
+{
+    float acc = 0.0f;
+
+#ifdef OMP
+#pragma omp simd reduction(+ \
+                           : acc)
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = expf(src[i]);
+        acc += dst[i];
+    }
+
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] /= acc;
+    }
+}
+
+// the maximum is subtracted before exp so that large inputs do not overflow
+SIMD_UTILS_API void softmaxd_C(double *src, double *dst, int len)
+{
+    double max_value = -INFINITY;
+    double acc = 0.0;
+
+    for (int i = 0; i < len; i++) {
+        if (src[i] > max_value)
+            max_value = src[i];
+    }
+
+    for (int i = 0; i < len; i++) {
+        dst[i] = exp(src[i] - max_value);
+        acc += dst[i];
+    }
+
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] /= acc;
+    }
+}
+
+SIMD_UTILS_API void absdiff16s_c(int16_t *a, int16_t *b, int16_t *c, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        c[i] = abs(a[i] - b[i]);
+    }
+}
+
+SIMD_UTILS_API void addsat16s_c(int16_t *src1, int16_t *src2, int16_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        int32_t tmp = (int32_t) src1[i] + (int32_t) src2[i];
+        dst[i] = (int16_t) (tmp > INT16_MAX ? INT16_MAX : (tmp < INT16_MIN ? INT16_MIN : tmp));
+    }
+}
+
+SIMD_UTILS_API void subsat16s_c(int16_t *src1, int16_t *src2, int16_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        int32_t tmp = (int32_t) src1[i] - (int32_t) src2[i];
+        dst[i] = (int16_t) (tmp > INT16_MAX ? INT16_MAX : (tmp < INT16_MIN ? INT16_MIN : tmp));
+    }
+}
+
+SIMD_UTILS_API void mulhi16s_c(int16_t *src1, int16_t *src2, int16_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = (int16_t) (((int32_t) src1[i] * (int32_t) src2[i]) >> 16);
+    }
+}
+
+SIMD_UTILS_API void mulhrs16s_c(int16_t *src1, int16_t *src2, int16_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = (int16_t) ((((int32_t) src1[i] * (int32_t) src2[i] >> 14) + 1) >> 1);
+    }
+}
+
+SIMD_UTILS_API void maxevery16s_c(int16_t *src1, int16_t *src2, int16_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src1[i] > src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void minevery16s_c(int16_t *src1, int16_t *src2, int16_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src1[i] < src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void abs16s_c(int16_t *src, int16_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src[i] == INT16_MIN ? INT16_MAX : (int16_t) abs(src[i]);
+    }
+}
+
+SIMD_UTILS_API void threshold_gt16s_c(int16_t *src, int16_t *dst, int len, int16_t value)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src[i] < value ? src[i] : value;
+    }
+}
+
+SIMD_UTILS_API void threshold_lt16s_c(int16_t *src, int16_t *dst, int len, int16_t value)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src[i] > value ? src[i] : value;
+    }
+}
+
+SIMD_UTILS_API void addsatu8_c(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        int tmp = (int) src1[i] + (int) src2[i];
+        dst[i] = (uint8_t) (tmp > UINT8_MAX ? UINT8_MAX : (tmp < 0 ? 0 : tmp));
+    }
+}
+
+SIMD_UTILS_API void subsatu8_c(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        int tmp = (int) src1[i] - (int) src2[i];
+        dst[i] = (uint8_t) (tmp > UINT8_MAX ? UINT8_MAX : (tmp < 0 ? 0 : tmp));
+    }
+}
+
+SIMD_UTILS_API void absdiffu8_c(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src1[i] > src2[i] ? src1[i] - src2[i] : src2[i] - src1[i];
+    }
+}
+
+SIMD_UTILS_API void maxeveryu8_c(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src1[i] > src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void mineveryu8_c(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src1[i] < src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void threshold_gtu8_c(uint8_t *src, uint8_t *dst, int len, uint8_t value)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src[i] < value ? src[i] : value;
+    }
+}
+
+SIMD_UTILS_API void threshold_ltu8_c(uint8_t *src, uint8_t *dst, int len, uint8_t value)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src[i] > value ? src[i] : value;
+    }
+}
+
+// src >> scale_factor saturated to [0, 255]
+SIMD_UTILS_API void convertInt16ToU8_C(int16_t *src, uint8_t *dst, int len, int scale_factor)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        int16_t tmp = (int16_t) (src[i] >> scale_factor);
+        dst[i] = (uint8_t) (tmp > UINT8_MAX ? UINT8_MAX : (tmp < 0 ? 0 : tmp));
+    }
+}
+
+// src << scale_factor, scale_factor up to 7
+SIMD_UTILS_API void convertU8ToInt16_C(uint8_t *src, int16_t *dst, int len, int scale_factor)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = (int16_t) (src[i] << scale_factor);
+    }
+}
+
+// add, sub, mul, sum, cmpeq and sll do not depend on the sign and also apply to uint64_t arrays
+SIMD_UTILS_API void add64s_c(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = (int64_t) ((uint64_t) src1[i] + (uint64_t) src2[i]);
+    }
+}
+
+SIMD_UTILS_API void sub64s_c(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = (int64_t) ((uint64_t) src1[i] - (uint64_t) src2[i]);
+    }
+}
+
+SIMD_UTILS_API void mul64s_c(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = (int64_t) ((uint64_t) src1[i] * (uint64_t) src2[i]);
+    }
+}
+
+SIMD_UTILS_API void sum64s_c(int64_t *src, int64_t *dst, int len)
+{
+    uint64_t tmp_acc = 0;
+
+#ifdef OMP
+#pragma omp simd reduction(+ \
+                           : tmp_acc)
+#endif
+    for (int i = 0; i < len; i++) {
+        tmp_acc += (uint64_t) src[i];
+    }
+
+    *dst = (int64_t) tmp_acc;
+}
+
+SIMD_UTILS_API void maxevery64s_c(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src1[i] > src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void minevery64s_c(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src1[i] < src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void maxeveryu64_c(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src1[i] > src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void mineveryu64_c(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src1[i] < src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void minmax64s_c(int64_t *src, int len, int64_t *min_value, int64_t *max_value)
+{
+    int64_t min_tmp = src[0];
+    int64_t max_tmp = src[0];
+
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 1; i < len; i++) {
+        max_tmp = max_tmp > src[i] ? max_tmp : src[i];
+        min_tmp = min_tmp < src[i] ? min_tmp : src[i];
+    }
+
+    *max_value = max_tmp;
+    *min_value = min_tmp;
+}
+
+SIMD_UTILS_API void minmaxu64_c(uint64_t *src, int len, uint64_t *min_value, uint64_t *max_value)
+{
+    uint64_t min_tmp = src[0];
+    uint64_t max_tmp = src[0];
+
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 1; i < len; i++) {
+        max_tmp = max_tmp > src[i] ? max_tmp : src[i];
+        min_tmp = min_tmp < src[i] ? min_tmp : src[i];
+    }
+
+    *max_value = max_tmp;
+    *min_value = min_tmp;
+}
+
+SIMD_UTILS_API void cmpeq64s_c(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src1[i] == src2[i] ? -1 : 0;
+    }
+}
+
+SIMD_UTILS_API void cmpgt64s_c(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src1[i] > src2[i] ? -1 : 0;
+    }
+}
+
+SIMD_UTILS_API void cmpgtu64_c(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src1[i] > src2[i] ? UINT64_MAX : 0;
+    }
+}
+
+SIMD_UTILS_API void sll64s_c(int64_t *src, int64_t *dst, int len, int shift)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = (int64_t) ((uint64_t) src[i] << shift);
+    }
+}
+
+SIMD_UTILS_API void sra64s_c(int64_t *src, int64_t *dst, int len, int shift)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src[i] >> shift;
+    }
+}
+
+SIMD_UTILS_API void srlu64_c(uint64_t *src, uint64_t *dst, int len, int shift)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src[i] >> shift;
+    }
+}
+
+SIMD_UTILS_API void sum16s32s_C(int16_t *src, int len, int32_t *dst, int scale_factor)
+{
+    int32_t tmp_acc = 0;
+    int16_t scale = 1 << scale_factor;
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        tmp_acc += (int32_t) src[i];
+    }
+
+    tmp_acc /= scale;
+    *dst = tmp_acc;
+}
+
+SIMD_UTILS_API void powerspect16s_c_interleaved(complex16s_t *src, int32_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = (int32_t) src[i].re * (int32_t) src[i].re + (int32_t) src[i].im * (int32_t) src[i].im;
+    }
+}
+
+SIMD_UTILS_API void maxeverys_c(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src1[i] > src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void mineverys_c(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src1[i] < src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void minmaxs_c(int32_t *src, int len, int32_t *min_value, int32_t *max_value)
+{
+    int32_t min_tmp = src[0];
+    int32_t max_tmp = src[0];
+
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 1; i < len; i++) {
+        max_tmp = max_tmp > src[i] ? max_tmp : src[i];
+        min_tmp = min_tmp < src[i] ? min_tmp : src[i];
+    }
+
+    *max_value = max_tmp;
+    *min_value = min_tmp;
+}
+
+SIMD_UTILS_API void maxlocs_C(int32_t *src, int32_t *max, int *idx, int len)
+{
+    int32_t max_val = src[0];
+    int max_idx = 0;
+    for (int i = 1; i < len; i++) {
+        if (src[i] > max_val) {
+            max_val = src[i];
+            max_idx = i;
+        }
+    }
+    *idx = max_idx;
+    *max = max_val;
+}
+
+SIMD_UTILS_API void minlocs_C(int32_t *src, int32_t *min, int *idx, int len)
+{
+    int32_t min_val = src[0];
+    int min_idx = 0;
+    for (int i = 1; i < len; i++) {
+        if (src[i] < min_val) {
+            min_val = src[i];
+            min_idx = i;
+        }
+    }
+    *idx = min_idx;
+    *min = min_val;
+}
+
+SIMD_UTILS_API void minmaxlocs_C(int32_t *src, int len, int32_t *min_value, int *min_idx, int32_t *max_value, int *max_idx)
+{
+    minlocs_C(src, min_value, min_idx, len);
+    maxlocs_C(src, max_value, max_idx, len);
+}
+
+SIMD_UTILS_API void minmax16s_c(int16_t *src, int len, int16_t *min_value, int16_t *max_value)
+{
+    int16_t min_tmp = src[0];
+    int16_t max_tmp = src[0];
+
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 1; i < len; i++) {
+        max_tmp = max_tmp > src[i] ? max_tmp : src[i];
+        min_tmp = min_tmp < src[i] ? min_tmp : src[i];
+    }
+
+    *max_value = max_tmp;
+    *min_value = min_tmp;
+}
+
+SIMD_UTILS_API void maxloc16s_C(int16_t *src, int16_t *max, int *idx, int len)
+{
+    int16_t max_val = src[0];
+    int max_idx = 0;
+    for (int i = 1; i < len; i++) {
+        if (src[i] > max_val) {
+            max_val = src[i];
+            max_idx = i;
+        }
+    }
+    *idx = max_idx;
+    *max = max_val;
+}
+
+SIMD_UTILS_API void minloc16s_C(int16_t *src, int16_t *min, int *idx, int len)
+{
+    int16_t min_val = src[0];
+    int min_idx = 0;
+    for (int i = 1; i < len; i++) {
+        if (src[i] < min_val) {
+            min_val = src[i];
+            min_idx = i;
+        }
+    }
+    *idx = min_idx;
+    *min = min_val;
+}
+
+SIMD_UTILS_API void minmaxloc16s_C(int16_t *src, int len, int16_t *min_value, int *min_idx, int16_t *max_value, int *max_idx)
+{
+    minloc16s_C(src, min_value, min_idx, len);
+    maxloc16s_C(src, max_value, max_idx, len);
+}
+
+SIMD_UTILS_API void threshold_gt_s_C(int32_t *src, int32_t *dst, int len, int32_t value)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src[i] < value ? src[i] : value;
+    }
+}
+
+SIMD_UTILS_API void threshold_gtabs_s_C(int32_t *src, int32_t *dst, int len, int32_t value)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        if (src[i] >= 0) {
+            dst[i] = src[i] > value ? value : src[i];
+        } else {
+            dst[i] = src[i] < (-value) ? (-value) : src[i];
+        }
+    }
+}
+
+SIMD_UTILS_API void threshold_lt_s_C(int32_t *src, int32_t *dst, int len, int32_t value)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
         dst[i] = src[i] > value ? src[i] : value;
     }
 }
 
-static inline void threshold_ltabs_s_C(int32_t *src, int32_t *dst, int len, int32_t value)
+SIMD_UTILS_API void threshold_ltabs_s_C(int32_t *src, int32_t *dst, int len, int32_t value)
 {
 #ifdef OMP
 #pragma omp simd
@@ -3065,7 +4546,7 @@ static inline void threshold_ltabs_s_C(int32_t *src, int32_t *dst, int len, int3
     }
 }
 
-static inline void threshold_ltval_gtval_s_C(int32_t *src, int32_t *dst, int len, int32_t ltlevel, int32_t ltvalue, int32_t gtlevel, int32_t gtvalue)
+SIMD_UTILS_API void threshold_ltval_gtval_s_C(int32_t *src, int32_t *dst, int len, int32_t ltlevel, int32_t ltvalue, int32_t gtlevel, int32_t gtvalue)
 {
 #ifdef OMP
 #pragma omp simd
@@ -3080,7 +4561,7 @@ static inline void threshold_ltval_gtval_s_C(int32_t *src, int32_t *dst, int len
     x = r × cos( θ )
     y = r × sin( θ )
 */
-static inline void pol2cart2Df_C(float *r, float *theta, float *x, float *y, int len)
+SIMD_UTILS_API void pol2cart2Df_C(float *r, float *theta, float *x, float *y, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -3093,7 +4574,7 @@ static inline void pol2cart2Df_C(float *r, float *theta, float *x, float *y, int
     }
 }
 
-static inline void pol2cart2Df_C_precise(float *r, float *theta, float *x, float *y, int len)
+SIMD_UTILS_API void pol2cart2Df_C_precise(float *r, float *theta, float *x, float *y, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -3110,7 +4591,7 @@ static inline void pol2cart2Df_C_precise(float *r, float *theta, float *x, float
 }
 
 // https://fr.mathworks.com/help/matlab/ref/cart2pol.html
-static inline void cart2pol2Df_C(float *x, float *y, float *r, float *theta, int len)
+SIMD_UTILS_API void cart2pol2Df_C(float *x, float *y, float *r, float *theta, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -3122,7 +4603,7 @@ static inline void cart2pol2Df_C(float *x, float *y, float *r, float *theta, int
     }
 }
 
-static inline void cart2pol2Df_C_precise(float *x, float *y, float *r, float *theta, int len)
+SIMD_UTILS_API void cart2pol2Df_C_precise(float *x, float *y, float *r, float *theta, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -3137,7 +4618,7 @@ static inline void cart2pol2Df_C_precise(float *x, float *y, float *r, float *th
 }
 
 // Do we need a special function for float or can we cast?
-static inline void gatheri_C(int32_t *src, int32_t *dst, int stride, int offset, int len)
+SIMD_UTILS_API void gatheri_C(int32_t *src, int32_t *dst, int stride, int offset, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -3149,7 +4630,7 @@ static inline void gatheri_C(int32_t *src, int32_t *dst, int stride, int offset,
 
 
 // Do we need a special function for float or can we cast?
-static inline void scatteri_C(int32_t *src, int32_t *dst, int stride, int offset, int len)
+SIMD_UTILS_API void scatteri_C(int32_t *src, int32_t *dst, int stride, int offset, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -3166,7 +4647,7 @@ x = r * sin(theta) * cos(rho)
 y = r * sin(theta) * sin(rho)
 z = r * cos(theta)
 */
-static inline void pol2cart3Df_C(float *r, float *theta, float *rho, float *x, float *y, float *z, int len)
+SIMD_UTILS_API void pol2cart3Df_C(float *r, float *theta, float *rho, float *x, float *y, float *z, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -3186,7 +4667,7 @@ r = sqrtf(x * x + y * y + z * z)
 rho = acosf(x / sqrtf(x * x + y * y)) * (y < 0 ? -1 : 1)
 theta = acosf(z / r)
 */
-static inline void cart2pol3Df_C(float *x, float *y, float *z, float *r, float *theta, float *rho, int len)
+SIMD_UTILS_API void cart2pol3Df_C(float *x, float *y, float *z, float *r, float *theta, float *rho, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -3246,7 +4727,7 @@ static inline void while_loop_4c_32s(int32_t* srcDst, short i, short j, const sh
 	return;
 }
 
-static inline void floodFill_4C_32s(int32_t* srcDst,  int imageStep, point_t roiSize, point_t seedPoint1, int32_t Point1NewValue, modified_t* modified){
+SIMD_UTILS_API void floodFill_4C_32s(int32_t* srcDst,  int imageStep, point_t roiSize, point_t seedPoint1, int32_t Point1NewValue, modified_t* modified){
 	imageStep = imageStep/sizeof(int32_t);
 	int32_t seedVal = srcDst[imageStep*seedPoint1.y + seedPoint1.x];
 	
@@ -3331,7 +4812,7 @@ static inline void while_loop_8c_32s(int32_t* srcDst, short i, short j,  const i
 	return;
 }
 
-static inline void floodFill_8C_c_32s(int32_t* srcDst,  int imageStep, point_t roiSize, point_t seedPoint1, int32_t Point1NewValue, modified_t* modified){
+SIMD_UTILS_API void floodFill_8C_c_32s(int32_t* srcDst,  int imageStep, point_t roiSize, point_t seedPoint1, int32_t Point1NewValue, modified_t* modified){
 	imageStep = imageStep/sizeof(int32_t);
 	int32_t seedVal = srcDst[imageStep*seedPoint1.y + seedPoint1.x];
 	
@@ -3395,7 +4876,7 @@ static inline void while_loop_4c_8u(uint8_t* srcDst, short i, short j, const sho
 	return;
 }
 
-static inline void floodFill_4C_8u(uint8_t* srcDst,  int imageStep, point_t roiSize, point_t seedPoint1, uint8_t Point1NewValue, modified_t* modified){
+SIMD_UTILS_API void floodFill_4C_8u(uint8_t* srcDst,  int imageStep, point_t roiSize, point_t seedPoint1, uint8_t Point1NewValue, modified_t* modified){
 	uint8_t seedVal = srcDst[imageStep*seedPoint1.y + seedPoint1.x];
 	
 	short i, j;
@@ -3479,7 +4960,7 @@ static inline void while_loop_8c_8u(uint8_t* srcDst, short i, short j,  const in
 	return;
 }
 
-static inline void floodFill_8C_c_8u(uint8_t* srcDst,  int imageStep, point_t roiSize, point_t seedPoint1, uint8_t Point1NewValue, modified_t* modified){
+SIMD_UTILS_API void floodFill_8C_c_8u(uint8_t* srcDst,  int imageStep, point_t roiSize, point_t seedPoint1, uint8_t Point1NewValue, modified_t* modified){
 	uint8_t seedVal = srcDst[imageStep*seedPoint1.y + seedPoint1.x];
 	
 	short i, j;
@@ -3566,7 +5047,7 @@ static inline void while_loop_8c_32f(float* srcDst, short i, short j,  const int
 	return;
 }
 
-static inline void floodFill_8C_c_32f(float* srcDst,  int imageStep, point_t roiSize, point_t seedPoint1, float Point1NewValue, modified_t* modified){
+SIMD_UTILS_API void floodFill_8C_c_32f(float* srcDst,  int imageStep, point_t roiSize, point_t seedPoint1, float Point1NewValue, modified_t* modified){
 	imageStep = imageStep/sizeof(float);
 	float seedVal = srcDst[imageStep*seedPoint1.y + seedPoint1.x];
 	
@@ -3591,7 +5072,7 @@ static inline void floodFill_8C_c_32f(float* srcDst,  int imageStep, point_t roi
 	}		
 }
 
-static inline void powf_c(float *x, float *y, float *dst, int len)
+SIMD_UTILS_API void powf_c(float *x, float *y, float *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -3601,7 +5082,7 @@ static inline void powf_c(float *x, float *y, float *dst, int len)
     }
 }
 
-static inline void powd_c(double *x, double *y, double *dst, int len)
+SIMD_UTILS_API void powd_c(double *x, double *y, double *dst, int len)
 {
 #ifdef OMP
 #pragma omp simd
@@ -3612,7 +5093,7 @@ static inline void powd_c(double *x, double *y, double *dst, int len)
 }
 
 
-static inline void powcplxf_c(complex32_t *x, complex32_t *y, complex32_t *dst, int len)
+SIMD_UTILS_API void powcplxf_c(complex32_t *x, complex32_t *y, complex32_t *dst, int len)
 {
     for (int i = 0; i < len; i++) {
 		float x_tmp_re2 = x[i].re * x[i].re;
@@ -3634,7 +5115,7 @@ static inline void powcplxf_c(complex32_t *x, complex32_t *y, complex32_t *dst,
     }
 }
 
-static inline void powcplxd_c(complex64_t *x, complex64_t *y, complex64_t *dst, int len)
+SIMD_UTILS_API void powcplxd_c(complex64_t *x, complex64_t *y, complex64_t *dst, int len)
 {
     for (int i = 0; i < len; i++) {
 		double x_tmp_re2 = x[i].re * x[i].re;
@@ -3657,6 +5138,368 @@ static inline void powcplxd_c(complex64_t *x, complex64_t *y, complex64_t *dst,
     }
 }
 
+static inline float pipeline_applyf_C(const pipeline_op_t *op, float x, int i)
+{
+    switch (op->op) {
+    case PipeMulC:
+        return x * op->value;
+    case PipeAddC:
+        return x + op->value;
+    case PipeMul:
+        return x * op->src[i];
+    case PipeAdd:
+        return x + op->src[i];
+    case PipeSub:
+        return x - op->src[i];
+    case PipeDiv:
+        return x / op->src[i];
+    case PipeThresholdGt:
+        return (x < op->value) ? x : op->value;
+    case PipeThresholdLt:
+        return (x > op->value) ? x : op->value;
+    case PipeFabs:
+        return fabsf(x);
+    case PipeSqrt:
+        return sqrtf(x);
+    case PipeExp:
+        return expf(x);
+    case PipeLn:
+        return logf(x);
+    case PipeLog10:
+        return log10f(x);
+    case PipeLog2:
+        return log2f(x);
+    case PipeCbrt:
+        return cbrtf(x);
+    case PipeSin:
+        return sinf(x);
+    case PipeCos:
+        return cosf(x);
+    case PipeTan:
+        return tanf(x);
+    case PipeTanh:
+        return tanhf(x);
+    case PipeAtan:
+        return atanf(x);
+    case PipeSigmoid:
+        return 1.0f / (1.0f + expf(-x));
+    default:
+        return x;
+    }
+}
+
+SIMD_UTILS_API void pipelinef_C(float *src, float *dst, int len, const pipeline_op_t *ops, int nb_ops)
+{
+    for (int i = 0; i < len; i++) {
+        float x = src[i];
+        for (int k = 0; k < nb_ops; k++) {
+            x = pipeline_applyf_C(&ops[k], x, i);
+        }
+        dst[i] = x;
+    }
+}
+
+SIMD_UTILS_API void pipelinef_sum_C(float *src, float *dst, int len, const pipeline_op_t *ops, int nb_ops)
+{
+    double acc = 0.0;
+    for (int i = 0; i < len; i++) {
+        float x = src[i];
+        for (int k = 0; k < nb_ops; k++) {
+            x = pipeline_applyf_C(&ops[k], x, i);
+        }
+        acc += (double) x;
+    }
+    *dst = (float) acc;
+}
+
+SIMD_UTILS_API void fftf_split_C(fft_plan32_t *plan, float *srcRe, float *srcIm, float *dstRe, float *dstIm)
+{
+    fft_split_coref_C(plan, srcRe, srcIm, dstRe, dstIm);
+}
+
+SIMD_UTILS_API void ifftf_split_C(fft_plan32_t *plan, float *srcRe, float *srcIm, float *dstRe, float *dstIm)
+{
+    fft_split_coref_C(plan, srcIm, srcRe, dstIm, dstRe);
+}
+
+SIMD_UTILS_API void fftf_C(fft_plan32_t *plan, complex32_t *src, complex32_t *dst)
+{
+    float *re = plan->work + 4 * plan->n;
+    float *im = re + plan->n;
+    cplxtorealf_C(src, re, im, plan->n);
+    fft_split_coref_C(plan, re, im, re, im);
+    realtocplx_C(re, im, dst, plan->n);
+}
+
+SIMD_UTILS_API void ifftf_C(fft_plan32_t *plan, complex32_t *src, complex32_t *dst)
+{
+    float *re = plan->work + 4 * plan->n;
+    float *im = re + plan->n;
+    cplxtorealf_C(src, re, im, plan->n);
+    fft_split_coref_C(plan, im, re, im, re);
+    realtocplx_C(re, im, dst, plan->n);
+}
+
+// src has real_n points, dst the real_n / 2 + 1 first bins
+SIMD_UTILS_API void rfftf_C(fft_plan32_t *plan, float *src, complex32_t *dst)
+{
+    float *re = plan->work + 4 * plan->n;
+    float *im = re + plan->n;
+    cplxtorealf_C((complex32_t *) src, re, im, plan->n);
+    fft_split_coref_C(plan, re, im, re, im);
+    rfft_postf_C(plan, re, im, dst, 1);
+}
+
+SIMD_UTILS_API void irfftf_C(fft_plan32_t *plan, complex32_t *src, float *dst)
+{
+    float *re = plan->work + 4 * plan->n;
+    float *im = re + plan->n;
+    irfft_pref_C(plan, src, re, im, 0);
+    fft_split_coref_C(plan, im, re, im, re);
+    realtocplx_C(re, im, (complex32_t *) dst, plan->n);
+}
+
+SIMD_UTILS_API void fftd_split_C(fft_plan64_t *plan, double *srcRe, double *srcIm, double *dstRe, double *dstIm)
+{
+    fft_split_cored_C(plan, srcRe, srcIm, dstRe, dstIm);
+}
+
+SIMD_UTILS_API void ifftd_split_C(fft_plan64_t *plan, double *srcRe, double *srcIm, double *dstRe, double *dstIm)
+{
+    fft_split_cored_C(plan, srcIm, srcRe, dstIm, dstRe);
+}
+
+SIMD_UTILS_API void fftd_C(fft_plan64_t *plan, complex64_t *src, complex64_t *dst)
+{
+    double *re = plan->work + 4 * plan->n;
+    double *im = re + plan->n;
+    cplxtoreald_C(src, re, im, plan->n);
+    fft_split_cored_C(plan, re, im, re, im);
+    realtocplxd_C(re, im, dst, plan->n);
+}
+
+SIMD_UTILS_API void ifftd_C(fft_plan64_t *plan, complex64_t *src, complex64_t *dst)
+{
+    double *re = plan->work + 4 * plan->n;
+    double *im = re + plan->n;
+    cplxtoreald_C(src, re, im, plan->n);
+    fft_split_cored_C(plan, im, re, im, re);
+    realtocplxd_C(re, im, dst, plan->n);
+}
+
+SIMD_UTILS_API void rfftd_C(fft_plan64_t *plan, double *src, complex64_t *dst)
+{
+    double *re = plan->work + 4 * plan->n;
+    double *im = re + plan->n;
+    cplxtoreald_C((complex64_t *) src, re, im, plan->n);
+    fft_split_cored_C(plan, re, im, re, im);
+    rfft_postd_C(plan, re, im, dst, 1);
+}
+
+SIMD_UTILS_API void irfftd_C(fft_plan64_t *plan, complex64_t *src, double *dst)
+{
+    double *re = plan->work + 4 * plan->n;
+    double *im = re + plan->n;
+    irfft_pred_C(plan, src, re, im, 0);
+    fft_split_cored_C(plan, im, re, im, re);
+    realtocplxd_C(re, im, (complex64_t *) dst, plan->n);
+}
+
+
+// returns the number of outputs, -1 if fir is a complex filter
+SIMD_UTILS_API int firf_C(fir32_t *fir, float *src, float *dst, int len)
+{
+    if (fir->cplx)
+        return -1;
+    return fir_runf(fir, fir_kernelf_C, src, NULL, dst, NULL, len);
+}
+
+SIMD_UTILS_API int firf_cplx_C(fir32_t *fir, complex32_t *src, complex32_t *dst, int len)
+{
+    if (!fir->cplx)
+        return -1;
+    return fir_runf(fir, fir_kernelf_cplx_C, (float *) src, NULL, (float *) dst, NULL, len);
+}
+
+SIMD_UTILS_API int firf_split_C(fir32_t *fir, float *srcRe, float *srcIm, float *dstRe, float *dstIm, int len)
+{
+    if (!fir->cplx)
+        return -1;
+    return fir_runf(fir, fir_kernelf_cplx_C, srcRe, srcIm, dstRe, dstIm, len);
+}
+
+// len frames of nb_channels interleaved channels, the scalar recursion of each channel
+SIMD_UTILS_API void iirf_C(iir32_t *iir, float *src, float *dst, int len)
+{
+    int C = iir->nb_channels;
+    for (int ch = 0; ch < C; ch++) {
+        for (int s = 0; s < iir->nb_stages; s++)
+            iir_biquadf_C(iir, s, ch, (s ? dst : src) + ch, dst + ch, len, C);
+    }
+}
+
+SIMD_UTILS_API void cplxvecmuld_C(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i].re = (src1[i].re * src2[i].re) - src1[i].im * src2[i].im;
+        dst[i].im = src1[i].re * src2[i].im + (src2[i].re * src1[i].im);
+    }
+}
+
+SIMD_UTILS_API void cplxvecmuld_C_split(double *src1Re, double *src1Im, double *src2Re, double *src2Im, double *dstRe, double *dstIm, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dstRe[i] = (src1Re[i] * src2Re[i]) - src1Im[i] * src2Im[i];
+        dstIm[i] = src1Re[i] * src2Im[i] + (src2Re[i] * src1Im[i]);
+    }
+}
+
+SIMD_UTILS_API void cplxconjvecmuld_C(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i].re = src1[i].re * src2[i].re + src1[i].im * src2[i].im;
+        dst[i].im = src2[i].re * src1[i].im - src1[i].re * src2[i].im;
+    }
+}
+
+SIMD_UTILS_API void cplxconjvecmuld_C_split(double *src1Re, double *src1Im, double *src2Re, double *src2Im, double *dstRe, double *dstIm, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dstRe[i] = src1Re[i] * src2Re[i] + src1Im[i] * src2Im[i];
+        dstIm[i] = src2Re[i] * src1Im[i] - src1Re[i] * src2Im[i];
+    }
+}
+
+SIMD_UTILS_API void cplxvecdivd_C(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        double c2d2 = src2[i].re * src2[i].re + src2[i].im * src2[i].im;
+        dst[i].re = (src1[i].re * src2[i].re + src1[i].im * src2[i].im) / c2d2;
+        dst[i].im = (src2[i].re * src1[i].im - src1[i].re * src2[i].im) / c2d2;
+    }
+}
+
+SIMD_UTILS_API void cplxvecdivd_C_split(double *src1Re, double *src1Im, double *src2Re, double *src2Im, double *dstRe, double *dstIm, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        double c2d2 = src2Re[i] * src2Re[i] + src2Im[i] * src2Im[i];
+        dstRe[i] = (src1Re[i] * src2Re[i] + src1Im[i] * src2Im[i]) / c2d2;
+        dstIm[i] = (src2Re[i] * src1Im[i] - src1Re[i] * src2Im[i]) / c2d2;
+    }
+}
+
+SIMD_UTILS_API void cplxconjd_C(complex64_t *src, complex64_t *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i].re = src[i].re;
+        dst[i].im = -src[i].im;
+    }
+}
+
+SIMD_UTILS_API void magnituded_C_split(double *srcRe, double *srcIm, double *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = sqrt(srcRe[i] * srcRe[i] + (srcIm[i] * srcIm[i]));
+    }
+}
+
+SIMD_UTILS_API void magnituded_C_interleaved(complex64_t *src, double *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = sqrt(src[i].re * src[i].re + (src[i].im * src[i].im));
+    }
+}
+
+SIMD_UTILS_API void powerspectd_C_split(double *srcRe, double *srcIm, double *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = srcRe[i] * srcRe[i] + (srcIm[i] * srcIm[i]);
+    }
+}
+
+SIMD_UTILS_API void powerspectd_C_interleaved(complex64_t *src, double *dst, int len)
+{
+#ifdef OMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < len; i++) {
+        dst[i] = src[i].re * src[i].re + (src[i].im * src[i].im);
+    }
+}
+
+// overlap-save block of the convolutions (see simd_utils_conv.h)
+static inline void conv_blockf_C(conv32_t *conv)
+{
+    if (conv->cplx) {
+        fftf_C(conv->plan, (complex32_t *) conv->buf, (complex32_t *) conv->work);
+        cplxvecmul_C((complex32_t *) conv->work, (complex32_t *) conv->spectrum, (complex32_t *) conv->out, conv->fft_len);
+        ifftf_C(conv->plan, (complex32_t *) conv->out, (complex32_t *) conv->out);
+    } else {
+        rfftf_C(conv->plan, conv->buf, (complex32_t *) conv->work);
+        cplxvecmul_C((complex32_t *) conv->work, (complex32_t *) conv->spectrum, (complex32_t *) conv->out, conv->fft_len / 2 + 1);
+        irfftf_C(conv->plan, (complex32_t *) conv->out, conv->out);
+    }
+}
+
+static inline void conv_blockd_C(conv64_t *conv)
+{
+    rfftd_C(conv->plan, conv->buf, (complex64_t *) conv->work);
+    cplxvecmuld_C((complex64_t *) conv->work, (complex64_t *) conv->spectrum, (complex64_t *) conv->out, conv->fft_len / 2 + 1);
+    irfftd_C(conv->plan, (complex64_t *) conv->out, conv->out);
+}
+
+// returns len, -1 if conv is a complex convolution
+SIMD_UTILS_API int convf_C(conv32_t *conv, float *src, float *dst, int len)
+{
+    if (conv->cplx)
+        return -1;
+    return conv_runf(conv, fir_kernelf_C, conv_blockf_C, src, dst, len);
+}
+
+SIMD_UTILS_API int convf_cplx_C(conv32_t *conv, complex32_t *src, complex32_t *dst, int len)
+{
+    if (!conv->cplx)
+        return -1;
+    return conv_runf(conv, fir_kernelf_cplx_C, conv_blockf_C, (float *) src, (float *) dst, len);
+}
+
+SIMD_UTILS_API int convd_C(conv64_t *conv, double *src, double *dst, int len)
+{
+    return conv_rund(conv, fir_kerneld_C, conv_blockd_C, src, dst, len);
+}
+
+#endif /* SIMD_UTILS_EXTERN */
+
 #ifdef __cplusplus
 }
 #endif
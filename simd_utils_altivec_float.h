@@ -129,7 +129,7 @@ static inline v4sf vec_sqrt_precise(v4sf a)
 #endif
 
 
-static inline void set128f(float *dst, float value, int len)
+SIMD_UTILS_API void set128f(float *dst, float value, int len)
 {
     v4sf tmp = vec_splats(value);
 
@@ -160,12 +160,12 @@ static inline void set128f(float *dst, float value, int len)
     }
 }
 
-static inline void zero128f(float *dst, int len)
+SIMD_UTILS_API void zero128f(float *dst, int len)
 {
     set128f(dst, 0.0f, len);
 }
 
-static inline void copy128f(float *src, float *dst, int len)
+SIMD_UTILS_API void copy128f(float *src, float *dst, int len)
 {
     int stop_len = len / (2 * ALTIVEC_LEN_FLOAT);
     stop_len *= (2 * ALTIVEC_LEN_FLOAT);
@@ -205,7 +205,7 @@ static inline void copy128f(float *src, float *dst, int len)
     }
 }
 
-static inline void add128f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void add128f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -252,7 +252,7 @@ static inline void add128f(float *src1, float *src2, float *dst, int len)
     }
 }
 
-static inline void addc128f(float *src, float value, float *dst, int len)
+SIMD_UTILS_API void addc128f(float *src, float value, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -295,7 +295,7 @@ static inline void addc128f(float *src, float value, float *dst, int len)
     }
 }
 
-static inline void sub128f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void sub128f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -342,7 +342,7 @@ static inline void sub128f(float *src1, float *src2, float *dst, int len)
     }
 }
 
-static inline void subc128f(float *src, float value, float *dst, int len)
+SIMD_UTILS_API void subc128f(float *src, float value, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -385,7 +385,7 @@ static inline void subc128f(float *src, float value, float *dst, int len)
     }
 }
 
-static inline void subcrev128f(float *src, float value, float *dst, int len)
+SIMD_UTILS_API void subcrev128f(float *src, float value, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -428,7 +428,7 @@ static inline void subcrev128f(float *src, float value, float *dst, int len)
     }
 }
 
-static inline void mul128f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void mul128f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -475,7 +475,7 @@ static inline void mul128f(float *src1, float *src2, float *dst, int len)
     }
 }
 
-static inline void mulc128f(float *src, float value, float *dst, int len)
+SIMD_UTILS_API void mulc128f(float *src, float value, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -518,7 +518,7 @@ static inline void mulc128f(float *src, float value, float *dst, int len)
     }
 }
 
-static inline void div128f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void div128f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -566,7 +566,7 @@ static inline void div128f(float *src1, float *src2, float *dst, int len)
 }
 
 
-static inline void fabs128f(float *src, float *dst, int len)
+SIMD_UTILS_API void fabs128f(float *src, float *dst, int len)
 {
     int stop_len = len / (2 * ALTIVEC_LEN_FLOAT);
     stop_len *= (2 * ALTIVEC_LEN_FLOAT);
@@ -611,7 +611,7 @@ static inline void fabs128f(float *src, float *dst, int len)
     }
 }
 
-static inline void minevery128f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void minevery128f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -654,7 +654,7 @@ static inline void minevery128f(float *src1, float *src2, float *dst, int len)
     }
 }
 
-static inline void maxevery128f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void maxevery128f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -698,7 +698,7 @@ static inline void maxevery128f(float *src1, float *src2, float *dst, int len)
 }
 
 // converts 32bits complex float to two arrays real and im
-static inline void cplxtoreal128f(complex32_t *src, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxtoreal128f(complex32_t *src, float *dstRe, float *dstIm, int len)
 {
 #ifdef LLVMMCA
     __asm volatile("# LLVM-MCA-BEGIN cplxtoreal128f" ::
@@ -763,7 +763,7 @@ static inline void cplxtoreal128f(complex32_t *src, float *dstRe, float *dstIm,
 #endif
 }
 
-static inline void realtocplx128f(float *srcRe, float *srcIm, complex32_t *dst, int len)
+SIMD_UTILS_API void realtocplx128f(float *srcRe, float *srcIm, complex32_t *dst, int len)
 {
 #ifdef LLVMMCA
     __asm volatile("# LLVM-MCA-BEGIN realtocplx128f" ::
@@ -871,7 +871,7 @@ static inline v4sf exp_ps_alternate(v4sf x)
     return z;
 }
 
-static inline void exp128f(float *src, float *dst, int len)
+SIMD_UTILS_API void exp128f(float *src, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -907,7 +907,7 @@ static inline void exp128f(float *src, float *dst, int len)
     }
 }
 
-static inline void log2128f(float *src, float *dst, int len)
+SIMD_UTILS_API void log2128f(float *src, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -988,7 +988,7 @@ static inline v4sf log2_ps(v4sf x)
     return x;
 }
 
-static inline void log2128f_precise(float *src, float *dst, int len)
+SIMD_UTILS_API void log2128f_precise(float *src, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -1025,7 +1025,7 @@ static inline void log2128f_precise(float *src, float *dst, int len)
 }
 
 // less precise
-static inline void ln128f_less_precise(float *src, float *dst, int len)
+SIMD_UTILS_API void ln128f_less_precise(float *src, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -1063,7 +1063,7 @@ static inline void ln128f_less_precise(float *src, float *dst, int len)
     }
 }
 
-static inline void log10128f(float *src, float *dst, int len)
+SIMD_UTILS_API void log10128f(float *src, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -1159,7 +1159,7 @@ static inline v4sf log10_ps(v4sf x)
     return x;
 }
 
-static inline void log10128f_precise(float *src, float *dst, int len)
+SIMD_UTILS_API void log10128f_precise(float *src, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -1245,7 +1245,7 @@ static inline v4sf log_ps(v4sf x)
     return x;
 }
 
-static inline void ln128f(float *src, float *dst, int len)
+SIMD_UTILS_API void ln128f(float *src, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -1281,7 +1281,7 @@ static inline void ln128f(float *src, float *dst, int len)
     }
 }
 
-static inline void magnitude128f_split(float *srcRe, float *srcIm, float *dst, int len)
+SIMD_UTILS_API void magnitude128f_split(float *srcRe, float *srcIm, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -1332,7 +1332,7 @@ static inline void magnitude128f_split(float *srcRe, float *srcIm, float *dst, i
     }
 }
 
-static inline void powerspect128f_split(float *srcRe, float *srcIm, float *dst, int len)
+SIMD_UTILS_API void powerspect128f_split(float *srcRe, float *srcIm, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -1385,7 +1385,7 @@ static inline void powerspect128f_split(float *srcRe, float *srcIm, float *dst,
 
 // vec_nmsub(a,b,c) => -(a*b -c)
 // (ac -bd) + i(ad + bc)
-static inline void cplxvecmul128f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxvecmul128f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
 {
     int stop_len = len / (4 * ALTIVEC_LEN_FLOAT);
     stop_len *= 4 * ALTIVEC_LEN_FLOAT;
@@ -1460,7 +1460,7 @@ static inline void cplxvecmul128f(complex32_t *src1, complex32_t *src2, complex3
     }
 }
 
-static inline void cplxvecmul128f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxvecmul128f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
 {
     int stop_len = len / (ALTIVEC_LEN_FLOAT);
     stop_len = stop_len * ALTIVEC_LEN_FLOAT;
@@ -1541,7 +1541,7 @@ static inline void cplxvecmul128f_split(float *src1Re, float *src1Im, float *src
     }
 }
 
-static inline void cplxvecdiv128f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxvecdiv128f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
 {
     int stop_len = len / (4 * ALTIVEC_LEN_FLOAT);
     stop_len *= 4 * ALTIVEC_LEN_FLOAT;
@@ -1633,7 +1633,7 @@ static inline void cplxvecdiv128f(complex32_t *src1, complex32_t *src2, complex3
     }
 }
 
-static inline void cplxvecdiv128f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxvecdiv128f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
 {
     int stop_len = len / (ALTIVEC_LEN_FLOAT);
     stop_len = stop_len * ALTIVEC_LEN_FLOAT;
@@ -1723,7 +1723,7 @@ static inline void cplxvecdiv128f_split(float *src1Re, float *src1Im, float *src
     }
 }
 
-static inline void minmax128f(float *src, int len, float *min_value, float *max_value)
+SIMD_UTILS_API void minmax128f(float *src, int len, float *min_value, float *max_value)
 {
     int stop_len = (len - ALTIVEC_LEN_FLOAT) / (2 * ALTIVEC_LEN_FLOAT);
     stop_len *= (2 * ALTIVEC_LEN_FLOAT);
@@ -1796,7 +1796,7 @@ static inline void minmax128f(float *src, int len, float *min_value, float *max_
     *min_value = min_tmp;
 }
 
-static inline void sum128f(float *src, float *dst, int len)
+SIMD_UTILS_API void sum128f(float *src, float *dst, int len)
 {
     int stop_len = len / (2 * ALTIVEC_LEN_FLOAT);
     stop_len *= (2 * ALTIVEC_LEN_FLOAT);
@@ -1835,7 +1835,7 @@ static inline void sum128f(float *src, float *dst, int len)
     *dst = tmp_acc;
 }
 
-static inline void mean128f(float *src, float *dst, int len)
+SIMD_UTILS_API void mean128f(float *src, float *dst, int len)
 {
     float coeff = 1.0f / ((float) len);
     sum128f(src, dst, len);
@@ -1843,7 +1843,7 @@ static inline void mean128f(float *src, float *dst, int len)
 }
 
 
-static inline void threshold128_gt_f(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold128_gt_f(float *src, float *dst, int len, float value)
 {
     const v4sf tmp = {value, value, value, value};
 
@@ -1890,7 +1890,7 @@ static inline void threshold128_gt_f(float *src, float *dst, int len, float valu
     }
 }
 
-static inline void threshold128_gtabs_f(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold128_gtabs_f(float *src, float *dst, int len, float value)
 {
     const v4sf pval = vec_splats(value);
 
@@ -1954,7 +1954,7 @@ static inline void threshold128_gtabs_f(float *src, float *dst, int len, float v
 }
 
 
-static inline void threshold128_lt_f(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold128_lt_f(float *src, float *dst, int len, float value)
 {
     const v4sf tmp = {value, value, value, value};
 
@@ -2001,7 +2001,7 @@ static inline void threshold128_lt_f(float *src, float *dst, int len, float valu
     }
 }
 
-static inline void threshold128_ltabs_f(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold128_ltabs_f(float *src, float *dst, int len, float value)
 {
     const v4sf pval = vec_splats(value);
 
@@ -2065,7 +2065,7 @@ static inline void threshold128_ltabs_f(float *src, float *dst, int len, float v
 }
 
 
-static inline void threshold128_ltval_gtval_f(float *src, float *dst, int len, float ltlevel, float ltvalue, float gtlevel, float gtvalue)
+SIMD_UTILS_API void threshold128_ltval_gtval_f(float *src, float *dst, int len, float ltlevel, float ltvalue, float gtlevel, float gtvalue)
 {
     const v4sf ltlevel_v = {ltlevel, ltlevel, ltlevel, ltlevel};
     const v4sf ltvalue_v = {ltvalue, ltvalue, ltvalue, ltvalue};
@@ -2129,7 +2129,7 @@ static inline void threshold128_ltval_gtval_f(float *src, float *dst, int len, f
     }
 }
 			
-static inline void rint128f(float *src, float *dst, int len)
+SIMD_UTILS_API void rint128f(float *src, float *dst, int len)
 {
     int stop_len = len / (2 * ALTIVEC_LEN_FLOAT);
     stop_len *= (2 * ALTIVEC_LEN_FLOAT);
@@ -2174,7 +2174,7 @@ static inline void rint128f(float *src, float *dst, int len)
     }
 }
 
-static inline void round128f(float *src, float *dst, int len)
+SIMD_UTILS_API void round128f(float *src, float *dst, int len)
 {
     int stop_len = len / (2 * ALTIVEC_LEN_FLOAT);
     stop_len *= (2 * ALTIVEC_LEN_FLOAT);
@@ -2231,7 +2231,7 @@ static inline void round128f(float *src, float *dst, int len)
     }
 }
 
-static inline void ceil128f(float *src, float *dst, int len)
+SIMD_UTILS_API void ceil128f(float *src, float *dst, int len)
 {
     int stop_len = len / (2 * ALTIVEC_LEN_FLOAT);
     stop_len *= (2 * ALTIVEC_LEN_FLOAT);
@@ -2276,7 +2276,7 @@ static inline void ceil128f(float *src, float *dst, int len)
     }
 }
 
-static inline void floor128f(float *src, float *dst, int len)
+SIMD_UTILS_API void floor128f(float *src, float *dst, int len)
 {
     int stop_len = len / (2 * ALTIVEC_LEN_FLOAT);
     stop_len *= (2 * ALTIVEC_LEN_FLOAT);
@@ -2321,7 +2321,7 @@ static inline void floor128f(float *src, float *dst, int len)
     }
 }
 
-static inline void trunc128f(float *src, float *dst, int len)
+SIMD_UTILS_API void trunc128f(float *src, float *dst, int len)
 {
     int stop_len = len / (2 * ALTIVEC_LEN_FLOAT);
     stop_len *= (2 * ALTIVEC_LEN_FLOAT);
@@ -2366,7 +2366,7 @@ static inline void trunc128f(float *src, float *dst, int len)
     }
 }
 
-static inline void sqrt128f(float *src, float *dst, int len)
+SIMD_UTILS_API void sqrt128f(float *src, float *dst, int len)
 {
     int stop_len = len / (2 * ALTIVEC_LEN_FLOAT);
     stop_len *= (2 * ALTIVEC_LEN_FLOAT);
@@ -2411,7 +2411,7 @@ static inline void sqrt128f(float *src, float *dst, int len)
     }
 }
 
-static inline void flip128f(float *src, float *dst, int len)
+SIMD_UTILS_API void flip128f(float *src, float *dst, int len)
 {
     int stop_len = len / (2 * ALTIVEC_LEN_FLOAT);
     stop_len *= (2 * ALTIVEC_LEN_FLOAT);
@@ -2552,7 +2552,7 @@ static inline void sincos_ps(v4sf x, v4sf *s, v4sf *c)
     *c = vec_xor(xmm2, *(v4sf *) sign_bit_cos);
 }
 
-static inline void sincos128f(float *src, float *dst_sin, float *dst_cos, int len)
+SIMD_UTILS_API void sincos128f(float *src, float *dst_sin, float *dst_cos, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -2601,7 +2601,7 @@ static inline void sincos128f(float *src, float *dst_sin, float *dst_cos, int le
     }
 }
 
-static inline void sincos128f_interleaved(float *src, complex32_t *dst, int len)
+SIMD_UTILS_API void sincos128f_interleaved(float *src, complex32_t *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -2705,7 +2705,7 @@ static inline v4sf tanf_ps(v4sf xx)
     return (y);
 }
 
-static inline void tan128f(float *src, float *dst, int len)
+SIMD_UTILS_API void tan128f(float *src, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -2741,7 +2741,7 @@ static inline void tan128f(float *src, float *dst, int len)
     }
 }
 
-static inline void tan128f_naive(float *restrict src, float *restrict dst, int len)
+SIMD_UTILS_API void tan128f_naive(float *restrict src, float *restrict dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -2818,7 +2818,7 @@ static inline v4sf atanf_ps(v4sf xx)
     return (y);
 }
 
-static inline void atan128f(float *src, float *dst, int len)
+SIMD_UTILS_API void atan128f(float *src, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -2901,7 +2901,7 @@ static inline v4sf atan2f_ps(v4sf y, v4sf x)
     return (z);
 }
 
-static inline void atan2128f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void atan2128f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -2948,7 +2948,7 @@ static inline void atan2128f(float *src1, float *src2, float *dst, int len)
     }
 }
 
-static inline void atan2128f_interleaved(complex32_t *src, float *dst, int len)
+SIMD_UTILS_API void atan2128f_interleaved(complex32_t *src, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -3035,7 +3035,7 @@ static inline v4sf tanhf_ps(v4sf xx)
     return (z);
 }
 
-static inline void tanh128f(float *src, float *dst, int len)
+SIMD_UTILS_API void tanh128f(float *src, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -3109,7 +3109,7 @@ static inline v4sf atanhf_ps(v4sf x)
     return (z);
 }
 
-static inline void atanh128f(float *src, float *dst, int len)
+SIMD_UTILS_API void atanh128f(float *src, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -3188,7 +3188,7 @@ static inline v4sf sinhf_ps(v4sf x)
     return (z);
 }
 
-static inline void sinh128f(float *src, float *dst, int len)
+SIMD_UTILS_API void sinh128f(float *src, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -3240,7 +3240,7 @@ static inline v4sf coshf_ps(v4sf xx)
     return y;
 }
 
-static inline void cosh128f(float *src, float *dst, int len)
+SIMD_UTILS_API void cosh128f(float *src, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -3308,7 +3308,7 @@ static inline v4sf asinhf_ps(v4sf xx)
     return z;
 }
 
-static inline void asinh128f(float *src, float *dst, int len)
+SIMD_UTILS_API void asinh128f(float *src, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -3380,7 +3380,7 @@ static inline v4sf acoshf_ps(v4sf x)
     return z;
 }
 
-static inline void acosh128f(float *src, float *dst, int len)
+SIMD_UTILS_API void acosh128f(float *src, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -3459,7 +3459,7 @@ static inline v4sf asinf_ps(v4sf xx)
     return (z);
 }
 
-static inline void asin128f(float *src, float *dst, int len)
+SIMD_UTILS_API void asin128f(float *src, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -3496,7 +3496,7 @@ static inline void asin128f(float *src, float *dst, int len)
 }
 
 
-static inline void cplxconj128f(complex32_t *src, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxconj128f(complex32_t *src, complex32_t *dst, int len)
 {
     int stop_len = len / (2 * ALTIVEC_LEN_FLOAT);  //(len << 1) >> 2;
     stop_len *= 2 * ALTIVEC_LEN_FLOAT;             // stop_len << 2;
@@ -3544,7 +3544,7 @@ static inline void cplxconj128f(complex32_t *src, complex32_t *dst, int len)
     }
 }
 
-static inline void PRelu128f(float *src, float *dst, float alpha, int len)
+SIMD_UTILS_API void PRelu128f(float *src, float *dst, float alpha, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -3590,7 +3590,7 @@ static inline void PRelu128f(float *src, float *dst, float alpha, int len)
     }
 }
 
-static inline void vectorSlope128f(float *dst, int len, float offset, float slope)
+SIMD_UTILS_API void vectorSlope128f(float *dst, int len, float offset, float slope)
 {
     v4sf coef = {0.0f, slope, 2.0f * slope, 3.0f * slope};
     v4sf slope8_vec = vec_splats(8.0f * slope);
@@ -3712,7 +3712,7 @@ static inline v4sf cbrtf_ps(v4sf xx)
     return x;
 }
 
-static inline void cbrt128f(float *src, float *dst, int len)
+SIMD_UTILS_API void cbrt128f(float *src, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -3748,7 +3748,7 @@ static inline void cbrt128f(float *src, float *dst, int len)
     }
 }
 
-static inline void modf128f(float *src, float *integer, float *remainder, int len)
+SIMD_UTILS_API void modf128f(float *src, float *integer, float *remainder, int len)
 {
     int stop_len = len / (2 * ALTIVEC_LEN_FLOAT);
     stop_len *= (2 * ALTIVEC_LEN_FLOAT);
@@ -3808,7 +3808,7 @@ static inline void modf128f(float *src, float *integer, float *remainder, int le
     }
 }
 
-static inline void dot128f(float *src1, float *src2, int len, float *dst)
+SIMD_UTILS_API void dot128f(float *src1, float *src2, int len, float *dst)
 {
     int stop_len = len / (2 * ALTIVEC_LEN_FLOAT);
     stop_len *= (2 * ALTIVEC_LEN_FLOAT);
@@ -3865,7 +3865,7 @@ static inline void dot128f(float *src1, float *src2, int len, float *dst)
     *dst = tmp_acc;
 }
 
-static inline void dotc128f(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst)
+SIMD_UTILS_API void dotc128f(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst)
 {
     int stop_len = len / (4 * ALTIVEC_LEN_FLOAT);
     stop_len *= 4 * ALTIVEC_LEN_FLOAT;
@@ -3957,7 +3957,7 @@ static inline void dotc128f(complex32_t *src1, complex32_t *src2, int len, compl
 }
 
 #ifndef __MACH__
-static inline void convertFloat32ToU8_128(float *src, uint8_t *dst, int len, int rounding_mode, int scale_factor)
+SIMD_UTILS_API void convertFloat32ToU8_128(float *src, uint8_t *dst, int len, int rounding_mode, int scale_factor)
 {
     int stop_len = len / (4 * ALTIVEC_LEN_FLOAT);
     stop_len *= (4 * ALTIVEC_LEN_FLOAT);
@@ -4142,7 +4142,7 @@ static inline void convertFloat32ToU8_128(float *src, uint8_t *dst, int len, int
     }
 }
 
-static inline void convertFloat32ToI16_128(float *src, int16_t *dst, int len, int rounding_mode, int scale_factor)
+SIMD_UTILS_API void convertFloat32ToI16_128(float *src, int16_t *dst, int len, int rounding_mode, int scale_factor)
 {
     int stop_len = len / (4 * ALTIVEC_LEN_FLOAT);
     stop_len *= (4 * ALTIVEC_LEN_FLOAT);
@@ -4331,7 +4331,7 @@ static inline void convertFloat32ToI16_128(float *src, int16_t *dst, int len, in
     }
 }
 
-static inline void convertFloat32ToU16_128(float *src, uint16_t *dst, int len, int rounding_mode, int scale_factor)
+SIMD_UTILS_API void convertFloat32ToU16_128(float *src, uint16_t *dst, int len, int rounding_mode, int scale_factor)
 {
     int stop_len = len / (4 * ALTIVEC_LEN_FLOAT);
     stop_len *= (4 * ALTIVEC_LEN_FLOAT);
@@ -4520,7 +4520,7 @@ static inline void convertFloat32ToU16_128(float *src, uint16_t *dst, int len, i
     }
 }
 
-static inline void convertInt16ToFloat32_128(int16_t *src, float *dst, int len, int scale_factor)
+SIMD_UTILS_API void convertInt16ToFloat32_128(int16_t *src, float *dst, int len, int scale_factor)
 {
     int stop_len = len / (2 * ALTIVEC_LEN_FLOAT);
     stop_len *= (2 * ALTIVEC_LEN_FLOAT);
@@ -4585,7 +4585,7 @@ static inline void convertInt16ToFloat32_128(int16_t *src, float *dst, int len,
 }
 #endif
 
-static inline void pol2cart2D128f(float *r, float *theta, float *x, float *y, int len)
+SIMD_UTILS_API void pol2cart2D128f(float *r, float *theta, float *x, float *y, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -4651,7 +4651,7 @@ static inline void pol2cart2D128f(float *r, float *theta, float *x, float *y, in
     }
 }
 
-static inline void cart2pol2D128f(float *x, float *y, float *r, float *theta, int len)
+SIMD_UTILS_API void cart2pol2D128f(float *x, float *y, float *r, float *theta, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -4713,7 +4713,7 @@ static inline void cart2pol2D128f(float *x, float *y, float *r, float *theta, in
     }
 }
 
-static inline void sigmoid128f(float *src, float *dst, int len)
+SIMD_UTILS_API void sigmoid128f(float *src, float *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_FLOAT;
     stop_len *= ALTIVEC_LEN_FLOAT;
@@ -4752,7 +4752,7 @@ static inline void sigmoid128f(float *src, float *dst, int len)
     }
 }
 
-static inline void softmax128f(float *src, float *dst, int len)
+SIMD_UTILS_API void softmax128f(float *src, float *dst, int len)
 {
     int stop_len = len / (ALTIVEC_LEN_FLOAT);
     stop_len *= (ALTIVEC_LEN_FLOAT);
@@ -57,7 +57,7 @@ static v4si vec_mullo(v4si a, v4si b)
 #endif
 
 /*
-static inline void mul128s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+SIMD_UTILS_API void mul128s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
 {
     int stop_len = len / (2 * ALTIVEC_LEN_INT32);
     stop_len *= (2 * ALTIVEC_LEN_INT32);
@@ -83,7 +83,7 @@ static inline void mul128s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
 }
 */
 
-static inline void copy128s(int32_t *src, int32_t *dst, int len)
+SIMD_UTILS_API void copy128s(int32_t *src, int32_t *dst, int len)
 {
     int stop_len = len / (2 * ALTIVEC_LEN_INT32);
     stop_len *= (2 * ALTIVEC_LEN_INT32);
@@ -123,7 +123,7 @@ static inline void copy128s(int32_t *src, int32_t *dst, int len)
     }
 }
 
-static inline void add128s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+SIMD_UTILS_API void add128s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_INT32;
     stop_len *= ALTIVEC_LEN_INT32;
@@ -170,7 +170,7 @@ static inline void add128s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
     }
 }
 
-static inline void addc128s(int32_t *src, int32_t value, int32_t *dst, int len)
+SIMD_UTILS_API void addc128s(int32_t *src, int32_t value, int32_t *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_INT32;
     stop_len *= ALTIVEC_LEN_INT32;
@@ -213,7 +213,7 @@ static inline void addc128s(int32_t *src, int32_t value, int32_t *dst, int len)
     }
 }
 
-static inline void sub128s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+SIMD_UTILS_API void sub128s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_INT32;
     stop_len *= ALTIVEC_LEN_INT32;
@@ -260,7 +260,7 @@ static inline void sub128s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
     }
 }
 
-static inline void subc128s(int32_t *src, int32_t value, int32_t *dst, int len)
+SIMD_UTILS_API void subc128s(int32_t *src, int32_t value, int32_t *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_INT32;
     stop_len *= ALTIVEC_LEN_INT32;
@@ -303,7 +303,7 @@ static inline void subc128s(int32_t *src, int32_t value, int32_t *dst, int len)
     }
 }
 
-static inline void flip128s(int32_t *src, int32_t *dst, int len)
+SIMD_UTILS_API void flip128s(int32_t *src, int32_t *dst, int len)
 {
     int stop_len = len / (2 * ALTIVEC_LEN_INT32);
     stop_len *= (2 * ALTIVEC_LEN_INT32);
@@ -353,7 +353,7 @@ static inline void flip128s(int32_t *src, int32_t *dst, int len)
     }
 }
 
-static inline void minevery128s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+SIMD_UTILS_API void minevery128s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_INT32;
     stop_len *= ALTIVEC_LEN_INT32;
@@ -396,7 +396,7 @@ static inline void minevery128s(int32_t *src1, int32_t *src2, int32_t *dst, int
     }
 }
 
-static inline void maxevery128s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+SIMD_UTILS_API void maxevery128s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_INT32;
     stop_len *= ALTIVEC_LEN_INT32;
@@ -439,7 +439,7 @@ static inline void maxevery128s(int32_t *src1, int32_t *src2, int32_t *dst, int
     }
 }
 
-static inline void minmax128s(int32_t *src, int len, int32_t *min_value, int32_t *max_value)
+SIMD_UTILS_API void minmax128s(int32_t *src, int len, int32_t *min_value, int32_t *max_value)
 {
     int stop_len = (len - ALTIVEC_LEN_INT32) / (2 * ALTIVEC_LEN_INT32);
     stop_len *= (2 * ALTIVEC_LEN_INT32);
@@ -512,7 +512,7 @@ static inline void minmax128s(int32_t *src, int len, int32_t *min_value, int32_t
     *min_value = min_tmp;
 }
 
-static inline void threshold128_gt_s(int32_t *src, int32_t *dst, int len, int32_t value)
+SIMD_UTILS_API void threshold128_gt_s(int32_t *src, int32_t *dst, int len, int32_t value)
 {
     const v4si tmp = {value, value, value, value};
 
@@ -559,7 +559,7 @@ static inline void threshold128_gt_s(int32_t *src, int32_t *dst, int len, int32_
     }
 }
 
-static inline void threshold128_gtabs_s(int32_t *src, int32_t *dst, int len, int32_t value)
+SIMD_UTILS_API void threshold128_gtabs_s(int32_t *src, int32_t *dst, int len, int32_t value)
 {
     const v4si pval = vec_splats(value);
     const v4si mval = vec_splats(-value);
@@ -628,7 +628,7 @@ static inline void threshold128_gtabs_s(int32_t *src, int32_t *dst, int len, int
     }
 }
 
-static inline void threshold128_lt_s(int32_t *src, int32_t *dst, int len, int32_t value)
+SIMD_UTILS_API void threshold128_lt_s(int32_t *src, int32_t *dst, int len, int32_t value)
 {
     const v4si tmp = {value, value, value, value};
 
@@ -675,7 +675,7 @@ static inline void threshold128_lt_s(int32_t *src, int32_t *dst, int len, int32_
     }
 }
 
-static inline void threshold128_ltabs_s(int32_t *src, int32_t *dst, int len, int32_t value)
+SIMD_UTILS_API void threshold128_ltabs_s(int32_t *src, int32_t *dst, int len, int32_t value)
 {
     const v4si pval = vec_splats(value);
     const v4si mval = vec_splats(-value);
@@ -744,7 +744,7 @@ static inline void threshold128_ltabs_s(int32_t *src, int32_t *dst, int len, int
 }
 
 
-static inline void threshold128_ltval_gtval_s(int32_t *src, int32_t *dst, int len, int32_t ltlevel, int32_t ltvalue, int32_t gtlevel, int32_t gtvalue)
+SIMD_UTILS_API void threshold128_ltval_gtval_s(int32_t *src, int32_t *dst, int len, int32_t ltlevel, int32_t ltvalue, int32_t gtlevel, int32_t gtvalue)
 {
     const v4si ltlevel_v = {ltlevel, ltlevel, ltlevel, ltlevel};
     const v4si ltvalue_v = {ltvalue, ltvalue, ltvalue, ltvalue};
@@ -824,7 +824,7 @@ static inline v8ss vec_absdiff(v8ss a, v8ss b)
 #endif
 }
 
-static inline void absdiff16s_128s(int16_t *src1, int16_t *src2, int16_t *dst, int len)
+SIMD_UTILS_API void absdiff16s_128s(int16_t *src1, int16_t *src2, int16_t *dst, int len)
 {
     int stop_len = len / ALTIVEC_LEN_INT16;
     stop_len *= ALTIVEC_LEN_INT16;
@@ -873,7 +873,7 @@ static inline void absdiff16s_128s(int16_t *src1, int16_t *src2, int16_t *dst, i
 }
 
 // Works with positive scale_factor (divides final value)
-static inline void sum16s32s128(int16_t *src, int len, int32_t *dst, int scale_factor)
+SIMD_UTILS_API void sum16s32s128(int16_t *src, int len, int32_t *dst, int scale_factor)
 {
     int stop_len = len / (4 * ALTIVEC_LEN_INT16);
     stop_len *= (4 * ALTIVEC_LEN_INT16);
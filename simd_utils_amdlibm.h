@@ -11,7 +11,7 @@
 #include "amdlibm_vec.h"
 
 #ifdef SSE
-static inline void sin128f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void sin128f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -33,7 +33,7 @@ static inline void sin128f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void cos128f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void cos128f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -55,7 +55,7 @@ static inline void cos128f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void sincos128f_amdlibm(float *src, float *dst_sin, float *dst_cos, int len)
+SIMD_UTILS_API void sincos128f_amdlibm(float *src, float *dst_sin, float *dst_cos, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -83,7 +83,7 @@ static inline void sincos128f_amdlibm(float *src, float *dst_sin, float *dst_cos
     }
 }
 
-static inline void sincos128d_amdlibm(double *src, double *dst_sin, double *dst_cos, int len)
+SIMD_UTILS_API void sincos128d_amdlibm(double *src, double *dst_sin, double *dst_cos, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -112,7 +112,7 @@ static inline void sincos128d_amdlibm(double *src, double *dst_sin, double *dst_
     }
 }
 
-static inline void exp128f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void exp128f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -132,7 +132,7 @@ static inline void exp128f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void exp128d_amdlibm(double *src, double *dst, int len)
+SIMD_UTILS_API void exp128d_amdlibm(double *src, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -154,7 +154,7 @@ static inline void exp128d_amdlibm(double *src, double *dst, int len)
     }
 }
 
-static inline void ln128f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void ln128f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -174,7 +174,7 @@ static inline void ln128f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void ln128d_amdlibm(double *src, double *dst, int len)
+SIMD_UTILS_API void ln128d_amdlibm(double *src, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -196,7 +196,7 @@ static inline void ln128d_amdlibm(double *src, double *dst, int len)
     }
 }
 
-static inline void log2128f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void log2128f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -216,7 +216,7 @@ static inline void log2128f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void log10128f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void log10128f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -236,7 +236,7 @@ static inline void log10128f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void atan128f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void atan128f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -258,7 +258,7 @@ static inline void atan128f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void atan128d_amdlibm(double *src, double *dst, int len)
+SIMD_UTILS_API void atan128d_amdlibm(double *src, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -281,7 +281,7 @@ static inline void atan128d_amdlibm(double *src, double *dst, int len)
 }
 
 /*
-static inline void atan2128f_amdlibm(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void atan2128f_amdlibm(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -302,7 +302,7 @@ static inline void atan2128f_amdlibm(float *src1, float *src2, float *dst, int l
 }
 */
 
-static inline void asin128f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void asin128f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -325,7 +325,7 @@ static inline void asin128f_amdlibm(float *src, float *dst, int len)
 }
 
 /*
-static inline void asin512d_amdlibm(double *src, double *dst, int len)
+SIMD_UTILS_API void asin512d_amdlibm(double *src, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -348,7 +348,7 @@ static inline void asin512d_amdlibm(double *src, double *dst, int len)
 }
 */
 
-static inline void tan128f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void tan128f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -370,7 +370,7 @@ static inline void tan128f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void tan128d_amdlibm(double *src, double *dst, int len)
+SIMD_UTILS_API void tan128d_amdlibm(double *src, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -393,7 +393,7 @@ static inline void tan128d_amdlibm(double *src, double *dst, int len)
 }
 
 /*
-static inline void atanh128f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void atanh128f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -415,7 +415,7 @@ static inline void atanh128f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void acosh128f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void acosh128f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -437,7 +437,7 @@ static inline void acosh128f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void asinh128f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void asinh128f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -459,7 +459,7 @@ static inline void asinh128f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void sinh128f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void sinh128f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -482,7 +482,7 @@ static inline void sinh128f_amdlibm(float *src, float *dst, int len)
 }
 */
 
-static inline void cosh128f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void cosh128f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -504,7 +504,7 @@ static inline void cosh128f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void tanh128f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void tanh128f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -526,7 +526,7 @@ static inline void tanh128f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void cbrt128f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void cbrt128f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / (SSE_LEN_FLOAT);
     stop_len *= (SSE_LEN_FLOAT);
@@ -553,7 +553,7 @@ static inline void cbrt128f_amdlibm(float *src, float *dst, int len)
 
 #ifdef AVX
 
-static inline void sin256f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void sin256f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -575,7 +575,7 @@ static inline void sin256f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void cos256f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void cos256f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -597,7 +597,7 @@ static inline void cos256f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void sincos256f_amdlibm(float *src, float *dst_sin, float *dst_cos, int len)
+SIMD_UTILS_API void sincos256f_amdlibm(float *src, float *dst_sin, float *dst_cos, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -625,7 +625,7 @@ static inline void sincos256f_amdlibm(float *src, float *dst_sin, float *dst_cos
     }
 }
 
-static inline void sincos256d_amdlibm(double *src, double *dst_sin, double *dst_cos, int len)
+SIMD_UTILS_API void sincos256d_amdlibm(double *src, double *dst_sin, double *dst_cos, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -654,7 +654,7 @@ static inline void sincos256d_amdlibm(double *src, double *dst_sin, double *dst_
     }
 }
 
-static inline void exp256f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void exp256f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -674,7 +674,7 @@ static inline void exp256f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void exp256d_amdlibm(double *src, double *dst, int len)
+SIMD_UTILS_API void exp256d_amdlibm(double *src, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -696,7 +696,7 @@ static inline void exp256d_amdlibm(double *src, double *dst, int len)
     }
 }
 
-static inline void ln256f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void ln256f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -716,7 +716,7 @@ static inline void ln256f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void ln256d_amdlibm(double *src, double *dst, int len)
+SIMD_UTILS_API void ln256d_amdlibm(double *src, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -738,7 +738,7 @@ static inline void ln256d_amdlibm(double *src, double *dst, int len)
     }
 }
 
-static inline void log2256f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void log2256f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -758,7 +758,7 @@ static inline void log2256f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void log10256f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void log10256f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -778,7 +778,7 @@ static inline void log10256f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void atan256f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void atan256f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -800,7 +800,7 @@ static inline void atan256f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void atan256d_amdlibm(double *src, double *dst, int len)
+SIMD_UTILS_API void atan256d_amdlibm(double *src, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -823,7 +823,7 @@ static inline void atan256d_amdlibm(double *src, double *dst, int len)
 }
 
 /*
-static inline void atan2256f_amdlibm(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void atan2256f_amdlibm(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -844,7 +844,7 @@ static inline void atan2256f_amdlibm(float *src1, float *src2, float *dst, int l
 }
 */
 
-static inline void asin256f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void asin256f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -867,7 +867,7 @@ static inline void asin256f_amdlibm(float *src, float *dst, int len)
 }
 
 /*
-static inline void asin256d_amdlibm(double *src, double *dst, int len)
+SIMD_UTILS_API void asin256d_amdlibm(double *src, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -890,7 +890,7 @@ static inline void asin256d_amdlibm(double *src, double *dst, int len)
 }
 */
 
-static inline void tan256f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void tan256f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -912,7 +912,7 @@ static inline void tan256f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void tan256d_amdlibm(double *src, double *dst, int len)
+SIMD_UTILS_API void tan256d_amdlibm(double *src, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -935,7 +935,7 @@ static inline void tan256d_amdlibm(double *src, double *dst, int len)
 }
 
 /*
-static inline void atanh256f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void atanh256f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -957,7 +957,7 @@ static inline void atanh256f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void acosh256f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void acosh256f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -979,7 +979,7 @@ static inline void acosh256f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void asinh256f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void asinh256f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -1001,7 +1001,7 @@ static inline void asinh256f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void sinh256f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void sinh256f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -1024,7 +1024,7 @@ static inline void sinh256f_amdlibm(float *src, float *dst, int len)
 }
 */
 
-static inline void cosh256f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void cosh256f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -1046,7 +1046,7 @@ static inline void cosh256f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void tanh256f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void tanh256f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -1072,7 +1072,7 @@ static inline void tanh256f_amdlibm(float *src, float *dst, int len)
 
 #ifdef AVX512
 
-static inline void sin512f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void sin512f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1094,7 +1094,7 @@ static inline void sin512f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void cos512f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void cos512f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1116,7 +1116,7 @@ static inline void cos512f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void sincos512f_amdlibm(float *src, float *dst_sin, float *dst_cos, int len)
+SIMD_UTILS_API void sincos512f_amdlibm(float *src, float *dst_sin, float *dst_cos, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1144,7 +1144,7 @@ static inline void sincos512f_amdlibm(float *src, float *dst_sin, float *dst_cos
     }
 }
 
-static inline void sincos512d_amdlibm(double *src, double *dst_sin, double *dst_cos, int len)
+SIMD_UTILS_API void sincos512d_amdlibm(double *src, double *dst_sin, double *dst_cos, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -1173,7 +1173,7 @@ static inline void sincos512d_amdlibm(double *src, double *dst_sin, double *dst_
     }
 }
 
-static inline void exp512f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void exp512f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1193,7 +1193,7 @@ static inline void exp512f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void exp512d_amdlibm(double *src, double *dst, int len)
+SIMD_UTILS_API void exp512d_amdlibm(double *src, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -1215,7 +1215,7 @@ static inline void exp512d_amdlibm(double *src, double *dst, int len)
     }
 }
 
-static inline void ln512f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void ln512f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1235,7 +1235,7 @@ static inline void ln512f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void ln512d_amdlibm(double *src, double *dst, int len)
+SIMD_UTILS_API void ln512d_amdlibm(double *src, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -1257,7 +1257,7 @@ static inline void ln512d_amdlibm(double *src, double *dst, int len)
     }
 }
 
-static inline void log2512f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void log2512f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1277,7 +1277,7 @@ static inline void log2512f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void log10512f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void log10512f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1297,7 +1297,7 @@ static inline void log10512f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void atan512f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void atan512f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1319,7 +1319,7 @@ static inline void atan512f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void atan512d_amdlibm(double *src, double *dst, int len)
+SIMD_UTILS_API void atan512d_amdlibm(double *src, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -1342,7 +1342,7 @@ static inline void atan512d_amdlibm(double *src, double *dst, int len)
 }
 
 /*
-static inline void atan2512f_amdlibm(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void atan2512f_amdlibm(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1362,7 +1362,7 @@ static inline void atan2512f_amdlibm(float *src1, float *src2, float *dst, int l
     }
 }*/
 
-static inline void asin512f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void asin512f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1384,7 +1384,7 @@ static inline void asin512f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void asin512d_amdlibm(double *src, double *dst, int len)
+SIMD_UTILS_API void asin512d_amdlibm(double *src, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -1407,7 +1407,7 @@ static inline void asin512d_amdlibm(double *src, double *dst, int len)
 }
 
 /*
-static inline void tan512f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void tan512f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1429,7 +1429,7 @@ static inline void tan512f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void tan512d_amdlibm(double *src, double *dst, int len)
+SIMD_UTILS_API void tan512d_amdlibm(double *src, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -1451,7 +1451,7 @@ static inline void tan512d_amdlibm(double *src, double *dst, int len)
     }
 }
 
-static inline void atanh512f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void atanh512f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1473,7 +1473,7 @@ static inline void atanh512f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void acosh512f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void acosh512f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1495,7 +1495,7 @@ static inline void acosh512f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void asinh512f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void asinh512f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1517,7 +1517,7 @@ static inline void asinh512f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void sinh512f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void sinh512f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1539,7 +1539,7 @@ static inline void sinh512f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void cosh512f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void cosh512f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1561,7 +1561,7 @@ static inline void cosh512f_amdlibm(float *src, float *dst, int len)
     }
 }
 
-static inline void tanh512f_amdlibm(float *src, float *dst, int len)
+SIMD_UTILS_API void tanh512f_amdlibm(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -0,0 +1,1980 @@
+/*
+ * Project : SIMD_Utils
+ * Version : 0.2.6
+ * Author  : JishinMaster
+ * Licence : BSD-2
+ */
+
+#pragma once
+
+/* Prototypes of the functions of the library mode (SIMD_UTILS_EXTERN, see simd_utils.h).
+ * Generated by scripts/gen_api_header.py from the SIMD_UTILS_API definitions, do not edit. */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "simd_utils_types.h"
+
+// simd_utils.h
+void simd_utils_get_version(void);
+void simd_set_stream_threshold(size_t bytes);
+size_t simd_get_stream_threshold(void);
+void fp32tofp16_C(float* src, uint16_t* dst, size_t len);
+void fp16tofp32_C(uint16_t* src, float* dst, size_t len);
+
+// simd_utils_fft.h
+fft_plan32_t *fft_plan32_create(int n);
+fft_plan32_t *rfft_plan32_create(int n);
+void fft_plan32_destroy(fft_plan32_t *plan);
+fft_plan64_t *fft_plan64_create(int n);
+fft_plan64_t *rfft_plan64_create(int n);
+void fft_plan64_destroy(fft_plan64_t *plan);
+
+// simd_utils_fir.h
+void fir32_reset(fir32_t *fir);
+fir32_t *fir32_create(float *taps, int nb_taps, int up, int down);
+fir32_t *fir32_create_cplx(complex32_t *taps, int nb_taps, int up, int down);
+void fir32_destroy(fir32_t *fir);
+
+// simd_utils_iir.h
+void iir32_reset(iir32_t *iir);
+void iir32_set_coefs(iir32_t *iir, int channel, float *coefs);
+iir32_t *iir32_create(float *coefs, int nb_stages, int nb_channels);
+void iir32_destroy(iir32_t *iir);
+
+// simd_utils_conv.h
+void conv32_reset(conv32_t *conv);
+void conv64_reset(conv64_t *conv);
+conv32_t *conv32_create(float *kernel, int len);
+conv32_t *conv32_create_cplx(complex32_t *kernel, int len);
+conv32_t *xcorr32_create(float *tmpl, int len);
+conv32_t *xcorr32_create_cplx(complex32_t *tmpl, int len);
+void conv32_destroy(conv32_t *conv);
+conv64_t *conv64_create(double *kernel, int len);
+conv64_t *xcorr64_create(double *tmpl, int len);
+void conv64_destroy(conv64_t *conv);
+
+// simd_utils_moments.h
+void moments_init(moments_t *m);
+void moments_merge(moments_t *dst, const moments_t *src);
+double moments_mean(const moments_t *m);
+double moments_variance(const moments_t *m, int ddof);
+double moments_stddev(const moments_t *m, int ddof);
+double moments_skewness(const moments_t *m);
+double moments_kurtosis(const moments_t *m);
+
+// simd_utils_sse_double.h
+#if defined(SSE)
+void set128d(double *dst, double value, int len);
+void zero128d(double *dst, int len);
+void copy128d(double *src, double *dst, int len);
+void sqrt128d(double *src, double *dst, int len);
+void fabs128d(double *src, double *dst, int len);
+void add128d(double *src1, double *src2, double *dst, int len);
+void mul128d(double *src1, double *src2, double *dst, int len);
+void sub128d(double *src1, double *src2, double *dst, int len);
+void div128d(double *src1, double *src2, double *dst, int len);
+void addc128d(double *src, double value, double *dst, int len);
+void mulc128d(double *src, double value, double *dst, int len);
+void muladd128d(double *_a, double *_b, double *_c, double *dst, int len);
+void mulcadd128d(double *_a, double _b, double *_c, double *dst, int len);
+void mulcaddc128d(double *_a, double _b, double _c, double *dst, int len);
+void muladdc128d(double *_a, double *_b, double _c, double *dst, int len);
+void rint128d(double *src, double *dst, int len);
+void round128d(double *src, double *dst, int len);
+void ceil128d(double *src, double *dst, int len);
+void floor128d(double *src, double *dst, int len);
+void trunc128d(double *src, double *dst, int len);
+void vectorSlope128d(double *dst, int len, double offset, double slope);
+void cplxtoreal128d(complex64_t *src, double *dstRe, double *dstIm, int len);
+void realtocplx128d(double *srcRe, double *srcIm, complex64_t *dst, int len);
+void sincos128d(double *src, double *dst_sin, double *dst_cos, int len);
+void sincos128d_interleaved(double *src, complex64_t *dst, int len);
+void atan128d(double *src, double *dst, int len);
+void atan2128d(double *src1, double *src2, double *dst, int len);
+void atan2128d_interleaved(complex64_t *src, double *dst, int len);
+void asin128d(double *src, double *dst, int len);
+void asin128d_(double *src, double *dst, int len);
+void pol2cart2D128f_precise(float *r, float *theta, float *x, float *y, int len);
+void cart2pol2D128f_precise(float *x, float *y, float *r, float *theta, int len);
+void exp128d(double *src, double *dst, int len);
+void ln128d(double *src, double *dst, int len);
+void tan128d(double *src, double *dst, int len);
+void pow128d(double *x, double *y, double *dst, int len);
+void log2128d(double *src, double *dst, int len);
+void log10128d(double *src, double *dst, int len);
+void sinh128d(double *src, double *dst, int len);
+void cosh128d(double *src, double *dst, int len);
+void tanh128d(double *src, double *dst, int len);
+void asinh128d(double *src, double *dst, int len);
+void acosh128d(double *src, double *dst, int len);
+void atanh128d(double *src, double *dst, int len);
+void cbrt128d(double *src, double *dst, int len);
+void acos128d(double *src, double *dst, int len);
+void sigmoid128d(double *src, double *dst, int len);
+void powcplx128d(complex64_t *x, complex64_t *y, complex64_t *dst, int len);
+void fft128d_split(fft_plan64_t *plan, double *srcRe, double *srcIm, double *dstRe, double *dstIm);
+void ifft128d_split(fft_plan64_t *plan, double *srcRe, double *srcIm, double *dstRe, double *dstIm);
+void fft128d(fft_plan64_t *plan, complex64_t *src, complex64_t *dst);
+void ifft128d(fft_plan64_t *plan, complex64_t *src, complex64_t *dst);
+void rfft128d(fft_plan64_t *plan, double *src, complex64_t *dst);
+void irfft128d(fft_plan64_t *plan, complex64_t *src, double *dst);
+void cplxvecmul128d(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len);
+void cplxvecmul128d_split(double *src1Re, double *src1Im, double *src2Re, double *src2Im, double *dstRe, double *dstIm, int len);
+void cplxconjvecmul128d(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len);
+void cplxconjvecmul128d_split(double *src1Re, double *src1Im, double *src2Re, double *src2Im, double *dstRe, double *dstIm, int len);
+void cplxvecdiv128d(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len);
+void cplxvecdiv128d_split(double *src1Re, double *src1Im, double *src2Re, double *src2Im, double *dstRe, double *dstIm, int len);
+void cplxconj128d(complex64_t *src, complex64_t *dst, int len);
+void magnitude128d_split(double *srcRe, double *srcIm, double *dst, int len);
+void magnitude128d_interleaved(complex64_t *src, double *dst, int len);
+void powerspect128d_split(double *srcRe, double *srcIm, double *dst, int len);
+void powerspect128d_interleaved(complex64_t *src, double *dst, int len);
+int conv128d(conv64_t *conv, double *src, double *dst, int len);
+void minmax128d(double *src, int len, double *min_value, double *max_value);
+void softmax128d(double *src, double *dst, int len);
+void maxloc128d(double *src, double *max, int *idx, int len);
+void minloc128d(double *src, double *min, int *idx, int len);
+void minmaxloc128d(double *src, int len, double *min_value, int *min_idx, double *max_value, int *max_idx);
+void maxevery128d(double *src1, double *src2, double *dst, int len);
+void minevery128d(double *src1, double *src2, double *dst, int len);
+void threshold128_gt_d(double *src, double *dst, int len, double value);
+void threshold128_gtabs_d(double *src, double *dst, int len, double value);
+void threshold128_lt_d(double *src, double *dst, int len, double value);
+void threshold128_ltabs_d(double *src, double *dst, int len, double value);
+void threshold128_ltval_gtval_d(double *src, double *dst, int len, double ltlevel, double ltvalue, double gtlevel, double gtvalue);
+void sum128d(double *src, double *dst, int len);
+void mean128d(double *src, double *dst, int len);
+void dot128d(double *src1, double *src2, int len, double *dst);
+void dotc128d(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst);
+void sumkahan128d(double *src, double *dst, int len);
+void meankahan128d(double *src, double *dst, int len);
+void dotkahan128d(double *src1, double *src2, int len, double *dst);
+void dotckahan128d(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst);
+void sumpairwise128d(double *src, double *dst, int len);
+void meanpairwise128d(double *src, double *dst, int len);
+void dotpairwise128d(double *src1, double *src2, int len, double *dst);
+void dotcpairwise128d(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst);
+void moments128d(double *src, int len, moments_t *m);
+void prefixsum128d(double *src, double *dst, int len, double *carry);
+void prefixsum128d_excl(double *src, double *dst, int len, double *carry);
+void diff128d(double *src, double *dst, int len, double *prev);
+void sort128d(double *src, int len);
+#endif
+
+// simd_utils_sse_float.h
+#if defined(SSE)
+void log10128f(float *src, float *dst, int len);
+void log10128f_precise(float *src, float *dst, int len);
+void log2128f(float *src, float *dst, int len);
+void log2128f_precise(float *src, float *dst, int len);
+void ln128f(float *src, float *dst, int len);
+void exp128f(float *src, float *dst, int len);
+void exp128f_(float *src, float *dst, int len);
+void cbrt128f(float *src, float *dst, int len);
+void fabs128f(float *src, float *dst, int len);
+void set128f(float *dst, float value, int len);
+void zero128f(float *dst, int len);
+void copy128f(float *src, float *dst, int len);
+void add128f(float *src1, float *src2, float *dst, int len);
+void mul128f(float *src1, float *src2, float *dst, int len);
+void sub128f(float *src1, float *src2, float *dst, int len);
+void addc128f(float *src, float value, float *dst, int len);
+void mulc128f(float *src, float value, float *dst, int len);
+void muladd128f(float *_a, float *_b, float *_c, float *dst, int len);
+void mulcadd128f(float *_a, float _b, float *_c, float *dst, int len);
+void mulcaddc128f(float *_a, float _b, float _c, float *dst, int len);
+void muladdc128f(float *_a, float *_b, float _c, float *dst, int len);
+void div128f(float *src1, float *src2, float *dst, int len);
+void vectorSlope128f(float *dst, int len, float offset, float slope);
+void convertFloat32ToU8_128(float *src, uint8_t *dst, int len, int rounding_mode, int scale_factor);
+void convertFloat32ToI16_128(float *src, int16_t *dst, int len, int rounding_mode, int scale_factor);
+void convertFloat32ToU16_128(float *src, uint16_t *dst, int len, int rounding_mode, int scale_factor);
+void convertInt16ToFloat32_128(int16_t *src, float *dst, int len, int scale_factor);
+void convertInt32ToFloat32_128(int32_t *src, float *dst, int len, int scale_factor);
+void cplxtoreal128f(complex32_t *src, float *dstRe, float *dstIm, int len);
+void realtocplx128f(float *srcRe, float *srcIm, complex32_t *dst, int len);
+void convert128_64f32f(double *src, float *dst, int len);
+void convert128_32f64f(float *src, double *dst, int len);
+void flip128f(float *src, float *dst, int len);
+void maxevery128f(float *src1, float *src2, float *dst, int len);
+void minevery128f(float *src1, float *src2, float *dst, int len);
+void minmax128f(float *src, int len, float *min_value, float *max_value);
+void threshold128_gt_f(float *src, float *dst, int len, float value);
+void threshold128_gtabs_f(float *src, float *dst, int len, float value);
+void threshold128_lt_f(float *src, float *dst, int len, float value);
+void threshold128_ltabs_f(float *src, float *dst, int len, float value);
+void threshold128_ltval_gtval_f(float *src, float *dst, int len, float ltlevel, float ltvalue, float gtlevel, float gtvalue);
+void sin128f(float *src, float *dst, int len);
+void cos128f(float *src, float *dst, int len);
+void sincos128f(float *src, float *dst_sin, float *dst_cos, int len);
+void sincos128f_interleaved(float *src, complex32_t *dst, int len);
+void cosh128f(float *src, float *dst, int len);
+void sinh128f(float *src, float *dst, int len);
+void acosh128f(float *src, float *dst, int len);
+void asinh128f(float *src, float *dst, int len);
+void atanh128f(float *src, float *dst, int len);
+void atan128f(float *src, float *dst, int len);
+void atan2128f(float *src1, float *src2, float *dst, int len);
+void atan2128f_interleaved(complex32_t *src, float *dst, int len);
+void asin128f(float *src, float *dst, int len);
+void tanh128f(float *src, float *dst, int len);
+void tan128f(float *src, float *dst, int len);
+void tan128f_naive(float *src, float *dst, int len);
+void magnitude128f_split(float *srcRe, float *srcIm, float *dst, int len);
+void powerspect128f_split(float *srcRe, float *srcIm, float *dst, int len);
+void magnitude128f_interleaved(complex32_t *src, float *dst, int len);
+void powerspect128f_interleaved(complex32_t *src, float *dst, int len);
+void subcrev128f(float *src, float value, float *dst, int len);
+void sum128f(float *src, float *dst, int len);
+void mean128f(float *src, float *dst, int len);
+void dot128f(float *src1, float *src2, int len, float *dst);
+void dotc128f(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst);
+void sumkahan128f(float *src, float *dst, int len);
+void meankahan128f(float *src, float *dst, int len);
+void dotkahan128f(float *src1, float *src2, int len, float *dst);
+void dotckahan128f(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst);
+void sumpairwise128f(float *src, float *dst, int len);
+void meanpairwise128f(float *src, float *dst, int len);
+void dotpairwise128f(float *src1, float *src2, int len, float *dst);
+void dotcpairwise128f(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst);
+void moments128f(float *src, int len, moments_t *m);
+void prefixsum128f(float *src, float *dst, int len, float *carry);
+void prefixsum128f_excl(float *src, float *dst, int len, float *carry);
+void diff128f(float *src, float *dst, int len, float *prev);
+void histogram128f(float *src, int len, float low, float high, int nb_bins, uint32_t *hist);
+void histogram128f_edges(float *src, int len, float *edges, int nb_bins, uint32_t *hist);
+void sort128f(float *src, int len);
+void sort128f_kv(float *keys, int32_t *values, int len);
+void topk128f(float *src, int len, int k, float *dst, int32_t *idx);
+void bottomk128f(float *src, int len, int k, float *dst, int32_t *idx);
+void partialsort128f(float *src, int len, int k);
+void sqrt128f(float *src, float *dst, int len);
+void rint128f(float *src, float *dst, int len);
+void round128f(float *src, float *dst, int len);
+void ceil128f(float *src, float *dst, int len);
+void floor128f(float *src, float *dst, int len);
+void trunc128f(float *src, float *dst, int len);
+void cplxvecdiv128f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len);
+void cplxvecmul128f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len);
+void cplxvecmul128f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len);
+void cplxvecdiv128f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len);
+void cplxconjvecmul128f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len);
+void cplxconjvecmul128f_kahan(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len);
+void cplxconjvecmul128f_precise(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len);
+void cplxconjvecmul128f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len);
+void cplxconjvecmul128f_split_kahan(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len);
+void cplxconjvecmul128f_split_precise(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len);
+void cplxconj128f(complex32_t *src, complex32_t *dst, int len);
+void sigmoid128f(float *src, float *dst, int len);
+void sigmoid128f_(float *src, float *dst, int len);
+void PRelu128f(float *src, float *dst, float alpha, int len);
+void softmax128f(float *src, float *dst, int len);
+void softmax128f_dualacc(float *src, float *dst, int len);
+void pol2cart2D128f(float *r, float *theta, float *x, float *y, int len);
+void cart2pol2D128f(float *x, float *y, float *r, float *theta, int len);
+void modf128f(float *src, float *integer, float *remainder, int len);
+void pow128f(float *x, float *y, float *dst, int len);
+void pow128f_precise(float *x, float *y, float *dst, int len);
+void powcplx128f(complex32_t *x, complex32_t *y, complex32_t *dst, int len);
+void pipeline_apply128f(const pipeline_op_t *op, float *in, float *out, int offset, int len);
+void pipeline128f(float *src, float *dst, int len, const pipeline_op_t *ops, int nb_ops);
+void pipeline128f_sum(float *src, float *dst, int len, const pipeline_op_t *ops, int nb_ops);
+void fft128f_split(fft_plan32_t *plan, float *srcRe, float *srcIm, float *dstRe, float *dstIm);
+void ifft128f_split(fft_plan32_t *plan, float *srcRe, float *srcIm, float *dstRe, float *dstIm);
+void fft128f(fft_plan32_t *plan, complex32_t *src, complex32_t *dst);
+void ifft128f(fft_plan32_t *plan, complex32_t *src, complex32_t *dst);
+void rfft128f(fft_plan32_t *plan, float *src, complex32_t *dst);
+void irfft128f(fft_plan32_t *plan, complex32_t *src, float *dst);
+int fir128f(fir32_t *fir, float *src, float *dst, int len);
+int fir128f_cplx(fir32_t *fir, complex32_t *src, complex32_t *dst, int len);
+int fir128f_split(fir32_t *fir, float *srcRe, float *srcIm, float *dstRe, float *dstIm, int len);
+void iir128f(iir32_t *iir, float *src, float *dst, int len);
+int conv128f(conv32_t *conv, float *src, float *dst, int len);
+int conv128f_cplx(conv32_t *conv, complex32_t *src, complex32_t *dst, int len);
+void maxloc128f(float *src, float *max, int *idx, int len);
+void minloc128f(float *src, float *min, int *idx, int len);
+void minmaxloc128f(float *src, int len, float *min_value, int *min_idx, float *max_value, int *max_idx);
+#endif
+
+// simd_utils_sse_int32.h
+#if defined(SSE)
+void add128s(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void mul128s(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void sub128s(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void addc128s(int32_t *src, int32_t value, int32_t *dst, int len);
+void vectorSlope128s(int *dst, int len, int offset, int slope);
+void sum128s(int32_t *src, int32_t *dst, int len);
+void copy128s(int32_t *src, int32_t *dst, int len);
+void copy128s_2(int32_t *src, int32_t *dst, int len);
+void fast_copy128s(int32_t *src, int32_t *dst, int len);
+void fast_copy128s_2(int32_t *src, int32_t *dst, int len);
+void fast_copy128s_4(int32_t *src, int32_t *dst, int len);
+void absdiff16s_128s(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void addsat16s_128s(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void subsat16s_128s(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void mulhi16s_128s(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void mulhrs16s_128s(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void maxevery16s_128s(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void minevery16s_128s(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void abs16s_128s(int16_t *src, int16_t *dst, int len);
+void threshold_gt16s_128s(int16_t *src, int16_t *dst, int len, int16_t value);
+void threshold_lt16s_128s(int16_t *src, int16_t *dst, int len, int16_t value);
+void addsatu8_128(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len);
+void subsatu8_128(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len);
+void absdiffu8_128(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len);
+void maxeveryu8_128(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len);
+void mineveryu8_128(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len);
+void threshold_gtu8_128(uint8_t *src, uint8_t *dst, int len, uint8_t value);
+void threshold_ltu8_128(uint8_t *src, uint8_t *dst, int len, uint8_t value);
+void convertInt16ToU8_128(int16_t *src, uint8_t *dst, int len, int scale_factor);
+void convertU8ToInt16_128(uint8_t *src, int16_t *dst, int len, int scale_factor);
+void add64s_128s(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void sub64s_128s(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void mul64s_128s(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void sum64s_128s(int64_t *src, int64_t *dst, int len);
+void maxevery64s_128s(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void minevery64s_128s(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void maxeveryu64_128(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len);
+void mineveryu64_128(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len);
+void minmax64s_128s(int64_t *src, int len, int64_t *min_value, int64_t *max_value);
+void minmaxu64_128(uint64_t *src, int len, uint64_t *min_value, uint64_t *max_value);
+void cmpeq64s_128s(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void cmpgt64s_128s(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void cmpgtu64_128(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len);
+void sll64s_128s(int64_t *src, int64_t *dst, int len, int shift);
+void sra64s_128s(int64_t *src, int64_t *dst, int len, int shift);
+void srlu64_128(uint64_t *src, uint64_t *dst, int len, int shift);
+void powerspect16s_128s_interleaved(complex16s_t *src, int32_t *dst, int len);
+void sum16s32s128(int16_t *src, int len, int32_t *dst, int scale_factor);
+void flip128s(int32_t *src, int32_t *dst, int len);
+void maxevery128s(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void minevery128s(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void minmax128s(int32_t *src, int len, int32_t *min_value, int32_t *max_value);
+void threshold128_gt_s(int32_t *src, int32_t *dst, int len, int32_t value);
+void threshold128_gtabs_s(int32_t *src, int32_t *dst, int len, int32_t value);
+void threshold128_lt_s(int32_t *src, int32_t *dst, int len, int32_t value);
+void threshold128_ltabs_s(int32_t *src, int32_t *dst, int len, int32_t value);
+void threshold128_ltval_gtval_s(int32_t *src, int32_t *dst, int len, int32_t ltlevel, int32_t ltvalue, int32_t gtlevel, int32_t gtvalue);
+void maxloc128s(int32_t *src, int32_t *max, int *idx, int len);
+void minloc128s(int32_t *src, int32_t *min, int *idx, int len);
+void minmaxloc128s(int32_t *src, int len, int32_t *min_value, int *min_idx, int32_t *max_value, int *max_idx);
+void minmax16s_128s(int16_t *src, int len, int16_t *min_value, int16_t *max_value);
+void maxloc16s_128s(int16_t *src, int16_t *max, int *idx, int len);
+void minloc16s_128s(int16_t *src, int16_t *min, int *idx, int len);
+void minmaxloc16s_128s(int16_t *src, int len, int16_t *min_value, int *min_idx, int16_t *max_value, int *max_idx);
+void histogram128s(int32_t *src, int len, int32_t low, int shift, int nb_bins, uint32_t *hist);
+void histogram16s_128s(int16_t *src, int len, int16_t low, int shift, int nb_bins, uint32_t *hist);
+void histogramu8_128(uint8_t *src, int len, uint32_t *hist);
+void prefixsum128s(int32_t *src, int32_t *dst, int len, int32_t *carry);
+void prefixsum128s_excl(int32_t *src, int32_t *dst, int len, int32_t *carry);
+void diff128s(int32_t *src, int32_t *dst, int len, int32_t *prev);
+void prefixsum16s_128s(int16_t *src, int16_t *dst, int len, int16_t *carry);
+void prefixsum16s_128s_excl(int16_t *src, int16_t *dst, int len, int16_t *carry);
+void diff16s_128s(int16_t *src, int16_t *dst, int len, int16_t *prev);
+void sort128s(int32_t *src, int len);
+void topk128s(int32_t *src, int len, int k, int32_t *dst, int32_t *idx);
+void bottomk128s(int32_t *src, int len, int k, int32_t *dst, int32_t *idx);
+void partialsort128s(int32_t *src, int len, int k);
+#endif
+
+// simd_utils_sse_strings.h
+#if defined(SSE)
+size_t strnlen_s_128(const char *s, size_t maxlen);
+#endif
+
+// simd_utils_avx_double.h
+#if defined(AVX)
+void set256d(double *dst, double value, int len);
+void zero256d(double *dst, int len);
+void copy256d(double *src, double *dst, int len);
+void sqrt256d(double *src, double *dst, int len);
+void fabs256d(double *src, double *dst, int len);
+void add256d(double *src1, double *src2, double *dst, int len);
+void mul256d(double *src1, double *src2, double *dst, int len);
+void sub256d(double *src1, double *src2, double *dst, int len);
+void div256d(double *src1, double *src2, double *dst, int len);
+void addc256d(double *src, double value, double *dst, int len);
+void mulc256d(double *src, double value, double *dst, int len);
+void muladd256d(double *_a, double *_b, double *_c, double *dst, int len);
+void mulcadd256d(double *_a, double _b, double *_c, double *dst, int len);
+void mulcaddc256d(double *_a, double _b, double _c, double *dst, int len);
+void muladdc256d(double *_a, double *_b, double _c, double *dst, int len);
+void rint256d(double *src, double *dst, int len);
+void round256d(double *src, double *dst, int len);
+void ceil256d(double *src, double *dst, int len);
+void floor256d(double *src, double *dst, int len);
+void trunc256d(double *src, double *dst, int len);
+void vectorSlope256d(double *dst, int len, double offset, double slope);
+void cplxtoreal256d(complex64_t *src, double *dstRe, double *dstIm, int len);
+void realtocplx256d(double *srcRe, double *srcIm, complex64_t *dst, int len);
+void asin256d(double *src, double *dst, int len);
+void atan256d(double *src, double *dst, int len);
+void atan2256d(double *src1, double *src2, double *dst, int len);
+void atan2256d_interleaved(complex64_t *src, double *dst, int len);
+#endif
+#if defined(AVX) && (defined(__AVX2__) || defined(DISPATCH))
+void sincos256d(double *src, double *dst_sin, double *dst_cos, int len);
+void sincos256d_interleaved(double *src, complex64_t *dst, int len);
+void pol2cart2D256f_precise(float *r, float *theta, float *x, float *y, int len);
+void cart2pol2D256f_precise(float *x, float *y, float *r, float *theta, int len);
+void exp256d(double *src, double *dst, int len);
+void ln256d(double *src, double *dst, int len);
+void tan256d(double *src, double *dst, int len);
+#endif
+#if defined(AVX)
+void pow256d(double *x, double *y, double *dst, int len);
+#endif
+#if defined(AVX) && (defined(__AVX2__) || defined(DISPATCH))
+void log2256d(double *src, double *dst, int len);
+void log10256d(double *src, double *dst, int len);
+void sinh256d(double *src, double *dst, int len);
+void cosh256d(double *src, double *dst, int len);
+void tanh256d(double *src, double *dst, int len);
+void asinh256d(double *src, double *dst, int len);
+void acosh256d(double *src, double *dst, int len);
+void atanh256d(double *src, double *dst, int len);
+void cbrt256d(double *src, double *dst, int len);
+void acos256d(double *src, double *dst, int len);
+void sigmoid256d(double *src, double *dst, int len);
+#endif
+#if defined(AVX)
+void powcplx256d(complex64_t *x, complex64_t *y, complex64_t *dst, int len);
+void fft256d_split(fft_plan64_t *plan, double *srcRe, double *srcIm, double *dstRe, double *dstIm);
+void ifft256d_split(fft_plan64_t *plan, double *srcRe, double *srcIm, double *dstRe, double *dstIm);
+void fft256d(fft_plan64_t *plan, complex64_t *src, complex64_t *dst);
+void ifft256d(fft_plan64_t *plan, complex64_t *src, complex64_t *dst);
+void rfft256d(fft_plan64_t *plan, double *src, complex64_t *dst);
+void irfft256d(fft_plan64_t *plan, complex64_t *src, double *dst);
+void cplxvecmul256d(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len);
+void cplxvecmul256d_split(double *src1Re, double *src1Im, double *src2Re, double *src2Im, double *dstRe, double *dstIm, int len);
+void cplxconjvecmul256d(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len);
+void cplxconjvecmul256d_split(double *src1Re, double *src1Im, double *src2Re, double *src2Im, double *dstRe, double *dstIm, int len);
+void cplxvecdiv256d(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len);
+void cplxvecdiv256d_split(double *src1Re, double *src1Im, double *src2Re, double *src2Im, double *dstRe, double *dstIm, int len);
+void cplxconj256d(complex64_t *src, complex64_t *dst, int len);
+void magnitude256d_split(double *srcRe, double *srcIm, double *dst, int len);
+void magnitude256d_interleaved(complex64_t *src, double *dst, int len);
+void powerspect256d_split(double *srcRe, double *srcIm, double *dst, int len);
+void powerspect256d_interleaved(complex64_t *src, double *dst, int len);
+int conv256d(conv64_t *conv, double *src, double *dst, int len);
+void minmax256d(double *src, int len, double *min_value, double *max_value);
+#endif
+#if defined(AVX) && (defined(__AVX2__) || defined(DISPATCH))
+void softmax256d(double *src, double *dst, int len);
+#endif
+#if defined(AVX)
+void maxloc256d(double *src, double *max, int *idx, int len);
+void minloc256d(double *src, double *min, int *idx, int len);
+void minmaxloc256d(double *src, int len, double *min_value, int *min_idx, double *max_value, int *max_idx);
+void maxevery256d(double *src1, double *src2, double *dst, int len);
+void minevery256d(double *src1, double *src2, double *dst, int len);
+void threshold256_gt_d(double *src, double *dst, int len, double value);
+void threshold256_gtabs_d(double *src, double *dst, int len, double value);
+void threshold256_lt_d(double *src, double *dst, int len, double value);
+void threshold256_ltabs_d(double *src, double *dst, int len, double value);
+void threshold256_ltval_gtval_d(double *src, double *dst, int len, double ltlevel, double ltvalue, double gtlevel, double gtvalue);
+void sum256d(double *src, double *dst, int len);
+void mean256d(double *src, double *dst, int len);
+void dot256d(double *src1, double *src2, int len, double *dst);
+void dotc256d(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst);
+void sumkahan256d(double *src, double *dst, int len);
+void meankahan256d(double *src, double *dst, int len);
+void dotkahan256d(double *src1, double *src2, int len, double *dst);
+void dotckahan256d(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst);
+void sumpairwise256d(double *src, double *dst, int len);
+void meanpairwise256d(double *src, double *dst, int len);
+void dotpairwise256d(double *src1, double *src2, int len, double *dst);
+void dotcpairwise256d(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst);
+void moments256d(double *src, int len, moments_t *m);
+void prefixsum256d(double *src, double *dst, int len, double *carry);
+void prefixsum256d_excl(double *src, double *dst, int len, double *carry);
+void diff256d(double *src, double *dst, int len, double *prev);
+#endif
+#if defined(AVX) && (defined(__AVX2__) || defined(DISPATCH))
+void sort256d(double *src, int len);
+#endif
+
+// simd_utils_avx_float.h
+#if defined(AVX)
+void log10256f(float *src, float *dst, int len);
+void log10256f_precise(float *src, float *dst, int len);
+void log2256f(float *src, float *dst, int len);
+void log2256f_precise(float *src, float *dst, int len);
+void ln256f(float *src, float *dst, int len);
+void exp256f(float *src, float *dst, int len);
+#endif
+#if defined(AVX) && (defined(__AVX2__) || defined(DISPATCH))
+void cbrt256f(float *src, float *dst, int len);
+#endif
+#if defined(AVX)
+void fabs256f(float *src, float *dst, int len);
+void set256f(float *dst, float value, int len);
+void zero256f(float *dst, int len);
+void copy256f(float *src, float *dst, int len);
+void add256f(float *src1, float *src2, float *dst, int len);
+void mul256f(float *src1, float *src2, float *dst, int len);
+void sub256f(float *src1, float *src2, float *dst, int len);
+void addc256f(float *src, float value, float *dst, int len);
+void mulc256f(float *src, float value, float *dst, int len);
+void muladd256f(float *_a, float *_b, float *_c, float *dst, int len);
+void mulcadd256f(float *_a, float _b, float *_c, float *dst, int len);
+void mulcaddc256f(float *_a, float _b, float _c, float *dst, int len);
+void muladdc256f(float *_a, float *_b, float _c, float *dst, int len);
+void div256f(float *src1, float *src2, float *dst, int len);
+void vectorSlope256f(float *dst, int len, float offset, float slope);
+#endif
+#if defined(AVX) && (defined(__AVX2__) || defined(DISPATCH))
+void convertInt16ToFloat32_256(int16_t *src, float *dst, int len, int scale_factor);
+void convertInt32ToFloat32_256(int32_t *src, float *dst, int len, int scale_factor);
+void convertFloat32ToU8_256(float *src, uint8_t *dst, int len, int rounding_mode, int scale_factor);
+void convertFloat32ToI16_256(float *src, int16_t *dst, int len, int rounding_mode, int scale_factor);
+void convertFloat32ToU16_256(float *src, uint16_t *dst, int len, int rounding_mode, int scale_factor);
+#endif
+#if defined(AVX)
+void cplxtoreal256f(complex32_t *src, float *dstRe, float *dstIm, int len);
+void realtocplx256f(float *srcRe, float *srcIm, complex32_t *dst, int len);
+void convert256_64f32f(double *src, float *dst, int len);
+void convert256_32f64f(float *src, double *dst, int len);
+void flip256f(float *src, float *dst, int len);
+void maxevery256f(float *src1, float *src2, float *dst, int len);
+void minevery256f(float *src1, float *src2, float *dst, int len);
+void minmax256f(float *src, int len, float *min_value, float *max_value);
+void threshold256_gt_f(float *src, float *dst, int len, float value);
+void threshold256_gtabs_f(float *src, float *dst, int len, float value);
+void threshold256_lt_f(float *src, float *dst, int len, float value);
+void threshold256_ltabs_f(float *src, float *dst, int len, float value);
+void threshold256_ltval_gtval_f(float *src, float *dst, int len, float ltlevel, float ltvalue, float gtlevel, float gtvalue);
+void sin256f(float *src, float *dst, int len);
+void cos256f(float *src, float *dst, int len);
+void sincos256f(float *src, float *dst_sin, float *dst_cos, int len);
+void sincos256f_interleaved(float *src, complex32_t *dst, int len);
+void acosh256f(float *src, float *dst, int len);
+void asinh256f(float *src, float *dst, int len);
+void atanh256f(float *src, float *dst, int len);
+void cosh256f(float *src, float *dst, int len);
+void sinh256f(float *src, float *dst, int len);
+void atan256f(float *src, float *dst, int len);
+void atan2256f(float *src1, float *src2, float *dst, int len);
+void atan2256f_interleaved(complex32_t *src, float *dst, int len);
+void asin256f(float *src, float *dst, int len);
+void tanh256f(float *src, float *dst, int len);
+void tan256f(float *src, float *dst, int len);
+void magnitude256f_split(float *srcRe, float *srcIm, float *dst, int len);
+void powerspect256f_split(float *srcRe, float *srcIm, float *dst, int len);
+void magnitude256f_interleaved(complex32_t *src, float *dst, int len);
+void powerspect256f_interleaved(complex32_t *src, float *dst, int len);
+void subcrev256f(float *src, float value, float *dst, int len);
+void sum256f(float *src, float *dst, int len);
+void mean256f(float *src, float *dst, int len);
+void dot256f(float *src1, float *src2, int len, float *dst);
+void dotc256f(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst);
+void sumkahan256f(float *src, float *dst, int len);
+void meankahan256f(float *src, float *dst, int len);
+void dotkahan256f(float *src1, float *src2, int len, float *dst);
+void dotckahan256f(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst);
+void sumpairwise256f(float *src, float *dst, int len);
+void meanpairwise256f(float *src, float *dst, int len);
+void dotpairwise256f(float *src1, float *src2, int len, float *dst);
+void dotcpairwise256f(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst);
+void moments256f(float *src, int len, moments_t *m);
+void prefixsum256f(float *src, float *dst, int len, float *carry);
+void prefixsum256f_excl(float *src, float *dst, int len, float *carry);
+void diff256f(float *src, float *dst, int len, float *prev);
+#endif
+#if defined(AVX) && (defined(__AVX2__) || defined(DISPATCH))
+void histogram256f(float *src, int len, float low, float high, int nb_bins, uint32_t *hist);
+void histogram256f_edges(float *src, int len, float *edges, int nb_bins, uint32_t *hist);
+void sort256f(float *src, int len);
+void sort256f_kv(float *keys, int32_t *values, int len);
+void topk256f(float *src, int len, int k, float *dst, int32_t *idx);
+void bottomk256f(float *src, int len, int k, float *dst, int32_t *idx);
+void partialsort256f(float *src, int len, int k);
+#endif
+#if defined(AVX)
+void sqrt256f(float *src, float *dst, int len);
+void rint256f(float *src, float *dst, int len);
+void round256f(float *src, float *dst, int len);
+void ceil256f(float *src, float *dst, int len);
+void floor256f(float *src, float *dst, int len);
+void trunc256f(float *src, float *dst, int len);
+void cplxvecdiv256f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len);
+void cplxvecdiv256f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len);
+void cplxvecmul256f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len);
+void cplxvecmul256f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len);
+void cplxconjvecmul256f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len);
+void cplxconjvecmul256f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len);
+void cplxconj256f(complex32_t *src, complex32_t *dst, int len);
+void sigmoid256f(float *src, float *dst, int len);
+void PRelu256f(float *src, float *dst, float alpha, int len);
+void softmax256f(float *src, float *dst, int len);
+void pol2cart2D256f(float *r, float *theta, float *x, float *y, int len);
+void cart2pol2D256f(float *x, float *y, float *r, float *theta, int len);
+void modf256f(float *src, float *integer, float *remainder, int len);
+void fp32tofp16128(float* src, uint16_t* dst, size_t len);
+void fp32tofp16256(float* src, uint16_t* dst, size_t len);
+void fp16tofp32128(uint16_t* src, float* dst, size_t len);
+void fp16tofp32256(uint16_t* src, float* dst, size_t len);
+void pow256f(float *x, float *y, float *dst, int len);
+void powcplx256f(complex32_t *x, complex32_t *y, complex32_t *dst, int len);
+void pipeline_apply256f(const pipeline_op_t *op, float *in, float *out, int offset, int len);
+void pipeline256f(float *src, float *dst, int len, const pipeline_op_t *ops, int nb_ops);
+void pipeline256f_sum(float *src, float *dst, int len, const pipeline_op_t *ops, int nb_ops);
+void fft256f_split(fft_plan32_t *plan, float *srcRe, float *srcIm, float *dstRe, float *dstIm);
+void ifft256f_split(fft_plan32_t *plan, float *srcRe, float *srcIm, float *dstRe, float *dstIm);
+void fft256f(fft_plan32_t *plan, complex32_t *src, complex32_t *dst);
+void ifft256f(fft_plan32_t *plan, complex32_t *src, complex32_t *dst);
+void rfft256f(fft_plan32_t *plan, float *src, complex32_t *dst);
+void irfft256f(fft_plan32_t *plan, complex32_t *src, float *dst);
+int fir256f(fir32_t *fir, float *src, float *dst, int len);
+int fir256f_cplx(fir32_t *fir, complex32_t *src, complex32_t *dst, int len);
+int fir256f_split(fir32_t *fir, float *srcRe, float *srcIm, float *dstRe, float *dstIm, int len);
+void iir256f(iir32_t *iir, float *src, float *dst, int len);
+int conv256f(conv32_t *conv, float *src, float *dst, int len);
+int conv256f_cplx(conv32_t *conv, complex32_t *src, complex32_t *dst, int len);
+void maxloc256f(float *src, float *max, int *idx, int len);
+void minloc256f(float *src, float *min, int *idx, int len);
+void minmaxloc256f(float *src, int len, float *min_value, int *min_idx, float *max_value, int *max_idx);
+#endif
+
+// simd_utils_avx_int32.h
+#if defined(AVX) && (defined(__AVX2__) || defined(DISPATCH))
+void add256s(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void mul256s(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void sub256s(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void addc256s(int32_t *src, int32_t value, int32_t *dst, int len);
+void vectorSlope256s(int *dst, int len, int offset, int slope);
+void copy256s(int32_t *src, int32_t *dst, int len);
+void copy256s_2(int32_t *src, int32_t *dst, int len);
+void fast_copy256s(int32_t *src, int32_t *dst, int len);
+void fast_copy256s_2(int32_t *src, int32_t *dst, int len);
+void fast_copy256s_4(int32_t *src, int32_t *dst, int len);
+void absdiff16s_256s(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void addsat16s_256s(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void subsat16s_256s(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void mulhi16s_256s(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void mulhrs16s_256s(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void maxevery16s_256s(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void minevery16s_256s(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void abs16s_256s(int16_t *src, int16_t *dst, int len);
+void threshold_gt16s_256s(int16_t *src, int16_t *dst, int len, int16_t value);
+void threshold_lt16s_256s(int16_t *src, int16_t *dst, int len, int16_t value);
+void addsatu8_256(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len);
+void subsatu8_256(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len);
+void absdiffu8_256(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len);
+void maxeveryu8_256(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len);
+void mineveryu8_256(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len);
+void threshold_gtu8_256(uint8_t *src, uint8_t *dst, int len, uint8_t value);
+void threshold_ltu8_256(uint8_t *src, uint8_t *dst, int len, uint8_t value);
+void convertInt16ToU8_256(int16_t *src, uint8_t *dst, int len, int scale_factor);
+void convertU8ToInt16_256(uint8_t *src, int16_t *dst, int len, int scale_factor);
+void add64s_256s(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void sub64s_256s(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void mul64s_256s(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void sum64s_256s(int64_t *src, int64_t *dst, int len);
+void maxevery64s_256s(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void minevery64s_256s(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void maxeveryu64_256(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len);
+void mineveryu64_256(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len);
+void minmax64s_256s(int64_t *src, int len, int64_t *min_value, int64_t *max_value);
+void minmaxu64_256(uint64_t *src, int len, uint64_t *min_value, uint64_t *max_value);
+void cmpeq64s_256s(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void cmpgt64s_256s(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void cmpgtu64_256(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len);
+void sll64s_256s(int64_t *src, int64_t *dst, int len, int shift);
+void sra64s_256s(int64_t *src, int64_t *dst, int len, int shift);
+void srlu64_256(uint64_t *src, uint64_t *dst, int len, int shift);
+void powerspect16s_256s_interleaved(complex16s_t *src, int32_t *dst, int len);
+void sum16s32s256(int16_t *src, int len, int32_t *dst, int scale_factor);
+void flip256s(int32_t *src, int32_t *dst, int len);
+void maxevery256s(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void minevery256s(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void minmax256s(int32_t *src, int len, int32_t *min_value, int32_t *max_value);
+void threshold256_gt_s(int32_t *src, int32_t *dst, int len, int32_t value);
+void threshold256_gtabs_s(int32_t *src, int32_t *dst, int len, int32_t value);
+void threshold256_lt_s(int32_t *src, int32_t *dst, int len, int32_t value);
+void threshold256_ltabs_s(int32_t *src, int32_t *dst, int len, int32_t value);
+void threshold256_ltval_gtval_s(int32_t *src, int32_t *dst, int len, int32_t ltlevel, int32_t ltvalue, int32_t gtlevel, int32_t gtvalue);
+void gatheri_256s(int32_t *src, int32_t *dst, int stride, int offset, int len);
+void maxloc256s(int32_t *src, int32_t *max, int *idx, int len);
+void minloc256s(int32_t *src, int32_t *min, int *idx, int len);
+void minmaxloc256s(int32_t *src, int len, int32_t *min_value, int *min_idx, int32_t *max_value, int *max_idx);
+void minmax16s_256s(int16_t *src, int len, int16_t *min_value, int16_t *max_value);
+void maxloc16s_256s(int16_t *src, int16_t *max, int *idx, int len);
+void minloc16s_256s(int16_t *src, int16_t *min, int *idx, int len);
+void minmaxloc16s_256s(int16_t *src, int len, int16_t *min_value, int *min_idx, int16_t *max_value, int *max_idx);
+void histogram256s(int32_t *src, int len, int32_t low, int shift, int nb_bins, uint32_t *hist);
+void histogram16s_256s(int16_t *src, int len, int16_t low, int shift, int nb_bins, uint32_t *hist);
+void histogramu8_256(uint8_t *src, int len, uint32_t *hist);
+void prefixsum256s(int32_t *src, int32_t *dst, int len, int32_t *carry);
+void prefixsum256s_excl(int32_t *src, int32_t *dst, int len, int32_t *carry);
+void diff256s(int32_t *src, int32_t *dst, int len, int32_t *prev);
+void prefixsum16s_256s(int16_t *src, int16_t *dst, int len, int16_t *carry);
+void prefixsum16s_256s_excl(int16_t *src, int16_t *dst, int len, int16_t *carry);
+void diff16s_256s(int16_t *src, int16_t *dst, int len, int16_t *prev);
+void sort256s(int32_t *src, int len);
+void topk256s(int32_t *src, int len, int k, int32_t *dst, int32_t *idx);
+void bottomk256s(int32_t *src, int len, int k, int32_t *dst, int32_t *idx);
+void partialsort256s(int32_t *src, int len, int k);
+#endif
+
+// simd_utils_avx_strings.h
+#if defined(AVX) && (defined(__AVX2__) || defined(DISPATCH))
+size_t strnlen_s_256(const char *s, size_t maxlen);
+#endif
+
+// simd_utils_avx512_double.h
+#if defined(AVX512)
+void set512d(double *dst, double value, int len);
+void zero512d(double *dst, int len);
+void copy512d(double *src, double *dst, int len);
+void sqrt512d(double *src, double *dst, int len);
+void fabs512d(double *src, double *dst, int len);
+void add512d(double *src1, double *src2, double *dst, int len);
+void mul512d(double *src1, double *src2, double *dst, int len);
+void sub512d(double *src1, double *src2, double *dst, int len);
+void div512d(double *src1, double *src2, double *dst, int len);
+void addc512d(double *src, double value, double *dst, int len);
+void mulc512d(double *src, double value, double *dst, int len);
+void muladd512d(double *_a, double *_b, double *_c, double *dst, int len);
+void mulcadd512d(double *_a, double _b, double *_c, double *dst, int len);
+void mulcaddc512d(double *_a, double _b, double _c, double *dst, int len);
+void muladdc512d(double *_a, double *_b, double _c, double *dst, int len);
+void rint512d(double *src, double *dst, int len);
+void round512d(double *src, double *dst, int len);
+void ceil512d(double *src, double *dst, int len);
+void floor512d(double *src, double *dst, int len);
+void trunc512d(double *src, double *dst, int len);
+void vectorSlope512d(double *dst, int len, double offset, double slope);
+void cplxtoreal512d(complex64_t *src, double *dstRe, double *dstIm, int len);
+void realtocplx512d(double *srcRe, double *srcIm, complex64_t *dst, int len);
+void asin512d(double *src, double *dst, int len);
+void atan512d(double *src, double *dst, int len);
+void atan2512d(double *src1, double *src2, double *dst, int len);
+void atan2512d_interleaved(complex64_t *src, double *dst, int len);
+void sincos512d(double *src, double *dst_sin, double *dst_cos, int len);
+void sincos512d_interleaved(double *src, complex64_t *dst, int len);
+void pol2cart2D512f_precise(float *r, float *theta, float *x, float *y, int len);
+void cart2pol2D512f_precise(float *x, float *y, float *r, float *theta, int len);
+void exp512d(double *src, double *dst, int len);
+void ln512d(double *src, double *dst, int len);
+void tan512d(double *src, double *dst, int len);
+void pow512d(double *x, double *y, double *dst, int len);
+void log2512d(double *src, double *dst, int len);
+void log10512d(double *src, double *dst, int len);
+void sinh512d(double *src, double *dst, int len);
+void cosh512d(double *src, double *dst, int len);
+void tanh512d(double *src, double *dst, int len);
+void asinh512d(double *src, double *dst, int len);
+void acosh512d(double *src, double *dst, int len);
+void atanh512d(double *src, double *dst, int len);
+void cbrt512d(double *src, double *dst, int len);
+void acos512d(double *src, double *dst, int len);
+void sigmoid512d(double *src, double *dst, int len);
+void powcplx512d(complex64_t *x, complex64_t *y, complex64_t *dst, int len);
+void fft512d_split(fft_plan64_t *plan, double *srcRe, double *srcIm, double *dstRe, double *dstIm);
+void ifft512d_split(fft_plan64_t *plan, double *srcRe, double *srcIm, double *dstRe, double *dstIm);
+void fft512d(fft_plan64_t *plan, complex64_t *src, complex64_t *dst);
+void ifft512d(fft_plan64_t *plan, complex64_t *src, complex64_t *dst);
+void rfft512d(fft_plan64_t *plan, double *src, complex64_t *dst);
+void irfft512d(fft_plan64_t *plan, complex64_t *src, double *dst);
+void cplxvecmul512d(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len);
+void cplxvecmul512d_split(double *src1Re, double *src1Im, double *src2Re, double *src2Im, double *dstRe, double *dstIm, int len);
+void cplxconjvecmul512d(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len);
+void cplxconjvecmul512d_split(double *src1Re, double *src1Im, double *src2Re, double *src2Im, double *dstRe, double *dstIm, int len);
+void cplxvecdiv512d(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len);
+void cplxvecdiv512d_split(double *src1Re, double *src1Im, double *src2Re, double *src2Im, double *dstRe, double *dstIm, int len);
+void cplxconj512d(complex64_t *src, complex64_t *dst, int len);
+void magnitude512d_split(double *srcRe, double *srcIm, double *dst, int len);
+void magnitude512d_interleaved(complex64_t *src, double *dst, int len);
+void powerspect512d_split(double *srcRe, double *srcIm, double *dst, int len);
+void powerspect512d_interleaved(complex64_t *src, double *dst, int len);
+int conv512d(conv64_t *conv, double *src, double *dst, int len);
+void minmax512d(double *src, int len, double *min_value, double *max_value);
+void softmax512d(double *src, double *dst, int len);
+void maxloc512d(double *src, double *max, int *idx, int len);
+void minloc512d(double *src, double *min, int *idx, int len);
+void minmaxloc512d(double *src, int len, double *min_value, int *min_idx, double *max_value, int *max_idx);
+void maxevery512d(double *src1, double *src2, double *dst, int len);
+void minevery512d(double *src1, double *src2, double *dst, int len);
+void threshold512_gt_d(double *src, double *dst, int len, double value);
+void threshold512_gtabs_d(double *src, double *dst, int len, double value);
+void threshold512_lt_d(double *src, double *dst, int len, double value);
+void threshold512_ltabs_d(double *src, double *dst, int len, double value);
+void threshold512_ltval_gtval_d(double *src, double *dst, int len, double ltlevel, double ltvalue, double gtlevel, double gtvalue);
+void sum512d(double *src, double *dst, int len);
+void mean512d(double *src, double *dst, int len);
+void dot512d(double *src1, double *src2, int len, double *dst);
+void dotc512d(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst);
+void sumkahan512d(double *src, double *dst, int len);
+void meankahan512d(double *src, double *dst, int len);
+void dotkahan512d(double *src1, double *src2, int len, double *dst);
+void dotckahan512d(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst);
+void sumpairwise512d(double *src, double *dst, int len);
+void meanpairwise512d(double *src, double *dst, int len);
+void dotpairwise512d(double *src1, double *src2, int len, double *dst);
+void dotcpairwise512d(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst);
+void moments512d(double *src, int len, moments_t *m);
+void prefixsum512d(double *src, double *dst, int len, double *carry);
+void prefixsum512d_excl(double *src, double *dst, int len, double *carry);
+void diff512d(double *src, double *dst, int len, double *prev);
+void sort512d(double *src, int len);
+#endif
+
+// simd_utils_avx512_float.h
+#if defined(AVX512)
+void log10512f(float *src, float *dst, int len);
+void log10512f_precise(float *src, float *dst, int len);
+void log2512f(float *src, float *dst, int len);
+void log2512f_precise(float *src, float *dst, int len);
+void ln512f(float *src, float *dst, int len);
+void exp512f(float *src, float *dst, int len);
+void cbrt512f(float *src, float *dst, int len);
+void fabs512f(float *src, float *dst, int len);
+void set512f(float *dst, float value, int len);
+void zero512f(float *dst, int len);
+void copy512f(float *src, float *dst, int len);
+void add512f(float *src1, float *src2, float *dst, int len);
+void mul512f(float *src1, float *src2, float *dst, int len);
+void sub512f(float *src1, float *src2, float *dst, int len);
+void addc512f(float *src, float value, float *dst, int len);
+void mulc512f(float *src, float value, float *dst, int len);
+void muladd512f(float *_a, float *_b, float *_c, float *dst, int len);
+void mulcadd512f(float *_a, float _b, float *_c, float *dst, int len);
+void mulcaddc512f(float *_a, float _b, float _c, float *dst, int len);
+void muladdc512f(float *_a, float *_b, float _c, float *dst, int len);
+void div512f(float *src1, float *src2, float *dst, int len);
+void vectorSlope512f(float *dst, int len, float offset, float slope);
+void convertInt16ToFloat32_512(int16_t *src, float *dst, int len, int scale_factor);
+void convertInt32ToFloat32_512(int32_t *src, float *dst, int len, int scale_factor);
+void convertFloat32ToU8_512(float *src, uint8_t *dst, int len, int rounding_mode, int scale_factor);
+void convertFloat32ToU16_512(float *src, uint16_t *dst, int len, int rounding_mode, int scale_factor);
+void convertFloat32ToI16_512(float *src, int16_t *dst, int len, int rounding_mode, int scale_factor);
+void cplxtoreal512f(complex32_t *src, float *dstRe, float *dstIm, int len);
+void realtocplx512f(float *srcRe, float *srcIm, complex32_t *dst, int len);
+void convert512_64f32f(double *src, float *dst, int len);
+void convert512_32f64f(float *src, double *dst, int len);
+void flip512f(float *src, float *dst, int len);
+void maxevery512f(float *src1, float *src2, float *dst, int len);
+void minevery512f(float *src1, float *src2, float *dst, int len);
+void minmax512f(float *src, int len, float *min_value, float *max_value);
+void threshold512_gt_f(float *src, float *dst, int len, float value);
+void threshold512_gtabs_f(float *src, float *dst, int len, float value);
+void threshold512_lt_f(float *src, float *dst, int len, float value);
+void threshold512_ltabs_f(float *src, float *dst, int len, float value);
+void threshold512_ltval_gtval_f(float *src, float *dst, int len, float ltlevel, float ltvalue, float gtlevel, float gtvalue);
+void sin512f(float *src, float *dst, int len);
+void cos512f(float *src, float *dst, int len);
+void sincos512f(float *src, float *dst_sin, float *dst_cos, int len);
+void sincos512f_interleaved(float *src, complex32_t *dst, int len);
+void acosh512f(float *src, float *dst, int len);
+void asinh512f(float *src, float *dst, int len);
+void atanh512f(float *src, float *dst, int len);
+void cosh512f(float *src, float *dst, int len);
+void sinh512f(float *src, float *dst, int len);
+void atan512f(float *src, float *dst, int len);
+void atan2512f(float *src1, float *src2, float *dst, int len);
+void atan2512f_interleaved(complex32_t *src, float *dst, int len);
+void asin512f(float *src, float *dst, int len);
+void tanh512f(float *src, float *dst, int len);
+void tan512f(float *src, float *dst, int len);
+void magnitude512f_split(float *srcRe, float *srcIm, float *dst, int len);
+void powerspect512f_split(float *srcRe, float *srcIm, float *dst, int len);
+void magnitude512f_interleaved(complex32_t *src, float *dst, int len);
+void powerspect512f_interleaved(complex32_t *src, float *dst, int len);
+void subcrev512f(float *src, float value, float *dst, int len);
+void sum512f(float *src, float *dst, int len);
+void mean512f(float *src, float *dst, int len);
+void dot512f(float *src1, float *src2, int len, float *dst);
+void dotc512f(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst);
+void sumkahan512f(float *src, float *dst, int len);
+void meankahan512f(float *src, float *dst, int len);
+void dotkahan512f(float *src1, float *src2, int len, float *dst);
+void dotckahan512f(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst);
+void sumpairwise512f(float *src, float *dst, int len);
+void meanpairwise512f(float *src, float *dst, int len);
+void dotpairwise512f(float *src1, float *src2, int len, float *dst);
+void dotcpairwise512f(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst);
+void moments512f(float *src, int len, moments_t *m);
+void prefixsum512f(float *src, float *dst, int len, float *carry);
+void prefixsum512f_excl(float *src, float *dst, int len, float *carry);
+void diff512f(float *src, float *dst, int len, float *prev);
+void histogram512f(float *src, int len, float low, float high, int nb_bins, uint32_t *hist);
+void histogram512f_edges(float *src, int len, float *edges, int nb_bins, uint32_t *hist);
+void sort512f(float *src, int len);
+void sort512f_kv(float *keys, int32_t *values, int len);
+void topk512f(float *src, int len, int k, float *dst, int32_t *idx);
+void bottomk512f(float *src, int len, int k, float *dst, int32_t *idx);
+void partialsort512f(float *src, int len, int k);
+void sqrt512f(float *src, float *dst, int len);
+void rint512f(float *src, float *dst, int len);
+void round512f(float *src, float *dst, int len);
+void ceil512f(float *src, float *dst, int len);
+void floor512f(float *src, float *dst, int len);
+void trunc512f(float *src, float *dst, int len);
+void cplxvecdiv512f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len);
+void cplxvecdiv512f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len);
+void cplxvecmul512f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len);
+void cplxvecmul512f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len);
+void cplxconjvecmul512f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len);
+void cplxconjvecmul512f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len);
+void cplxconj512f(complex32_t *src, complex32_t *dst, int len);
+void sigmoid512f(float *src, float *dst, int len);
+void PRelu512f(float *src, float *dst, float alpha, int len);
+void softmax512f(float *src, float *dst, int len);
+void pol2cart2D512f(float *r, float *theta, float *x, float *y, int len);
+void cart2pol2D512f(float *x, float *y, float *r, float *theta, int len);
+void modf512f(float *src, float *integer, float *remainder, int len);
+void pow512f(float *x, float *y, float *dst, int len);
+void powcplx512f(complex32_t *x, complex32_t *y, complex32_t *dst, int len);
+void pipeline_apply512f(const pipeline_op_t *op, float *in, float *out, int offset, int len);
+void pipeline512f(float *src, float *dst, int len, const pipeline_op_t *ops, int nb_ops);
+void pipeline512f_sum(float *src, float *dst, int len, const pipeline_op_t *ops, int nb_ops);
+void fft512f_split(fft_plan32_t *plan, float *srcRe, float *srcIm, float *dstRe, float *dstIm);
+void ifft512f_split(fft_plan32_t *plan, float *srcRe, float *srcIm, float *dstRe, float *dstIm);
+void fft512f(fft_plan32_t *plan, complex32_t *src, complex32_t *dst);
+void ifft512f(fft_plan32_t *plan, complex32_t *src, complex32_t *dst);
+void rfft512f(fft_plan32_t *plan, float *src, complex32_t *dst);
+void irfft512f(fft_plan32_t *plan, complex32_t *src, float *dst);
+int fir512f(fir32_t *fir, float *src, float *dst, int len);
+int fir512f_cplx(fir32_t *fir, complex32_t *src, complex32_t *dst, int len);
+int fir512f_split(fir32_t *fir, float *srcRe, float *srcIm, float *dstRe, float *dstIm, int len);
+void iir512f(iir32_t *iir, float *src, float *dst, int len);
+int conv512f(conv32_t *conv, float *src, float *dst, int len);
+int conv512f_cplx(conv32_t *conv, complex32_t *src, complex32_t *dst, int len);
+void maxloc512f(float *src, float *max, int *idx, int len);
+void minloc512f(float *src, float *min, int *idx, int len);
+void minmaxloc512f(float *src, int len, float *min_value, int *min_idx, float *max_value, int *max_idx);
+#endif
+
+// simd_utils_avx512_int32.h
+#if defined(AVX512)
+void add512s(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void mul512s(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void sub512s(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void addc512s(int32_t *src, int32_t value, int32_t *dst, int len);
+void vectorSlope512s(int *dst, int len, int offset, int slope);
+void copy512s(int32_t *src, int32_t *dst, int len);
+void copy512s_2(int32_t *src, int32_t *dst, int len);
+void fast_copy512s(int32_t *src, int32_t *dst, int len);
+void fast_copy512s_2(int32_t *src, int32_t *dst, int len);
+void fast_copy512s_4(int32_t *src, int32_t *dst, int len);
+void absdiff16s_512s(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void addsat16s_512s(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void subsat16s_512s(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void mulhi16s_512s(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void mulhrs16s_512s(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void maxevery16s_512s(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void minevery16s_512s(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void abs16s_512s(int16_t *src, int16_t *dst, int len);
+void threshold_gt16s_512s(int16_t *src, int16_t *dst, int len, int16_t value);
+void threshold_lt16s_512s(int16_t *src, int16_t *dst, int len, int16_t value);
+void addsatu8_512(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len);
+void subsatu8_512(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len);
+void absdiffu8_512(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len);
+void maxeveryu8_512(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len);
+void mineveryu8_512(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len);
+void threshold_gtu8_512(uint8_t *src, uint8_t *dst, int len, uint8_t value);
+void threshold_ltu8_512(uint8_t *src, uint8_t *dst, int len, uint8_t value);
+void convertInt16ToU8_512(int16_t *src, uint8_t *dst, int len, int scale_factor);
+void convertU8ToInt16_512(uint8_t *src, int16_t *dst, int len, int scale_factor);
+void add64s_512s(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void sub64s_512s(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void mul64s_512s(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void sum64s_512s(int64_t *src, int64_t *dst, int len);
+void maxevery64s_512s(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void minevery64s_512s(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void maxeveryu64_512(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len);
+void mineveryu64_512(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len);
+void minmax64s_512s(int64_t *src, int len, int64_t *min_value, int64_t *max_value);
+void minmaxu64_512(uint64_t *src, int len, uint64_t *min_value, uint64_t *max_value);
+void cmpeq64s_512s(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void cmpgt64s_512s(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void cmpgtu64_512(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len);
+void sll64s_512s(int64_t *src, int64_t *dst, int len, int shift);
+void sra64s_512s(int64_t *src, int64_t *dst, int len, int shift);
+void srlu64_512(uint64_t *src, uint64_t *dst, int len, int shift);
+void powerspect16s_512s_interleaved(complex16s_t *src, int32_t *dst, int len);
+void sum16s32s512(int16_t *src, int len, int32_t *dst, int scale_factor);
+void flip512s(int32_t *src, int32_t *dst, int len);
+void maxevery512s(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void minevery512s(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void minmax512s(int32_t *src, int len, int32_t *min_value, int32_t *max_value);
+void threshold512_gt_s(int32_t *src, int32_t *dst, int len, int32_t value);
+void threshold512_gtabs_s(int32_t *src, int32_t *dst, int len, int32_t value);
+void threshold512_lt_s(int32_t *src, int32_t *dst, int len, int32_t value);
+void threshold512_ltabs_s(int32_t *src, int32_t *dst, int len, int32_t value);
+void threshold512_ltval_gtval_s(int32_t *src, int32_t *dst, int len, int32_t ltlevel, int32_t ltvalue, int32_t gtlevel, int32_t gtvalue);
+void gatheri_512s(int32_t *src, int32_t *dst, int stride, int offset, int len);
+void scatteri_512s(int32_t *src, int32_t *dst, int stride, int offset, int len);
+void maxloc512s(int32_t *src, int32_t *max, int *idx, int len);
+void minloc512s(int32_t *src, int32_t *min, int *idx, int len);
+void minmaxloc512s(int32_t *src, int len, int32_t *min_value, int *min_idx, int32_t *max_value, int *max_idx);
+void minmax16s_512s(int16_t *src, int len, int16_t *min_value, int16_t *max_value);
+void maxloc16s_512s(int16_t *src, int16_t *max, int *idx, int len);
+void minloc16s_512s(int16_t *src, int16_t *min, int *idx, int len);
+void minmaxloc16s_512s(int16_t *src, int len, int16_t *min_value, int *min_idx, int16_t *max_value, int *max_idx);
+void histogram512s(int32_t *src, int len, int32_t low, int shift, int nb_bins, uint32_t *hist);
+void histogram16s_512s(int16_t *src, int len, int16_t low, int shift, int nb_bins, uint32_t *hist);
+void histogramu8_512(uint8_t *src, int len, uint32_t *hist);
+void prefixsum512s(int32_t *src, int32_t *dst, int len, int32_t *carry);
+void prefixsum512s_excl(int32_t *src, int32_t *dst, int len, int32_t *carry);
+void diff512s(int32_t *src, int32_t *dst, int len, int32_t *prev);
+void prefixsum16s_512s(int16_t *src, int16_t *dst, int len, int16_t *carry);
+void prefixsum16s_512s_excl(int16_t *src, int16_t *dst, int len, int16_t *carry);
+void diff16s_512s(int16_t *src, int16_t *dst, int len, int16_t *prev);
+void sort512s(int32_t *src, int len);
+void topk512s(int32_t *src, int len, int k, int32_t *dst, int32_t *idx);
+void bottomk512s(int32_t *src, int len, int k, int32_t *dst, int32_t *idx);
+void partialsort512s(int32_t *src, int len, int k);
+#endif
+
+// simd_utils_avx512_strings.h
+#if defined(AVX512) && (defined(__AVX2__) || defined(DISPATCH))
+size_t strnlen_s_512(const char *s, size_t maxlen);
+#endif
+
+// simd_utils_dispatch.h
+#if defined(DISPATCH)
+int simd_utils_cpu_isa(void);
+const char *simd_utils_isa_name(int isa);
+int simd_utils_dispatch_init(int isa);
+int simd_utils_dispatch_isa(void);
+void setf_vec(float *dst, float value, int len);
+void zerof_vec(float *dst, int len);
+void copyf_vec(float *src, float *dst, int len);
+void addf_vec(float *src1, float *src2, float *dst, int len);
+void subf_vec(float *src1, float *src2, float *dst, int len);
+void mulf_vec(float *src1, float *src2, float *dst, int len);
+void divf_vec(float *src1, float *src2, float *dst, int len);
+void addcf_vec(float *src, float value, float *dst, int len);
+void mulcf_vec(float *src, float value, float *dst, int len);
+void muladdf_vec(float *_a, float *_b, float *_c, float *dst, int len);
+void sqrtf_vec(float *src, float *dst, int len);
+void fabsf_vec(float *src, float *dst, int len);
+void expf_vec(float *src, float *dst, int len);
+void lnf_vec(float *src, float *dst, int len);
+void log10f_vec(float *src, float *dst, int len);
+void log2f_vec(float *src, float *dst, int len);
+void cbrtf_vec(float *src, float *dst, int len);
+void sinf_vec(float *src, float *dst, int len);
+void cosf_vec(float *src, float *dst, int len);
+void sincosf_vec(float *src, float *dst_sin, float *dst_cos, int len);
+void tanf_vec(float *src, float *dst, int len);
+void tanhf_vec(float *src, float *dst, int len);
+void atanf_vec(float *src, float *dst, int len);
+void atan2f_vec(float *src1, float *src2, float *dst, int len);
+void asinf_vec(float *src, float *dst, int len);
+void sigmoidf_vec(float *src, float *dst, int len);
+void softmaxf_vec(float *src, float *dst, int len);
+void sumf_vec(float *src, float *dst, int len);
+void meanf_vec(float *src, float *dst, int len);
+void dotf_vec(float *src1, float *src2, int len, float *dst);
+void sumkahanf_vec(float *src, float *dst, int len);
+void meankahanf_vec(float *src, float *dst, int len);
+void sumpairwisef_vec(float *src, float *dst, int len);
+void meanpairwisef_vec(float *src, float *dst, int len);
+void dotkahanf_vec(float *src1, float *src2, int len, float *dst);
+void dotpairwisef_vec(float *src1, float *src2, int len, float *dst);
+void dotcf_vec(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst);
+void dotckahanf_vec(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst);
+void dotcpairwisef_vec(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst);
+void sumd_vec(double *src, double *dst, int len);
+void meand_vec(double *src, double *dst, int len);
+void dotd_vec(double *src1, double *src2, int len, double *dst);
+void dotcd_vec(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst);
+void sumkahand_vec(double *src, double *dst, int len);
+void meankahand_vec(double *src, double *dst, int len);
+void sumpairwised_vec(double *src, double *dst, int len);
+void meanpairwised_vec(double *src, double *dst, int len);
+void dotkahand_vec(double *src1, double *src2, int len, double *dst);
+void dotpairwised_vec(double *src1, double *src2, int len, double *dst);
+void dotckahand_vec(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst);
+void dotcpairwised_vec(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst);
+void momentsf_vec(float *src, int len, moments_t *m);
+void momentsd_vec(double *src, int len, moments_t *m);
+void histogramu8_vec(uint8_t *src, int len, uint32_t *hist);
+void histogram16s_vec(int16_t *src, int len, int16_t low, int shift, int nb_bins, uint32_t *hist);
+void histograms_vec(int32_t *src, int len, int32_t low, int shift, int nb_bins, uint32_t *hist);
+void histogramf_vec(float *src, int len, float low, float high, int nb_bins, uint32_t *hist);
+void histogramf_edges_vec(float *src, int len, float *edges, int nb_bins, uint32_t *hist);
+void prefixsumf_vec(float *src, float *dst, int len, float *carry);
+void prefixsumf_excl_vec(float *src, float *dst, int len, float *carry);
+void difff_vec(float *src, float *dst, int len, float *prev);
+void prefixsumd_vec(double *src, double *dst, int len, double *carry);
+void prefixsumd_excl_vec(double *src, double *dst, int len, double *carry);
+void diffd_vec(double *src, double *dst, int len, double *prev);
+void prefixsums_vec(int32_t *src, int32_t *dst, int len, int32_t *carry);
+void prefixsums_excl_vec(int32_t *src, int32_t *dst, int len, int32_t *carry);
+void diffs_vec(int32_t *src, int32_t *dst, int len, int32_t *prev);
+void prefixsum16s_vec(int16_t *src, int16_t *dst, int len, int16_t *carry);
+void prefixsum16s_excl_vec(int16_t *src, int16_t *dst, int len, int16_t *carry);
+void diff16s_vec(int16_t *src, int16_t *dst, int len, int16_t *prev);
+void sortf_vec(float *src, int len);
+void sortd_vec(double *src, int len);
+void sorts_vec(int32_t *src, int len);
+void sortf_kv_vec(float *keys, int32_t *values, int len);
+void topkf_vec(float *src, int len, int k, float *dst, int32_t *idx);
+void bottomkf_vec(float *src, int len, int k, float *dst, int32_t *idx);
+void topks_vec(int32_t *src, int len, int k, int32_t *dst, int32_t *idx);
+void bottomks_vec(int32_t *src, int len, int k, int32_t *dst, int32_t *idx);
+void partialsortf_vec(float *src, int len, int k);
+void partialsorts_vec(int32_t *src, int len, int k);
+void minmaxf_vec(float *src, int len, float *min_value, float *max_value);
+void maxlocf_vec(float *src, float *max, int *idx, int len);
+void minlocf_vec(float *src, float *min, int *idx, int len);
+void minmaxlocf_vec(float *src, int len, float *min_value, int *min_idx, float *max_value, int *max_idx);
+void minmaxd_vec(double *src, int len, double *min_value, double *max_value);
+void maxlocd_vec(double *src, double *max, int *idx, int len);
+void minlocd_vec(double *src, double *min, int *idx, int len);
+void minmaxlocd_vec(double *src, int len, double *min_value, int *min_idx, double *max_value, int *max_idx);
+void maxeveryd_vec(double *src1, double *src2, double *dst, int len);
+void mineveryd_vec(double *src1, double *src2, double *dst, int len);
+void threshold_gt_d_vec(double *src, double *dst, int len, double value);
+void threshold_lt_d_vec(double *src, double *dst, int len, double value);
+void maxlocs_vec(int32_t *src, int32_t *max, int *idx, int len);
+void minlocs_vec(int32_t *src, int32_t *min, int *idx, int len);
+void minmaxlocs_vec(int32_t *src, int len, int32_t *min_value, int *min_idx, int32_t *max_value, int *max_idx);
+void minmax16s_vec(int16_t *src, int len, int16_t *min_value, int16_t *max_value);
+void maxloc16s_vec(int16_t *src, int16_t *max, int *idx, int len);
+void minloc16s_vec(int16_t *src, int16_t *min, int *idx, int len);
+void minmaxloc16s_vec(int16_t *src, int len, int16_t *min_value, int *min_idx, int16_t *max_value, int *max_idx);
+void addsat16s_vec(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void subsat16s_vec(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void mulhi16s_vec(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void mulhrs16s_vec(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void maxevery16s_vec(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void minevery16s_vec(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void abs16s_vec(int16_t *src, int16_t *dst, int len);
+void threshold_gt16s_vec(int16_t *src, int16_t *dst, int len, int16_t value);
+void threshold_lt16s_vec(int16_t *src, int16_t *dst, int len, int16_t value);
+void addsatu8_vec(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len);
+void subsatu8_vec(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len);
+void absdiffu8_vec(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len);
+void maxeveryu8_vec(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len);
+void mineveryu8_vec(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len);
+void threshold_gtu8_vec(uint8_t *src, uint8_t *dst, int len, uint8_t value);
+void threshold_ltu8_vec(uint8_t *src, uint8_t *dst, int len, uint8_t value);
+void convertInt16ToU8_vec(int16_t *src, uint8_t *dst, int len, int scale_factor);
+void convertU8ToInt16_vec(uint8_t *src, int16_t *dst, int len, int scale_factor);
+void add64s_vec(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void sub64s_vec(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void mul64s_vec(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void sum64s_vec(int64_t *src, int64_t *dst, int len);
+void maxevery64s_vec(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void minevery64s_vec(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void maxeveryu64_vec(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len);
+void mineveryu64_vec(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len);
+void minmax64s_vec(int64_t *src, int len, int64_t *min_value, int64_t *max_value);
+void minmaxu64_vec(uint64_t *src, int len, uint64_t *min_value, uint64_t *max_value);
+void cmpeq64s_vec(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void cmpgt64s_vec(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void cmpgtu64_vec(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len);
+void sll64s_vec(int64_t *src, int64_t *dst, int len, int shift);
+void sra64s_vec(int64_t *src, int64_t *dst, int len, int shift);
+void srlu64_vec(uint64_t *src, uint64_t *dst, int len, int shift);
+void maxeveryf_vec(float *src1, float *src2, float *dst, int len);
+void mineveryf_vec(float *src1, float *src2, float *dst, int len);
+void threshold_gt_f_vec(float *src, float *dst, int len, float value);
+void threshold_lt_f_vec(float *src, float *dst, int len, float value);
+void cplxvecmulf_vec(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len);
+void magnitudef_split_vec(float *srcRe, float *srcIm, float *dst, int len);
+void powerspectf_split_vec(float *srcRe, float *srcIm, float *dst, int len);
+void pipelinef_vec(float *src, float *dst, int len, const pipeline_op_t *ops, int nb_ops);
+void pipelinef_sum_vec(float *src, float *dst, int len, const pipeline_op_t *ops, int nb_ops);
+void fftf_vec(fft_plan32_t *plan, complex32_t *src, complex32_t *dst);
+void ifftf_vec(fft_plan32_t *plan, complex32_t *src, complex32_t *dst);
+void fftf_split_vec(fft_plan32_t *plan, float *srcRe, float *srcIm, float *dstRe, float *dstIm);
+void ifftf_split_vec(fft_plan32_t *plan, float *srcRe, float *srcIm, float *dstRe, float *dstIm);
+void rfftf_vec(fft_plan32_t *plan, float *src, complex32_t *dst);
+void irfftf_vec(fft_plan32_t *plan, complex32_t *src, float *dst);
+int firf_vec(fir32_t *fir, float *src, float *dst, int len);
+int firf_cplx_vec(fir32_t *fir, complex32_t *src, complex32_t *dst, int len);
+int firf_split_vec(fir32_t *fir, float *srcRe, float *srcIm, float *dstRe, float *dstIm, int len);
+void iirf_vec(iir32_t *iir, float *src, float *dst, int len);
+int convf_vec(conv32_t *conv, float *src, float *dst, int len);
+int convf_cplx_vec(conv32_t *conv, complex32_t *src, complex32_t *dst, int len);
+void setd_vec(double *dst, double value, int len);
+void copyd_vec(double *src, double *dst, int len);
+void addd_vec(double *src1, double *src2, double *dst, int len);
+void subd_vec(double *src1, double *src2, double *dst, int len);
+void muld_vec(double *src1, double *src2, double *dst, int len);
+void divd_vec(double *src1, double *src2, double *dst, int len);
+void sqrtd_vec(double *src, double *dst, int len);
+void fabsd_vec(double *src, double *dst, int len);
+void expd_vec(double *src, double *dst, int len);
+void lnd_vec(double *src, double *dst, int len);
+void log2d_vec(double *src, double *dst, int len);
+void log10d_vec(double *src, double *dst, int len);
+void sinhd_vec(double *src, double *dst, int len);
+void coshd_vec(double *src, double *dst, int len);
+void tanhd_vec(double *src, double *dst, int len);
+void asinhd_vec(double *src, double *dst, int len);
+void acoshd_vec(double *src, double *dst, int len);
+void atanhd_vec(double *src, double *dst, int len);
+void cbrtd_vec(double *src, double *dst, int len);
+void acosd_vec(double *src, double *dst, int len);
+void sigmoidd_vec(double *src, double *dst, int len);
+void softmaxd_vec(double *src, double *dst, int len);
+void sincosd_vec(double *src, double *dst_sin, double *dst_cos, int len);
+void atand_vec(double *src, double *dst, int len);
+void asind_vec(double *src, double *dst, int len);
+void fftd_vec(fft_plan64_t *plan, complex64_t *src, complex64_t *dst);
+void ifftd_vec(fft_plan64_t *plan, complex64_t *src, complex64_t *dst);
+void fftd_split_vec(fft_plan64_t *plan, double *srcRe, double *srcIm, double *dstRe, double *dstIm);
+void ifftd_split_vec(fft_plan64_t *plan, double *srcRe, double *srcIm, double *dstRe, double *dstIm);
+void rfftd_vec(fft_plan64_t *plan, double *src, complex64_t *dst);
+void irfftd_vec(fft_plan64_t *plan, complex64_t *src, double *dst);
+void cplxvecmuld_vec(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len);
+void cplxconjvecmuld_vec(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len);
+void cplxvecdivd_vec(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len);
+void cplxconjd_vec(complex64_t *src, complex64_t *dst, int len);
+void magnituded_split_vec(double *srcRe, double *srcIm, double *dst, int len);
+void magnituded_interleaved_vec(complex64_t *src, double *dst, int len);
+void powerspectd_split_vec(double *srcRe, double *srcIm, double *dst, int len);
+void powerspectd_interleaved_vec(complex64_t *src, double *dst, int len);
+int convd_vec(conv64_t *conv, double *src, double *dst, int len);
+void adds_vec(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void subs_vec(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void muls_vec(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+#endif
+
+// simd_utils_svml.h
+#if defined(ICC) && defined(SSE)
+void sin128f_svml(float *src, float *dst, int len);
+void cos128f_svml(float *src, float *dst, int len);
+void sincos128f_svml(float *src, float *dst_sin, float *dst_cos, int len);
+void sincos128d_svml(double *src, double *dst_sin, double *dst_cos, int len);
+void exp128f_svml(float *src, float *dst, int len);
+void exp128d_svml(double *src, double *dst, int len);
+void ln128f_svml(float *src, float *dst, int len);
+void ln128d_svml(double *src, double *dst, int len);
+void log2128f_svml(float *src, float *dst, int len);
+void log10128f_svml(float *src, float *dst, int len);
+void atan128f_svml(float *src, float *dst, int len);
+void atan128d_svml(double *src, double *dst, int len);
+void atan2128f_svml(float *src1, float *src2, float *dst, int len);
+void atan2128d_svml(double *src1, double *src2, double *dst, int len);
+void asin128f_svml(float *src, float *dst, int len);
+void asin128d_svml(double *src, double *dst, int len);
+void tan128f_svml(float *src, float *dst, int len);
+void tan128d_svml(double *src, double *dst, int len);
+void atanh128f_svml(float *src, float *dst, int len);
+void acosh128f_svml(float *src, float *dst, int len);
+void asinh128f_svml(float *src, float *dst, int len);
+void sinh128f_svml(float *src, float *dst, int len);
+void cosh128f_svml(float *src, float *dst, int len);
+void tanh128f_svml(float *src, float *dst, int len);
+void cbrt128f_svml(float *src, float *dst, int len);
+#endif
+#if defined(ICC) && defined(AVX)
+void sin256f_svml(float *src, float *dst, int len);
+void cos256f_svml(float *src, float *dst, int len);
+void sincos256f_svml(float *src, float *dst_sin, float *dst_cos, int len);
+void sincos256d_svml(double *src, double *dst_sin, double *dst_cos, int len);
+void exp256f_svml(float *src, float *dst, int len);
+void exp256d_svml(double *src, double *dst, int len);
+void ln256f_svml(float *src, float *dst, int len);
+void ln256d_svml(double *src, double *dst, int len);
+void log2256f_svml(float *src, float *dst, int len);
+void log10256f_svml(float *src, float *dst, int len);
+void atan256f_svml(float *src, float *dst, int len);
+void atan256d_svml(double *src, double *dst, int len);
+void atan2256f_svml(float *src1, float *src2, float *dst, int len);
+void atan2256d_svml(double *src1, double *src2, double *dst, int len);
+void asin256f_svml(float *src, float *dst, int len);
+void asin256d_svml(double *src, double *dst, int len);
+void tan256f_svml(float *src, float *dst, int len);
+void tan256d_svml(double *src, double *dst, int len);
+void atanh256f_svml(float *src, float *dst, int len);
+void acosh256f_svml(float *src, float *dst, int len);
+void asinh256f_svml(float *src, float *dst, int len);
+void sinh256f_svml(float *src, float *dst, int len);
+void cosh256f_svml(float *src, float *dst, int len);
+void tanh256f_svml(float *src, float *dst, int len);
+void cbrt256f_svml(float *src, float *dst, int len);
+#endif
+#if defined(ICC) && defined(AVX512)
+void sin512f_svml(float *src, float *dst, int len);
+void cos512f_svml(float *src, float *dst, int len);
+void sincos512f_svml(float *src, float *dst_sin, float *dst_cos, int len);
+void sincos512d_svml(double *src, double *dst_sin, double *dst_cos, int len);
+void exp512f_svml(float *src, float *dst, int len);
+void exp512d_svml(double *src, double *dst, int len);
+void ln512f_svml(float *src, float *dst, int len);
+void ln512d_svml(double *src, double *dst, int len);
+void log2512f_svml(float *src, float *dst, int len);
+void log10512f_svml(float *src, float *dst, int len);
+void atan512f_svml(float *src, float *dst, int len);
+void atan512d_svml(double *src, double *dst, int len);
+void atan2512f_svml(float *src1, float *src2, float *dst, int len);
+void atan2512d_svml(double *src1, double *src2, double *dst, int len);
+void asin512f_svml(float *src, float *dst, int len);
+void asin512d_svml(double *src, double *dst, int len);
+void tan512f_svml(float *src, float *dst, int len);
+void tan512d_svml(double *src, double *dst, int len);
+void atanh512f_svml(float *src, float *dst, int len);
+void acosh512f_svml(float *src, float *dst, int len);
+void asinh512f_svml(float *src, float *dst, int len);
+void sinh512f_svml(float *src, float *dst, int len);
+void cosh512f_svml(float *src, float *dst, int len);
+void tanh512f_svml(float *src, float *dst, int len);
+void cbrt512f_svml(float *src, float *dst, int len);
+#endif
+
+// simd_utils_amdlibm.h
+#if defined(AMDLIBM) && defined(SSE)
+void sin128f_amdlibm(float *src, float *dst, int len);
+void cos128f_amdlibm(float *src, float *dst, int len);
+void sincos128f_amdlibm(float *src, float *dst_sin, float *dst_cos, int len);
+void sincos128d_amdlibm(double *src, double *dst_sin, double *dst_cos, int len);
+void exp128f_amdlibm(float *src, float *dst, int len);
+void exp128d_amdlibm(double *src, double *dst, int len);
+void ln128f_amdlibm(float *src, float *dst, int len);
+void ln128d_amdlibm(double *src, double *dst, int len);
+void log2128f_amdlibm(float *src, float *dst, int len);
+void log10128f_amdlibm(float *src, float *dst, int len);
+void atan128f_amdlibm(float *src, float *dst, int len);
+void atan128d_amdlibm(double *src, double *dst, int len);
+void asin128f_amdlibm(float *src, float *dst, int len);
+void tan128f_amdlibm(float *src, float *dst, int len);
+void tan128d_amdlibm(double *src, double *dst, int len);
+void cosh128f_amdlibm(float *src, float *dst, int len);
+void tanh128f_amdlibm(float *src, float *dst, int len);
+void cbrt128f_amdlibm(float *src, float *dst, int len);
+#endif
+#if defined(AMDLIBM) && defined(AVX)
+void sin256f_amdlibm(float *src, float *dst, int len);
+void cos256f_amdlibm(float *src, float *dst, int len);
+void sincos256f_amdlibm(float *src, float *dst_sin, float *dst_cos, int len);
+void sincos256d_amdlibm(double *src, double *dst_sin, double *dst_cos, int len);
+void exp256f_amdlibm(float *src, float *dst, int len);
+void exp256d_amdlibm(double *src, double *dst, int len);
+void ln256f_amdlibm(float *src, float *dst, int len);
+void ln256d_amdlibm(double *src, double *dst, int len);
+void log2256f_amdlibm(float *src, float *dst, int len);
+void log10256f_amdlibm(float *src, float *dst, int len);
+void atan256f_amdlibm(float *src, float *dst, int len);
+void atan256d_amdlibm(double *src, double *dst, int len);
+void asin256f_amdlibm(float *src, float *dst, int len);
+void tan256f_amdlibm(float *src, float *dst, int len);
+void tan256d_amdlibm(double *src, double *dst, int len);
+void cosh256f_amdlibm(float *src, float *dst, int len);
+void tanh256f_amdlibm(float *src, float *dst, int len);
+#endif
+#if defined(AMDLIBM) && defined(AVX512)
+void sin512f_amdlibm(float *src, float *dst, int len);
+void cos512f_amdlibm(float *src, float *dst, int len);
+void sincos512f_amdlibm(float *src, float *dst_sin, float *dst_cos, int len);
+void sincos512d_amdlibm(double *src, double *dst_sin, double *dst_cos, int len);
+void exp512f_amdlibm(float *src, float *dst, int len);
+void exp512d_amdlibm(double *src, double *dst, int len);
+void ln512f_amdlibm(float *src, float *dst, int len);
+void ln512d_amdlibm(double *src, double *dst, int len);
+void log2512f_amdlibm(float *src, float *dst, int len);
+void log10512f_amdlibm(float *src, float *dst, int len);
+void atan512f_amdlibm(float *src, float *dst, int len);
+void atan512d_amdlibm(double *src, double *dst, int len);
+void asin512f_amdlibm(float *src, float *dst, int len);
+void asin512d_amdlibm(double *src, double *dst, int len);
+#endif
+
+// simd_utils_riscv_double.h
+#if defined(RISCV) && (ELEN >= 64)
+void rintd_vec(double *src, double *dst, int len);
+void roundd_vec(double *src, double *dst, int len);
+void ceild_vec(double *src, double *dst, int len);
+void floord_vec(double *src, double *dst, int len);
+void truncd_vec(double *src, double *dst, int len);
+void addcd_vec(double *src, double value, double *dst, int len);
+void muld_vec(double *a, double *b, double *c, int len);
+void divd_vec(double *a, double *b, double *c, int len);
+void subd_vec(double *a, double *b, double *c, int len);
+void muladdd_vec(double *a, double *b, double *c, double *dst, int len);
+void mulcaddd_vec(double *a, double b, double *c, double *dst, int len);
+void mulcaddcd_vec(double *a, double b, double c, double *dst, int len);
+void muladdcd_vec(double *a, double *b, double c, double *dst, int len);
+void mulcd_vec(double *src, double value, double *dst, int len);
+void setd_vec(double *dst, double value, int len);
+void zerod_vec(double *dst, int len);
+void copyd_vec(double *src, double *dst, int len);
+void sqrtd_vec(double *src, double *dst, int len);
+void fabsd_vec(double *src, double *dst, int len);
+void sumd_vec(double *src, double *dst, int len);
+void meand_vec(double *src, double *dst, int len);
+void vectorSloped_vec(double *dst, int len, double offset, double slope);
+void cplxtoreald_vec(complex64_t *src, double *dstRe, double *dstIm, int len);
+void realtocplxd_vec(double *srcRe, double *srcIm, complex64_t *dst, int len);
+void sincosd_vec(double *src, double *s, double *c, int len);
+void sincosd_interleaved_vec(double *src, complex64_t *dst, int len);
+void atand_vec(double *src, double *dst, int len);
+void atan2d_vec(double *src1, double *src2, double *dst, int len);
+void atan2d_interleaved_vec(complex64_t *src, double *dst, int len);
+void expd_vec(double *src, double *dst, int len);
+void asind_vec(double *src, double *dst, int len);
+#endif
+#if defined(RISCV) && !(ELEN >= 64)
+void rintd_vec(double *src, double *dst, int len);
+void ceild_vec(double *src, double *dst, int len);
+void floord_vec(double *src, double *dst, int len);
+void truncd_vec(double *src, double *dst, int len);
+void addcd_vec(double *src, double value, double *dst, int len);
+void muld_vec(double *a, double *b, double *c, int len);
+void divd_vec(double *a, double *b, double *c, int len);
+void subd_vec(double *a, double *b, double *c, int len);
+void muladdd_vec(double *a, double *b, double *c, double *dst, int len);
+void mulcaddd_vec(double *a, double b, double *c, double *dst, int len);
+void mulcaddcd_vec(double *a, double b, double c, double *dst, int len);
+void muladdcd_vec(double *a, double *b, double c, double *dst, int len);
+void mulcd_vec(double *src, double value, double *dst, int len);
+void setd_vec(double *dst, double value, int len);
+void zerod_vec(double *dst, int len);
+void copyd_vec(double *src, double *dst, int len);
+void sqrtd_vec(double *src, double *dst, int len);
+void fabsd_vec(double *src, double *dst, int len);
+void sumd_vec(double *src, double *dst, int len);
+void meand_vec(double *src, double *dst, int len);
+void vectorSloped_vec(double *dst, int len, double offset, double slope);
+void cplxtoreald_vec(complex64_t *src, double *dstRe, double *dstIm, int len);
+void realtocplxd_vec(double *srcRe, double *srcIm, complex64_t *dst, int len);
+void sincosd_vec(double *src, double *s, double *c, int len);
+void sincosd_interleaved_vec(double *src, complex64_t *dst, int len);
+void atand_vec(double *src, double *dst, int len);
+void atan2d_vec(double *src1, double *src2, double *dst, int len);
+void atan2d_interleaved_vec(complex64_t *src, double *dst, int len);
+void asind_vec(double *src, double *dst, int len);
+void expd_vec(double *src, double *dst, int len);
+#endif
+
+// simd_utils_riscv_float.h
+#if defined(RISCV)
+void addcf_vec(float *src, float value, float *dst, int len);
+void mulf_vec(float *a, float *b, float *c, int len);
+void divf_vec(float *a, float *b, float *c, int len);
+void subf_vec(float *a, float *b, float *c, int len);
+void subcrevf_vec(float *src, float value, float *dst, int len);
+void muladdf_vec(float *a, float *b, float *c, float *dst, int len);
+void mulcaddf_vec(float *a, float b, float *c, float *dst, int len);
+void mulcaddcf_vec(float *a, float b, float c, float *dst, int len);
+void muladdcf_vec(float *a, float *b, float c, float *dst, int len);
+void mulcf_vec(float *src, float value, float *dst, int len);
+void sinf_vec(float *src, float *dst, int len);
+void cosf_vec(float *src, float *dst, int len);
+void sincosf_vec(float *src, float *s, float *c, int len);
+void sincosf_interleaved_vec(float *src, complex32_t *dst, int len);
+void tanf_vec(float *src, float *dst, int len);
+void sumf_vec(float *src, float *dst, int len);
+void meanf_vec(float *src, float *dst, int len);
+void dotf_vec(float *src1, float *src2, int len, float *dst);
+void dotcf_vec(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst);
+void cplxtorealf_vec(complex32_t *src, float *dstRe, float *dstIm, int len);
+void realtocplxf_vec(float *srcRe, float *srcIm, complex32_t *dst, int len);
+void cplxvecmulf_vec(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len);
+void cplxvecmulf_vec_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len);
+void cplxvecdivf_vec(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len);
+void cplxvecdivf_vec_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len);
+void cplxconjf_vec(complex32_t *src, complex32_t *dst, int len);
+void cplxconjvecmulf_vec(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len);
+void cplxconjvecmulf_vec_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len);
+void magnitudef_split_vec(float *srcRe, float *srcIm, float *dst, int len);
+void powerspectf_split_vec(float *srcRe, float *srcIm, float *dst, int len);
+void powerspectf_interleaved_vec(complex32_t *src, float *dst, int len);
+void magnitudef_interleaved_vec(complex32_t *src, float *dst, int len);
+void maxeveryf_vec(float *src1, float *src2, float *dst, int len);
+void mineveryf_vec(float *src1, float *src2, float *dst, int len);
+void minmaxf_vec(float *src, int len, float *min_value, float *max_value);
+void threshold_gt_f_vec(float *src, float *dst, int len, float value);
+void threshold_lt_f_vec(float *src, float *dst, int len, float value);
+void threshold_gtabs_f_vec(float *src, float *dst, int len, float value);
+void threshold_ltabs_f_vec(float *src, float *dst, int len, float value);
+void threshold_ltval_gtval_f_vec(float *src, float *dst, int len, float ltlevel, float ltvalue, float gtlevel, float gtvalue);
+void sqrtf_vec(float *src, float *dst, int len);
+void fabsf_vec(float *src, float *dst, int len);
+void log10f_vec(float *src, float *dst, int len);
+void lnf_vec(float *src, float *dst, int len);
+void log2f_vec(float *src, float *dst, int len);
+void atanf_vec(float *src, float *dst, int len);
+void atan2f_vec(float *src1, float *src2, float *dst, int len);
+void atan2f_interleaved_vec(complex32_t *src, float *dst, int len);
+void asinf_vec(float *src, float *dst, int len);
+void acoshf_vec(float *src, float *dst, int len);
+void asinhf_vec(float *src, float *dst, int len);
+void atanhf_vec(float *src, float *dst, int len);
+void expf_vec(float *src, float *dst, int len);
+void coshf_vec(float *src, float *dst, int len);
+void sinhf_vec(float *src, float *dst, int len);
+void tanhf_vec(float *src, float *dst, int len);
+void vectorSlopef_vec(float *dst, int len, float offset, float slope);
+void setf_vec(float *dst, float value, int len);
+void zerof_vec(float *dst, int len);
+void copyf_vec(float *src, float *dst, int len);
+void modf_vec(float *src, float *integer, float *remainder, int len);
+void rintf_vec(float *src, float *dst, int len);
+void roundf_vec(float *src, float *dst, int len);
+void ceilf_vec(float *src, float *dst, int len);
+void floorf_vec(float *src, float *dst, int len);
+void truncf_vec(float *src, float *dst, int len);
+void flipf_vec(float *src, float *dst, int len);
+void cbrtf_vec(float *src, float *dst, int len);
+void convertInt16ToFloat32_vec(int16_t *src, float *dst, int len, int scale_factor);
+void convertFloat32ToI16_vec(float *src, int16_t *dst, int len, int rounding_mode, int scale_factor);
+void convertFloat32ToU16_vec(float *src, uint16_t *dst, int len, int rounding_mode, int scale_factor);
+void convertFloat32ToU8_vec(float *src, uint8_t *dst, int len, int rounding_mode, int scale_factor);
+void pol2cart2Df_vec(float *r, float *theta, float *x, float *y, int len);
+void cart2pol2Df_vec(float *x, float *y, float *r, float *theta, int len);
+void PReluf_vec(float *src, float *dst, float alpha, int len);
+void sigmoidf_vec(float *src, float *dst, int len);
+void softmaxf_vec(float *src, float *dst, int len);
+#endif
+#if defined(RISCV) && (ELEN >= 64)
+void convert_32f64f_vec(float *src, double *dst, int len);
+void convert_64f32f_vec(double *src, float *dst, int len);
+#endif
+#if defined(RISCV) && !(ELEN >= 64)
+void convert_32f64f_vec(float *src, double *dst, int len);
+void convert_64f32f_vec(double *src, float *dst, int len);
+#endif
+
+// simd_utils_riscv_int.h
+#if defined(RISCV)
+void copys_vec(int32_t *src, int32_t *dst, int len);
+void subs_vec(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void adds_vec(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void addcs_vec(int32_t *src, int32_t value, int32_t *dst, int len);
+void muls_vec(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void mulcs_vec(int32_t *src, int32_t value, int32_t *dst, int len);
+void vectorSlopes_vec(int32_t *dst, int len, int32_t offset, int32_t slope);
+void threshold_gt_s_vec(int32_t *src, int32_t *dst, int len, float value);
+void threshold_lt_s_vec(int32_t *src, int32_t *dst, int len, float value);
+void threshold_gtabs_s_vec(int32_t *src, int32_t *dst, int len, int32_t value);
+void threshold_ltabs_s_vec(int32_t *src, int32_t *dst, int len, int32_t value);
+void minmaxs_vec(int32_t *src, int len, int32_t *min_value, int32_t *max_value);
+void maxeverys_vec(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void mineverys_vec(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void threshold_ltval_gtval_s_vec(int32_t *src, int32_t *dst, int len, int32_t ltlevel, int32_t ltvalue, int32_t gtlevel, int32_t gtvalue);
+void flips_vec(int32_t *src, int32_t *dst, int len);
+void sum16s32s_vec(int16_t *src, int len, int32_t *dst, int scale_factor);
+void absdiff16s_vec(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+#endif
+
+// simd_utils_altivec_float.h
+#if defined(ALTIVEC)
+void set128f(float *dst, float value, int len);
+void zero128f(float *dst, int len);
+void copy128f(float *src, float *dst, int len);
+void add128f(float *src1, float *src2, float *dst, int len);
+void addc128f(float *src, float value, float *dst, int len);
+void sub128f(float *src1, float *src2, float *dst, int len);
+void subc128f(float *src, float value, float *dst, int len);
+void subcrev128f(float *src, float value, float *dst, int len);
+void mul128f(float *src1, float *src2, float *dst, int len);
+void mulc128f(float *src, float value, float *dst, int len);
+void div128f(float *src1, float *src2, float *dst, int len);
+void fabs128f(float *src, float *dst, int len);
+void minevery128f(float *src1, float *src2, float *dst, int len);
+void maxevery128f(float *src1, float *src2, float *dst, int len);
+void cplxtoreal128f(complex32_t *src, float *dstRe, float *dstIm, int len);
+void realtocplx128f(float *srcRe, float *srcIm, complex32_t *dst, int len);
+void exp128f(float *src, float *dst, int len);
+void log2128f(float *src, float *dst, int len);
+void log2128f_precise(float *src, float *dst, int len);
+void ln128f_less_precise(float *src, float *dst, int len);
+void log10128f(float *src, float *dst, int len);
+void log10128f_precise(float *src, float *dst, int len);
+void ln128f(float *src, float *dst, int len);
+void magnitude128f_split(float *srcRe, float *srcIm, float *dst, int len);
+void powerspect128f_split(float *srcRe, float *srcIm, float *dst, int len);
+void cplxvecmul128f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len);
+void cplxvecmul128f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len);
+void cplxvecdiv128f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len);
+void cplxvecdiv128f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len);
+void minmax128f(float *src, int len, float *min_value, float *max_value);
+void sum128f(float *src, float *dst, int len);
+void mean128f(float *src, float *dst, int len);
+void threshold128_gt_f(float *src, float *dst, int len, float value);
+void threshold128_gtabs_f(float *src, float *dst, int len, float value);
+void threshold128_lt_f(float *src, float *dst, int len, float value);
+void threshold128_ltabs_f(float *src, float *dst, int len, float value);
+void threshold128_ltval_gtval_f(float *src, float *dst, int len, float ltlevel, float ltvalue, float gtlevel, float gtvalue);
+void rint128f(float *src, float *dst, int len);
+void round128f(float *src, float *dst, int len);
+void ceil128f(float *src, float *dst, int len);
+void floor128f(float *src, float *dst, int len);
+void trunc128f(float *src, float *dst, int len);
+void sqrt128f(float *src, float *dst, int len);
+void flip128f(float *src, float *dst, int len);
+void sincos128f(float *src, float *dst_sin, float *dst_cos, int len);
+void sincos128f_interleaved(float *src, complex32_t *dst, int len);
+void tan128f(float *src, float *dst, int len);
+void tan128f_naive(float *restrict src, float *restrict dst, int len);
+void atan128f(float *src, float *dst, int len);
+void atan2128f(float *src1, float *src2, float *dst, int len);
+void atan2128f_interleaved(complex32_t *src, float *dst, int len);
+void tanh128f(float *src, float *dst, int len);
+void atanh128f(float *src, float *dst, int len);
+void sinh128f(float *src, float *dst, int len);
+void cosh128f(float *src, float *dst, int len);
+void asinh128f(float *src, float *dst, int len);
+void acosh128f(float *src, float *dst, int len);
+void asin128f(float *src, float *dst, int len);
+void cplxconj128f(complex32_t *src, complex32_t *dst, int len);
+void PRelu128f(float *src, float *dst, float alpha, int len);
+void vectorSlope128f(float *dst, int len, float offset, float slope);
+void cbrt128f(float *src, float *dst, int len);
+void modf128f(float *src, float *integer, float *remainder, int len);
+void dot128f(float *src1, float *src2, int len, float *dst);
+void dotc128f(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst);
+#endif
+#if defined(ALTIVEC) && !defined(__MACH__)
+void convertFloat32ToU8_128(float *src, uint8_t *dst, int len, int rounding_mode, int scale_factor);
+void convertFloat32ToI16_128(float *src, int16_t *dst, int len, int rounding_mode, int scale_factor);
+void convertFloat32ToU16_128(float *src, uint16_t *dst, int len, int rounding_mode, int scale_factor);
+void convertInt16ToFloat32_128(int16_t *src, float *dst, int len, int scale_factor);
+#endif
+#if defined(ALTIVEC)
+void pol2cart2D128f(float *r, float *theta, float *x, float *y, int len);
+void cart2pol2D128f(float *x, float *y, float *r, float *theta, int len);
+void sigmoid128f(float *src, float *dst, int len);
+void softmax128f(float *src, float *dst, int len);
+#endif
+
+// simd_utils_altivec_int32.h
+#if defined(ALTIVEC)
+void copy128s(int32_t *src, int32_t *dst, int len);
+void add128s(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void addc128s(int32_t *src, int32_t value, int32_t *dst, int len);
+void sub128s(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void subc128s(int32_t *src, int32_t value, int32_t *dst, int len);
+void flip128s(int32_t *src, int32_t *dst, int len);
+void minevery128s(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void maxevery128s(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void minmax128s(int32_t *src, int len, int32_t *min_value, int32_t *max_value);
+void threshold128_gt_s(int32_t *src, int32_t *dst, int len, int32_t value);
+void threshold128_gtabs_s(int32_t *src, int32_t *dst, int len, int32_t value);
+void threshold128_lt_s(int32_t *src, int32_t *dst, int len, int32_t value);
+void threshold128_ltabs_s(int32_t *src, int32_t *dst, int len, int32_t value);
+void threshold128_ltval_gtval_s(int32_t *src, int32_t *dst, int len, int32_t ltlevel, int32_t ltvalue, int32_t gtlevel, int32_t gtvalue);
+void absdiff16s_128s(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void sum16s32s128(int16_t *src, int len, int32_t *dst, int scale_factor);
+#endif
+
+// simd_utils.h
+void log10f_C(float *src, float *dst, int len);
+void log10f_C_precise(float *src, float *dst, int len);
+void log2f_C(float *src, float *dst, int len);
+void log2f_C_precise(float *src, float *dst, int len);
+void lnf_C(float *src, float *dst, int len);
+void lnf_C_precise(float *src, float *dst, int len);
+void ln_C(double *src, double *dst, int len);
+void expf_C(float *src, float *dst, int len);
+void expf_C_precise(float *src, float *dst, int len);
+void exp_C(double *src, double *dst, int len);
+void log2d_C(double *src, double *dst, int len);
+void log10d_C(double *src, double *dst, int len);
+void sinhd_C(double *src, double *dst, int len);
+void coshd_C(double *src, double *dst, int len);
+void tanhd_C(double *src, double *dst, int len);
+void asinhd_C(double *src, double *dst, int len);
+void acoshd_C(double *src, double *dst, int len);
+void atanhd_C(double *src, double *dst, int len);
+void cbrtd_C(double *src, double *dst, int len);
+void acosd_C(double *src, double *dst, int len);
+void cbrtf_C(float *src, float *dst, int len);
+void cbrtf_C_precise(float *src, float *dst, int len);
+void fabsf_C(float *src, float *dst, int len);
+void setf_C(float *dst, float value, int len);
+void zerof_C(float *dst, int len);
+void copyf_C(float *src, float *dst, int len);
+void addcf_C(float *src, float value, float *dst, int len);
+void addcs_C(int32_t *src, int32_t value, int32_t *dst, int len);
+void mulf_C(float *src1, float *src2, float *dst, int len);
+void mulcf_C(float *src, float value, float *dst, int len);
+void muladdf_C(float *_a, float *_b, float *_c, float *dst, int len);
+void mulcaddf_C(float *_a, float _b, float *_c, float *dst, int len);
+void mulcaddcf_C(float *_a, float _b, float _c, float *dst, int len);
+void muladdcf_C(float *_a, float *_b, float _c, float *dst, int len);
+void muls_c(int32_t *a, int32_t *b, int32_t *c, int len);
+void divf_C(float *src1, float *src2, float *dst, int len);
+void divf_C_precise(float *src1, float *src2, float *dst, int len);
+void cplxtorealf_C(complex32_t *src, float *dstRe, float *dstIm, int len);
+void realtocplx_C(float *srcRe, float *srcIm, complex32_t *dst, int len);
+void cplxtoreald_C(complex64_t *src, double *dstRe, double *dstIm, int len);
+void realtocplxd_C(double *srcRe, double *srcIm, complex64_t *dst, int len);
+void convert_64f32f_C(double *src, float *dst, int len);
+void convert_32f64f_C(float *src, double *dst, int len);
+void convertFloat32ToU8_C(float *src, uint8_t *dst, int len, int rounding_mode, int scale_factor);
+void convertFloat32ToI16_C(float *src, int16_t *dst, int len, int rounding_mode, int scale_factor);
+void convertFloat32ToU16_C(float *src, uint16_t *dst, int len, int rounding_mode, int scale_factor);
+void convertInt16ToFloat32_C(int16_t *src, float *dst, int len, int scale_factor);
+void convertInt32ToFloat32_C(int32_t *src, float *dst, int len, int scale_factor);
+void threshold_gt_f_C(float *src, float *dst, int len, float value);
+void threshold_gtabs_f_C(float *src, float *dst, int len, float value);
+void threshold_lt_f_C(float *src, float *dst, int len, float value);
+void threshold_ltabs_f_C(float *src, float *dst, int len, float value);
+void threshold_ltval_gtval_f_C(float *src, float *dst, int len, float ltlevel, float ltvalue, float gtlevel, float gtvalue);
+void magnitudef_C_interleaved(complex32_t *src, float *dst, int len);
+void magnitudef_C_interleaved_precise(complex32_t *src, float *dst, int len);
+void magnitudef_C_split(float *srcRe, float *srcIm, float *dst, int len);
+void magnitudef_C_split_precise(float *srcRe, float *srcIm, float *dst, int len);
+void powerspectf_C_split(float *srcRe, float *srcIm, float *dst, int len);
+void powerspectf_C_split_precise(float *srcRe, float *srcIm, float *dst, int len);
+void powerspectf_C_interleaved(complex32_t *src, float *dst, int len);
+void powerspectf_C_interleaved_precise(complex32_t *src, float *dst, int len);
+void meanf_C(float *src, float *dst, int len);
+void meanf_C_precise(float *src, float *dst, int len);
+void sumf_C(float *src, float *dst, int len);
+void sumkahanf_C(float *src, float *dst, int len);
+void sumd_C(double *src, double *dst, int len);
+void sumkahand_C(double *src, double *dst, int len);
+void maxlocf_C(float *src, float *max, int *idx, int len);
+void minlocf_C(float *src, float *min, int *idx, int len);
+void minmaxlocf_C(float *src, int len, float *min_value, int *min_idx, float *max_value, int *max_idx);
+void flipf_C(float *src, float *dst, int len);
+void flips_C(int32_t *src, int32_t *dst, int len);
+void asinf_C(float *src, float *dst, int len);
+void asinf_C_precise(float *src, float *dst, int len);
+void asin_C(double *src, double *dst, int len);
+void tanf_C(float *src, float *dst, int len);
+void tanf_C_precise(float *src, float *dst, int len);
+void tan_C(double *src, double *dst, int len);
+void tanhf_C(float *src, float *dst, int len);
+void tanhf_C_precise(float *src, float *dst, int len);
+void sinhf_C(float *src, float *dst, int len);
+void sinhf_C_precise(float *src, float *dst, int len);
+void coshf_C(float *src, float *dst, int len);
+void coshf_C_precise(float *src, float *dst, int len);
+void atanhf_C(float *src, float *dst, int len);
+void atanhf_C_precise(float *src, float *dst, int len);
+void asinhf_C(float *src, float *dst, int len);
+void asinhf_C_precise(float *src, float *dst, int len);
+void acoshf_C(float *src, float *dst, int len);
+void acoshf_C_precise(float *src, float *dst, int len);
+void atan_C(double *src, double *dst, int len);
+void atanf_C(float *src, float *dst, int len);
+void atanf_C_precise(float *src, float *dst, int len);
+void atan2f_C(float *src1, float *src2, float *dst, int len);
+void atan2f_C_precise(float *src1, float *src2, float *dst, int len);
+void atan2f_interleaved_C(complex32_t *src, float *dst, int len);
+void atan2f_interleaved_C_precise(complex32_t *src, float *dst, int len);
+void atan2_C(double *src1, double *src2, double *dst, int len);
+void atan2_interleaved_C(complex64_t *src, double *dst, int len);
+void sinf_C(float *src, float *dst, int len);
+void sinf_C_precise(float *src, float *dst, int len);
+void cosf_C(float *src, float *dst, int len);
+void cosf_C_precise(float *src, float *dst, int len);
+void sincosf_C(float *src, float *dst_sin, float *dst_cos, int len);
+void sincosf_C_precise(float *src, float *dst_sin, float *dst_cos, int len);
+void sincosd_C(double *src, double *dst_sin, double *dst_cos, int len);
+void sincosf_C_interleaved(float *src, complex32_t *dst, int len);
+void sincosf_C_interleaved_precise(float *src, complex32_t *dst, int len);
+void sincosd_C_interleaved(double *src, complex64_t *dst, int len);
+void sqrtf_C(float *src, float *dst, int len);
+void sqrtf_C_precise(float *src, float *dst, int len);
+void modff_C(float *src, float *integer, float *remainder, int len);
+void floorf_C(float *src, float *dst, int len);
+void ceilf_C(float *src, float *dst, int len);
+void roundf_C(float *src, float *dst, int len);
+void rintf_C(float *src, float *dst, int len);
+void truncf_C(float *src, float *dst, int len);
+void floord_C(double *src, double *dst, int len);
+void ceild_C(double *src, double *dst, int len);
+void roundd_C(double *src, double *dst, int len);
+void rintd_C(double *src, double *dst, int len);
+void truncd_C(double *src, double *dst, int len);
+void cplxvecdiv_C(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len);
+void cplxvecdiv_C_precise(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len);
+void cplxvecdiv_C_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len);
+void cplxvecdiv_C_split_precise(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len);
+void cplxvecmul_C(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len);
+void cplxvecmul_C_precise(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len);
+void cplxvecmul_C_unrolled8(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len);
+void cplxvecmul_C_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len);
+void cplxvecmul_C_split_precise(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len);
+void cplxconjvecmul_C(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len);
+void cplxconjvecmul_C_precise(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len);
+void cplxconjvecmul_C_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len);
+void cplxconjvecmul_C_split_precise(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len);
+void cplxconj_C(complex32_t *src, complex32_t *dst, int len);
+void dotf_C(float *src1, float *src2, int len, float *dst);
+void dotf_C_precise(float *src1, float *src2, int len, float *dst);
+void dotcf_C(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst);
+void dotcf_C_precise(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst);
+void dotkahanf_C(float *src1, float *src2, int len, float *dst);
+void dotckahanf_C(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst);
+void dotd_C(double *src1, double *src2, int len, double *dst);
+void dotkahand_C(double *src1, double *src2, int len, double *dst);
+void dotcd_C(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst);
+void dotckahand_C(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst);
+void momentsf_C(float *src, int len, moments_t *m);
+void momentsd_C(double *src, int len, moments_t *m);
+void histogramu8_C(uint8_t *src, int len, uint32_t *hist);
+void histogram16s_C(int16_t *src, int len, int16_t low, int shift, int nb_bins, uint32_t *hist);
+void histograms_C(int32_t *src, int len, int32_t low, int shift, int nb_bins, uint32_t *hist);
+void histogramf_C(float *src, int len, float low, float high, int nb_bins, uint32_t *hist);
+void histogramf_edges_C(float *src, int len, float *edges, int nb_bins, uint32_t *hist);
+void prefixsumf_C(float *src, float *dst, int len, float *carry);
+void prefixsumf_excl_C(float *src, float *dst, int len, float *carry);
+void difff_C(float *src, float *dst, int len, float *prev);
+void prefixsumd_C(double *src, double *dst, int len, double *carry);
+void prefixsumd_excl_C(double *src, double *dst, int len, double *carry);
+void diffd_C(double *src, double *dst, int len, double *prev);
+void prefixsums_C(int32_t *src, int32_t *dst, int len, int32_t *carry);
+void prefixsums_excl_C(int32_t *src, int32_t *dst, int len, int32_t *carry);
+void diffs_C(int32_t *src, int32_t *dst, int len, int32_t *prev);
+void prefixsum16s_C(int16_t *src, int16_t *dst, int len, int16_t *carry);
+void prefixsum16s_excl_C(int16_t *src, int16_t *dst, int len, int16_t *carry);
+void diff16s_C(int16_t *src, int16_t *dst, int len, int16_t *prev);
+void sortf_C(float *src, int len);
+void sortd_C(double *src, int len);
+void sorts_C(int32_t *src, int len);
+void sortf_kv_C(float *keys, int32_t *values, int len);
+void partialsortf_C(float *src, int len, int k);
+void partialsorts_C(int32_t *src, int len, int k);
+void topkf_C(float *src, int len, int k, float *dst, int32_t *idx);
+void bottomkf_C(float *src, int len, int k, float *dst, int32_t *idx);
+void topks_C(int32_t *src, int len, int k, int32_t *dst, int32_t *idx);
+void bottomks_C(int32_t *src, int len, int k, int32_t *dst, int32_t *idx);
+void vectorSlopef_C(float *dst, int len, float offset, float slope);
+void vectorSloped_C(double *dst, int len, double offset, double slope);
+void vectorSlopes_C(int32_t *dst, int len, int32_t offset, int32_t slope);
+void maxeveryf_c(float *src1, float *src2, float *dst, int len);
+void mineveryf_c(float *src1, float *src2, float *dst, int len);
+void minmaxf_c(float *src, int len, float *min_value, float *max_value);
+void minmaxd_c(double *src, int len, double *min_value, double *max_value);
+void maxlocd_C(double *src, double *max, int *idx, int len);
+void minlocd_C(double *src, double *min, int *idx, int len);
+void minmaxlocd_C(double *src, int len, double *min_value, int *min_idx, double *max_value, int *max_idx);
+void maxeveryd_c(double *src1, double *src2, double *dst, int len);
+void mineveryd_c(double *src1, double *src2, double *dst, int len);
+void threshold_gt_d_C(double *src, double *dst, int len, double value);
+void threshold_gtabs_d_C(double *src, double *dst, int len, double value);
+void threshold_lt_d_C(double *src, double *dst, int len, double value);
+void threshold_ltabs_d_C(double *src, double *dst, int len, double value);
+void threshold_ltval_gtval_d_C(double *src, double *dst, int len, double ltlevel, double ltvalue, double gtlevel, double gtvalue);
+void addf_c(float *a, float *b, float *c, int len);
+void adds_c(int32_t *a, int32_t *b, int32_t *c, int len);
+void subf_c(float *a, float *b, float *c, int len);
+void subcrevf_C(float *src, float value, float *dst, int len);
+void subs_c(int32_t *a, int32_t *b, int32_t *c, int len);
+void setd_C(double *dst, double value, int len);
+void zerod_C(double *dst, int len);
+void copyd_C(double *src, double *dst, int len);
+void copys_C(int32_t *src, int32_t *dst, int len);
+void sqrtd_C(double *src, double *dst, int len);
+void fabsd_C(double *src, double *dst, int len);
+void addd_c(double *a, double *b, double *c, int len);
+void muld_c(double *a, double *b, double *c, int len);
+void subd_c(double *a, double *b, double *c, int len);
+void divd_c(double *a, double *b, double *c, int len);
+void mulcd_C(double *src, double value, double *dst, int len);
+void muladdd_C(double *_a, double *_b, double *_c, double *dst, int len);
+void mulcaddd_C(double *_a, double _b, double *_c, double *dst, int len);
+void mulcaddcd_C(double *_a, double _b, double _c, double *dst, int len);
+void muladdcd_C(double *_a, double *_b, double _c, double *dst, int len);
+void addcd_C(double *src, double value, double *dst, int len);
+void ors_C(int32_t *a, int32_t *b, int32_t *c, int len);
+void ands_C(int32_t *a, int32_t *b, int32_t *c, int len);
+void sigmoidf_C(float *src, float *dst, int len);
+void sigmoidd_C(double *src, double *dst, int len);
+void PReluf_C(float *src, float *dst, float alpha, int len);
+void softmaxf_C(float *src, float *dst, int len);
+void softmaxd_C(double *src, double *dst, int len);
+void absdiff16s_c(int16_t *a, int16_t *b, int16_t *c, int len);
+void addsat16s_c(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void subsat16s_c(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void mulhi16s_c(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void mulhrs16s_c(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void maxevery16s_c(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void minevery16s_c(int16_t *src1, int16_t *src2, int16_t *dst, int len);
+void abs16s_c(int16_t *src, int16_t *dst, int len);
+void threshold_gt16s_c(int16_t *src, int16_t *dst, int len, int16_t value);
+void threshold_lt16s_c(int16_t *src, int16_t *dst, int len, int16_t value);
+void addsatu8_c(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len);
+void subsatu8_c(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len);
+void absdiffu8_c(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len);
+void maxeveryu8_c(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len);
+void mineveryu8_c(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len);
+void threshold_gtu8_c(uint8_t *src, uint8_t *dst, int len, uint8_t value);
+void threshold_ltu8_c(uint8_t *src, uint8_t *dst, int len, uint8_t value);
+void convertInt16ToU8_C(int16_t *src, uint8_t *dst, int len, int scale_factor);
+void convertU8ToInt16_C(uint8_t *src, int16_t *dst, int len, int scale_factor);
+void add64s_c(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void sub64s_c(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void mul64s_c(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void sum64s_c(int64_t *src, int64_t *dst, int len);
+void maxevery64s_c(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void minevery64s_c(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void maxeveryu64_c(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len);
+void mineveryu64_c(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len);
+void minmax64s_c(int64_t *src, int len, int64_t *min_value, int64_t *max_value);
+void minmaxu64_c(uint64_t *src, int len, uint64_t *min_value, uint64_t *max_value);
+void cmpeq64s_c(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void cmpgt64s_c(int64_t *src1, int64_t *src2, int64_t *dst, int len);
+void cmpgtu64_c(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len);
+void sll64s_c(int64_t *src, int64_t *dst, int len, int shift);
+void sra64s_c(int64_t *src, int64_t *dst, int len, int shift);
+void srlu64_c(uint64_t *src, uint64_t *dst, int len, int shift);
+void sum16s32s_C(int16_t *src, int len, int32_t *dst, int scale_factor);
+void powerspect16s_c_interleaved(complex16s_t *src, int32_t *dst, int len);
+void maxeverys_c(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void mineverys_c(int32_t *src1, int32_t *src2, int32_t *dst, int len);
+void minmaxs_c(int32_t *src, int len, int32_t *min_value, int32_t *max_value);
+void maxlocs_C(int32_t *src, int32_t *max, int *idx, int len);
+void minlocs_C(int32_t *src, int32_t *min, int *idx, int len);
+void minmaxlocs_C(int32_t *src, int len, int32_t *min_value, int *min_idx, int32_t *max_value, int *max_idx);
+void minmax16s_c(int16_t *src, int len, int16_t *min_value, int16_t *max_value);
+void maxloc16s_C(int16_t *src, int16_t *max, int *idx, int len);
+void minloc16s_C(int16_t *src, int16_t *min, int *idx, int len);
+void minmaxloc16s_C(int16_t *src, int len, int16_t *min_value, int *min_idx, int16_t *max_value, int *max_idx);
+void threshold_gt_s_C(int32_t *src, int32_t *dst, int len, int32_t value);
+void threshold_gtabs_s_C(int32_t *src, int32_t *dst, int len, int32_t value);
+void threshold_lt_s_C(int32_t *src, int32_t *dst, int len, int32_t value);
+void threshold_ltabs_s_C(int32_t *src, int32_t *dst, int len, int32_t value);
+void threshold_ltval_gtval_s_C(int32_t *src, int32_t *dst, int len, int32_t ltlevel, int32_t ltvalue, int32_t gtlevel, int32_t gtvalue);
+void pol2cart2Df_C(float *r, float *theta, float *x, float *y, int len);
+void pol2cart2Df_C_precise(float *r, float *theta, float *x, float *y, int len);
+void cart2pol2Df_C(float *x, float *y, float *r, float *theta, int len);
+void cart2pol2Df_C_precise(float *x, float *y, float *r, float *theta, int len);
+void gatheri_C(int32_t *src, int32_t *dst, int stride, int offset, int len);
+void scatteri_C(int32_t *src, int32_t *dst, int stride, int offset, int len);
+void floodFill_4C_32s(int32_t* srcDst, int imageStep, point_t roiSize, point_t seedPoint1, int32_t Point1NewValue, modified_t* modified);
+void floodFill_8C_c_32s(int32_t* srcDst, int imageStep, point_t roiSize, point_t seedPoint1, int32_t Point1NewValue, modified_t* modified);
+void floodFill_4C_8u(uint8_t* srcDst, int imageStep, point_t roiSize, point_t seedPoint1, uint8_t Point1NewValue, modified_t* modified);
+void floodFill_8C_c_8u(uint8_t* srcDst, int imageStep, point_t roiSize, point_t seedPoint1, uint8_t Point1NewValue, modified_t* modified);
+void floodFill_8C_c_32f(float* srcDst, int imageStep, point_t roiSize, point_t seedPoint1, float Point1NewValue, modified_t* modified);
+void powf_c(float *x, float *y, float *dst, int len);
+void powd_c(double *x, double *y, double *dst, int len);
+void powcplxf_c(complex32_t *x, complex32_t *y, complex32_t *dst, int len);
+void powcplxd_c(complex64_t *x, complex64_t *y, complex64_t *dst, int len);
+void pipelinef_C(float *src, float *dst, int len, const pipeline_op_t *ops, int nb_ops);
+void pipelinef_sum_C(float *src, float *dst, int len, const pipeline_op_t *ops, int nb_ops);
+void fftf_split_C(fft_plan32_t *plan, float *srcRe, float *srcIm, float *dstRe, float *dstIm);
+void ifftf_split_C(fft_plan32_t *plan, float *srcRe, float *srcIm, float *dstRe, float *dstIm);
+void fftf_C(fft_plan32_t *plan, complex32_t *src, complex32_t *dst);
+void ifftf_C(fft_plan32_t *plan, complex32_t *src, complex32_t *dst);
+void rfftf_C(fft_plan32_t *plan, float *src, complex32_t *dst);
+void irfftf_C(fft_plan32_t *plan, complex32_t *src, float *dst);
+void fftd_split_C(fft_plan64_t *plan, double *srcRe, double *srcIm, double *dstRe, double *dstIm);
+void ifftd_split_C(fft_plan64_t *plan, double *srcRe, double *srcIm, double *dstRe, double *dstIm);
+void fftd_C(fft_plan64_t *plan, complex64_t *src, complex64_t *dst);
+void ifftd_C(fft_plan64_t *plan, complex64_t *src, complex64_t *dst);
+void rfftd_C(fft_plan64_t *plan, double *src, complex64_t *dst);
+void irfftd_C(fft_plan64_t *plan, complex64_t *src, double *dst);
+int firf_C(fir32_t *fir, float *src, float *dst, int len);
+int firf_cplx_C(fir32_t *fir, complex32_t *src, complex32_t *dst, int len);
+int firf_split_C(fir32_t *fir, float *srcRe, float *srcIm, float *dstRe, float *dstIm, int len);
+void iirf_C(iir32_t *iir, float *src, float *dst, int len);
+void cplxvecmuld_C(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len);
+void cplxvecmuld_C_split(double *src1Re, double *src1Im, double *src2Re, double *src2Im, double *dstRe, double *dstIm, int len);
+void cplxconjvecmuld_C(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len);
+void cplxconjvecmuld_C_split(double *src1Re, double *src1Im, double *src2Re, double *src2Im, double *dstRe, double *dstIm, int len);
+void cplxvecdivd_C(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len);
+void cplxvecdivd_C_split(double *src1Re, double *src1Im, double *src2Re, double *src2Im, double *dstRe, double *dstIm, int len);
+void cplxconjd_C(complex64_t *src, complex64_t *dst, int len);
+void magnituded_C_split(double *srcRe, double *srcIm, double *dst, int len);
+void magnituded_C_interleaved(complex64_t *src, double *dst, int len);
+void powerspectd_C_split(double *srcRe, double *srcIm, double *dst, int len);
+void powerspectd_C_interleaved(complex64_t *src, double *dst, int len);
+int convf_C(conv32_t *conv, float *src, float *dst, int len);
+int convf_cplx_C(conv32_t *conv, complex32_t *src, complex32_t *dst, int len);
+int convd_C(conv64_t *conv, double *src, double *dst, int len);
@@ -10,7 +10,7 @@
 #include <stdint.h>
 #include "immintrin.h"
 
-static inline void set512d(double *dst, double value, int len)
+SIMD_UTILS_API void set512d(double *dst, double value, int len)
 {
     const v8sd tmp = _mm512_set1_pd(value);
 
@@ -18,8 +18,15 @@ static inline void set512d(double *dst, double value, int len)
     stop_len *= AVX512_LEN_DOUBLE;
 
     if (isAligned((uintptr_t) (dst), AVX512_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
-            _mm512_store_pd(dst + i, tmp);
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                _mm512_stream_pd(dst + i, tmp);
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                _mm512_store_pd(dst + i, tmp);
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
@@ -27,12 +34,13 @@ static inline void set512d(double *dst, double value, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = value;
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        _mm512_mask_storeu_pd(dst + i, mask, tmp);
     }
 }
 
-static inline void zero512d(double *dst, int len)
+SIMD_UTILS_API void zero512d(double *dst, int len)
 {
     const v8sd tmp = _mm512_setzero_pd();
 
@@ -40,8 +48,15 @@ static inline void zero512d(double *dst, int len)
     stop_len *= AVX512_LEN_DOUBLE;
 
     if (isAligned((uintptr_t) (dst), AVX512_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
-            _mm512_store_pd(dst + i, tmp);
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                _mm512_stream_pd(dst + i, tmp);
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                _mm512_store_pd(dst + i, tmp);
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
@@ -49,19 +64,27 @@ static inline void zero512d(double *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = 0.0;
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        _mm512_mask_storeu_pd(dst + i, mask, tmp);
     }
 }
 
-static inline void copy512d(double *src, double *dst, int len)
+SIMD_UTILS_API void copy512d(double *src, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
-            _mm512_store_pd(dst + i, _mm512_load_pd(src + i));
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                _mm512_stream_pd(dst + i, _mm512_load_pd(src + i));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                _mm512_store_pd(dst + i, _mm512_load_pd(src + i));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
@@ -69,19 +92,27 @@ static inline void copy512d(double *src, double *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        _mm512_mask_storeu_pd(dst + i, mask, _mm512_maskz_loadu_pd(mask, src + i));
     }
 }
 
-static inline void sqrt512d(double *src, double *dst, int len)
+SIMD_UTILS_API void sqrt512d(double *src, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
-            _mm512_store_pd(dst + i, _mm512_sqrt_pd(_mm512_load_pd(src + i)));
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                _mm512_stream_pd(dst + i, _mm512_sqrt_pd(_mm512_load_pd(src + i)));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                _mm512_store_pd(dst + i, _mm512_sqrt_pd(_mm512_load_pd(src + i)));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
@@ -89,12 +120,58 @@ static inline void sqrt512d(double *src, double *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = sqrt(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        _mm512_mask_storeu_pd(dst + i, mask, _mm512_sqrt_pd(_mm512_maskz_loadu_pd(mask, src + i)));
+    }
+}
+
+SIMD_UTILS_API void fabs512d(double *src, double *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_DOUBLE);
+    stop_len *= (2 * AVX512_LEN_DOUBLE);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                v8sd src_tmp2 = _mm512_load_pd(src + i + AVX512_LEN_DOUBLE);
+                v8sd dst_tmp = _mm512_and_pd(*(v8sd *) _pd512_positive_mask, src_tmp);
+                v8sd dst_tmp2 = _mm512_and_pd(*(v8sd *) _pd512_positive_mask, src_tmp2);
+                _mm512_stream_pd(dst + i, dst_tmp);
+                _mm512_stream_pd(dst + i + AVX512_LEN_DOUBLE, dst_tmp2);
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                v8sd src_tmp2 = _mm512_load_pd(src + i + AVX512_LEN_DOUBLE);
+                v8sd dst_tmp = _mm512_and_pd(*(v8sd *) _pd512_positive_mask, src_tmp);
+                v8sd dst_tmp2 = _mm512_and_pd(*(v8sd *) _pd512_positive_mask, src_tmp2);
+                _mm512_store_pd(dst + i, dst_tmp);
+                _mm512_store_pd(dst + i + AVX512_LEN_DOUBLE, dst_tmp2);
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd src_tmp = _mm512_loadu_pd(src + i);
+            v8sd src_tmp2 = _mm512_loadu_pd(src + i + AVX512_LEN_DOUBLE);
+            v8sd dst_tmp = _mm512_and_pd(*(v8sd *) _pd512_positive_mask, src_tmp);
+            v8sd dst_tmp2 = _mm512_and_pd(*(v8sd *) _pd512_positive_mask, src_tmp2);
+            _mm512_storeu_pd(dst + i, dst_tmp);
+            _mm512_storeu_pd(dst + i + AVX512_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        v8sd dst_tmp = _mm512_and_pd(*(v8sd *) _pd512_positive_mask, src_tmp);
+        _mm512_mask_storeu_pd(dst + i, mask, dst_tmp);
     }
 }
 
-static inline void add512d(double *src1, double *src2, double *dst, int len)
+SIMD_UTILS_API void add512d(double *src1, double *src2, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -109,12 +186,13 @@ static inline void add512d(double *src1, double *src2, double *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src1[i] + src2[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        _mm512_mask_storeu_pd(dst + i, mask, _mm512_add_pd(_mm512_maskz_loadu_pd(mask, src1 + i), _mm512_maskz_loadu_pd(mask, src2 + i)));
     }
 }
 
-static inline void mul512d(double *src1, double *src2, double *dst, int len)
+SIMD_UTILS_API void mul512d(double *src1, double *src2, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -129,12 +207,13 @@ static inline void mul512d(double *src1, double *src2, double *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src1[i] * src2[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        _mm512_mask_storeu_pd(dst + i, mask, _mm512_mul_pd(_mm512_maskz_loadu_pd(mask, src1 + i), _mm512_maskz_loadu_pd(mask, src2 + i)));
     }
 }
 
-static inline void sub512d(double *src1, double *src2, double *dst, int len)
+SIMD_UTILS_API void sub512d(double *src1, double *src2, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -149,12 +228,13 @@ static inline void sub512d(double *src1, double *src2, double *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src1[i] - src2[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        _mm512_mask_storeu_pd(dst + i, mask, _mm512_sub_pd(_mm512_maskz_loadu_pd(mask, src1 + i), _mm512_maskz_loadu_pd(mask, src2 + i)));
     }
 }
 
-static inline void div512d(double *src1, double *src2, double *dst, int len)
+SIMD_UTILS_API void div512d(double *src1, double *src2, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -169,13 +249,14 @@ static inline void div512d(double *src1, double *src2, double *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src1[i] / src2[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        _mm512_mask_storeu_pd(dst + i, mask, _mm512_div_pd(_mm512_maskz_loadu_pd(mask, src1 + i), _mm512_maskz_loadu_pd(mask, src2 + i)));
     }
 }
 
 // TODO : "Immediate add/mul?"
-static inline void addc512d(double *src, double value, double *dst, int len)
+SIMD_UTILS_API void addc512d(double *src, double value, double *dst, int len)
 {
     const v8sd tmp = _mm512_set1_pd(value);
 
@@ -192,12 +273,13 @@ static inline void addc512d(double *src, double value, double *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src[i] + value;
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        _mm512_mask_storeu_pd(dst + i, mask, _mm512_add_pd(tmp, _mm512_maskz_loadu_pd(mask, src + i)));
     }
 }
 
-static inline void mulc512d(double *src, double value, double *dst, int len)
+SIMD_UTILS_API void mulc512d(double *src, double value, double *dst, int len)
 {
     const v8sd tmp = _mm512_set1_pd(value);
 
@@ -214,12 +296,13 @@ static inline void mulc512d(double *src, double value, double *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src[i] * value;
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        _mm512_mask_storeu_pd(dst + i, mask, _mm512_mul_pd(tmp, _mm512_maskz_loadu_pd(mask, src + i)));
     }
 }
 
-static inline void muladd512d(double *_a, double *_b, double *_c, double *dst, int len)
+SIMD_UTILS_API void muladd512d(double *_a, double *_b, double *_c, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -241,12 +324,16 @@ static inline void muladd512d(double *_a, double *_b, double *_c, double *dst, i
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = _a[i] * _b[i] + _c[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd a = _mm512_maskz_loadu_pd(mask, _a + i);
+        v8sd b = _mm512_maskz_loadu_pd(mask, _b + i);
+        v8sd c = _mm512_maskz_loadu_pd(mask, _c + i);
+        _mm512_mask_storeu_pd(dst + i, mask, _mm512_fmadd_pd_custom(a, b, c));
     }
 }
 
-static inline void mulcadd512d(double *_a, double _b, double *_c, double *dst, int len)
+SIMD_UTILS_API void mulcadd512d(double *_a, double _b, double *_c, double *dst, int len)
 {
     v8sd b = _mm512_set1_pd(_b);
 
@@ -267,12 +354,15 @@ static inline void mulcadd512d(double *_a, double _b, double *_c, double *dst, i
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = _a[i] * _b + _c[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd a = _mm512_maskz_loadu_pd(mask, _a + i);
+        v8sd c = _mm512_maskz_loadu_pd(mask, _c + i);
+        _mm512_mask_storeu_pd(dst + i, mask, _mm512_fmadd_pd_custom(a, b, c));
     }
 }
 
-static inline void mulcaddc512d(double *_a, double _b, double _c, double *dst, int len)
+SIMD_UTILS_API void mulcaddc512d(double *_a, double _b, double _c, double *dst, int len)
 {
     v8sd b = _mm512_set1_pd(_b);
     v8sd c = _mm512_set1_pd(_c);
@@ -292,12 +382,14 @@ static inline void mulcaddc512d(double *_a, double _b, double _c, double *dst, i
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = _a[i] * _b + _c;
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd a = _mm512_maskz_loadu_pd(mask, _a + i);
+        _mm512_mask_storeu_pd(dst + i, mask, _mm512_fmadd_pd_custom(a, b, c));
     }
 }
 
-static inline void muladdc512d(double *_a, double *_b, double _c, double *dst, int len)
+SIMD_UTILS_API void muladdc512d(double *_a, double *_b, double _c, double *dst, int len)
 {
     v8sd c = _mm512_set1_pd(_c);
 
@@ -318,12 +410,15 @@ static inline void muladdc512d(double *_a, double *_b, double _c, double *dst, i
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = _a[i] * _b[i] + _c;
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd a = _mm512_maskz_loadu_pd(mask, _a + i);
+        v8sd b = _mm512_maskz_loadu_pd(mask, _b + i);
+        _mm512_mask_storeu_pd(dst + i, mask, _mm512_fmadd_pd_custom(a, b, c));
     }
 }
 
-static inline void rint512d(double *src, double *dst, int len)
+SIMD_UTILS_API void rint512d(double *src, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -342,12 +437,15 @@ static inline void rint512d(double *src, double *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = rint(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        v8sd dst_tmp = _mm512_roundscale_pd(src_tmp, ROUNDTONEAREST);
+        _mm512_mask_storeu_pd(dst + i, mask, dst_tmp);
     }
 }
 
-static inline void round512d(double *src, double *dst, int len)
+SIMD_UTILS_API void round512d(double *src, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -372,12 +470,18 @@ static inline void round512d(double *src, double *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = round(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        v8sd spe1 = _mm512_and_pd(src_tmp, *(v8sd*)_pd512_sign_mask);
+        spe1 = _mm512_or_pd(spe1,*(v8sd*)_pd512_mid_mask);
+        spe1 = _mm512_add_pd(src_tmp, spe1);
+        v8sd dst_tmp = _mm512_roundscale_pd(spe1, ROUNDTOZERO);
+        _mm512_mask_storeu_pd(dst + i, mask, dst_tmp);
     }
 }
 
-static inline void ceil512d(double *src, double *dst, int len)
+SIMD_UTILS_API void ceil512d(double *src, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -394,12 +498,14 @@ static inline void ceil512d(double *src, double *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = ceil(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        _mm512_mask_storeu_pd(dst + i, mask, _mm512_roundscale_pd(src_tmp, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC));
     }
 }
 
-static inline void floor512d(double *src, double *dst, int len)
+SIMD_UTILS_API void floor512d(double *src, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -416,12 +522,14 @@ static inline void floor512d(double *src, double *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = floor(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        _mm512_mask_storeu_pd(dst + i, mask, _mm512_roundscale_pd(src_tmp, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
     }
 }
 
-static inline void trunc512d(double *src, double *dst, int len)
+SIMD_UTILS_API void trunc512d(double *src, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -438,12 +546,14 @@ static inline void trunc512d(double *src, double *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = trunc(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        _mm512_mask_storeu_pd(dst + i, mask, _mm512_roundscale_pd(src_tmp, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC));
     }
 }
 
-static inline void vectorSlope512d(double *dst, int len, double offset, double slope)
+SIMD_UTILS_API void vectorSlope512d(double *dst, int len, double offset, double slope)
 {
     v8sd coef = _mm512_set_pd(7.0 * slope, 6.0 * slope, 5.0 * slope, 4.0 * slope, 3.0 * slope, 2.0 * slope, slope, 0.0);
     v8sd slope16_vec = _mm512_set1_pd(16.0 * slope);
@@ -479,12 +589,15 @@ static inline void vectorSlope512d(double *dst, int len, double offset, double s
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = offset + slope * (double) i;
+    v8sd index = _mm512_set_pd(7.0, 6.0, 5.0, 4.0, 3.0, 2.0, 1.0, 0.0);
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd pos = _mm512_add_pd(_mm512_set1_pd((double) i), index);
+        _mm512_mask_storeu_pd(dst + i, mask, _mm512_fmadd_pd_custom(pos, _mm512_set1_pd(slope), _mm512_set1_pd(offset)));
     }
 }
 
-static inline void cplxtoreal512d(complex64_t *src, double *dstRe, double *dstIm, int len)
+SIMD_UTILS_API void cplxtoreal512d(complex64_t *src, double *dstRe, double *dstIm, int len)
 {
     int stop_len = 2 * len / (4 * AVX512_LEN_DOUBLE);
     stop_len *= 4 * AVX512_LEN_DOUBLE;
@@ -512,13 +625,15 @@ static inline void cplxtoreal512d(complex64_t *src, double *dstRe, double *dstIm
         }
     }
 
-    for (int i = j; i < len; i++) {
-        dstRe[i] = src[i].re;
-        dstIm[i] = src[i].im;
+    for (int i = j; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sdx2 vec1 = _mm512_maskz_load2u_pd(len - i, (double const *) (src + i));
+        _mm512_mask_storeu_pd(dstRe + i, mask, vec1.val[0]);
+        _mm512_mask_storeu_pd(dstIm + i, mask, vec1.val[1]);
     }
 }
 
-static inline void realtocplx512d(double *srcRe, double *srcIm, complex64_t *dst, int len)
+SIMD_UTILS_API void realtocplx512d(double *srcRe, double *srcIm, complex64_t *dst, int len)
 {
     int stop_len = len / (2 * AVX512_LEN_DOUBLE);
     stop_len *= 2 * AVX512_LEN_DOUBLE;
@@ -550,9 +665,12 @@ static inline void realtocplx512d(double *srcRe, double *srcIm, complex64_t *dst
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i].re = srcRe[i];
-        dst[i].im = srcIm[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd re = _mm512_maskz_loadu_pd(mask, srcRe + i);
+        v8sd im = _mm512_maskz_loadu_pd(mask, srcIm + i);
+        v8sdx2 reim = {{re, im}};
+        _mm512_mask_store2u_pd((double *) (dst + i), len - i, reim);
     }
 }
 
@@ -628,7 +746,7 @@ static inline v8sd asin512_pd(v8sd x)
     return (z);
 }
 
-static inline void asin512d(double *src, double *dst, int len)
+SIMD_UTILS_API void asin512d(double *src, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -645,8 +763,10 @@ static inline void asin512d(double *src, double *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = asin(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        _mm512_mask_storeu_pd(dst + i, mask, asin512_pd(src_tmp));
     }
 }
 
@@ -708,7 +828,7 @@ static inline v8sd atan512_pd(v8sd xx)
 
     y = _mm512_add_pd(y, z);
     y = _mm512_xor_pd(y, sign);
-    y = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(x, _mm512_setzero_pd(), _CMP_EQ_OS), y, xx);  // if (xx == 0) then return xx (x is fabs(xx))
+    y = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(xx, _mm512_setzero_pd(), _CMP_EQ_OS), y, xx);  // if (xx == 0) then return xx
     return (y);
 }
 
@@ -746,7 +866,7 @@ static inline v8sd atan2512_pd(v8sd y, v8sd x)
     return (z);
 }
 
-static inline void atan512d(double *src, double *dst, int len)
+SIMD_UTILS_API void atan512d(double *src, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -763,12 +883,14 @@ static inline void atan512d(double *src, double *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = atan(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        _mm512_mask_storeu_pd(dst + i, mask, atan512_pd(src_tmp));
     }
 }
 
-static inline void atan2512d(double *src1, double *src2, double *dst, int len)
+SIMD_UTILS_API void atan2512d(double *src1, double *src2, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -783,12 +905,13 @@ static inline void atan2512d(double *src1, double *src2, double *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = atan2(src1[i], src2[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        _mm512_mask_storeu_pd(dst + i, mask, atan2512_pd(_mm512_maskz_loadu_pd(mask, src1 + i), _mm512_maskz_loadu_pd(mask, src2 + i)));
     }
 }
 
-static inline void atan2512d_interleaved(complex64_t *src, double *dst, int len)
+SIMD_UTILS_API void atan2512d_interleaved(complex64_t *src, double *dst, int len)
 {
     int stop_len = len / (2 * AVX512_LEN_DOUBLE);
     stop_len *= 2 * AVX512_LEN_DOUBLE;
@@ -812,8 +935,9 @@ static inline void atan2512d_interleaved(complex64_t *src, double *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = atan2(src[i].im, src[i].re);
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        v8sdx2 src_split = _mm512_maskz_load2u_pd(len - i, (double *) (src + i));
+        _mm512_mask_storeu_pd(dst + i, tail_mask8(len - i), atan2512_pd(src_split.val[1], src_split.val[0]));
     }
 }
 
@@ -908,7 +1032,7 @@ static inline void sincos512_pd(v8sd x, v8sd *s, v8sd *c)
     *c = _mm512_xor_pd(xmm2, sign_bit_cos);
 }
 
-static inline void sincos512d(double *src, double *dst_sin, double *dst_cos, int len)
+SIMD_UTILS_API void sincos512d(double *src, double *dst_sin, double *dst_cos, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -933,13 +1057,18 @@ static inline void sincos512d(double *src, double *dst_sin, double *dst_cos, int
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst_sin[i] = sin(src[i]);
-        dst_cos[i] = cos(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        v8sd dst_sin_tmp;
+        v8sd dst_cos_tmp;
+        sincos512_pd(src_tmp, &dst_sin_tmp, &dst_cos_tmp);
+        _mm512_mask_storeu_pd(dst_sin + i, mask, dst_sin_tmp);
+        _mm512_mask_storeu_pd(dst_cos + i, mask, dst_cos_tmp);
     }
 }
 
-static inline void sincos512d_interleaved(double *src, complex64_t *dst, int len)
+SIMD_UTILS_API void sincos512d_interleaved(double *src, complex64_t *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -963,13 +1092,15 @@ static inline void sincos512d_interleaved(double *src, complex64_t *dst, int len
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i].im = sin(src[i]);
-        dst[i].re = cos(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        v8sd src_tmp = _mm512_maskz_loadu_pd(tail_mask8(len - i), src + i);
+        v8sdx2 dst_tmp;
+        sincos512_pd(src_tmp, &(dst_tmp.val[1]), &(dst_tmp.val[0]));
+        _mm512_mask_store2u_pd((double *) (dst + i), len - i, dst_tmp);
     }
 }
 
-static inline void pol2cart2D512f_precise(float *r, float *theta, float *x, float *y, int len)
+SIMD_UTILS_API void pol2cart2D512f_precise(float *r, float *theta, float *x, float *y, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -1009,18 +1140,19 @@ static inline void pol2cart2D512f_precise(float *r, float *theta, float *x, floa
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        double sin_tmp, cos_tmp;
-        double theta_double = (double) theta[i];
-        double r_double = (double) r[i];
-        sin_tmp = sin(theta_double);
-        cos_tmp = cos(theta_double);
-        x[i] = (float) (r_double * cos_tmp);
-        y[i] = (float) (r_double * sin_tmp);
+    for (int i = stop_len; i < len; i += AVX_LEN_FLOAT) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd r_tmp = _mm512_cvtps_pd(_mm256_maskz_loadu_ps(mask, r + i));
+        v8sd theta_tmp = _mm512_cvtps_pd(_mm256_maskz_loadu_ps(mask, theta + i));
+        v8sd sin_tmp;
+        v8sd cos_tmp;
+        sincos512_pd(theta_tmp, &sin_tmp, &cos_tmp);
+        _mm256_mask_storeu_ps(x + i, mask, _mm512_cvtpd_ps(_mm512_mul_pd(r_tmp, cos_tmp)));
+        _mm256_mask_storeu_ps(y + i, mask, _mm512_cvtpd_ps(_mm512_mul_pd(r_tmp, sin_tmp)));
     }
 }
 
-static inline void cart2pol2D512f_precise(float *x, float *y, float *r, float *theta, int len)
+SIMD_UTILS_API void cart2pol2D512f_precise(float *x, float *y, float *r, float *theta, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -1060,12 +1192,14 @@ static inline void cart2pol2D512f_precise(float *x, float *y, float *r, float *t
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        double y_double = (double) y[i];
-        double x_double = (double) x[i];
-        double y_square = y_double * y_double;
-        r[i] = (float) sqrt(x_double * x_double + y_square);
-        theta[i] = (float) atan2(y_double, x_double);
+    for (int i = stop_len; i < len; i += AVX_LEN_FLOAT) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd x_tmp = _mm512_cvtps_pd(_mm256_maskz_loadu_ps(mask, x + i));
+        v8sd y_tmp = _mm512_cvtps_pd(_mm256_maskz_loadu_ps(mask, y + i));
+        v8sd y_square = _mm512_mul_pd(y_tmp, y_tmp);
+        v8sd r_tmpd = _mm512_sqrt_pd(_mm512_fmadd_pd_custom(x_tmp, x_tmp, y_square));
+        _mm256_mask_storeu_ps(r + i, mask, _mm512_cvtpd_ps(r_tmpd));
+        _mm256_mask_storeu_ps(theta + i, mask, _mm512_cvtpd_ps(atan2512_pd(y_tmp, x_tmp)));
     }
 }
 
@@ -1174,15 +1308,23 @@ static inline v8sd exp512_pd(v8sd x)
     return (x);
 }
 
-static inline void exp512d(double *src, double *dst, int len)
+SIMD_UTILS_API void exp512d(double *src, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
-            v8sd src_tmp = _mm512_load_pd(src + i);
-            _mm512_store_pd(dst + i, exp512_pd(src_tmp));
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_stream_pd(dst + i, exp512_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_store_pd(dst + i, exp512_pd(src_tmp));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
@@ -1191,8 +1333,10 @@ static inline void exp512d(double *src, double *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = exp(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        _mm512_mask_storeu_pd(dst + i, mask, exp512_pd(src_tmp));
     }
 }
 
@@ -1299,15 +1443,23 @@ static inline v8sd log512_pd(v8sd x)
     return (z);
 }
 
-static inline void ln512d(double *src, double *dst, int len)
+SIMD_UTILS_API void ln512d(double *src, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
-            v8sd src_tmp = _mm512_load_pd(src + i);
-            _mm512_store_pd(dst + i, log512_pd(src_tmp));
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_stream_pd(dst + i, log512_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_store_pd(dst + i, log512_pd(src_tmp));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
@@ -1316,20 +1468,30 @@ static inline void ln512d(double *src, double *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = log(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        _mm512_mask_storeu_pd(dst + i, mask, log512_pd(src_tmp));
     }
 }
 
-static inline void tan512d(double *src, double *dst, int len)
+SIMD_UTILS_API void tan512d(double *src, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
-            v8sd src_tmp = _mm512_load_pd(src + i);
-            _mm512_store_pd(dst + i, tan512_pd(src_tmp));
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_stream_pd(dst + i, tan512_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_store_pd(dst + i, tan512_pd(src_tmp));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
@@ -1338,8 +1500,10 @@ static inline void tan512d(double *src, double *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = tan(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        _mm512_mask_storeu_pd(dst + i, mask, tan512_pd(src_tmp));
     }
 }
 
@@ -1351,7 +1515,7 @@ static inline v8sd pow512_pd(v8sd x, v8sd y)
     return ret;
 }
 
-static inline void pow512d(double *x, double *y, double *dst, int len)
+SIMD_UTILS_API void pow512d(double *x, double *y, double *dst, int len)
 {
     int stop_len = len / (2* AVX512_LEN_DOUBLE);
     stop_len *= ( 2*AVX512_LEN_DOUBLE);
@@ -1380,82 +1544,2469 @@ static inline void pow512d(double *x, double *y, double *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = pow(x[i], y[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd x_tmp = _mm512_maskz_loadu_pd(mask, x + i);
+        v8sd y_tmp = _mm512_maskz_loadu_pd(mask, y + i);
+        _mm512_mask_storeu_pd(dst + i, mask, pow512_pd(x_tmp, y_tmp));
     }
 }
 
+// log(1 + x), the rounding of u = 1 + x is compensated : log(u) * x / (u - 1)
+static inline v8sd log1p512_pd(v8sd x)
+{
+    v8sd u = _mm512_add_pd(*(v8sd *) _pd512_1, x);
+    v8sd d = _mm512_sub_pd(u, *(v8sd *) _pd512_1);
+    v8sd y = _mm512_mul_pd(log512_pd(u), _mm512_div_pd(x, d));
+    __mmask8 m_exact = _mm512_cmp_pd_mask(d, _mm512_setzero_pd(), _CMP_EQ_OS);  // log(1 + x) = x
+    return _mm512_mask_blend_pd(m_exact, y, x);
+}
 
-static inline void powcplx512d(complex64_t *x, complex64_t *y, complex64_t *dst, int len)
+static inline v8sd log2512_pd(v8sd x)
 {
-    int stop_len = len / (2* AVX512_LEN_DOUBLE);
-    stop_len *= ( 2*AVX512_LEN_DOUBLE);
+    v8sd y = log512_pd(x);
+    v8sd lo = _mm512_mul_pd(y, *(v8sd *) _pd512_log2e_lo);
+    return _mm512_fmadd_pd_custom(y, *(v8sd *) _pd512_cephes_LOG2E, lo);
+}
 
-    if (areAligned3((uintptr_t) (x), (uintptr_t) (y), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
-            v8sdx2 x_tmp = _mm512_load2_pd((double const *) (x) + i);
-            v8sdx2 y_tmp = _mm512_load2_pd((double const *) (y) + i);
-            v8sd x_tmp_re2 = _mm512_mul_pd(x_tmp.val[0], x_tmp.val[0]);
-            v8sd modx = _mm512_fmadd_pd_custom(x_tmp.val[1], x_tmp.val[1], x_tmp_re2);
-			modx = _mm512_sqrt_pd(modx);
-			v8sdx2 logx;
-			logx.val[0] = log512_pd(modx);
-			logx.val[1] = atan2512_pd(x_tmp.val[1], x_tmp.val[0]);
-			v8sdx2 ylogx;
-            v8sd ac = _mm512_mul_pd(logx.val[0], y_tmp.val[0]);     // ac
-            v8sd ad = _mm512_mul_pd(logx.val[0], y_tmp.val[1]);     // ad
-            ylogx.val[0] = _mm512_fnmadd_pd_custom(logx.val[1], y_tmp.val[1], ac);
-            ylogx.val[1] = _mm512_fmadd_pd_custom(logx.val[1], y_tmp.val[0], ad);
-			v8sd ex = exp512_pd(ylogx.val[0]);
-			v8sd cosylogx, sinylogx;
-			sincos512_pd(ylogx.val[1], &sinylogx, &cosylogx);
-			v8sdx2 dst_tmp;
-			dst_tmp.val[0] = _mm512_mul_pd(ex,cosylogx);
-			dst_tmp.val[1] = _mm512_mul_pd(ex,sinylogx);
-            _mm512_store2_pd((double*)(dst) + i, dst_tmp);
+static inline v8sd log10512_pd(v8sd x)
+{
+    v8sd y = log512_pd(x);
+    v8sd lo = _mm512_mul_pd(y, *(v8sd *) _pd512_log10e_lo);
+    return _mm512_fmadd_pd_custom(y, *(v8sd *) _pd512_log10e, lo);
+}
+
+static inline v8sd sinh512_pd(v8sd x)
+{
+    v8sd xabs = _mm512_and_pd(x, *(v8sd *) _pd512_positive_mask);
+    v8sd sign = _mm512_and_pd(x, *(v8sd *) _pd512_negative_mask);
+
+    // |x| <= 1 : x + x^3 P(x^2) / Q(x^2)
+    v8sd z = _mm512_mul_pd(xabs, xabs);
+    v8sd p = _mm512_fmadd_pd_custom(z, *(v8sd *) _pd512_sinh_p0, *(v8sd *) _pd512_sinh_p1);
+    p = _mm512_fmadd_pd_custom(z, p, *(v8sd *) _pd512_sinh_p2);
+    p = _mm512_fmadd_pd_custom(z, p, *(v8sd *) _pd512_sinh_p3);
+    v8sd q = _mm512_add_pd(z, *(v8sd *) _pd512_sinh_q0);
+    q = _mm512_fmadd_pd_custom(z, q, *(v8sd *) _pd512_sinh_q1);
+    q = _mm512_fmadd_pd_custom(z, q, *(v8sd *) _pd512_sinh_q2);
+    v8sd small = _mm512_fmadd_pd_custom(_mm512_mul_pd(xabs, z), _mm512_div_pd(p, q), xabs);
+
+    // |x| > 1 : (exp(|x|) - exp(-|x|)) / 2
+    v8sd e = exp512_pd(xabs);
+    v8sd large = _mm512_fmadd_pd_custom(e, *(v8sd *) _pd512_0p5, _mm512_div_pd(*(v8sd *) _pd512_min0p5, e));
+
+    __mmask8 m_large = _mm512_cmp_pd_mask(xabs, *(v8sd *) _pd512_1, _CMP_GT_OS);
+    v8sd y = _mm512_mask_blend_pd(m_large, small, large);
+    return _mm512_xor_pd(y, sign);
+}
+
+static inline v8sd cosh512_pd(v8sd x)
+{
+    v8sd e = exp512_pd(_mm512_and_pd(x, *(v8sd *) _pd512_positive_mask));
+    return _mm512_fmadd_pd_custom(e, *(v8sd *) _pd512_0p5, _mm512_div_pd(*(v8sd *) _pd512_0p5, e));
+}
+
+static inline v8sd tanh512_pd(v8sd x)
+{
+    v8sd xabs = _mm512_and_pd(x, *(v8sd *) _pd512_positive_mask);
+    v8sd sign = _mm512_and_pd(x, *(v8sd *) _pd512_negative_mask);
+
+    // |x| < 0.625 : x + x^3 P(x^2) / Q(x^2)
+    v8sd z = _mm512_mul_pd(xabs, xabs);
+    v8sd p = _mm512_fmadd_pd_custom(z, *(v8sd *) _pd512_tanh_p0, *(v8sd *) _pd512_tanh_p1);
+    p = _mm512_fmadd_pd_custom(z, p, *(v8sd *) _pd512_tanh_p2);
+    v8sd q = _mm512_add_pd(z, *(v8sd *) _pd512_tanh_q0);
+    q = _mm512_fmadd_pd_custom(z, q, *(v8sd *) _pd512_tanh_q1);
+    q = _mm512_fmadd_pd_custom(z, q, *(v8sd *) _pd512_tanh_q2);
+    v8sd small = _mm512_fmadd_pd_custom(_mm512_mul_pd(xabs, z), _mm512_div_pd(p, q), xabs);
+
+    // |x| >= 0.625 : 1 - 2 / (exp(2|x|) + 1)
+    v8sd xmax = _mm512_min_pd(xabs, *(v8sd *) _pd512_tanh_max);
+    v8sd e = exp512_pd(_mm512_add_pd(xmax, xmax));
+    v8sd large = _mm512_sub_pd(*(v8sd *) _pd512_1, _mm512_div_pd(*(v8sd *) _pd512_2, _mm512_add_pd(e, *(v8sd *) _pd512_1)));
+
+    __mmask8 m_large = _mm512_cmp_pd_mask(xabs, *(v8sd *) _pd512_0p625, _CMP_GE_OS);
+    v8sd y = _mm512_mask_blend_pd(m_large, small, large);
+    return _mm512_xor_pd(y, sign);
+}
+
+static inline v8sd asinh512_pd(v8sd x)
+{
+    v8sd xabs = _mm512_and_pd(x, *(v8sd *) _pd512_positive_mask);
+    v8sd sign = _mm512_and_pd(x, *(v8sd *) _pd512_negative_mask);
+
+    // log1p(|x| + x^2 / (1 + sqrt(1 + x^2)))
+    v8sd z = _mm512_mul_pd(xabs, xabs);
+    v8sd tmp = _mm512_add_pd(*(v8sd *) _pd512_1, _mm512_sqrt_pd(_mm512_add_pd(*(v8sd *) _pd512_1, z)));
+    v8sd small = log1p512_pd(_mm512_add_pd(xabs, _mm512_div_pd(z, tmp)));
+
+    // |x| > 1e8 : log(|x|) + log(2), x^2 could overflow
+    v8sd large = _mm512_add_pd(log512_pd(xabs), *(v8sd *) _pd512_cephes_LOGE2);
+
+    __mmask8 m_large = _mm512_cmp_pd_mask(xabs, *(v8sd *) _pd512_asinh_big, _CMP_GT_OS);
+    v8sd y = _mm512_mask_blend_pd(m_large, small, large);
+    return _mm512_xor_pd(y, sign);
+}
+
+static inline v8sd acosh512_pd(v8sd x)
+{
+    // log1p(z + sqrt(2z + z^2)), z = x - 1
+    v8sd z = _mm512_sub_pd(x, *(v8sd *) _pd512_1);
+    v8sd tmp = _mm512_sqrt_pd(_mm512_fmadd_pd_custom(z, z, _mm512_add_pd(z, z)));
+    v8sd small = log1p512_pd(_mm512_add_pd(z, tmp));
+
+    // x > 1e8 : log(x) + log(2)
+    v8sd large = _mm512_add_pd(log512_pd(x), *(v8sd *) _pd512_cephes_LOGE2);
+
+    __mmask8 m_large = _mm512_cmp_pd_mask(x, *(v8sd *) _pd512_asinh_big, _CMP_GT_OS);
+    return _mm512_mask_blend_pd(m_large, small, large);
+}
+
+static inline v8sd atanh512_pd(v8sd x)
+{
+    v8sd xabs = _mm512_and_pd(x, *(v8sd *) _pd512_positive_mask);
+    v8sd sign = _mm512_and_pd(x, *(v8sd *) _pd512_negative_mask);
+
+    // log1p(2|x| / (1 - |x|)) / 2
+    v8sd tmp = _mm512_div_pd(_mm512_add_pd(xabs, xabs), _mm512_sub_pd(*(v8sd *) _pd512_1, xabs));
+    v8sd y = _mm512_mul_pd(log1p512_pd(tmp), *(v8sd *) _pd512_0p5);
+    return _mm512_xor_pd(y, sign);
+}
+
+static inline v8sd cbrt512_pd(v8sd x)
+{
+    v8sd xabs = _mm512_and_pd(x, *(v8sd *) _pd512_positive_mask);
+    v8sd sign = _mm512_and_pd(x, *(v8sd *) _pd512_negative_mask);
+
+    // denormals are scaled by 2^54 to get a usable exponent
+    __mmask8 m_denorm = _mm512_cmp_pd_mask(xabs, *(v8sd *) _pd512_dbl_min, _CMP_LT_OS);
+    v8sd xscaled = _mm512_mul_pd(xabs, *(v8sd *) _pd512_two54);
+    v8sd xnorm = _mm512_mask_blend_pd(m_denorm, xabs, xscaled);
+
+    // |x| = m 2^(3q + r), m in [1, 2), r in {0, 1, 2}
+    v8sd e = _mm512_castsi512_pd(_mm512_srli_epi64(_mm512_castpd_si512(xnorm), 52));
+    e = _mm512_sub_pd(_mm512_or_pd(e, *(v8sd *) _pd512_two52), *(v8sd *) _pd512_two52);
+    e = _mm512_sub_pd(e, *(v8sd *) _pd512_1023);
+    v8sd e54 = _mm512_sub_pd(e, *(v8sd *) _pd512_54);
+    e = _mm512_mask_blend_pd(m_denorm, e, e54);
+    v8sd q = _mm512_roundscale_pd(_mm512_div_pd(e, *(v8sd *) _pd512_3), ROUNDTOFLOOR);
+    v8sd r = _mm512_sub_pd(e, _mm512_mul_pd(q, *(v8sd *) _pd512_3));
+    v8sd m = _mm512_or_pd(_mm512_and_pd(xnorm, *(v8sd *) _pd512_mant_mask), *(v8sd *) _pd512_1);
+    v8sd pow2r = _mm512_add_pd(_mm512_add_pd(r, *(v8sd *) _pd512_1023), *(v8sd *) _pd512_two52);
+    pow2r = _mm512_castsi512_pd(_mm512_slli_epi64(_mm512_castpd_si512(pow2r), 52));
+    m = _mm512_mul_pd(m, pow2r);  // in [1, 8)
+
+    // quadratic guess, two Halley iterations y (y^3 + 2m) / (2y^3 + m) and a Newton iteration
+    v8sd y = _mm512_fmadd_pd_custom(_mm512_fmadd_pd_custom(m, *(v8sd *) _pd512_cbrt_c2, *(v8sd *) _pd512_cbrt_c1), m, *(v8sd *) _pd512_cbrt_c0);
+    v8sd y3 = _mm512_mul_pd(_mm512_mul_pd(y, y), y);
+    y = _mm512_mul_pd(y, _mm512_div_pd(_mm512_add_pd(y3, _mm512_add_pd(m, m)), _mm512_fmadd_pd_custom(y3, *(v8sd *) _pd512_2, m)));
+    y3 = _mm512_mul_pd(_mm512_mul_pd(y, y), y);
+    y = _mm512_mul_pd(y, _mm512_div_pd(_mm512_add_pd(y3, _mm512_add_pd(m, m)), _mm512_fmadd_pd_custom(y3, *(v8sd *) _pd512_2, m)));
+    v8sd y2 = _mm512_mul_pd(y, y);
+    y = _mm512_sub_pd(y, _mm512_div_pd(_mm512_sub_pd(_mm512_mul_pd(y2, y), m), _mm512_mul_pd(y2, *(v8sd *) _pd512_3)));
+
+    // 2^q, q >= -360 so it is a normal number
+    v8sd pow2q = _mm512_add_pd(_mm512_add_pd(q, *(v8sd *) _pd512_1023), *(v8sd *) _pd512_two52);
+    pow2q = _mm512_castsi512_pd(_mm512_slli_epi64(_mm512_castpd_si512(pow2q), 52));
+    y = _mm512_or_pd(_mm512_mul_pd(y, pow2q), sign);
+
+    // cbrt(x) = x for 0, inf and NaN
+    __mmask8 m_zero = _mm512_cmp_pd_mask(xabs, _mm512_setzero_pd(), _CMP_EQ_OS);
+    __mmask8 m_notfinite = _mm512_cmp_pd_mask(xabs, *(v8sd *) _pd512_dbl_max, _CMP_NLE_US);
+    y = _mm512_mask_blend_pd(m_zero, y, x);
+    return _mm512_mask_blend_pd(m_notfinite, y, x);
+}
+
+static inline v8sd acos512_pd(v8sd x)
+{
+    v8sd xabs = _mm512_and_pd(x, *(v8sd *) _pd512_positive_mask);
+    __mmask8 m_large = _mm512_cmp_pd_mask(xabs, *(v8sd *) _pd512_0p5, _CMP_GT_OS);
+    __mmask8 m_neg = _mm512_cmp_pd_mask(x, _mm512_setzero_pd(), _CMP_LT_OS);
+
+    // |x| > 0.5 : acos(|x|) = 2 asin(sqrt((1 - |x|) / 2)), else acos(x) = PI/2 - asin(x)
+    v8sd s = _mm512_sqrt_pd(_mm512_mul_pd(_mm512_sub_pd(*(v8sd *) _pd512_1, xabs), *(v8sd *) _pd512_0p5));
+    v8sd a = asin512_pd(_mm512_mask_blend_pd(m_large, x, s));
+    v8sd small = _mm512_sub_pd(*(v8sd *) _pd512_PIO2F, _mm512_sub_pd(a, *(v8sd *) _pd512_PIO2_lo));
+    v8sd large = _mm512_add_pd(a, a);
+    v8sd large_neg = _mm512_sub_pd(*(v8sd *) _pd512_PIF, _mm512_sub_pd(large, *(v8sd *) _pd512_PI_lo));  // acos(x) = PI - acos(-x)
+    large = _mm512_mask_blend_pd(m_neg, large, large_neg);
+    return _mm512_mask_blend_pd(m_large, small, large);
+}
+
+// 1 / (1 + exp(-x)), exp(-x) being clamped to the range of exp256_pd
+static inline v8sd sigmoid512_pd(v8sd x)
+{
+    v8sd minus_x = _mm512_xor_pd(x, *(v8sd *) _pd512_negative_mask);
+    minus_x = _mm512_max_pd(*(v8sd *) _pd512_exp_min, minus_x);  // NaN is returned by the second operand
+    minus_x = _mm512_min_pd(*(v8sd *) _pd512_exp_max, minus_x);
+    return _mm512_div_pd(*(v8sd *) _pd512_1, _mm512_add_pd(*(v8sd *) _pd512_1, exp512_pd(minus_x)));
+}
+
+SIMD_UTILS_API void log2512d(double *src, double *dst, int len)
+{
+    int stop_len = len / AVX512_LEN_DOUBLE;
+    stop_len *= AVX512_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_stream_pd(dst + i, log2512_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_store_pd(dst + i, log2512_pd(src_tmp));
+            }
         }
     } else {
-        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
-            v8sdx2 x_tmp = _mm512_load2u_pd((double const *) (x) + i);
-            v8sdx2 y_tmp = _mm512_load2u_pd((double const *) (y) + i);
-            v8sd x_tmp_re2 = _mm512_mul_pd(x_tmp.val[0], x_tmp.val[0]);
-            v8sd modx = _mm512_fmadd_pd_custom(x_tmp.val[1], x_tmp.val[1], x_tmp_re2);
-			modx = _mm512_sqrt_pd(modx);
-			v8sdx2 logx;
-			logx.val[0] = log512_pd(modx);
-			logx.val[1] = atan2512_pd(x_tmp.val[1], x_tmp.val[0]);
-			v8sdx2 ylogx;
-            v8sd ac = _mm512_mul_pd(logx.val[0], y_tmp.val[0]);     // ac
-            v8sd ad = _mm512_mul_pd(logx.val[0], y_tmp.val[1]);     // ad
-            ylogx.val[0] = _mm512_fnmadd_pd_custom(logx.val[1], y_tmp.val[1], ac);
-            ylogx.val[1] = _mm512_fmadd_pd_custom(logx.val[1], y_tmp.val[0], ad);
-			v8sd ex = exp512_pd(ylogx.val[0]);
-			v8sd cosylogx, sinylogx;
-			sincos512_pd(ylogx.val[1], &sinylogx, &cosylogx);
-			v8sdx2 dst_tmp;
-			dst_tmp.val[0] = _mm512_mul_pd(ex,cosylogx);
-			dst_tmp.val[1] = _mm512_mul_pd(ex,sinylogx);
-            _mm512_store2u_pd((double*)(dst) + i, dst_tmp);
+        for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+            v8sd src_tmp = _mm512_loadu_pd(src + i);
+            _mm512_storeu_pd(dst + i, log2512_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        _mm512_mask_storeu_pd(dst + i, mask, log2512_pd(src_tmp));
+    }
+}
+
+SIMD_UTILS_API void log10512d(double *src, double *dst, int len)
+{
+    int stop_len = len / AVX512_LEN_DOUBLE;
+    stop_len *= AVX512_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_stream_pd(dst + i, log10512_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_store_pd(dst + i, log10512_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+            v8sd src_tmp = _mm512_loadu_pd(src + i);
+            _mm512_storeu_pd(dst + i, log10512_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        _mm512_mask_storeu_pd(dst + i, mask, log10512_pd(src_tmp));
+    }
+}
+
+SIMD_UTILS_API void sinh512d(double *src, double *dst, int len)
+{
+    int stop_len = len / AVX512_LEN_DOUBLE;
+    stop_len *= AVX512_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_stream_pd(dst + i, sinh512_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_store_pd(dst + i, sinh512_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+            v8sd src_tmp = _mm512_loadu_pd(src + i);
+            _mm512_storeu_pd(dst + i, sinh512_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        _mm512_mask_storeu_pd(dst + i, mask, sinh512_pd(src_tmp));
+    }
+}
+
+SIMD_UTILS_API void cosh512d(double *src, double *dst, int len)
+{
+    int stop_len = len / AVX512_LEN_DOUBLE;
+    stop_len *= AVX512_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_stream_pd(dst + i, cosh512_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_store_pd(dst + i, cosh512_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+            v8sd src_tmp = _mm512_loadu_pd(src + i);
+            _mm512_storeu_pd(dst + i, cosh512_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        _mm512_mask_storeu_pd(dst + i, mask, cosh512_pd(src_tmp));
+    }
+}
+
+SIMD_UTILS_API void tanh512d(double *src, double *dst, int len)
+{
+    int stop_len = len / AVX512_LEN_DOUBLE;
+    stop_len *= AVX512_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_stream_pd(dst + i, tanh512_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_store_pd(dst + i, tanh512_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+            v8sd src_tmp = _mm512_loadu_pd(src + i);
+            _mm512_storeu_pd(dst + i, tanh512_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        _mm512_mask_storeu_pd(dst + i, mask, tanh512_pd(src_tmp));
+    }
+}
+
+SIMD_UTILS_API void asinh512d(double *src, double *dst, int len)
+{
+    int stop_len = len / AVX512_LEN_DOUBLE;
+    stop_len *= AVX512_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_stream_pd(dst + i, asinh512_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_store_pd(dst + i, asinh512_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+            v8sd src_tmp = _mm512_loadu_pd(src + i);
+            _mm512_storeu_pd(dst + i, asinh512_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        _mm512_mask_storeu_pd(dst + i, mask, asinh512_pd(src_tmp));
+    }
+}
+
+SIMD_UTILS_API void acosh512d(double *src, double *dst, int len)
+{
+    int stop_len = len / AVX512_LEN_DOUBLE;
+    stop_len *= AVX512_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_stream_pd(dst + i, acosh512_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_store_pd(dst + i, acosh512_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+            v8sd src_tmp = _mm512_loadu_pd(src + i);
+            _mm512_storeu_pd(dst + i, acosh512_pd(src_tmp));
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-		double x_tmp_re2 = x[i].re * x[i].re;
-		double modx = (x[i].im * x[i].im) + x_tmp_re2;
-		modx = sqrt(modx);
-		complex64_t logx;
-		logx.re = log(modx);
-		logx.im = atan2(x[i].im, x[i].re);
-		complex64_t ylogx;
-		double ac = logx.re * y[i].re;     // ac
-		double ad = logx.re * y[i].im;     // ad
-		ylogx.re = ac - (logx.im * y[i].im);
-		ylogx.im = (logx.im *  y[i].re) +  ad;
-		double ex = exp(ylogx.re);
-		double cosylogx, sinylogx;
-        sinylogx = sin(ylogx.im);	
-        cosylogx = cos(ylogx.im);		
-		dst[i].re = ex * cosylogx;
-		dst[i].im = ex * sinylogx;
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        _mm512_mask_storeu_pd(dst + i, mask, acosh512_pd(src_tmp));
     }
 }
+
+SIMD_UTILS_API void atanh512d(double *src, double *dst, int len)
+{
+    int stop_len = len / AVX512_LEN_DOUBLE;
+    stop_len *= AVX512_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_stream_pd(dst + i, atanh512_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_store_pd(dst + i, atanh512_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+            v8sd src_tmp = _mm512_loadu_pd(src + i);
+            _mm512_storeu_pd(dst + i, atanh512_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        _mm512_mask_storeu_pd(dst + i, mask, atanh512_pd(src_tmp));
+    }
+}
+
+SIMD_UTILS_API void cbrt512d(double *src, double *dst, int len)
+{
+    int stop_len = len / AVX512_LEN_DOUBLE;
+    stop_len *= AVX512_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_stream_pd(dst + i, cbrt512_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_store_pd(dst + i, cbrt512_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+            v8sd src_tmp = _mm512_loadu_pd(src + i);
+            _mm512_storeu_pd(dst + i, cbrt512_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        _mm512_mask_storeu_pd(dst + i, mask, cbrt512_pd(src_tmp));
+    }
+}
+
+SIMD_UTILS_API void acos512d(double *src, double *dst, int len)
+{
+    int stop_len = len / AVX512_LEN_DOUBLE;
+    stop_len *= AVX512_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_stream_pd(dst + i, acos512_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_store_pd(dst + i, acos512_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+            v8sd src_tmp = _mm512_loadu_pd(src + i);
+            _mm512_storeu_pd(dst + i, acos512_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        _mm512_mask_storeu_pd(dst + i, mask, acos512_pd(src_tmp));
+    }
+}
+
+SIMD_UTILS_API void sigmoid512d(double *src, double *dst, int len)
+{
+    int stop_len = len / AVX512_LEN_DOUBLE;
+    stop_len *= AVX512_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_stream_pd(dst + i, sigmoid512_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+                v8sd src_tmp = _mm512_load_pd(src + i);
+                _mm512_store_pd(dst + i, sigmoid512_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+            v8sd src_tmp = _mm512_loadu_pd(src + i);
+            _mm512_storeu_pd(dst + i, sigmoid512_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        _mm512_mask_storeu_pd(dst + i, mask, sigmoid512_pd(src_tmp));
+    }
+}
+
+
+SIMD_UTILS_API void powcplx512d(complex64_t *x, complex64_t *y, complex64_t *dst, int len)
+{
+    int stop_len = len / (2* AVX512_LEN_DOUBLE);
+    stop_len *= ( 2*AVX512_LEN_DOUBLE);
+
+    if (areAligned3((uintptr_t) (x), (uintptr_t) (y), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < 2 * stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sdx2 x_tmp = _mm512_load2_pd((double const *) (x) + i);
+            v8sdx2 y_tmp = _mm512_load2_pd((double const *) (y) + i);
+            v8sd x_tmp_re2 = _mm512_mul_pd(x_tmp.val[0], x_tmp.val[0]);
+            v8sd modx = _mm512_fmadd_pd_custom(x_tmp.val[1], x_tmp.val[1], x_tmp_re2);
+			modx = _mm512_sqrt_pd(modx);
+			v8sdx2 logx;
+			logx.val[0] = log512_pd(modx);
+			logx.val[1] = atan2512_pd(x_tmp.val[1], x_tmp.val[0]);
+			v8sdx2 ylogx;
+            v8sd ac = _mm512_mul_pd(logx.val[0], y_tmp.val[0]);     // ac
+            v8sd ad = _mm512_mul_pd(logx.val[0], y_tmp.val[1]);     // ad
+            ylogx.val[0] = _mm512_fnmadd_pd_custom(logx.val[1], y_tmp.val[1], ac);
+            ylogx.val[1] = _mm512_fmadd_pd_custom(logx.val[1], y_tmp.val[0], ad);
+			v8sd ex = exp512_pd(ylogx.val[0]);
+			v8sd cosylogx, sinylogx;
+			sincos512_pd(ylogx.val[1], &sinylogx, &cosylogx);
+			v8sdx2 dst_tmp;
+			dst_tmp.val[0] = _mm512_mul_pd(ex,cosylogx);
+			dst_tmp.val[1] = _mm512_mul_pd(ex,sinylogx);
+            _mm512_store2_pd((double*)(dst) + i, dst_tmp);
+        }
+    } else {
+        for (int i = 0; i < 2 * stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sdx2 x_tmp = _mm512_load2u_pd((double const *) (x) + i);
+            v8sdx2 y_tmp = _mm512_load2u_pd((double const *) (y) + i);
+            v8sd x_tmp_re2 = _mm512_mul_pd(x_tmp.val[0], x_tmp.val[0]);
+            v8sd modx = _mm512_fmadd_pd_custom(x_tmp.val[1], x_tmp.val[1], x_tmp_re2);
+			modx = _mm512_sqrt_pd(modx);
+			v8sdx2 logx;
+			logx.val[0] = log512_pd(modx);
+			logx.val[1] = atan2512_pd(x_tmp.val[1], x_tmp.val[0]);
+			v8sdx2 ylogx;
+            v8sd ac = _mm512_mul_pd(logx.val[0], y_tmp.val[0]);     // ac
+            v8sd ad = _mm512_mul_pd(logx.val[0], y_tmp.val[1]);     // ad
+            ylogx.val[0] = _mm512_fnmadd_pd_custom(logx.val[1], y_tmp.val[1], ac);
+            ylogx.val[1] = _mm512_fmadd_pd_custom(logx.val[1], y_tmp.val[0], ad);
+			v8sd ex = exp512_pd(ylogx.val[0]);
+			v8sd cosylogx, sinylogx;
+			sincos512_pd(ylogx.val[1], &sinylogx, &cosylogx);
+			v8sdx2 dst_tmp;
+			dst_tmp.val[0] = _mm512_mul_pd(ex,cosylogx);
+			dst_tmp.val[1] = _mm512_mul_pd(ex,sinylogx);
+            _mm512_store2u_pd((double*)(dst) + i, dst_tmp);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        v8sdx2 x_tmp = _mm512_maskz_load2u_pd(len - i, (double const *) (x + i));
+        v8sdx2 y_tmp = _mm512_maskz_load2u_pd(len - i, (double const *) (y + i));
+        v8sd x_tmp_re2 = _mm512_mul_pd(x_tmp.val[0], x_tmp.val[0]);
+        v8sd modx = _mm512_fmadd_pd_custom(x_tmp.val[1], x_tmp.val[1], x_tmp_re2);
+        modx = _mm512_sqrt_pd(modx);
+        v8sdx2 logx;
+        logx.val[0] = log512_pd(modx);
+        logx.val[1] = atan2512_pd(x_tmp.val[1], x_tmp.val[0]);
+        v8sdx2 ylogx;
+        v8sd ac = _mm512_mul_pd(logx.val[0], y_tmp.val[0]);  // ac
+        v8sd ad = _mm512_mul_pd(logx.val[0], y_tmp.val[1]);  // ad
+        ylogx.val[0] = _mm512_fnmadd_pd_custom(logx.val[1], y_tmp.val[1], ac);
+        ylogx.val[1] = _mm512_fmadd_pd_custom(logx.val[1], y_tmp.val[0], ad);
+        v8sd ex = exp512_pd(ylogx.val[0]);
+        v8sd cosylogx, sinylogx;
+        sincos512_pd(ylogx.val[1], &sinylogx, &cosylogx);
+        v8sdx2 dst_tmp;
+        dst_tmp.val[0] = _mm512_mul_pd(ex, cosylogx);
+        dst_tmp.val[1] = _mm512_mul_pd(ex, sinylogx);
+        _mm512_mask_store2u_pd((double *) (dst + i), len - i, dst_tmp);
+    }
+}
+
+/* FFT (see simd_utils_fft.h) */
+
+// radix-4 butterfly on AVX512_LEN_DOUBLE points x[idx + r*n4], y = Y0re, Y0im, w1*Y1re, w1*Y1im, ...
+static inline void fft_radix4_512d(const double *xr, const double *xi, int idx, int n4, const v8sd *w, v8sd *y)
+{
+    v8sd ar = _mm512_loadu_pd(xr + idx), ai = _mm512_loadu_pd(xi + idx);
+    v8sd br = _mm512_loadu_pd(xr + idx + n4), bi = _mm512_loadu_pd(xi + idx + n4);
+    v8sd cr = _mm512_loadu_pd(xr + idx + 2 * n4), ci = _mm512_loadu_pd(xi + idx + 2 * n4);
+    v8sd dr = _mm512_loadu_pd(xr + idx + 3 * n4), di = _mm512_loadu_pd(xi + idx + 3 * n4);
+    v8sd apcr = _mm512_add_pd(ar, cr), apci = _mm512_add_pd(ai, ci);
+    v8sd amcr = _mm512_sub_pd(ar, cr), amci = _mm512_sub_pd(ai, ci);
+    v8sd bpdr = _mm512_add_pd(br, dr), bpdi = _mm512_add_pd(bi, di);
+    v8sd jbmdr = _mm512_sub_pd(bi, di), jbmdi = _mm512_sub_pd(dr, br);  // -j * (b - d)
+    v8sd t1r = _mm512_add_pd(amcr, jbmdr), t1i = _mm512_add_pd(amci, jbmdi);
+    v8sd t2r = _mm512_sub_pd(apcr, bpdr), t2i = _mm512_sub_pd(apci, bpdi);
+    v8sd t3r = _mm512_sub_pd(amcr, jbmdr), t3i = _mm512_sub_pd(amci, jbmdi);
+    y[0] = _mm512_add_pd(apcr, bpdr);
+    y[1] = _mm512_add_pd(apci, bpdi);
+    y[2] = _mm512_fnmadd_pd_custom(t1i, w[1], _mm512_mul_pd(t1r, w[0]));
+    y[3] = _mm512_fmadd_pd_custom(t1r, w[1], _mm512_mul_pd(t1i, w[0]));
+    y[4] = _mm512_fnmadd_pd_custom(t2i, w[3], _mm512_mul_pd(t2r, w[2]));
+    y[5] = _mm512_fmadd_pd_custom(t2r, w[3], _mm512_mul_pd(t2i, w[2]));
+    y[6] = _mm512_fnmadd_pd_custom(t3i, w[5], _mm512_mul_pd(t3r, w[4]));
+    y[7] = _mm512_fmadd_pd_custom(t3r, w[5], _mm512_mul_pd(t3i, w[4]));
+}
+
+// dst[4i + r] = yr[i]
+static inline void fft_store4_s1_512d(double *dst, v8sd y0, v8sd y1, v8sd y2, v8sd y3)
+{
+    v8sd t0 = _mm512_unpacklo_pd(y0, y1);  // points 0, 2, 4, 6
+    v8sd t1 = _mm512_unpackhi_pd(y0, y1);  // points 1, 3, 5, 7
+    v8sd t2 = _mm512_unpacklo_pd(y2, y3);
+    v8sd t3 = _mm512_unpackhi_pd(y2, y3);
+    v8sd u0 = _mm512_shuffle_f64x2(t0, t2, 0x44);
+    v8sd u1 = _mm512_shuffle_f64x2(t0, t2, 0xEE);
+    v8sd v0 = _mm512_shuffle_f64x2(t1, t3, 0x44);
+    v8sd v1 = _mm512_shuffle_f64x2(t1, t3, 0xEE);
+    _mm512_storeu_pd(dst, _mm512_shuffle_f64x2(u0, v0, 0x88));
+    _mm512_storeu_pd(dst + AVX512_LEN_DOUBLE, _mm512_shuffle_f64x2(u0, v0, 0xDD));
+    _mm512_storeu_pd(dst + 2 * AVX512_LEN_DOUBLE, _mm512_shuffle_f64x2(u1, v1, 0x88));
+    _mm512_storeu_pd(dst + 3 * AVX512_LEN_DOUBLE, _mm512_shuffle_f64x2(u1, v1, 0xDD));
+}
+
+// dst[16p + 4r + q] = yr[4p + q]
+static inline void fft_store4_s4_512d(double *dst, v8sd y0, v8sd y1, v8sd y2, v8sd y3)
+{
+    _mm512_storeu_pd(dst, _mm512_shuffle_f64x2(y0, y1, 0x44));
+    _mm512_storeu_pd(dst + AVX512_LEN_DOUBLE, _mm512_shuffle_f64x2(y2, y3, 0x44));
+    _mm512_storeu_pd(dst + 2 * AVX512_LEN_DOUBLE, _mm512_shuffle_f64x2(y0, y1, 0xEE));
+    _mm512_storeu_pd(dst + 3 * AVX512_LEN_DOUBLE, _mm512_shuffle_f64x2(y2, y3, 0xEE));
+}
+
+
+static inline v8sd fft_reverse512d(v8sd a)
+{
+    return _mm512_permutexvar_pd(_mm512_set_epi64(0, 1, 2, 3, 4, 5, 6, 7), a);
+}
+
+static inline void fft_radix4_stage512d(const fft_plan64_t *plan, int s, const double *xr, const double *xi, double *yr, double *yi)
+{
+    int n4 = plan->n / 4;
+    v8sd w[6], y[8];
+
+    if (s >= AVX512_LEN_DOUBLE) {
+        const double *tw = fft_stage_twd(plan, s);
+        for (int p = 0; p < n4 / s; p++) {
+            for (int r = 0; r < 6; r++)
+                w[r] = _mm512_set1_pd(tw[6 * p + r]);
+            for (int q = 0; q < s; q += AVX512_LEN_DOUBLE) {
+                int out = q + 4 * s * p;
+                fft_radix4_512d(xr, xi, q + s * p, n4, w, y);
+                for (int r = 0; r < 4; r++) {
+                    _mm512_storeu_pd(yr + out + r * s, y[2 * r]);
+                    _mm512_storeu_pd(yi + out + r * s, y[2 * r + 1]);
+                }
+            }
+        }
+    } else {
+        // strides smaller than a vector : twiddles per point, the 4 outputs are interleaved by chunks of s
+        const double *twx = plan->twx + ((s == 1) ? 0 : 6 * n4);
+        for (int idx = 0; idx < n4; idx += AVX512_LEN_DOUBLE) {
+            for (int r = 0; r < 6; r++)
+                w[r] = _mm512_loadu_pd(twx + r * n4 + idx);
+            fft_radix4_512d(xr, xi, idx, n4, w, y);
+            for (int r = 0; r < 2; r++) {
+                if (s == 1)
+                    fft_store4_s1_512d((r ? yi : yr) + 4 * idx, y[r], y[2 + r], y[4 + r], y[6 + r]);
+                else
+                    fft_store4_s4_512d((r ? yi : yr) + 4 * idx, y[r], y[2 + r], y[4 + r], y[6 + r]);
+            }
+        }
+    }
+}
+
+// last stage when log2(n) is odd, stride n/2 and no twiddles
+static inline void fft_radix2_stage512d(int n, const double *xr, const double *xi, double *yr, double *yi)
+{
+    int n2 = n / 2;
+    for (int q = 0; q < n2; q += AVX512_LEN_DOUBLE) {
+        v8sd ar = _mm512_loadu_pd(xr + q), ai = _mm512_loadu_pd(xi + q);
+        v8sd br = _mm512_loadu_pd(xr + q + n2), bi = _mm512_loadu_pd(xi + q + n2);
+        _mm512_storeu_pd(yr + q, _mm512_add_pd(ar, br));
+        _mm512_storeu_pd(yi + q, _mm512_add_pd(ai, bi));
+        _mm512_storeu_pd(yr + q + n2, _mm512_sub_pd(ar, br));
+        _mm512_storeu_pd(yi + q + n2, _mm512_sub_pd(ai, bi));
+    }
+}
+
+static inline void fft_split_core512d(const fft_plan64_t *plan, double *srcRe, double *srcIm, double *dstRe, double *dstIm)
+{
+    int n = plan->n;
+    if ((n / 4) < AVX512_LEN_DOUBLE) {
+        fft_split_cored_C(plan, srcRe, srcIm, dstRe, dstIm);
+        return;
+    }
+
+    int nb_stages = plan->log2n / 2 + (plan->log2n & 1);
+    double *xr = srcRe, *xi = srcIm;
+    int s = 1;
+    for (int stage = 0; stage < nb_stages; stage++) {
+        double *yr = fft_stage_outd(plan, stage, nb_stages, dstRe);
+        double *yi = (yr == dstRe) ? dstIm : yr + n;
+        if (s < n / 2 || !(plan->log2n & 1)) {
+            fft_radix4_stage512d(plan, s, xr, xi, yr, yi);
+            s *= 4;
+        } else {
+            fft_radix2_stage512d(n, xr, xi, yr, yi);
+        }
+        xr = yr;
+        xi = yi;
+    }
+}
+
+SIMD_UTILS_API void fft512d_split(fft_plan64_t *plan, double *srcRe, double *srcIm, double *dstRe, double *dstIm)
+{
+    fft_split_core512d(plan, srcRe, srcIm, dstRe, dstIm);
+}
+
+SIMD_UTILS_API void ifft512d_split(fft_plan64_t *plan, double *srcRe, double *srcIm, double *dstRe, double *dstIm)
+{
+    fft_split_core512d(plan, srcIm, srcRe, dstIm, dstRe);
+}
+
+SIMD_UTILS_API void fft512d(fft_plan64_t *plan, complex64_t *src, complex64_t *dst)
+{
+    double *re = plan->work + 4 * plan->n;
+    double *im = re + plan->n;
+    cplxtoreal512d(src, re, im, plan->n);
+    fft_split_core512d(plan, re, im, re, im);
+    realtocplx512d(re, im, dst, plan->n);
+}
+
+SIMD_UTILS_API void ifft512d(fft_plan64_t *plan, complex64_t *src, complex64_t *dst)
+{
+    double *re = plan->work + 4 * plan->n;
+    double *im = re + plan->n;
+    cplxtoreal512d(src, re, im, plan->n);
+    fft_split_core512d(plan, im, re, im, re);
+    realtocplx512d(re, im, dst, plan->n);
+}
+
+// src has plan->real_n points, dst the plan->real_n / 2 + 1 first bins
+SIMD_UTILS_API void rfft512d(fft_plan64_t *plan, double *src, complex64_t *dst)
+{
+    int n = plan->n;
+    double *re = plan->work + 4 * n;
+    double *im = re + n;
+    cplxtoreal512d((complex64_t *) src, re, im, n);
+    fft_split_core512d(plan, re, im, re, im);
+
+    v8sd half = _mm512_set1_pd(0.5);
+    int k = 1;
+    for (; (k + AVX512_LEN_DOUBLE) <= n; k += AVX512_LEN_DOUBLE) {
+        v8sd a = _mm512_loadu_pd(re + k), b = _mm512_loadu_pd(im + k);
+        v8sd c = fft_reverse512d(_mm512_loadu_pd(re + n - k - AVX512_LEN_DOUBLE + 1));
+        v8sd d = fft_reverse512d(_mm512_loadu_pd(im + n - k - AVX512_LEN_DOUBLE + 1));
+        v8sd wr = _mm512_loadu_pd(plan->rtw + k), wi = _mm512_loadu_pd(plan->rtw + n + k);
+        v8sd hs = _mm512_add_pd(a, c), hd = _mm512_sub_pd(b, d);
+        v8sd fr = _mm512_add_pd(b, d), fi = _mm512_sub_pd(c, a);
+        v8sdx2 out;
+        out.val[0] = _mm512_mul_pd(half, _mm512_fnmadd_pd_custom(wi, fi, _mm512_fmadd_pd_custom(wr, fr, hs)));
+        out.val[1] = _mm512_mul_pd(half, _mm512_fmadd_pd_custom(wi, fr, _mm512_fmadd_pd_custom(wr, fi, hd)));
+        _mm512_store2u_pd((double *) (dst + k), out);
+    }
+    rfft_postd_C(plan, re, im, dst, k);
+}
+
+// src has the plan->real_n / 2 + 1 first bins, dst plan->real_n points, not normalized
+SIMD_UTILS_API void irfft512d(fft_plan64_t *plan, complex64_t *src, double *dst)
+{
+    int n = plan->n;
+    double *re = plan->work + 4 * n;
+    double *im = re + n;
+
+    int k = 0;
+    for (; (k + AVX512_LEN_DOUBLE) <= n; k += AVX512_LEN_DOUBLE) {
+        v8sdx2 x = _mm512_load2u_pd((double *) (src + k));
+        v8sdx2 xc = _mm512_load2u_pd((double *) (src + n - k - AVX512_LEN_DOUBLE + 1));
+        v8sd c = fft_reverse512d(xc.val[0]), d = fft_reverse512d(xc.val[1]);
+        v8sd wr = _mm512_loadu_pd(plan->rtw + k), wi = _mm512_loadu_pd(plan->rtw + n + k);
+        v8sd amc = _mm512_sub_pd(x.val[0], c), bpd = _mm512_add_pd(x.val[1], d);
+        v8sd zr = _mm512_fnmadd_pd_custom(bpd, wr, _mm512_add_pd(x.val[0], c));
+        v8sd zi = _mm512_fmadd_pd_custom(amc, wr, _mm512_sub_pd(x.val[1], d));
+        _mm512_storeu_pd(re + k, _mm512_fmadd_pd_custom(amc, wi, zr));
+        _mm512_storeu_pd(im + k, _mm512_fmadd_pd_custom(bpd, wi, zi));
+    }
+    irfft_pred_C(plan, src, re, im, k);
+
+    fft_split_core512d(plan, im, re, im, re);
+    realtocplx512d(re, im, (complex64_t *) dst, n);
+}
+
+/* FIR kernel and convolutions (see simd_utils_fir.h and simd_utils_conv.h) */
+
+// dst[i] = (dst[i] if accumulate) + sum_m taps[m] * src[i + m], 8 vectors of outputs per pass on the taps
+static inline void fir_kernel512d(const double *taps, int nb_taps, const double *src, double *dst, int len, int accumulate)
+{
+    int i = 0;
+    for (; (i + 8 * AVX512_LEN_DOUBLE) <= len; i += 8 * AVX512_LEN_DOUBLE) {
+        v8sd acc[8];
+        for (int k = 0; k < 8; k++)
+            acc[k] = accumulate ? _mm512_loadu_pd(dst + i + k * AVX512_LEN_DOUBLE) : _mm512_setzero_pd();
+        const double *s = src + i;
+        for (int m = 0; m < nb_taps; m++) {
+            v8sd tap = _mm512_set1_pd(taps[m]);
+            acc[0] = _mm512_fmadd_pd_custom(tap, _mm512_loadu_pd(s + m), acc[0]);
+            acc[1] = _mm512_fmadd_pd_custom(tap, _mm512_loadu_pd(s + m + AVX512_LEN_DOUBLE), acc[1]);
+            acc[2] = _mm512_fmadd_pd_custom(tap, _mm512_loadu_pd(s + m + 2 * AVX512_LEN_DOUBLE), acc[2]);
+            acc[3] = _mm512_fmadd_pd_custom(tap, _mm512_loadu_pd(s + m + 3 * AVX512_LEN_DOUBLE), acc[3]);
+            acc[4] = _mm512_fmadd_pd_custom(tap, _mm512_loadu_pd(s + m + 4 * AVX512_LEN_DOUBLE), acc[4]);
+            acc[5] = _mm512_fmadd_pd_custom(tap, _mm512_loadu_pd(s + m + 5 * AVX512_LEN_DOUBLE), acc[5]);
+            acc[6] = _mm512_fmadd_pd_custom(tap, _mm512_loadu_pd(s + m + 6 * AVX512_LEN_DOUBLE), acc[6]);
+            acc[7] = _mm512_fmadd_pd_custom(tap, _mm512_loadu_pd(s + m + 7 * AVX512_LEN_DOUBLE), acc[7]);
+        }
+        for (int k = 0; k < 8; k++)
+            _mm512_storeu_pd(dst + i + k * AVX512_LEN_DOUBLE, acc[k]);
+    }
+
+    for (; (i + AVX512_LEN_DOUBLE) <= len; i += AVX512_LEN_DOUBLE) {
+        v8sd acc = accumulate ? _mm512_loadu_pd(dst + i) : _mm512_setzero_pd();
+        for (int m = 0; m < nb_taps; m++)
+            acc = _mm512_fmadd_pd_custom(_mm512_set1_pd(taps[m]), _mm512_loadu_pd(src + i + m), acc);
+        _mm512_storeu_pd(dst + i, acc);
+    }
+
+    if (i < len) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd acc = accumulate ? _mm512_maskz_loadu_pd(mask, dst + i) : _mm512_setzero_pd();
+        for (int m = 0; m < nb_taps; m++)
+            acc = _mm512_fmadd_pd_custom(_mm512_set1_pd(taps[m]), _mm512_maskz_loadu_pd(mask, src + i + m), acc);
+        _mm512_mask_storeu_pd(dst + i, mask, acc);
+    }
+}
+
+SIMD_UTILS_API void cplxvecmul512d(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len)
+{
+    int stop_len = len / (AVX512_LEN_DOUBLE);
+    stop_len = stop_len * AVX512_LEN_DOUBLE;
+
+    int i;
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (i = 0; i < 2 * stop_len; i += AVX512_LEN_DOUBLE) {
+            v8sd src1_tmp = _mm512_load_pd((double *) (src1) + i);  // src1 = b0,a0 (little endian)
+            v8sd src2_tmp = _mm512_load_pd((double *) (src2) + i);  // src2 = d0,c0
+            v8sd tmp1 = _mm512_movedup_pd(src1_tmp);  // a0,a0
+            v8sd tmp2 = _mm512_permute_pd(src2_tmp, 0x55);  // c0,d0
+            v8sd tmp3 = _mm512_permute_pd(src1_tmp, 0xFF);  // b0,b0
+            v8sd out = _mm512_mul_pd(tmp2, tmp3);
+            out = _mm512_fmaddsub_pd_custom(tmp1, src2_tmp, out);
+            _mm512_store_pd((double *) (dst) + i, out);
+        }
+    } else {
+        for (i = 0; i < 2 * stop_len; i += AVX512_LEN_DOUBLE) {
+            v8sd src1_tmp = _mm512_loadu_pd((double *) (src1) + i);  // src1 = b0,a0 (little endian)
+            v8sd src2_tmp = _mm512_loadu_pd((double *) (src2) + i);  // src2 = d0,c0
+            v8sd tmp1 = _mm512_movedup_pd(src1_tmp);  // a0,a0
+            v8sd tmp2 = _mm512_permute_pd(src2_tmp, 0x55);  // c0,d0
+            v8sd tmp3 = _mm512_permute_pd(src1_tmp, 0xFF);  // b0,b0
+            v8sd out = _mm512_mul_pd(tmp2, tmp3);
+            out = _mm512_fmaddsub_pd_custom(tmp1, src2_tmp, out);
+            _mm512_storeu_pd((double *) (dst) + i, out);
+        }
+    }
+
+    for (i = 2 * stop_len; i < 2 * len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(2 * len - i);
+        v8sd src1_tmp = _mm512_maskz_loadu_pd(mask, (double *) (src1) + i);
+        v8sd src2_tmp = _mm512_maskz_loadu_pd(mask, (double *) (src2) + i);
+        v8sd tmp1 = _mm512_movedup_pd(src1_tmp);
+        v8sd tmp2 = _mm512_permute_pd(src2_tmp, 0x55);
+        v8sd tmp3 = _mm512_permute_pd(src1_tmp, 0xFF);
+        v8sd out = _mm512_mul_pd(tmp2, tmp3);
+        out = _mm512_fmaddsub_pd_custom(tmp1, src2_tmp, out);
+        _mm512_mask_storeu_pd((double *) (dst) + i, mask, out);
+    }
+}
+
+SIMD_UTILS_API void cplxvecmul512d_split(double *src1Re, double *src1Im, double *src2Re, double *src2Im, double *dstRe, double *dstIm, int len)
+{
+    int stop_len = len / AVX512_LEN_DOUBLE;
+    stop_len *= AVX512_LEN_DOUBLE;
+
+    if (areAligned3((uintptr_t) (src1Re), (uintptr_t) (src1Im), (uintptr_t) (src2Re), AVX512_LEN_BYTES) &&
+        areAligned3((uintptr_t) (src2Im), (uintptr_t) (dstRe), (uintptr_t) (dstIm), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+            v8sd src1Re_tmp = _mm512_load_pd(src1Re + i);
+            v8sd src1Im_tmp = _mm512_load_pd(src1Im + i);
+            v8sd src2Re_tmp = _mm512_load_pd(src2Re + i);
+            v8sd src2Im_tmp = _mm512_load_pd(src2Im + i);
+            v8sd bc = _mm512_mul_pd(src1Im_tmp, src2Re_tmp);
+            v8sd ac = _mm512_mul_pd(src1Re_tmp, src2Re_tmp);
+            v8sd dstRe_tmp = _mm512_fnmadd_pd_custom(src1Im_tmp, src2Im_tmp, ac);  // ac - bd
+            v8sd dstIm_tmp = _mm512_fmadd_pd_custom(src1Re_tmp, src2Im_tmp, bc);   // ad + bc
+            _mm512_store_pd(dstRe + i, dstRe_tmp);
+            _mm512_store_pd(dstIm + i, dstIm_tmp);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+            v8sd src1Re_tmp = _mm512_loadu_pd(src1Re + i);
+            v8sd src1Im_tmp = _mm512_loadu_pd(src1Im + i);
+            v8sd src2Re_tmp = _mm512_loadu_pd(src2Re + i);
+            v8sd src2Im_tmp = _mm512_loadu_pd(src2Im + i);
+            v8sd bc = _mm512_mul_pd(src1Im_tmp, src2Re_tmp);
+            v8sd ac = _mm512_mul_pd(src1Re_tmp, src2Re_tmp);
+            v8sd dstRe_tmp = _mm512_fnmadd_pd_custom(src1Im_tmp, src2Im_tmp, ac);  // ac - bd
+            v8sd dstIm_tmp = _mm512_fmadd_pd_custom(src1Re_tmp, src2Im_tmp, bc);   // ad + bc
+            _mm512_storeu_pd(dstRe + i, dstRe_tmp);
+            _mm512_storeu_pd(dstIm + i, dstIm_tmp);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src1Re_tmp = _mm512_maskz_loadu_pd(mask, src1Re + i);
+        v8sd src1Im_tmp = _mm512_maskz_loadu_pd(mask, src1Im + i);
+        v8sd src2Re_tmp = _mm512_maskz_loadu_pd(mask, src2Re + i);
+        v8sd src2Im_tmp = _mm512_maskz_loadu_pd(mask, src2Im + i);
+        v8sd bc = _mm512_mul_pd(src1Im_tmp, src2Re_tmp);
+        v8sd ac = _mm512_mul_pd(src1Re_tmp, src2Re_tmp);
+        v8sd dstRe_tmp = _mm512_fnmadd_pd_custom(src1Im_tmp, src2Im_tmp, ac);  // ac - bd
+        v8sd dstIm_tmp = _mm512_fmadd_pd_custom(src1Re_tmp, src2Im_tmp, bc);   // ad + bc
+        _mm512_mask_storeu_pd(dstRe + i, mask, dstRe_tmp);
+        _mm512_mask_storeu_pd(dstIm + i, mask, dstIm_tmp);
+    }
+}
+
+SIMD_UTILS_API void cplxconjvecmul512d(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len)
+{
+    int stop_len = len / (AVX512_LEN_DOUBLE);
+    stop_len = stop_len * AVX512_LEN_DOUBLE;
+
+    int i;
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (i = 0; i < 2 * stop_len; i += AVX512_LEN_DOUBLE) {
+            v8sd src1_tmp = _mm512_load_pd((double *) (src1) + i);  // src1 = b0,a0 (little endian)
+            v8sd src2_tmp = _mm512_load_pd((double *) (src2) + i);  // src2 = d0,c0
+            v8sd tmp1 = _mm512_movedup_pd(src1_tmp);          // a0,a0
+            v8sd tmp2 = _mm512_mul_pd(tmp1, src2_tmp);  // a0d0,a0c0
+            v8sd tmp3 = _mm512_permute_pd(src2_tmp, 0x55);           // c0,d0
+            v8sd tmp4 = _mm512_permute_pd(src1_tmp, 0xFF);          // b0,b0
+            v8sd out = _mm512_fmsubadd_pd_custom(tmp3, tmp4, tmp2);  // b0c0 - a0d0, a0c0 + b0d0
+            _mm512_store_pd((double *) (dst) + i, out);
+        }
+    } else {
+        for (i = 0; i < 2 * stop_len; i += AVX512_LEN_DOUBLE) {
+            v8sd src1_tmp = _mm512_loadu_pd((double *) (src1) + i);  // src1 = b0,a0 (little endian)
+            v8sd src2_tmp = _mm512_loadu_pd((double *) (src2) + i);  // src2 = d0,c0
+            v8sd tmp1 = _mm512_movedup_pd(src1_tmp);          // a0,a0
+            v8sd tmp2 = _mm512_mul_pd(tmp1, src2_tmp);  // a0d0,a0c0
+            v8sd tmp3 = _mm512_permute_pd(src2_tmp, 0x55);           // c0,d0
+            v8sd tmp4 = _mm512_permute_pd(src1_tmp, 0xFF);          // b0,b0
+            v8sd out = _mm512_fmsubadd_pd_custom(tmp3, tmp4, tmp2);  // b0c0 - a0d0, a0c0 + b0d0
+            _mm512_storeu_pd((double *) (dst) + i, out);
+        }
+    }
+
+    for (i = 2 * stop_len; i < 2 * len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(2 * len - i);
+        v8sd src1_tmp = _mm512_maskz_loadu_pd(mask, (double *) (src1) + i);
+        v8sd src2_tmp = _mm512_maskz_loadu_pd(mask, (double *) (src2) + i);
+        v8sd tmp1 = _mm512_movedup_pd(src1_tmp);          // a0,a0
+        v8sd tmp2 = _mm512_mul_pd(tmp1, src2_tmp);  // a0d0,a0c0
+        v8sd tmp3 = _mm512_permute_pd(src2_tmp, 0x55);           // c0,d0
+        v8sd tmp4 = _mm512_permute_pd(src1_tmp, 0xFF);          // b0,b0
+        v8sd out = _mm512_fmsubadd_pd_custom(tmp3, tmp4, tmp2);  // b0c0 - a0d0, a0c0 + b0d0
+        _mm512_mask_storeu_pd((double *) (dst) + i, mask, out);
+    }
+}
+
+SIMD_UTILS_API void cplxconjvecmul512d_split(double *src1Re, double *src1Im, double *src2Re, double *src2Im, double *dstRe, double *dstIm, int len)
+{
+    int stop_len = len / AVX512_LEN_DOUBLE;
+    stop_len *= AVX512_LEN_DOUBLE;
+
+    if (areAligned3((uintptr_t) (src1Re), (uintptr_t) (src1Im), (uintptr_t) (src2Re), AVX512_LEN_BYTES) &&
+        areAligned3((uintptr_t) (src2Im), (uintptr_t) (dstRe), (uintptr_t) (dstIm), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+            v8sd src1Re_tmp = _mm512_load_pd(src1Re + i);
+            v8sd src1Im_tmp = _mm512_load_pd(src1Im + i);
+            v8sd src2Re_tmp = _mm512_load_pd(src2Re + i);
+            v8sd src2Im_tmp = _mm512_load_pd(src2Im + i);
+            v8sd bc = _mm512_mul_pd(src1Im_tmp, src2Re_tmp);
+            v8sd ac = _mm512_mul_pd(src1Re_tmp, src2Re_tmp);
+            v8sd dstRe_tmp = _mm512_fmadd_pd_custom(src1Im_tmp, src2Im_tmp, ac);   // ac + bd
+            v8sd dstIm_tmp = _mm512_fnmadd_pd_custom(src1Re_tmp, src2Im_tmp, bc);  // bc - ad
+            _mm512_store_pd(dstRe + i, dstRe_tmp);
+            _mm512_store_pd(dstIm + i, dstIm_tmp);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+            v8sd src1Re_tmp = _mm512_loadu_pd(src1Re + i);
+            v8sd src1Im_tmp = _mm512_loadu_pd(src1Im + i);
+            v8sd src2Re_tmp = _mm512_loadu_pd(src2Re + i);
+            v8sd src2Im_tmp = _mm512_loadu_pd(src2Im + i);
+            v8sd bc = _mm512_mul_pd(src1Im_tmp, src2Re_tmp);
+            v8sd ac = _mm512_mul_pd(src1Re_tmp, src2Re_tmp);
+            v8sd dstRe_tmp = _mm512_fmadd_pd_custom(src1Im_tmp, src2Im_tmp, ac);   // ac + bd
+            v8sd dstIm_tmp = _mm512_fnmadd_pd_custom(src1Re_tmp, src2Im_tmp, bc);  // bc - ad
+            _mm512_storeu_pd(dstRe + i, dstRe_tmp);
+            _mm512_storeu_pd(dstIm + i, dstIm_tmp);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src1Re_tmp = _mm512_maskz_loadu_pd(mask, src1Re + i);
+        v8sd src1Im_tmp = _mm512_maskz_loadu_pd(mask, src1Im + i);
+        v8sd src2Re_tmp = _mm512_maskz_loadu_pd(mask, src2Re + i);
+        v8sd src2Im_tmp = _mm512_maskz_loadu_pd(mask, src2Im + i);
+        v8sd bc = _mm512_mul_pd(src1Im_tmp, src2Re_tmp);
+        v8sd ac = _mm512_mul_pd(src1Re_tmp, src2Re_tmp);
+        v8sd dstRe_tmp = _mm512_fmadd_pd_custom(src1Im_tmp, src2Im_tmp, ac);   // ac + bd
+        v8sd dstIm_tmp = _mm512_fnmadd_pd_custom(src1Re_tmp, src2Im_tmp, bc);  // bc - ad
+        _mm512_mask_storeu_pd(dstRe + i, mask, dstRe_tmp);
+        _mm512_mask_storeu_pd(dstIm + i, mask, dstIm_tmp);
+    }
+}
+
+SIMD_UTILS_API void cplxvecdiv512d(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len)
+{
+    int stop_len = len / (AVX512_LEN_DOUBLE);
+    stop_len = stop_len * AVX512_LEN_DOUBLE;
+
+    int i;
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (i = 0; i < 2 * stop_len; i += AVX512_LEN_DOUBLE) {
+            v8sd src1_tmp = _mm512_load_pd((double *) (src1) + i);  // src1 = b0,a0 (little endian)
+            v8sd src2_tmp = _mm512_load_pd((double *) (src2) + i);  // src2 = d0,c0
+            v8sd tmp1 = _mm512_movedup_pd(src1_tmp);          // a0,a0
+            v8sd tmp2 = _mm512_mul_pd(tmp1, src2_tmp);  // a0d0,a0c0
+            v8sd tmp3 = _mm512_permute_pd(src2_tmp, 0x55);           // c0,d0
+            v8sd tmp4 = _mm512_permute_pd(src1_tmp, 0xFF);          // b0,b0
+            v8sd out = _mm512_fmsubadd_pd_custom(tmp3, tmp4, tmp2);  // b0c0 - a0d0, a0c0 + b0d0
+            v8sd c2d2 = _mm512_mul_pd(src2_tmp, src2_tmp);
+            c2d2 = _mm512_add_pd(c2d2, _mm512_permute_pd(c2d2, 0x55));  // c0^2 + d0^2, c0^2 + d0^2
+            out = _mm512_div_pd(out, c2d2);
+            _mm512_store_pd((double *) (dst) + i, out);
+        }
+    } else {
+        for (i = 0; i < 2 * stop_len; i += AVX512_LEN_DOUBLE) {
+            v8sd src1_tmp = _mm512_loadu_pd((double *) (src1) + i);  // src1 = b0,a0 (little endian)
+            v8sd src2_tmp = _mm512_loadu_pd((double *) (src2) + i);  // src2 = d0,c0
+            v8sd tmp1 = _mm512_movedup_pd(src1_tmp);          // a0,a0
+            v8sd tmp2 = _mm512_mul_pd(tmp1, src2_tmp);  // a0d0,a0c0
+            v8sd tmp3 = _mm512_permute_pd(src2_tmp, 0x55);           // c0,d0
+            v8sd tmp4 = _mm512_permute_pd(src1_tmp, 0xFF);          // b0,b0
+            v8sd out = _mm512_fmsubadd_pd_custom(tmp3, tmp4, tmp2);  // b0c0 - a0d0, a0c0 + b0d0
+            v8sd c2d2 = _mm512_mul_pd(src2_tmp, src2_tmp);
+            c2d2 = _mm512_add_pd(c2d2, _mm512_permute_pd(c2d2, 0x55));  // c0^2 + d0^2, c0^2 + d0^2
+            out = _mm512_div_pd(out, c2d2);
+            _mm512_storeu_pd((double *) (dst) + i, out);
+        }
+    }
+
+    for (i = 2 * stop_len; i < 2 * len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(2 * len - i);
+        v8sd src1_tmp = _mm512_maskz_loadu_pd(mask, (double *) (src1) + i);
+        v8sd src2_tmp = _mm512_maskz_loadu_pd(mask, (double *) (src2) + i);
+        v8sd tmp1 = _mm512_movedup_pd(src1_tmp);          // a0,a0
+        v8sd tmp2 = _mm512_mul_pd(tmp1, src2_tmp);  // a0d0,a0c0
+        v8sd tmp3 = _mm512_permute_pd(src2_tmp, 0x55);           // c0,d0
+        v8sd tmp4 = _mm512_permute_pd(src1_tmp, 0xFF);          // b0,b0
+        v8sd out = _mm512_fmsubadd_pd_custom(tmp3, tmp4, tmp2);  // b0c0 - a0d0, a0c0 + b0d0
+        v8sd c2d2 = _mm512_mul_pd(src2_tmp, src2_tmp);
+        c2d2 = _mm512_add_pd(c2d2, _mm512_permute_pd(c2d2, 0x55));  // c0^2 + d0^2, c0^2 + d0^2
+        out = _mm512_div_pd(out, c2d2);
+        _mm512_mask_storeu_pd((double *) (dst) + i, mask, out);
+    }
+}
+
+SIMD_UTILS_API void cplxvecdiv512d_split(double *src1Re, double *src1Im, double *src2Re, double *src2Im, double *dstRe, double *dstIm, int len)
+{
+    int stop_len = len / AVX512_LEN_DOUBLE;
+    stop_len *= AVX512_LEN_DOUBLE;
+
+    if (areAligned3((uintptr_t) (src1Re), (uintptr_t) (src1Im), (uintptr_t) (src2Re), AVX512_LEN_BYTES) &&
+        areAligned3((uintptr_t) (src2Im), (uintptr_t) (dstRe), (uintptr_t) (dstIm), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+            v8sd src1Re_tmp = _mm512_load_pd(src1Re + i);
+            v8sd src1Im_tmp = _mm512_load_pd(src1Im + i);
+            v8sd src2Re_tmp = _mm512_load_pd(src2Re + i);
+            v8sd src2Im_tmp = _mm512_load_pd(src2Im + i);
+            v8sd bc = _mm512_mul_pd(src1Im_tmp, src2Re_tmp);
+            v8sd ac = _mm512_mul_pd(src1Re_tmp, src2Re_tmp);
+            v8sd dstRe_tmp = _mm512_fmadd_pd_custom(src1Im_tmp, src2Im_tmp, ac);   // ac + bd
+            v8sd dstIm_tmp = _mm512_fnmadd_pd_custom(src1Re_tmp, src2Im_tmp, bc);  // bc - ad
+            v8sd c2d2 = _mm512_fmadd_pd_custom(src2Im_tmp, src2Im_tmp, _mm512_mul_pd(src2Re_tmp, src2Re_tmp));
+            dstRe_tmp = _mm512_div_pd(dstRe_tmp, c2d2);
+            dstIm_tmp = _mm512_div_pd(dstIm_tmp, c2d2);
+            _mm512_store_pd(dstRe + i, dstRe_tmp);
+            _mm512_store_pd(dstIm + i, dstIm_tmp);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+            v8sd src1Re_tmp = _mm512_loadu_pd(src1Re + i);
+            v8sd src1Im_tmp = _mm512_loadu_pd(src1Im + i);
+            v8sd src2Re_tmp = _mm512_loadu_pd(src2Re + i);
+            v8sd src2Im_tmp = _mm512_loadu_pd(src2Im + i);
+            v8sd bc = _mm512_mul_pd(src1Im_tmp, src2Re_tmp);
+            v8sd ac = _mm512_mul_pd(src1Re_tmp, src2Re_tmp);
+            v8sd dstRe_tmp = _mm512_fmadd_pd_custom(src1Im_tmp, src2Im_tmp, ac);   // ac + bd
+            v8sd dstIm_tmp = _mm512_fnmadd_pd_custom(src1Re_tmp, src2Im_tmp, bc);  // bc - ad
+            v8sd c2d2 = _mm512_fmadd_pd_custom(src2Im_tmp, src2Im_tmp, _mm512_mul_pd(src2Re_tmp, src2Re_tmp));
+            dstRe_tmp = _mm512_div_pd(dstRe_tmp, c2d2);
+            dstIm_tmp = _mm512_div_pd(dstIm_tmp, c2d2);
+            _mm512_storeu_pd(dstRe + i, dstRe_tmp);
+            _mm512_storeu_pd(dstIm + i, dstIm_tmp);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src1Re_tmp = _mm512_maskz_loadu_pd(mask, src1Re + i);
+        v8sd src1Im_tmp = _mm512_maskz_loadu_pd(mask, src1Im + i);
+        v8sd src2Re_tmp = _mm512_maskz_loadu_pd(mask, src2Re + i);
+        v8sd src2Im_tmp = _mm512_maskz_loadu_pd(mask, src2Im + i);
+        v8sd bc = _mm512_mul_pd(src1Im_tmp, src2Re_tmp);
+        v8sd ac = _mm512_mul_pd(src1Re_tmp, src2Re_tmp);
+        v8sd dstRe_tmp = _mm512_fmadd_pd_custom(src1Im_tmp, src2Im_tmp, ac);   // ac + bd
+        v8sd dstIm_tmp = _mm512_fnmadd_pd_custom(src1Re_tmp, src2Im_tmp, bc);  // bc - ad
+        v8sd c2d2 = _mm512_fmadd_pd_custom(src2Im_tmp, src2Im_tmp, _mm512_mul_pd(src2Re_tmp, src2Re_tmp));
+        dstRe_tmp = _mm512_div_pd(dstRe_tmp, c2d2);
+        dstIm_tmp = _mm512_div_pd(dstIm_tmp, c2d2);
+        _mm512_mask_storeu_pd(dstRe + i, mask, dstRe_tmp);
+        _mm512_mask_storeu_pd(dstIm + i, mask, dstIm_tmp);
+    }
+}
+
+// prefer using cplxconjvecmulXd if you also need to do a multiply
+SIMD_UTILS_API void cplxconj512d(complex64_t *src, complex64_t *dst, int len)
+{
+    int stop_len = len / AVX512_LEN_DOUBLE;
+    stop_len *= AVX512_LEN_DOUBLE;
+
+    __attribute__((aligned(AVX512_LEN_BYTES))) int64_t conj_mask[AVX512_LEN_DOUBLE] = {0, (int64_t) 0x8000000000000000, 0, (int64_t) 0x8000000000000000, 0, (int64_t) 0x8000000000000000, 0, (int64_t) 0x8000000000000000};
+    v8sd conj_vec = _mm512_load_pd((double *) conj_mask);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < 2 * stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd src_tmp = _mm512_load_pd((double *) (src) + i);
+            v8sd src_tmp2 = _mm512_load_pd((double *) (src) + i + AVX512_LEN_DOUBLE);
+            _mm512_store_pd((double *) (dst) + i, _mm512_xor_pd(src_tmp, conj_vec));
+            _mm512_store_pd((double *) (dst) + i + AVX512_LEN_DOUBLE, _mm512_xor_pd(src_tmp2, conj_vec));
+        }
+    } else {
+        for (int i = 0; i < 2 * stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd src_tmp = _mm512_loadu_pd((double *) (src) + i);
+            v8sd src_tmp2 = _mm512_loadu_pd((double *) (src) + i + AVX512_LEN_DOUBLE);
+            _mm512_storeu_pd((double *) (dst) + i, _mm512_xor_pd(src_tmp, conj_vec));
+            _mm512_storeu_pd((double *) (dst) + i + AVX512_LEN_DOUBLE, _mm512_xor_pd(src_tmp2, conj_vec));
+        }
+    }
+
+    for (int i = 2 * stop_len; i < 2 * len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(2 * len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, (double *) (src) + i);
+        _mm512_mask_storeu_pd((double *) (dst) + i, mask, _mm512_xor_pd(src_tmp, conj_vec));
+    }
+}
+
+SIMD_UTILS_API void magnitude512d_split(double *srcRe, double *srcIm, double *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_DOUBLE);
+    stop_len *= 2 * AVX512_LEN_DOUBLE;
+
+    if (areAligned3((uintptr_t) (srcRe), (uintptr_t) (srcIm), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd re_tmp = _mm512_load_pd(srcRe + i);
+            v8sd im_tmp = _mm512_load_pd(srcIm + i);
+            v8sd re_tmp2 = _mm512_load_pd(srcRe + i + AVX512_LEN_DOUBLE);
+            v8sd im_tmp2 = _mm512_load_pd(srcIm + i + AVX512_LEN_DOUBLE);
+            v8sd dst_tmp = _mm512_fmadd_pd_custom(im_tmp, im_tmp, _mm512_mul_pd(re_tmp, re_tmp));
+            v8sd dst_tmp2 = _mm512_fmadd_pd_custom(im_tmp2, im_tmp2, _mm512_mul_pd(re_tmp2, re_tmp2));
+            _mm512_store_pd(dst + i, _mm512_sqrt_pd(dst_tmp));
+            _mm512_store_pd(dst + i + AVX512_LEN_DOUBLE, _mm512_sqrt_pd(dst_tmp2));
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd re_tmp = _mm512_loadu_pd(srcRe + i);
+            v8sd im_tmp = _mm512_loadu_pd(srcIm + i);
+            v8sd re_tmp2 = _mm512_loadu_pd(srcRe + i + AVX512_LEN_DOUBLE);
+            v8sd im_tmp2 = _mm512_loadu_pd(srcIm + i + AVX512_LEN_DOUBLE);
+            v8sd dst_tmp = _mm512_fmadd_pd_custom(im_tmp, im_tmp, _mm512_mul_pd(re_tmp, re_tmp));
+            v8sd dst_tmp2 = _mm512_fmadd_pd_custom(im_tmp2, im_tmp2, _mm512_mul_pd(re_tmp2, re_tmp2));
+            _mm512_storeu_pd(dst + i, _mm512_sqrt_pd(dst_tmp));
+            _mm512_storeu_pd(dst + i + AVX512_LEN_DOUBLE, _mm512_sqrt_pd(dst_tmp2));
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd re_tmp = _mm512_maskz_loadu_pd(mask, srcRe + i);
+        v8sd im_tmp = _mm512_maskz_loadu_pd(mask, srcIm + i);
+        v8sd dst_tmp = _mm512_fmadd_pd_custom(im_tmp, im_tmp, _mm512_mul_pd(re_tmp, re_tmp));
+        _mm512_mask_storeu_pd(dst + i, mask, _mm512_sqrt_pd(dst_tmp));
+    }
+}
+
+SIMD_UTILS_API void magnitude512d_interleaved(complex64_t *src, double *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_DOUBLE);
+    stop_len *= 2 * AVX512_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sdx2 src_split = _mm512_load2_pd((double *) (src + i));  // a0a1, b0b1
+            v8sdx2 src_split2 = _mm512_load2_pd((double *) (src + i + AVX512_LEN_DOUBLE));
+            v8sd dst_tmp = _mm512_fmadd_pd_custom(src_split.val[1], src_split.val[1], _mm512_mul_pd(src_split.val[0], src_split.val[0]));
+            v8sd dst_tmp2 = _mm512_fmadd_pd_custom(src_split2.val[1], src_split2.val[1], _mm512_mul_pd(src_split2.val[0], src_split2.val[0]));
+            _mm512_store_pd(dst + i, _mm512_sqrt_pd(dst_tmp));
+            _mm512_store_pd(dst + i + AVX512_LEN_DOUBLE, _mm512_sqrt_pd(dst_tmp2));
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sdx2 src_split = _mm512_load2u_pd((double *) (src + i));  // a0a1, b0b1
+            v8sdx2 src_split2 = _mm512_load2u_pd((double *) (src + i + AVX512_LEN_DOUBLE));
+            v8sd dst_tmp = _mm512_fmadd_pd_custom(src_split.val[1], src_split.val[1], _mm512_mul_pd(src_split.val[0], src_split.val[0]));
+            v8sd dst_tmp2 = _mm512_fmadd_pd_custom(src_split2.val[1], src_split2.val[1], _mm512_mul_pd(src_split2.val[0], src_split2.val[0]));
+            _mm512_storeu_pd(dst + i, _mm512_sqrt_pd(dst_tmp));
+            _mm512_storeu_pd(dst + i + AVX512_LEN_DOUBLE, _mm512_sqrt_pd(dst_tmp2));
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        v8sdx2 src_split = _mm512_maskz_load2u_pd(len - i, (double *) (src + i));
+        v8sd dst_tmp = _mm512_fmadd_pd_custom(src_split.val[1], src_split.val[1], _mm512_mul_pd(src_split.val[0], src_split.val[0]));
+        _mm512_mask_storeu_pd(dst + i, tail_mask8(len - i), _mm512_sqrt_pd(dst_tmp));
+    }
+}
+
+SIMD_UTILS_API void powerspect512d_split(double *srcRe, double *srcIm, double *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_DOUBLE);
+    stop_len *= 2 * AVX512_LEN_DOUBLE;
+
+    if (areAligned3((uintptr_t) (srcRe), (uintptr_t) (srcIm), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd re_tmp = _mm512_load_pd(srcRe + i);
+            v8sd im_tmp = _mm512_load_pd(srcIm + i);
+            v8sd re_tmp2 = _mm512_load_pd(srcRe + i + AVX512_LEN_DOUBLE);
+            v8sd im_tmp2 = _mm512_load_pd(srcIm + i + AVX512_LEN_DOUBLE);
+            v8sd dst_tmp = _mm512_fmadd_pd_custom(im_tmp, im_tmp, _mm512_mul_pd(re_tmp, re_tmp));
+            v8sd dst_tmp2 = _mm512_fmadd_pd_custom(im_tmp2, im_tmp2, _mm512_mul_pd(re_tmp2, re_tmp2));
+            _mm512_store_pd(dst + i, dst_tmp);
+            _mm512_store_pd(dst + i + AVX512_LEN_DOUBLE, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd re_tmp = _mm512_loadu_pd(srcRe + i);
+            v8sd im_tmp = _mm512_loadu_pd(srcIm + i);
+            v8sd re_tmp2 = _mm512_loadu_pd(srcRe + i + AVX512_LEN_DOUBLE);
+            v8sd im_tmp2 = _mm512_loadu_pd(srcIm + i + AVX512_LEN_DOUBLE);
+            v8sd dst_tmp = _mm512_fmadd_pd_custom(im_tmp, im_tmp, _mm512_mul_pd(re_tmp, re_tmp));
+            v8sd dst_tmp2 = _mm512_fmadd_pd_custom(im_tmp2, im_tmp2, _mm512_mul_pd(re_tmp2, re_tmp2));
+            _mm512_storeu_pd(dst + i, dst_tmp);
+            _mm512_storeu_pd(dst + i + AVX512_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd re_tmp = _mm512_maskz_loadu_pd(mask, srcRe + i);
+        v8sd im_tmp = _mm512_maskz_loadu_pd(mask, srcIm + i);
+        v8sd dst_tmp = _mm512_fmadd_pd_custom(im_tmp, im_tmp, _mm512_mul_pd(re_tmp, re_tmp));
+        _mm512_mask_storeu_pd(dst + i, mask, dst_tmp);
+    }
+}
+
+SIMD_UTILS_API void powerspect512d_interleaved(complex64_t *src, double *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_DOUBLE);
+    stop_len *= 2 * AVX512_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sdx2 src_split = _mm512_load2_pd((double *) (src + i));  // a0a1, b0b1
+            v8sdx2 src_split2 = _mm512_load2_pd((double *) (src + i + AVX512_LEN_DOUBLE));
+            v8sd dst_tmp = _mm512_fmadd_pd_custom(src_split.val[1], src_split.val[1], _mm512_mul_pd(src_split.val[0], src_split.val[0]));
+            v8sd dst_tmp2 = _mm512_fmadd_pd_custom(src_split2.val[1], src_split2.val[1], _mm512_mul_pd(src_split2.val[0], src_split2.val[0]));
+            _mm512_store_pd(dst + i, dst_tmp);
+            _mm512_store_pd(dst + i + AVX512_LEN_DOUBLE, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sdx2 src_split = _mm512_load2u_pd((double *) (src + i));  // a0a1, b0b1
+            v8sdx2 src_split2 = _mm512_load2u_pd((double *) (src + i + AVX512_LEN_DOUBLE));
+            v8sd dst_tmp = _mm512_fmadd_pd_custom(src_split.val[1], src_split.val[1], _mm512_mul_pd(src_split.val[0], src_split.val[0]));
+            v8sd dst_tmp2 = _mm512_fmadd_pd_custom(src_split2.val[1], src_split2.val[1], _mm512_mul_pd(src_split2.val[0], src_split2.val[0]));
+            _mm512_storeu_pd(dst + i, dst_tmp);
+            _mm512_storeu_pd(dst + i + AVX512_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        v8sdx2 src_split = _mm512_maskz_load2u_pd(len - i, (double *) (src + i));
+        v8sd dst_tmp = _mm512_fmadd_pd_custom(src_split.val[1], src_split.val[1], _mm512_mul_pd(src_split.val[0], src_split.val[0]));
+        _mm512_mask_storeu_pd(dst + i, tail_mask8(len - i), dst_tmp);
+    }
+}
+
+static inline void conv_block512d(conv64_t *conv)
+{
+    rfft512d(conv->plan, conv->buf, (complex64_t *) conv->work);
+    cplxvecmul512d((complex64_t *) conv->work, (complex64_t *) conv->spectrum, (complex64_t *) conv->out, conv->fft_len / 2 + 1);
+    irfft512d(conv->plan, (complex64_t *) conv->out, conv->out);
+}
+
+// returns len
+SIMD_UTILS_API int conv512d(conv64_t *conv, double *src, double *dst, int len)
+{
+    return conv_rund(conv, fir_kernel512d, conv_block512d, src, dst, len);
+}
+
+SIMD_UTILS_API void minmax512d(double *src, int len, double *min_value, double *max_value)
+{
+    int stop_len = (len - AVX512_LEN_DOUBLE) / (2 * AVX512_LEN_DOUBLE);
+    stop_len *= (2 * AVX512_LEN_DOUBLE);
+    stop_len = (stop_len < 0) ? 0 : stop_len;
+
+    v8sd max_v, min_v, max_v2, min_v2;
+    v8sd src_tmp, src_tmp2;
+
+    double min_tmp = src[0];
+    double max_tmp = src[0];
+
+    if (len >= AVX512_LEN_DOUBLE) {
+        if (isAligned((uintptr_t) (src), AVX512_LEN_BYTES)) {
+            src_tmp = _mm512_load_pd(src + 0);
+            max_v = src_tmp;
+            min_v = src_tmp;
+            max_v2 = src_tmp;
+            min_v2 = src_tmp;
+
+            for (int i = AVX512_LEN_DOUBLE; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+                src_tmp = _mm512_load_pd(src + i);
+                src_tmp2 = _mm512_load_pd(src + i + AVX512_LEN_DOUBLE);
+                max_v = _mm512_max_pd(max_v, src_tmp);
+                min_v = _mm512_min_pd(min_v, src_tmp);
+                max_v2 = _mm512_max_pd(max_v2, src_tmp2);
+                min_v2 = _mm512_min_pd(min_v2, src_tmp2);
+            }
+        } else {
+            src_tmp = _mm512_loadu_pd(src + 0);
+            max_v = src_tmp;
+            min_v = src_tmp;
+            max_v2 = src_tmp;
+            min_v2 = src_tmp;
+
+            for (int i = AVX512_LEN_DOUBLE; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+                src_tmp = _mm512_loadu_pd(src + i);
+                src_tmp2 = _mm512_loadu_pd(src + i + AVX512_LEN_DOUBLE);
+                max_v = _mm512_max_pd(max_v, src_tmp);
+                min_v = _mm512_min_pd(min_v, src_tmp);
+                max_v2 = _mm512_max_pd(max_v2, src_tmp2);
+                min_v2 = _mm512_min_pd(min_v2, src_tmp2);
+            }
+        }
+
+        for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+            __mmask8 mask = tail_mask8(len - i);
+            src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+            max_v = _mm512_mask_max_pd(max_v, mask, max_v, src_tmp);
+            min_v = _mm512_mask_min_pd(min_v, mask, min_v, src_tmp);
+        }
+
+        max_v = _mm512_max_pd(max_v, max_v2);
+        min_v = _mm512_min_pd(min_v, min_v2);
+
+        min_tmp = _mm512_reduce_min_pd(min_v);
+        max_tmp = _mm512_reduce_max_pd(max_v);
+    } else {
+        for (int i = 1; i < len; i++) {
+            max_tmp = max_tmp > src[i] ? max_tmp : src[i];
+            min_tmp = min_tmp < src[i] ? min_tmp : src[i];
+        }
+    }
+
+    *max_value = max_tmp;
+    *min_value = min_tmp;
+}
+
+// exp(x - max) / sum of exp(x - max) : the largest element gives 1, so the sum cannot overflow
+SIMD_UTILS_API void softmax512d(double *src, double *dst, int len)
+{
+    int stop_len = len / AVX512_LEN_DOUBLE;
+    stop_len *= AVX512_LEN_DOUBLE;
+
+    __attribute__((aligned(AVX512_LEN_BYTES))) double accumulate[AVX512_LEN_DOUBLE];
+    double min_value, max_value, acc = 0.0;
+
+    if (len <= 0)
+        return;
+
+    minmax512d(src, len, &min_value, &max_value);
+    v8sd max_vec = _mm512_set1_pd(max_value);
+    v8sd vec_acc = _mm512_setzero_pd();
+
+    for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+        v8sd src_tmp = _mm512_max_pd(_mm512_sub_pd(_mm512_loadu_pd(src + i), max_vec), *(v8sd *) _pd512_exp_min);
+        v8sd dst_tmp = exp512_pd(src_tmp);
+        vec_acc = _mm512_add_pd(vec_acc, dst_tmp);
+        _mm512_storeu_pd(dst + i, dst_tmp);
+    }
+
+    if (stop_len < len) {
+        __mmask8 mask = tail_mask8(len - stop_len);
+        v8sd src_tmp = _mm512_max_pd(_mm512_sub_pd(_mm512_maskz_loadu_pd(mask, src + stop_len), max_vec), *(v8sd *) _pd512_exp_min);
+        v8sd dst_tmp = exp512_pd(src_tmp);
+        vec_acc = _mm512_mask_add_pd(vec_acc, mask, vec_acc, dst_tmp);
+        _mm512_mask_storeu_pd(dst + stop_len, mask, dst_tmp);
+    }
+    _mm512_store_pd(accumulate, vec_acc);
+    for (int i = 0; i < AVX512_LEN_DOUBLE; i++) {
+        acc += accumulate[i];
+    }
+
+    v8sd acc_vec = _mm512_set1_pd(acc);
+    for (int i = 0; i < stop_len; i += AVX512_LEN_DOUBLE) {
+        _mm512_storeu_pd(dst + i, _mm512_div_pd(_mm512_loadu_pd(dst + i), acc_vec));
+    }
+
+    if (stop_len < len) {
+        __mmask8 mask = tail_mask8(len - stop_len);
+        v8sd dst_tmp = _mm512_maskz_loadu_pd(mask, dst + stop_len);
+        _mm512_mask_storeu_pd(dst + stop_len, mask, _mm512_div_pd(dst_tmp, acc_vec));
+    }
+}
+
+// first index of value in src, len if it is not found
+static inline int firsteq512d(double *src, int len, double value)
+{
+    int stop_len = len / (2 * AVX512_LEN_DOUBLE);
+    stop_len *= (2 * AVX512_LEN_DOUBLE);
+
+    v8sd value_v = _mm512_set1_pd(value);
+    for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+        uint32_t mask = (uint32_t) _mm512_cmp_pd_mask(_mm512_loadu_pd(src + i), value_v, _CMP_EQ_OQ);
+        mask |= (uint32_t) _mm512_cmp_pd_mask(_mm512_loadu_pd(src + i + AVX512_LEN_DOUBLE), value_v, _CMP_EQ_OQ) << 8;
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 tail = tail_mask8(len - i);
+        __mmask8 mask = _mm512_mask_cmp_pd_mask(tail, _mm512_maskz_loadu_pd(tail, src + i), value_v, _CMP_EQ_OQ);
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+    return len;
+}
+
+SIMD_UTILS_API void maxloc512d(double *src, double *max, int *idx, int len)
+{
+    minmaxloc_rund(src, len, minmax512d, firsteq512d, NULL, NULL, max, idx);
+}
+
+SIMD_UTILS_API void minloc512d(double *src, double *min, int *idx, int len)
+{
+    minmaxloc_rund(src, len, minmax512d, firsteq512d, min, idx, NULL, NULL);
+}
+
+SIMD_UTILS_API void minmaxloc512d(double *src, int len, double *min_value, int *min_idx, double *max_value, int *max_idx)
+{
+    minmaxloc_rund(src, len, minmax512d, firsteq512d, min_value, min_idx, max_value, max_idx);
+}
+
+SIMD_UTILS_API void maxevery512d(double *src1, double *src2, double *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_DOUBLE);
+    stop_len *= (2 * AVX512_LEN_DOUBLE);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd src1_tmp = _mm512_load_pd(src1 + i);
+            v8sd src2_tmp = _mm512_load_pd(src2 + i);
+            v8sd src1_tmp2 = _mm512_load_pd(src1 + i + AVX512_LEN_DOUBLE);
+            v8sd src2_tmp2 = _mm512_load_pd(src2 + i + AVX512_LEN_DOUBLE);
+            v8sd dst_tmp = _mm512_max_pd(src1_tmp, src2_tmp);
+            v8sd dst_tmp2 = _mm512_max_pd(src1_tmp2, src2_tmp2);
+            _mm512_store_pd(dst + i, dst_tmp);
+            _mm512_store_pd(dst + i + AVX512_LEN_DOUBLE, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd src1_tmp = _mm512_loadu_pd(src1 + i);
+            v8sd src2_tmp = _mm512_loadu_pd(src2 + i);
+            v8sd src1_tmp2 = _mm512_loadu_pd(src1 + i + AVX512_LEN_DOUBLE);
+            v8sd src2_tmp2 = _mm512_loadu_pd(src2 + i + AVX512_LEN_DOUBLE);
+            v8sd dst_tmp = _mm512_max_pd(src1_tmp, src2_tmp);
+            v8sd dst_tmp2 = _mm512_max_pd(src1_tmp2, src2_tmp2);
+            _mm512_storeu_pd(dst + i, dst_tmp);
+            _mm512_storeu_pd(dst + i + AVX512_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src1_tmp = _mm512_maskz_loadu_pd(mask, src1 + i);
+        v8sd src2_tmp = _mm512_maskz_loadu_pd(mask, src2 + i);
+        v8sd dst_tmp = _mm512_max_pd(src1_tmp, src2_tmp);
+        _mm512_mask_storeu_pd(dst + i, mask, dst_tmp);
+    }
+}
+
+SIMD_UTILS_API void minevery512d(double *src1, double *src2, double *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_DOUBLE);
+    stop_len *= (2 * AVX512_LEN_DOUBLE);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd src1_tmp = _mm512_load_pd(src1 + i);
+            v8sd src2_tmp = _mm512_load_pd(src2 + i);
+            v8sd src1_tmp2 = _mm512_load_pd(src1 + i + AVX512_LEN_DOUBLE);
+            v8sd src2_tmp2 = _mm512_load_pd(src2 + i + AVX512_LEN_DOUBLE);
+            v8sd dst_tmp = _mm512_min_pd(src1_tmp, src2_tmp);
+            v8sd dst_tmp2 = _mm512_min_pd(src1_tmp2, src2_tmp2);
+            _mm512_store_pd(dst + i, dst_tmp);
+            _mm512_store_pd(dst + i + AVX512_LEN_DOUBLE, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd src1_tmp = _mm512_loadu_pd(src1 + i);
+            v8sd src2_tmp = _mm512_loadu_pd(src2 + i);
+            v8sd src1_tmp2 = _mm512_loadu_pd(src1 + i + AVX512_LEN_DOUBLE);
+            v8sd src2_tmp2 = _mm512_loadu_pd(src2 + i + AVX512_LEN_DOUBLE);
+            v8sd dst_tmp = _mm512_min_pd(src1_tmp, src2_tmp);
+            v8sd dst_tmp2 = _mm512_min_pd(src1_tmp2, src2_tmp2);
+            _mm512_storeu_pd(dst + i, dst_tmp);
+            _mm512_storeu_pd(dst + i + AVX512_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src1_tmp = _mm512_maskz_loadu_pd(mask, src1 + i);
+        v8sd src2_tmp = _mm512_maskz_loadu_pd(mask, src2 + i);
+        v8sd dst_tmp = _mm512_min_pd(src1_tmp, src2_tmp);
+        _mm512_mask_storeu_pd(dst + i, mask, dst_tmp);
+    }
+}
+
+SIMD_UTILS_API void threshold512_gt_d(double *src, double *dst, int len, double value)
+{
+    const v8sd pval = _mm512_set1_pd(value);
+
+    int stop_len = len / (2 * AVX512_LEN_DOUBLE);
+    stop_len *= (2 * AVX512_LEN_DOUBLE);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd src_tmp = _mm512_load_pd(src + i);
+            v8sd src_tmp2 = _mm512_load_pd(src + i + AVX512_LEN_DOUBLE);
+            v8sd dst_tmp = _mm512_min_pd(src_tmp, pval);
+            v8sd dst_tmp2 = _mm512_min_pd(src_tmp2, pval);
+            _mm512_store_pd(dst + i, dst_tmp);
+            _mm512_store_pd(dst + i + AVX512_LEN_DOUBLE, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd src_tmp = _mm512_loadu_pd(src + i);
+            v8sd src_tmp2 = _mm512_loadu_pd(src + i + AVX512_LEN_DOUBLE);
+            v8sd dst_tmp = _mm512_min_pd(src_tmp, pval);
+            v8sd dst_tmp2 = _mm512_min_pd(src_tmp2, pval);
+            _mm512_storeu_pd(dst + i, dst_tmp);
+            _mm512_storeu_pd(dst + i + AVX512_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        v8sd dst_tmp = _mm512_min_pd(src_tmp, pval);
+        _mm512_mask_storeu_pd(dst + i, mask, dst_tmp);
+    }
+}
+
+SIMD_UTILS_API void threshold512_gtabs_d(double *src, double *dst, int len, double value)
+{
+    const v8sd pval = _mm512_set1_pd(value);
+
+    int stop_len = len / (2 * AVX512_LEN_DOUBLE);
+    stop_len *= (2 * AVX512_LEN_DOUBLE);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd src_tmp = _mm512_load_pd(src + i);
+            v8sd src_tmp2 = _mm512_load_pd(src + i + AVX512_LEN_DOUBLE);
+            v8sd src_sign = _mm512_and_pd(src_tmp, *(v8sd *) _pd512_negative_mask);  // extract sign
+            v8sd src_abs = _mm512_and_pd(src_tmp, *(v8sd *) _pd512_positive_mask);   // take absolute value
+            v8sd dst_tmp = _mm512_xor_pd(_mm512_min_pd(src_abs, pval), src_sign);
+            v8sd src_sign2 = _mm512_and_pd(src_tmp2, *(v8sd *) _pd512_negative_mask);  // extract sign
+            v8sd src_abs2 = _mm512_and_pd(src_tmp2, *(v8sd *) _pd512_positive_mask);   // take absolute value
+            v8sd dst_tmp2 = _mm512_xor_pd(_mm512_min_pd(src_abs2, pval), src_sign2);
+            _mm512_store_pd(dst + i, dst_tmp);
+            _mm512_store_pd(dst + i + AVX512_LEN_DOUBLE, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd src_tmp = _mm512_loadu_pd(src + i);
+            v8sd src_tmp2 = _mm512_loadu_pd(src + i + AVX512_LEN_DOUBLE);
+            v8sd src_sign = _mm512_and_pd(src_tmp, *(v8sd *) _pd512_negative_mask);  // extract sign
+            v8sd src_abs = _mm512_and_pd(src_tmp, *(v8sd *) _pd512_positive_mask);   // take absolute value
+            v8sd dst_tmp = _mm512_xor_pd(_mm512_min_pd(src_abs, pval), src_sign);
+            v8sd src_sign2 = _mm512_and_pd(src_tmp2, *(v8sd *) _pd512_negative_mask);  // extract sign
+            v8sd src_abs2 = _mm512_and_pd(src_tmp2, *(v8sd *) _pd512_positive_mask);   // take absolute value
+            v8sd dst_tmp2 = _mm512_xor_pd(_mm512_min_pd(src_abs2, pval), src_sign2);
+            _mm512_storeu_pd(dst + i, dst_tmp);
+            _mm512_storeu_pd(dst + i + AVX512_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        v8sd src_sign = _mm512_and_pd(src_tmp, *(v8sd *) _pd512_negative_mask);  // extract sign
+        v8sd src_abs = _mm512_and_pd(src_tmp, *(v8sd *) _pd512_positive_mask);   // take absolute value
+        v8sd dst_tmp = _mm512_xor_pd(_mm512_min_pd(src_abs, pval), src_sign);
+        _mm512_mask_storeu_pd(dst + i, mask, dst_tmp);
+    }
+}
+
+SIMD_UTILS_API void threshold512_lt_d(double *src, double *dst, int len, double value)
+{
+    const v8sd pval = _mm512_set1_pd(value);
+
+    int stop_len = len / (2 * AVX512_LEN_DOUBLE);
+    stop_len *= (2 * AVX512_LEN_DOUBLE);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd src_tmp = _mm512_load_pd(src + i);
+            v8sd src_tmp2 = _mm512_load_pd(src + i + AVX512_LEN_DOUBLE);
+            v8sd dst_tmp = _mm512_max_pd(src_tmp, pval);
+            v8sd dst_tmp2 = _mm512_max_pd(src_tmp2, pval);
+            _mm512_store_pd(dst + i, dst_tmp);
+            _mm512_store_pd(dst + i + AVX512_LEN_DOUBLE, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd src_tmp = _mm512_loadu_pd(src + i);
+            v8sd src_tmp2 = _mm512_loadu_pd(src + i + AVX512_LEN_DOUBLE);
+            v8sd dst_tmp = _mm512_max_pd(src_tmp, pval);
+            v8sd dst_tmp2 = _mm512_max_pd(src_tmp2, pval);
+            _mm512_storeu_pd(dst + i, dst_tmp);
+            _mm512_storeu_pd(dst + i + AVX512_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        v8sd dst_tmp = _mm512_max_pd(src_tmp, pval);
+        _mm512_mask_storeu_pd(dst + i, mask, dst_tmp);
+    }
+}
+
+SIMD_UTILS_API void threshold512_ltabs_d(double *src, double *dst, int len, double value)
+{
+    const v8sd pval = _mm512_set1_pd(value);
+
+    int stop_len = len / (2 * AVX512_LEN_DOUBLE);
+    stop_len *= (2 * AVX512_LEN_DOUBLE);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd src_tmp = _mm512_load_pd(src + i);
+            v8sd src_tmp2 = _mm512_load_pd(src + i + AVX512_LEN_DOUBLE);
+            v8sd src_sign = _mm512_and_pd(src_tmp, *(v8sd *) _pd512_negative_mask);  // extract sign
+            v8sd src_abs = _mm512_and_pd(src_tmp, *(v8sd *) _pd512_positive_mask);   // take absolute value
+            v8sd dst_tmp = _mm512_xor_pd(_mm512_max_pd(src_abs, pval), src_sign);
+            v8sd src_sign2 = _mm512_and_pd(src_tmp2, *(v8sd *) _pd512_negative_mask);  // extract sign
+            v8sd src_abs2 = _mm512_and_pd(src_tmp2, *(v8sd *) _pd512_positive_mask);   // take absolute value
+            v8sd dst_tmp2 = _mm512_xor_pd(_mm512_max_pd(src_abs2, pval), src_sign2);
+            _mm512_store_pd(dst + i, dst_tmp);
+            _mm512_store_pd(dst + i + AVX512_LEN_DOUBLE, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd src_tmp = _mm512_loadu_pd(src + i);
+            v8sd src_tmp2 = _mm512_loadu_pd(src + i + AVX512_LEN_DOUBLE);
+            v8sd src_sign = _mm512_and_pd(src_tmp, *(v8sd *) _pd512_negative_mask);  // extract sign
+            v8sd src_abs = _mm512_and_pd(src_tmp, *(v8sd *) _pd512_positive_mask);   // take absolute value
+            v8sd dst_tmp = _mm512_xor_pd(_mm512_max_pd(src_abs, pval), src_sign);
+            v8sd src_sign2 = _mm512_and_pd(src_tmp2, *(v8sd *) _pd512_negative_mask);  // extract sign
+            v8sd src_abs2 = _mm512_and_pd(src_tmp2, *(v8sd *) _pd512_positive_mask);   // take absolute value
+            v8sd dst_tmp2 = _mm512_xor_pd(_mm512_max_pd(src_abs2, pval), src_sign2);
+            _mm512_storeu_pd(dst + i, dst_tmp);
+            _mm512_storeu_pd(dst + i + AVX512_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        v8sd src_sign = _mm512_and_pd(src_tmp, *(v8sd *) _pd512_negative_mask);  // extract sign
+        v8sd src_abs = _mm512_and_pd(src_tmp, *(v8sd *) _pd512_positive_mask);   // take absolute value
+        v8sd dst_tmp = _mm512_xor_pd(_mm512_max_pd(src_abs, pval), src_sign);
+        _mm512_mask_storeu_pd(dst + i, mask, dst_tmp);
+    }
+}
+
+SIMD_UTILS_API void threshold512_ltval_gtval_d(double *src, double *dst, int len, double ltlevel, double ltvalue, double gtlevel, double gtvalue)
+{
+    const v8sd ltlevel_v = _mm512_set1_pd(ltlevel);
+    const v8sd ltvalue_v = _mm512_set1_pd(ltvalue);
+    const v8sd gtlevel_v = _mm512_set1_pd(gtlevel);
+    const v8sd gtvalue_v = _mm512_set1_pd(gtvalue);
+
+    int stop_len = len / (2 * AVX512_LEN_DOUBLE);
+    stop_len *= (2 * AVX512_LEN_DOUBLE);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd src_tmp = _mm512_load_pd(src + i);
+            v8sd src_tmp2 = _mm512_load_pd(src + i + AVX512_LEN_DOUBLE);
+            __mmask8 lt_mask = _mm512_cmp_pd_mask(src_tmp, ltlevel_v, _CMP_LT_OS);
+            __mmask8 gt_mask = _mm512_cmp_pd_mask(src_tmp, gtlevel_v, _CMP_GT_OS);
+            v8sd dst_tmp = _mm512_mask_blend_pd(lt_mask, src_tmp, ltvalue_v);
+            dst_tmp = _mm512_mask_blend_pd(gt_mask, dst_tmp, gtvalue_v);
+            __mmask8 lt_mask2 = _mm512_cmp_pd_mask(src_tmp2, ltlevel_v, _CMP_LT_OS);
+            __mmask8 gt_mask2 = _mm512_cmp_pd_mask(src_tmp2, gtlevel_v, _CMP_GT_OS);
+            v8sd dst_tmp2 = _mm512_mask_blend_pd(lt_mask2, src_tmp2, ltvalue_v);
+            dst_tmp2 = _mm512_mask_blend_pd(gt_mask2, dst_tmp2, gtvalue_v);
+            _mm512_store_pd(dst + i, dst_tmp);
+            _mm512_store_pd(dst + i + AVX512_LEN_DOUBLE, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd src_tmp = _mm512_loadu_pd(src + i);
+            v8sd src_tmp2 = _mm512_loadu_pd(src + i + AVX512_LEN_DOUBLE);
+            __mmask8 lt_mask = _mm512_cmp_pd_mask(src_tmp, ltlevel_v, _CMP_LT_OS);
+            __mmask8 gt_mask = _mm512_cmp_pd_mask(src_tmp, gtlevel_v, _CMP_GT_OS);
+            v8sd dst_tmp = _mm512_mask_blend_pd(lt_mask, src_tmp, ltvalue_v);
+            dst_tmp = _mm512_mask_blend_pd(gt_mask, dst_tmp, gtvalue_v);
+            __mmask8 lt_mask2 = _mm512_cmp_pd_mask(src_tmp2, ltlevel_v, _CMP_LT_OS);
+            __mmask8 gt_mask2 = _mm512_cmp_pd_mask(src_tmp2, gtlevel_v, _CMP_GT_OS);
+            v8sd dst_tmp2 = _mm512_mask_blend_pd(lt_mask2, src_tmp2, ltvalue_v);
+            dst_tmp2 = _mm512_mask_blend_pd(gt_mask2, dst_tmp2, gtvalue_v);
+            _mm512_storeu_pd(dst + i, dst_tmp);
+            _mm512_storeu_pd(dst + i + AVX512_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd src_tmp = _mm512_maskz_loadu_pd(mask, src + i);
+        __mmask8 lt_mask = _mm512_cmp_pd_mask(src_tmp, ltlevel_v, _CMP_LT_OS);
+        __mmask8 gt_mask = _mm512_cmp_pd_mask(src_tmp, gtlevel_v, _CMP_GT_OS);
+        v8sd dst_tmp = _mm512_mask_blend_pd(lt_mask, src_tmp, ltvalue_v);
+        dst_tmp = _mm512_mask_blend_pd(gt_mask, dst_tmp, gtvalue_v);
+        _mm512_mask_storeu_pd(dst + i, mask, dst_tmp);
+    }
+}
+
+SIMD_UTILS_API void sum512d(double *src, double *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_DOUBLE);
+    stop_len *= (2 * AVX512_LEN_DOUBLE);
+
+    v8sd vec_acc1 = _mm512_setzero_pd();  // initialize the vector accumulator
+    v8sd vec_acc2 = _mm512_setzero_pd();  // initialize the vector accumulator
+
+    if (isAligned((uintptr_t) (src), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd vec_tmp1 = _mm512_load_pd(src + i);
+            vec_acc1 = _mm512_add_pd(vec_acc1, vec_tmp1);
+            v8sd vec_tmp2 = _mm512_load_pd(src + i + AVX512_LEN_DOUBLE);
+            vec_acc2 = _mm512_add_pd(vec_acc2, vec_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd vec_tmp1 = _mm512_loadu_pd(src + i);
+            vec_acc1 = _mm512_add_pd(vec_acc1, vec_tmp1);
+            v8sd vec_tmp2 = _mm512_loadu_pd(src + i + AVX512_LEN_DOUBLE);
+            vec_acc2 = _mm512_add_pd(vec_acc2, vec_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        v8sd vec_tmp1 = _mm512_maskz_loadu_pd(tail_mask8(len - i), src + i);
+        vec_acc1 = _mm512_add_pd(vec_acc1, vec_tmp1);
+    }
+
+    vec_acc1 = _mm512_add_pd(vec_acc1, vec_acc2);
+    *dst = _mm512_reduce_add_pd(vec_acc1);
+}
+
+SIMD_UTILS_API void mean512d(double *src, double *dst, int len)
+{
+    double coeff = 1.0 / ((double) len);
+    sum512d(src, dst, len);
+    *dst *= coeff;
+}
+
+SIMD_UTILS_API void dot512d(double *src1, double *src2, int len, double *dst)
+{
+    int stop_len = len / (2 * AVX512_LEN_DOUBLE);
+    stop_len *= (2 * AVX512_LEN_DOUBLE);
+
+    v8sd vec_acc1 = _mm512_setzero_pd();  // initialize the vector accumulator
+    v8sd vec_acc2 = _mm512_setzero_pd();  // initialize the vector accumulator
+
+    if (areAligned2((uintptr_t) (src1), (uintptr_t) (src2), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd vec_src1_tmp = _mm512_load_pd(src1 + i);
+            v8sd vec_src1_tmp2 = _mm512_load_pd(src1 + i + AVX512_LEN_DOUBLE);
+            v8sd vec_src2_tmp = _mm512_load_pd(src2 + i);
+            v8sd vec_src2_tmp2 = _mm512_load_pd(src2 + i + AVX512_LEN_DOUBLE);
+            vec_acc1 = _mm512_fmadd_pd_custom(vec_src1_tmp, vec_src2_tmp, vec_acc1);
+            vec_acc2 = _mm512_fmadd_pd_custom(vec_src1_tmp2, vec_src2_tmp2, vec_acc2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd vec_src1_tmp = _mm512_loadu_pd(src1 + i);
+            v8sd vec_src1_tmp2 = _mm512_loadu_pd(src1 + i + AVX512_LEN_DOUBLE);
+            v8sd vec_src2_tmp = _mm512_loadu_pd(src2 + i);
+            v8sd vec_src2_tmp2 = _mm512_loadu_pd(src2 + i + AVX512_LEN_DOUBLE);
+            vec_acc1 = _mm512_fmadd_pd_custom(vec_src1_tmp, vec_src2_tmp, vec_acc1);
+            vec_acc2 = _mm512_fmadd_pd_custom(vec_src1_tmp2, vec_src2_tmp2, vec_acc2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd vec_src1_tmp = _mm512_maskz_loadu_pd(mask, src1 + i);
+        v8sd vec_src2_tmp = _mm512_maskz_loadu_pd(mask, src2 + i);
+        vec_acc1 = _mm512_fmadd_pd_custom(vec_src1_tmp, vec_src2_tmp, vec_acc1);
+    }
+
+    vec_acc1 = _mm512_add_pd(vec_acc1, vec_acc2);
+    *dst = _mm512_reduce_add_pd(vec_acc1);
+}
+
+SIMD_UTILS_API void dotc512d(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst)
+{
+    int stop_len = len / (4 * AVX512_LEN_DOUBLE);
+    stop_len *= (4 * AVX512_LEN_DOUBLE);
+
+    v8sdx2 vec_acc1 = {{_mm512_setzero_pd(), _mm512_setzero_pd()}};  // initialize the vector accumulator
+    v8sdx2 vec_acc2 = {{_mm512_setzero_pd(), _mm512_setzero_pd()}};  // initialize the vector accumulator
+
+    //  (ac -bd) + i(ad + bc)
+    if (areAligned2((uintptr_t) (src1), (uintptr_t) (src2), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < 2 * stop_len; i += 4 * AVX512_LEN_DOUBLE) {
+            v8sdx2 src1_split = _mm512_load2_pd((double *) (src1) + i);  // a0a1, b0b1
+            v8sdx2 src2_split = _mm512_load2_pd((double *) (src2) + i);  // c0c1, d0d1
+            v8sdx2 src1_split2 = _mm512_load2_pd((double *) (src1) + i + 2 * AVX512_LEN_DOUBLE);
+            v8sdx2 src2_split2 = _mm512_load2_pd((double *) (src2) + i + 2 * AVX512_LEN_DOUBLE);
+            v8sd ac = _mm512_mul_pd(src1_split.val[0], src2_split.val[0]);     // ac
+            v8sd ad = _mm512_mul_pd(src1_split.val[0], src2_split.val[1]);     // ad
+            v8sd ac2 = _mm512_mul_pd(src1_split2.val[0], src2_split2.val[0]);  // ac
+            v8sd ad2 = _mm512_mul_pd(src1_split2.val[0], src2_split2.val[1]);  // ad
+            vec_acc1.val[0] = _mm512_add_pd(vec_acc1.val[0], _mm512_fnmadd_pd_custom(src1_split.val[1], src2_split.val[1], ac));
+            vec_acc1.val[1] = _mm512_add_pd(vec_acc1.val[1], _mm512_fmadd_pd_custom(src1_split.val[1], src2_split.val[0], ad));
+            vec_acc2.val[0] = _mm512_add_pd(vec_acc2.val[0], _mm512_fnmadd_pd_custom(src1_split2.val[1], src2_split2.val[1], ac2));
+            vec_acc2.val[1] = _mm512_add_pd(vec_acc2.val[1], _mm512_fmadd_pd_custom(src1_split2.val[1], src2_split2.val[0], ad2));
+        }
+    } else {
+        for (int i = 0; i < 2 * stop_len; i += 4 * AVX512_LEN_DOUBLE) {
+            v8sdx2 src1_split = _mm512_load2u_pd((double *) (src1) + i);  // a0a1, b0b1
+            v8sdx2 src2_split = _mm512_load2u_pd((double *) (src2) + i);  // c0c1, d0d1
+            v8sdx2 src1_split2 = _mm512_load2u_pd((double *) (src1) + i + 2 * AVX512_LEN_DOUBLE);
+            v8sdx2 src2_split2 = _mm512_load2u_pd((double *) (src2) + i + 2 * AVX512_LEN_DOUBLE);
+            v8sd ac = _mm512_mul_pd(src1_split.val[0], src2_split.val[0]);     // ac
+            v8sd ad = _mm512_mul_pd(src1_split.val[0], src2_split.val[1]);     // ad
+            v8sd ac2 = _mm512_mul_pd(src1_split2.val[0], src2_split2.val[0]);  // ac
+            v8sd ad2 = _mm512_mul_pd(src1_split2.val[0], src2_split2.val[1]);  // ad
+            vec_acc1.val[0] = _mm512_add_pd(vec_acc1.val[0], _mm512_fnmadd_pd_custom(src1_split.val[1], src2_split.val[1], ac));
+            vec_acc1.val[1] = _mm512_add_pd(vec_acc1.val[1], _mm512_fmadd_pd_custom(src1_split.val[1], src2_split.val[0], ad));
+            vec_acc2.val[0] = _mm512_add_pd(vec_acc2.val[0], _mm512_fnmadd_pd_custom(src1_split2.val[1], src2_split2.val[1], ac2));
+            vec_acc2.val[1] = _mm512_add_pd(vec_acc2.val[1], _mm512_fmadd_pd_custom(src1_split2.val[1], src2_split2.val[0], ad2));
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        v8sdx2 src1_split = _mm512_maskz_load2u_pd(len - i, (double *) (src1 + i));
+        v8sdx2 src2_split = _mm512_maskz_load2u_pd(len - i, (double *) (src2 + i));
+        v8sd ac = _mm512_mul_pd(src1_split.val[0], src2_split.val[0]);  // ac
+        v8sd ad = _mm512_mul_pd(src1_split.val[0], src2_split.val[1]);  // ad
+        vec_acc1.val[0] = _mm512_add_pd(vec_acc1.val[0], _mm512_fnmadd_pd_custom(src1_split.val[1], src2_split.val[1], ac));
+        vec_acc1.val[1] = _mm512_add_pd(vec_acc1.val[1], _mm512_fmadd_pd_custom(src1_split.val[1], src2_split.val[0], ad));
+    }
+
+    vec_acc1.val[0] = _mm512_add_pd(vec_acc1.val[0], vec_acc2.val[0]);
+    vec_acc1.val[1] = _mm512_add_pd(vec_acc1.val[1], vec_acc2.val[1]);
+    dst->re = _mm512_reduce_add_pd(vec_acc1.val[0]);
+    dst->im = _mm512_reduce_add_pd(vec_acc1.val[1]);
+}
+
+// *acc + *cor += value, *cor gathers the rounding errors of the additions (TwoSum, see simd_utils_sum.h)
+static inline void kahan_add512d(v8sd *acc, v8sd *cor, v8sd value)
+{
+    v8sd t = _mm512_add_pd(*acc, value);
+    v8sd bp = _mm512_sub_pd(t, *acc);
+    v8sd err = _mm512_add_pd(_mm512_sub_pd(*acc, _mm512_sub_pd(t, bp)), _mm512_sub_pd(value, bp));
+    *cor = _mm512_add_pd(*cor, err);
+    *acc = t;
+}
+
+SIMD_UTILS_API void sumkahan512d(double *src, double *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_DOUBLE);
+    stop_len *= (2 * AVX512_LEN_DOUBLE);
+
+    __attribute__((aligned(AVX512_LEN_BYTES))) double accumulate[2 * AVX512_LEN_DOUBLE];
+    __attribute__((aligned(AVX512_LEN_BYTES))) double correction[2 * AVX512_LEN_DOUBLE];
+    double tmp_acc = 0.0;
+    double tmp_cor = 0.0;
+    v8sd vec_acc1 = _mm512_setzero_pd();  // initialize the vector accumulator
+    v8sd vec_acc2 = _mm512_setzero_pd();  // initialize the vector accumulator
+    v8sd vec_cor1 = _mm512_setzero_pd();  // rounding errors of the accumulator
+    v8sd vec_cor2 = _mm512_setzero_pd();  // rounding errors of the accumulator
+
+    if (isAligned((uintptr_t) (src), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            kahan_add512d(&vec_acc1, &vec_cor1, _mm512_load_pd(src + i));
+            kahan_add512d(&vec_acc2, &vec_cor2, _mm512_load_pd(src + i + AVX512_LEN_DOUBLE));
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            kahan_add512d(&vec_acc1, &vec_cor1, _mm512_loadu_pd(src + i));
+            kahan_add512d(&vec_acc2, &vec_cor2, _mm512_loadu_pd(src + i + AVX512_LEN_DOUBLE));
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        kahan_add512d(&vec_acc1, &vec_cor1, _mm512_maskz_loadu_pd(tail_mask8(len - i), src + i));
+    }
+
+    _mm512_store_pd(accumulate, vec_acc1);
+    _mm512_store_pd(accumulate + AVX512_LEN_DOUBLE, vec_acc2);
+    _mm512_store_pd(correction, vec_cor1);
+    _mm512_store_pd(correction + AVX512_LEN_DOUBLE, vec_cor2);
+    kahan_foldd(accumulate, correction, 2 * AVX512_LEN_DOUBLE, &tmp_acc, &tmp_cor);
+
+    *dst = tmp_acc + tmp_cor;
+}
+
+SIMD_UTILS_API void meankahan512d(double *src, double *dst, int len)
+{
+    double coeff = 1.0 / ((double) len);
+    sumkahan512d(src, dst, len);
+    *dst *= coeff;
+}
+
+/* The rounding errors of the products are prod - src1 * src2 computed with a FMA,
+ * they are 0 without FMA (only the additions are compensated) */
+SIMD_UTILS_API void dotkahan512d(double *src1, double *src2, int len, double *dst)
+{
+    int stop_len = len / (2 * AVX512_LEN_DOUBLE);
+    stop_len *= (2 * AVX512_LEN_DOUBLE);
+
+    __attribute__((aligned(AVX512_LEN_BYTES))) double accumulate[2 * AVX512_LEN_DOUBLE];
+    __attribute__((aligned(AVX512_LEN_BYTES))) double correction[2 * AVX512_LEN_DOUBLE];
+    double tmp_acc = 0.0;
+    double tmp_cor = 0.0;
+    v8sd vec_acc1 = _mm512_setzero_pd();  // initialize the vector accumulator
+    v8sd vec_acc2 = _mm512_setzero_pd();  // initialize the vector accumulator
+    v8sd vec_cor1 = _mm512_setzero_pd();  // rounding errors of the accumulator
+    v8sd vec_cor2 = _mm512_setzero_pd();  // rounding errors of the accumulator
+
+    if (areAligned2((uintptr_t) (src1), (uintptr_t) (src2), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd vec_src1_tmp = _mm512_load_pd(src1 + i);
+            v8sd vec_src1_tmp2 = _mm512_load_pd(src1 + i + AVX512_LEN_DOUBLE);
+            v8sd vec_src2_tmp = _mm512_load_pd(src2 + i);
+            v8sd vec_src2_tmp2 = _mm512_load_pd(src2 + i + AVX512_LEN_DOUBLE);
+            v8sd prod = _mm512_mul_pd(vec_src1_tmp, vec_src2_tmp);
+            v8sd prod2 = _mm512_mul_pd(vec_src1_tmp2, vec_src2_tmp2);
+            kahan_add512d(&vec_acc1, &vec_cor1, prod);
+            kahan_add512d(&vec_acc2, &vec_cor2, prod2);
+            vec_cor1 = _mm512_sub_pd(vec_cor1, _mm512_fnmadd_pd_custom(vec_src1_tmp, vec_src2_tmp, prod));
+            vec_cor2 = _mm512_sub_pd(vec_cor2, _mm512_fnmadd_pd_custom(vec_src1_tmp2, vec_src2_tmp2, prod2));
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd vec_src1_tmp = _mm512_loadu_pd(src1 + i);
+            v8sd vec_src1_tmp2 = _mm512_loadu_pd(src1 + i + AVX512_LEN_DOUBLE);
+            v8sd vec_src2_tmp = _mm512_loadu_pd(src2 + i);
+            v8sd vec_src2_tmp2 = _mm512_loadu_pd(src2 + i + AVX512_LEN_DOUBLE);
+            v8sd prod = _mm512_mul_pd(vec_src1_tmp, vec_src2_tmp);
+            v8sd prod2 = _mm512_mul_pd(vec_src1_tmp2, vec_src2_tmp2);
+            kahan_add512d(&vec_acc1, &vec_cor1, prod);
+            kahan_add512d(&vec_acc2, &vec_cor2, prod2);
+            vec_cor1 = _mm512_sub_pd(vec_cor1, _mm512_fnmadd_pd_custom(vec_src1_tmp, vec_src2_tmp, prod));
+            vec_cor2 = _mm512_sub_pd(vec_cor2, _mm512_fnmadd_pd_custom(vec_src1_tmp2, vec_src2_tmp2, prod2));
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd vec_src1_tmp = _mm512_maskz_loadu_pd(mask, src1 + i);
+        v8sd vec_src2_tmp = _mm512_maskz_loadu_pd(mask, src2 + i);
+        v8sd prod = _mm512_mul_pd(vec_src1_tmp, vec_src2_tmp);
+        kahan_add512d(&vec_acc1, &vec_cor1, prod);
+        vec_cor1 = _mm512_sub_pd(vec_cor1, _mm512_fnmadd_pd_custom(vec_src1_tmp, vec_src2_tmp, prod));
+    }
+
+    _mm512_store_pd(accumulate, vec_acc1);
+    _mm512_store_pd(accumulate + AVX512_LEN_DOUBLE, vec_acc2);
+    _mm512_store_pd(correction, vec_cor1);
+    _mm512_store_pd(correction + AVX512_LEN_DOUBLE, vec_cor2);
+    kahan_foldd(accumulate, correction, 2 * AVX512_LEN_DOUBLE, &tmp_acc, &tmp_cor);
+
+    *dst = tmp_acc + tmp_cor;
+}
+
+SIMD_UTILS_API void dotckahan512d(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst)
+{
+    int stop_len = len / (4 * AVX512_LEN_DOUBLE);
+    stop_len *= (4 * AVX512_LEN_DOUBLE);
+
+    __attribute__((aligned(AVX512_LEN_BYTES))) double accumulateRe[2 * AVX512_LEN_DOUBLE];
+    __attribute__((aligned(AVX512_LEN_BYTES))) double accumulateIm[2 * AVX512_LEN_DOUBLE];
+    __attribute__((aligned(AVX512_LEN_BYTES))) double correctionRe[2 * AVX512_LEN_DOUBLE];
+    __attribute__((aligned(AVX512_LEN_BYTES))) double correctionIm[2 * AVX512_LEN_DOUBLE];
+    complex64_t dst_tmp = {0.0, 0.0};
+    complex64_t dst_cor = {0.0, 0.0};
+    v8sdx2 vec_acc1 = {{_mm512_setzero_pd(), _mm512_setzero_pd()}};  // initialize the vector accumulator
+    v8sdx2 vec_acc2 = {{_mm512_setzero_pd(), _mm512_setzero_pd()}};  // initialize the vector accumulator
+    v8sdx2 vec_cor1 = {{_mm512_setzero_pd(), _mm512_setzero_pd()}};  // rounding errors of the accumulator
+    v8sdx2 vec_cor2 = {{_mm512_setzero_pd(), _mm512_setzero_pd()}};  // rounding errors of the accumulator
+
+    //  (ac -bd) + i(ad + bc)
+    if (areAligned2((uintptr_t) (src1), (uintptr_t) (src2), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < 2 * stop_len; i += 4 * AVX512_LEN_DOUBLE) {
+            v8sdx2 src1_split = _mm512_load2_pd((double *) (src1) + i);  // a0a1, b0b1
+            v8sdx2 src2_split = _mm512_load2_pd((double *) (src2) + i);  // c0c1, d0d1
+            v8sdx2 src1_split2 = _mm512_load2_pd((double *) (src1) + i + 2 * AVX512_LEN_DOUBLE);
+            v8sdx2 src2_split2 = _mm512_load2_pd((double *) (src2) + i + 2 * AVX512_LEN_DOUBLE);
+            v8sd ac = _mm512_mul_pd(src1_split.val[0], src2_split.val[0]);     // ac
+            v8sd ad = _mm512_mul_pd(src1_split.val[0], src2_split.val[1]);     // ad
+            v8sd ac2 = _mm512_mul_pd(src1_split2.val[0], src2_split2.val[0]);  // ac
+            v8sd ad2 = _mm512_mul_pd(src1_split2.val[0], src2_split2.val[1]);  // ad
+            kahan_add512d(&vec_acc1.val[0], &vec_cor1.val[0], _mm512_fnmadd_pd_custom(src1_split.val[1], src2_split.val[1], ac));
+            kahan_add512d(&vec_acc1.val[1], &vec_cor1.val[1], _mm512_fmadd_pd_custom(src1_split.val[1], src2_split.val[0], ad));
+            kahan_add512d(&vec_acc2.val[0], &vec_cor2.val[0], _mm512_fnmadd_pd_custom(src1_split2.val[1], src2_split2.val[1], ac2));
+            kahan_add512d(&vec_acc2.val[1], &vec_cor2.val[1], _mm512_fmadd_pd_custom(src1_split2.val[1], src2_split2.val[0], ad2));
+        }
+    } else {
+        for (int i = 0; i < 2 * stop_len; i += 4 * AVX512_LEN_DOUBLE) {
+            v8sdx2 src1_split = _mm512_load2u_pd((double *) (src1) + i);  // a0a1, b0b1
+            v8sdx2 src2_split = _mm512_load2u_pd((double *) (src2) + i);  // c0c1, d0d1
+            v8sdx2 src1_split2 = _mm512_load2u_pd((double *) (src1) + i + 2 * AVX512_LEN_DOUBLE);
+            v8sdx2 src2_split2 = _mm512_load2u_pd((double *) (src2) + i + 2 * AVX512_LEN_DOUBLE);
+            v8sd ac = _mm512_mul_pd(src1_split.val[0], src2_split.val[0]);     // ac
+            v8sd ad = _mm512_mul_pd(src1_split.val[0], src2_split.val[1]);     // ad
+            v8sd ac2 = _mm512_mul_pd(src1_split2.val[0], src2_split2.val[0]);  // ac
+            v8sd ad2 = _mm512_mul_pd(src1_split2.val[0], src2_split2.val[1]);  // ad
+            kahan_add512d(&vec_acc1.val[0], &vec_cor1.val[0], _mm512_fnmadd_pd_custom(src1_split.val[1], src2_split.val[1], ac));
+            kahan_add512d(&vec_acc1.val[1], &vec_cor1.val[1], _mm512_fmadd_pd_custom(src1_split.val[1], src2_split.val[0], ad));
+            kahan_add512d(&vec_acc2.val[0], &vec_cor2.val[0], _mm512_fnmadd_pd_custom(src1_split2.val[1], src2_split2.val[1], ac2));
+            kahan_add512d(&vec_acc2.val[1], &vec_cor2.val[1], _mm512_fmadd_pd_custom(src1_split2.val[1], src2_split2.val[0], ad2));
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        v8sdx2 src1_split = _mm512_maskz_load2u_pd(len - i, (double *) (src1 + i));
+        v8sdx2 src2_split = _mm512_maskz_load2u_pd(len - i, (double *) (src2 + i));
+        v8sd ac = _mm512_mul_pd(src1_split.val[0], src2_split.val[0]);  // ac
+        v8sd ad = _mm512_mul_pd(src1_split.val[0], src2_split.val[1]);  // ad
+        kahan_add512d(&vec_acc1.val[0], &vec_cor1.val[0], _mm512_fnmadd_pd_custom(src1_split.val[1], src2_split.val[1], ac));
+        kahan_add512d(&vec_acc1.val[1], &vec_cor1.val[1], _mm512_fmadd_pd_custom(src1_split.val[1], src2_split.val[0], ad));
+    }
+
+    _mm512_store_pd(accumulateRe, vec_acc1.val[0]);
+    _mm512_store_pd(accumulateRe + AVX512_LEN_DOUBLE, vec_acc2.val[0]);
+    _mm512_store_pd(accumulateIm, vec_acc1.val[1]);
+    _mm512_store_pd(accumulateIm + AVX512_LEN_DOUBLE, vec_acc2.val[1]);
+    _mm512_store_pd(correctionRe, vec_cor1.val[0]);
+    _mm512_store_pd(correctionRe + AVX512_LEN_DOUBLE, vec_cor2.val[0]);
+    _mm512_store_pd(correctionIm, vec_cor1.val[1]);
+    _mm512_store_pd(correctionIm + AVX512_LEN_DOUBLE, vec_cor2.val[1]);
+    kahan_foldd(accumulateRe, correctionRe, 2 * AVX512_LEN_DOUBLE, &dst_tmp.re, &dst_cor.re);
+    kahan_foldd(accumulateIm, correctionIm, 2 * AVX512_LEN_DOUBLE, &dst_tmp.im, &dst_cor.im);
+
+    dst->re = dst_tmp.re + dst_cor.re;
+    dst->im = dst_tmp.im + dst_cor.im;
+}
+
+SIMD_UTILS_API void sumpairwise512d(double *src, double *dst, int len)
+{
+    *dst = sum_pairwised(src, len, sum512d);
+}
+
+SIMD_UTILS_API void meanpairwise512d(double *src, double *dst, int len)
+{
+    double coeff = 1.0 / ((double) len);
+    sumpairwise512d(src, dst, len);
+    *dst *= coeff;
+}
+
+SIMD_UTILS_API void dotpairwise512d(double *src1, double *src2, int len, double *dst)
+{
+    *dst = dot_pairwised(src1, src2, len, dot512d);
+}
+
+SIMD_UTILS_API void dotcpairwise512d(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst)
+{
+    *dst = dotc_pairwised(src1, src2, len, dotc512d);
+}
+
+// sums of the powers of (src[i] - shift), see simd_utils_moments.h
+static inline void centered_sums512d(double *src, int len, double shift, double *sums)
+{
+    int stop_len = len / (2 * AVX512_LEN_DOUBLE);
+    stop_len *= (2 * AVX512_LEN_DOUBLE);
+
+    __attribute__((aligned(AVX512_LEN_BYTES))) double accumulate[4 * AVX512_LEN_DOUBLE];
+    v8sd shift_vec = _mm512_set1_pd(shift);
+    v8sd sum1_1 = _mm512_setzero_pd(), sum1_2 = _mm512_setzero_pd();  // d
+    v8sd sum2_1 = _mm512_setzero_pd(), sum2_2 = _mm512_setzero_pd();  // d^2
+    v8sd sum3_1 = _mm512_setzero_pd(), sum3_2 = _mm512_setzero_pd();  // d^3
+    v8sd sum4_1 = _mm512_setzero_pd(), sum4_2 = _mm512_setzero_pd();  // d^4
+
+    if (isAligned((uintptr_t) (src), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd d1 = _mm512_sub_pd(_mm512_load_pd(src + i), shift_vec);
+            v8sd d2 = _mm512_sub_pd(_mm512_load_pd(src + i + AVX512_LEN_DOUBLE), shift_vec);
+            v8sd sq1 = _mm512_mul_pd(d1, d1);
+            v8sd sq2 = _mm512_mul_pd(d2, d2);
+            sum1_1 = _mm512_add_pd(sum1_1, d1);
+            sum1_2 = _mm512_add_pd(sum1_2, d2);
+            sum2_1 = _mm512_add_pd(sum2_1, sq1);
+            sum2_2 = _mm512_add_pd(sum2_2, sq2);
+            sum3_1 = _mm512_fmadd_pd_custom(sq1, d1, sum3_1);
+            sum3_2 = _mm512_fmadd_pd_custom(sq2, d2, sum3_2);
+            sum4_1 = _mm512_fmadd_pd_custom(sq1, sq1, sum4_1);
+            sum4_2 = _mm512_fmadd_pd_custom(sq2, sq2, sum4_2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+            v8sd d1 = _mm512_sub_pd(_mm512_loadu_pd(src + i), shift_vec);
+            v8sd d2 = _mm512_sub_pd(_mm512_loadu_pd(src + i + AVX512_LEN_DOUBLE), shift_vec);
+            v8sd sq1 = _mm512_mul_pd(d1, d1);
+            v8sd sq2 = _mm512_mul_pd(d2, d2);
+            sum1_1 = _mm512_add_pd(sum1_1, d1);
+            sum1_2 = _mm512_add_pd(sum1_2, d2);
+            sum2_1 = _mm512_add_pd(sum2_1, sq1);
+            sum2_2 = _mm512_add_pd(sum2_2, sq2);
+            sum3_1 = _mm512_fmadd_pd_custom(sq1, d1, sum3_1);
+            sum3_2 = _mm512_fmadd_pd_custom(sq2, d2, sum3_2);
+            sum4_1 = _mm512_fmadd_pd_custom(sq1, sq1, sum4_1);
+            sum4_2 = _mm512_fmadd_pd_custom(sq2, sq2, sum4_2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        // the masked out lanes of d are zeros
+        v8sd d1 = _mm512_maskz_sub_pd(tail_mask8(len - i), _mm512_maskz_loadu_pd(tail_mask8(len - i), src + i), shift_vec);
+        v8sd sq1 = _mm512_mul_pd(d1, d1);
+        sum1_1 = _mm512_add_pd(sum1_1, d1);
+        sum2_1 = _mm512_add_pd(sum2_1, sq1);
+        sum3_1 = _mm512_fmadd_pd_custom(sq1, d1, sum3_1);
+        sum4_1 = _mm512_fmadd_pd_custom(sq1, sq1, sum4_1);
+    }
+
+    _mm512_store_pd(accumulate, _mm512_add_pd(sum1_1, sum1_2));
+    _mm512_store_pd(accumulate + AVX512_LEN_DOUBLE, _mm512_add_pd(sum2_1, sum2_2));
+    _mm512_store_pd(accumulate + 2 * AVX512_LEN_DOUBLE, _mm512_add_pd(sum3_1, sum3_2));
+    _mm512_store_pd(accumulate + 3 * AVX512_LEN_DOUBLE, _mm512_add_pd(sum4_1, sum4_2));
+
+    for (int k = 0; k < 4; k++) {
+        sums[k] = 0.0;
+        for (int i = 0; i < AVX512_LEN_DOUBLE; i++) {
+            sums[k] += (double) accumulate[k * AVX512_LEN_DOUBLE + i];
+        }
+    }
+}
+
+SIMD_UTILS_API void moments512d(double *src, int len, moments_t *m)
+{
+    moments_rund(src, len, sum512d, centered_sums512d, m);
+}
+
+// inclusive prefix sum of the lanes of x
+static inline v8sd prefix_lanes512d(v8sd x)
+{
+    v16si zero = _mm512_setzero_si512();
+    x = _mm512_add_pd(x, _mm512_castsi512_pd(_mm512_alignr_epi64(_mm512_castpd_si512(x), zero, 7)));
+    x = _mm512_add_pd(x, _mm512_castsi512_pd(_mm512_alignr_epi64(_mm512_castpd_si512(x), zero, 6)));
+    x = _mm512_add_pd(x, _mm512_castsi512_pd(_mm512_alignr_epi64(_mm512_castpd_si512(x), zero, 4)));
+    return x;
+}
+
+// last lane of x in all the lanes
+static inline v8sd last_lane512d(v8sd x)
+{
+    return _mm512_permutexvar_pd(_mm512_set1_epi64(7), x);
+}
+
+// lanes of x moved up by one, the first lane getting the last lane of prev
+static inline v8sd shift_lane512d(v8sd x, v8sd prev)
+{
+    return _mm512_castsi512_pd(_mm512_alignr_epi64(_mm512_castpd_si512(x), _mm512_castpd_si512(prev), 7));
+}
+
+// prefix sums of src (see simd_utils.h), exclusive when exclusive is set
+static inline void prefixsum512d_run(double *src, double *dst, int len, double *carry, int exclusive)
+{
+    int stop_len = len / (2 * AVX512_LEN_DOUBLE);
+    stop_len *= (2 * AVX512_LEN_DOUBLE);
+
+    v8sd carry_vec = _mm512_set1_pd(carry ? *carry : 0.0);
+
+    // the carry only waits for one add per pair of vectors
+    for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+        v8sd a = prefix_lanes512d(_mm512_loadu_pd(src + i));
+        v8sd b = prefix_lanes512d(_mm512_loadu_pd(src + i + AVX512_LEN_DOUBLE));
+        b = _mm512_add_pd(b, last_lane512d(a));
+        v8sd last = last_lane512d(b);
+        a = _mm512_add_pd(a, carry_vec);
+        b = _mm512_add_pd(b, carry_vec);
+        if (exclusive) {
+            _mm512_storeu_pd(dst + i, shift_lane512d(a, carry_vec));
+            _mm512_storeu_pd(dst + i + AVX512_LEN_DOUBLE, shift_lane512d(b, a));
+        } else {
+            _mm512_storeu_pd(dst + i, a);
+            _mm512_storeu_pd(dst + i + AVX512_LEN_DOUBLE, b);
+        }
+        carry_vec = _mm512_add_pd(carry_vec, last);
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd a = prefix_lanes512d(_mm512_maskz_loadu_pd(mask, src + i));  // the masked out lanes are 0
+        v8sd last = last_lane512d(a);
+        a = _mm512_add_pd(a, carry_vec);
+        if (exclusive) {
+            _mm512_mask_storeu_pd(dst + i, mask, shift_lane512d(a, carry_vec));
+        } else {
+            _mm512_mask_storeu_pd(dst + i, mask, a);
+        }
+        carry_vec = _mm512_add_pd(carry_vec, last);
+    }
+
+    if (carry)
+        *carry = _mm_cvtsd_f64(_mm512_castpd512_pd128(carry_vec));
+}
+
+SIMD_UTILS_API void prefixsum512d(double *src, double *dst, int len, double *carry)
+{
+    prefixsum512d_run(src, dst, len, carry, 0);
+}
+
+SIMD_UTILS_API void prefixsum512d_excl(double *src, double *dst, int len, double *carry)
+{
+    prefixsum512d_run(src, dst, len, carry, 1);
+}
+
+SIMD_UTILS_API void diff512d(double *src, double *dst, int len, double *prev)
+{
+    int stop_len = len / (2 * AVX512_LEN_DOUBLE);
+    stop_len *= (2 * AVX512_LEN_DOUBLE);
+
+    double prev_tmp = prev ? *prev : 0.0;
+    double last = (len > 0) ? src[len - 1] : prev_tmp;  // before src is overwritten by dst
+    v8sd prev_vec = _mm512_set1_pd(prev_tmp);
+
+    for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_DOUBLE) {
+        v8sd a = _mm512_loadu_pd(src + i);
+        v8sd b = _mm512_loadu_pd(src + i + AVX512_LEN_DOUBLE);
+        _mm512_storeu_pd(dst + i, _mm512_sub_pd(a, shift_lane512d(a, prev_vec)));
+        _mm512_storeu_pd(dst + i + AVX512_LEN_DOUBLE, _mm512_sub_pd(b, shift_lane512d(b, a)));
+        prev_vec = b;
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd a = _mm512_maskz_loadu_pd(mask, src + i);
+        _mm512_mask_storeu_pd(dst + i, mask, _mm512_sub_pd(a, shift_lane512d(a, prev_vec)));
+        prev_vec = a;
+    }
+
+    if (prev)
+        *prev = last;
+}
+
+// bitonic sort of the lanes of x
+static inline v8sd sort_lanes512d(v8sd x)
+{
+    v8sd p;
+    p = _mm512_permute_pd(x, 0x55);
+    x = _mm512_mask_blend_pd(0x66, _mm512_min_pd(x, p), _mm512_max_pd(x, p));
+    p = _mm512_permutex_pd(x, _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm512_mask_blend_pd(0x3C, _mm512_min_pd(x, p), _mm512_max_pd(x, p));
+    p = _mm512_permute_pd(x, 0x55);
+    x = _mm512_mask_blend_pd(0x5A, _mm512_min_pd(x, p), _mm512_max_pd(x, p));
+    p = _mm512_shuffle_f64x2(x, x, _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm512_mask_blend_pd(0xF0, _mm512_min_pd(x, p), _mm512_max_pd(x, p));
+    p = _mm512_permutex_pd(x, _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm512_mask_blend_pd(0xCC, _mm512_min_pd(x, p), _mm512_max_pd(x, p));
+    p = _mm512_permute_pd(x, 0x55);
+    x = _mm512_mask_blend_pd(0xAA, _mm512_min_pd(x, p), _mm512_max_pd(x, p));
+    return x;
+}
+
+// sorts the lanes of x, which are a bitonic sequence
+static inline v8sd sort_clean512d(v8sd x)
+{
+    v8sd p;
+    p = _mm512_shuffle_f64x2(x, x, _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm512_mask_blend_pd(0xF0, _mm512_min_pd(x, p), _mm512_max_pd(x, p));
+    p = _mm512_permutex_pd(x, _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm512_mask_blend_pd(0xCC, _mm512_min_pd(x, p), _mm512_max_pd(x, p));
+    p = _mm512_permute_pd(x, 0x55);
+    x = _mm512_mask_blend_pd(0xAA, _mm512_min_pd(x, p), _mm512_max_pd(x, p));
+    return x;
+}
+
+// merges the sorted vectors a and b, a getting the lowest half
+static inline void sort_merge2512d(v8sd *a, v8sd *b)
+{
+    v8sd rev = _mm512_permutexvar_pd(_mm512_set_epi64(0, 1, 2, 3, 4, 5, 6, 7), *b);
+    v8sd low = _mm512_min_pd(*a, rev);
+    v8sd high = _mm512_max_pd(*a, rev);
+    *a = sort_clean512d(low);
+    *b = sort_clean512d(high);
+}
+
+// merges the sorted sequences (a, b) and (c, d)
+static inline void sort_merge4512d(v8sd *a, v8sd *b, v8sd *c, v8sd *d)
+{
+    v8sd rev_c = _mm512_permutexvar_pd(_mm512_set_epi64(0, 1, 2, 3, 4, 5, 6, 7), *d);
+    v8sd rev_d = _mm512_permutexvar_pd(_mm512_set_epi64(0, 1, 2, 3, 4, 5, 6, 7), *c);
+    v8sd low0 = _mm512_min_pd(*a, rev_c);
+    v8sd high0 = _mm512_max_pd(*a, rev_c);
+    v8sd low1 = _mm512_min_pd(*b, rev_d);
+    v8sd high1 = _mm512_max_pd(*b, rev_d);
+    *a = sort_clean512d(_mm512_min_pd(low0, low1));
+    *b = sort_clean512d(_mm512_max_pd(low0, low1));
+    *c = sort_clean512d(_mm512_min_pd(high0, high1));
+    *d = sort_clean512d(_mm512_max_pd(high0, high1));
+}
+
+// sorts up to 4 vectors, padded with the largest value
+static inline void sort_small512d(double *src, int len)
+{
+    double tmp[4 * AVX512_LEN_DOUBLE] __attribute__((aligned(AVX512_LEN_BYTES)));
+
+    memcpy(tmp, src, len * sizeof(double));
+    for (int i = len; i < 4 * AVX512_LEN_DOUBLE; i++) {
+        tmp[i] = INFINITY;
+    }
+
+    v8sd a = sort_lanes512d(_mm512_loadu_pd(tmp));
+    if (len <= AVX512_LEN_DOUBLE) {
+        _mm512_storeu_pd(tmp, a);
+    } else if (len <= 2 * AVX512_LEN_DOUBLE) {
+        v8sd b = sort_lanes512d(_mm512_loadu_pd(tmp + AVX512_LEN_DOUBLE));
+        sort_merge2512d(&a, &b);
+        _mm512_storeu_pd(tmp, a);
+        _mm512_storeu_pd(tmp + AVX512_LEN_DOUBLE, b);
+    } else {
+        v8sd b = sort_lanes512d(_mm512_loadu_pd(tmp + AVX512_LEN_DOUBLE));
+        v8sd c = sort_lanes512d(_mm512_loadu_pd(tmp + 2 * AVX512_LEN_DOUBLE));
+        v8sd d = sort_lanes512d(_mm512_loadu_pd(tmp + 3 * AVX512_LEN_DOUBLE));
+        sort_merge2512d(&a, &b);
+        sort_merge2512d(&c, &d);
+        sort_merge4512d(&a, &b, &c, &d);
+        _mm512_storeu_pd(tmp, a);
+        _mm512_storeu_pd(tmp + AVX512_LEN_DOUBLE, b);
+        _mm512_storeu_pd(tmp + 2 * AVX512_LEN_DOUBLE, c);
+        _mm512_storeu_pd(tmp + 3 * AVX512_LEN_DOUBLE, d);
+    }
+
+    memcpy(src, tmp, len * sizeof(double));
+}
+
+// packs the lanes of x lower than the pivot to [*left_w, ...) and the others to [..., *right_w)
+static inline void partition_store512d(double *src, v8sd x, v8sd pivot_vec, int *left_w, int *right_w)
+{
+    __mmask8 mask = _mm512_cmp_pd_mask(x, pivot_vec, _CMP_LT_OQ);
+    int nb_low = __builtin_popcount(mask);
+    int nb_high = AVX512_LEN_DOUBLE - nb_low;
+
+    // the full vector is stored on the left (free space of a vector at least), masked on the right
+    _mm512_storeu_pd(src + *left_w, _mm512_maskz_compress_pd(mask, x));
+    _mm512_mask_storeu_pd(src + *right_w - nb_high, tail_mask8(nb_high), _mm512_maskz_compress_pd((__mmask8) ~mask, x));
+    *left_w += nb_low;
+    *right_w -= nb_high;
+}
+
+// number of elements lower than pivot, moved to the beginning of src (len >= 2 * AVX512_LEN_DOUBLE)
+static inline int partition512d(double *src, int len, double pivot)
+{
+    v8sd pivot_vec = _mm512_set1_pd(pivot);
+    v8sd first = _mm512_loadu_pd(src);
+    v8sd last = _mm512_loadu_pd(src + len - AVX512_LEN_DOUBLE);
+    int left = AVX512_LEN_DOUBLE, right = len - 2 * AVX512_LEN_DOUBLE;  // next vectors read from each end
+    int left_w = 0, right_w = len;             // free space [left_w, left) and [right + AVX512_LEN_DOUBLE, right_w)
+
+    while (left <= right) {
+        v8sd x;
+        if ((left - left_w) <= (right_w - right - AVX512_LEN_DOUBLE)) {
+            x = _mm512_loadu_pd(src + left);
+            left += AVX512_LEN_DOUBLE;
+        } else {
+            x = _mm512_loadu_pd(src + right);
+            right -= AVX512_LEN_DOUBLE;
+        }
+        partition_store512d(src, x, pivot_vec, &left_w, &right_w);
+    }
+
+    // the last elements (less than a vector) with the first and the last vectors
+    double tmp[3 * AVX512_LEN_DOUBLE];
+    int nb_tmp = right + AVX512_LEN_DOUBLE - left;
+    memcpy(tmp, src + left, nb_tmp * sizeof(double));
+    _mm512_storeu_pd(tmp + nb_tmp, first);
+    _mm512_storeu_pd(tmp + nb_tmp + AVX512_LEN_DOUBLE, last);
+    sort_partition_taild(src, tmp, nb_tmp + 2 * AVX512_LEN_DOUBLE, pivot, &left_w, &right_w);
+    return left_w;
+}
+
+SIMD_UTILS_API void sort512d(double *src, int len)
+{
+    sort_rund(src, len, 4 * AVX512_LEN_DOUBLE, partition512d, sort_small512d);
+}
@@ -115,7 +115,7 @@ static inline v16sf log2512_ps(v16sf x)
     return x;
 }
 
-static inline void log10512f(float *src, float *dst, int len)
+SIMD_UTILS_API void log10512f(float *src, float *dst, int len)
 {
     const v16sf invln10f = _mm512_set1_ps((float) INVLN10);  //_mm512_broadcast_ss(&invln10f_mask);
 
@@ -123,9 +123,17 @@ static inline void log10512f(float *src, float *dst, int len)
     stop_len *= AVX512_LEN_FLOAT;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
-            v16sf src_tmp = log512_ps(_mm512_load_ps(src + i));
-            _mm512_store_ps(dst + i, _mm512_mul_ps(src_tmp, invln10f));
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
+                v16sf src_tmp = log512_ps(_mm512_load_ps(src + i));
+                _mm512_stream_ps(dst + i, _mm512_mul_ps(src_tmp, invln10f));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
+                v16sf src_tmp = log512_ps(_mm512_load_ps(src + i));
+                _mm512_store_ps(dst + i, _mm512_mul_ps(src_tmp, invln10f));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
@@ -134,12 +142,14 @@ static inline void log10512f(float *src, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = log10f(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = log512_ps(_mm512_maskz_loadu_ps(mask, src + i));
+        _mm512_mask_storeu_ps(dst + i, mask, _mm512_mul_ps(src_tmp, invln10f));
     }
 }
 
-static inline void log10512f_precise(float *src, float *dst, int len)
+SIMD_UTILS_API void log10512f_precise(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -156,12 +166,14 @@ static inline void log10512f_precise(float *src, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = log10f(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = log10512_ps(_mm512_maskz_loadu_ps(mask, src + i));
+        _mm512_mask_storeu_ps(dst + i, mask, src_tmp);
     }
 }
 
-static inline void log2512f(float *src, float *dst, int len)
+SIMD_UTILS_API void log2512f(float *src, float *dst, int len)
 {
     const v16sf invln2f = _mm512_set1_ps((float) INVLN2);
 
@@ -169,9 +181,17 @@ static inline void log2512f(float *src, float *dst, int len)
     stop_len *= AVX512_LEN_FLOAT;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
-            v16sf src_tmp = log512_ps(_mm512_load_ps(src + i));
-            _mm512_store_ps(dst + i, _mm512_mul_ps(src_tmp, invln2f));
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
+                v16sf src_tmp = log512_ps(_mm512_load_ps(src + i));
+                _mm512_stream_ps(dst + i, _mm512_mul_ps(src_tmp, invln2f));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
+                v16sf src_tmp = log512_ps(_mm512_load_ps(src + i));
+                _mm512_store_ps(dst + i, _mm512_mul_ps(src_tmp, invln2f));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
@@ -180,12 +200,14 @@ static inline void log2512f(float *src, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = log2f(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = log512_ps(_mm512_maskz_loadu_ps(mask, src + i));
+        _mm512_mask_storeu_ps(dst + i, mask, _mm512_mul_ps(src_tmp, invln2f));
     }
 }
 
-static inline void log2512f_precise(float *src, float *dst, int len)
+SIMD_UTILS_API void log2512f_precise(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -202,19 +224,28 @@ static inline void log2512f_precise(float *src, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = log2f(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = log2512_ps(_mm512_maskz_loadu_ps(mask, src + i));
+        _mm512_mask_storeu_ps(dst + i, mask, src_tmp);
     }
 }
 
-static inline void ln512f(float *src, float *dst, int len)
+SIMD_UTILS_API void ln512f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
-            _mm512_store_ps(dst + i, log512_ps(_mm512_load_ps(src + i)));
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
+                _mm512_stream_ps(dst + i, log512_ps(_mm512_load_ps(src + i)));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
+                _mm512_store_ps(dst + i, log512_ps(_mm512_load_ps(src + i)));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
@@ -222,19 +253,27 @@ static inline void ln512f(float *src, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = logf(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        _mm512_mask_storeu_ps(dst + i, mask, log512_ps(_mm512_maskz_loadu_ps(mask, src + i)));
     }
 }
 
-static inline void exp512f(float *src, float *dst, int len)
+SIMD_UTILS_API void exp512f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
-            _mm512_store_ps(dst + i, exp512_ps(_mm512_load_ps(src + i)));
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
+                _mm512_stream_ps(dst + i, exp512_ps(_mm512_load_ps(src + i)));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
+                _mm512_store_ps(dst + i, exp512_ps(_mm512_load_ps(src + i)));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
@@ -242,8 +281,9 @@ static inline void exp512f(float *src, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = expf(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        _mm512_mask_storeu_ps(dst + i, mask, exp512_ps(_mm512_maskz_loadu_ps(mask, src + i)));
     }
 }
 
@@ -325,7 +365,7 @@ static inline v16sf cbrt512f_ps(v16sf xx)
     return x;
 }
 
-static inline void cbrt512f(float *src, float *dst, int len)
+SIMD_UTILS_API void cbrt512f(float *src, float *dst, int len)
 {
     int stop_len = len / (AVX512_LEN_FLOAT);
     stop_len *= (AVX512_LEN_FLOAT);
@@ -343,24 +383,38 @@ static inline void cbrt512f(float *src, float *dst, int len)
             _mm512_storeu_ps(dst + i, dst_tmp);
         }
     }
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = cbrtf(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf x = _mm512_maskz_loadu_ps(mask, src + i);
+        _mm512_mask_storeu_ps(dst + i, mask, cbrt512f_ps(x));
     }
 }
 
-static inline void fabs512f(float *src, float *dst, int len)
+SIMD_UTILS_API void fabs512f(float *src, float *dst, int len)
 {
     int stop_len = len / (2 * AVX512_LEN_FLOAT);
     stop_len *= (2 * AVX512_LEN_FLOAT);
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
-            v16sf src_tmp = _mm512_load_ps(src + i);
-            v16sf src_tmp2 = _mm512_load_ps(src + i + AVX512_LEN_FLOAT);
-            v16sf dst_tmp = _mm512_and_ps(*(v16sf *) _ps512_pos_sign_mask, src_tmp);
-            v16sf dst_tmp2 = _mm512_and_ps(*(v16sf *) _ps512_pos_sign_mask, src_tmp2);
-            _mm512_store_ps(dst + i, dst_tmp);
-            _mm512_store_ps(dst + i + AVX512_LEN_FLOAT, dst_tmp2);
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
+                v16sf src_tmp = _mm512_load_ps(src + i);
+                v16sf src_tmp2 = _mm512_load_ps(src + i + AVX512_LEN_FLOAT);
+                v16sf dst_tmp = _mm512_and_ps(*(v16sf *) _ps512_pos_sign_mask, src_tmp);
+                v16sf dst_tmp2 = _mm512_and_ps(*(v16sf *) _ps512_pos_sign_mask, src_tmp2);
+                _mm512_stream_ps(dst + i, dst_tmp);
+                _mm512_stream_ps(dst + i + AVX512_LEN_FLOAT, dst_tmp2);
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
+                v16sf src_tmp = _mm512_load_ps(src + i);
+                v16sf src_tmp2 = _mm512_load_ps(src + i + AVX512_LEN_FLOAT);
+                v16sf dst_tmp = _mm512_and_ps(*(v16sf *) _ps512_pos_sign_mask, src_tmp);
+                v16sf dst_tmp2 = _mm512_and_ps(*(v16sf *) _ps512_pos_sign_mask, src_tmp2);
+                _mm512_store_ps(dst + i, dst_tmp);
+                _mm512_store_ps(dst + i + AVX512_LEN_FLOAT, dst_tmp2);
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
@@ -373,12 +427,15 @@ static inline void fabs512f(float *src, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = fabsf(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        v16sf dst_tmp = _mm512_and_ps(*(v16sf *) _ps512_pos_sign_mask, src_tmp);
+        _mm512_mask_storeu_ps(dst + i, mask, dst_tmp);
     }
 }
 
-static inline void set512f(float *dst, float value, int len)
+SIMD_UTILS_API void set512f(float *dst, float value, int len)
 {
     const v16sf tmp = _mm512_set1_ps(value);  //_mm512_broadcast_ss(&value); //avx broadcast vs mm_set_ps?
 
@@ -386,8 +443,15 @@ static inline void set512f(float *dst, float value, int len)
     stop_len *= AVX512_LEN_FLOAT;
 
     if (isAligned((uintptr_t) (dst), AVX512_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
-            _mm512_store_ps(dst + i, tmp);
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
+                _mm512_stream_ps(dst + i, tmp);
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
+                _mm512_store_ps(dst + i, tmp);
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
@@ -395,12 +459,13 @@ static inline void set512f(float *dst, float value, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = value;
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        _mm512_mask_storeu_ps(dst + i, mask, tmp);
     }
 }
 
-static inline void zero512f(float *dst, int len)
+SIMD_UTILS_API void zero512f(float *dst, int len)
 {
     const v16sf tmp = _mm512_setzero_ps();
 
@@ -408,8 +473,15 @@ static inline void zero512f(float *dst, int len)
     stop_len *= AVX512_LEN_FLOAT;
 
     if (isAligned((uintptr_t) (dst), AVX512_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
-            _mm512_store_ps(dst + i, tmp);
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
+                _mm512_stream_ps(dst + i, tmp);
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
+                _mm512_store_ps(dst + i, tmp);
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
@@ -417,23 +489,34 @@ static inline void zero512f(float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = 0.0f;
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        _mm512_mask_storeu_ps(dst + i, mask, tmp);
     }
 }
 
 
-static inline void copy512f(float *src, float *dst, int len)
+SIMD_UTILS_API void copy512f(float *src, float *dst, int len)
 {
     int stop_len = len / (2 * AVX512_LEN_FLOAT);
     stop_len *= (2 * AVX512_LEN_FLOAT);
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
-            v16sf src_tmp = _mm512_load_ps(src + i);
-            v16sf src_tmp2 = _mm512_load_ps(src + i + AVX512_LEN_FLOAT);
-            _mm512_store_ps(dst + i, src_tmp);
-            _mm512_store_ps(dst + i + AVX512_LEN_FLOAT, src_tmp2);
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
+                v16sf src_tmp = _mm512_load_ps(src + i);
+                v16sf src_tmp2 = _mm512_load_ps(src + i + AVX512_LEN_FLOAT);
+                _mm512_stream_ps(dst + i, src_tmp);
+                _mm512_stream_ps(dst + i + AVX512_LEN_FLOAT, src_tmp2);
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
+                v16sf src_tmp = _mm512_load_ps(src + i);
+                v16sf src_tmp2 = _mm512_load_ps(src + i + AVX512_LEN_FLOAT);
+                _mm512_store_ps(dst + i, src_tmp);
+                _mm512_store_ps(dst + i + AVX512_LEN_FLOAT, src_tmp2);
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
@@ -444,12 +527,14 @@ static inline void copy512f(float *src, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        _mm512_mask_storeu_ps(dst + i, mask, src_tmp);
     }
 }
 
-static inline void add512f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void add512f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / (2 * AVX512_LEN_FLOAT);
     stop_len *= (2 * AVX512_LEN_FLOAT);
@@ -478,13 +563,17 @@ static inline void add512f(float *src1, float *src2, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src1[i] + src2[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf a = _mm512_maskz_loadu_ps(mask, src1 + i);
+        v16sf b = _mm512_maskz_loadu_ps(mask, src2 + i);
+        v16sf dst_tmp = _mm512_add_ps(a, b);
+        _mm512_mask_storeu_ps(dst + i, mask, dst_tmp);
     }
 }
 
 
-static inline void mul512f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void mul512f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / (2 * AVX512_LEN_FLOAT);
     stop_len *= (2 * AVX512_LEN_FLOAT);
@@ -513,12 +602,16 @@ static inline void mul512f(float *src1, float *src2, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src1[i] * src2[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf a = _mm512_maskz_loadu_ps(mask, src1 + i);
+        v16sf b = _mm512_maskz_loadu_ps(mask, src2 + i);
+        v16sf dst_tmp = _mm512_mul_ps(a, b);
+        _mm512_mask_storeu_ps(dst + i, mask, dst_tmp);
     }
 }
 
-static inline void sub512f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void sub512f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / (2 * AVX512_LEN_FLOAT);
     stop_len *= (2 * AVX512_LEN_FLOAT);
@@ -547,13 +640,17 @@ static inline void sub512f(float *src1, float *src2, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src1[i] - src2[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf a = _mm512_maskz_loadu_ps(mask, src1 + i);
+        v16sf b = _mm512_maskz_loadu_ps(mask, src2 + i);
+        v16sf dst_tmp = _mm512_sub_ps(a, b);
+        _mm512_mask_storeu_ps(dst + i, mask, dst_tmp);
     }
 }
 
 
-static inline void addc512f(float *src, float value, float *dst, int len)
+SIMD_UTILS_API void addc512f(float *src, float value, float *dst, int len)
 {
     const v16sf tmp = _mm512_set1_ps(value);  //_mm512_broadcast_ss(&value); //avx broadcast vs mm_set_ps?
 
@@ -580,12 +677,15 @@ static inline void addc512f(float *src, float value, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src[i] + value;
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf a = _mm512_maskz_loadu_ps(mask, src + i);
+        v16sf dst_tmp = _mm512_add_ps(a, tmp);
+        _mm512_mask_storeu_ps(dst + i, mask, dst_tmp);
     }
 }
 
-static inline void mulc512f(float *src, float value, float *dst, int len)
+SIMD_UTILS_API void mulc512f(float *src, float value, float *dst, int len)
 {
     const v16sf tmp = _mm512_set1_ps(value);  //_mm512_broadcast_ss(&value); //avx broadcast vs mm_set_ps?
 
@@ -612,12 +712,15 @@ static inline void mulc512f(float *src, float value, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src[i] * value;
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp1 = _mm512_maskz_loadu_ps(mask, src + i);
+        v16sf dst_tmp1 = _mm512_mul_ps(tmp, src_tmp1);
+        _mm512_mask_storeu_ps(dst + i, mask, dst_tmp1);
     }
 }
 
-static inline void muladd512f(float *_a, float *_b, float *_c, float *dst, int len)
+SIMD_UTILS_API void muladd512f(float *_a, float *_b, float *_c, float *dst, int len)
 {
     int stop_len = len / (2 * AVX512_LEN_FLOAT);
     stop_len *= (2 * AVX512_LEN_FLOAT);
@@ -651,12 +754,17 @@ static inline void muladd512f(float *_a, float *_b, float *_c, float *dst, int l
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = (_a[i] * _b[i]) + _c[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf a = _mm512_maskz_loadu_ps(mask, _a + i);
+        v16sf b = _mm512_maskz_loadu_ps(mask, _b + i);
+        v16sf c = _mm512_maskz_loadu_ps(mask, _c + i);
+        v16sf dst_tmp = _mm512_fmadd_ps_custom(a, b, c);
+        _mm512_mask_storeu_ps(dst + i, mask, dst_tmp);
     }
 }
 
-static inline void mulcadd512f(float *_a, float _b, float *_c, float *dst, int len)
+SIMD_UTILS_API void mulcadd512f(float *_a, float _b, float *_c, float *dst, int len)
 {
     v16sf b = _mm512_set1_ps(_b);
 
@@ -677,12 +785,15 @@ static inline void mulcadd512f(float *_a, float _b, float *_c, float *dst, int l
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = _a[i] * _b + _c[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf a = _mm512_maskz_loadu_ps(mask, _a + i);
+        v16sf c = _mm512_maskz_loadu_ps(mask, _c + i);
+        _mm512_mask_storeu_ps(dst + i, mask, _mm512_fmadd_ps_custom(a, b, c));
     }
 }
 
-static inline void mulcaddc512f(float *_a, float _b, float _c, float *dst, int len)
+SIMD_UTILS_API void mulcaddc512f(float *_a, float _b, float _c, float *dst, int len)
 {
     v16sf b = _mm512_set1_ps(_b);
     v16sf c = _mm512_set1_ps(_c);
@@ -702,12 +813,14 @@ static inline void mulcaddc512f(float *_a, float _b, float _c, float *dst, int l
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = _a[i] * _b + _c;
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf a = _mm512_maskz_loadu_ps(mask, _a + i);
+        _mm512_mask_storeu_ps(dst + i, mask, _mm512_fmadd_ps_custom(a, b, c));
     }
 }
 
-static inline void muladdc512f(float *_a, float *_b, float _c, float *dst, int len)
+SIMD_UTILS_API void muladdc512f(float *_a, float *_b, float _c, float *dst, int len)
 {
     v16sf c = _mm512_set1_ps(_c);
 
@@ -728,12 +841,15 @@ static inline void muladdc512f(float *_a, float *_b, float _c, float *dst, int l
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = _a[i] * _b[i] + _c;
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf a = _mm512_maskz_loadu_ps(mask, _a + i);
+        v16sf b = _mm512_maskz_loadu_ps(mask, _b + i);
+        _mm512_mask_storeu_ps(dst + i, mask, _mm512_fmadd_ps_custom(a, b, c));
     }
 }
 
-static inline void div512f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void div512f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -748,12 +864,13 @@ static inline void div512f(float *src1, float *src2, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src1[i] / src2[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        _mm512_mask_storeu_ps(dst + i, mask, _mm512_div_ps(_mm512_maskz_loadu_ps(mask, src1 + i), _mm512_maskz_loadu_ps(mask, src2 + i)));
     }
 }
 
-static inline void vectorSlope512f(float *dst, int len, float offset, float slope)
+SIMD_UTILS_API void vectorSlope512f(float *dst, int len, float offset, float slope)
 {
     v16sf coef = _mm512_set_ps(15.0f * slope, 14.0f * slope, 13.0f * slope, 12.0f * slope,
                                11.0f * slope, 10.0f * slope, 9.0f * slope, 8.0f * slope,
@@ -793,12 +910,15 @@ static inline void vectorSlope512f(float *dst, int len, float offset, float slop
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = offset + slope * (float) i;
+    v16sf index = _mm512_set_ps(15.0f, 14.0f, 13.0f, 12.0f, 11.0f, 10.0f, 9.0f, 8.0f, 7.0f, 6.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f, 0.0f);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf pos = _mm512_add_ps(_mm512_set1_ps((float) i), index);
+        _mm512_mask_storeu_ps(dst + i, mask, _mm512_fmadd_ps_custom(pos, _mm512_set1_ps(slope), _mm512_set1_ps(offset)));
     }
 }
 
-static inline void convertInt16ToFloat32_512(int16_t *src, float *dst, int len, int scale_factor)
+SIMD_UTILS_API void convertInt16ToFloat32_512(int16_t *src, float *dst, int len, int scale_factor)
 {
     int stop_len = len / (2 * AVX512_LEN_FLOAT);
     stop_len *= (2 * AVX512_LEN_FLOAT);
@@ -842,13 +962,16 @@ static inline void convertInt16ToFloat32_512(int16_t *src, float *dst, int len,
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = (float) src[i] * scale_fact_mult;
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16si vec = _mm512_cvtepi16_epi32(_mm256_maskz_loadu_epi16(mask, src + i));
+        v16sf floatlo = _mm512_mul_ps(_mm512_cvtepi32_ps(vec), scale_fact_vec);
+        _mm512_mask_storeu_ps(dst + i, mask, floatlo);
     }
 }
 
 // Allow for integer up to 24bits without overflow
-static inline void convertInt32ToFloat32_512(int32_t *src, float *dst, int len, int scale_factor)
+SIMD_UTILS_API void convertInt32ToFloat32_512(int32_t *src, float *dst, int len, int scale_factor)
 {
     int stop_len = len / (2 * AVX512_LEN_FLOAT);
     stop_len *= (2 * AVX512_LEN_FLOAT);
@@ -880,12 +1003,15 @@ static inline void convertInt32ToFloat32_512(int32_t *src, float *dst, int len,
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = (float) src[i] * scale_fact_mult;
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16si vec = _mm512_maskz_loadu_epi32(mask, src + i);
+        v16sf floatlo = _mm512_mul_ps(_mm512_cvtepi32_ps(vec), scale_fact_vec);
+        _mm512_mask_storeu_ps(dst + i, mask, floatlo);
     }
 }
 
-static inline void convertFloat32ToU8_512(float *src, uint8_t *dst, int len, int rounding_mode, int scale_factor)
+SIMD_UTILS_API void convertFloat32ToU8_512(float *src, uint8_t *dst, int len, int rounding_mode, int scale_factor)
 {
     int stop_len = len / (4 * AVX512_LEN_FLOAT);
     stop_len *= (4 * AVX512_LEN_FLOAT);
@@ -1024,23 +1150,25 @@ static inline void convertFloat32ToU8_512(float *src, uint8_t *dst, int len, int
       }
     }
 
-    if (rounding_mode == RndFinancial) {
-        for (int i = stop_len; i < len; i++) {
-            float tmp = roundf(src[i] * scale_fact_mult);
-            dst[i] = (uint8_t) (tmp > 255.0f ? 255.0f : tmp);  // round to nearest even with round(x/2)*2
-        }
-    } else {
-        // Default round toward zero
-        for (int i = stop_len; i < len; i++) {
-            float tmp = rintf(src[i] * scale_fact_mult);
-            dst[i] = (uint8_t) (tmp > 255.0f ? 255.0f : tmp);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf tmp = _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, src + i), scale_fact_vec);
+        if (rounding_mode == RndFinancial) {
+            v16sf spe = _mm512_and_ps(tmp, *(v16sf *) _ps512_sign_mask);
+            spe = _mm512_or_ps(spe, *(v16sf *) _ps512_mid_mask);
+            tmp = _mm512_roundscale_ps(_mm512_add_ps(tmp, spe), ROUNDTOZERO);
         }
+        v16si tmp_int = _mm512_max_epi32(_mm512_cvtps_epi32(tmp), _mm512_setzero_si512());
+        _mm512_mask_cvtusepi32_storeu_epi8(dst + i, mask, tmp_int);  // unsigned saturation
+    }
+
+    if (rounding_mode != RndFinancial) {
         _MM_SET_ROUNDING_MODE(_mm_rounding_ori);  // restore previous rounding mode
         fesetround(rounding_ori);
     }
 }
 
-static inline void convertFloat32ToU16_512(float *src, uint16_t *dst, int len, int rounding_mode, int scale_factor)
+SIMD_UTILS_API void convertFloat32ToU16_512(float *src, uint16_t *dst, int len, int rounding_mode, int scale_factor)
 {
     int stop_len = len / (2 * AVX512_LEN_FLOAT);
     stop_len *= (2 * AVX512_LEN_FLOAT);
@@ -1131,23 +1259,25 @@ static inline void convertFloat32ToU16_512(float *src, uint16_t *dst, int len, i
       }
     }
 
-    if (rounding_mode == RndFinancial) {
-        for (int i = stop_len; i < len; i++) {
-            float tmp = roundf(src[i] * scale_fact_mult);
-            dst[i] = (uint16_t) (tmp > 65535.0f ? 65535.0f : tmp);  
-        }
-    } else {
-        // Default round toward zero
-        for (int i = stop_len; i < len; i++) {
-            float tmp = rintf(src[i] * scale_fact_mult);
-            dst[i] = (uint16_t) (tmp > 65535.0f ? 65535.0f : tmp);  
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf tmp = _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, src + i), scale_fact_vec);
+        if (rounding_mode == RndFinancial) {
+            v16sf spe = _mm512_and_ps(tmp, *(v16sf *) _ps512_sign_mask);
+            spe = _mm512_or_ps(spe, *(v16sf *) _ps512_mid_mask);
+            tmp = _mm512_roundscale_ps(_mm512_add_ps(tmp, spe), ROUNDTOZERO);
         }
+        v16si tmp_int = _mm512_max_epi32(_mm512_cvtps_epi32(tmp), _mm512_setzero_si512());
+        _mm512_mask_cvtusepi32_storeu_epi16(dst + i, mask, tmp_int);  // unsigned saturation
+    }
+
+    if (rounding_mode != RndFinancial) {
         _MM_SET_ROUNDING_MODE(_mm_rounding_ori);  // restore previous rounding mode
         fesetround(rounding_ori);
     }
 }
 
-static inline void convertFloat32ToI16_512(float *src, int16_t *dst, int len, int rounding_mode, int scale_factor)
+SIMD_UTILS_API void convertFloat32ToI16_512(float *src, int16_t *dst, int len, int rounding_mode, int scale_factor)
 {
     int stop_len = len / (2 * AVX512_LEN_FLOAT);
     stop_len *= (2 * AVX512_LEN_FLOAT);
@@ -1238,25 +1368,24 @@ static inline void convertFloat32ToI16_512(float *src, int16_t *dst, int len, in
       }
    }
  
-    if (rounding_mode == RndFinancial) {
-        for (int i = stop_len; i < len; i++) {
-            float tmp = roundf(src[i] * scale_fact_mult);
-            dst[i] = (int16_t) (tmp > 32767.0f ? 32767.0f : tmp);  
-			dst[i] = (int16_t) (tmp < -32768.0f ? -32768.0f : tmp);  
-        }
-    } else {
-        // Default round toward zero
-        for (int i = stop_len; i < len; i++) {
-            float tmp = rintf(src[i] * scale_fact_mult);
-            dst[i] = (int16_t) (tmp > 32767.0f ? 32767.0f : tmp);
-			dst[i] = (int16_t) (tmp < -32768.0f ? -32768.0f : tmp);  
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf tmp = _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, src + i), scale_fact_vec);
+        if (rounding_mode == RndFinancial) {
+            v16sf spe = _mm512_and_ps(tmp, *(v16sf *) _ps512_sign_mask);
+            spe = _mm512_or_ps(spe, *(v16sf *) _ps512_mid_mask);
+            tmp = _mm512_roundscale_ps(_mm512_add_ps(tmp, spe), ROUNDTOZERO);
         }
+        _mm512_mask_cvtsepi32_storeu_epi16(dst + i, mask, _mm512_cvtps_epi32(tmp));  // signed saturation
+    }
+
+    if (rounding_mode != RndFinancial) {
         _MM_SET_ROUNDING_MODE(_mm_rounding_ori);  // restore previous rounding mode
         fesetround(rounding_ori);
     }
 }
 
-static inline void cplxtoreal512f(complex32_t *src, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxtoreal512f(complex32_t *src, float *dstRe, float *dstIm, int len)
 {
     int stop_len = 2 * len / (4 * AVX512_LEN_FLOAT);
     stop_len *= 4 * AVX512_LEN_FLOAT;
@@ -1287,14 +1416,16 @@ static inline void cplxtoreal512f(complex32_t *src, float *dstRe, float *dstIm,
         }
     }
 
-    for (int i = j; i < len; i++) {
-        dstRe[i] = src[i].re;
-        dstIm[i] = src[i].im;
+    for (int i = j; i < len; i += AVX512_LEN_FLOAT) {
+        v16sfx2 tmp = _mm512_maskz_load2u_ps(len - i, (float const *) (src + i));
+        __mmask16 mask = tail_mask16(len - i);
+        _mm512_mask_storeu_ps(dstRe + i, mask, tmp.val[0]);
+        _mm512_mask_storeu_ps(dstIm + i, mask, tmp.val[1]);
     }
 }
 
 
-static inline void realtocplx512f(float *srcRe, float *srcIm, complex32_t *dst, int len)
+SIMD_UTILS_API void realtocplx512f(float *srcRe, float *srcIm, complex32_t *dst, int len)
 {
     int stop_len = len / (2 * AVX512_LEN_FLOAT);
     stop_len *= 2 * AVX512_LEN_FLOAT;
@@ -1327,14 +1458,17 @@ static inline void realtocplx512f(float *srcRe, float *srcIm, complex32_t *dst,
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i].re = srcRe[i];
-        dst[i].im = srcIm[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sfx2 vec;
+        vec.val[0] = _mm512_maskz_loadu_ps(mask, srcRe + i);
+        vec.val[1] = _mm512_maskz_loadu_ps(mask, srcIm + i);
+        _mm512_mask_store2u_ps((float *) (dst + i), len - i, vec);
     }
 }
 
 
-static inline void convert512_64f32f(double *src, float *dst, int len)
+SIMD_UTILS_API void convert512_64f32f(double *src, float *dst, int len)
 {
     int stop_len = len / (4 * AVX512_LEN_DOUBLE);
     stop_len *= (4 * AVX512_LEN_DOUBLE);
@@ -1382,12 +1516,14 @@ static inline void convert512_64f32f(double *src, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = (float) src[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sf dst_lo = _mm512_cvtpd_ps(_mm512_maskz_loadu_pd(mask, src + i));
+        _mm256_mask_storeu_ps(dst + i, mask, dst_lo);
     }
 }
 
-static inline void convert512_32f64f(float *src, double *dst, int len)
+SIMD_UTILS_API void convert512_32f64f(float *src, double *dst, int len)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);
     stop_len *= (2 * AVX_LEN_FLOAT);
@@ -1412,24 +1548,21 @@ static inline void convert512_32f64f(float *src, double *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = (double) src[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_DOUBLE) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sd dst_tmp = _mm512_cvtps_pd(_mm256_maskz_loadu_ps(mask, src + i));
+        _mm512_mask_storeu_pd(dst + i, mask, dst_tmp);
     }
 }
 
-static inline void flip512f(float *src, float *dst, int len)
+SIMD_UTILS_API void flip512f(float *src, float *dst, int len)
 {
     int stop_len = len / (2 * AVX512_LEN_FLOAT);
     stop_len *= (2 * AVX512_LEN_FLOAT);
     v16si flip_idx = _mm512_set_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
 
-    int mini = ((len - 1) < (2 * AVX512_LEN_FLOAT)) ? (len - 1) : (2 * AVX512_LEN_FLOAT);
-    for (int i = 0; i < mini; i++) {
-        dst[len - i - 1] = src[i];
-    }
-
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst + len - AVX512_LEN_FLOAT), AVX512_LEN_BYTES)) {
-        for (int i = 2 * AVX512_LEN_FLOAT; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
             v16sf src_tmp = _mm512_load_ps(src + i);  // load a,b,c,d,e,f,g,h
             v16sf src_tmp2 = _mm512_load_ps(src + i + AVX512_LEN_FLOAT);
             v16sf src_tmp_flip = _mm512_permutex2var_ps(src_tmp, flip_idx, src_tmp);
@@ -1438,7 +1571,7 @@ static inline void flip512f(float *src, float *dst, int len)
             _mm512_store_ps(dst + len - i - 2 * AVX512_LEN_FLOAT, src_tmp_flip2);
         }
     } else {
-        for (int i = 2 * AVX512_LEN_FLOAT; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
             v16sf src_tmp = _mm512_loadu_ps(src + i);  // load a,b,c,d,e,f,g,h
             v16sf src_tmp2 = _mm512_loadu_ps(src + i + AVX512_LEN_FLOAT);
             v16sf src_tmp_flip = _mm512_permutex2var_ps(src_tmp, flip_idx, src_tmp);
@@ -1448,12 +1581,15 @@ static inline void flip512f(float *src, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[len - i - 1] = src[i];
+    // the reversed elements of the tail are in the upper lanes
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        v16sf src_tmp = _mm512_maskz_loadu_ps(tail_mask16(len - i), src + i);
+        v16sf src_tmp_flip = _mm512_permutexvar_ps(flip_idx, src_tmp);
+        _mm512_mask_storeu_ps(dst + len - i - AVX512_LEN_FLOAT, (__mmask16) ~tail_mask16(AVX512_LEN_FLOAT - (len - i)), src_tmp_flip);
     }
 }
 
-static inline void maxevery512f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void maxevery512f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / (2 * AVX512_LEN_FLOAT);
     stop_len *= (2 * AVX512_LEN_FLOAT);
@@ -1482,12 +1618,16 @@ static inline void maxevery512f(float *src1, float *src2, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src1[i] > src2[i] ? src1[i] : src2[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src1_tmp = _mm512_maskz_loadu_ps(mask, src1 + i);
+        v16sf src2_tmp = _mm512_maskz_loadu_ps(mask, src2 + i);
+        v16sf dst_tmp = _mm512_max_ps(src1_tmp, src2_tmp);
+        _mm512_mask_storeu_ps(dst + i, mask, dst_tmp);
     }
 }
 
-static inline void minevery512f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void minevery512f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / (2 * AVX512_LEN_FLOAT);
     stop_len *= (2 * AVX512_LEN_FLOAT);
@@ -1516,12 +1656,16 @@ static inline void minevery512f(float *src1, float *src2, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src1[i] < src2[i] ? src1[i] : src2[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src1_tmp = _mm512_maskz_loadu_ps(mask, src1 + i);
+        v16sf src2_tmp = _mm512_maskz_loadu_ps(mask, src2 + i);
+        v16sf dst_tmp = _mm512_min_ps(src1_tmp, src2_tmp);
+        _mm512_mask_storeu_ps(dst + i, mask, dst_tmp);
     }
 }
 
-static inline void minmax512f(float *src, int len, float *min_value, float *max_value)
+SIMD_UTILS_API void minmax512f(float *src, int len, float *min_value, float *max_value)
 {
     int stop_len = (len - AVX512_LEN_FLOAT) / (2 * AVX512_LEN_FLOAT);
     stop_len *= (2 * AVX512_LEN_FLOAT);
@@ -1566,6 +1710,13 @@ static inline void minmax512f(float *src, int len, float *min_value, float *max_
             }
         }
 
+        for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+            __mmask16 mask = tail_mask16(len - i);
+            src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+            max_v = _mm512_mask_max_ps(max_v, mask, max_v, src_tmp);
+            min_v = _mm512_mask_min_ps(min_v, mask, min_v, src_tmp);
+        }
+
         max_v = _mm512_max_ps(max_v, max_v2);
         min_v = _mm512_min_ps(min_v, min_v2);
 
@@ -1598,18 +1749,18 @@ static inline void minmax512f(float *src, int len, float *min_value, float *max_
         _mm_store_ss(&max_tmp, max4);
         _mm_store_ss(&min_tmp, min4);
 #endif
-    }
-
-    for (int i = stop_len; i < len; i++) {
-        max_tmp = max_tmp > src[i] ? max_tmp : src[i];
-        min_tmp = min_tmp < src[i] ? min_tmp : src[i];
+    } else {
+        // the masked out lanes get src[0]
+        src_tmp = _mm512_mask_loadu_ps(_mm512_set1_ps(src[0]), tail_mask16(len), src);
+        min_tmp = _mm512_reduce_min_ps(src_tmp);
+        max_tmp = _mm512_reduce_max_ps(src_tmp);
     }
 
     *max_value = max_tmp;
     *min_value = min_tmp;
 }
 
-static inline void threshold512_gt_f(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold512_gt_f(float *src, float *dst, int len, float value)
 {
     v16sf tmp = _mm512_set1_ps(value);  //_mm512_broadcast_ss(&value); //avx broadcast vs mm_set_ps?
 
@@ -1636,12 +1787,15 @@ static inline void threshold512_gt_f(float *src, float *dst, int len, float valu
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src[i] < value ? src[i] : value;
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        v16sf dst_tmp = _mm512_min_ps(src_tmp, tmp);
+        _mm512_mask_storeu_ps(dst + i, mask, dst_tmp);
     }
 }
 
-static inline void threshold512_gtabs_f(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold512_gtabs_f(float *src, float *dst, int len, float value)
 {
     const v16sf pval = _mm512_set1_ps(value);
 
@@ -1668,16 +1822,15 @@ static inline void threshold512_gtabs_f(float *src, float *dst, int len, float v
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        if (src[i] >= 0.0f) {
-            dst[i] = src[i] > value ? value : src[i];
-        } else {
-            dst[i] = src[i] < (-value) ? (-value) : src[i];
-        }
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        v16sf dst_tmp = _mm512_range_ps(src_tmp, pval, 0x2);
+        _mm512_mask_storeu_ps(dst + i, mask, dst_tmp);
     }
 }
 
-static inline void threshold512_lt_f(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold512_lt_f(float *src, float *dst, int len, float value)
 {
     v16sf tmp = _mm512_set1_ps(value);  //_mm512_broadcast_ss(&value); //avx broadcast vs mm_set_ps?
 
@@ -1704,12 +1857,15 @@ static inline void threshold512_lt_f(float *src, float *dst, int len, float valu
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src[i] > value ? src[i] : value;
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        v16sf dst_tmp = _mm512_max_ps(src_tmp, tmp);
+        _mm512_mask_storeu_ps(dst + i, mask, dst_tmp);
     }
 }
 
-static inline void threshold512_ltabs_f(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold512_ltabs_f(float *src, float *dst, int len, float value)
 {
     const v16sf pval = _mm512_set1_ps(value);
 
@@ -1736,24 +1892,23 @@ static inline void threshold512_ltabs_f(float *src, float *dst, int len, float v
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        if (src[i] >= 0.0f) {
-            dst[i] = src[i] < value ? value : src[i];
-        } else {
-            dst[i] = src[i] > (-value) ? (-value) : src[i];
-        }
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        v16sf dst_tmp = _mm512_range_ps(src_tmp, pval, 0x3);
+        _mm512_mask_storeu_ps(dst + i, mask, dst_tmp);
     }
 }
 
-static inline void threshold512_ltval_gtval_f(float *src, float *dst, int len, float ltlevel, float ltvalue, float gtlevel, float gtvalue)
+SIMD_UTILS_API void threshold512_ltval_gtval_f(float *src, float *dst, int len, float ltlevel, float ltvalue, float gtlevel, float gtvalue)
 {
     const v16sf ltlevel_v = _mm512_set1_ps(ltlevel);
     const v16sf ltvalue_v = _mm512_set1_ps(ltvalue);
     const v16sf gtlevel_v = _mm512_set1_ps(gtlevel);
     const v16sf gtvalue_v = _mm512_set1_ps(gtvalue);
 
-    int stop_len = len / (2 * AVX512_LEN_BYTES);
-    stop_len *= (2 * AVX512_LEN_BYTES);
+    int stop_len = len / (2 * AVX512_LEN_FLOAT);
+    stop_len *= (2 * AVX512_LEN_FLOAT);
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
         for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
@@ -1787,22 +1942,34 @@ static inline void threshold512_ltval_gtval_f(float *src, float *dst, int len, f
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-		float tmp = src[i];
-        dst[i] = tmp < ltlevel ? ltvalue : tmp;
-        dst[i] = tmp > gtlevel ? gtvalue : dst[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        __mmask16 lt_mask = _mm512_cmp_ps_mask(src_tmp, ltlevel_v, _CMP_LT_OS);
+        __mmask16 gt_mask = _mm512_cmp_ps_mask(src_tmp, gtlevel_v, _CMP_GT_OS);
+        v16sf dst_tmp = _mm512_mask_blend_ps(lt_mask, src_tmp, ltvalue_v);
+        dst_tmp = _mm512_mask_blend_ps(gt_mask, dst_tmp, gtvalue_v);
+        _mm512_mask_storeu_ps(dst + i, mask, dst_tmp);
     }
 }
 
-static inline void sin512f(float *src, float *dst, int len)
+SIMD_UTILS_API void sin512f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
-            v16sf src_tmp = _mm512_load_ps(src + i);
-            _mm512_store_ps(dst + i, sin512_ps(src_tmp));
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
+                v16sf src_tmp = _mm512_load_ps(src + i);
+                _mm512_stream_ps(dst + i, sin512_ps(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
+                v16sf src_tmp = _mm512_load_ps(src + i);
+                _mm512_store_ps(dst + i, sin512_ps(src_tmp));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
@@ -1811,20 +1978,30 @@ static inline void sin512f(float *src, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = sinf(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        _mm512_mask_storeu_ps(dst + i, mask, sin512_ps(src_tmp));
     }
 }
 
-static inline void cos512f(float *src, float *dst, int len)
+SIMD_UTILS_API void cos512f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
-            v16sf src_tmp = _mm512_load_ps(src + i);
-            _mm512_store_ps(dst + i, cos512_ps(src_tmp));
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
+                v16sf src_tmp = _mm512_load_ps(src + i);
+                _mm512_stream_ps(dst + i, cos512_ps(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
+                v16sf src_tmp = _mm512_load_ps(src + i);
+                _mm512_store_ps(dst + i, cos512_ps(src_tmp));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
@@ -1833,12 +2010,14 @@ static inline void cos512f(float *src, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = cosf(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        _mm512_mask_storeu_ps(dst + i, mask, cos512_ps(src_tmp));
     }
 }
 
-static inline void sincos512f(float *src, float *dst_sin, float *dst_cos, int len)
+SIMD_UTILS_API void sincos512f(float *src, float *dst_sin, float *dst_cos, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1863,13 +2042,19 @@ static inline void sincos512f(float *src, float *dst_sin, float *dst_cos, int le
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        mysincosf(src[i], dst_sin + i, dst_cos + i);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        v16sf dst_sin_tmp;
+        v16sf dst_cos_tmp;
+        sincos512_ps(src_tmp, &dst_sin_tmp, &dst_cos_tmp);
+        _mm512_mask_storeu_ps(dst_sin + i, mask, dst_sin_tmp);
+        _mm512_mask_storeu_ps(dst_cos + i, mask, dst_cos_tmp);
     }
 }
 
 // e^ix = cos(x) + i*sin(x)
-static inline void sincos512f_interleaved(float *src, complex32_t *dst, int len)
+SIMD_UTILS_API void sincos512f_interleaved(float *src, complex32_t *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1893,8 +2078,11 @@ static inline void sincos512f_interleaved(float *src, complex32_t *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        mysincosf(src[i], &(dst[i].im), &(dst[i].re));
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        v16sf src_tmp = _mm512_maskz_loadu_ps(tail_mask16(len - i), src + i);
+        v16sfx2 dst_tmp;
+        sincos512_ps(src_tmp, &(dst_tmp.val[1]), &(dst_tmp.val[0]));
+        _mm512_mask_store2u_ps((float *) (dst + i), len - i, dst_tmp);
     }
 }
 
@@ -1930,7 +2118,7 @@ static inline v16sf acosh512f_ps(v16sf x)
     return z;
 }
 
-static inline void acosh512f(float *src, float *dst, int len)
+SIMD_UTILS_API void acosh512f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1947,8 +2135,10 @@ static inline void acosh512f(float *src, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = acoshf(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        _mm512_mask_storeu_ps(dst + i, mask, acosh512f_ps(src_tmp));
     }
 }
 
@@ -1983,7 +2173,7 @@ static inline v16sf asinh512f_ps(v16sf xx)
     return z;
 }
 
-static inline void asinh512f(float *src, float *dst, int len)
+SIMD_UTILS_API void asinh512f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -2000,8 +2190,10 @@ static inline void asinh512f(float *src, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = asinhf(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        _mm512_mask_storeu_ps(dst + i, mask, asinh512f_ps(src_tmp));
     }
 }
 
@@ -2046,7 +2238,7 @@ static inline v16sf atanh512f_ps(v16sf x)
     return (z);
 }
 
-static inline void atanh512f(float *src, float *dst, int len)
+SIMD_UTILS_API void atanh512f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -2063,8 +2255,10 @@ static inline void atanh512f(float *src, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = atanhf(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        _mm512_mask_storeu_ps(dst + i, mask, atanh512f_ps(src_tmp));
     }
 }
 
@@ -2085,7 +2279,7 @@ static inline v16sf cosh512f_ps(v16sf xx)
     return y;
 }
 
-static inline void cosh512f(float *src, float *dst, int len)
+SIMD_UTILS_API void cosh512f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -2102,8 +2296,10 @@ static inline void cosh512f(float *src, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = coshf(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        _mm512_mask_storeu_ps(dst + i, mask, cosh512f_ps(src_tmp));
     }
 }
 
@@ -2143,7 +2339,7 @@ static inline v16sf sinh512f_ps(v16sf x)
     return (z);
 }
 
-static inline void sinh512f(float *src, float *dst, int len)
+SIMD_UTILS_API void sinh512f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -2160,8 +2356,10 @@ static inline void sinh512f(float *src, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = sinhf(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        _mm512_mask_storeu_ps(dst + i, mask, sinh512f_ps(src_tmp));
     }
 }
 
@@ -2202,7 +2400,7 @@ static inline v16sf atan512f_ps(v16sf xx)
     return (y);
 }
 
-static inline void atan512f(float *src, float *dst, int len)
+SIMD_UTILS_API void atan512f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -2219,8 +2417,10 @@ static inline void atan512f(float *src, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = atanf(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        _mm512_mask_storeu_ps(dst + i, mask, atan512f_ps(src_tmp));
     }
 }
 
@@ -2260,7 +2460,7 @@ static inline v16sf atan2512f_ps(v16sf y, v16sf x)
     return (z);
 }
 
-static inline void atan2512f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void atan2512f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -2275,12 +2475,13 @@ static inline void atan2512f(float *src1, float *src2, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = atan2f(src1[i], src2[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        _mm512_mask_storeu_ps(dst + i, mask, atan2512f_ps(_mm512_maskz_loadu_ps(mask, src1 + i), _mm512_maskz_loadu_ps(mask, src2 + i)));
     }
 }
 
-static inline void atan2512f_interleaved(complex32_t *src, float *dst, int len)
+SIMD_UTILS_API void atan2512f_interleaved(complex32_t *src, float *dst, int len)
 {
     int stop_len = len / (2 * AVX512_LEN_FLOAT);
     stop_len *= 2 * AVX512_LEN_FLOAT;
@@ -2304,8 +2505,9 @@ static inline void atan2512f_interleaved(complex32_t *src, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = atan2f(src[i].im, src[i].re);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        v16sfx2 src1 = _mm512_maskz_load2u_ps(len - i, (float *) (src + i));
+        _mm512_mask_storeu_ps(dst + i, tail_mask16(len - i), atan2512f_ps(src1.val[1], src1.val[0]));
     }
 }
 
@@ -2353,7 +2555,7 @@ static inline v16sf asin512f_ps(v16sf xx)
     return (z);
 }
 
-static inline void asin512f(float *src, float *dst, int len)
+SIMD_UTILS_API void asin512f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -2370,8 +2572,10 @@ static inline void asin512f(float *src, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = asinf(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        _mm512_mask_storeu_ps(dst + i, mask, asin512f_ps(src_tmp));
     }
 }
 
@@ -2413,7 +2617,7 @@ static inline v16sf tanh512f_ps(v16sf xx)
     return (z);
 }
 
-static inline void tanh512f(float *src, float *dst, int len)
+SIMD_UTILS_API void tanh512f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -2430,8 +2634,10 @@ static inline void tanh512f(float *src, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = tanhf(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        _mm512_mask_storeu_ps(dst + i, mask, tanh512f_ps(src_tmp));
     }
 }
 
@@ -2493,15 +2699,23 @@ static inline v16sf tan512f_ps(v16sf xx)
     return (y);
 }
 
-static inline void tan512f(float *src, float *dst, int len)
+SIMD_UTILS_API void tan512f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
-            v16sf src_tmp = _mm512_load_ps(src + i);
-            _mm512_store_ps(dst + i, tan512f_ps(src_tmp));
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
+                v16sf src_tmp = _mm512_load_ps(src + i);
+                _mm512_stream_ps(dst + i, tan512f_ps(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
+                v16sf src_tmp = _mm512_load_ps(src + i);
+                _mm512_store_ps(dst + i, tan512f_ps(src_tmp));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
@@ -2510,14 +2724,16 @@ static inline void tan512f(float *src, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = tanf(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        _mm512_mask_storeu_ps(dst + i, mask, tan512f_ps(src_tmp));
     }
 }
 
 #else
 
-static inline void tan512f(float *src, float *dst, int len)
+SIMD_UTILS_API void tan512f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -2534,13 +2750,15 @@ static inline void tan512f(float *src, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = tanf(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        _mm512_mask_storeu_ps(dst + i, mask, _mm512_div_ps(sin512_ps(src_tmp), cos512_ps(src_tmp)));
     }
 }
 #endif
 
-static inline void magnitude512f_split(float *srcRe, float *srcIm, float *dst, int len)
+SIMD_UTILS_API void magnitude512f_split(float *srcRe, float *srcIm, float *dst, int len)
 {
     int stop_len = len / (2 * AVX512_LEN_FLOAT);
     stop_len *= (2 * AVX512_LEN_FLOAT);
@@ -2577,12 +2795,18 @@ static inline void magnitude512f_split(float *srcRe, float *srcIm, float *dst, i
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = sqrtf(srcRe[i] * srcRe[i] + srcIm[i] * srcIm[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf re_tmp = _mm512_maskz_loadu_ps(mask, srcRe + i);
+        v16sf im_tmp = _mm512_maskz_loadu_ps(mask, srcIm + i);
+        v16sf re_square = _mm512_mul_ps(re_tmp, re_tmp);
+        v16sf dst_tmp = _mm512_fmadd_ps_custom(im_tmp, im_tmp, re_square);
+        dst_tmp = _mm512_sqrt_ps(dst_tmp);
+        _mm512_mask_storeu_ps(dst + i, mask, dst_tmp);
     }
 }
 
-static inline void powerspect512f_split(float *srcRe, float *srcIm, float *dst, int len)
+SIMD_UTILS_API void powerspect512f_split(float *srcRe, float *srcIm, float *dst, int len)
 {
     int stop_len = len / (2 * AVX512_LEN_FLOAT);
     stop_len *= (2 * AVX512_LEN_FLOAT);
@@ -2615,12 +2839,17 @@ static inline void powerspect512f_split(float *srcRe, float *srcIm, float *dst,
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = srcRe[i] * srcRe[i] + srcIm[i] * srcIm[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf re_tmp = _mm512_maskz_loadu_ps(mask, srcRe + i);
+        v16sf im_tmp = _mm512_maskz_loadu_ps(mask, srcIm + i);
+        v16sf re_square = _mm512_mul_ps(re_tmp, re_tmp);
+        v16sf dst_tmp = _mm512_fmadd_ps_custom(im_tmp, im_tmp, re_square);
+        _mm512_mask_storeu_ps(dst + i, mask, dst_tmp);
     }
 }
 
-static inline void magnitude512f_interleaved(complex32_t *src, float *dst, int len)
+SIMD_UTILS_API void magnitude512f_interleaved(complex32_t *src, float *dst, int len)
 {
     int stop_len = len / (4 * AVX512_LEN_FLOAT);
     stop_len *= 4 * AVX512_LEN_FLOAT;
@@ -2684,12 +2913,15 @@ static inline void magnitude512f_interleaved(complex32_t *src, float *dst, int l
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = sqrtf(src[i].re * src[i].re + (src[i].im * src[i].im));
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        v16sfx2 src_split = _mm512_maskz_load2u_ps(len - i, (float *) (src + i));
+        v16sf split_square0 = _mm512_mul_ps(src_split.val[0], src_split.val[0]);
+        v16sf dst_tmp = _mm512_fmadd_ps_custom(src_split.val[1], src_split.val[1], split_square0);
+        _mm512_mask_storeu_ps(dst + i, tail_mask16(len - i), _mm512_sqrt_ps(dst_tmp));
     }
 }
 
-static inline void powerspect512f_interleaved(complex32_t *src, float *dst, int len)
+SIMD_UTILS_API void powerspect512f_interleaved(complex32_t *src, float *dst, int len)
 {
     int stop_len = len / (4 * AVX512_LEN_FLOAT);
     stop_len *= 4 * AVX512_LEN_FLOAT;
@@ -2743,12 +2975,15 @@ static inline void powerspect512f_interleaved(complex32_t *src, float *dst, int
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src[i].re * src[i].re + (src[i].im * src[i].im);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        v16sfx2 src_split = _mm512_maskz_load2u_ps(len - i, (float *) (src + i));
+        v16sf split_square0 = _mm512_mul_ps(src_split.val[0], src_split.val[0]);
+        v16sf dst_tmp = _mm512_fmadd_ps_custom(src_split.val[1], src_split.val[1], split_square0);
+        _mm512_mask_storeu_ps(dst + i, tail_mask16(len - i), dst_tmp);
     }
 }
 
-static inline void subcrev512f(float *src, float value, float *dst, int len)
+SIMD_UTILS_API void subcrev512f(float *src, float value, float *dst, int len)
 {
     const v16sf tmp = _mm512_set1_ps(value);
 
@@ -2765,12 +3000,13 @@ static inline void subcrev512f(float *src, float value, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = value - src[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        _mm512_mask_storeu_ps(dst + i, mask, _mm512_sub_ps(tmp, _mm512_maskz_loadu_ps(mask, src + i)));
     }
 }
 
-static inline void sum512f(float *src, float *dst, int len)
+SIMD_UTILS_API void sum512f(float *src, float *dst, int len)
 {
     int stop_len = len / (2 * AVX512_LEN_FLOAT);
     stop_len *= (2 * AVX512_LEN_FLOAT);
@@ -2794,24 +3030,26 @@ static inline void sum512f(float *src, float *dst, int len)
         }
     }
 
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        v16sf vec_tmp1 = _mm512_maskz_loadu_ps(tail_mask16(len - i), src + i);
+        vec_acc1 = _mm512_add_ps(vec_acc1, vec_tmp1);
+    }
+
     vec_acc1 = _mm512_add_ps(vec_acc1, vec_acc2);
     float tmp_acc = _mm512_reduce_add_ps(vec_acc1);
-    for (int i = stop_len; i < len; i++) {
-        tmp_acc += src[i];
-    }
-    
+
     *dst = tmp_acc;
 }
 
 
-static inline void mean512f(float *src, float *dst, int len)
+SIMD_UTILS_API void mean512f(float *src, float *dst, int len)
 {
     float coeff = 1.0f / ((float) len);
     sum512f(src, dst, len);
     *dst *= coeff;
 }
 
-static inline void dot512f(float *src1, float *src2, int len, float *dst)
+SIMD_UTILS_API void dot512f(float *src1, float *src2, int len, float *dst)
 {
     int stop_len = len / (2 * AVX512_LEN_FLOAT);
     stop_len *= (2 * AVX512_LEN_FLOAT);
@@ -2838,16 +3076,21 @@ static inline void dot512f(float *src1, float *src2, int len, float *dst)
             vec_acc2 = _mm512_fmadd_ps(vec_src1_tmp2, vec_src2_tmp2, vec_acc2);
         }
     }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf vec_src1_tmp = _mm512_maskz_loadu_ps(mask, src1 + i);
+        v16sf vec_src2_tmp = _mm512_maskz_loadu_ps(mask, src2 + i);
+        vec_acc1 = _mm512_fmadd_ps(vec_src1_tmp, vec_src2_tmp, vec_acc1);
+    }
+
     vec_acc1 = _mm512_add_ps(vec_acc1, vec_acc2);
     float tmp_acc = _mm512_reduce_add_ps(vec_acc1);
-    for (int i = stop_len; i < len; i++) {
-        tmp_acc += src1[i] * src2[i];
-    }
 
     *dst = tmp_acc;
 }
 
-static inline void dotc512f(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst)
+SIMD_UTILS_API void dotc512f(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst)
 {
     int stop_len = len / (4 * AVX512_LEN_FLOAT);
     stop_len *= (4 * AVX512_LEN_FLOAT);
@@ -2902,188 +3145,1180 @@ static inline void dotc512f(complex32_t *src1, complex32_t *src2, int len, compl
         }
     }
 
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        v16sfx2 src1_split = _mm512_maskz_load2u_ps(len - i, (float *) (src1 + i));
+        v16sfx2 src2_split = _mm512_maskz_load2u_ps(len - i, (float *) (src2 + i));
+        v16sf ac = _mm512_mul_ps(src1_split.val[0], src2_split.val[0]);  // ac
+        v16sf ad = _mm512_mul_ps(src1_split.val[0], src2_split.val[1]);  // ad
+        vec_acc1.val[0] = _mm512_add_ps(vec_acc1.val[0], _mm512_fnmadd_ps(src1_split.val[1], src2_split.val[1], ac));
+        vec_acc1.val[1] = _mm512_add_ps(vec_acc1.val[1], _mm512_fmadd_ps(src1_split.val[1], src2_split.val[0], ad));
+    }
+
     vec_acc1.val[0] = _mm512_add_ps(vec_acc1.val[0], vec_acc2.val[0]);
     vec_acc1.val[1] = _mm512_add_ps(vec_acc1.val[1], vec_acc2.val[1]);
-    
+
     dst_tmp.re = _mm512_reduce_add_ps(vec_acc1.val[0]);
     dst_tmp.im = _mm512_reduce_add_ps(vec_acc1.val[1]);
 
-    for (int i = stop_len; i < len; i++) {
-        dst_tmp.re += src1[i].re * src2[i].re - (src1[i].im * src2[i].im);
-        dst_tmp.im += src1[i].re * src2[i].im + (src2[i].re * src1[i].im);
-    }
-
     dst->re = dst_tmp.re;
     dst->im = dst_tmp.im;
 }
 
-static inline void sqrt512f(float *src, float *dst, int len)
+// *acc + *cor += value, *cor gathers the rounding errors of the additions (TwoSum, see simd_utils_sum.h)
+static inline void kahan_add512f(v16sf *acc, v16sf *cor, v16sf value)
+{
+    v16sf t = _mm512_add_ps(*acc, value);
+    v16sf bp = _mm512_sub_ps(t, *acc);
+    v16sf err = _mm512_add_ps(_mm512_sub_ps(*acc, _mm512_sub_ps(t, bp)), _mm512_sub_ps(value, bp));
+    *cor = _mm512_add_ps(*cor, err);
+    *acc = t;
+}
+
+SIMD_UTILS_API void sumkahan512f(float *src, float *dst, int len)
 {
     int stop_len = len / (2 * AVX512_LEN_FLOAT);
     stop_len *= (2 * AVX512_LEN_FLOAT);
 
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+    __attribute__((aligned(AVX512_LEN_BYTES))) float accumulate[2 * AVX512_LEN_FLOAT];
+    __attribute__((aligned(AVX512_LEN_BYTES))) float correction[2 * AVX512_LEN_FLOAT];
+    float tmp_acc = 0.0f;
+    float tmp_cor = 0.0f;
+    v16sf vec_acc1 = _mm512_setzero_ps();  // initialize the vector accumulator
+    v16sf vec_acc2 = _mm512_setzero_ps();  // initialize the vector accumulator
+    v16sf vec_cor1 = _mm512_setzero_ps();  // rounding errors of the accumulator
+    v16sf vec_cor2 = _mm512_setzero_ps();  // rounding errors of the accumulator
+
+    if (isAligned((uintptr_t) (src), AVX512_LEN_BYTES)) {
         for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
-            v16sf src_tmp = _mm512_load_ps(src + i);
-            v16sf src_tmp2 = _mm512_load_ps(src + i + AVX512_LEN_FLOAT);
-            v16sf dst_tmp = _mm512_sqrt_ps(src_tmp);
-            v16sf dst_tmp2 = _mm512_sqrt_ps(src_tmp2);
-            _mm512_store_ps(dst + i, dst_tmp);
-            _mm512_store_ps(dst + i + AVX512_LEN_FLOAT, dst_tmp2);
+            kahan_add512f(&vec_acc1, &vec_cor1, _mm512_load_ps(src + i));
+            kahan_add512f(&vec_acc2, &vec_cor2, _mm512_load_ps(src + i + AVX512_LEN_FLOAT));
         }
     } else {
         for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
-            v16sf src_tmp = _mm512_loadu_ps(src + i);
-            v16sf src_tmp2 = _mm512_loadu_ps(src + i + AVX512_LEN_FLOAT);
-            v16sf dst_tmp = _mm512_sqrt_ps(src_tmp);
-            v16sf dst_tmp2 = _mm512_sqrt_ps(src_tmp2);
-            _mm512_storeu_ps(dst + i, dst_tmp);
-            _mm512_storeu_ps(dst + i + AVX512_LEN_FLOAT, dst_tmp2);
+            kahan_add512f(&vec_acc1, &vec_cor1, _mm512_loadu_ps(src + i));
+            kahan_add512f(&vec_acc2, &vec_cor2, _mm512_loadu_ps(src + i + AVX512_LEN_FLOAT));
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = sqrtf(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        kahan_add512f(&vec_acc1, &vec_cor1, _mm512_maskz_loadu_ps(tail_mask16(len - i), src + i));
     }
+
+    _mm512_store_ps(accumulate, vec_acc1);
+    _mm512_store_ps(accumulate + AVX512_LEN_FLOAT, vec_acc2);
+    _mm512_store_ps(correction, vec_cor1);
+    _mm512_store_ps(correction + AVX512_LEN_FLOAT, vec_cor2);
+    kahan_foldf(accumulate, correction, 2 * AVX512_LEN_FLOAT, &tmp_acc, &tmp_cor);
+
+    *dst = tmp_acc + tmp_cor;
 }
 
-static inline void rint512f(float *src, float *dst, int len)
+SIMD_UTILS_API void meankahan512f(float *src, float *dst, int len)
+{
+    float coeff = 1.0f / ((float) len);
+    sumkahan512f(src, dst, len);
+    *dst *= coeff;
+}
+
+/* The rounding errors of the products are prod - src1 * src2 computed with a FMA,
+ * they are 0 without FMA (only the additions are compensated) */
+SIMD_UTILS_API void dotkahan512f(float *src1, float *src2, int len, float *dst)
 {
     int stop_len = len / (2 * AVX512_LEN_FLOAT);
     stop_len *= (2 * AVX512_LEN_FLOAT);
 
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+    __attribute__((aligned(AVX512_LEN_BYTES))) float accumulate[2 * AVX512_LEN_FLOAT];
+    __attribute__((aligned(AVX512_LEN_BYTES))) float correction[2 * AVX512_LEN_FLOAT];
+    float tmp_acc = 0.0f;
+    float tmp_cor = 0.0f;
+    v16sf vec_acc1 = _mm512_setzero_ps();  // initialize the vector accumulator
+    v16sf vec_acc2 = _mm512_setzero_ps();  // initialize the vector accumulator
+    v16sf vec_cor1 = _mm512_setzero_ps();  // rounding errors of the accumulator
+    v16sf vec_cor2 = _mm512_setzero_ps();  // rounding errors of the accumulator
+
+    if (areAligned2((uintptr_t) (src1), (uintptr_t) (src2), AVX512_LEN_BYTES)) {
         for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
-            v16sf src_tmp = _mm512_load_ps(src + i);
-            v16sf src_tmp2 = _mm512_load_ps(src + i + AVX512_LEN_FLOAT);
-            v16sf dst_tmp = _mm512_roundscale_ps(src_tmp, ROUNDTONEAREST);
-            v16sf dst_tmp2 = _mm512_roundscale_ps(src_tmp2, ROUNDTONEAREST);
-            _mm512_store_ps(dst + i, dst_tmp);
-            _mm512_store_ps(dst + i + AVX512_LEN_FLOAT, dst_tmp2);
+            v16sf vec_src1_tmp = _mm512_load_ps(src1 + i);
+            v16sf vec_src1_tmp2 = _mm512_load_ps(src1 + i + AVX512_LEN_FLOAT);
+            v16sf vec_src2_tmp = _mm512_load_ps(src2 + i);
+            v16sf vec_src2_tmp2 = _mm512_load_ps(src2 + i + AVX512_LEN_FLOAT);
+            v16sf prod = _mm512_mul_ps(vec_src1_tmp, vec_src2_tmp);
+            v16sf prod2 = _mm512_mul_ps(vec_src1_tmp2, vec_src2_tmp2);
+            kahan_add512f(&vec_acc1, &vec_cor1, prod);
+            kahan_add512f(&vec_acc2, &vec_cor2, prod2);
+            vec_cor1 = _mm512_sub_ps(vec_cor1, _mm512_fnmadd_ps_custom(vec_src1_tmp, vec_src2_tmp, prod));
+            vec_cor2 = _mm512_sub_ps(vec_cor2, _mm512_fnmadd_ps_custom(vec_src1_tmp2, vec_src2_tmp2, prod2));
         }
     } else {
         for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
-            v16sf src_tmp = _mm512_loadu_ps(src + i);
-            v16sf src_tmp2 = _mm512_loadu_ps(src + i + AVX512_LEN_FLOAT);
-            v16sf dst_tmp = _mm512_roundscale_ps(src_tmp, ROUNDTONEAREST);
-            v16sf dst_tmp2 = _mm512_roundscale_ps(src_tmp2, ROUNDTONEAREST);
-            _mm512_storeu_ps(dst + i, dst_tmp);
-            _mm512_storeu_ps(dst + i + AVX512_LEN_FLOAT, dst_tmp2);
+            v16sf vec_src1_tmp = _mm512_loadu_ps(src1 + i);
+            v16sf vec_src1_tmp2 = _mm512_loadu_ps(src1 + i + AVX512_LEN_FLOAT);
+            v16sf vec_src2_tmp = _mm512_loadu_ps(src2 + i);
+            v16sf vec_src2_tmp2 = _mm512_loadu_ps(src2 + i + AVX512_LEN_FLOAT);
+            v16sf prod = _mm512_mul_ps(vec_src1_tmp, vec_src2_tmp);
+            v16sf prod2 = _mm512_mul_ps(vec_src1_tmp2, vec_src2_tmp2);
+            kahan_add512f(&vec_acc1, &vec_cor1, prod);
+            kahan_add512f(&vec_acc2, &vec_cor2, prod2);
+            vec_cor1 = _mm512_sub_ps(vec_cor1, _mm512_fnmadd_ps_custom(vec_src1_tmp, vec_src2_tmp, prod));
+            vec_cor2 = _mm512_sub_ps(vec_cor2, _mm512_fnmadd_ps_custom(vec_src1_tmp2, vec_src2_tmp2, prod2));
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = rintf(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf vec_src1_tmp = _mm512_maskz_loadu_ps(mask, src1 + i);
+        v16sf vec_src2_tmp = _mm512_maskz_loadu_ps(mask, src2 + i);
+        v16sf prod = _mm512_mul_ps(vec_src1_tmp, vec_src2_tmp);
+        kahan_add512f(&vec_acc1, &vec_cor1, prod);
+        vec_cor1 = _mm512_sub_ps(vec_cor1, _mm512_fnmadd_ps_custom(vec_src1_tmp, vec_src2_tmp, prod));
     }
+
+    _mm512_store_ps(accumulate, vec_acc1);
+    _mm512_store_ps(accumulate + AVX512_LEN_FLOAT, vec_acc2);
+    _mm512_store_ps(correction, vec_cor1);
+    _mm512_store_ps(correction + AVX512_LEN_FLOAT, vec_cor2);
+    kahan_foldf(accumulate, correction, 2 * AVX512_LEN_FLOAT, &tmp_acc, &tmp_cor);
+
+    *dst = tmp_acc + tmp_cor;
 }
 
-//rounds away from zero like IPP, whereas SSE/AVx/AVX512 rounds to nearest even (IEEE-754)
-static inline void round512f(float *src, float *dst, int len)
+SIMD_UTILS_API void dotckahan512f(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst)
 {
-    int stop_len = len / (2 * AVX512_LEN_FLOAT);
-    stop_len *= (2 * AVX512_LEN_FLOAT);
+    int stop_len = len / (4 * AVX512_LEN_FLOAT);
+    stop_len *= (4 * AVX512_LEN_FLOAT);
 
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
-            v16sf src_tmp = _mm512_load_ps(src + i);
-            v16sf src_tmp2 = _mm512_load_ps(src + i + AVX512_LEN_FLOAT);
-            v16sf spe1 = _mm512_and_ps(src_tmp, *(v16sf*)_ps512_sign_mask);
-            spe1 = _mm512_or_ps(spe1,*(v16sf*)_ps512_mid_mask);
-            spe1 = _mm512_add_ps(src_tmp, spe1);
-            v16sf spe2 = _mm512_and_ps(src_tmp2, *(v16sf*)_ps512_sign_mask);
-            spe2 = _mm512_or_ps(spe2,*(v16sf*)_ps512_mid_mask);
-            spe2 = _mm512_add_ps(src_tmp2, spe2);
-            v16sf dst_tmp = _mm512_roundscale_ps(spe1, ROUNDTOZERO);
-            v16sf dst_tmp2 = _mm512_roundscale_ps(spe2, ROUNDTOZERO);
-            _mm512_store_ps(dst + i, dst_tmp);
-            _mm512_store_ps(dst + i + AVX512_LEN_FLOAT, dst_tmp2);
+    __attribute__((aligned(AVX512_LEN_BYTES))) float accumulateRe[2 * AVX512_LEN_FLOAT];
+    __attribute__((aligned(AVX512_LEN_BYTES))) float accumulateIm[2 * AVX512_LEN_FLOAT];
+    __attribute__((aligned(AVX512_LEN_BYTES))) float correctionRe[2 * AVX512_LEN_FLOAT];
+    __attribute__((aligned(AVX512_LEN_BYTES))) float correctionIm[2 * AVX512_LEN_FLOAT];
+    complex32_t dst_tmp = {0.0f, 0.0f};
+    complex32_t dst_cor = {0.0f, 0.0f};
+    v16sfx2 vec_acc1 = {{_mm512_setzero_ps(), _mm512_setzero_ps()}};  // initialize the vector accumulator
+    v16sfx2 vec_acc2 = {{_mm512_setzero_ps(), _mm512_setzero_ps()}};  // initialize the vector accumulator
+    v16sfx2 vec_cor1 = {{_mm512_setzero_ps(), _mm512_setzero_ps()}};  // rounding errors of the accumulator
+    v16sfx2 vec_cor2 = {{_mm512_setzero_ps(), _mm512_setzero_ps()}};  // rounding errors of the accumulator
+
+    //  (ac -bd) + i(ad + bc)
+    if (areAligned2((uintptr_t) (src1), (uintptr_t) (src2), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < 2 * stop_len; i += 4 * AVX512_LEN_FLOAT) {
+            v16sfx2 src1_split = _mm512_load2_ps((float *) (src1) + i);  // a0a1, b0b1
+            v16sfx2 src2_split = _mm512_load2_ps((float *) (src2) + i);  // c0c1, d0d1
+            v16sfx2 src1_split2 = _mm512_load2_ps((float *) (src1) + i + 2 * AVX512_LEN_FLOAT);
+            v16sfx2 src2_split2 = _mm512_load2_ps((float *) (src2) + i + 2 * AVX512_LEN_FLOAT);
+            v16sf ac = _mm512_mul_ps(src1_split.val[0], src2_split.val[0]);     // ac
+            v16sf ad = _mm512_mul_ps(src1_split.val[0], src2_split.val[1]);     // ad
+            v16sf ac2 = _mm512_mul_ps(src1_split2.val[0], src2_split2.val[0]);  // ac
+            v16sf ad2 = _mm512_mul_ps(src1_split2.val[0], src2_split2.val[1]);  // ad
+            kahan_add512f(&vec_acc1.val[0], &vec_cor1.val[0], _mm512_fnmadd_ps_custom(src1_split.val[1], src2_split.val[1], ac));
+            kahan_add512f(&vec_acc1.val[1], &vec_cor1.val[1], _mm512_fmadd_ps_custom(src1_split.val[1], src2_split.val[0], ad));
+            kahan_add512f(&vec_acc2.val[0], &vec_cor2.val[0], _mm512_fnmadd_ps_custom(src1_split2.val[1], src2_split2.val[1], ac2));
+            kahan_add512f(&vec_acc2.val[1], &vec_cor2.val[1], _mm512_fmadd_ps_custom(src1_split2.val[1], src2_split2.val[0], ad2));
         }
     } else {
-        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
-            v16sf src_tmp = _mm512_loadu_ps(src + i);
-            v16sf src_tmp2 = _mm512_loadu_ps(src + i + AVX512_LEN_FLOAT);
-            v16sf spe1 = _mm512_and_ps(src_tmp, *(v16sf*)_ps512_sign_mask);
-            spe1 = _mm512_or_ps(spe1,*(v16sf*)_ps512_mid_mask);
-            spe1 = _mm512_add_ps(src_tmp, spe1);
-            v16sf spe2 = _mm512_and_ps(src_tmp2, *(v16sf*)_ps512_sign_mask);
-            spe2 = _mm512_or_ps(spe2,*(v16sf*)_ps512_mid_mask);
-            spe2 = _mm512_add_ps(src_tmp2, spe2);
-            v16sf dst_tmp = _mm512_roundscale_ps(spe1, ROUNDTOZERO);
-            v16sf dst_tmp2 = _mm512_roundscale_ps(spe2, ROUNDTOZERO);
-            _mm512_storeu_ps(dst + i, dst_tmp);
-            _mm512_storeu_ps(dst + i + AVX512_LEN_FLOAT, dst_tmp2);
-        }
-    }
+        for (int i = 0; i < 2 * stop_len; i += 4 * AVX512_LEN_FLOAT) {
+            v16sfx2 src1_split = _mm512_load2u_ps((float *) (src1) + i);  // a0a1, b0b1
+            v16sfx2 src2_split = _mm512_load2u_ps((float *) (src2) + i);  // c0c1, d0d1
+            v16sfx2 src1_split2 = _mm512_load2u_ps((float *) (src1) + i + 2 * AVX512_LEN_FLOAT);
+            v16sfx2 src2_split2 = _mm512_load2u_ps((float *) (src2) + i + 2 * AVX512_LEN_FLOAT);
+            v16sf ac = _mm512_mul_ps(src1_split.val[0], src2_split.val[0]);     // ac
+            v16sf ad = _mm512_mul_ps(src1_split.val[0], src2_split.val[1]);     // ad
+            v16sf ac2 = _mm512_mul_ps(src1_split2.val[0], src2_split2.val[0]);  // ac
+            v16sf ad2 = _mm512_mul_ps(src1_split2.val[0], src2_split2.val[1]);  // ad
+            kahan_add512f(&vec_acc1.val[0], &vec_cor1.val[0], _mm512_fnmadd_ps_custom(src1_split.val[1], src2_split.val[1], ac));
+            kahan_add512f(&vec_acc1.val[1], &vec_cor1.val[1], _mm512_fmadd_ps_custom(src1_split.val[1], src2_split.val[0], ad));
+            kahan_add512f(&vec_acc2.val[0], &vec_cor2.val[0], _mm512_fnmadd_ps_custom(src1_split2.val[1], src2_split2.val[1], ac2));
+            kahan_add512f(&vec_acc2.val[1], &vec_cor2.val[1], _mm512_fmadd_ps_custom(src1_split2.val[1], src2_split2.val[0], ad2));
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        v16sfx2 src1_split = _mm512_maskz_load2u_ps(len - i, (float *) (src1 + i));
+        v16sfx2 src2_split = _mm512_maskz_load2u_ps(len - i, (float *) (src2 + i));
+        v16sf ac = _mm512_mul_ps(src1_split.val[0], src2_split.val[0]);  // ac
+        v16sf ad = _mm512_mul_ps(src1_split.val[0], src2_split.val[1]);  // ad
+        kahan_add512f(&vec_acc1.val[0], &vec_cor1.val[0], _mm512_fnmadd_ps_custom(src1_split.val[1], src2_split.val[1], ac));
+        kahan_add512f(&vec_acc1.val[1], &vec_cor1.val[1], _mm512_fmadd_ps_custom(src1_split.val[1], src2_split.val[0], ad));
+    }
+
+    _mm512_store_ps(accumulateRe, vec_acc1.val[0]);
+    _mm512_store_ps(accumulateRe + AVX512_LEN_FLOAT, vec_acc2.val[0]);
+    _mm512_store_ps(accumulateIm, vec_acc1.val[1]);
+    _mm512_store_ps(accumulateIm + AVX512_LEN_FLOAT, vec_acc2.val[1]);
+    _mm512_store_ps(correctionRe, vec_cor1.val[0]);
+    _mm512_store_ps(correctionRe + AVX512_LEN_FLOAT, vec_cor2.val[0]);
+    _mm512_store_ps(correctionIm, vec_cor1.val[1]);
+    _mm512_store_ps(correctionIm + AVX512_LEN_FLOAT, vec_cor2.val[1]);
+    kahan_foldf(accumulateRe, correctionRe, 2 * AVX512_LEN_FLOAT, &dst_tmp.re, &dst_cor.re);
+    kahan_foldf(accumulateIm, correctionIm, 2 * AVX512_LEN_FLOAT, &dst_tmp.im, &dst_cor.im);
+
+    dst->re = dst_tmp.re + dst_cor.re;
+    dst->im = dst_tmp.im + dst_cor.im;
+}
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = roundf(src[i]);
-    }
+SIMD_UTILS_API void sumpairwise512f(float *src, float *dst, int len)
+{
+    *dst = sum_pairwisef(src, len, sum512f);
 }
 
-static inline void ceil512f(float *src, float *dst, int len)
+SIMD_UTILS_API void meanpairwise512f(float *src, float *dst, int len)
 {
-    int stop_len = len / (2 * AVX512_LEN_FLOAT);
-    stop_len *= (2 * AVX512_LEN_FLOAT);
+    float coeff = 1.0f / ((float) len);
+    sumpairwise512f(src, dst, len);
+    *dst *= coeff;
+}
 
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
-            v16sf src_tmp = _mm512_load_ps(src + i);
-            v16sf src_tmp2 = _mm512_load_ps(src + i + AVX512_LEN_FLOAT);
-            v16sf dst_tmp = _mm512_roundscale_ps(src_tmp, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
-            v16sf dst_tmp2 = _mm512_roundscale_ps(src_tmp2, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
-            _mm512_store_ps(dst + i, dst_tmp);
-            _mm512_store_ps(dst + i + AVX512_LEN_FLOAT, dst_tmp2);
-        }
-    } else {
-        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
-            v16sf src_tmp = _mm512_loadu_ps(src + i);
-            v16sf src_tmp2 = _mm512_loadu_ps(src + i + AVX512_LEN_FLOAT);
-            v16sf dst_tmp = _mm512_roundscale_ps(src_tmp, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
-            v16sf dst_tmp2 = _mm512_roundscale_ps(src_tmp2, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
-            _mm512_storeu_ps(dst + i, dst_tmp);
-            _mm512_storeu_ps(dst + i + AVX512_LEN_FLOAT, dst_tmp2);
-        }
-    }
+SIMD_UTILS_API void dotpairwise512f(float *src1, float *src2, int len, float *dst)
+{
+    *dst = dot_pairwisef(src1, src2, len, dot512f);
+}
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = ceilf(src[i]);
-    }
+SIMD_UTILS_API void dotcpairwise512f(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst)
+{
+    *dst = dotc_pairwisef(src1, src2, len, dotc512f);
 }
 
-static inline void floor512f(float *src, float *dst, int len)
+// sums of the powers of (src[i] - shift), see simd_utils_moments.h
+static inline void centered_sums512f(float *src, int len, float shift, double *sums)
 {
     int stop_len = len / (2 * AVX512_LEN_FLOAT);
     stop_len *= (2 * AVX512_LEN_FLOAT);
 
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+    __attribute__((aligned(AVX512_LEN_BYTES))) float accumulate[4 * AVX512_LEN_FLOAT];
+    v16sf shift_vec = _mm512_set1_ps(shift);
+    v16sf sum1_1 = _mm512_setzero_ps(), sum1_2 = _mm512_setzero_ps();  // d
+    v16sf sum2_1 = _mm512_setzero_ps(), sum2_2 = _mm512_setzero_ps();  // d^2
+    v16sf sum3_1 = _mm512_setzero_ps(), sum3_2 = _mm512_setzero_ps();  // d^3
+    v16sf sum4_1 = _mm512_setzero_ps(), sum4_2 = _mm512_setzero_ps();  // d^4
+
+    if (isAligned((uintptr_t) (src), AVX512_LEN_BYTES)) {
         for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
-            v16sf src_tmp = _mm512_load_ps(src + i);
-            v16sf src_tmp2 = _mm512_load_ps(src + i + AVX512_LEN_FLOAT);
-            v16sf dst_tmp = _mm512_roundscale_ps(src_tmp, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
-            v16sf dst_tmp2 = _mm512_roundscale_ps(src_tmp2, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
-            _mm512_store_ps(dst + i, dst_tmp);
-            _mm512_store_ps(dst + i + AVX512_LEN_FLOAT, dst_tmp2);
+            v16sf d1 = _mm512_sub_ps(_mm512_load_ps(src + i), shift_vec);
+            v16sf d2 = _mm512_sub_ps(_mm512_load_ps(src + i + AVX512_LEN_FLOAT), shift_vec);
+            v16sf sq1 = _mm512_mul_ps(d1, d1);
+            v16sf sq2 = _mm512_mul_ps(d2, d2);
+            sum1_1 = _mm512_add_ps(sum1_1, d1);
+            sum1_2 = _mm512_add_ps(sum1_2, d2);
+            sum2_1 = _mm512_add_ps(sum2_1, sq1);
+            sum2_2 = _mm512_add_ps(sum2_2, sq2);
+            sum3_1 = _mm512_fmadd_ps_custom(sq1, d1, sum3_1);
+            sum3_2 = _mm512_fmadd_ps_custom(sq2, d2, sum3_2);
+            sum4_1 = _mm512_fmadd_ps_custom(sq1, sq1, sum4_1);
+            sum4_2 = _mm512_fmadd_ps_custom(sq2, sq2, sum4_2);
         }
     } else {
         for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
-            v16sf src_tmp = _mm512_loadu_ps(src + i);
-            v16sf src_tmp2 = _mm512_loadu_ps(src + i + AVX512_LEN_FLOAT);
-            v16sf dst_tmp = _mm512_roundscale_ps(src_tmp, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
-            v16sf dst_tmp2 = _mm512_roundscale_ps(src_tmp2, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
-            _mm512_storeu_ps(dst + i, dst_tmp);
-            _mm512_storeu_ps(dst + i + AVX512_LEN_FLOAT, dst_tmp2);
+            v16sf d1 = _mm512_sub_ps(_mm512_loadu_ps(src + i), shift_vec);
+            v16sf d2 = _mm512_sub_ps(_mm512_loadu_ps(src + i + AVX512_LEN_FLOAT), shift_vec);
+            v16sf sq1 = _mm512_mul_ps(d1, d1);
+            v16sf sq2 = _mm512_mul_ps(d2, d2);
+            sum1_1 = _mm512_add_ps(sum1_1, d1);
+            sum1_2 = _mm512_add_ps(sum1_2, d2);
+            sum2_1 = _mm512_add_ps(sum2_1, sq1);
+            sum2_2 = _mm512_add_ps(sum2_2, sq2);
+            sum3_1 = _mm512_fmadd_ps_custom(sq1, d1, sum3_1);
+            sum3_2 = _mm512_fmadd_ps_custom(sq2, d2, sum3_2);
+            sum4_1 = _mm512_fmadd_ps_custom(sq1, sq1, sum4_1);
+            sum4_2 = _mm512_fmadd_ps_custom(sq2, sq2, sum4_2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        // the masked out lanes of d are zeros
+        v16sf d1 = _mm512_maskz_sub_ps(tail_mask16(len - i), _mm512_maskz_loadu_ps(tail_mask16(len - i), src + i), shift_vec);
+        v16sf sq1 = _mm512_mul_ps(d1, d1);
+        sum1_1 = _mm512_add_ps(sum1_1, d1);
+        sum2_1 = _mm512_add_ps(sum2_1, sq1);
+        sum3_1 = _mm512_fmadd_ps_custom(sq1, d1, sum3_1);
+        sum4_1 = _mm512_fmadd_ps_custom(sq1, sq1, sum4_1);
+    }
+
+    _mm512_store_ps(accumulate, _mm512_add_ps(sum1_1, sum1_2));
+    _mm512_store_ps(accumulate + AVX512_LEN_FLOAT, _mm512_add_ps(sum2_1, sum2_2));
+    _mm512_store_ps(accumulate + 2 * AVX512_LEN_FLOAT, _mm512_add_ps(sum3_1, sum3_2));
+    _mm512_store_ps(accumulate + 3 * AVX512_LEN_FLOAT, _mm512_add_ps(sum4_1, sum4_2));
+
+    for (int k = 0; k < 4; k++) {
+        sums[k] = 0.0;
+        for (int i = 0; i < AVX512_LEN_FLOAT; i++) {
+            sums[k] += (double) accumulate[k * AVX512_LEN_FLOAT + i];
         }
     }
-
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = floorf(src[i]);
-    }
 }
 
-static inline void trunc512f(float *src, float *dst, int len)
+SIMD_UTILS_API void moments512f(float *src, int len, moments_t *m)
 {
-    int stop_len = len / (2 * AVX512_LEN_FLOAT);
-    stop_len *= (2 * AVX512_LEN_FLOAT);
+    moments_runf(src, len, sum512f, centered_sums512f, m);
+}
+
+// inclusive prefix sum of the lanes of x
+static inline v16sf prefix_lanes512f(v16sf x)
+{
+    v16si zero = _mm512_setzero_si512();
+    x = _mm512_add_ps(x, _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(x), zero, 15)));
+    x = _mm512_add_ps(x, _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(x), zero, 14)));
+    x = _mm512_add_ps(x, _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(x), zero, 12)));
+    x = _mm512_add_ps(x, _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(x), zero, 8)));
+    return x;
+}
+
+// last lane of x in all the lanes
+static inline v16sf last_lane512f(v16sf x)
+{
+    return _mm512_permutexvar_ps(_mm512_set1_epi32(15), x);
+}
+
+// lanes of x moved up by one, the first lane getting the last lane of prev
+static inline v16sf shift_lane512f(v16sf x, v16sf prev)
+{
+    return _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(x), _mm512_castps_si512(prev), 15));
+}
+
+// prefix sums of src (see simd_utils.h), exclusive when exclusive is set
+static inline void prefixsum512f_run(float *src, float *dst, int len, float *carry, int exclusive)
+{
+    int stop_len = len / (2 * AVX512_LEN_FLOAT);
+    stop_len *= (2 * AVX512_LEN_FLOAT);
+
+    v16sf carry_vec = _mm512_set1_ps(carry ? *carry : 0.0f);
+
+    // the carry only waits for one add per pair of vectors
+    for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
+        v16sf a = prefix_lanes512f(_mm512_loadu_ps(src + i));
+        v16sf b = prefix_lanes512f(_mm512_loadu_ps(src + i + AVX512_LEN_FLOAT));
+        b = _mm512_add_ps(b, last_lane512f(a));
+        v16sf last = last_lane512f(b);
+        a = _mm512_add_ps(a, carry_vec);
+        b = _mm512_add_ps(b, carry_vec);
+        if (exclusive) {
+            _mm512_storeu_ps(dst + i, shift_lane512f(a, carry_vec));
+            _mm512_storeu_ps(dst + i + AVX512_LEN_FLOAT, shift_lane512f(b, a));
+        } else {
+            _mm512_storeu_ps(dst + i, a);
+            _mm512_storeu_ps(dst + i + AVX512_LEN_FLOAT, b);
+        }
+        carry_vec = _mm512_add_ps(carry_vec, last);
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf a = prefix_lanes512f(_mm512_maskz_loadu_ps(mask, src + i));  // the masked out lanes are 0
+        v16sf last = last_lane512f(a);
+        a = _mm512_add_ps(a, carry_vec);
+        if (exclusive) {
+            _mm512_mask_storeu_ps(dst + i, mask, shift_lane512f(a, carry_vec));
+        } else {
+            _mm512_mask_storeu_ps(dst + i, mask, a);
+        }
+        carry_vec = _mm512_add_ps(carry_vec, last);
+    }
+
+    if (carry)
+        *carry = _mm_cvtss_f32(_mm512_castps512_ps128(carry_vec));
+}
+
+SIMD_UTILS_API void prefixsum512f(float *src, float *dst, int len, float *carry)
+{
+    prefixsum512f_run(src, dst, len, carry, 0);
+}
+
+SIMD_UTILS_API void prefixsum512f_excl(float *src, float *dst, int len, float *carry)
+{
+    prefixsum512f_run(src, dst, len, carry, 1);
+}
+
+SIMD_UTILS_API void diff512f(float *src, float *dst, int len, float *prev)
+{
+    int stop_len = len / (2 * AVX512_LEN_FLOAT);
+    stop_len *= (2 * AVX512_LEN_FLOAT);
+
+    float prev_tmp = prev ? *prev : 0.0f;
+    float last = (len > 0) ? src[len - 1] : prev_tmp;  // before src is overwritten by dst
+    v16sf prev_vec = _mm512_set1_ps(prev_tmp);
+
+    for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
+        v16sf a = _mm512_loadu_ps(src + i);
+        v16sf b = _mm512_loadu_ps(src + i + AVX512_LEN_FLOAT);
+        _mm512_storeu_ps(dst + i, _mm512_sub_ps(a, shift_lane512f(a, prev_vec)));
+        _mm512_storeu_ps(dst + i + AVX512_LEN_FLOAT, _mm512_sub_ps(b, shift_lane512f(b, a)));
+        prev_vec = b;
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf a = _mm512_maskz_loadu_ps(mask, src + i);
+        _mm512_mask_storeu_ps(dst + i, mask, _mm512_sub_ps(a, shift_lane512f(a, prev_vec)));
+        prev_vec = a;
+    }
+
+    if (prev)
+        *prev = last;
+}
+
+// bins of x in histogram512f, *in the lanes inside of the bins
+static inline v16si hist_bin512f(v16sf x, v16sf low_vec, v16sf high_vec, v16sf scale_vec, v16si last_vec, __mmask16 *in)
+{
+    *in = _mm512_cmp_ps_mask(x, low_vec, _CMP_GE_OQ) & _mm512_cmp_ps_mask(x, high_vec, _CMP_LE_OQ);
+    return _mm512_min_epi32(_mm512_cvttps_epi32(_mm512_mul_ps(_mm512_sub_ps(x, low_vec), scale_vec)), last_vec);
+}
+
+SIMD_UTILS_API void histogram512f(float *src, int len, float low, float high, int nb_bins, uint32_t *hist)
+{
+    int stop_len = len / AVX512_LEN_FLOAT;
+    stop_len *= AVX512_LEN_FLOAT;
+
+    v16sf low_vec = _mm512_set1_ps(low);
+    v16sf high_vec = _mm512_set1_ps(high);
+    v16sf scale_vec = _mm512_set1_ps(hist_scalef(low, high, nb_bins));
+    v16si last_vec = _mm512_set1_epi32(nb_bins - 1);
+
+    if (isAligned((uintptr_t) (src), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
+            __mmask16 in;
+            v16si bin = hist_bin512f(_mm512_load_ps(src + i), low_vec, high_vec, scale_vec, last_vec, &in);
+            hist_add512(hist, bin, in);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
+            __mmask16 in;
+            v16si bin = hist_bin512f(_mm512_loadu_ps(src + i), low_vec, high_vec, scale_vec, last_vec, &in);
+            hist_add512(hist, bin, in);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        __mmask16 in;
+        v16si bin = hist_bin512f(_mm512_maskz_loadu_ps(mask, src + i), low_vec, high_vec, scale_vec, last_vec, &in);
+        hist_add512(hist, bin, in & mask);
+    }
+}
+
+// bins of x in histogram512f_edges (binary search of all the lanes at once), *in the lanes inside of the bins
+static inline v16si hist_bin512f_edges(v16sf x, float *edges, int nb_bins, int step, __mmask16 *in)
+{
+    v16si nb_vec = _mm512_set1_epi32(nb_bins);
+    v16si pos = _mm512_setzero_si512();
+
+    *in = _mm512_cmp_ps_mask(x, _mm512_set1_ps(edges[0]), _CMP_GE_OQ) & _mm512_cmp_ps_mask(x, _mm512_set1_ps(edges[nb_bins]), _CMP_LE_OQ);
+    for (; step > 0; step >>= 1) {
+        v16si cand = _mm512_add_epi32(pos, _mm512_set1_epi32(step));
+        __mmask16 valid = _mm512_cmplt_epi32_mask(cand, nb_vec);
+        v16sf e = _mm512_mask_i32gather_ps(x, valid, cand, edges, 4);
+        pos = _mm512_mask_mov_epi32(pos, _mm512_mask_cmp_ps_mask(valid, e, x, _CMP_LE_OQ), cand);
+    }
+    return pos;
+}
+
+SIMD_UTILS_API void histogram512f_edges(float *src, int len, float *edges, int nb_bins, uint32_t *hist)
+{
+    int stop_len = len / AVX512_LEN_FLOAT;
+    stop_len *= AVX512_LEN_FLOAT;
+    int step = hist_edges_step(nb_bins);
+
+    if (isAligned((uintptr_t) (src), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
+            __mmask16 in;
+            v16si bin = hist_bin512f_edges(_mm512_load_ps(src + i), edges, nb_bins, step, &in);
+            hist_add512(hist, bin, in);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_FLOAT) {
+            __mmask16 in;
+            v16si bin = hist_bin512f_edges(_mm512_loadu_ps(src + i), edges, nb_bins, step, &in);
+            hist_add512(hist, bin, in);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        __mmask16 in;
+        v16si bin = hist_bin512f_edges(_mm512_maskz_loadu_ps(mask, src + i), edges, nb_bins, step, &in);
+        hist_add512(hist, bin, in & mask);
+    }
+}
+
+// bitonic sort of the lanes of x
+static inline v16sf sort_lanes512f(v16sf x)
+{
+    v16sf p;
+    p = _mm512_permute_ps(x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm512_mask_blend_ps(0x6666, _mm512_min_ps(x, p), _mm512_max_ps(x, p));
+    p = _mm512_permute_ps(x, _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm512_mask_blend_ps(0x3C3C, _mm512_min_ps(x, p), _mm512_max_ps(x, p));
+    p = _mm512_permute_ps(x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm512_mask_blend_ps(0x5A5A, _mm512_min_ps(x, p), _mm512_max_ps(x, p));
+    p = _mm512_shuffle_f32x4(x, x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm512_mask_blend_ps(0xFF0, _mm512_min_ps(x, p), _mm512_max_ps(x, p));
+    p = _mm512_permute_ps(x, _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm512_mask_blend_ps(0x33CC, _mm512_min_ps(x, p), _mm512_max_ps(x, p));
+    p = _mm512_permute_ps(x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm512_mask_blend_ps(0x55AA, _mm512_min_ps(x, p), _mm512_max_ps(x, p));
+    p = _mm512_shuffle_f32x4(x, x, _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm512_mask_blend_ps(0xFF00, _mm512_min_ps(x, p), _mm512_max_ps(x, p));
+    p = _mm512_shuffle_f32x4(x, x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm512_mask_blend_ps(0xF0F0, _mm512_min_ps(x, p), _mm512_max_ps(x, p));
+    p = _mm512_permute_ps(x, _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm512_mask_blend_ps(0xCCCC, _mm512_min_ps(x, p), _mm512_max_ps(x, p));
+    p = _mm512_permute_ps(x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm512_mask_blend_ps(0xAAAA, _mm512_min_ps(x, p), _mm512_max_ps(x, p));
+    return x;
+}
+
+// sorts the lanes of x, which are a bitonic sequence
+static inline v16sf sort_clean512f(v16sf x)
+{
+    v16sf p;
+    p = _mm512_shuffle_f32x4(x, x, _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm512_mask_blend_ps(0xFF00, _mm512_min_ps(x, p), _mm512_max_ps(x, p));
+    p = _mm512_shuffle_f32x4(x, x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm512_mask_blend_ps(0xF0F0, _mm512_min_ps(x, p), _mm512_max_ps(x, p));
+    p = _mm512_permute_ps(x, _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm512_mask_blend_ps(0xCCCC, _mm512_min_ps(x, p), _mm512_max_ps(x, p));
+    p = _mm512_permute_ps(x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm512_mask_blend_ps(0xAAAA, _mm512_min_ps(x, p), _mm512_max_ps(x, p));
+    return x;
+}
+
+// merges the sorted vectors a and b, a getting the lowest half
+static inline void sort_merge2512f(v16sf *a, v16sf *b)
+{
+    v16sf rev = _mm512_permutexvar_ps(_mm512_set_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), *b);
+    v16sf low = _mm512_min_ps(*a, rev);
+    v16sf high = _mm512_max_ps(*a, rev);
+    *a = sort_clean512f(low);
+    *b = sort_clean512f(high);
+}
+
+// merges the sorted sequences (a, b) and (c, d)
+static inline void sort_merge4512f(v16sf *a, v16sf *b, v16sf *c, v16sf *d)
+{
+    v16sf rev_c = _mm512_permutexvar_ps(_mm512_set_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), *d);
+    v16sf rev_d = _mm512_permutexvar_ps(_mm512_set_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), *c);
+    v16sf low0 = _mm512_min_ps(*a, rev_c);
+    v16sf high0 = _mm512_max_ps(*a, rev_c);
+    v16sf low1 = _mm512_min_ps(*b, rev_d);
+    v16sf high1 = _mm512_max_ps(*b, rev_d);
+    *a = sort_clean512f(_mm512_min_ps(low0, low1));
+    *b = sort_clean512f(_mm512_max_ps(low0, low1));
+    *c = sort_clean512f(_mm512_min_ps(high0, high1));
+    *d = sort_clean512f(_mm512_max_ps(high0, high1));
+}
+
+// sorts up to 4 vectors, padded with the largest value
+static inline void sort_small512f(float *src, int len)
+{
+    float tmp[4 * AVX512_LEN_FLOAT] __attribute__((aligned(AVX512_LEN_BYTES)));
+
+    memcpy(tmp, src, len * sizeof(float));
+    for (int i = len; i < 4 * AVX512_LEN_FLOAT; i++) {
+        tmp[i] = INFINITY;
+    }
+
+    v16sf a = sort_lanes512f(_mm512_loadu_ps(tmp));
+    if (len <= AVX512_LEN_FLOAT) {
+        _mm512_storeu_ps(tmp, a);
+    } else if (len <= 2 * AVX512_LEN_FLOAT) {
+        v16sf b = sort_lanes512f(_mm512_loadu_ps(tmp + AVX512_LEN_FLOAT));
+        sort_merge2512f(&a, &b);
+        _mm512_storeu_ps(tmp, a);
+        _mm512_storeu_ps(tmp + AVX512_LEN_FLOAT, b);
+    } else {
+        v16sf b = sort_lanes512f(_mm512_loadu_ps(tmp + AVX512_LEN_FLOAT));
+        v16sf c = sort_lanes512f(_mm512_loadu_ps(tmp + 2 * AVX512_LEN_FLOAT));
+        v16sf d = sort_lanes512f(_mm512_loadu_ps(tmp + 3 * AVX512_LEN_FLOAT));
+        sort_merge2512f(&a, &b);
+        sort_merge2512f(&c, &d);
+        sort_merge4512f(&a, &b, &c, &d);
+        _mm512_storeu_ps(tmp, a);
+        _mm512_storeu_ps(tmp + AVX512_LEN_FLOAT, b);
+        _mm512_storeu_ps(tmp + 2 * AVX512_LEN_FLOAT, c);
+        _mm512_storeu_ps(tmp + 3 * AVX512_LEN_FLOAT, d);
+    }
+
+    memcpy(src, tmp, len * sizeof(float));
+}
+
+// packs the lanes of x lower than the pivot to [*left_w, ...) and the others to [..., *right_w)
+static inline void partition_store512f(float *src, v16sf x, v16sf pivot_vec, int *left_w, int *right_w)
+{
+    __mmask16 mask = _mm512_cmp_ps_mask(x, pivot_vec, _CMP_LT_OQ);
+    int nb_low = __builtin_popcount(mask);
+    int nb_high = AVX512_LEN_FLOAT - nb_low;
+
+    // the full vector is stored on the left (free space of a vector at least), masked on the right
+    _mm512_storeu_ps(src + *left_w, _mm512_maskz_compress_ps(mask, x));
+    _mm512_mask_storeu_ps(src + *right_w - nb_high, tail_mask16(nb_high), _mm512_maskz_compress_ps((__mmask16) ~mask, x));
+    *left_w += nb_low;
+    *right_w -= nb_high;
+}
+
+// number of elements lower than pivot, moved to the beginning of src (len >= 2 * AVX512_LEN_FLOAT)
+static inline int partition512f(float *src, int len, float pivot)
+{
+    v16sf pivot_vec = _mm512_set1_ps(pivot);
+    v16sf first = _mm512_loadu_ps(src);
+    v16sf last = _mm512_loadu_ps(src + len - AVX512_LEN_FLOAT);
+    int left = AVX512_LEN_FLOAT, right = len - 2 * AVX512_LEN_FLOAT;  // next vectors read from each end
+    int left_w = 0, right_w = len;             // free space [left_w, left) and [right + AVX512_LEN_FLOAT, right_w)
+
+    while (left <= right) {
+        v16sf x;
+        if ((left - left_w) <= (right_w - right - AVX512_LEN_FLOAT)) {
+            x = _mm512_loadu_ps(src + left);
+            left += AVX512_LEN_FLOAT;
+        } else {
+            x = _mm512_loadu_ps(src + right);
+            right -= AVX512_LEN_FLOAT;
+        }
+        partition_store512f(src, x, pivot_vec, &left_w, &right_w);
+    }
+
+    // the last elements (less than a vector) with the first and the last vectors
+    float tmp[3 * AVX512_LEN_FLOAT];
+    int nb_tmp = right + AVX512_LEN_FLOAT - left;
+    memcpy(tmp, src + left, nb_tmp * sizeof(float));
+    _mm512_storeu_ps(tmp + nb_tmp, first);
+    _mm512_storeu_ps(tmp + nb_tmp + AVX512_LEN_FLOAT, last);
+    sort_partition_tailf(src, tmp, nb_tmp + 2 * AVX512_LEN_FLOAT, pivot, &left_w, &right_w);
+    return left_w;
+}
+
+SIMD_UTILS_API void sort512f(float *src, int len)
+{
+    sort_runf(src, len, 4 * AVX512_LEN_FLOAT, partition512f, sort_small512f);
+}
+
+// bitonic sort of the lanes of the keys k, with their values v
+static inline void sort_lanes512f_kv(v16sf *k, v16si *v)
+{
+    v16sf pk;
+    v16si pv;
+    __mmask16 lt, gt, take;
+    pk = _mm512_permute_ps(*k, _MM_SHUFFLE(2, 3, 0, 1));
+    pv = _mm512_shuffle_epi32(*v, (_MM_PERM_ENUM) _MM_SHUFFLE(2, 3, 0, 1));
+    lt = _mm512_cmp_ps_mask(pk, *k, _CMP_LT_OQ);
+    gt = _mm512_cmp_ps_mask(pk, *k, _CMP_GT_OQ);
+    take = (__mmask16) ((gt & 0x6666) | (lt & 0x9999));
+    *k = _mm512_mask_blend_ps(take, *k, pk);
+    *v = _mm512_mask_blend_epi32(take, *v, pv);
+    pk = _mm512_permute_ps(*k, _MM_SHUFFLE(1, 0, 3, 2));
+    pv = _mm512_shuffle_epi32(*v, (_MM_PERM_ENUM) _MM_SHUFFLE(1, 0, 3, 2));
+    lt = _mm512_cmp_ps_mask(pk, *k, _CMP_LT_OQ);
+    gt = _mm512_cmp_ps_mask(pk, *k, _CMP_GT_OQ);
+    take = (__mmask16) ((gt & 0x3C3C) | (lt & 0xC3C3));
+    *k = _mm512_mask_blend_ps(take, *k, pk);
+    *v = _mm512_mask_blend_epi32(take, *v, pv);
+    pk = _mm512_permute_ps(*k, _MM_SHUFFLE(2, 3, 0, 1));
+    pv = _mm512_shuffle_epi32(*v, (_MM_PERM_ENUM) _MM_SHUFFLE(2, 3, 0, 1));
+    lt = _mm512_cmp_ps_mask(pk, *k, _CMP_LT_OQ);
+    gt = _mm512_cmp_ps_mask(pk, *k, _CMP_GT_OQ);
+    take = (__mmask16) ((gt & 0x5A5A) | (lt & 0xA5A5));
+    *k = _mm512_mask_blend_ps(take, *k, pk);
+    *v = _mm512_mask_blend_epi32(take, *v, pv);
+    pk = _mm512_shuffle_f32x4(*k, *k, _MM_SHUFFLE(2, 3, 0, 1));
+    pv = _mm512_shuffle_i32x4(*v, *v, _MM_SHUFFLE(2, 3, 0, 1));
+    lt = _mm512_cmp_ps_mask(pk, *k, _CMP_LT_OQ);
+    gt = _mm512_cmp_ps_mask(pk, *k, _CMP_GT_OQ);
+    take = (__mmask16) ((gt & 0xFF0) | (lt & 0xF00F));
+    *k = _mm512_mask_blend_ps(take, *k, pk);
+    *v = _mm512_mask_blend_epi32(take, *v, pv);
+    pk = _mm512_permute_ps(*k, _MM_SHUFFLE(1, 0, 3, 2));
+    pv = _mm512_shuffle_epi32(*v, (_MM_PERM_ENUM) _MM_SHUFFLE(1, 0, 3, 2));
+    lt = _mm512_cmp_ps_mask(pk, *k, _CMP_LT_OQ);
+    gt = _mm512_cmp_ps_mask(pk, *k, _CMP_GT_OQ);
+    take = (__mmask16) ((gt & 0x33CC) | (lt & 0xCC33));
+    *k = _mm512_mask_blend_ps(take, *k, pk);
+    *v = _mm512_mask_blend_epi32(take, *v, pv);
+    pk = _mm512_permute_ps(*k, _MM_SHUFFLE(2, 3, 0, 1));
+    pv = _mm512_shuffle_epi32(*v, (_MM_PERM_ENUM) _MM_SHUFFLE(2, 3, 0, 1));
+    lt = _mm512_cmp_ps_mask(pk, *k, _CMP_LT_OQ);
+    gt = _mm512_cmp_ps_mask(pk, *k, _CMP_GT_OQ);
+    take = (__mmask16) ((gt & 0x55AA) | (lt & 0xAA55));
+    *k = _mm512_mask_blend_ps(take, *k, pk);
+    *v = _mm512_mask_blend_epi32(take, *v, pv);
+    pk = _mm512_shuffle_f32x4(*k, *k, _MM_SHUFFLE(1, 0, 3, 2));
+    pv = _mm512_shuffle_i32x4(*v, *v, _MM_SHUFFLE(1, 0, 3, 2));
+    lt = _mm512_cmp_ps_mask(pk, *k, _CMP_LT_OQ);
+    gt = _mm512_cmp_ps_mask(pk, *k, _CMP_GT_OQ);
+    take = (__mmask16) ((gt & 0xFF00) | (lt & 0xFF));
+    *k = _mm512_mask_blend_ps(take, *k, pk);
+    *v = _mm512_mask_blend_epi32(take, *v, pv);
+    pk = _mm512_shuffle_f32x4(*k, *k, _MM_SHUFFLE(2, 3, 0, 1));
+    pv = _mm512_shuffle_i32x4(*v, *v, _MM_SHUFFLE(2, 3, 0, 1));
+    lt = _mm512_cmp_ps_mask(pk, *k, _CMP_LT_OQ);
+    gt = _mm512_cmp_ps_mask(pk, *k, _CMP_GT_OQ);
+    take = (__mmask16) ((gt & 0xF0F0) | (lt & 0xF0F));
+    *k = _mm512_mask_blend_ps(take, *k, pk);
+    *v = _mm512_mask_blend_epi32(take, *v, pv);
+    pk = _mm512_permute_ps(*k, _MM_SHUFFLE(1, 0, 3, 2));
+    pv = _mm512_shuffle_epi32(*v, (_MM_PERM_ENUM) _MM_SHUFFLE(1, 0, 3, 2));
+    lt = _mm512_cmp_ps_mask(pk, *k, _CMP_LT_OQ);
+    gt = _mm512_cmp_ps_mask(pk, *k, _CMP_GT_OQ);
+    take = (__mmask16) ((gt & 0xCCCC) | (lt & 0x3333));
+    *k = _mm512_mask_blend_ps(take, *k, pk);
+    *v = _mm512_mask_blend_epi32(take, *v, pv);
+    pk = _mm512_permute_ps(*k, _MM_SHUFFLE(2, 3, 0, 1));
+    pv = _mm512_shuffle_epi32(*v, (_MM_PERM_ENUM) _MM_SHUFFLE(2, 3, 0, 1));
+    lt = _mm512_cmp_ps_mask(pk, *k, _CMP_LT_OQ);
+    gt = _mm512_cmp_ps_mask(pk, *k, _CMP_GT_OQ);
+    take = (__mmask16) ((gt & 0xAAAA) | (lt & 0x5555));
+    *k = _mm512_mask_blend_ps(take, *k, pk);
+    *v = _mm512_mask_blend_epi32(take, *v, pv);
+}
+
+// sorts the lanes of the keys k, which are a bitonic sequence, with their values v
+static inline void sort_clean512f_kv(v16sf *k, v16si *v)
+{
+    v16sf pk;
+    v16si pv;
+    __mmask16 lt, gt, take;
+    pk = _mm512_shuffle_f32x4(*k, *k, _MM_SHUFFLE(1, 0, 3, 2));
+    pv = _mm512_shuffle_i32x4(*v, *v, _MM_SHUFFLE(1, 0, 3, 2));
+    lt = _mm512_cmp_ps_mask(pk, *k, _CMP_LT_OQ);
+    gt = _mm512_cmp_ps_mask(pk, *k, _CMP_GT_OQ);
+    take = (__mmask16) ((gt & 0xFF00) | (lt & 0xFF));
+    *k = _mm512_mask_blend_ps(take, *k, pk);
+    *v = _mm512_mask_blend_epi32(take, *v, pv);
+    pk = _mm512_shuffle_f32x4(*k, *k, _MM_SHUFFLE(2, 3, 0, 1));
+    pv = _mm512_shuffle_i32x4(*v, *v, _MM_SHUFFLE(2, 3, 0, 1));
+    lt = _mm512_cmp_ps_mask(pk, *k, _CMP_LT_OQ);
+    gt = _mm512_cmp_ps_mask(pk, *k, _CMP_GT_OQ);
+    take = (__mmask16) ((gt & 0xF0F0) | (lt & 0xF0F));
+    *k = _mm512_mask_blend_ps(take, *k, pk);
+    *v = _mm512_mask_blend_epi32(take, *v, pv);
+    pk = _mm512_permute_ps(*k, _MM_SHUFFLE(1, 0, 3, 2));
+    pv = _mm512_shuffle_epi32(*v, (_MM_PERM_ENUM) _MM_SHUFFLE(1, 0, 3, 2));
+    lt = _mm512_cmp_ps_mask(pk, *k, _CMP_LT_OQ);
+    gt = _mm512_cmp_ps_mask(pk, *k, _CMP_GT_OQ);
+    take = (__mmask16) ((gt & 0xCCCC) | (lt & 0x3333));
+    *k = _mm512_mask_blend_ps(take, *k, pk);
+    *v = _mm512_mask_blend_epi32(take, *v, pv);
+    pk = _mm512_permute_ps(*k, _MM_SHUFFLE(2, 3, 0, 1));
+    pv = _mm512_shuffle_epi32(*v, (_MM_PERM_ENUM) _MM_SHUFFLE(2, 3, 0, 1));
+    lt = _mm512_cmp_ps_mask(pk, *k, _CMP_LT_OQ);
+    gt = _mm512_cmp_ps_mask(pk, *k, _CMP_GT_OQ);
+    take = (__mmask16) ((gt & 0xAAAA) | (lt & 0x5555));
+    *k = _mm512_mask_blend_ps(take, *k, pk);
+    *v = _mm512_mask_blend_epi32(take, *v, pv);
+}
+
+// low = min(a, b), high = max(a, b) of the keys, with their values
+static inline void sort_minmax512f_kv(v16sf ka, v16si va, v16sf kb, v16si vb, v16sf *k_low, v16si *v_low, v16sf *k_high, v16si *v_high)
+{
+    __mmask16 take = _mm512_cmp_ps_mask(kb, ka, _CMP_LT_OQ);
+    *k_low = _mm512_mask_blend_ps(take, ka, kb);
+    *v_low = _mm512_mask_blend_epi32(take, va, vb);
+    *k_high = _mm512_mask_blend_ps(take, kb, ka);
+    *v_high = _mm512_mask_blend_epi32(take, vb, va);
+}
+
+// merges the sorted vectors a and b, a getting the lowest half
+static inline void sort_merge2512f_kv(v16sf *ka, v16si *va, v16sf *kb, v16si *vb)
+{
+    sort_minmax512f_kv(*ka, *va, _mm512_permutexvar_ps(_mm512_set_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), *kb), _mm512_permutexvar_epi32(_mm512_set_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), *vb), ka, va, kb, vb);
+    sort_clean512f_kv(ka, va);
+    sort_clean512f_kv(kb, vb);
+}
+
+// merges the sorted sequences (a, b) and (c, d)
+static inline void sort_merge4512f_kv(v16sf *ka, v16si *va, v16sf *kb, v16si *vb, v16sf *kc, v16si *vc, v16sf *kd, v16si *vd)
+{
+    v16sf k_low0, k_high0, k_low1, k_high1;
+    v16si v_low0, v_high0, v_low1, v_high1;
+    sort_minmax512f_kv(*ka, *va, _mm512_permutexvar_ps(_mm512_set_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), *kd), _mm512_permutexvar_epi32(_mm512_set_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), *vd), &k_low0, &v_low0, &k_high0, &v_high0);
+    sort_minmax512f_kv(*kb, *vb, _mm512_permutexvar_ps(_mm512_set_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), *kc), _mm512_permutexvar_epi32(_mm512_set_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), *vc), &k_low1, &v_low1, &k_high1, &v_high1);
+    sort_minmax512f_kv(k_low0, v_low0, k_low1, v_low1, ka, va, kb, vb);
+    sort_minmax512f_kv(k_high0, v_high0, k_high1, v_high1, kc, vc, kd, vd);
+    sort_clean512f_kv(ka, va);
+    sort_clean512f_kv(kb, vb);
+    sort_clean512f_kv(kc, vc);
+    sort_clean512f_kv(kd, vd);
+}
+
+// sorts up to 4 vectors, padded with +inf keys (insertion sort if there are +inf keys, which could be swapped with the padding)
+static inline void sort_small512f_kv(float *keys, int32_t *values, int len)
+{
+    float tmp_keys[4 * AVX512_LEN_FLOAT] __attribute__((aligned(AVX512_LEN_BYTES)));
+    int32_t tmp_values[4 * AVX512_LEN_FLOAT] __attribute__((aligned(AVX512_LEN_BYTES)));
+
+    for (int i = 0; i < len; i++) {
+        if (keys[i] == INFINITY) {
+            insertion_sortf_kv(keys, values, len);
+            return;
+        }
+    }
+    memcpy(tmp_keys, keys, len * sizeof(float));
+    memcpy(tmp_values, values, len * sizeof(int32_t));
+    for (int i = len; i < 4 * AVX512_LEN_FLOAT; i++) {
+        tmp_keys[i] = INFINITY;
+        tmp_values[i] = 0;
+    }
+
+    v16sf ka = _mm512_loadu_ps(tmp_keys), kb, kc, kd;
+    v16si va = _mm512_loadu_si512((v16si *) (tmp_values)), vb, vc, vd;
+    sort_lanes512f_kv(&ka, &va);
+    if (len > AVX512_LEN_FLOAT) {
+        kb = _mm512_loadu_ps(tmp_keys + AVX512_LEN_FLOAT);
+        vb = _mm512_loadu_si512((v16si *) (tmp_values + AVX512_LEN_FLOAT));
+        sort_lanes512f_kv(&kb, &vb);
+        sort_merge2512f_kv(&ka, &va, &kb, &vb);
+        _mm512_storeu_ps(tmp_keys + AVX512_LEN_FLOAT, kb);
+        _mm512_storeu_si512((v16si *) (tmp_values + AVX512_LEN_FLOAT), vb);
+    }
+    if (len > 2 * AVX512_LEN_FLOAT) {
+        kc = _mm512_loadu_ps(tmp_keys + 2 * AVX512_LEN_FLOAT);
+        vc = _mm512_loadu_si512((v16si *) (tmp_values + 2 * AVX512_LEN_FLOAT));
+        kd = _mm512_loadu_ps(tmp_keys + 3 * AVX512_LEN_FLOAT);
+        vd = _mm512_loadu_si512((v16si *) (tmp_values + 3 * AVX512_LEN_FLOAT));
+        sort_lanes512f_kv(&kc, &vc);
+        sort_lanes512f_kv(&kd, &vd);
+        sort_merge2512f_kv(&kc, &vc, &kd, &vd);
+        sort_merge4512f_kv(&ka, &va, &kb, &vb, &kc, &vc, &kd, &vd);
+        _mm512_storeu_ps(tmp_keys + AVX512_LEN_FLOAT, kb);
+        _mm512_storeu_si512((v16si *) (tmp_values + AVX512_LEN_FLOAT), vb);
+        _mm512_storeu_ps(tmp_keys + 2 * AVX512_LEN_FLOAT, kc);
+        _mm512_storeu_si512((v16si *) (tmp_values + 2 * AVX512_LEN_FLOAT), vc);
+        _mm512_storeu_ps(tmp_keys + 3 * AVX512_LEN_FLOAT, kd);
+        _mm512_storeu_si512((v16si *) (tmp_values + 3 * AVX512_LEN_FLOAT), vd);
+    }
+    _mm512_storeu_ps(tmp_keys, ka);
+    _mm512_storeu_si512((v16si *) (tmp_values), va);
+
+    memcpy(keys, tmp_keys, len * sizeof(float));
+    memcpy(values, tmp_values, len * sizeof(int32_t));
+}
+
+// packs the keys lower than the pivot (with their values) to [*left_w, ...) and the others to [..., *right_w)
+static inline void partition_store512f_kv(float *keys, int32_t *values, v16sf k, v16si v, v16sf pivot_vec, int *left_w, int *right_w)
+{
+    __mmask16 mask = _mm512_cmp_ps_mask(k, pivot_vec, _CMP_LT_OQ);
+    __mmask16 mask_high = (__mmask16) ~mask;
+    int nb_low = __builtin_popcount(mask);
+    int nb_high = AVX512_LEN_FLOAT - nb_low;
+
+    _mm512_storeu_ps(keys + *left_w, _mm512_maskz_compress_ps(mask, k));
+    _mm512_storeu_si512((v16si *) (values + *left_w), _mm512_maskz_compress_epi32(mask, v));
+    _mm512_mask_storeu_ps(keys + *right_w - nb_high, tail_mask16(nb_high), _mm512_maskz_compress_ps(mask_high, k));
+    _mm512_mask_storeu_epi32(values + *right_w - nb_high, tail_mask16(nb_high), _mm512_maskz_compress_epi32(mask_high, v));
+    *left_w += nb_low;
+    *right_w -= nb_high;
+}
+
+// number of keys lower than pivot, moved to the beginning of keys with their values (len >= 2 * AVX512_LEN_FLOAT)
+static inline int partition512f_kv(float *keys, int32_t *values, int len, float pivot)
+{
+    v16sf pivot_vec = _mm512_set1_ps(pivot);
+    v16sf first_k = _mm512_loadu_ps(keys);
+    v16si first_v = _mm512_loadu_si512((v16si *) (values));
+    v16sf last_k = _mm512_loadu_ps(keys + len - AVX512_LEN_FLOAT);
+    v16si last_v = _mm512_loadu_si512((v16si *) (values + len - AVX512_LEN_FLOAT));
+    int left = AVX512_LEN_FLOAT, right = len - 2 * AVX512_LEN_FLOAT;  // next vectors read from each end
+    int left_w = 0, right_w = len;             // free space [left_w, left) and [right + AVX512_LEN_FLOAT, right_w)
+
+    while (left <= right) {
+        v16sf k;
+        v16si v;
+        if ((left - left_w) <= (right_w - right - AVX512_LEN_FLOAT)) {
+            k = _mm512_loadu_ps(keys + left);
+            v = _mm512_loadu_si512((v16si *) (values + left));
+            left += AVX512_LEN_FLOAT;
+        } else {
+            k = _mm512_loadu_ps(keys + right);
+            v = _mm512_loadu_si512((v16si *) (values + right));
+            right -= AVX512_LEN_FLOAT;
+        }
+        partition_store512f_kv(keys, values, k, v, pivot_vec, &left_w, &right_w);
+    }
+
+    // the last elements (less than a vector) with the first and the last vectors
+    float tmp_keys[3 * AVX512_LEN_FLOAT];
+    int32_t tmp_values[3 * AVX512_LEN_FLOAT];
+    int nb_tmp = right + AVX512_LEN_FLOAT - left;
+    memcpy(tmp_keys, keys + left, nb_tmp * sizeof(float));
+    memcpy(tmp_values, values + left, nb_tmp * sizeof(int32_t));
+    _mm512_storeu_ps(tmp_keys + nb_tmp, first_k);
+    _mm512_storeu_si512((v16si *) (tmp_values + nb_tmp), first_v);
+    _mm512_storeu_ps(tmp_keys + nb_tmp + AVX512_LEN_FLOAT, last_k);
+    _mm512_storeu_si512((v16si *) (tmp_values + nb_tmp + AVX512_LEN_FLOAT), last_v);
+    sort_partition_tailf_kv(keys, values, tmp_keys, tmp_values, nb_tmp + 2 * AVX512_LEN_FLOAT, pivot, &left_w, &right_w);
+    return left_w;
+}
+
+SIMD_UTILS_API void sort512f_kv(float *keys, int32_t *values, int len)
+{
+    sort_runf_kv(keys, values, len, 4 * AVX512_LEN_FLOAT, partition512f_kv, sort_small512f_kv);
+}
+
+// indices of the elements of src greater than threshold (see simd_utils_topk.h)
+static inline int filter_gt512f(float *src, int len, float threshold, int32_t *idx)
+{
+    int stop_len = len / (2 * AVX512_LEN_FLOAT);
+    stop_len *= (2 * AVX512_LEN_FLOAT);
+    v16sf thr = _mm512_set1_ps(threshold);
+    int nb = 0;
+
+    for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
+        v16sf x0 = _mm512_loadu_ps(src + i);
+        v16sf x1 = _mm512_loadu_ps(src + i + AVX512_LEN_FLOAT);
+        uint32_t mask = (uint32_t) _mm512_cmp_ps_mask(x0, thr, _CMP_GT_OQ) | ((uint32_t) _mm512_cmp_ps_mask(x1, thr, _CMP_GT_OQ) << AVX512_LEN_FLOAT);
+        while (mask) {
+            idx[nb++] = i + __builtin_ctz(mask);
+            mask &= mask - 1;
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 tail = tail_mask16(len - i);
+        uint32_t mask = _mm512_mask_cmp_ps_mask(tail, _mm512_maskz_loadu_ps(tail, src + i), thr, _CMP_GT_OQ);
+        while (mask) {
+            idx[nb++] = i + __builtin_ctz(mask);
+            mask &= mask - 1;
+        }
+    }
+    return nb;
+}
+
+// indices of the elements of src lower than threshold (see simd_utils_topk.h)
+static inline int filter_lt512f(float *src, int len, float threshold, int32_t *idx)
+{
+    int stop_len = len / (2 * AVX512_LEN_FLOAT);
+    stop_len *= (2 * AVX512_LEN_FLOAT);
+    v16sf thr = _mm512_set1_ps(threshold);
+    int nb = 0;
+
+    for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
+        v16sf x0 = _mm512_loadu_ps(src + i);
+        v16sf x1 = _mm512_loadu_ps(src + i + AVX512_LEN_FLOAT);
+        uint32_t mask = (uint32_t) _mm512_cmp_ps_mask(x0, thr, _CMP_LT_OQ) | ((uint32_t) _mm512_cmp_ps_mask(x1, thr, _CMP_LT_OQ) << AVX512_LEN_FLOAT);
+        while (mask) {
+            idx[nb++] = i + __builtin_ctz(mask);
+            mask &= mask - 1;
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 tail = tail_mask16(len - i);
+        uint32_t mask = _mm512_mask_cmp_ps_mask(tail, _mm512_maskz_loadu_ps(tail, src + i), thr, _CMP_LT_OQ);
+        while (mask) {
+            idx[nb++] = i + __builtin_ctz(mask);
+            mask &= mask - 1;
+        }
+    }
+    return nb;
+}
+
+SIMD_UTILS_API void topk512f(float *src, int len, int k, float *dst, int32_t *idx)
+{
+    topk_runf(src, len, k, dst, idx, 1, filter_gt512f);
+}
+
+SIMD_UTILS_API void bottomk512f(float *src, int len, int k, float *dst, int32_t *idx)
+{
+    topk_runf(src, len, k, dst, idx, 0, filter_lt512f);
+}
+
+SIMD_UTILS_API void partialsort512f(float *src, int len, int k)
+{
+    partialsort_runf(src, len, k, 4 * AVX512_LEN_FLOAT, partition512f, sort_small512f);
+}
+
+SIMD_UTILS_API void sqrt512f(float *src, float *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_FLOAT);
+    stop_len *= (2 * AVX512_LEN_FLOAT);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
+                v16sf src_tmp = _mm512_load_ps(src + i);
+                v16sf src_tmp2 = _mm512_load_ps(src + i + AVX512_LEN_FLOAT);
+                v16sf dst_tmp = _mm512_sqrt_ps(src_tmp);
+                v16sf dst_tmp2 = _mm512_sqrt_ps(src_tmp2);
+                _mm512_stream_ps(dst + i, dst_tmp);
+                _mm512_stream_ps(dst + i + AVX512_LEN_FLOAT, dst_tmp2);
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
+                v16sf src_tmp = _mm512_load_ps(src + i);
+                v16sf src_tmp2 = _mm512_load_ps(src + i + AVX512_LEN_FLOAT);
+                v16sf dst_tmp = _mm512_sqrt_ps(src_tmp);
+                v16sf dst_tmp2 = _mm512_sqrt_ps(src_tmp2);
+                _mm512_store_ps(dst + i, dst_tmp);
+                _mm512_store_ps(dst + i + AVX512_LEN_FLOAT, dst_tmp2);
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
+            v16sf src_tmp = _mm512_loadu_ps(src + i);
+            v16sf src_tmp2 = _mm512_loadu_ps(src + i + AVX512_LEN_FLOAT);
+            v16sf dst_tmp = _mm512_sqrt_ps(src_tmp);
+            v16sf dst_tmp2 = _mm512_sqrt_ps(src_tmp2);
+            _mm512_storeu_ps(dst + i, dst_tmp);
+            _mm512_storeu_ps(dst + i + AVX512_LEN_FLOAT, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        v16sf dst_tmp = _mm512_sqrt_ps(src_tmp);
+        _mm512_mask_storeu_ps(dst + i, mask, dst_tmp);
+    }
+}
+
+SIMD_UTILS_API void rint512f(float *src, float *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_FLOAT);
+    stop_len *= (2 * AVX512_LEN_FLOAT);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
+            v16sf src_tmp = _mm512_load_ps(src + i);
+            v16sf src_tmp2 = _mm512_load_ps(src + i + AVX512_LEN_FLOAT);
+            v16sf dst_tmp = _mm512_roundscale_ps(src_tmp, ROUNDTONEAREST);
+            v16sf dst_tmp2 = _mm512_roundscale_ps(src_tmp2, ROUNDTONEAREST);
+            _mm512_store_ps(dst + i, dst_tmp);
+            _mm512_store_ps(dst + i + AVX512_LEN_FLOAT, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
+            v16sf src_tmp = _mm512_loadu_ps(src + i);
+            v16sf src_tmp2 = _mm512_loadu_ps(src + i + AVX512_LEN_FLOAT);
+            v16sf dst_tmp = _mm512_roundscale_ps(src_tmp, ROUNDTONEAREST);
+            v16sf dst_tmp2 = _mm512_roundscale_ps(src_tmp2, ROUNDTONEAREST);
+            _mm512_storeu_ps(dst + i, dst_tmp);
+            _mm512_storeu_ps(dst + i + AVX512_LEN_FLOAT, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        v16sf dst_tmp = _mm512_roundscale_ps(src_tmp, ROUNDTONEAREST);
+        _mm512_mask_storeu_ps(dst + i, mask, dst_tmp);
+    }
+}
+
+//rounds away from zero like IPP, whereas SSE/AVx/AVX512 rounds to nearest even (IEEE-754)
+SIMD_UTILS_API void round512f(float *src, float *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_FLOAT);
+    stop_len *= (2 * AVX512_LEN_FLOAT);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
+            v16sf src_tmp = _mm512_load_ps(src + i);
+            v16sf src_tmp2 = _mm512_load_ps(src + i + AVX512_LEN_FLOAT);
+            v16sf spe1 = _mm512_and_ps(src_tmp, *(v16sf*)_ps512_sign_mask);
+            spe1 = _mm512_or_ps(spe1,*(v16sf*)_ps512_mid_mask);
+            spe1 = _mm512_add_ps(src_tmp, spe1);
+            v16sf spe2 = _mm512_and_ps(src_tmp2, *(v16sf*)_ps512_sign_mask);
+            spe2 = _mm512_or_ps(spe2,*(v16sf*)_ps512_mid_mask);
+            spe2 = _mm512_add_ps(src_tmp2, spe2);
+            v16sf dst_tmp = _mm512_roundscale_ps(spe1, ROUNDTOZERO);
+            v16sf dst_tmp2 = _mm512_roundscale_ps(spe2, ROUNDTOZERO);
+            _mm512_store_ps(dst + i, dst_tmp);
+            _mm512_store_ps(dst + i + AVX512_LEN_FLOAT, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
+            v16sf src_tmp = _mm512_loadu_ps(src + i);
+            v16sf src_tmp2 = _mm512_loadu_ps(src + i + AVX512_LEN_FLOAT);
+            v16sf spe1 = _mm512_and_ps(src_tmp, *(v16sf*)_ps512_sign_mask);
+            spe1 = _mm512_or_ps(spe1,*(v16sf*)_ps512_mid_mask);
+            spe1 = _mm512_add_ps(src_tmp, spe1);
+            v16sf spe2 = _mm512_and_ps(src_tmp2, *(v16sf*)_ps512_sign_mask);
+            spe2 = _mm512_or_ps(spe2,*(v16sf*)_ps512_mid_mask);
+            spe2 = _mm512_add_ps(src_tmp2, spe2);
+            v16sf dst_tmp = _mm512_roundscale_ps(spe1, ROUNDTOZERO);
+            v16sf dst_tmp2 = _mm512_roundscale_ps(spe2, ROUNDTOZERO);
+            _mm512_storeu_ps(dst + i, dst_tmp);
+            _mm512_storeu_ps(dst + i + AVX512_LEN_FLOAT, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        v16sf spe1 = _mm512_and_ps(src_tmp, *(v16sf*)_ps512_sign_mask);
+        spe1 = _mm512_or_ps(spe1,*(v16sf*)_ps512_mid_mask);
+        spe1 = _mm512_add_ps(src_tmp, spe1);
+        v16sf dst_tmp = _mm512_roundscale_ps(spe1, ROUNDTOZERO);
+        _mm512_mask_storeu_ps(dst + i, mask, dst_tmp);
+    }
+}
+
+SIMD_UTILS_API void ceil512f(float *src, float *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_FLOAT);
+    stop_len *= (2 * AVX512_LEN_FLOAT);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
+            v16sf src_tmp = _mm512_load_ps(src + i);
+            v16sf src_tmp2 = _mm512_load_ps(src + i + AVX512_LEN_FLOAT);
+            v16sf dst_tmp = _mm512_roundscale_ps(src_tmp, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+            v16sf dst_tmp2 = _mm512_roundscale_ps(src_tmp2, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+            _mm512_store_ps(dst + i, dst_tmp);
+            _mm512_store_ps(dst + i + AVX512_LEN_FLOAT, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
+            v16sf src_tmp = _mm512_loadu_ps(src + i);
+            v16sf src_tmp2 = _mm512_loadu_ps(src + i + AVX512_LEN_FLOAT);
+            v16sf dst_tmp = _mm512_roundscale_ps(src_tmp, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+            v16sf dst_tmp2 = _mm512_roundscale_ps(src_tmp2, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+            _mm512_storeu_ps(dst + i, dst_tmp);
+            _mm512_storeu_ps(dst + i + AVX512_LEN_FLOAT, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        v16sf dst_tmp = _mm512_roundscale_ps(src_tmp, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+        _mm512_mask_storeu_ps(dst + i, mask, dst_tmp);
+    }
+}
+
+SIMD_UTILS_API void floor512f(float *src, float *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_FLOAT);
+    stop_len *= (2 * AVX512_LEN_FLOAT);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
+            v16sf src_tmp = _mm512_load_ps(src + i);
+            v16sf src_tmp2 = _mm512_load_ps(src + i + AVX512_LEN_FLOAT);
+            v16sf dst_tmp = _mm512_roundscale_ps(src_tmp, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+            v16sf dst_tmp2 = _mm512_roundscale_ps(src_tmp2, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+            _mm512_store_ps(dst + i, dst_tmp);
+            _mm512_store_ps(dst + i + AVX512_LEN_FLOAT, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
+            v16sf src_tmp = _mm512_loadu_ps(src + i);
+            v16sf src_tmp2 = _mm512_loadu_ps(src + i + AVX512_LEN_FLOAT);
+            v16sf dst_tmp = _mm512_roundscale_ps(src_tmp, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+            v16sf dst_tmp2 = _mm512_roundscale_ps(src_tmp2, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+            _mm512_storeu_ps(dst + i, dst_tmp);
+            _mm512_storeu_ps(dst + i + AVX512_LEN_FLOAT, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        v16sf dst_tmp = _mm512_roundscale_ps(src_tmp, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+        _mm512_mask_storeu_ps(dst + i, mask, dst_tmp);
+    }
+}
+
+SIMD_UTILS_API void trunc512f(float *src, float *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_FLOAT);
+    stop_len *= (2 * AVX512_LEN_FLOAT);
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
         for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
@@ -3105,12 +4340,15 @@ static inline void trunc512f(float *src, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = truncf(src[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        v16sf dst_tmp = _mm512_roundscale_ps(src_tmp, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        _mm512_mask_storeu_ps(dst + i, mask, dst_tmp);
     }
 }
 
-static inline void cplxvecdiv512f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxvecdiv512f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
 
 {
     int stop_len = len / (AVX512_LEN_FLOAT);  //(len << 1) >> 2;
@@ -3151,14 +4389,27 @@ static inline void cplxvecdiv512f(complex32_t *src1, complex32_t *src2, complex3
             _mm512_storeu_ps((float *) (dst) + i, out);
         }
     }
-    for (int i = stop_len; i < len; i++) {
-        float c2d2 = src2[i].re * src2[i].re + src2[i].im * src2[i].im;
-        dst[i].re = ((src1[i].re * src2[i].re) + (src1[i].im * src2[i].im)) / c2d2;
-        dst[i].im = (-(src1[i].re * src2[i].im) + (src2[i].re * src1[i].im)) / c2d2;
+    // tail by half vectors of 8 complex
+    for (i = 2 * stop_len; i < 2 * len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(2 * len - i);
+        v16sf src1_tmp = _mm512_maskz_loadu_ps(mask, (float *) (src1) + i);
+        // the masked out lanes of src2 are set to 1 to avoid divisions by zero
+        v16sf src2_tmp = _mm512_mask_loadu_ps(_mm512_set1_ps(1.0f), mask, (float *) (src2) + i);
+        v16sf c2d2 = _mm512_mul_ps(src2_tmp, src2_tmp);
+        v16sf c2d2_shuf = _mm512_shuffle_ps(c2d2, c2d2, _MM_SHUFFLE(2, 3, 0, 1));
+        c2d2 = _mm512_add_ps(c2d2_shuf, c2d2);
+        v16sf tmp1 = _mm512_moveldup_ps(src1_tmp);  // a1,a1,a0,a0
+        tmp1 = _mm512_mul_ps(*(v16sf *) _ps512_conj_mask, tmp1);
+        v16sf tmp2 = _mm512_shuffle_ps(src2_tmp, src2_tmp, _MM_SHUFFLE(2, 3, 0, 1));  // c1,d1,c0,d0
+        v16sf tmp3 = _mm512_movehdup_ps(src1_tmp);                                    // b1,b1,b0,b0
+        v16sf out = _mm512_mul_ps(tmp2, tmp3);                                        // c1b1, b1d1, c0b0, d0b0
+        out = _mm512_fmadd_ps_custom(tmp1, src2_tmp, out);
+        out = _mm512_div_ps(out, c2d2);
+        _mm512_mask_storeu_ps((float *) (dst) + i, mask, out);
     }
 }
 
-static inline void cplxvecdiv512f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxvecdiv512f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
 {
     int stop_len = len / (2 * AVX512_LEN_FLOAT);
     stop_len *= 2 * AVX512_LEN_FLOAT;
@@ -3236,14 +4487,25 @@ static inline void cplxvecdiv512f_split(float *src1Re, float *src1Im, float *src
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        float c2d2 = src2Re[i] * src2Re[i] + src2Im[i] * src2Im[i];
-        dstRe[i] = (src1Re[i] * src2Re[i] + (src1Im[i] * src2Im[i])) / c2d2;
-        dstIm[i] = (-src1Re[i] * src2Im[i] + (src2Re[i] * src1Im[i])) / c2d2;
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src1Re_tmp = _mm512_maskz_loadu_ps(mask, src1Re + i);
+        v16sf src1Im_tmp = _mm512_maskz_loadu_ps(mask, src1Im + i);
+        // the masked out lanes of src2 are set to 1 to avoid divisions by zero
+        v16sf src2Re_tmp = _mm512_mask_loadu_ps(_mm512_set1_ps(1.0f), mask, src2Re + i);
+        v16sf src2Im_tmp = _mm512_maskz_loadu_ps(mask, src2Im + i);
+        v16sf c2 = _mm512_mul_ps(src2Re_tmp, src2Re_tmp);
+        v16sf c2d2 = _mm512_fmadd_ps_custom(src2Im_tmp, src2Im_tmp, c2);
+        v16sf ac = _mm512_mul_ps(src1Re_tmp, src2Re_tmp);  // ac
+        v16sf bc = _mm512_mul_ps(src1Im_tmp, src2Re_tmp);  // bc
+        v16sf dstRe_tmp = _mm512_fmadd_ps_custom(src1Im_tmp, src2Im_tmp, ac);
+        v16sf dstIm_tmp = _mm512_fnmadd_ps_custom(src1Re_tmp, src2Im_tmp, bc);
+        _mm512_mask_storeu_ps(dstRe + i, mask, _mm512_div_ps(dstRe_tmp, c2d2));
+        _mm512_mask_storeu_ps(dstIm + i, mask, _mm512_div_ps(dstIm_tmp, c2d2));
     }
 }
 
-static inline void cplxvecmul512f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxvecmul512f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
 {
     int stop_len = len / (AVX512_LEN_FLOAT);  //(len << 1) >> 2;
     stop_len = stop_len * AVX512_LEN_FLOAT;   // stop_len << 2;
@@ -3277,13 +4539,20 @@ static inline void cplxvecmul512f(complex32_t *src1, complex32_t *src2, complex3
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i].re = (src1[i].re * src2[i].re) - src1[i].im * src2[i].im;
-        dst[i].im = src1[i].re * src2[i].im + (src2[i].re * src1[i].im);
+    for (i = 2 * stop_len; i < 2 * len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(2 * len - i);
+        v16sf src1_tmp = _mm512_maskz_loadu_ps(mask, (float *) (src1) + i);
+        v16sf src2_tmp = _mm512_maskz_loadu_ps(mask, (float *) (src2) + i);
+        v16sf tmp1 = _mm512_moveldup_ps(src1_tmp);                                    // a1,a1,a0,a0
+        v16sf tmp3 = _mm512_shuffle_ps(src2_tmp, src2_tmp, _MM_SHUFFLE(2, 3, 0, 1));  // c1,d1,c0,d0
+        v16sf tmp4 = _mm512_movehdup_ps(src1_tmp);                                    // b1,b1,b0,b0
+        v16sf out = _mm512_mul_ps(tmp3, tmp4);
+        out = _mm512_fmaddsub_ps_custom(tmp1, src2_tmp, out);
+        _mm512_mask_storeu_ps((float *) (dst) + i, mask, out);
     }
 }
 
-static inline void cplxvecmul512f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxvecmul512f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
 {
     int stop_len = len / (AVX512_LEN_FLOAT);
     stop_len = stop_len * AVX512_LEN_FLOAT;
@@ -3319,13 +4588,20 @@ static inline void cplxvecmul512f_split(float *src1Re, float *src1Im, float *src
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dstRe[i] = (src1Re[i] * src2Re[i]) - src1Im[i] * src2Im[i];
-        dstIm[i] = src1Re[i] * src2Im[i] + (src2Re[i] * src1Im[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src1Re_tmp = _mm512_maskz_loadu_ps(mask, src1Re + i);
+        v16sf src1Im_tmp = _mm512_maskz_loadu_ps(mask, src1Im + i);
+        v16sf src2Re_tmp = _mm512_maskz_loadu_ps(mask, src2Re + i);
+        v16sf src2Im_tmp = _mm512_maskz_loadu_ps(mask, src2Im + i);
+        v16sf ac = _mm512_mul_ps(src1Re_tmp, src2Re_tmp);
+        v16sf bc = _mm512_mul_ps(src1Im_tmp, src2Re_tmp);
+        _mm512_mask_storeu_ps(dstRe + i, mask, _mm512_fnmadd_ps_custom(src1Im_tmp, src2Im_tmp, ac));  // ac - bd
+        _mm512_mask_storeu_ps(dstIm + i, mask, _mm512_fmadd_ps_custom(src1Re_tmp, src2Im_tmp, bc));   // ad + bc
     }
 }
 
-static inline void cplxconjvecmul512f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxconjvecmul512f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
 {
     int stop_len = len / (AVX512_LEN_FLOAT);  //(len << 1) >> 2;
     stop_len = stop_len * AVX512_LEN_FLOAT;   // stop_len << 2;
@@ -3372,13 +4648,25 @@ static inline void cplxconjvecmul512f(complex32_t *src1, complex32_t *src2, comp
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i].re = src1[i].re * src2[i].re + (src1[i].im * src2[i].im);
-        dst[i].im = (src2[i].re * src1[i].im) - src1[i].re * src2[i].im;
+    for (i = 2 * stop_len; i < 2 * len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(2 * len - i);
+        v16sf src1_tmp = _mm512_maskz_loadu_ps(mask, (float *) (src1) + i);
+        v16sf src2_tmp = _mm512_maskz_loadu_ps(mask, (float *) (src2) + i);
+        v16sf tmp1 = _mm512_moveldup_ps(src1_tmp);                                    // a1,a1,a0,a0
+        v16sf tmp2 = _mm512_mul_ps(tmp1, src2_tmp);                                   // a1d1,a1c1,a0d0,a0c0
+        v16sf tmp3 = _mm512_shuffle_ps(src2_tmp, src2_tmp, _MM_SHUFFLE(2, 3, 0, 1));  // c1,d1,c0,d0
+        v16sf tmp4 = _mm512_movehdup_ps(src1_tmp);                                    // b1,b1,b0,b0
+#ifndef FMA
+        v16sf out = _mm512_mul_ps(tmp3, tmp4);
+        out = _mm512_fmadd_ps_custom(*(v16sf *) _ps512_conj_mask, tmp2, out);
+#else
+        v16sf out = _mm512_fmsubadd_ps(tmp3, tmp4, tmp2);
+#endif
+        _mm512_mask_storeu_ps((float *) (dst) + i, mask, out);
     }
 }
 
-static inline void cplxconjvecmul512f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxconjvecmul512f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
 {
     int stop_len = len / (AVX512_LEN_FLOAT);
     stop_len = stop_len * AVX512_LEN_FLOAT;
@@ -3414,14 +4702,21 @@ static inline void cplxconjvecmul512f_split(float *src1Re, float *src1Im, float
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dstRe[i] = src1Re[i] * src2Re[i] + (src1Im[i] * src2Im[i]);
-        dstIm[i] = (src2Re[i] * src1Im[i]) - src1Re[i] * src2Im[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src1Re_tmp = _mm512_maskz_loadu_ps(mask, src1Re + i);
+        v16sf src1Im_tmp = _mm512_maskz_loadu_ps(mask, src1Im + i);
+        v16sf src2Re_tmp = _mm512_maskz_loadu_ps(mask, src2Re + i);
+        v16sf src2Im_tmp = _mm512_maskz_loadu_ps(mask, src2Im + i);
+        v16sf ac = _mm512_mul_ps(src1Re_tmp, src2Re_tmp);
+        v16sf bc = _mm512_mul_ps(src1Im_tmp, src2Re_tmp);
+        _mm512_mask_storeu_ps(dstRe + i, mask, _mm512_fmadd_ps_custom(src1Im_tmp, src2Im_tmp, ac));   // ac + bd
+        _mm512_mask_storeu_ps(dstIm + i, mask, _mm512_fnmadd_ps_custom(src1Re_tmp, src2Im_tmp, bc));  // bc - ad
     }
 }
 
 // prefer using cplxconjvecmulXf if you also need to do a multiply
-static inline void cplxconj512f(complex32_t *src, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxconj512f(complex32_t *src, complex32_t *dst, int len)
 {
     int stop_len = len / (2 * AVX512_LEN_FLOAT);  //(len << 1) >> 2;
     stop_len *= 2 * AVX512_LEN_FLOAT;             // stop_len << 2;
@@ -3452,13 +4747,14 @@ static inline void cplxconj512f(complex32_t *src, complex32_t *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i].re = src[i].re;
-        dst[i].im = -src[i].im;
+    for (i = 2 * stop_len; i < 2 * len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(2 * len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, (float *) (src) + i);
+        _mm512_mask_storeu_ps((float *) (dst) + i, mask, _mm512_xor_ps(src_tmp, *(v16sf *) &conj_mask));
     }
 }
 
-static inline void sigmoid512f(float *src, float *dst, int len)
+SIMD_UTILS_API void sigmoid512f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -3477,12 +4773,15 @@ static inline void sigmoid512f(float *src, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = 1.0f / (1.0f + expf(-src[i]));
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        v16sf tmp = _mm512_add_ps(*(v16sf *) _ps512_1, exp512_ps(_mm512_xor_ps(*(v16sf *) _ps512_neg_sign_mask, src_tmp)));
+        _mm512_mask_storeu_ps(dst + i, mask, _mm512_div_ps(*(v16sf *) _ps512_1, tmp));
     }
 }
 
-static inline void PRelu512f(float *src, float *dst, float alpha, int len)
+SIMD_UTILS_API void PRelu512f(float *src, float *dst, float alpha, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -3506,15 +4805,16 @@ static inline void PRelu512f(float *src, float *dst, float alpha, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        if (src[i] > 0.0f)
-            dst[i] = src[i];
-        else
-            dst[i] = alpha * src[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        v16sf tmp = _mm512_mul_ps(alpha_vec, src_tmp);  // tmp = a*x (used when x < 0)
+        __mmask16 compare = _mm512_cmp_ps_mask(src_tmp, zero, _CMP_GT_OS);
+        _mm512_mask_storeu_ps(dst + i, mask, _mm512_mask_blend_ps(compare, tmp, src_tmp));
     }
 }
 
-static inline void softmax512f(float *src, float *dst, int len)
+SIMD_UTILS_API void softmax512f(float *src, float *dst, int len)
 {
     int stop_len = len / (AVX512_LEN_FLOAT);
     stop_len *= (AVX512_LEN_FLOAT);
@@ -3537,12 +4837,15 @@ static inline void softmax512f(float *src, float *dst, int len)
         }
     }
 
-    float acc = _mm512_reduce_add_ps(vec_acc1);
-
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = expf(src[i]);
-        acc += dst[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        v16sf dst_tmp = exp512_ps(src_tmp);
+        vec_acc1 = _mm512_mask_add_ps(vec_acc1, mask, vec_acc1, dst_tmp);
+        _mm512_mask_storeu_ps(dst + i, mask, dst_tmp);
     }
+
+    float acc = _mm512_reduce_add_ps(vec_acc1);
     vec_acc1 = _mm512_set1_ps(acc);
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
@@ -3557,12 +4860,14 @@ static inline void softmax512f(float *src, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] /= acc;
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf dst_tmp = _mm512_maskz_loadu_ps(mask, dst + i);
+        _mm512_mask_storeu_ps(dst + i, mask, _mm512_div_ps(dst_tmp, vec_acc1));
     }
 }
 
-static inline void pol2cart2D512f(float *r, float *theta, float *x, float *y, int len)
+SIMD_UTILS_API void pol2cart2D512f(float *r, float *theta, float *x, float *y, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -3594,15 +4899,21 @@ static inline void pol2cart2D512f(float *r, float *theta, float *x, float *y, in
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        float sin_tmp = 0.0f, cos_tmp = 0.0f;
-        mysincosf(theta[i], &sin_tmp, &cos_tmp);
-        x[i] = r[i] * cos_tmp;
-        y[i] = r[i] * sin_tmp;
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf r_tmp = _mm512_maskz_loadu_ps(mask, r + i);
+        v16sf theta_tmp = _mm512_maskz_loadu_ps(mask, theta + i);
+        v16sf sin_tmp;
+        v16sf cos_tmp;
+        sincos512_ps(theta_tmp, &sin_tmp, &cos_tmp);
+        v16sf x_tmp = _mm512_mul_ps(r_tmp, cos_tmp);
+        v16sf y_tmp = _mm512_mul_ps(r_tmp, sin_tmp);
+        _mm512_mask_storeu_ps(x + i, mask, x_tmp);
+        _mm512_mask_storeu_ps(y + i, mask, y_tmp);
     }
 }
 
-static inline void cart2pol2D512f(float *x, float *y, float *r, float *theta, int len)
+SIMD_UTILS_API void cart2pol2D512f(float *x, float *y, float *r, float *theta, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -3632,13 +4943,20 @@ static inline void cart2pol2D512f(float *x, float *y, float *r, float *theta, in
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        r[i] = sqrtf(x[i] * x[i] + (y[i] * y[i]));
-        theta[i] = atan2f(y[i], x[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf x_tmp = _mm512_maskz_loadu_ps(mask, x + i);
+        v16sf y_tmp = _mm512_maskz_loadu_ps(mask, y + i);
+        v16sf y_square = _mm512_mul_ps(y_tmp, y_tmp);
+        v16sf r_tmp = _mm512_fmadd_ps_custom(x_tmp, x_tmp, y_square);
+        r_tmp = _mm512_sqrt_ps(r_tmp);
+        v16sf theta_tmp = atan2512f_ps(y_tmp, x_tmp);
+        _mm512_mask_storeu_ps(r + i, mask, r_tmp);
+        _mm512_mask_storeu_ps(theta + i, mask, theta_tmp);
     }
 }
 
-static inline void modf512f(float *src, float *integer, float *remainder, int len)
+SIMD_UTILS_API void modf512f(float *src, float *integer, float *remainder, int len)
 {
     int stop_len = len / (2 * AVX512_LEN_FLOAT);
     stop_len *= (2 * AVX512_LEN_FLOAT);
@@ -3671,8 +4989,13 @@ static inline void modf512f(float *src, float *integer, float *remainder, int le
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        remainder[i] = modff(src[i], &(integer[i]));
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf src_tmp = _mm512_maskz_loadu_ps(mask, src + i);
+        v16sf integer_tmp = _mm512_roundscale_ps(src_tmp, ROUNDTOZERO);
+        v16sf remainder_tmp = _mm512_sub_ps(src_tmp, integer_tmp);
+        _mm512_mask_storeu_ps(integer + i, mask, integer_tmp);
+        _mm512_mask_storeu_ps(remainder + i, mask, remainder_tmp);
     }
 }
 
@@ -3685,7 +5008,7 @@ static inline v16sf pow512_ps(v16sf x, v16sf y)
     return ret;
 }
 
-static inline void pow512f(float *x, float *y, float *dst, int len)
+SIMD_UTILS_API void pow512f(float *x, float *y, float *dst, int len)
 {
     int stop_len = len / (2* AVX512_LEN_FLOAT);
     stop_len *= ( 2*AVX512_LEN_FLOAT);
@@ -3714,18 +5037,21 @@ static inline void pow512f(float *x, float *y, float *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = powf(x[i], y[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf x_tmp = _mm512_maskz_loadu_ps(mask, x + i);
+        v16sf y_tmp = _mm512_maskz_loadu_ps(mask, y + i);
+        _mm512_mask_storeu_ps(dst + i, mask, pow512_ps(x_tmp, y_tmp));
     }
 }
 
-static inline void powcplx512f(complex32_t *x, complex32_t *y, complex32_t *dst, int len)
+SIMD_UTILS_API void powcplx512f(complex32_t *x, complex32_t *y, complex32_t *dst, int len)
 {
     int stop_len = len / (2* AVX512_LEN_FLOAT);
     stop_len *= ( 2*AVX512_LEN_FLOAT);
 
     if (areAligned3((uintptr_t) (x), (uintptr_t) (y), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
+        for (int i = 0; i < 2 * stop_len; i += 2 * AVX512_LEN_FLOAT) {
             v16sfx2 x_tmp = _mm512_load2_ps((float const *) (x) + i);
             v16sfx2 y_tmp = _mm512_load2_ps((float const *) (y) + i);
             v16sf x_tmp_re2 = _mm512_mul_ps(x_tmp.val[0], x_tmp.val[0]);
@@ -3748,7 +5074,7 @@ static inline void powcplx512f(complex32_t *x, complex32_t *y, complex32_t *dst,
             _mm512_store2_ps((float*)(dst) + i, dst_tmp);
         }
     } else {
-        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
+        for (int i = 0; i < 2 * stop_len; i += 2 * AVX512_LEN_FLOAT) {
             v16sfx2 x_tmp = _mm512_load2u_ps((float const *) (x) + i);
             v16sfx2 y_tmp = _mm512_load2u_ps((float const *) (y) + i);
             v16sf x_tmp_re2 = _mm512_mul_ps(x_tmp.val[0], x_tmp.val[0]);
@@ -3772,22 +5098,633 @@ static inline void powcplx512f(complex32_t *x, complex32_t *y, complex32_t *dst,
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-		float x_tmp_re2 = x[i].re * x[i].re;
-		float modx = (x[i].im * x[i].im) + x_tmp_re2;
-		modx = sqrtf(modx);
-		complex32_t logx;
-		logx.re = logf(modx);
-		logx.im = atan2f(x[i].im, x[i].re);
-		complex32_t ylogx;
-		float ac = logx.re * y[i].re;     // ac
-		float ad = logx.re * y[i].im;     // ad
-		ylogx.re = ac - (logx.im * y[i].im);
-		ylogx.im = (logx.im *  y[i].re) +  ad;
-		float ex = expf(ylogx.re);
-		float cosylogx, sinylogx;
-		mysincosf(ylogx.im, &sinylogx, &cosylogx);
-		dst[i].re = ex * cosylogx;
-		dst[i].im = ex * sinylogx;
-    }
-}
\ No newline at end of file
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        v16sfx2 x_tmp = _mm512_maskz_load2u_ps(len - i, (float const *) (x + i));
+        v16sfx2 y_tmp = _mm512_maskz_load2u_ps(len - i, (float const *) (y + i));
+        v16sf x_tmp_re2 = _mm512_mul_ps(x_tmp.val[0], x_tmp.val[0]);
+        v16sf modx = _mm512_fmadd_ps_custom(x_tmp.val[1], x_tmp.val[1], x_tmp_re2);
+        modx = _mm512_sqrt_ps(modx);
+        v16sfx2 logx;
+        logx.val[0] = log512_ps(modx);
+        logx.val[1] = atan2512f_ps(x_tmp.val[1], x_tmp.val[0]);
+        v16sfx2 ylogx;
+        v16sf ac = _mm512_mul_ps(logx.val[0], y_tmp.val[0]);  // ac
+        v16sf ad = _mm512_mul_ps(logx.val[0], y_tmp.val[1]);  // ad
+        ylogx.val[0] = _mm512_fnmadd_ps_custom(logx.val[1], y_tmp.val[1], ac);
+        ylogx.val[1] = _mm512_fmadd_ps_custom(logx.val[1], y_tmp.val[0], ad);
+        v16sf ex = exp512_ps(ylogx.val[0]);
+        v16sf cosylogx, sinylogx;
+        sincos512_ps(ylogx.val[1], &sinylogx, &cosylogx);
+        v16sfx2 dst_tmp;
+        dst_tmp.val[0] = _mm512_mul_ps(ex, cosylogx);
+        dst_tmp.val[1] = _mm512_mul_ps(ex, sinylogx);
+        _mm512_mask_store2u_ps((float *) (dst + i), len - i, dst_tmp);
+    }
+}
+
+// Applies one stage of a pipeline on a block (in may be equal to out).
+// offset is the position of the block in the whole array, used for the array operands
+SIMD_UTILS_API void pipeline_apply512f(const pipeline_op_t *op, float *in, float *out, int offset, int len)
+{
+    switch (op->op) {
+    case PipeMulC:
+        mulc512f(in, op->value, out, len);
+        break;
+    case PipeAddC:
+        addc512f(in, op->value, out, len);
+        break;
+    case PipeMul:
+        mul512f(in, op->src + offset, out, len);
+        break;
+    case PipeAdd:
+        add512f(in, op->src + offset, out, len);
+        break;
+    case PipeSub:
+        sub512f(in, op->src + offset, out, len);
+        break;
+    case PipeDiv:
+        div512f(in, op->src + offset, out, len);
+        break;
+    case PipeThresholdGt:
+        threshold512_gt_f(in, out, len, op->value);
+        break;
+    case PipeThresholdLt:
+        threshold512_lt_f(in, out, len, op->value);
+        break;
+    case PipeFabs:
+        fabs512f(in, out, len);
+        break;
+    case PipeSqrt:
+        sqrt512f(in, out, len);
+        break;
+    case PipeExp:
+        exp512f(in, out, len);
+        break;
+    case PipeLn:
+        ln512f(in, out, len);
+        break;
+    case PipeLog10:
+        log10512f(in, out, len);
+        break;
+    case PipeLog2:
+        log2512f(in, out, len);
+        break;
+    case PipeCbrt:
+        cbrt512f(in, out, len);
+        break;
+    case PipeSin:
+        sin512f(in, out, len);
+        break;
+    case PipeCos:
+        cos512f(in, out, len);
+        break;
+    case PipeTan:
+        tan512f(in, out, len);
+        break;
+    case PipeTanh:
+        tanh512f(in, out, len);
+        break;
+    case PipeAtan:
+        atan512f(in, out, len);
+        break;
+    case PipeSigmoid:
+        sigmoid512f(in, out, len);
+        break;
+    default:
+        if (in != out)
+            copy512f(in, out, len);
+        break;
+    }
+}
+
+/* Applies the chain of operations ops[0] ... ops[nb_ops - 1] on src, block by block,
+ * so that each block stays in L1 cache between two operations */
+SIMD_UTILS_API void pipeline512f(float *src, float *dst, int len, const pipeline_op_t *ops, int nb_ops)
+{
+    if (nb_ops <= 0) {
+        if (src != dst)
+            copy512f(src, dst, len);
+        return;
+    }
+
+    for (int i = 0; i < len; i += PIPELINE_BLOCK_FLOAT) {
+        int block_len = ((len - i) < PIPELINE_BLOCK_FLOAT) ? (len - i) : PIPELINE_BLOCK_FLOAT;
+        pipeline_apply512f(&ops[0], src + i, dst + i, i, block_len);
+        for (int k = 1; k < nb_ops; k++) {
+            pipeline_apply512f(&ops[k], dst + i, dst + i, i, block_len);
+        }
+    }
+}
+
+// Same as pipeline512f followed by a sum, without writing the intermediate array
+SIMD_UTILS_API void pipeline512f_sum(float *src, float *dst, int len, const pipeline_op_t *ops, int nb_ops)
+{
+    __attribute__((aligned(AVX512_LEN_BYTES))) float block[PIPELINE_BLOCK_FLOAT];
+    double acc = 0.0;
+
+    for (int i = 0; i < len; i += PIPELINE_BLOCK_FLOAT) {
+        int block_len = ((len - i) < PIPELINE_BLOCK_FLOAT) ? (len - i) : PIPELINE_BLOCK_FLOAT;
+        float *in = src + i;
+        float block_sum;
+        for (int k = 0; k < nb_ops; k++) {
+            pipeline_apply512f(&ops[k], in, block, i, block_len);
+            in = block;
+        }
+        sum512f(in, &block_sum, block_len);
+        acc += (double) block_sum;
+    }
+
+    *dst = (float) acc;
+}
+
+/* FFT (see simd_utils_fft.h) */
+
+// radix-4 butterfly on AVX512_LEN_FLOAT points x[idx + r*n4], y = Y0re, Y0im, w1*Y1re, w1*Y1im, ...
+static inline void fft_radix4_512f(const float *xr, const float *xi, int idx, int n4, const v16sf *w, v16sf *y)
+{
+    v16sf ar = _mm512_loadu_ps(xr + idx), ai = _mm512_loadu_ps(xi + idx);
+    v16sf br = _mm512_loadu_ps(xr + idx + n4), bi = _mm512_loadu_ps(xi + idx + n4);
+    v16sf cr = _mm512_loadu_ps(xr + idx + 2 * n4), ci = _mm512_loadu_ps(xi + idx + 2 * n4);
+    v16sf dr = _mm512_loadu_ps(xr + idx + 3 * n4), di = _mm512_loadu_ps(xi + idx + 3 * n4);
+    v16sf apcr = _mm512_add_ps(ar, cr), apci = _mm512_add_ps(ai, ci);
+    v16sf amcr = _mm512_sub_ps(ar, cr), amci = _mm512_sub_ps(ai, ci);
+    v16sf bpdr = _mm512_add_ps(br, dr), bpdi = _mm512_add_ps(bi, di);
+    v16sf jbmdr = _mm512_sub_ps(bi, di), jbmdi = _mm512_sub_ps(dr, br);  // -j * (b - d)
+    v16sf t1r = _mm512_add_ps(amcr, jbmdr), t1i = _mm512_add_ps(amci, jbmdi);
+    v16sf t2r = _mm512_sub_ps(apcr, bpdr), t2i = _mm512_sub_ps(apci, bpdi);
+    v16sf t3r = _mm512_sub_ps(amcr, jbmdr), t3i = _mm512_sub_ps(amci, jbmdi);
+    y[0] = _mm512_add_ps(apcr, bpdr);
+    y[1] = _mm512_add_ps(apci, bpdi);
+    y[2] = _mm512_fnmadd_ps_custom(t1i, w[1], _mm512_mul_ps(t1r, w[0]));
+    y[3] = _mm512_fmadd_ps_custom(t1r, w[1], _mm512_mul_ps(t1i, w[0]));
+    y[4] = _mm512_fnmadd_ps_custom(t2i, w[3], _mm512_mul_ps(t2r, w[2]));
+    y[5] = _mm512_fmadd_ps_custom(t2r, w[3], _mm512_mul_ps(t2i, w[2]));
+    y[6] = _mm512_fnmadd_ps_custom(t3i, w[5], _mm512_mul_ps(t3r, w[4]));
+    y[7] = _mm512_fmadd_ps_custom(t3r, w[5], _mm512_mul_ps(t3i, w[4]));
+}
+
+// transpose of the 128 bits lanes, dst = r0[L], r1[L], r2[L], r3[L] for each lane L
+static inline void fft_store4_lanes512f(float *dst, v16sf r0, v16sf r1, v16sf r2, v16sf r3)
+{
+    v16sf u0 = _mm512_shuffle_f32x4(r0, r1, 0x44);
+    v16sf u1 = _mm512_shuffle_f32x4(r0, r1, 0xEE);
+    v16sf u2 = _mm512_shuffle_f32x4(r2, r3, 0x44);
+    v16sf u3 = _mm512_shuffle_f32x4(r2, r3, 0xEE);
+    _mm512_storeu_ps(dst, _mm512_shuffle_f32x4(u0, u2, 0x88));
+    _mm512_storeu_ps(dst + AVX512_LEN_FLOAT, _mm512_shuffle_f32x4(u0, u2, 0xDD));
+    _mm512_storeu_ps(dst + 2 * AVX512_LEN_FLOAT, _mm512_shuffle_f32x4(u1, u3, 0x88));
+    _mm512_storeu_ps(dst + 3 * AVX512_LEN_FLOAT, _mm512_shuffle_f32x4(u1, u3, 0xDD));
+}
+
+// dst[4i + r] = yr[i]
+static inline void fft_store4_s1_512f(float *dst, v16sf y0, v16sf y1, v16sf y2, v16sf y3)
+{
+    v16sf t0 = _mm512_unpacklo_ps(y0, y1);
+    v16sf t1 = _mm512_unpackhi_ps(y0, y1);
+    v16sf t2 = _mm512_unpacklo_ps(y2, y3);
+    v16sf t3 = _mm512_unpackhi_ps(y2, y3);
+    // 4x4 transposes inside the 128 bits lanes
+    v16sf r0 = _mm512_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+    v16sf r1 = _mm512_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    v16sf r2 = _mm512_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    v16sf r3 = _mm512_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    fft_store4_lanes512f(dst, r0, r1, r2, r3);
+}
+
+// dst[16p + 4r + q] = yr[4p + q]
+static inline void fft_store4_s4_512f(float *dst, v16sf y0, v16sf y1, v16sf y2, v16sf y3)
+{
+    fft_store4_lanes512f(dst, y0, y1, y2, y3);
+}
+
+
+static inline v16sf fft_reverse512f(v16sf a)
+{
+    return _mm512_permutexvar_ps(_mm512_set_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), a);
+}
+
+static inline void fft_radix4_stage512f(const fft_plan32_t *plan, int s, const float *xr, const float *xi, float *yr, float *yi)
+{
+    int n4 = plan->n / 4;
+    v16sf w[6], y[8];
+
+    if (s >= AVX512_LEN_FLOAT) {
+        const float *tw = fft_stage_twf(plan, s);
+        for (int p = 0; p < n4 / s; p++) {
+            for (int r = 0; r < 6; r++)
+                w[r] = _mm512_set1_ps(tw[6 * p + r]);
+            for (int q = 0; q < s; q += AVX512_LEN_FLOAT) {
+                int out = q + 4 * s * p;
+                fft_radix4_512f(xr, xi, q + s * p, n4, w, y);
+                for (int r = 0; r < 4; r++) {
+                    _mm512_storeu_ps(yr + out + r * s, y[2 * r]);
+                    _mm512_storeu_ps(yi + out + r * s, y[2 * r + 1]);
+                }
+            }
+        }
+    } else {
+        // strides smaller than a vector : twiddles per point, the 4 outputs are interleaved by chunks of s
+        const float *twx = plan->twx + ((s == 1) ? 0 : 6 * n4);
+        for (int idx = 0; idx < n4; idx += AVX512_LEN_FLOAT) {
+            for (int r = 0; r < 6; r++)
+                w[r] = _mm512_loadu_ps(twx + r * n4 + idx);
+            fft_radix4_512f(xr, xi, idx, n4, w, y);
+            for (int r = 0; r < 2; r++) {
+                if (s == 1)
+                    fft_store4_s1_512f((r ? yi : yr) + 4 * idx, y[r], y[2 + r], y[4 + r], y[6 + r]);
+                else
+                    fft_store4_s4_512f((r ? yi : yr) + 4 * idx, y[r], y[2 + r], y[4 + r], y[6 + r]);
+            }
+        }
+    }
+}
+
+// last stage when log2(n) is odd, stride n/2 and no twiddles
+static inline void fft_radix2_stage512f(int n, const float *xr, const float *xi, float *yr, float *yi)
+{
+    int n2 = n / 2;
+    for (int q = 0; q < n2; q += AVX512_LEN_FLOAT) {
+        v16sf ar = _mm512_loadu_ps(xr + q), ai = _mm512_loadu_ps(xi + q);
+        v16sf br = _mm512_loadu_ps(xr + q + n2), bi = _mm512_loadu_ps(xi + q + n2);
+        _mm512_storeu_ps(yr + q, _mm512_add_ps(ar, br));
+        _mm512_storeu_ps(yi + q, _mm512_add_ps(ai, bi));
+        _mm512_storeu_ps(yr + q + n2, _mm512_sub_ps(ar, br));
+        _mm512_storeu_ps(yi + q + n2, _mm512_sub_ps(ai, bi));
+    }
+}
+
+static inline void fft_split_core512f(const fft_plan32_t *plan, float *srcRe, float *srcIm, float *dstRe, float *dstIm)
+{
+    int n = plan->n;
+    if ((n / 4) < AVX512_LEN_FLOAT) {
+        fft_split_coref_C(plan, srcRe, srcIm, dstRe, dstIm);
+        return;
+    }
+
+    int nb_stages = plan->log2n / 2 + (plan->log2n & 1);
+    float *xr = srcRe, *xi = srcIm;
+    int s = 1;
+    for (int stage = 0; stage < nb_stages; stage++) {
+        float *yr = fft_stage_outf(plan, stage, nb_stages, dstRe);
+        float *yi = (yr == dstRe) ? dstIm : yr + n;
+        if (s < n / 2 || !(plan->log2n & 1)) {
+            fft_radix4_stage512f(plan, s, xr, xi, yr, yi);
+            s *= 4;
+        } else {
+            fft_radix2_stage512f(n, xr, xi, yr, yi);
+        }
+        xr = yr;
+        xi = yi;
+    }
+}
+
+SIMD_UTILS_API void fft512f_split(fft_plan32_t *plan, float *srcRe, float *srcIm, float *dstRe, float *dstIm)
+{
+    fft_split_core512f(plan, srcRe, srcIm, dstRe, dstIm);
+}
+
+SIMD_UTILS_API void ifft512f_split(fft_plan32_t *plan, float *srcRe, float *srcIm, float *dstRe, float *dstIm)
+{
+    fft_split_core512f(plan, srcIm, srcRe, dstIm, dstRe);
+}
+
+SIMD_UTILS_API void fft512f(fft_plan32_t *plan, complex32_t *src, complex32_t *dst)
+{
+    float *re = plan->work + 4 * plan->n;
+    float *im = re + plan->n;
+    cplxtoreal512f(src, re, im, plan->n);
+    fft_split_core512f(plan, re, im, re, im);
+    realtocplx512f(re, im, dst, plan->n);
+}
+
+SIMD_UTILS_API void ifft512f(fft_plan32_t *plan, complex32_t *src, complex32_t *dst)
+{
+    float *re = plan->work + 4 * plan->n;
+    float *im = re + plan->n;
+    cplxtoreal512f(src, re, im, plan->n);
+    fft_split_core512f(plan, im, re, im, re);
+    realtocplx512f(re, im, dst, plan->n);
+}
+
+// src has plan->real_n points, dst the plan->real_n / 2 + 1 first bins
+SIMD_UTILS_API void rfft512f(fft_plan32_t *plan, float *src, complex32_t *dst)
+{
+    int n = plan->n;
+    float *re = plan->work + 4 * n;
+    float *im = re + n;
+    cplxtoreal512f((complex32_t *) src, re, im, n);
+    fft_split_core512f(plan, re, im, re, im);
+
+    v16sf half = _mm512_set1_ps(0.5f);
+    int k = 1;
+    for (; (k + AVX512_LEN_FLOAT) <= n; k += AVX512_LEN_FLOAT) {
+        v16sf a = _mm512_loadu_ps(re + k), b = _mm512_loadu_ps(im + k);
+        v16sf c = fft_reverse512f(_mm512_loadu_ps(re + n - k - AVX512_LEN_FLOAT + 1));
+        v16sf d = fft_reverse512f(_mm512_loadu_ps(im + n - k - AVX512_LEN_FLOAT + 1));
+        v16sf wr = _mm512_loadu_ps(plan->rtw + k), wi = _mm512_loadu_ps(plan->rtw + n + k);
+        v16sf hs = _mm512_add_ps(a, c), hd = _mm512_sub_ps(b, d);
+        v16sf fr = _mm512_add_ps(b, d), fi = _mm512_sub_ps(c, a);
+        v16sfx2 out;
+        out.val[0] = _mm512_mul_ps(half, _mm512_fnmadd_ps_custom(wi, fi, _mm512_fmadd_ps_custom(wr, fr, hs)));
+        out.val[1] = _mm512_mul_ps(half, _mm512_fmadd_ps_custom(wi, fr, _mm512_fmadd_ps_custom(wr, fi, hd)));
+        _mm512_store2u_ps((float *) (dst + k), out);
+    }
+    rfft_postf_C(plan, re, im, dst, k);
+}
+
+// src has the plan->real_n / 2 + 1 first bins, dst plan->real_n points, not normalized
+SIMD_UTILS_API void irfft512f(fft_plan32_t *plan, complex32_t *src, float *dst)
+{
+    int n = plan->n;
+    float *re = plan->work + 4 * n;
+    float *im = re + n;
+
+    int k = 0;
+    for (; (k + AVX512_LEN_FLOAT) <= n; k += AVX512_LEN_FLOAT) {
+        v16sfx2 x = _mm512_load2u_ps((float *) (src + k));
+        v16sfx2 xc = _mm512_load2u_ps((float *) (src + n - k - AVX512_LEN_FLOAT + 1));
+        v16sf c = fft_reverse512f(xc.val[0]), d = fft_reverse512f(xc.val[1]);
+        v16sf wr = _mm512_loadu_ps(plan->rtw + k), wi = _mm512_loadu_ps(plan->rtw + n + k);
+        v16sf amc = _mm512_sub_ps(x.val[0], c), bpd = _mm512_add_ps(x.val[1], d);
+        v16sf zr = _mm512_fnmadd_ps_custom(bpd, wr, _mm512_add_ps(x.val[0], c));
+        v16sf zi = _mm512_fmadd_ps_custom(amc, wr, _mm512_sub_ps(x.val[1], d));
+        _mm512_storeu_ps(re + k, _mm512_fmadd_ps_custom(amc, wi, zr));
+        _mm512_storeu_ps(im + k, _mm512_fmadd_ps_custom(bpd, wi, zi));
+    }
+    irfft_pref_C(plan, src, re, im, k);
+
+    fft_split_core512f(plan, im, re, im, re);
+    realtocplx512f(re, im, (complex32_t *) dst, n);
+}
+
+/* FIR filters (see simd_utils_fir.h) */
+
+// dst[i] = (dst[i] if accumulate) + sum_m taps[m] * src[i + m]
+// 8 vectors of outputs per pass on the taps, enough independent FMAs to hide their latency
+static inline void fir_kernel512f(const float *taps, int nb_taps, const float *src, float *dst, int len, int accumulate)
+{
+    int i = 0;
+    for (; (i + 8 * AVX512_LEN_FLOAT) <= len; i += 8 * AVX512_LEN_FLOAT) {
+        v16sf acc[8];
+        for (int k = 0; k < 8; k++)
+            acc[k] = accumulate ? _mm512_loadu_ps(dst + i + k * AVX512_LEN_FLOAT) : _mm512_setzero_ps();
+        const float *s = src + i;
+        int m = 0;
+        /* 4 taps spaced by one vector per step : the vectors loaded for a tap are reused
+         * by the next ones (11 loads for 32 FMAs instead of one load per FMA) */
+        for (; (m + 4 * AVX512_LEN_FLOAT) <= nb_taps; m += 4 * AVX512_LEN_FLOAT) {
+            for (int r = 0; r < AVX512_LEN_FLOAT; r++) {
+                const float *b = s + m + r;
+                v16sf tap[4], in[11];
+                for (int g = 0; g < 4; g++)
+                    tap[g] = _mm512_set1_ps(taps[m + r + g * AVX512_LEN_FLOAT]);
+                for (int k = 0; k < 11; k++)
+                    in[k] = _mm512_loadu_ps(b + k * AVX512_LEN_FLOAT);
+                for (int k = 0; k < 8; k++) {
+                    acc[k] = _mm512_fmadd_ps_custom(tap[0], in[k], acc[k]);
+                    acc[k] = _mm512_fmadd_ps_custom(tap[1], in[k + 1], acc[k]);
+                    acc[k] = _mm512_fmadd_ps_custom(tap[2], in[k + 2], acc[k]);
+                    acc[k] = _mm512_fmadd_ps_custom(tap[3], in[k + 3], acc[k]);
+                }
+            }
+        }
+        for (; m < nb_taps; m++) {
+            v16sf tap = _mm512_set1_ps(taps[m]);
+            acc[0] = _mm512_fmadd_ps_custom(tap, _mm512_loadu_ps(s + m), acc[0]);
+            acc[1] = _mm512_fmadd_ps_custom(tap, _mm512_loadu_ps(s + m + AVX512_LEN_FLOAT), acc[1]);
+            acc[2] = _mm512_fmadd_ps_custom(tap, _mm512_loadu_ps(s + m + 2 * AVX512_LEN_FLOAT), acc[2]);
+            acc[3] = _mm512_fmadd_ps_custom(tap, _mm512_loadu_ps(s + m + 3 * AVX512_LEN_FLOAT), acc[3]);
+            acc[4] = _mm512_fmadd_ps_custom(tap, _mm512_loadu_ps(s + m + 4 * AVX512_LEN_FLOAT), acc[4]);
+            acc[5] = _mm512_fmadd_ps_custom(tap, _mm512_loadu_ps(s + m + 5 * AVX512_LEN_FLOAT), acc[5]);
+            acc[6] = _mm512_fmadd_ps_custom(tap, _mm512_loadu_ps(s + m + 6 * AVX512_LEN_FLOAT), acc[6]);
+            acc[7] = _mm512_fmadd_ps_custom(tap, _mm512_loadu_ps(s + m + 7 * AVX512_LEN_FLOAT), acc[7]);
+        }
+        for (int k = 0; k < 8; k++)
+            _mm512_storeu_ps(dst + i + k * AVX512_LEN_FLOAT, acc[k]);
+    }
+
+    for (; (i + AVX512_LEN_FLOAT) <= len; i += AVX512_LEN_FLOAT) {
+        v16sf acc = accumulate ? _mm512_loadu_ps(dst + i) : _mm512_setzero_ps();
+        for (int m = 0; m < nb_taps; m++)
+            acc = _mm512_fmadd_ps_custom(_mm512_set1_ps(taps[m]), _mm512_loadu_ps(src + i + m), acc);
+        _mm512_storeu_ps(dst + i, acc);
+    }
+
+    if (i < len) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16sf acc = accumulate ? _mm512_maskz_loadu_ps(mask, dst + i) : _mm512_setzero_ps();
+        for (int m = 0; m < nb_taps; m++)
+            acc = _mm512_fmadd_ps_custom(_mm512_set1_ps(taps[m]), _mm512_maskz_loadu_ps(mask, src + i + m), acc);
+        _mm512_mask_storeu_ps(dst + i, mask, acc);
+    }
+}
+
+// complex taps (real parts then imaginary parts) on interleaved complex samples
+static inline void fir_kernel512f_cplx(const float *taps, int nb_taps, const float *src, float *dst, int len, int accumulate)
+{
+    const float *taps_im = taps + nb_taps;
+    int i = 0;
+    // dst = sum taps_re * src + j * sum taps_im * src
+    for (; (i + AVX512_LEN_FLOAT) <= len; i += AVX512_LEN_FLOAT) {
+        v16sf re0 = _mm512_setzero_ps(), re1 = _mm512_setzero_ps();
+        v16sf im0 = _mm512_setzero_ps(), im1 = _mm512_setzero_ps();
+        const float *s = src + 2 * i;
+        for (int m = 0; m < nb_taps; m++) {
+            v16sf tap_re = _mm512_set1_ps(taps[m]);
+            v16sf tap_im = _mm512_set1_ps(taps_im[m]);
+            v16sf s0 = _mm512_loadu_ps(s + 2 * m);
+            v16sf s1 = _mm512_loadu_ps(s + 2 * m + AVX512_LEN_FLOAT);
+            re0 = _mm512_fmadd_ps_custom(tap_re, s0, re0);
+            re1 = _mm512_fmadd_ps_custom(tap_re, s1, re1);
+            im0 = _mm512_fmadd_ps_custom(tap_im, s0, im0);
+            im1 = _mm512_fmadd_ps_custom(tap_im, s1, im1);
+        }
+        v16sf out0 = _mm512_fmaddsub_ps(re0, _mm512_set1_ps(1.0f), _mm512_permute_ps(im0, _MM_SHUFFLE(2, 3, 0, 1)));
+        v16sf out1 = _mm512_fmaddsub_ps(re1, _mm512_set1_ps(1.0f), _mm512_permute_ps(im1, _MM_SHUFFLE(2, 3, 0, 1)));
+        if (accumulate) {
+            out0 = _mm512_add_ps(out0, _mm512_loadu_ps(dst + 2 * i));
+            out1 = _mm512_add_ps(out1, _mm512_loadu_ps(dst + 2 * i + AVX512_LEN_FLOAT));
+        }
+        _mm512_storeu_ps(dst + 2 * i, out0);
+        _mm512_storeu_ps(dst + 2 * i + AVX512_LEN_FLOAT, out1);
+    }
+
+    for (; i < len; i += AVX512_LEN_FLOAT / 2) {
+        __mmask16 mask = tail_mask16(2 * (len - i));
+        v16sf re = _mm512_setzero_ps(), im = _mm512_setzero_ps();
+        for (int m = 0; m < nb_taps; m++) {
+            v16sf s = _mm512_maskz_loadu_ps(mask, src + 2 * (i + m));
+            re = _mm512_fmadd_ps_custom(_mm512_set1_ps(taps[m]), s, re);
+            im = _mm512_fmadd_ps_custom(_mm512_set1_ps(taps_im[m]), s, im);
+        }
+        v16sf out = _mm512_fmaddsub_ps(re, _mm512_set1_ps(1.0f), _mm512_permute_ps(im, _MM_SHUFFLE(2, 3, 0, 1)));
+        if (accumulate)
+            out = _mm512_add_ps(out, _mm512_maskz_loadu_ps(mask, dst + 2 * i));
+        _mm512_mask_storeu_ps(dst + 2 * i, mask, out);
+    }
+}
+
+// returns the number of outputs, -1 if fir is a complex filter
+SIMD_UTILS_API int fir512f(fir32_t *fir, float *src, float *dst, int len)
+{
+    if (fir->cplx)
+        return -1;
+    return fir_runf(fir, fir_kernel512f, src, NULL, dst, NULL, len);
+}
+
+SIMD_UTILS_API int fir512f_cplx(fir32_t *fir, complex32_t *src, complex32_t *dst, int len)
+{
+    if (!fir->cplx)
+        return -1;
+    return fir_runf(fir, fir_kernel512f_cplx, (float *) src, NULL, (float *) dst, NULL, len);
+}
+
+SIMD_UTILS_API int fir512f_split(fir32_t *fir, float *srcRe, float *srcIm, float *dstRe, float *dstIm, int len)
+{
+    if (!fir->cplx)
+        return -1;
+    return fir_runf(fir, fir_kernel512f_cplx, srcRe, srcIm, dstRe, dstIm, len);
+}
+
+/* IIR filters (see simd_utils_iir.h) */
+
+// channels c0 to c0 + AVX512_LEN_FLOAT - 1 (those of mask), filtered in lockstep
+static inline void iir_lanes512f(iir32_t *iir, int c0, __mmask16 mask, const float *src, float *dst, int len)
+{
+    int C = iir->nb_channels;
+    int S = iir->stride;
+    for (int i = 0; i < len; i++) {
+        v16sf x = _mm512_maskz_loadu_ps(mask, src + (size_t) i * C + c0);
+        for (int s = 0; s < iir->nb_stages; s++) {
+            const float *c = iir->coefs + (size_t) s * 5 * S + c0;
+            float *z = iir->state + (size_t) s * 2 * S + c0;
+            v16sf y = _mm512_fmadd_ps_custom(_mm512_load_ps(c), x, _mm512_load_ps(z));
+            v16sf z1 = _mm512_fmadd_ps_custom(_mm512_load_ps(c + S), x, _mm512_load_ps(z + S));
+            v16sf z2 = _mm512_mul_ps(_mm512_load_ps(c + 2 * S), x);
+            _mm512_store_ps(z, _mm512_fnmadd_ps_custom(_mm512_load_ps(c + 3 * S), y, z1));
+            _mm512_store_ps(z + S, _mm512_fnmadd_ps_custom(_mm512_load_ps(c + 4 * S), y, z2));
+            x = y;
+        }
+        _mm512_mask_storeu_ps(dst + (size_t) i * C + c0, mask, x);
+    }
+}
+
+/* one channel in the block state space form, blocks of AVX512_LEN_FLOAT frames,
+ * every stage of a block before the next block */
+static inline void iir_ss_kernel512f(iir32_t *iir, int channel, const float *src, float *dst, int len)
+{
+    int C = iir->stride;
+    int i = 0;
+    for (; (i + AVX512_LEN_FLOAT) <= len; i += AVX512_LEN_FLOAT) {
+        for (int s = 0; s < iir->nb_stages; s++) {
+            const float *x = (s ? dst : src) + i;
+            const float *m = iir32_ss(iir, s, channel);
+            const float *z = iir->state + (size_t) s * 2 * C + channel;
+            float x1 = x[AVX512_LEN_FLOAT - 1], x2 = x[AVX512_LEN_FLOAT - 2];
+            // D * x, by columns
+            v16sf acc0 = _mm512_mul_ps(_mm512_load_ps(m), _mm512_set1_ps(x[0]));
+            v16sf acc1 = _mm512_mul_ps(_mm512_load_ps(m + IIR_SS_LEN), _mm512_set1_ps(x[1]));
+            for (int j = 2; j < AVX512_LEN_FLOAT; j += 2) {
+                acc0 = _mm512_fmadd_ps_custom(_mm512_load_ps(m + j * IIR_SS_LEN), _mm512_set1_ps(x[j]), acc0);
+                acc1 = _mm512_fmadd_ps_custom(_mm512_load_ps(m + (j + 1) * IIR_SS_LEN), _mm512_set1_ps(x[j + 1]), acc1);
+            }
+            // + c1 * z1 + c2 * z2
+            v16sf y = _mm512_fmadd_ps_custom(_mm512_load_ps(m + IIR_SS_LEN * IIR_SS_LEN), _mm512_set1_ps(z[0]), _mm512_add_ps(acc0, acc1));
+            y = _mm512_fmadd_ps_custom(_mm512_load_ps(m + (IIR_SS_LEN + 1) * IIR_SS_LEN), _mm512_set1_ps(z[C]), y);
+            _mm512_storeu_ps(dst + i, y);
+            iir_ss_update(iir, s, channel, x1, x2, dst[i + AVX512_LEN_FLOAT - 1], dst[i + AVX512_LEN_FLOAT - 2]);
+        }
+    }
+
+    if (i < len) {
+        for (int s = 0; s < iir->nb_stages; s++)
+            iir_biquadf_C(iir, s, channel, (s ? dst : src) + i, dst + i, len - i, 1);
+    }
+}
+
+/* len frames of nb_channels interleaved channels, src and dst can be the same array.
+ * Groups of channels are filtered in lockstep, the remaining ones (or a single
+ * channel) in the block state space form. */
+SIMD_UTILS_API void iir512f(iir32_t *iir, float *src, float *dst, int len)
+{
+    int C = iir->nb_channels;
+    int c = 0;
+    if (C > 1) {
+        for (; (c + AVX512_LEN_FLOAT) <= C; c += AVX512_LEN_FLOAT)
+            iir_lanes512f(iir, c, 0xFFFF, src, dst, len);
+        // a masked vector for 4 remaining channels or more, the state space form below
+        if ((C - c) >= 4) {
+            iir_lanes512f(iir, c, tail_mask16(C - c), src, dst, len);
+            c = C;
+        }
+    }
+    for (; c < C; c++)
+        iir_ss_runf(iir, iir_ss_kernel512f, c, src, dst, len);
+}
+
+/* Convolutions (see simd_utils_conv.h) */
+
+static inline void conv_block512f(conv32_t *conv)
+{
+    if (conv->cplx) {
+        fft512f(conv->plan, (complex32_t *) conv->buf, (complex32_t *) conv->work);
+        cplxvecmul512f((complex32_t *) conv->work, (complex32_t *) conv->spectrum, (complex32_t *) conv->out, conv->fft_len);
+        ifft512f(conv->plan, (complex32_t *) conv->out, (complex32_t *) conv->out);
+    } else {
+        rfft512f(conv->plan, conv->buf, (complex32_t *) conv->work);
+        cplxvecmul512f((complex32_t *) conv->work, (complex32_t *) conv->spectrum, (complex32_t *) conv->out, conv->fft_len / 2 + 1);
+        irfft512f(conv->plan, (complex32_t *) conv->out, conv->out);
+    }
+}
+
+// returns len, -1 if conv is a complex convolution
+SIMD_UTILS_API int conv512f(conv32_t *conv, float *src, float *dst, int len)
+{
+    if (conv->cplx)
+        return -1;
+    return conv_runf(conv, fir_kernel512f, conv_block512f, src, dst, len);
+}
+
+SIMD_UTILS_API int conv512f_cplx(conv32_t *conv, complex32_t *src, complex32_t *dst, int len)
+{
+    if (!conv->cplx)
+        return -1;
+    return conv_runf(conv, fir_kernel512f_cplx, conv_block512f, (float *) src, (float *) dst, len);
+}
+
+// first index of value in src, len if it is not found
+static inline int firsteq512f(float *src, int len, float value)
+{
+    int stop_len = len / (2 * AVX512_LEN_FLOAT);
+    stop_len *= (2 * AVX512_LEN_FLOAT);
+
+    v16sf value_v = _mm512_set1_ps(value);
+    for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_FLOAT) {
+        uint32_t mask = (uint32_t) _mm512_cmp_ps_mask(_mm512_loadu_ps(src + i), value_v, _CMP_EQ_OQ);
+        mask |= (uint32_t) _mm512_cmp_ps_mask(_mm512_loadu_ps(src + i + AVX512_LEN_FLOAT), value_v, _CMP_EQ_OQ) << 16;
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+    for (int i = stop_len; i < len; i += AVX512_LEN_FLOAT) {
+        __mmask16 tail = tail_mask16(len - i);
+        __mmask16 mask = _mm512_mask_cmp_ps_mask(tail, _mm512_maskz_loadu_ps(tail, src + i), value_v, _CMP_EQ_OQ);
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+    return len;
+}
+
+SIMD_UTILS_API void maxloc512f(float *src, float *max, int *idx, int len)
+{
+    minmaxloc_runf(src, len, minmax512f, firsteq512f, NULL, NULL, max, idx);
+}
+
+SIMD_UTILS_API void minloc512f(float *src, float *min, int *idx, int len)
+{
+    minmaxloc_runf(src, len, minmax512f, firsteq512f, min, idx, NULL, NULL);
+}
+
+SIMD_UTILS_API void minmaxloc512f(float *src, int len, float *min_value, int *min_idx, float *max_value, int *max_idx)
+{
+    minmaxloc_runf(src, len, minmax512f, firsteq512f, min_value, min_idx, max_value, max_idx);
+}
@@ -9,7 +9,7 @@
 #include <stdint.h>
 #include "immintrin.h"
 
-static inline void add512s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+SIMD_UTILS_API void add512s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
 {
     int stop_len = len / AVX512_LEN_INT32;
     stop_len *= AVX512_LEN_INT32;
@@ -26,13 +26,14 @@ static inline void add512s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src1[i] + src2[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT32) {
+        __mmask16 mask = tail_mask16(len - i);
+        _mm512_mask_storeu_epi32(dst + i, mask, _mm512_add_epi32(_mm512_maskz_loadu_epi32(mask, src1 + i), _mm512_maskz_loadu_epi32(mask, src2 + i)));
     }
 }
 
 // Works only for Integers stored on 32bits smaller than 16bits
-static inline void mul512s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+SIMD_UTILS_API void mul512s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
 {
     int stop_len = len / (2 * AVX512_LEN_INT32);
     stop_len *= (2 * AVX512_LEN_INT32);
@@ -61,12 +62,16 @@ static inline void mul512s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src1[i] * src2[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT32) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16si src1_tmp = _mm512_maskz_loadu_epi32(mask, src1 + i);
+        v16si src2_tmp = _mm512_maskz_loadu_epi32(mask, src2 + i);
+        v16si tmp = _mm512_mullo_epi32(src1_tmp, src2_tmp);
+        _mm512_mask_storeu_epi32(dst + i, mask, tmp);
     }
 }
 
-static inline void sub512s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+SIMD_UTILS_API void sub512s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
 {
     int stop_len = len / AVX512_LEN_INT32;
     stop_len *= AVX512_LEN_INT32;
@@ -83,12 +88,13 @@ static inline void sub512s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src1[i] - src2[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT32) {
+        __mmask16 mask = tail_mask16(len - i);
+        _mm512_mask_storeu_epi32(dst + i, mask, _mm512_sub_epi32(_mm512_maskz_loadu_epi32(mask, src1 + i), _mm512_maskz_loadu_epi32(mask, src2 + i)));
     }
 }
 
-static inline void addc512s(int32_t *src, int32_t value, int32_t *dst, int len)
+SIMD_UTILS_API void addc512s(int32_t *src, int32_t value, int32_t *dst, int len)
 {
     int stop_len = len / AVX512_LEN_INT32;
     stop_len *= AVX512_LEN_INT32;
@@ -105,12 +111,13 @@ static inline void addc512s(int32_t *src, int32_t value, int32_t *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src[i] + value;
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT32) {
+        __mmask16 mask = tail_mask16(len - i);
+        _mm512_mask_storeu_epi32(dst + i, mask, _mm512_add_epi32(tmp, _mm512_maskz_loadu_epi32(mask, src + i)));
     }
 }
 
-static inline void vectorSlope512s(int *dst, int len, int offset, int slope)
+SIMD_UTILS_API void vectorSlope512s(int *dst, int len, int offset, int slope)
 {
     v16si coef = _mm512_set_epi32(15 * slope, 14 * slope, 13 * slope, 12 * slope,
                                   11 * slope, 10 * slope, 9 * slope, 8 * slope,
@@ -150,13 +157,16 @@ static inline void vectorSlope512s(int *dst, int len, int offset, int slope)
 		}
 	}
 	
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = offset + slope * i;
+    v16si index = _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT32) {
+        v16si pos = _mm512_add_epi32(_mm512_set1_epi32(i), index);
+        v16si dst_tmp = _mm512_add_epi32(_mm512_set1_epi32(offset), _mm512_mullo_epi32(pos, _mm512_set1_epi32(slope)));
+        _mm512_mask_storeu_epi32(dst + i, tail_mask16(len - i), dst_tmp);
     }
 }
 
 // Experimental
-static inline void copy512s(int32_t *src, int32_t *dst, int len)
+SIMD_UTILS_API void copy512s(int32_t *src, int32_t *dst, int len)
 {
     int stop_len = len / AVX512_LEN_INT32;
     stop_len *= AVX512_LEN_INT32;
@@ -177,12 +187,13 @@ static inline void copy512s(int32_t *src, int32_t *dst, int len)
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT32) {
+        __mmask16 mask = tail_mask16(len - i);
+        _mm512_mask_storeu_epi32(dst + i, mask, _mm512_maskz_loadu_epi32(mask, src + i));
     }
 }
 
-static inline void copy512s_2(int32_t *src, int32_t *dst, int len)
+SIMD_UTILS_API void copy512s_2(int32_t *src, int32_t *dst, int len)
 {
     int stop_len = len / (2 * AVX512_LEN_INT32);
     stop_len *= (2 * AVX512_LEN_INT32);
@@ -214,13 +225,21 @@ static inline void copy512s_2(int32_t *src, int32_t *dst, int len)
 #endif
 
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT32) {
+        __mmask16 mask = tail_mask16(len - i);
+        __m512i tmp1 = _mm512_maskz_loadu_epi32(mask, src + i);
+        _mm512_mask_storeu_epi32(dst + i, mask, tmp1);
     }
 }
 
-static inline void fast_copy512s(int32_t *src, int32_t *dst, int len)
+SIMD_UTILS_API void fast_copy512s(int32_t *src, int32_t *dst, int len)
 {
+    // the streaming loads and stores need aligned pointers
+    if (!areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        copy512s(src, dst, len);
+        return;
+    }
+
     int stop_len = len / AVX512_LEN_INT32;
     stop_len *= AVX512_LEN_INT32;
 
@@ -228,18 +247,26 @@ static inline void fast_copy512s(int32_t *src, int32_t *dst, int len)
 #pragma omp parallel for schedule(auto)
 #endif
     for (int i = 0; i < stop_len; i += AVX512_LEN_INT32) {
-        _mm512_stream_si512((__m512i *) (dst + i), _mm512_stream_load_si512((__m512i *) (src + i)));
+        __m512i tmp1 = _mm512_stream_load_si512((__m512i *) (src + i));
+        _mm512_stream_si512((__m512i *) (dst + i), tmp1);
     }
-    _mm_mfence();
+    _mm_sfence();
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT32) {
+        __mmask16 mask = tail_mask16(len - i);
+        _mm512_mask_storeu_epi32(dst + i, mask, _mm512_maskz_loadu_epi32(mask, src + i));
     }
 }
 
 
-static inline void fast_copy512s_2(int32_t *src, int32_t *dst, int len)
+SIMD_UTILS_API void fast_copy512s_2(int32_t *src, int32_t *dst, int len)
 {
+    // the streaming loads and stores need aligned pointers
+    if (!areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        copy512s(src, dst, len);
+        return;
+    }
+
     int stop_len = len / (2 * AVX512_LEN_INT32);
     stop_len *= (2 * AVX512_LEN_INT32);
 
@@ -252,15 +279,22 @@ static inline void fast_copy512s_2(int32_t *src, int32_t *dst, int len)
         _mm512_stream_si512((__m512i *) (dst + i), tmp1);
         _mm512_stream_si512((__m512i *) (dst + i + AVX512_LEN_INT32), tmp2);
     }
-    _mm_mfence();
+    _mm_sfence();
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT32) {
+        __mmask16 mask = tail_mask16(len - i);
+        _mm512_mask_storeu_epi32(dst + i, mask, _mm512_maskz_loadu_epi32(mask, src + i));
     }
 }
 
-static inline void fast_copy512s_4(int32_t *src, int32_t *dst, int len)
+SIMD_UTILS_API void fast_copy512s_4(int32_t *src, int32_t *dst, int len)
 {
+    // the streaming loads and stores need aligned pointers
+    if (!areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        copy512s(src, dst, len);
+        return;
+    }
+
     int stop_len = len / (4 * AVX512_LEN_INT32);
     stop_len *= (4 * AVX512_LEN_INT32);
 
@@ -277,10 +311,11 @@ static inline void fast_copy512s_4(int32_t *src, int32_t *dst, int len)
         _mm512_stream_si512((__m512i *) (dst + i + 2 * AVX512_LEN_INT32), tmp3);
         _mm512_stream_si512((__m512i *) (dst + i + 3 * AVX512_LEN_INT32), tmp4);
     }
-    _mm_mfence();
+    _mm_sfence();
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT32) {
+        __mmask16 mask = tail_mask16(len - i);
+        _mm512_mask_storeu_epi32(dst + i, mask, _mm512_maskz_loadu_epi32(mask, src + i));
     }
 }
 
@@ -338,7 +373,7 @@ static inline __m512i _mm512_absdiff_epi8(__m512i a, __m512i b)
 #endif
 }
 
-static inline void absdiff16s_512s(int16_t *src1, int16_t *src2, int16_t *dst, int len)
+SIMD_UTILS_API void absdiff16s_512s(int16_t *src1, int16_t *src2, int16_t *dst, int len)
 {
     int stop_len = len / AVX512_LEN_INT16;
     stop_len *= AVX512_LEN_INT16;
@@ -358,309 +393,1542 @@ static inline void absdiff16s_512s(int16_t *src1, int16_t *src2, int16_t *dst, i
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = abs(src1[i] - src2[i]);
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT16) {
+        __mmask32 mask = tail_mask32(len - i);
+        __m512i a = _mm512_maskz_loadu_epi16(mask, src1 + i);
+        __m512i b = _mm512_maskz_loadu_epi16(mask, src2 + i);
+        _mm512_mask_storeu_epi16(dst + i, mask, _mm512_absdiff_epi16(a, b));
     }
 }
 
-static inline void powerspect16s_512s_interleaved(complex16s_t *src, int32_t *dst, int len)
+SIMD_UTILS_API void addsat16s_512s(int16_t *src1, int16_t *src2, int16_t *dst, int len)
 {
-    int stop_len = len / AVX512_LEN_INT32;
-    stop_len *= AVX512_LEN_INT32;
+    int stop_len = len / (2 * AVX512_LEN_INT16);
+    stop_len *= (2 * AVX512_LEN_INT16);
 
-    int j = 0;
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX512_LEN_INT32) {
-            __m512i reim = _mm512_load_si512((__m512i *) ((const int16_t *) src + j));
-            _mm512_store_si512((__m512i *) (dst + i), _mm512_madd_epi16(reim, reim));
-            j += AVX512_LEN_INT16;
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT16) {
+            v16si a = _mm512_load_si512((__m512i *) (src1 + i));
+            v16si b = _mm512_load_si512((__m512i *) (src2 + i));
+            v16si a2 = _mm512_load_si512((__m512i *) (src1 + i + AVX512_LEN_INT16));
+            v16si b2 = _mm512_load_si512((__m512i *) (src2 + i + AVX512_LEN_INT16));
+            v16si res = _mm512_adds_epi16(a, b);
+            v16si res2 = _mm512_adds_epi16(a2, b2);
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT16), res2);
         }
     } else {
-        for (int i = 0; i < stop_len; i += AVX512_LEN_INT32) {
-            __m512i reim = _mm512_loadu_si512((__m512i *) ((const int16_t *) src + j));
-            _mm512_storeu_si512((__m512i *) (dst + i), _mm512_madd_epi16(reim, reim));
-            j += AVX512_LEN_INT16;
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT16) {
+            v16si a = _mm512_loadu_si512((__m512i *) (src1 + i));
+            v16si b = _mm512_loadu_si512((__m512i *) (src2 + i));
+            v16si a2 = _mm512_loadu_si512((__m512i *) (src1 + i + AVX512_LEN_INT16));
+            v16si b2 = _mm512_loadu_si512((__m512i *) (src2 + i + AVX512_LEN_INT16));
+            v16si res = _mm512_adds_epi16(a, b);
+            v16si res2 = _mm512_adds_epi16(a2, b2);
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT16), res2);
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = (int32_t) src[i].re * (int32_t) src[i].re + (int32_t) src[i].im * (int32_t) src[i].im;
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT16) {
+        __mmask32 mask = tail_mask32(len - i);
+        v16si a = _mm512_maskz_loadu_epi16(mask, src1 + i);
+        v16si b = _mm512_maskz_loadu_epi16(mask, src2 + i);
+        v16si res = _mm512_adds_epi16(a, b);
+        _mm512_mask_storeu_epi16(dst + i, mask, res);
     }
 }
 
-static inline void sum16s32s512(int16_t *src, int len, int32_t *dst, int scale_factor)
+SIMD_UTILS_API void subsat16s_512s(int16_t *src1, int16_t *src2, int16_t *dst, int len)
 {
-    int stop_len = len / (4 * AVX512_LEN_INT16);
-    stop_len *= (4 * AVX512_LEN_INT16);
-
-    __attribute__((aligned(AVX512_LEN_BYTES))) int32_t accumulate[AVX512_LEN_INT32] = {
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-    };
-    int32_t tmp_acc = 0;
-    int16_t scale = 1 << scale_factor;
-    v16si one = _mm512_set1_epi16(1);
-    v16si vec_acc1 = _mm512_setzero_si512();  // initialize the vector accumulator
-    v16si vec_acc2 = _mm512_setzero_si512();  // initialize the vector accumulator
+    int stop_len = len / (2 * AVX512_LEN_INT16);
+    stop_len *= (2 * AVX512_LEN_INT16);
 
-    if (isAligned((uintptr_t) (src), AVX512_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 4 * AVX512_LEN_INT16) {
-            v16si vec_src_tmp = _mm512_load_si512((__m512i *) ((const int16_t *) src + i));
-            v16si vec_src_tmp2 = _mm512_load_si512((__m512i *) ((const int16_t *) src + i + AVX512_LEN_INT16));
-            v16si vec_src_tmp3 = _mm512_load_si512((__m512i *) ((const int16_t *) src + i + 2 * AVX512_LEN_INT16));
-            v16si vec_src_tmp4 = _mm512_load_si512((__m512i *) ((const int16_t *) src + i + 3 * AVX512_LEN_INT16));
-            vec_src_tmp = _mm512_madd_epi16(vec_src_tmp, one);
-            vec_src_tmp2 = _mm512_madd_epi16(vec_src_tmp2, one);
-            vec_src_tmp3 = _mm512_madd_epi16(vec_src_tmp3, one);
-            vec_src_tmp4 = _mm512_madd_epi16(vec_src_tmp4, one);
-            vec_src_tmp = _mm512_add_epi32(vec_src_tmp, vec_src_tmp2);
-            vec_src_tmp3 = _mm512_add_epi32(vec_src_tmp3, vec_src_tmp4);
-            vec_acc1 = _mm512_add_epi32(vec_src_tmp, vec_acc1);
-            vec_acc2 = _mm512_add_epi32(vec_src_tmp3, vec_acc2);
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT16) {
+            v16si a = _mm512_load_si512((__m512i *) (src1 + i));
+            v16si b = _mm512_load_si512((__m512i *) (src2 + i));
+            v16si a2 = _mm512_load_si512((__m512i *) (src1 + i + AVX512_LEN_INT16));
+            v16si b2 = _mm512_load_si512((__m512i *) (src2 + i + AVX512_LEN_INT16));
+            v16si res = _mm512_subs_epi16(a, b);
+            v16si res2 = _mm512_subs_epi16(a2, b2);
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT16), res2);
         }
     } else {
-        for (int i = 0; i < stop_len; i += 4 * AVX512_LEN_INT16) {
-            v16si vec_src_tmp = _mm512_loadu_si512((__m512i *) ((const int16_t *) src + i));
-            v16si vec_src_tmp2 = _mm512_loadu_si512((__m512i *) ((const int16_t *) src + i + AVX512_LEN_INT16));
-            v16si vec_src_tmp3 = _mm512_loadu_si512((__m512i *) ((const int16_t *) src + i + 2 * AVX512_LEN_INT16));
-            v16si vec_src_tmp4 = _mm512_loadu_si512((__m512i *) ((const int16_t *) src + i + 3 * AVX512_LEN_INT16));
-            vec_src_tmp = _mm512_madd_epi16(vec_src_tmp, one);
-            vec_src_tmp2 = _mm512_madd_epi16(vec_src_tmp2, one);
-            vec_src_tmp3 = _mm512_madd_epi16(vec_src_tmp3, one);
-            vec_src_tmp4 = _mm512_madd_epi16(vec_src_tmp4, one);
-            vec_src_tmp = _mm512_add_epi32(vec_src_tmp, vec_src_tmp2);
-            vec_src_tmp3 = _mm512_add_epi32(vec_src_tmp3, vec_src_tmp4);
-            vec_acc1 = _mm512_add_epi32(vec_src_tmp, vec_acc1);
-            vec_acc2 = _mm512_add_epi32(vec_src_tmp3, vec_acc2);
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT16) {
+            v16si a = _mm512_loadu_si512((__m512i *) (src1 + i));
+            v16si b = _mm512_loadu_si512((__m512i *) (src2 + i));
+            v16si a2 = _mm512_loadu_si512((__m512i *) (src1 + i + AVX512_LEN_INT16));
+            v16si b2 = _mm512_loadu_si512((__m512i *) (src2 + i + AVX512_LEN_INT16));
+            v16si res = _mm512_subs_epi16(a, b);
+            v16si res2 = _mm512_subs_epi16(a2, b2);
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT16), res2);
         }
     }
 
-    vec_acc1 = _mm512_add_epi32(vec_acc1, vec_acc2);
-    _mm512_store_si512((v16si *) accumulate, vec_acc1);
-
-    for (int i = stop_len; i < len; i++) {
-        tmp_acc += (int32_t) src[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT16) {
+        __mmask32 mask = tail_mask32(len - i);
+        v16si a = _mm512_maskz_loadu_epi16(mask, src1 + i);
+        v16si b = _mm512_maskz_loadu_epi16(mask, src2 + i);
+        v16si res = _mm512_subs_epi16(a, b);
+        _mm512_mask_storeu_epi16(dst + i, mask, res);
     }
-
-    tmp_acc = tmp_acc + accumulate[0] + accumulate[1] + accumulate[2] + accumulate[3] +
-              accumulate[4] + accumulate[5] + accumulate[6] + accumulate[7] +
-              accumulate[8] + accumulate[9] + accumulate[10] + accumulate[11] +
-              accumulate[12] + accumulate[13] + accumulate[14] + accumulate[15];
-    tmp_acc /= scale;
-    *dst = tmp_acc;
 }
 
-static inline void flip512s(int32_t *src, int32_t *dst, int len)
+// high 16 bits of the 32 bits products
+SIMD_UTILS_API void mulhi16s_512s(int16_t *src1, int16_t *src2, int16_t *dst, int len)
 {
-    int stop_len = len / (2 * AVX512_LEN_INT32);
-    stop_len *= (2 * AVX512_LEN_INT32);
-    v16si flip_idx = _mm512_set_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    int stop_len = len / (2 * AVX512_LEN_INT16);
+    stop_len *= (2 * AVX512_LEN_INT16);
 
-    int mini = ((len - 1) < (2 * AVX512_LEN_INT32)) ? (len - 1) : (2 * AVX512_LEN_INT32);
-    for (int i = 0; i < mini; i++) {
-        dst[len - i - 1] = src[i];
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT16) {
+            v16si a = _mm512_load_si512((__m512i *) (src1 + i));
+            v16si b = _mm512_load_si512((__m512i *) (src2 + i));
+            v16si a2 = _mm512_load_si512((__m512i *) (src1 + i + AVX512_LEN_INT16));
+            v16si b2 = _mm512_load_si512((__m512i *) (src2 + i + AVX512_LEN_INT16));
+            v16si res = _mm512_mulhi_epi16(a, b);
+            v16si res2 = _mm512_mulhi_epi16(a2, b2);
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT16), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT16) {
+            v16si a = _mm512_loadu_si512((__m512i *) (src1 + i));
+            v16si b = _mm512_loadu_si512((__m512i *) (src2 + i));
+            v16si a2 = _mm512_loadu_si512((__m512i *) (src1 + i + AVX512_LEN_INT16));
+            v16si b2 = _mm512_loadu_si512((__m512i *) (src2 + i + AVX512_LEN_INT16));
+            v16si res = _mm512_mulhi_epi16(a, b);
+            v16si res2 = _mm512_mulhi_epi16(a2, b2);
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT16), res2);
+        }
     }
 
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst + len - AVX512_LEN_INT32), AVX512_LEN_BYTES)) {
-        for (int i = 2 * AVX512_LEN_INT32; i < stop_len; i += 2 * AVX512_LEN_INT32) {
-            v16si src_tmp = _mm512_load_si512((__m512i *) (src + i));  // load a,b,c,d,e,f,g,h
-            v16si src_tmp2 = _mm512_load_si512((__m512i *) (src + i + AVX512_LEN_INT32));
-            v16si src_tmp_flip = _mm512_permutex2var_epi32(src_tmp, flip_idx, src_tmp);
-            v16si src_tmp_flip2 = _mm512_permutex2var_epi32(src_tmp2, flip_idx, src_tmp2);
-            _mm512_store_si512((__m512i *) (dst + len - i - AVX512_LEN_INT32), src_tmp_flip);
-            _mm512_store_si512((__m512i *) (dst + len - i - 2 * AVX512_LEN_INT32), src_tmp_flip2);
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT16) {
+        __mmask32 mask = tail_mask32(len - i);
+        v16si a = _mm512_maskz_loadu_epi16(mask, src1 + i);
+        v16si b = _mm512_maskz_loadu_epi16(mask, src2 + i);
+        v16si res = _mm512_mulhi_epi16(a, b);
+        _mm512_mask_storeu_epi16(dst + i, mask, res);
+    }
+}
+
+// Q15 product rounded to nearest, (-1) * (-1) wraps to -1 as with pmulhrsw
+SIMD_UTILS_API void mulhrs16s_512s(int16_t *src1, int16_t *src2, int16_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT16);
+    stop_len *= (2 * AVX512_LEN_INT16);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT16) {
+            v16si a = _mm512_load_si512((__m512i *) (src1 + i));
+            v16si b = _mm512_load_si512((__m512i *) (src2 + i));
+            v16si a2 = _mm512_load_si512((__m512i *) (src1 + i + AVX512_LEN_INT16));
+            v16si b2 = _mm512_load_si512((__m512i *) (src2 + i + AVX512_LEN_INT16));
+            v16si res = _mm512_mulhrs_epi16(a, b);
+            v16si res2 = _mm512_mulhrs_epi16(a2, b2);
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT16), res2);
         }
     } else {
-        for (int i = 2 * AVX512_LEN_INT32; i < stop_len; i += 2 * AVX512_LEN_INT32) {
-            v16si src_tmp = _mm512_loadu_si512((__m512i *) (src + i));  // load a,b,c,d,e,f,g,h
-            v16si src_tmp2 = _mm512_loadu_si512((__m512i *) (src + i + AVX512_LEN_INT32));
-            v16si src_tmp_flip = _mm512_permutex2var_epi32(src_tmp, flip_idx, src_tmp);
-            v16si src_tmp_flip2 = _mm512_permutex2var_epi32(src_tmp2, flip_idx, src_tmp2);
-            _mm512_storeu_si512((__m512i *) (dst + len - i - AVX512_LEN_INT32), src_tmp_flip);
-            _mm512_storeu_si512((__m512i *) (dst + len - i - 2 * AVX512_LEN_INT32), src_tmp_flip2);
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT16) {
+            v16si a = _mm512_loadu_si512((__m512i *) (src1 + i));
+            v16si b = _mm512_loadu_si512((__m512i *) (src2 + i));
+            v16si a2 = _mm512_loadu_si512((__m512i *) (src1 + i + AVX512_LEN_INT16));
+            v16si b2 = _mm512_loadu_si512((__m512i *) (src2 + i + AVX512_LEN_INT16));
+            v16si res = _mm512_mulhrs_epi16(a, b);
+            v16si res2 = _mm512_mulhrs_epi16(a2, b2);
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT16), res2);
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[len - i - 1] = src[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT16) {
+        __mmask32 mask = tail_mask32(len - i);
+        v16si a = _mm512_maskz_loadu_epi16(mask, src1 + i);
+        v16si b = _mm512_maskz_loadu_epi16(mask, src2 + i);
+        v16si res = _mm512_mulhrs_epi16(a, b);
+        _mm512_mask_storeu_epi16(dst + i, mask, res);
     }
 }
 
-static inline void maxevery512s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+SIMD_UTILS_API void maxevery16s_512s(int16_t *src1, int16_t *src2, int16_t *dst, int len)
 {
-    int stop_len = len / (2 * AVX512_LEN_INT32);
-    stop_len *= (2 * AVX512_LEN_INT32);
+    int stop_len = len / (2 * AVX512_LEN_INT16);
+    stop_len *= (2 * AVX512_LEN_INT16);
 
     if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT32) {
-            v16si src1_tmp = _mm512_load_si512((__m512i *) ((const int32_t *) src1 + i));
-            v16si src2_tmp = _mm512_load_si512((__m512i *) ((const int32_t *) src2 + i));
-            v16si src1_tmp2 = _mm512_load_si512((__m512i *) ((const int32_t *) src1 + i + AVX512_LEN_INT32));
-            v16si src2_tmp2 = _mm512_load_si512((__m512i *) ((const int32_t *) src2 + i + AVX512_LEN_INT32));
-            v16si max1 = _mm512_max_epi32(src1_tmp, src2_tmp);
-            v16si max2 = _mm512_max_epi32(src1_tmp2, src2_tmp2);
-            _mm512_store_si512((__m512i *) (dst + i), max1);
-            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT32), max2);
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT16) {
+            v16si a = _mm512_load_si512((__m512i *) (src1 + i));
+            v16si b = _mm512_load_si512((__m512i *) (src2 + i));
+            v16si a2 = _mm512_load_si512((__m512i *) (src1 + i + AVX512_LEN_INT16));
+            v16si b2 = _mm512_load_si512((__m512i *) (src2 + i + AVX512_LEN_INT16));
+            v16si res = _mm512_max_epi16(a, b);
+            v16si res2 = _mm512_max_epi16(a2, b2);
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT16), res2);
         }
     } else {
-        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT32) {
-            v16si src1_tmp = _mm512_loadu_si512((__m512i *) (src1 + i));
-            v16si src2_tmp = _mm512_loadu_si512((__m512i *) (src2 + i));
-            v16si src1_tmp2 = _mm512_loadu_si512((__m512i *) (src1 + i + AVX512_LEN_INT32));
-            v16si src2_tmp2 = _mm512_loadu_si512((__m512i *) (src2 + i + AVX512_LEN_INT32));
-            v16si max1 = _mm512_max_epi32(src1_tmp, src2_tmp);
-            v16si max2 = _mm512_max_epi32(src1_tmp2, src2_tmp2);
-            _mm512_storeu_si512((__m512i *) (dst + i), max1);
-            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT32), max2);
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT16) {
+            v16si a = _mm512_loadu_si512((__m512i *) (src1 + i));
+            v16si b = _mm512_loadu_si512((__m512i *) (src2 + i));
+            v16si a2 = _mm512_loadu_si512((__m512i *) (src1 + i + AVX512_LEN_INT16));
+            v16si b2 = _mm512_loadu_si512((__m512i *) (src2 + i + AVX512_LEN_INT16));
+            v16si res = _mm512_max_epi16(a, b);
+            v16si res2 = _mm512_max_epi16(a2, b2);
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT16), res2);
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src1[i] > src2[i] ? src1[i] : src2[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT16) {
+        __mmask32 mask = tail_mask32(len - i);
+        v16si a = _mm512_maskz_loadu_epi16(mask, src1 + i);
+        v16si b = _mm512_maskz_loadu_epi16(mask, src2 + i);
+        v16si res = _mm512_max_epi16(a, b);
+        _mm512_mask_storeu_epi16(dst + i, mask, res);
     }
 }
 
-static inline void minevery512s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+SIMD_UTILS_API void minevery16s_512s(int16_t *src1, int16_t *src2, int16_t *dst, int len)
 {
-    int stop_len = len / (2 * AVX512_LEN_INT32);
-    stop_len *= (2 * AVX512_LEN_INT32);
+    int stop_len = len / (2 * AVX512_LEN_INT16);
+    stop_len *= (2 * AVX512_LEN_INT16);
 
     if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT32) {
-            v16si src1_tmp = _mm512_load_si512((__m512i *) ((const int32_t *) src1 + i));
-            v16si src2_tmp = _mm512_load_si512((__m512i *) ((const int32_t *) src2 + i));
-            v16si src1_tmp2 = _mm512_load_si512((__m512i *) ((const int32_t *) src1 + i + AVX512_LEN_INT32));
-            v16si src2_tmp2 = _mm512_load_si512((__m512i *) ((const int32_t *) src2 + i + AVX512_LEN_INT32));
-            v16si min1 = _mm512_min_epi32(src1_tmp, src2_tmp);
-            v16si min2 = _mm512_min_epi32(src1_tmp2, src2_tmp2);
-            _mm512_store_si512((__m512i *) (dst + i), min1);
-            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT32), min2);
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT16) {
+            v16si a = _mm512_load_si512((__m512i *) (src1 + i));
+            v16si b = _mm512_load_si512((__m512i *) (src2 + i));
+            v16si a2 = _mm512_load_si512((__m512i *) (src1 + i + AVX512_LEN_INT16));
+            v16si b2 = _mm512_load_si512((__m512i *) (src2 + i + AVX512_LEN_INT16));
+            v16si res = _mm512_min_epi16(a, b);
+            v16si res2 = _mm512_min_epi16(a2, b2);
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT16), res2);
         }
     } else {
-        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT32) {
-            v16si src1_tmp = _mm512_loadu_si512((__m512i *) (src1 + i));
-            v16si src2_tmp = _mm512_loadu_si512((__m512i *) (src2 + i));
-            v16si src1_tmp2 = _mm512_loadu_si512((__m512i *) (src1 + i + AVX512_LEN_INT32));
-            v16si src2_tmp2 = _mm512_loadu_si512((__m512i *) (src2 + i + AVX512_LEN_INT32));
-            v16si min1 = _mm512_min_epi32(src1_tmp, src2_tmp);
-            v16si min2 = _mm512_min_epi32(src1_tmp2, src2_tmp2);
-            _mm512_storeu_si512((__m512i *) (dst + i), min1);
-            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT32), min2);
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT16) {
+            v16si a = _mm512_loadu_si512((__m512i *) (src1 + i));
+            v16si b = _mm512_loadu_si512((__m512i *) (src2 + i));
+            v16si a2 = _mm512_loadu_si512((__m512i *) (src1 + i + AVX512_LEN_INT16));
+            v16si b2 = _mm512_loadu_si512((__m512i *) (src2 + i + AVX512_LEN_INT16));
+            v16si res = _mm512_min_epi16(a, b);
+            v16si res2 = _mm512_min_epi16(a2, b2);
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT16), res2);
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src1[i] < src2[i] ? src1[i] : src2[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT16) {
+        __mmask32 mask = tail_mask32(len - i);
+        v16si a = _mm512_maskz_loadu_epi16(mask, src1 + i);
+        v16si b = _mm512_maskz_loadu_epi16(mask, src2 + i);
+        v16si res = _mm512_min_epi16(a, b);
+        _mm512_mask_storeu_epi16(dst + i, mask, res);
     }
 }
 
-static inline void minmax512s(int32_t *src, int len, int32_t *min_value, int32_t *max_value)
+// saturated, abs(-32768) is 32767
+SIMD_UTILS_API void abs16s_512s(int16_t *src, int16_t *dst, int len)
 {
-    int stop_len = (len - AVX512_LEN_INT32) / (2 * AVX512_LEN_INT32);
-    stop_len *= (2 * AVX512_LEN_INT32);
-    stop_len = (stop_len < 0) ? 0 : stop_len;
+    const v16si zero = _mm512_setzero_si512();
 
-    v16si max_v, min_v, max_v2, min_v2;
-    v16si src_tmp, src_tmp2;
+    int stop_len = len / (2 * AVX512_LEN_INT16);
+    stop_len *= (2 * AVX512_LEN_INT16);
 
-    int32_t min_tmp = src[0];
-    int32_t max_tmp = src[0];
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT16) {
+            v16si a = _mm512_load_si512((__m512i *) (src + i));
+            v16si a2 = _mm512_load_si512((__m512i *) (src + i + AVX512_LEN_INT16));
+            v16si res = _mm512_max_epi16(a, _mm512_subs_epi16(zero, a));
+            v16si res2 = _mm512_max_epi16(a2, _mm512_subs_epi16(zero, a2));
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT16), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT16) {
+            v16si a = _mm512_loadu_si512((__m512i *) (src + i));
+            v16si a2 = _mm512_loadu_si512((__m512i *) (src + i + AVX512_LEN_INT16));
+            v16si res = _mm512_max_epi16(a, _mm512_subs_epi16(zero, a));
+            v16si res2 = _mm512_max_epi16(a2, _mm512_subs_epi16(zero, a2));
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT16), res2);
+        }
+    }
 
-    __attribute__((aligned(SSE_LEN_BYTES))) int32_t max_f[SSE_LEN_INT32];
-    __attribute__((aligned(SSE_LEN_BYTES))) int32_t min_f[SSE_LEN_INT32];
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT16) {
+        __mmask32 mask = tail_mask32(len - i);
+        v16si a = _mm512_maskz_loadu_epi16(mask, src + i);
+        v16si res = _mm512_max_epi16(a, _mm512_subs_epi16(zero, a));
+        _mm512_mask_storeu_epi16(dst + i, mask, res);
+    }
+}
 
-    if (len >= AVX512_LEN_INT32) {
-        if (isAligned((uintptr_t) (src), AVX512_LEN_BYTES)) {
-            src_tmp = _mm512_load_si512((__m512i *) (src + 0));
-            max_v = src_tmp;
-            min_v = src_tmp;
-            max_v2 = src_tmp;
-            min_v2 = src_tmp;
+SIMD_UTILS_API void threshold_gt16s_512s(int16_t *src, int16_t *dst, int len, int16_t value)
+{
+    const v16si val = _mm512_set1_epi16(value);
 
-            for (int i = AVX512_LEN_INT32; i < stop_len; i += 2 * AVX512_LEN_INT32) {
-                src_tmp = _mm512_load_si512((__m512i *) (src + i));
-                src_tmp2 = _mm512_load_si512((__m512i *) (src + i + AVX512_LEN_INT32));
-                max_v = _mm512_max_epi32(max_v, src_tmp);
-                min_v = _mm512_min_epi32(min_v, src_tmp);
-                max_v2 = _mm512_max_epi32(max_v2, src_tmp2);
-                min_v2 = _mm512_min_epi32(min_v2, src_tmp2);
-            }
-        } else {
-            src_tmp = _mm512_loadu_si512((__m512i *) (src + 0));
-            max_v = src_tmp;
-            min_v = src_tmp;
-            max_v2 = src_tmp;
-            min_v2 = src_tmp;
+    int stop_len = len / (2 * AVX512_LEN_INT16);
+    stop_len *= (2 * AVX512_LEN_INT16);
 
-            for (int i = AVX512_LEN_INT32; i < stop_len; i += 2 * AVX512_LEN_INT32) {
-                src_tmp = _mm512_loadu_si512((__m512i *) (src + i));
-                src_tmp2 = _mm512_loadu_si512((__m512i *) (src + i + AVX512_LEN_INT32));
-                max_v = _mm512_max_epi32(max_v, src_tmp);
-                min_v = _mm512_min_epi32(min_v, src_tmp);
-                max_v2 = _mm512_max_epi32(max_v2, src_tmp2);
-                min_v2 = _mm512_min_epi32(min_v2, src_tmp2);
-            }
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT16) {
+            v16si a = _mm512_load_si512((__m512i *) (src + i));
+            v16si a2 = _mm512_load_si512((__m512i *) (src + i + AVX512_LEN_INT16));
+            v16si res = _mm512_min_epi16(a, val);
+            v16si res2 = _mm512_min_epi16(a2, val);
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT16), res2);
         }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT16) {
+            v16si a = _mm512_loadu_si512((__m512i *) (src + i));
+            v16si a2 = _mm512_loadu_si512((__m512i *) (src + i + AVX512_LEN_INT16));
+            v16si res = _mm512_min_epi16(a, val);
+            v16si res2 = _mm512_min_epi16(a2, val);
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT16), res2);
+        }
+    }
 
-        max_v = _mm512_max_epi32(max_v, max_v2);
-        min_v = _mm512_min_epi32(min_v, min_v2);
-
-        v8si max1 = _mm512_castsi512_si256(max_v);
-        v8si min1 = _mm512_castsi512_si256(min_v);
-        v8si max2 = _mm512_extracti32x8_epi32(max_v, 1);
-        v8si min2 = _mm512_extracti32x8_epi32(min_v, 1);
-        max2 = _mm256_max_epi32(max1, max2);
-        min2 = _mm256_min_epi32(min1, min2);
-        v4si max3 = _mm256_castsi256_si128(max2);
-        v4si min3 = _mm256_castsi256_si128(min2);
-        v4si max4 = _mm256_extracti32x4_epi32(max2, 1);
-        v4si min4 = _mm256_extracti32x4_epi32(min2, 1);
-        max4 = _mm_max_epi32(max3, max4);
-        min4 = _mm_min_epi32(min3, min4);
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT16) {
+        __mmask32 mask = tail_mask32(len - i);
+        v16si a = _mm512_maskz_loadu_epi16(mask, src + i);
+        v16si res = _mm512_min_epi16(a, val);
+        _mm512_mask_storeu_epi16(dst + i, mask, res);
+    }
+}
 
-        _mm_store_si128((__m128i *) (max_f), max4);
-        _mm_store_si128((__m128i *) (min_f), min4);
+SIMD_UTILS_API void threshold_lt16s_512s(int16_t *src, int16_t *dst, int len, int16_t value)
+{
+    const v16si val = _mm512_set1_epi16(value);
 
-        max_tmp = max_f[0];
-        max_tmp = max_tmp > max_f[1] ? max_tmp : max_f[1];
-        max_tmp = max_tmp > max_f[2] ? max_tmp : max_f[2];
-        max_tmp = max_tmp > max_f[3] ? max_tmp : max_f[3];
+    int stop_len = len / (2 * AVX512_LEN_INT16);
+    stop_len *= (2 * AVX512_LEN_INT16);
 
-        min_tmp = min_f[0];
-        min_tmp = min_tmp < min_f[1] ? min_tmp : min_f[1];
-        min_tmp = min_tmp < min_f[2] ? min_tmp : min_f[2];
-        min_tmp = min_tmp < min_f[3] ? min_tmp : min_f[3];
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT16) {
+            v16si a = _mm512_load_si512((__m512i *) (src + i));
+            v16si a2 = _mm512_load_si512((__m512i *) (src + i + AVX512_LEN_INT16));
+            v16si res = _mm512_max_epi16(a, val);
+            v16si res2 = _mm512_max_epi16(a2, val);
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT16), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT16) {
+            v16si a = _mm512_loadu_si512((__m512i *) (src + i));
+            v16si a2 = _mm512_loadu_si512((__m512i *) (src + i + AVX512_LEN_INT16));
+            v16si res = _mm512_max_epi16(a, val);
+            v16si res2 = _mm512_max_epi16(a2, val);
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT16), res2);
+        }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        max_tmp = max_tmp > src[i] ? max_tmp : src[i];
-        min_tmp = min_tmp < src[i] ? min_tmp : src[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT16) {
+        __mmask32 mask = tail_mask32(len - i);
+        v16si a = _mm512_maskz_loadu_epi16(mask, src + i);
+        v16si res = _mm512_max_epi16(a, val);
+        _mm512_mask_storeu_epi16(dst + i, mask, res);
     }
-
-    *max_value = max_tmp;
-    *min_value = min_tmp;
 }
 
-static inline void threshold512_gt_s(int32_t *src, int32_t *dst, int len, int32_t value)
+SIMD_UTILS_API void addsatu8_512(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len)
 {
-    const v16si tmp = _mm512_set1_epi32(value);
+    int stop_len = len / (2 * AVX512_LEN_INT8);
+    stop_len *= (2 * AVX512_LEN_INT8);
 
-    int stop_len = len / (2 * AVX512_LEN_INT32);
-    stop_len *= (2 * AVX512_LEN_INT32);
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT8) {
+            v16si a = _mm512_load_si512((__m512i *) (src1 + i));
+            v16si b = _mm512_load_si512((__m512i *) (src2 + i));
+            v16si a2 = _mm512_load_si512((__m512i *) (src1 + i + AVX512_LEN_INT8));
+            v16si b2 = _mm512_load_si512((__m512i *) (src2 + i + AVX512_LEN_INT8));
+            v16si res = _mm512_adds_epu8(a, b);
+            v16si res2 = _mm512_adds_epu8(a2, b2);
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT8), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT8) {
+            v16si a = _mm512_loadu_si512((__m512i *) (src1 + i));
+            v16si b = _mm512_loadu_si512((__m512i *) (src2 + i));
+            v16si a2 = _mm512_loadu_si512((__m512i *) (src1 + i + AVX512_LEN_INT8));
+            v16si b2 = _mm512_loadu_si512((__m512i *) (src2 + i + AVX512_LEN_INT8));
+            v16si res = _mm512_adds_epu8(a, b);
+            v16si res2 = _mm512_adds_epu8(a2, b2);
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT8), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT8) {
+        __mmask64 mask = tail_mask64(len - i);
+        v16si a = _mm512_maskz_loadu_epi8(mask, src1 + i);
+        v16si b = _mm512_maskz_loadu_epi8(mask, src2 + i);
+        v16si res = _mm512_adds_epu8(a, b);
+        _mm512_mask_storeu_epi8(dst + i, mask, res);
+    }
+}
+
+SIMD_UTILS_API void subsatu8_512(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT8);
+    stop_len *= (2 * AVX512_LEN_INT8);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT8) {
+            v16si a = _mm512_load_si512((__m512i *) (src1 + i));
+            v16si b = _mm512_load_si512((__m512i *) (src2 + i));
+            v16si a2 = _mm512_load_si512((__m512i *) (src1 + i + AVX512_LEN_INT8));
+            v16si b2 = _mm512_load_si512((__m512i *) (src2 + i + AVX512_LEN_INT8));
+            v16si res = _mm512_subs_epu8(a, b);
+            v16si res2 = _mm512_subs_epu8(a2, b2);
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT8), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT8) {
+            v16si a = _mm512_loadu_si512((__m512i *) (src1 + i));
+            v16si b = _mm512_loadu_si512((__m512i *) (src2 + i));
+            v16si a2 = _mm512_loadu_si512((__m512i *) (src1 + i + AVX512_LEN_INT8));
+            v16si b2 = _mm512_loadu_si512((__m512i *) (src2 + i + AVX512_LEN_INT8));
+            v16si res = _mm512_subs_epu8(a, b);
+            v16si res2 = _mm512_subs_epu8(a2, b2);
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT8), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT8) {
+        __mmask64 mask = tail_mask64(len - i);
+        v16si a = _mm512_maskz_loadu_epi8(mask, src1 + i);
+        v16si b = _mm512_maskz_loadu_epi8(mask, src2 + i);
+        v16si res = _mm512_subs_epu8(a, b);
+        _mm512_mask_storeu_epi8(dst + i, mask, res);
+    }
+}
+
+// one of the two saturated differences is 0
+SIMD_UTILS_API void absdiffu8_512(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT8);
+    stop_len *= (2 * AVX512_LEN_INT8);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT8) {
+            v16si a = _mm512_load_si512((__m512i *) (src1 + i));
+            v16si b = _mm512_load_si512((__m512i *) (src2 + i));
+            v16si a2 = _mm512_load_si512((__m512i *) (src1 + i + AVX512_LEN_INT8));
+            v16si b2 = _mm512_load_si512((__m512i *) (src2 + i + AVX512_LEN_INT8));
+            v16si res = _mm512_or_si512(_mm512_subs_epu8(a, b), _mm512_subs_epu8(b, a));
+            v16si res2 = _mm512_or_si512(_mm512_subs_epu8(a2, b2), _mm512_subs_epu8(b2, a2));
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT8), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT8) {
+            v16si a = _mm512_loadu_si512((__m512i *) (src1 + i));
+            v16si b = _mm512_loadu_si512((__m512i *) (src2 + i));
+            v16si a2 = _mm512_loadu_si512((__m512i *) (src1 + i + AVX512_LEN_INT8));
+            v16si b2 = _mm512_loadu_si512((__m512i *) (src2 + i + AVX512_LEN_INT8));
+            v16si res = _mm512_or_si512(_mm512_subs_epu8(a, b), _mm512_subs_epu8(b, a));
+            v16si res2 = _mm512_or_si512(_mm512_subs_epu8(a2, b2), _mm512_subs_epu8(b2, a2));
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT8), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT8) {
+        __mmask64 mask = tail_mask64(len - i);
+        v16si a = _mm512_maskz_loadu_epi8(mask, src1 + i);
+        v16si b = _mm512_maskz_loadu_epi8(mask, src2 + i);
+        v16si res = _mm512_or_si512(_mm512_subs_epu8(a, b), _mm512_subs_epu8(b, a));
+        _mm512_mask_storeu_epi8(dst + i, mask, res);
+    }
+}
+
+SIMD_UTILS_API void maxeveryu8_512(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT8);
+    stop_len *= (2 * AVX512_LEN_INT8);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT8) {
+            v16si a = _mm512_load_si512((__m512i *) (src1 + i));
+            v16si b = _mm512_load_si512((__m512i *) (src2 + i));
+            v16si a2 = _mm512_load_si512((__m512i *) (src1 + i + AVX512_LEN_INT8));
+            v16si b2 = _mm512_load_si512((__m512i *) (src2 + i + AVX512_LEN_INT8));
+            v16si res = _mm512_max_epu8(a, b);
+            v16si res2 = _mm512_max_epu8(a2, b2);
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT8), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT8) {
+            v16si a = _mm512_loadu_si512((__m512i *) (src1 + i));
+            v16si b = _mm512_loadu_si512((__m512i *) (src2 + i));
+            v16si a2 = _mm512_loadu_si512((__m512i *) (src1 + i + AVX512_LEN_INT8));
+            v16si b2 = _mm512_loadu_si512((__m512i *) (src2 + i + AVX512_LEN_INT8));
+            v16si res = _mm512_max_epu8(a, b);
+            v16si res2 = _mm512_max_epu8(a2, b2);
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT8), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT8) {
+        __mmask64 mask = tail_mask64(len - i);
+        v16si a = _mm512_maskz_loadu_epi8(mask, src1 + i);
+        v16si b = _mm512_maskz_loadu_epi8(mask, src2 + i);
+        v16si res = _mm512_max_epu8(a, b);
+        _mm512_mask_storeu_epi8(dst + i, mask, res);
+    }
+}
+
+SIMD_UTILS_API void mineveryu8_512(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT8);
+    stop_len *= (2 * AVX512_LEN_INT8);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT8) {
+            v16si a = _mm512_load_si512((__m512i *) (src1 + i));
+            v16si b = _mm512_load_si512((__m512i *) (src2 + i));
+            v16si a2 = _mm512_load_si512((__m512i *) (src1 + i + AVX512_LEN_INT8));
+            v16si b2 = _mm512_load_si512((__m512i *) (src2 + i + AVX512_LEN_INT8));
+            v16si res = _mm512_min_epu8(a, b);
+            v16si res2 = _mm512_min_epu8(a2, b2);
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT8), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT8) {
+            v16si a = _mm512_loadu_si512((__m512i *) (src1 + i));
+            v16si b = _mm512_loadu_si512((__m512i *) (src2 + i));
+            v16si a2 = _mm512_loadu_si512((__m512i *) (src1 + i + AVX512_LEN_INT8));
+            v16si b2 = _mm512_loadu_si512((__m512i *) (src2 + i + AVX512_LEN_INT8));
+            v16si res = _mm512_min_epu8(a, b);
+            v16si res2 = _mm512_min_epu8(a2, b2);
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT8), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT8) {
+        __mmask64 mask = tail_mask64(len - i);
+        v16si a = _mm512_maskz_loadu_epi8(mask, src1 + i);
+        v16si b = _mm512_maskz_loadu_epi8(mask, src2 + i);
+        v16si res = _mm512_min_epu8(a, b);
+        _mm512_mask_storeu_epi8(dst + i, mask, res);
+    }
+}
+
+SIMD_UTILS_API void threshold_gtu8_512(uint8_t *src, uint8_t *dst, int len, uint8_t value)
+{
+    const v16si val = _mm512_set1_epi8((char) value);
+
+    int stop_len = len / (2 * AVX512_LEN_INT8);
+    stop_len *= (2 * AVX512_LEN_INT8);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT8) {
+            v16si a = _mm512_load_si512((__m512i *) (src + i));
+            v16si a2 = _mm512_load_si512((__m512i *) (src + i + AVX512_LEN_INT8));
+            v16si res = _mm512_min_epu8(a, val);
+            v16si res2 = _mm512_min_epu8(a2, val);
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT8), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT8) {
+            v16si a = _mm512_loadu_si512((__m512i *) (src + i));
+            v16si a2 = _mm512_loadu_si512((__m512i *) (src + i + AVX512_LEN_INT8));
+            v16si res = _mm512_min_epu8(a, val);
+            v16si res2 = _mm512_min_epu8(a2, val);
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT8), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT8) {
+        __mmask64 mask = tail_mask64(len - i);
+        v16si a = _mm512_maskz_loadu_epi8(mask, src + i);
+        v16si res = _mm512_min_epu8(a, val);
+        _mm512_mask_storeu_epi8(dst + i, mask, res);
+    }
+}
+
+SIMD_UTILS_API void threshold_ltu8_512(uint8_t *src, uint8_t *dst, int len, uint8_t value)
+{
+    const v16si val = _mm512_set1_epi8((char) value);
+
+    int stop_len = len / (2 * AVX512_LEN_INT8);
+    stop_len *= (2 * AVX512_LEN_INT8);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT8) {
+            v16si a = _mm512_load_si512((__m512i *) (src + i));
+            v16si a2 = _mm512_load_si512((__m512i *) (src + i + AVX512_LEN_INT8));
+            v16si res = _mm512_max_epu8(a, val);
+            v16si res2 = _mm512_max_epu8(a2, val);
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT8), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT8) {
+            v16si a = _mm512_loadu_si512((__m512i *) (src + i));
+            v16si a2 = _mm512_loadu_si512((__m512i *) (src + i + AVX512_LEN_INT8));
+            v16si res = _mm512_max_epu8(a, val);
+            v16si res2 = _mm512_max_epu8(a2, val);
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT8), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT8) {
+        __mmask64 mask = tail_mask64(len - i);
+        v16si a = _mm512_maskz_loadu_epi8(mask, src + i);
+        v16si res = _mm512_max_epu8(a, val);
+        _mm512_mask_storeu_epi8(dst + i, mask, res);
+    }
+}
+
+// src >> scale_factor saturated to [0, 255]
+SIMD_UTILS_API void convertInt16ToU8_512(int16_t *src, uint8_t *dst, int len, int scale_factor)
+{
+    const v16si zero = _mm512_setzero_si512();
+
+    int stop_len = len / AVX512_LEN_INT16;
+    stop_len *= AVX512_LEN_INT16;
+
+    if (isAligned((uintptr_t) (src), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_INT16) {
+            v16si a = _mm512_load_si512((__m512i *) (src + i));
+            a = _mm512_max_epi16(_mm512_srai_epi16(a, scale_factor), zero);
+            _mm256_storeu_si256((__m256i *) (dst + i), _mm512_cvtusepi16_epi8(a));
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_INT16) {
+            v16si a = _mm512_loadu_si512((__m512i *) (src + i));
+            a = _mm512_max_epi16(_mm512_srai_epi16(a, scale_factor), zero);
+            _mm256_storeu_si256((__m256i *) (dst + i), _mm512_cvtusepi16_epi8(a));
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT16) {
+        __mmask32 mask = tail_mask32(len - i);
+        v16si a = _mm512_maskz_loadu_epi16(mask, src + i);
+        a = _mm512_max_epi16(_mm512_srai_epi16(a, scale_factor), zero);
+        _mm512_mask_cvtusepi16_storeu_epi8(dst + i, mask, a);
+    }
+}
+
+// src << scale_factor, scale_factor up to 7
+SIMD_UTILS_API void convertU8ToInt16_512(uint8_t *src, int16_t *dst, int len, int scale_factor)
+{
+    int stop_len = len / AVX512_LEN_INT16;
+    stop_len *= AVX512_LEN_INT16;
+
+    if (isAligned((uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_INT16) {
+            v16si a = _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i *) (src + i)));
+            _mm512_store_si512((__m512i *) (dst + i), _mm512_slli_epi16(a, scale_factor));
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_INT16) {
+            v16si a = _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i *) (src + i)));
+            _mm512_storeu_si512((__m512i *) (dst + i), _mm512_slli_epi16(a, scale_factor));
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT16) {
+        __mmask32 mask = tail_mask32(len - i);
+        v16si a = _mm512_cvtepu8_epi16(_mm256_maskz_loadu_epi8(mask, src + i));
+        _mm512_mask_storeu_epi16(dst + i, mask, _mm512_slli_epi16(a, scale_factor));
+    }
+}
+
+SIMD_UTILS_API void add64s_512s(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT64);
+    stop_len *= (2 * AVX512_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT64) {
+            v8sid a = _mm512_load_si512((__m512i *) (src1 + i));
+            v8sid b = _mm512_load_si512((__m512i *) (src2 + i));
+            v8sid a2 = _mm512_load_si512((__m512i *) (src1 + i + AVX512_LEN_INT64));
+            v8sid b2 = _mm512_load_si512((__m512i *) (src2 + i + AVX512_LEN_INT64));
+            v8sid res = _mm512_add_epi64(a, b);
+            v8sid res2 = _mm512_add_epi64(a2, b2);
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT64) {
+            v8sid a = _mm512_loadu_si512((__m512i *) (src1 + i));
+            v8sid b = _mm512_loadu_si512((__m512i *) (src2 + i));
+            v8sid a2 = _mm512_loadu_si512((__m512i *) (src1 + i + AVX512_LEN_INT64));
+            v8sid b2 = _mm512_loadu_si512((__m512i *) (src2 + i + AVX512_LEN_INT64));
+            v8sid res = _mm512_add_epi64(a, b);
+            v8sid res2 = _mm512_add_epi64(a2, b2);
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT64) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sid a = _mm512_maskz_loadu_epi64(mask, src1 + i);
+        v8sid b = _mm512_maskz_loadu_epi64(mask, src2 + i);
+        v8sid res = _mm512_add_epi64(a, b);
+        _mm512_mask_storeu_epi64(dst + i, mask, res);
+    }
+}
+
+SIMD_UTILS_API void sub64s_512s(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT64);
+    stop_len *= (2 * AVX512_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT64) {
+            v8sid a = _mm512_load_si512((__m512i *) (src1 + i));
+            v8sid b = _mm512_load_si512((__m512i *) (src2 + i));
+            v8sid a2 = _mm512_load_si512((__m512i *) (src1 + i + AVX512_LEN_INT64));
+            v8sid b2 = _mm512_load_si512((__m512i *) (src2 + i + AVX512_LEN_INT64));
+            v8sid res = _mm512_sub_epi64(a, b);
+            v8sid res2 = _mm512_sub_epi64(a2, b2);
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT64) {
+            v8sid a = _mm512_loadu_si512((__m512i *) (src1 + i));
+            v8sid b = _mm512_loadu_si512((__m512i *) (src2 + i));
+            v8sid a2 = _mm512_loadu_si512((__m512i *) (src1 + i + AVX512_LEN_INT64));
+            v8sid b2 = _mm512_loadu_si512((__m512i *) (src2 + i + AVX512_LEN_INT64));
+            v8sid res = _mm512_sub_epi64(a, b);
+            v8sid res2 = _mm512_sub_epi64(a2, b2);
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT64) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sid a = _mm512_maskz_loadu_epi64(mask, src1 + i);
+        v8sid b = _mm512_maskz_loadu_epi64(mask, src2 + i);
+        v8sid res = _mm512_sub_epi64(a, b);
+        _mm512_mask_storeu_epi64(dst + i, mask, res);
+    }
+}
+
+// low 64 bits of the products
+SIMD_UTILS_API void mul64s_512s(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT64);
+    stop_len *= (2 * AVX512_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT64) {
+            v8sid a = _mm512_load_si512((__m512i *) (src1 + i));
+            v8sid b = _mm512_load_si512((__m512i *) (src2 + i));
+            v8sid a2 = _mm512_load_si512((__m512i *) (src1 + i + AVX512_LEN_INT64));
+            v8sid b2 = _mm512_load_si512((__m512i *) (src2 + i + AVX512_LEN_INT64));
+            v8sid res = _mm512_mullo_epi64(a, b);
+            v8sid res2 = _mm512_mullo_epi64(a2, b2);
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT64) {
+            v8sid a = _mm512_loadu_si512((__m512i *) (src1 + i));
+            v8sid b = _mm512_loadu_si512((__m512i *) (src2 + i));
+            v8sid a2 = _mm512_loadu_si512((__m512i *) (src1 + i + AVX512_LEN_INT64));
+            v8sid b2 = _mm512_loadu_si512((__m512i *) (src2 + i + AVX512_LEN_INT64));
+            v8sid res = _mm512_mullo_epi64(a, b);
+            v8sid res2 = _mm512_mullo_epi64(a2, b2);
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT64) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sid a = _mm512_maskz_loadu_epi64(mask, src1 + i);
+        v8sid b = _mm512_maskz_loadu_epi64(mask, src2 + i);
+        v8sid res = _mm512_mullo_epi64(a, b);
+        _mm512_mask_storeu_epi64(dst + i, mask, res);
+    }
+}
+
+SIMD_UTILS_API void sum64s_512s(int64_t *src, int64_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT64);
+    stop_len *= (2 * AVX512_LEN_INT64);
+
+    v8sid vec_acc1 = _mm512_setzero_si512();
+    v8sid vec_acc2 = _mm512_setzero_si512();
+
+    for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT64) {
+        vec_acc1 = _mm512_add_epi64(vec_acc1, _mm512_loadu_si512((__m512i *) (src + i)));
+        vec_acc2 = _mm512_add_epi64(vec_acc2, _mm512_loadu_si512((__m512i *) (src + i + AVX512_LEN_INT64)));
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT64) {
+        __mmask8 mask = tail_mask8(len - i);
+        vec_acc1 = _mm512_add_epi64(vec_acc1, _mm512_maskz_loadu_epi64(mask, src + i));
+    }
+
+    *dst = _mm512_reduce_add_epi64(_mm512_add_epi64(vec_acc1, vec_acc2));
+}
+
+SIMD_UTILS_API void maxevery64s_512s(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT64);
+    stop_len *= (2 * AVX512_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT64) {
+            v8sid a = _mm512_load_si512((__m512i *) (src1 + i));
+            v8sid b = _mm512_load_si512((__m512i *) (src2 + i));
+            v8sid a2 = _mm512_load_si512((__m512i *) (src1 + i + AVX512_LEN_INT64));
+            v8sid b2 = _mm512_load_si512((__m512i *) (src2 + i + AVX512_LEN_INT64));
+            v8sid res = _mm512_max_epi64(a, b);
+            v8sid res2 = _mm512_max_epi64(a2, b2);
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT64) {
+            v8sid a = _mm512_loadu_si512((__m512i *) (src1 + i));
+            v8sid b = _mm512_loadu_si512((__m512i *) (src2 + i));
+            v8sid a2 = _mm512_loadu_si512((__m512i *) (src1 + i + AVX512_LEN_INT64));
+            v8sid b2 = _mm512_loadu_si512((__m512i *) (src2 + i + AVX512_LEN_INT64));
+            v8sid res = _mm512_max_epi64(a, b);
+            v8sid res2 = _mm512_max_epi64(a2, b2);
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT64) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sid a = _mm512_maskz_loadu_epi64(mask, src1 + i);
+        v8sid b = _mm512_maskz_loadu_epi64(mask, src2 + i);
+        v8sid res = _mm512_max_epi64(a, b);
+        _mm512_mask_storeu_epi64(dst + i, mask, res);
+    }
+}
+
+SIMD_UTILS_API void minevery64s_512s(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT64);
+    stop_len *= (2 * AVX512_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT64) {
+            v8sid a = _mm512_load_si512((__m512i *) (src1 + i));
+            v8sid b = _mm512_load_si512((__m512i *) (src2 + i));
+            v8sid a2 = _mm512_load_si512((__m512i *) (src1 + i + AVX512_LEN_INT64));
+            v8sid b2 = _mm512_load_si512((__m512i *) (src2 + i + AVX512_LEN_INT64));
+            v8sid res = _mm512_min_epi64(a, b);
+            v8sid res2 = _mm512_min_epi64(a2, b2);
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT64) {
+            v8sid a = _mm512_loadu_si512((__m512i *) (src1 + i));
+            v8sid b = _mm512_loadu_si512((__m512i *) (src2 + i));
+            v8sid a2 = _mm512_loadu_si512((__m512i *) (src1 + i + AVX512_LEN_INT64));
+            v8sid b2 = _mm512_loadu_si512((__m512i *) (src2 + i + AVX512_LEN_INT64));
+            v8sid res = _mm512_min_epi64(a, b);
+            v8sid res2 = _mm512_min_epi64(a2, b2);
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT64) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sid a = _mm512_maskz_loadu_epi64(mask, src1 + i);
+        v8sid b = _mm512_maskz_loadu_epi64(mask, src2 + i);
+        v8sid res = _mm512_min_epi64(a, b);
+        _mm512_mask_storeu_epi64(dst + i, mask, res);
+    }
+}
+
+SIMD_UTILS_API void maxeveryu64_512(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT64);
+    stop_len *= (2 * AVX512_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT64) {
+            v8sid a = _mm512_load_si512((__m512i *) (src1 + i));
+            v8sid b = _mm512_load_si512((__m512i *) (src2 + i));
+            v8sid a2 = _mm512_load_si512((__m512i *) (src1 + i + AVX512_LEN_INT64));
+            v8sid b2 = _mm512_load_si512((__m512i *) (src2 + i + AVX512_LEN_INT64));
+            v8sid res = _mm512_max_epu64(a, b);
+            v8sid res2 = _mm512_max_epu64(a2, b2);
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT64) {
+            v8sid a = _mm512_loadu_si512((__m512i *) (src1 + i));
+            v8sid b = _mm512_loadu_si512((__m512i *) (src2 + i));
+            v8sid a2 = _mm512_loadu_si512((__m512i *) (src1 + i + AVX512_LEN_INT64));
+            v8sid b2 = _mm512_loadu_si512((__m512i *) (src2 + i + AVX512_LEN_INT64));
+            v8sid res = _mm512_max_epu64(a, b);
+            v8sid res2 = _mm512_max_epu64(a2, b2);
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT64) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sid a = _mm512_maskz_loadu_epi64(mask, src1 + i);
+        v8sid b = _mm512_maskz_loadu_epi64(mask, src2 + i);
+        v8sid res = _mm512_max_epu64(a, b);
+        _mm512_mask_storeu_epi64(dst + i, mask, res);
+    }
+}
+
+SIMD_UTILS_API void mineveryu64_512(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT64);
+    stop_len *= (2 * AVX512_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT64) {
+            v8sid a = _mm512_load_si512((__m512i *) (src1 + i));
+            v8sid b = _mm512_load_si512((__m512i *) (src2 + i));
+            v8sid a2 = _mm512_load_si512((__m512i *) (src1 + i + AVX512_LEN_INT64));
+            v8sid b2 = _mm512_load_si512((__m512i *) (src2 + i + AVX512_LEN_INT64));
+            v8sid res = _mm512_min_epu64(a, b);
+            v8sid res2 = _mm512_min_epu64(a2, b2);
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT64) {
+            v8sid a = _mm512_loadu_si512((__m512i *) (src1 + i));
+            v8sid b = _mm512_loadu_si512((__m512i *) (src2 + i));
+            v8sid a2 = _mm512_loadu_si512((__m512i *) (src1 + i + AVX512_LEN_INT64));
+            v8sid b2 = _mm512_loadu_si512((__m512i *) (src2 + i + AVX512_LEN_INT64));
+            v8sid res = _mm512_min_epu64(a, b);
+            v8sid res2 = _mm512_min_epu64(a2, b2);
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT64) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sid a = _mm512_maskz_loadu_epi64(mask, src1 + i);
+        v8sid b = _mm512_maskz_loadu_epi64(mask, src2 + i);
+        v8sid res = _mm512_min_epu64(a, b);
+        _mm512_mask_storeu_epi64(dst + i, mask, res);
+    }
+}
+
+SIMD_UTILS_API void minmax64s_512s(int64_t *src, int len, int64_t *min_value, int64_t *max_value)
+{
+    if (len <= 0)
+        return;
+
+    int stop_len = len / AVX512_LEN_INT64;
+    stop_len *= AVX512_LEN_INT64;
+
+    // the first element fills the lanes which are not loaded by the tail
+    v8sid max_v = _mm512_set1_epi64((int64_t) src[0]);
+    v8sid min_v = max_v;
+
+    for (int i = 0; i < stop_len; i += AVX512_LEN_INT64) {
+        v8sid a = _mm512_loadu_si512((__m512i *) (src + i));
+        max_v = _mm512_max_epi64(max_v, a);
+        min_v = _mm512_min_epi64(min_v, a);
+    }
+
+    if (stop_len < len) {
+        __mmask8 mask = tail_mask8(len - stop_len);
+        v8sid a = _mm512_mask_loadu_epi64(max_v, mask, src + stop_len);
+        max_v = _mm512_max_epi64(max_v, a);
+        a = _mm512_mask_loadu_epi64(min_v, mask, src + stop_len);
+        min_v = _mm512_min_epi64(min_v, a);
+    }
+
+    *max_value = (int64_t) _mm512_reduce_max_epi64(max_v);
+    *min_value = (int64_t) _mm512_reduce_min_epi64(min_v);
+}
+
+SIMD_UTILS_API void minmaxu64_512(uint64_t *src, int len, uint64_t *min_value, uint64_t *max_value)
+{
+    if (len <= 0)
+        return;
+
+    int stop_len = len / AVX512_LEN_INT64;
+    stop_len *= AVX512_LEN_INT64;
+
+    // the first element fills the lanes which are not loaded by the tail
+    v8sid max_v = _mm512_set1_epi64((int64_t) src[0]);
+    v8sid min_v = max_v;
+
+    for (int i = 0; i < stop_len; i += AVX512_LEN_INT64) {
+        v8sid a = _mm512_loadu_si512((__m512i *) (src + i));
+        max_v = _mm512_max_epu64(max_v, a);
+        min_v = _mm512_min_epu64(min_v, a);
+    }
+
+    if (stop_len < len) {
+        __mmask8 mask = tail_mask8(len - stop_len);
+        v8sid a = _mm512_mask_loadu_epi64(max_v, mask, src + stop_len);
+        max_v = _mm512_max_epu64(max_v, a);
+        a = _mm512_mask_loadu_epi64(min_v, mask, src + stop_len);
+        min_v = _mm512_min_epu64(min_v, a);
+    }
+
+    *max_value = (uint64_t) _mm512_reduce_max_epu64(max_v);
+    *min_value = (uint64_t) _mm512_reduce_min_epu64(min_v);
+}
+
+// dst is all ones where the comparison holds, 0 elsewhere
+SIMD_UTILS_API void cmpeq64s_512s(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT64);
+    stop_len *= (2 * AVX512_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT64) {
+            v8sid a = _mm512_load_si512((__m512i *) (src1 + i));
+            v8sid b = _mm512_load_si512((__m512i *) (src2 + i));
+            v8sid a2 = _mm512_load_si512((__m512i *) (src1 + i + AVX512_LEN_INT64));
+            v8sid b2 = _mm512_load_si512((__m512i *) (src2 + i + AVX512_LEN_INT64));
+            v8sid res = _mm512_movm_epi64(_mm512_cmpeq_epi64_mask(a, b));
+            v8sid res2 = _mm512_movm_epi64(_mm512_cmpeq_epi64_mask(a2, b2));
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT64) {
+            v8sid a = _mm512_loadu_si512((__m512i *) (src1 + i));
+            v8sid b = _mm512_loadu_si512((__m512i *) (src2 + i));
+            v8sid a2 = _mm512_loadu_si512((__m512i *) (src1 + i + AVX512_LEN_INT64));
+            v8sid b2 = _mm512_loadu_si512((__m512i *) (src2 + i + AVX512_LEN_INT64));
+            v8sid res = _mm512_movm_epi64(_mm512_cmpeq_epi64_mask(a, b));
+            v8sid res2 = _mm512_movm_epi64(_mm512_cmpeq_epi64_mask(a2, b2));
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT64) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sid a = _mm512_maskz_loadu_epi64(mask, src1 + i);
+        v8sid b = _mm512_maskz_loadu_epi64(mask, src2 + i);
+        v8sid res = _mm512_movm_epi64(_mm512_cmpeq_epi64_mask(a, b));
+        _mm512_mask_storeu_epi64(dst + i, mask, res);
+    }
+}
+
+SIMD_UTILS_API void cmpgt64s_512s(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT64);
+    stop_len *= (2 * AVX512_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT64) {
+            v8sid a = _mm512_load_si512((__m512i *) (src1 + i));
+            v8sid b = _mm512_load_si512((__m512i *) (src2 + i));
+            v8sid a2 = _mm512_load_si512((__m512i *) (src1 + i + AVX512_LEN_INT64));
+            v8sid b2 = _mm512_load_si512((__m512i *) (src2 + i + AVX512_LEN_INT64));
+            v8sid res = _mm512_movm_epi64(_mm512_cmpgt_epi64_mask(a, b));
+            v8sid res2 = _mm512_movm_epi64(_mm512_cmpgt_epi64_mask(a2, b2));
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT64) {
+            v8sid a = _mm512_loadu_si512((__m512i *) (src1 + i));
+            v8sid b = _mm512_loadu_si512((__m512i *) (src2 + i));
+            v8sid a2 = _mm512_loadu_si512((__m512i *) (src1 + i + AVX512_LEN_INT64));
+            v8sid b2 = _mm512_loadu_si512((__m512i *) (src2 + i + AVX512_LEN_INT64));
+            v8sid res = _mm512_movm_epi64(_mm512_cmpgt_epi64_mask(a, b));
+            v8sid res2 = _mm512_movm_epi64(_mm512_cmpgt_epi64_mask(a2, b2));
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT64) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sid a = _mm512_maskz_loadu_epi64(mask, src1 + i);
+        v8sid b = _mm512_maskz_loadu_epi64(mask, src2 + i);
+        v8sid res = _mm512_movm_epi64(_mm512_cmpgt_epi64_mask(a, b));
+        _mm512_mask_storeu_epi64(dst + i, mask, res);
+    }
+}
+
+SIMD_UTILS_API void cmpgtu64_512(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT64);
+    stop_len *= (2 * AVX512_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT64) {
+            v8sid a = _mm512_load_si512((__m512i *) (src1 + i));
+            v8sid b = _mm512_load_si512((__m512i *) (src2 + i));
+            v8sid a2 = _mm512_load_si512((__m512i *) (src1 + i + AVX512_LEN_INT64));
+            v8sid b2 = _mm512_load_si512((__m512i *) (src2 + i + AVX512_LEN_INT64));
+            v8sid res = _mm512_movm_epi64(_mm512_cmpgt_epu64_mask(a, b));
+            v8sid res2 = _mm512_movm_epi64(_mm512_cmpgt_epu64_mask(a2, b2));
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT64) {
+            v8sid a = _mm512_loadu_si512((__m512i *) (src1 + i));
+            v8sid b = _mm512_loadu_si512((__m512i *) (src2 + i));
+            v8sid a2 = _mm512_loadu_si512((__m512i *) (src1 + i + AVX512_LEN_INT64));
+            v8sid b2 = _mm512_loadu_si512((__m512i *) (src2 + i + AVX512_LEN_INT64));
+            v8sid res = _mm512_movm_epi64(_mm512_cmpgt_epu64_mask(a, b));
+            v8sid res2 = _mm512_movm_epi64(_mm512_cmpgt_epu64_mask(a2, b2));
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT64) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sid a = _mm512_maskz_loadu_epi64(mask, src1 + i);
+        v8sid b = _mm512_maskz_loadu_epi64(mask, src2 + i);
+        v8sid res = _mm512_movm_epi64(_mm512_cmpgt_epu64_mask(a, b));
+        _mm512_mask_storeu_epi64(dst + i, mask, res);
+    }
+}
+
+// shift in [0, 63]
+SIMD_UTILS_API void sll64s_512s(int64_t *src, int64_t *dst, int len, int shift)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT64);
+    stop_len *= (2 * AVX512_LEN_INT64);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT64) {
+            v8sid a = _mm512_load_si512((__m512i *) (src + i));
+            v8sid a2 = _mm512_load_si512((__m512i *) (src + i + AVX512_LEN_INT64));
+            v8sid res = _mm512_slli_epi64(a, shift);
+            v8sid res2 = _mm512_slli_epi64(a2, shift);
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT64) {
+            v8sid a = _mm512_loadu_si512((__m512i *) (src + i));
+            v8sid a2 = _mm512_loadu_si512((__m512i *) (src + i + AVX512_LEN_INT64));
+            v8sid res = _mm512_slli_epi64(a, shift);
+            v8sid res2 = _mm512_slli_epi64(a2, shift);
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT64) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sid a = _mm512_maskz_loadu_epi64(mask, src + i);
+        v8sid res = _mm512_slli_epi64(a, shift);
+        _mm512_mask_storeu_epi64(dst + i, mask, res);
+    }
+}
+
+SIMD_UTILS_API void sra64s_512s(int64_t *src, int64_t *dst, int len, int shift)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT64);
+    stop_len *= (2 * AVX512_LEN_INT64);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT64) {
+            v8sid a = _mm512_load_si512((__m512i *) (src + i));
+            v8sid a2 = _mm512_load_si512((__m512i *) (src + i + AVX512_LEN_INT64));
+            v8sid res = _mm512_srai_epi64(a, shift);
+            v8sid res2 = _mm512_srai_epi64(a2, shift);
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT64) {
+            v8sid a = _mm512_loadu_si512((__m512i *) (src + i));
+            v8sid a2 = _mm512_loadu_si512((__m512i *) (src + i + AVX512_LEN_INT64));
+            v8sid res = _mm512_srai_epi64(a, shift);
+            v8sid res2 = _mm512_srai_epi64(a2, shift);
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT64) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sid a = _mm512_maskz_loadu_epi64(mask, src + i);
+        v8sid res = _mm512_srai_epi64(a, shift);
+        _mm512_mask_storeu_epi64(dst + i, mask, res);
+    }
+}
+
+SIMD_UTILS_API void srlu64_512(uint64_t *src, uint64_t *dst, int len, int shift)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT64);
+    stop_len *= (2 * AVX512_LEN_INT64);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT64) {
+            v8sid a = _mm512_load_si512((__m512i *) (src + i));
+            v8sid a2 = _mm512_load_si512((__m512i *) (src + i + AVX512_LEN_INT64));
+            v8sid res = _mm512_srli_epi64(a, shift);
+            v8sid res2 = _mm512_srli_epi64(a2, shift);
+            _mm512_store_si512((__m512i *) (dst + i), res);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT64) {
+            v8sid a = _mm512_loadu_si512((__m512i *) (src + i));
+            v8sid a2 = _mm512_loadu_si512((__m512i *) (src + i + AVX512_LEN_INT64));
+            v8sid res = _mm512_srli_epi64(a, shift);
+            v8sid res2 = _mm512_srli_epi64(a2, shift);
+            _mm512_storeu_si512((__m512i *) (dst + i), res);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT64) {
+        __mmask8 mask = tail_mask8(len - i);
+        v8sid a = _mm512_maskz_loadu_epi64(mask, src + i);
+        v8sid res = _mm512_srli_epi64(a, shift);
+        _mm512_mask_storeu_epi64(dst + i, mask, res);
+    }
+}
+
+SIMD_UTILS_API void powerspect16s_512s_interleaved(complex16s_t *src, int32_t *dst, int len)
+{
+    int stop_len = len / AVX512_LEN_INT32;
+    stop_len *= AVX512_LEN_INT32;
+
+    int j = 0;
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_INT32) {
+            __m512i reim = _mm512_load_si512((__m512i *) ((const int16_t *) src + j));
+            _mm512_store_si512((__m512i *) (dst + i), _mm512_madd_epi16(reim, reim));
+            j += AVX512_LEN_INT16;
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_INT32) {
+            __m512i reim = _mm512_loadu_si512((__m512i *) ((const int16_t *) src + j));
+            _mm512_storeu_si512((__m512i *) (dst + i), _mm512_madd_epi16(reim, reim));
+            j += AVX512_LEN_INT16;
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT32) {
+        __m512i reim = _mm512_maskz_loadu_epi16(tail_mask32(2 * (len - i)), (const int16_t *) (src + i));
+        _mm512_mask_storeu_epi32(dst + i, tail_mask16(len - i), _mm512_madd_epi16(reim, reim));
+    }
+}
+
+SIMD_UTILS_API void sum16s32s512(int16_t *src, int len, int32_t *dst, int scale_factor)
+{
+    int stop_len = len / (4 * AVX512_LEN_INT16);
+    stop_len *= (4 * AVX512_LEN_INT16);
+
+    __attribute__((aligned(AVX512_LEN_BYTES))) int32_t accumulate[AVX512_LEN_INT32] = {
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+    };
+    int32_t tmp_acc = 0;
+    int16_t scale = 1 << scale_factor;
+    v16si one = _mm512_set1_epi16(1);
+    v16si vec_acc1 = _mm512_setzero_si512();  // initialize the vector accumulator
+    v16si vec_acc2 = _mm512_setzero_si512();  // initialize the vector accumulator
+
+    if (isAligned((uintptr_t) (src), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 4 * AVX512_LEN_INT16) {
+            v16si vec_src_tmp = _mm512_load_si512((__m512i *) ((const int16_t *) src + i));
+            v16si vec_src_tmp2 = _mm512_load_si512((__m512i *) ((const int16_t *) src + i + AVX512_LEN_INT16));
+            v16si vec_src_tmp3 = _mm512_load_si512((__m512i *) ((const int16_t *) src + i + 2 * AVX512_LEN_INT16));
+            v16si vec_src_tmp4 = _mm512_load_si512((__m512i *) ((const int16_t *) src + i + 3 * AVX512_LEN_INT16));
+            vec_src_tmp = _mm512_madd_epi16(vec_src_tmp, one);
+            vec_src_tmp2 = _mm512_madd_epi16(vec_src_tmp2, one);
+            vec_src_tmp3 = _mm512_madd_epi16(vec_src_tmp3, one);
+            vec_src_tmp4 = _mm512_madd_epi16(vec_src_tmp4, one);
+            vec_src_tmp = _mm512_add_epi32(vec_src_tmp, vec_src_tmp2);
+            vec_src_tmp3 = _mm512_add_epi32(vec_src_tmp3, vec_src_tmp4);
+            vec_acc1 = _mm512_add_epi32(vec_src_tmp, vec_acc1);
+            vec_acc2 = _mm512_add_epi32(vec_src_tmp3, vec_acc2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 4 * AVX512_LEN_INT16) {
+            v16si vec_src_tmp = _mm512_loadu_si512((__m512i *) ((const int16_t *) src + i));
+            v16si vec_src_tmp2 = _mm512_loadu_si512((__m512i *) ((const int16_t *) src + i + AVX512_LEN_INT16));
+            v16si vec_src_tmp3 = _mm512_loadu_si512((__m512i *) ((const int16_t *) src + i + 2 * AVX512_LEN_INT16));
+            v16si vec_src_tmp4 = _mm512_loadu_si512((__m512i *) ((const int16_t *) src + i + 3 * AVX512_LEN_INT16));
+            vec_src_tmp = _mm512_madd_epi16(vec_src_tmp, one);
+            vec_src_tmp2 = _mm512_madd_epi16(vec_src_tmp2, one);
+            vec_src_tmp3 = _mm512_madd_epi16(vec_src_tmp3, one);
+            vec_src_tmp4 = _mm512_madd_epi16(vec_src_tmp4, one);
+            vec_src_tmp = _mm512_add_epi32(vec_src_tmp, vec_src_tmp2);
+            vec_src_tmp3 = _mm512_add_epi32(vec_src_tmp3, vec_src_tmp4);
+            vec_acc1 = _mm512_add_epi32(vec_src_tmp, vec_acc1);
+            vec_acc2 = _mm512_add_epi32(vec_src_tmp3, vec_acc2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT16) {
+        v16si vec_src_tmp = _mm512_maskz_loadu_epi16(tail_mask32(len - i), src + i);
+        vec_acc1 = _mm512_add_epi32(_mm512_madd_epi16(vec_src_tmp, one), vec_acc1);
+    }
+
+    vec_acc1 = _mm512_add_epi32(vec_acc1, vec_acc2);
+    _mm512_store_si512((v16si *) accumulate, vec_acc1);
+
+    tmp_acc = tmp_acc + accumulate[0] + accumulate[1] + accumulate[2] + accumulate[3] +
+              accumulate[4] + accumulate[5] + accumulate[6] + accumulate[7] +
+              accumulate[8] + accumulate[9] + accumulate[10] + accumulate[11] +
+              accumulate[12] + accumulate[13] + accumulate[14] + accumulate[15];
+    tmp_acc /= scale;
+    *dst = tmp_acc;
+}
+
+SIMD_UTILS_API void flip512s(int32_t *src, int32_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT32);
+    stop_len *= (2 * AVX512_LEN_INT32);
+    v16si flip_idx = _mm512_set_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst + len - AVX512_LEN_INT32), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT32) {
+            v16si src_tmp = _mm512_load_si512((__m512i *) (src + i));  // load a,b,c,d,e,f,g,h
+            v16si src_tmp2 = _mm512_load_si512((__m512i *) (src + i + AVX512_LEN_INT32));
+            v16si src_tmp_flip = _mm512_permutex2var_epi32(src_tmp, flip_idx, src_tmp);
+            v16si src_tmp_flip2 = _mm512_permutex2var_epi32(src_tmp2, flip_idx, src_tmp2);
+            _mm512_store_si512((__m512i *) (dst + len - i - AVX512_LEN_INT32), src_tmp_flip);
+            _mm512_store_si512((__m512i *) (dst + len - i - 2 * AVX512_LEN_INT32), src_tmp_flip2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT32) {
+            v16si src_tmp = _mm512_loadu_si512((__m512i *) (src + i));  // load a,b,c,d,e,f,g,h
+            v16si src_tmp2 = _mm512_loadu_si512((__m512i *) (src + i + AVX512_LEN_INT32));
+            v16si src_tmp_flip = _mm512_permutex2var_epi32(src_tmp, flip_idx, src_tmp);
+            v16si src_tmp_flip2 = _mm512_permutex2var_epi32(src_tmp2, flip_idx, src_tmp2);
+            _mm512_storeu_si512((__m512i *) (dst + len - i - AVX512_LEN_INT32), src_tmp_flip);
+            _mm512_storeu_si512((__m512i *) (dst + len - i - 2 * AVX512_LEN_INT32), src_tmp_flip2);
+        }
+    }
+
+    // the reversed elements of the tail are in the upper lanes
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT32) {
+        v16si src_tmp = _mm512_maskz_loadu_epi32(tail_mask16(len - i), src + i);
+        v16si src_tmp_flip = _mm512_permutexvar_epi32(flip_idx, src_tmp);
+        _mm512_mask_storeu_epi32(dst + len - i - AVX512_LEN_INT32, (__mmask16) ~tail_mask16(AVX512_LEN_INT32 - (len - i)), src_tmp_flip);
+    }
+}
+
+SIMD_UTILS_API void maxevery512s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT32);
+    stop_len *= (2 * AVX512_LEN_INT32);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT32) {
+            v16si src1_tmp = _mm512_load_si512((__m512i *) ((const int32_t *) src1 + i));
+            v16si src2_tmp = _mm512_load_si512((__m512i *) ((const int32_t *) src2 + i));
+            v16si src1_tmp2 = _mm512_load_si512((__m512i *) ((const int32_t *) src1 + i + AVX512_LEN_INT32));
+            v16si src2_tmp2 = _mm512_load_si512((__m512i *) ((const int32_t *) src2 + i + AVX512_LEN_INT32));
+            v16si max1 = _mm512_max_epi32(src1_tmp, src2_tmp);
+            v16si max2 = _mm512_max_epi32(src1_tmp2, src2_tmp2);
+            _mm512_store_si512((__m512i *) (dst + i), max1);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT32), max2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT32) {
+            v16si src1_tmp = _mm512_loadu_si512((__m512i *) (src1 + i));
+            v16si src2_tmp = _mm512_loadu_si512((__m512i *) (src2 + i));
+            v16si src1_tmp2 = _mm512_loadu_si512((__m512i *) (src1 + i + AVX512_LEN_INT32));
+            v16si src2_tmp2 = _mm512_loadu_si512((__m512i *) (src2 + i + AVX512_LEN_INT32));
+            v16si max1 = _mm512_max_epi32(src1_tmp, src2_tmp);
+            v16si max2 = _mm512_max_epi32(src1_tmp2, src2_tmp2);
+            _mm512_storeu_si512((__m512i *) (dst + i), max1);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT32), max2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT32) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16si src1_tmp = _mm512_maskz_loadu_epi32(mask, src1 + i);
+        v16si src2_tmp = _mm512_maskz_loadu_epi32(mask, src2 + i);
+        v16si max1 = _mm512_max_epi32(src1_tmp, src2_tmp);
+        _mm512_mask_storeu_epi32(dst + i, mask, max1);
+    }
+}
+
+SIMD_UTILS_API void minevery512s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT32);
+    stop_len *= (2 * AVX512_LEN_INT32);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT32) {
+            v16si src1_tmp = _mm512_load_si512((__m512i *) ((const int32_t *) src1 + i));
+            v16si src2_tmp = _mm512_load_si512((__m512i *) ((const int32_t *) src2 + i));
+            v16si src1_tmp2 = _mm512_load_si512((__m512i *) ((const int32_t *) src1 + i + AVX512_LEN_INT32));
+            v16si src2_tmp2 = _mm512_load_si512((__m512i *) ((const int32_t *) src2 + i + AVX512_LEN_INT32));
+            v16si min1 = _mm512_min_epi32(src1_tmp, src2_tmp);
+            v16si min2 = _mm512_min_epi32(src1_tmp2, src2_tmp2);
+            _mm512_store_si512((__m512i *) (dst + i), min1);
+            _mm512_store_si512((__m512i *) (dst + i + AVX512_LEN_INT32), min2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT32) {
+            v16si src1_tmp = _mm512_loadu_si512((__m512i *) (src1 + i));
+            v16si src2_tmp = _mm512_loadu_si512((__m512i *) (src2 + i));
+            v16si src1_tmp2 = _mm512_loadu_si512((__m512i *) (src1 + i + AVX512_LEN_INT32));
+            v16si src2_tmp2 = _mm512_loadu_si512((__m512i *) (src2 + i + AVX512_LEN_INT32));
+            v16si min1 = _mm512_min_epi32(src1_tmp, src2_tmp);
+            v16si min2 = _mm512_min_epi32(src1_tmp2, src2_tmp2);
+            _mm512_storeu_si512((__m512i *) (dst + i), min1);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT32), min2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT32) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16si src1_tmp = _mm512_maskz_loadu_epi32(mask, src1 + i);
+        v16si src2_tmp = _mm512_maskz_loadu_epi32(mask, src2 + i);
+        v16si min1 = _mm512_min_epi32(src1_tmp, src2_tmp);
+        _mm512_mask_storeu_epi32(dst + i, mask, min1);
+    }
+}
+
+SIMD_UTILS_API void minmax512s(int32_t *src, int len, int32_t *min_value, int32_t *max_value)
+{
+    int stop_len = (len - AVX512_LEN_INT32) / (2 * AVX512_LEN_INT32);
+    stop_len *= (2 * AVX512_LEN_INT32);
+    stop_len = (stop_len < 0) ? 0 : stop_len;
+
+    v16si max_v, min_v, max_v2, min_v2;
+    v16si src_tmp, src_tmp2;
+
+    int32_t min_tmp = src[0];
+    int32_t max_tmp = src[0];
+
+    __attribute__((aligned(SSE_LEN_BYTES))) int32_t max_f[SSE_LEN_INT32];
+    __attribute__((aligned(SSE_LEN_BYTES))) int32_t min_f[SSE_LEN_INT32];
+
+    if (len >= AVX512_LEN_INT32) {
+        if (isAligned((uintptr_t) (src), AVX512_LEN_BYTES)) {
+            src_tmp = _mm512_load_si512((__m512i *) (src + 0));
+            max_v = src_tmp;
+            min_v = src_tmp;
+            max_v2 = src_tmp;
+            min_v2 = src_tmp;
+
+            for (int i = AVX512_LEN_INT32; i < stop_len; i += 2 * AVX512_LEN_INT32) {
+                src_tmp = _mm512_load_si512((__m512i *) (src + i));
+                src_tmp2 = _mm512_load_si512((__m512i *) (src + i + AVX512_LEN_INT32));
+                max_v = _mm512_max_epi32(max_v, src_tmp);
+                min_v = _mm512_min_epi32(min_v, src_tmp);
+                max_v2 = _mm512_max_epi32(max_v2, src_tmp2);
+                min_v2 = _mm512_min_epi32(min_v2, src_tmp2);
+            }
+        } else {
+            src_tmp = _mm512_loadu_si512((__m512i *) (src + 0));
+            max_v = src_tmp;
+            min_v = src_tmp;
+            max_v2 = src_tmp;
+            min_v2 = src_tmp;
+
+            for (int i = AVX512_LEN_INT32; i < stop_len; i += 2 * AVX512_LEN_INT32) {
+                src_tmp = _mm512_loadu_si512((__m512i *) (src + i));
+                src_tmp2 = _mm512_loadu_si512((__m512i *) (src + i + AVX512_LEN_INT32));
+                max_v = _mm512_max_epi32(max_v, src_tmp);
+                min_v = _mm512_min_epi32(min_v, src_tmp);
+                max_v2 = _mm512_max_epi32(max_v2, src_tmp2);
+                min_v2 = _mm512_min_epi32(min_v2, src_tmp2);
+            }
+        }
+
+        for (int i = stop_len; i < len; i += AVX512_LEN_INT32) {
+            __mmask16 mask = tail_mask16(len - i);
+            src_tmp = _mm512_maskz_loadu_epi32(mask, src + i);
+            max_v = _mm512_mask_max_epi32(max_v, mask, max_v, src_tmp);
+            min_v = _mm512_mask_min_epi32(min_v, mask, min_v, src_tmp);
+        }
+
+        max_v = _mm512_max_epi32(max_v, max_v2);
+        min_v = _mm512_min_epi32(min_v, min_v2);
+
+        v8si max1 = _mm512_castsi512_si256(max_v);
+        v8si min1 = _mm512_castsi512_si256(min_v);
+        v8si max2 = _mm512_extracti32x8_epi32(max_v, 1);
+        v8si min2 = _mm512_extracti32x8_epi32(min_v, 1);
+        max2 = _mm256_max_epi32(max1, max2);
+        min2 = _mm256_min_epi32(min1, min2);
+        v4si max3 = _mm256_castsi256_si128(max2);
+        v4si min3 = _mm256_castsi256_si128(min2);
+        v4si max4 = _mm256_extracti32x4_epi32(max2, 1);
+        v4si min4 = _mm256_extracti32x4_epi32(min2, 1);
+        max4 = _mm_max_epi32(max3, max4);
+        min4 = _mm_min_epi32(min3, min4);
+
+        _mm_store_si128((__m128i *) (max_f), max4);
+        _mm_store_si128((__m128i *) (min_f), min4);
+
+        max_tmp = max_f[0];
+        max_tmp = max_tmp > max_f[1] ? max_tmp : max_f[1];
+        max_tmp = max_tmp > max_f[2] ? max_tmp : max_f[2];
+        max_tmp = max_tmp > max_f[3] ? max_tmp : max_f[3];
+
+        min_tmp = min_f[0];
+        min_tmp = min_tmp < min_f[1] ? min_tmp : min_f[1];
+        min_tmp = min_tmp < min_f[2] ? min_tmp : min_f[2];
+        min_tmp = min_tmp < min_f[3] ? min_tmp : min_f[3];
+    } else {
+        // the masked out lanes get src[0]
+        src_tmp = _mm512_mask_loadu_epi32(_mm512_set1_epi32(src[0]), tail_mask16(len), src);
+        min_tmp = _mm512_reduce_min_epi32(src_tmp);
+        max_tmp = _mm512_reduce_max_epi32(src_tmp);
+    }
+
+    *max_value = max_tmp;
+    *min_value = min_tmp;
+}
+
+SIMD_UTILS_API void threshold512_gt_s(int32_t *src, int32_t *dst, int len, int32_t value)
+{
+    const v16si tmp = _mm512_set1_epi32(value);
+
+    int stop_len = len / (2 * AVX512_LEN_INT32);
+    stop_len *= (2 * AVX512_LEN_INT32);
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX512_LEN_BYTES)) {
         for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT32) {
@@ -682,13 +1950,16 @@ static inline void threshold512_gt_s(int32_t *src, int32_t *dst, int len, int32_
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src[i] < value ? src[i] : value;
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT32) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16si src_tmp = _mm512_maskz_loadu_epi32(mask, src + i);
+        v16si dst_tmp = _mm512_min_epi32(src_tmp, tmp);
+        _mm512_mask_storeu_epi32(dst + i, mask, dst_tmp);
     }
 }
 
 
-static inline void threshold512_gtabs_s(int32_t *src, int32_t *dst, int len, int32_t value)
+SIMD_UTILS_API void threshold512_gtabs_s(int32_t *src, int32_t *dst, int len, int32_t value)
 {
     const v16si pval = _mm512_set1_epi32(value);
     const v16si mval = _mm512_set1_epi32(-value);
@@ -732,16 +2003,18 @@ static inline void threshold512_gtabs_s(int32_t *src, int32_t *dst, int len, int
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        if (src[i] >= 0) {
-            dst[i] = src[i] > value ? value : src[i];
-        } else {
-            dst[i] = src[i] < (-value) ? (-value) : src[i];
-        }
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT32) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16si src_tmp = _mm512_maskz_loadu_epi32(mask, src + i);
+        v16si src_abs = _mm512_abs_epi32(src_tmp);
+        __mmask16 eqmask = _mm512_cmp_epi32_mask(src_abs, src_tmp, _MM_CMPINT_EQ);
+        v16si max = _mm512_min_epi32(src_tmp, pval);
+        v16si min = _mm512_max_epi32(src_tmp, mval);
+        _mm512_mask_storeu_epi32(dst + i, mask, _mm512_mask_blend_epi32(eqmask, min, max));
     }
 }
 
-static inline void threshold512_lt_s(int32_t *src, int32_t *dst, int len, int32_t value)
+SIMD_UTILS_API void threshold512_lt_s(int32_t *src, int32_t *dst, int len, int32_t value)
 {
     const v16si tmp = _mm512_set1_epi32(value);
 
@@ -768,12 +2041,15 @@ static inline void threshold512_lt_s(int32_t *src, int32_t *dst, int len, int32_
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src[i] > value ? src[i] : value;
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT32) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16si src_tmp = _mm512_maskz_loadu_epi32(mask, src + i);
+        v16si dst_tmp = _mm512_max_epi32(src_tmp, tmp);
+        _mm512_mask_storeu_epi32(dst + i, mask, dst_tmp);
     }
 }
 
-static inline void threshold512_ltabs_s(int32_t *src, int32_t *dst, int len, int32_t value)
+SIMD_UTILS_API void threshold512_ltabs_s(int32_t *src, int32_t *dst, int len, int32_t value)
 {
     const v16si pval = _mm512_set1_epi32(value);
     const v16si mval = _mm512_set1_epi32(-value);
@@ -817,16 +2093,18 @@ static inline void threshold512_ltabs_s(int32_t *src, int32_t *dst, int len, int
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        if (src[i] >= 0) {
-            dst[i] = src[i] < value ? value : src[i];
-        } else {
-            dst[i] = src[i] > (-value) ? (-value) : src[i];
-        }
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT32) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16si src_tmp = _mm512_maskz_loadu_epi32(mask, src + i);
+        v16si src_abs = _mm512_abs_epi32(src_tmp);
+        __mmask16 eqmask = _mm512_cmp_epi32_mask(src_abs, src_tmp, _MM_CMPINT_EQ);
+        v16si max = _mm512_max_epi32(src_tmp, pval);
+        v16si min = _mm512_min_epi32(src_tmp, mval);
+        _mm512_mask_storeu_epi32(dst + i, mask, _mm512_mask_blend_epi32(eqmask, min, max));
     }
 }
 
-static inline void threshold512_ltval_gtval_s(int32_t *src, int32_t *dst, int len, int32_t ltlevel, int32_t ltvalue, int32_t gtlevel, int32_t gtvalue)
+SIMD_UTILS_API void threshold512_ltval_gtval_s(int32_t *src, int32_t *dst, int len, int32_t ltlevel, int32_t ltvalue, int32_t gtlevel, int32_t gtvalue)
 {
     const v16si ltlevel_v = _mm512_set1_epi32(ltlevel);
     const v16si ltvalue_v = _mm512_set1_epi32(ltvalue);
@@ -868,14 +2146,19 @@ static inline void threshold512_ltval_gtval_s(int32_t *src, int32_t *dst, int le
         }
     }
 
-    for (int i = stop_len; i < len; i++) {
-        dst[i] = src[i] < ltlevel ? ltvalue : src[i];
-        dst[i] = src[i] > gtlevel ? gtvalue : dst[i];
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT32) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16si src_tmp = _mm512_maskz_loadu_epi32(mask, src + i);
+        __mmask16 lt_mask = _mm512_cmp_epi32_mask(src_tmp, ltlevel_v, _MM_CMPINT_LT);
+        __mmask16 gt_mask = _mm512_cmp_epi32_mask(src_tmp, gtlevel_v, _MM_CMPINT_NLE);
+        v16si dst_tmp = _mm512_mask_blend_epi32(lt_mask, src_tmp, ltvalue_v);
+        dst_tmp = _mm512_mask_blend_epi32(gt_mask, dst_tmp, gtvalue_v);
+        _mm512_mask_storeu_epi32(dst + i, mask, dst_tmp);
     }
 }
 
 // is it useful to unroll?
-static inline void gatheri_512s(int32_t *src, int32_t *dst, int stride, int offset, int len)
+SIMD_UTILS_API void gatheri_512s(int32_t *src, int32_t *dst, int stride, int offset, int len)
 {
     int stop_len = len / (AVX512_LEN_INT32);
     stop_len *= (AVX512_LEN_INT32);
@@ -903,7 +2186,7 @@ static inline void gatheri_512s(int32_t *src, int32_t *dst, int stride, int offs
 }
 
 // is it useful to unroll?
-static inline void scatteri_512s(int32_t *src, int32_t *dst, int stride, int offset, int len)
+SIMD_UTILS_API void scatteri_512s(int32_t *src, int32_t *dst, int stride, int offset, int len)
 {
     int stop_len = len / (AVX512_LEN_INT32);
     stop_len *= (AVX512_LEN_INT32);
@@ -929,3 +2212,672 @@ static inline void scatteri_512s(int32_t *src, int32_t *dst, int stride, int off
         dst[i] = src[i * stride + offset];
     }
 }
+
+// first index of value in src, len if it is not found
+static inline int firsteq512s(int32_t *src, int len, int32_t value)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT32);
+    stop_len *= (2 * AVX512_LEN_INT32);
+
+    v16si value_v = _mm512_set1_epi32(value);
+    for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT32) {
+        uint32_t mask = (uint32_t) _mm512_cmpeq_epi32_mask(_mm512_loadu_si512((__m512i *) (src + i)), value_v);
+        mask |= (uint32_t) _mm512_cmpeq_epi32_mask(_mm512_loadu_si512((__m512i *) (src + i + AVX512_LEN_INT32)), value_v) << 16;
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT32) {
+        __mmask16 tail = tail_mask16(len - i);
+        __mmask16 mask = _mm512_mask_cmpeq_epi32_mask(tail, _mm512_maskz_loadu_epi32(tail, src + i), value_v);
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+    return len;
+}
+
+SIMD_UTILS_API void maxloc512s(int32_t *src, int32_t *max, int *idx, int len)
+{
+    minmaxloc_runs(src, len, minmax512s, firsteq512s, NULL, NULL, max, idx);
+}
+
+SIMD_UTILS_API void minloc512s(int32_t *src, int32_t *min, int *idx, int len)
+{
+    minmaxloc_runs(src, len, minmax512s, firsteq512s, min, idx, NULL, NULL);
+}
+
+SIMD_UTILS_API void minmaxloc512s(int32_t *src, int len, int32_t *min_value, int *min_idx, int32_t *max_value, int *max_idx)
+{
+    minmaxloc_runs(src, len, minmax512s, firsteq512s, min_value, min_idx, max_value, max_idx);
+}
+
+SIMD_UTILS_API void minmax16s_512s(int16_t *src, int len, int16_t *min_value, int16_t *max_value)
+{
+    int stop_len = (len - AVX512_LEN_INT16) / (2 * AVX512_LEN_INT16);
+    stop_len *= (2 * AVX512_LEN_INT16);
+    stop_len = (stop_len < 0) ? 0 : stop_len;
+
+    int16_t min_s[AVX512_LEN_INT16] __attribute__((aligned(AVX512_LEN_BYTES)));
+    int16_t max_s[AVX512_LEN_INT16] __attribute__((aligned(AVX512_LEN_BYTES)));
+    __m512i max_v, min_v, max_v2, min_v2;
+    __m512i src_tmp, src_tmp2;
+
+    int16_t min_tmp = src[0];
+    int16_t max_tmp = src[0];
+
+    if (len >= AVX512_LEN_INT16) {
+        if (isAligned((uintptr_t) (src), AVX512_LEN_BYTES)) {
+            src_tmp = _mm512_load_si512((__m512i *) (src + 0));
+            max_v = src_tmp;
+            min_v = src_tmp;
+            max_v2 = src_tmp;
+            min_v2 = src_tmp;
+
+            for (int i = AVX512_LEN_INT16; i < stop_len; i += 2 * AVX512_LEN_INT16) {
+                src_tmp = _mm512_load_si512((__m512i *) (src + i));
+                src_tmp2 = _mm512_load_si512((__m512i *) (src + i + AVX512_LEN_INT16));
+                max_v = _mm512_max_epi16(max_v, src_tmp);
+                min_v = _mm512_min_epi16(min_v, src_tmp);
+                max_v2 = _mm512_max_epi16(max_v2, src_tmp2);
+                min_v2 = _mm512_min_epi16(min_v2, src_tmp2);
+            }
+        } else {
+            src_tmp = _mm512_loadu_si512((__m512i *) (src + 0));
+            max_v = src_tmp;
+            min_v = src_tmp;
+            max_v2 = src_tmp;
+            min_v2 = src_tmp;
+
+            for (int i = AVX512_LEN_INT16; i < stop_len; i += 2 * AVX512_LEN_INT16) {
+                src_tmp = _mm512_loadu_si512((__m512i *) (src + i));
+                src_tmp2 = _mm512_loadu_si512((__m512i *) (src + i + AVX512_LEN_INT16));
+                max_v = _mm512_max_epi16(max_v, src_tmp);
+                min_v = _mm512_min_epi16(min_v, src_tmp);
+                max_v2 = _mm512_max_epi16(max_v2, src_tmp2);
+                min_v2 = _mm512_min_epi16(min_v2, src_tmp2);
+            }
+        }
+
+        for (int i = stop_len; i < len; i += AVX512_LEN_INT16) {
+            __mmask32 mask = tail_mask32(len - i);
+            src_tmp = _mm512_maskz_loadu_epi16(mask, src + i);
+            max_v = _mm512_mask_max_epi16(max_v, mask, max_v, src_tmp);
+            min_v = _mm512_mask_min_epi16(min_v, mask, min_v, src_tmp);
+        }
+
+        max_v = _mm512_max_epi16(max_v, max_v2);
+        min_v = _mm512_min_epi16(min_v, min_v2);
+
+        _mm512_store_si512((__m512i *) (max_s), max_v);
+        _mm512_store_si512((__m512i *) (min_s), min_v);
+
+        max_tmp = max_s[0];
+        min_tmp = min_s[0];
+        for (int i = 1; i < AVX512_LEN_INT16; i++) {
+            max_tmp = max_tmp > max_s[i] ? max_tmp : max_s[i];
+            min_tmp = min_tmp < min_s[i] ? min_tmp : min_s[i];
+        }
+    } else {
+        for (int i = 1; i < len; i++) {
+            max_tmp = max_tmp > src[i] ? max_tmp : src[i];
+            min_tmp = min_tmp < src[i] ? min_tmp : src[i];
+        }
+    }
+
+    *max_value = max_tmp;
+    *min_value = min_tmp;
+}
+
+// first index of value in src, len if it is not found
+static inline int firsteq16s_512s(int16_t *src, int len, int16_t value)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT16);
+    stop_len *= (2 * AVX512_LEN_INT16);
+
+    __m512i value_v = _mm512_set1_epi16(value);
+    for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT16) {
+        uint64_t mask = (uint64_t) _mm512_cmpeq_epi16_mask(_mm512_loadu_si512((__m512i *) (src + i)), value_v);
+        mask |= (uint64_t) _mm512_cmpeq_epi16_mask(_mm512_loadu_si512((__m512i *) (src + i + AVX512_LEN_INT16)), value_v) << 32;
+        if (mask)
+            return i + __builtin_ctzll(mask);
+    }
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT16) {
+        __mmask32 tail = tail_mask32(len - i);
+        __mmask32 mask = _mm512_mask_cmpeq_epi16_mask(tail, _mm512_maskz_loadu_epi16(tail, src + i), value_v);
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+    return len;
+}
+
+SIMD_UTILS_API void maxloc16s_512s(int16_t *src, int16_t *max, int *idx, int len)
+{
+    minmaxloc_run16s(src, len, minmax16s_512s, firsteq16s_512s, NULL, NULL, max, idx);
+}
+
+SIMD_UTILS_API void minloc16s_512s(int16_t *src, int16_t *min, int *idx, int len)
+{
+    minmaxloc_run16s(src, len, minmax16s_512s, firsteq16s_512s, min, idx, NULL, NULL);
+}
+
+SIMD_UTILS_API void minmaxloc16s_512s(int16_t *src, int len, int16_t *min_value, int *min_idx, int16_t *max_value, int *max_idx)
+{
+    minmaxloc_run16s(src, len, minmax16s_512s, firsteq16s_512s, min_value, min_idx, max_value, max_idx);
+}
+
+// bins of histogram512s and histogram16s_512s, *in the lanes inside of the bins
+static inline v16si hist_bin512s(v16si x, v16si low_vec, __m128i shift, v16si nb_vec, __mmask16 *in)
+{
+    v16si bin = _mm512_sra_epi32(_mm512_sub_epi32(x, low_vec), shift);  // negative below low
+    *in = _mm512_cmplt_epu32_mask(bin, nb_vec);
+    return bin;
+}
+
+SIMD_UTILS_API void histogram512s(int32_t *src, int len, int32_t low, int shift, int nb_bins, uint32_t *hist)
+{
+    int stop_len = len / AVX512_LEN_INT32;
+    stop_len *= AVX512_LEN_INT32;
+
+    v16si low_vec = _mm512_set1_epi32((int32_t) low);
+    __m128i shift_vec = _mm_cvtsi32_si128(shift);
+    v16si nb_vec = _mm512_set1_epi32(nb_bins);
+
+    if (isAligned((uintptr_t) (src), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_INT32) {
+            __mmask16 in;
+            v16si bin = hist_bin512s(_mm512_load_si512((v16si *) (src + i)), low_vec, shift_vec, nb_vec, &in);
+            hist_add512(hist, bin, in);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_INT32) {
+            __mmask16 in;
+            v16si bin = hist_bin512s(_mm512_loadu_si512((v16si *) (src + i)), low_vec, shift_vec, nb_vec, &in);
+            hist_add512(hist, bin, in);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT32) {
+        __mmask16 mask = tail_mask16(len - i);
+        __mmask16 in;
+        v16si bin = hist_bin512s(_mm512_maskz_loadu_epi32(mask, src + i), low_vec, shift_vec, nb_vec, &in);
+        hist_add512(hist, bin, in & mask);
+    }
+}
+
+SIMD_UTILS_API void histogram16s_512s(int16_t *src, int len, int16_t low, int shift, int nb_bins, uint32_t *hist)
+{
+    int stop_len = len / AVX512_LEN_INT16;
+    stop_len *= AVX512_LEN_INT16;
+
+    v16si low_vec = _mm512_set1_epi32((int32_t) low);
+    __m128i shift_vec = _mm_cvtsi32_si128(shift);
+    v16si nb_vec = _mm512_set1_epi32(nb_bins);
+
+    if (isAligned((uintptr_t) (src), AVX512_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_INT16) {
+            __mmask16 in;
+            v16si x = _mm512_load_si512((v16si *) (src + i));
+            v16si bin = hist_bin512s(_mm512_cvtepi16_epi32(_mm512_castsi512_si256(x)), low_vec, shift_vec, nb_vec, &in);
+            hist_add512(hist, bin, in);
+            bin = hist_bin512s(_mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(x, 1)), low_vec, shift_vec, nb_vec, &in);
+            hist_add512(hist, bin, in);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX512_LEN_INT16) {
+            __mmask16 in;
+            v16si x = _mm512_loadu_si512((v16si *) (src + i));
+            v16si bin = hist_bin512s(_mm512_cvtepi16_epi32(_mm512_castsi512_si256(x)), low_vec, shift_vec, nb_vec, &in);
+            hist_add512(hist, bin, in);
+            bin = hist_bin512s(_mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(x, 1)), low_vec, shift_vec, nb_vec, &in);
+            hist_add512(hist, bin, in);
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT32) {
+        __mmask16 mask = tail_mask16(len - i);
+        __mmask16 in;
+        v16si x = _mm512_cvtepi16_epi32(_mm256_maskz_loadu_epi16(mask, src + i));
+        v16si bin = hist_bin512s(x, low_vec, shift_vec, nb_vec, &in);
+        hist_add512(hist, bin, in & mask);
+    }
+}
+
+// the gather/scatter of the conflict detection are about twice slower than the sub-histograms for 256 bins
+SIMD_UTILS_API void histogramu8_512(uint8_t *src, int len, uint32_t *hist)
+{
+    hist_count_u8(src, len, hist);
+}
+
+// inclusive prefix sum of the lanes of x
+static inline v16si prefix_lanes512s(v16si x)
+{
+    v16si zero = _mm512_setzero_si512();
+    x = _mm512_add_epi32(x, _mm512_alignr_epi32(x, zero, 15));
+    x = _mm512_add_epi32(x, _mm512_alignr_epi32(x, zero, 14));
+    x = _mm512_add_epi32(x, _mm512_alignr_epi32(x, zero, 12));
+    x = _mm512_add_epi32(x, _mm512_alignr_epi32(x, zero, 8));
+    return x;
+}
+
+// last lane of x in all the lanes
+static inline v16si last_lane512s(v16si x)
+{
+    return _mm512_permutexvar_epi32(_mm512_set1_epi32(15), x);
+}
+
+// lanes of x moved up by one, the first lane getting the last lane of prev
+static inline v16si shift_lane512s(v16si x, v16si prev)
+{
+    return _mm512_alignr_epi32(x, prev, 15);
+}
+
+// prefix sums of src (see simd_utils.h), exclusive when exclusive is set
+static inline void prefixsum512s_run(int32_t *src, int32_t *dst, int len, int32_t *carry, int exclusive)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT32);
+    stop_len *= (2 * AVX512_LEN_INT32);
+
+    v16si carry_vec = _mm512_set1_epi32(carry ? *carry : 0);
+
+    // the carry only waits for one add per pair of vectors
+    for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT32) {
+        v16si a = prefix_lanes512s(_mm512_loadu_si512((v16si *) (src + i)));
+        v16si b = prefix_lanes512s(_mm512_loadu_si512((v16si *) (src + i + AVX512_LEN_INT32)));
+        b = _mm512_add_epi32(b, last_lane512s(a));
+        v16si last = last_lane512s(b);
+        a = _mm512_add_epi32(a, carry_vec);
+        b = _mm512_add_epi32(b, carry_vec);
+        if (exclusive) {
+            _mm512_storeu_si512((v16si *) (dst + i), shift_lane512s(a, carry_vec));
+            _mm512_storeu_si512((v16si *) (dst + i + AVX512_LEN_INT32), shift_lane512s(b, a));
+        } else {
+            _mm512_storeu_si512((v16si *) (dst + i), a);
+            _mm512_storeu_si512((v16si *) (dst + i + AVX512_LEN_INT32), b);
+        }
+        carry_vec = _mm512_add_epi32(carry_vec, last);
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT32) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16si a = prefix_lanes512s(_mm512_maskz_loadu_epi32(mask, src + i));  // the masked out lanes are 0
+        v16si last = last_lane512s(a);
+        a = _mm512_add_epi32(a, carry_vec);
+        if (exclusive) {
+            _mm512_mask_storeu_epi32(dst + i, mask, shift_lane512s(a, carry_vec));
+        } else {
+            _mm512_mask_storeu_epi32(dst + i, mask, a);
+        }
+        carry_vec = _mm512_add_epi32(carry_vec, last);
+    }
+
+    if (carry)
+        *carry = _mm_cvtsi128_si32(_mm512_castsi512_si128(carry_vec));
+}
+
+SIMD_UTILS_API void prefixsum512s(int32_t *src, int32_t *dst, int len, int32_t *carry)
+{
+    prefixsum512s_run(src, dst, len, carry, 0);
+}
+
+SIMD_UTILS_API void prefixsum512s_excl(int32_t *src, int32_t *dst, int len, int32_t *carry)
+{
+    prefixsum512s_run(src, dst, len, carry, 1);
+}
+
+SIMD_UTILS_API void diff512s(int32_t *src, int32_t *dst, int len, int32_t *prev)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT32);
+    stop_len *= (2 * AVX512_LEN_INT32);
+
+    int32_t prev_tmp = prev ? *prev : 0;
+    int32_t last = (len > 0) ? src[len - 1] : prev_tmp;  // before src is overwritten by dst
+    v16si prev_vec = _mm512_set1_epi32(prev_tmp);
+
+    for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT32) {
+        v16si a = _mm512_loadu_si512((v16si *) (src + i));
+        v16si b = _mm512_loadu_si512((v16si *) (src + i + AVX512_LEN_INT32));
+        _mm512_storeu_si512((v16si *) (dst + i), _mm512_sub_epi32(a, shift_lane512s(a, prev_vec)));
+        _mm512_storeu_si512((v16si *) (dst + i + AVX512_LEN_INT32), _mm512_sub_epi32(b, shift_lane512s(b, a)));
+        prev_vec = b;
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT32) {
+        __mmask16 mask = tail_mask16(len - i);
+        v16si a = _mm512_maskz_loadu_epi32(mask, src + i);
+        _mm512_mask_storeu_epi32(dst + i, mask, _mm512_sub_epi32(a, shift_lane512s(a, prev_vec)));
+        prev_vec = a;
+    }
+
+    if (prev)
+        *prev = last;
+}
+
+// inclusive prefix sum of the lanes of x (no alignr of 16 bits elements, vpermw instead)
+static inline __m512i prefix_lanes16s_512s(__m512i x)
+{
+    const __m512i iota = _mm512_set_epi16(31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16,
+                                          15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    for (int k = 1; k < AVX512_LEN_INT16; k *= 2) {
+        __m512i idx = _mm512_sub_epi16(iota, _mm512_set1_epi16((int16_t) k));
+        x = _mm512_add_epi16(x, _mm512_maskz_permutexvar_epi16((__mmask32) (0xFFFFFFFFU << k), idx, x));
+    }
+    return x;
+}
+
+// last lane of x in all the lanes
+static inline __m512i last_lane16s_512s(__m512i x)
+{
+    return _mm512_permutexvar_epi16(_mm512_set1_epi16(31), x);
+}
+
+// lanes of x moved up by one, the first lane getting the last lane of prev
+static inline __m512i shift_lane16s_512s(__m512i x, __m512i prev)
+{
+    const __m512i idx = _mm512_set_epi16(30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15,
+                                         14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 63);
+    return _mm512_permutex2var_epi16(x, idx, prev);
+}
+
+// prefix sums of src (see simd_utils.h), exclusive when exclusive is set
+static inline void prefixsum16s_512s_run(int16_t *src, int16_t *dst, int len, int16_t *carry, int exclusive)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT16);
+    stop_len *= (2 * AVX512_LEN_INT16);
+
+    __m512i carry_vec = _mm512_set1_epi16(carry ? *carry : 0);
+
+    // the carry only waits for one add per pair of vectors
+    for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT16) {
+        __m512i a = prefix_lanes16s_512s(_mm512_loadu_si512((__m512i *) (src + i)));
+        __m512i b = prefix_lanes16s_512s(_mm512_loadu_si512((__m512i *) (src + i + AVX512_LEN_INT16)));
+        b = _mm512_add_epi16(b, last_lane16s_512s(a));
+        __m512i last = last_lane16s_512s(b);
+        a = _mm512_add_epi16(a, carry_vec);
+        b = _mm512_add_epi16(b, carry_vec);
+        if (exclusive) {
+            _mm512_storeu_si512((__m512i *) (dst + i), shift_lane16s_512s(a, carry_vec));
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT16), shift_lane16s_512s(b, a));
+        } else {
+            _mm512_storeu_si512((__m512i *) (dst + i), a);
+            _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT16), b);
+        }
+        carry_vec = _mm512_add_epi16(carry_vec, last);
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT16) {
+        __mmask32 mask = tail_mask32(len - i);
+        __m512i a = prefix_lanes16s_512s(_mm512_maskz_loadu_epi16(mask, src + i));  // the masked out lanes are 0
+        __m512i last = last_lane16s_512s(a);
+        a = _mm512_add_epi16(a, carry_vec);
+        if (exclusive) {
+            _mm512_mask_storeu_epi16(dst + i, mask, shift_lane16s_512s(a, carry_vec));
+        } else {
+            _mm512_mask_storeu_epi16(dst + i, mask, a);
+        }
+        carry_vec = _mm512_add_epi16(carry_vec, last);
+    }
+
+    if (carry)
+        *carry = (int16_t) _mm_cvtsi128_si32(_mm512_castsi512_si128(carry_vec));
+}
+
+SIMD_UTILS_API void prefixsum16s_512s(int16_t *src, int16_t *dst, int len, int16_t *carry)
+{
+    prefixsum16s_512s_run(src, dst, len, carry, 0);
+}
+
+SIMD_UTILS_API void prefixsum16s_512s_excl(int16_t *src, int16_t *dst, int len, int16_t *carry)
+{
+    prefixsum16s_512s_run(src, dst, len, carry, 1);
+}
+
+SIMD_UTILS_API void diff16s_512s(int16_t *src, int16_t *dst, int len, int16_t *prev)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT16);
+    stop_len *= (2 * AVX512_LEN_INT16);
+
+    int16_t prev_tmp = prev ? *prev : 0;
+    int16_t last = (len > 0) ? src[len - 1] : prev_tmp;  // before src is overwritten by dst
+    __m512i prev_vec = _mm512_set1_epi16(prev_tmp);
+
+    for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT16) {
+        __m512i a = _mm512_loadu_si512((__m512i *) (src + i));
+        __m512i b = _mm512_loadu_si512((__m512i *) (src + i + AVX512_LEN_INT16));
+        _mm512_storeu_si512((__m512i *) (dst + i), _mm512_sub_epi16(a, shift_lane16s_512s(a, prev_vec)));
+        _mm512_storeu_si512((__m512i *) (dst + i + AVX512_LEN_INT16), _mm512_sub_epi16(b, shift_lane16s_512s(b, a)));
+        prev_vec = b;
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT16) {
+        __mmask32 mask = tail_mask32(len - i);
+        __m512i a = _mm512_maskz_loadu_epi16(mask, src + i);
+        _mm512_mask_storeu_epi16(dst + i, mask, _mm512_sub_epi16(a, shift_lane16s_512s(a, prev_vec)));
+        prev_vec = a;
+    }
+
+    if (prev)
+        *prev = last;
+}
+
+// bitonic sort of the lanes of x
+static inline v16si sort_lanes512s(v16si x)
+{
+    v16si p;
+    p = _mm512_shuffle_epi32(x, (_MM_PERM_ENUM) _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm512_mask_blend_epi32(0x6666, _mm512_min_epi32(x, p), _mm512_max_epi32(x, p));
+    p = _mm512_shuffle_epi32(x, (_MM_PERM_ENUM) _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm512_mask_blend_epi32(0x3C3C, _mm512_min_epi32(x, p), _mm512_max_epi32(x, p));
+    p = _mm512_shuffle_epi32(x, (_MM_PERM_ENUM) _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm512_mask_blend_epi32(0x5A5A, _mm512_min_epi32(x, p), _mm512_max_epi32(x, p));
+    p = _mm512_shuffle_i32x4(x, x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm512_mask_blend_epi32(0xFF0, _mm512_min_epi32(x, p), _mm512_max_epi32(x, p));
+    p = _mm512_shuffle_epi32(x, (_MM_PERM_ENUM) _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm512_mask_blend_epi32(0x33CC, _mm512_min_epi32(x, p), _mm512_max_epi32(x, p));
+    p = _mm512_shuffle_epi32(x, (_MM_PERM_ENUM) _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm512_mask_blend_epi32(0x55AA, _mm512_min_epi32(x, p), _mm512_max_epi32(x, p));
+    p = _mm512_shuffle_i32x4(x, x, _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm512_mask_blend_epi32(0xFF00, _mm512_min_epi32(x, p), _mm512_max_epi32(x, p));
+    p = _mm512_shuffle_i32x4(x, x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm512_mask_blend_epi32(0xF0F0, _mm512_min_epi32(x, p), _mm512_max_epi32(x, p));
+    p = _mm512_shuffle_epi32(x, (_MM_PERM_ENUM) _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm512_mask_blend_epi32(0xCCCC, _mm512_min_epi32(x, p), _mm512_max_epi32(x, p));
+    p = _mm512_shuffle_epi32(x, (_MM_PERM_ENUM) _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm512_mask_blend_epi32(0xAAAA, _mm512_min_epi32(x, p), _mm512_max_epi32(x, p));
+    return x;
+}
+
+// sorts the lanes of x, which are a bitonic sequence
+static inline v16si sort_clean512s(v16si x)
+{
+    v16si p;
+    p = _mm512_shuffle_i32x4(x, x, _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm512_mask_blend_epi32(0xFF00, _mm512_min_epi32(x, p), _mm512_max_epi32(x, p));
+    p = _mm512_shuffle_i32x4(x, x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm512_mask_blend_epi32(0xF0F0, _mm512_min_epi32(x, p), _mm512_max_epi32(x, p));
+    p = _mm512_shuffle_epi32(x, (_MM_PERM_ENUM) _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm512_mask_blend_epi32(0xCCCC, _mm512_min_epi32(x, p), _mm512_max_epi32(x, p));
+    p = _mm512_shuffle_epi32(x, (_MM_PERM_ENUM) _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm512_mask_blend_epi32(0xAAAA, _mm512_min_epi32(x, p), _mm512_max_epi32(x, p));
+    return x;
+}
+
+// merges the sorted vectors a and b, a getting the lowest half
+static inline void sort_merge2512s(v16si *a, v16si *b)
+{
+    v16si rev = _mm512_permutexvar_epi32(_mm512_set_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), *b);
+    v16si low = _mm512_min_epi32(*a, rev);
+    v16si high = _mm512_max_epi32(*a, rev);
+    *a = sort_clean512s(low);
+    *b = sort_clean512s(high);
+}
+
+// merges the sorted sequences (a, b) and (c, d)
+static inline void sort_merge4512s(v16si *a, v16si *b, v16si *c, v16si *d)
+{
+    v16si rev_c = _mm512_permutexvar_epi32(_mm512_set_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), *d);
+    v16si rev_d = _mm512_permutexvar_epi32(_mm512_set_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), *c);
+    v16si low0 = _mm512_min_epi32(*a, rev_c);
+    v16si high0 = _mm512_max_epi32(*a, rev_c);
+    v16si low1 = _mm512_min_epi32(*b, rev_d);
+    v16si high1 = _mm512_max_epi32(*b, rev_d);
+    *a = sort_clean512s(_mm512_min_epi32(low0, low1));
+    *b = sort_clean512s(_mm512_max_epi32(low0, low1));
+    *c = sort_clean512s(_mm512_min_epi32(high0, high1));
+    *d = sort_clean512s(_mm512_max_epi32(high0, high1));
+}
+
+// sorts up to 4 vectors, padded with the largest value
+static inline void sort_small512s(int32_t *src, int len)
+{
+    int32_t tmp[4 * AVX512_LEN_INT32] __attribute__((aligned(AVX512_LEN_BYTES)));
+
+    memcpy(tmp, src, len * sizeof(int32_t));
+    for (int i = len; i < 4 * AVX512_LEN_INT32; i++) {
+        tmp[i] = INT32_MAX;
+    }
+
+    v16si a = sort_lanes512s(_mm512_loadu_si512((v16si *) (tmp)));
+    if (len <= AVX512_LEN_INT32) {
+        _mm512_storeu_si512((v16si *) (tmp), a);
+    } else if (len <= 2 * AVX512_LEN_INT32) {
+        v16si b = sort_lanes512s(_mm512_loadu_si512((v16si *) (tmp + AVX512_LEN_INT32)));
+        sort_merge2512s(&a, &b);
+        _mm512_storeu_si512((v16si *) (tmp), a);
+        _mm512_storeu_si512((v16si *) (tmp + AVX512_LEN_INT32), b);
+    } else {
+        v16si b = sort_lanes512s(_mm512_loadu_si512((v16si *) (tmp + AVX512_LEN_INT32)));
+        v16si c = sort_lanes512s(_mm512_loadu_si512((v16si *) (tmp + 2 * AVX512_LEN_INT32)));
+        v16si d = sort_lanes512s(_mm512_loadu_si512((v16si *) (tmp + 3 * AVX512_LEN_INT32)));
+        sort_merge2512s(&a, &b);
+        sort_merge2512s(&c, &d);
+        sort_merge4512s(&a, &b, &c, &d);
+        _mm512_storeu_si512((v16si *) (tmp), a);
+        _mm512_storeu_si512((v16si *) (tmp + AVX512_LEN_INT32), b);
+        _mm512_storeu_si512((v16si *) (tmp + 2 * AVX512_LEN_INT32), c);
+        _mm512_storeu_si512((v16si *) (tmp + 3 * AVX512_LEN_INT32), d);
+    }
+
+    memcpy(src, tmp, len * sizeof(int32_t));
+}
+
+// packs the lanes of x lower than the pivot to [*left_w, ...) and the others to [..., *right_w)
+static inline void partition_store512s(int32_t *src, v16si x, v16si pivot_vec, int *left_w, int *right_w)
+{
+    __mmask16 mask = _mm512_cmplt_epi32_mask(x, pivot_vec);
+    int nb_low = __builtin_popcount(mask);
+    int nb_high = AVX512_LEN_INT32 - nb_low;
+
+    // the full vector is stored on the left (free space of a vector at least), masked on the right
+    _mm512_storeu_si512((v16si *) (src + *left_w), _mm512_maskz_compress_epi32(mask, x));
+    _mm512_mask_storeu_epi32(src + *right_w - nb_high, tail_mask16(nb_high), _mm512_maskz_compress_epi32((__mmask16) ~mask, x));
+    *left_w += nb_low;
+    *right_w -= nb_high;
+}
+
+// number of elements lower than pivot, moved to the beginning of src (len >= 2 * AVX512_LEN_INT32)
+static inline int partition512s(int32_t *src, int len, int32_t pivot)
+{
+    v16si pivot_vec = _mm512_set1_epi32(pivot);
+    v16si first = _mm512_loadu_si512((v16si *) (src));
+    v16si last = _mm512_loadu_si512((v16si *) (src + len - AVX512_LEN_INT32));
+    int left = AVX512_LEN_INT32, right = len - 2 * AVX512_LEN_INT32;  // next vectors read from each end
+    int left_w = 0, right_w = len;             // free space [left_w, left) and [right + AVX512_LEN_INT32, right_w)
+
+    while (left <= right) {
+        v16si x;
+        if ((left - left_w) <= (right_w - right - AVX512_LEN_INT32)) {
+            x = _mm512_loadu_si512((v16si *) (src + left));
+            left += AVX512_LEN_INT32;
+        } else {
+            x = _mm512_loadu_si512((v16si *) (src + right));
+            right -= AVX512_LEN_INT32;
+        }
+        partition_store512s(src, x, pivot_vec, &left_w, &right_w);
+    }
+
+    // the last elements (less than a vector) with the first and the last vectors
+    int32_t tmp[3 * AVX512_LEN_INT32];
+    int nb_tmp = right + AVX512_LEN_INT32 - left;
+    memcpy(tmp, src + left, nb_tmp * sizeof(int32_t));
+    _mm512_storeu_si512((v16si *) (tmp + nb_tmp), first);
+    _mm512_storeu_si512((v16si *) (tmp + nb_tmp + AVX512_LEN_INT32), last);
+    sort_partition_tails(src, tmp, nb_tmp + 2 * AVX512_LEN_INT32, pivot, &left_w, &right_w);
+    return left_w;
+}
+
+SIMD_UTILS_API void sort512s(int32_t *src, int len)
+{
+    sort_runs(src, len, 4 * AVX512_LEN_INT32, partition512s, sort_small512s);
+}
+
+// indices of the elements of src greater than threshold (see simd_utils_topk.h)
+static inline int filter_gt512s(int32_t *src, int len, int32_t threshold, int32_t *idx)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT32);
+    stop_len *= (2 * AVX512_LEN_INT32);
+    v16si thr = _mm512_set1_epi32(threshold);
+    int nb = 0;
+
+    for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT32) {
+        v16si x0 = _mm512_loadu_si512((v16si *) (src + i));
+        v16si x1 = _mm512_loadu_si512((v16si *) (src + i + AVX512_LEN_INT32));
+        uint32_t mask = (uint32_t) _mm512_cmpgt_epi32_mask(x0, thr) | ((uint32_t) _mm512_cmpgt_epi32_mask(x1, thr) << AVX512_LEN_INT32);
+        while (mask) {
+            idx[nb++] = i + __builtin_ctz(mask);
+            mask &= mask - 1;
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT32) {
+        __mmask16 tail = tail_mask16(len - i);
+        uint32_t mask = _mm512_mask_cmpgt_epi32_mask(tail, _mm512_maskz_loadu_epi32(tail, src + i), thr);
+        while (mask) {
+            idx[nb++] = i + __builtin_ctz(mask);
+            mask &= mask - 1;
+        }
+    }
+    return nb;
+}
+
+// indices of the elements of src lower than threshold (see simd_utils_topk.h)
+static inline int filter_lt512s(int32_t *src, int len, int32_t threshold, int32_t *idx)
+{
+    int stop_len = len / (2 * AVX512_LEN_INT32);
+    stop_len *= (2 * AVX512_LEN_INT32);
+    v16si thr = _mm512_set1_epi32(threshold);
+    int nb = 0;
+
+    for (int i = 0; i < stop_len; i += 2 * AVX512_LEN_INT32) {
+        v16si x0 = _mm512_loadu_si512((v16si *) (src + i));
+        v16si x1 = _mm512_loadu_si512((v16si *) (src + i + AVX512_LEN_INT32));
+        uint32_t mask = (uint32_t) _mm512_cmplt_epi32_mask(x0, thr) | ((uint32_t) _mm512_cmplt_epi32_mask(x1, thr) << AVX512_LEN_INT32);
+        while (mask) {
+            idx[nb++] = i + __builtin_ctz(mask);
+            mask &= mask - 1;
+        }
+    }
+
+    for (int i = stop_len; i < len; i += AVX512_LEN_INT32) {
+        __mmask16 tail = tail_mask16(len - i);
+        uint32_t mask = _mm512_mask_cmplt_epi32_mask(tail, _mm512_maskz_loadu_epi32(tail, src + i), thr);
+        while (mask) {
+            idx[nb++] = i + __builtin_ctz(mask);
+            mask &= mask - 1;
+        }
+    }
+    return nb;
+}
+
+SIMD_UTILS_API void topk512s(int32_t *src, int len, int k, int32_t *dst, int32_t *idx)
+{
+    topk_runs(src, len, k, dst, idx, 1, filter_gt512s);
+}
+
+SIMD_UTILS_API void bottomk512s(int32_t *src, int len, int k, int32_t *dst, int32_t *idx)
+{
+    topk_runs(src, len, k, dst, idx, 0, filter_lt512s);
+}
+
+SIMD_UTILS_API void partialsort512s(int32_t *src, int len, int k)
+{
+    partialsort_runs(src, len, k, 4 * AVX512_LEN_INT32, partition512s, sort_small512s);
+}
@@ -18,7 +18,7 @@
 #include <string.h>
 
 #ifdef __AVX2__
-size_t strnlen_s_512(const char *s, size_t maxlen) {
+SIMD_UTILS_API size_t strnlen_s_512(const char *s, size_t maxlen) {
     if (s == NULL)
         return 0;
 
@@ -67,7 +67,7 @@ size_t strnlen_s_512(const char *s, size_t maxlen) {
 		stop_len+=16;
 	}
 
-    for (int i = stop_len; i < maxlen; i++) {
+    for (size_t i = stop_len; i < maxlen; i++) {
 		if (s[i] == '\0') {
             return i;
         }
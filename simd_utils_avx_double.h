@@ -10,7 +10,7 @@
 #include <stdint.h>
 #include "immintrin.h"
 
-static inline void set256d(double *dst, double value, int len)
+SIMD_UTILS_API void set256d(double *dst, double value, int len)
 {
     const v4sd tmp = _mm256_set1_pd(value);
 
@@ -18,8 +18,15 @@ static inline void set256d(double *dst, double value, int len)
     stop_len *= AVX_LEN_DOUBLE;
 
     if (isAligned((uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
-            _mm256_store_pd(dst + i, tmp);
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                _mm256_stream_pd(dst + i, tmp);
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                _mm256_store_pd(dst + i, tmp);
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
@@ -32,7 +39,7 @@ static inline void set256d(double *dst, double value, int len)
     }
 }
 
-static inline void zero256d(double *dst, int len)
+SIMD_UTILS_API void zero256d(double *dst, int len)
 {
     const v4sd tmp = _mm256_setzero_pd();
 
@@ -40,8 +47,15 @@ static inline void zero256d(double *dst, int len)
     stop_len *= AVX_LEN_DOUBLE;
 
     if (isAligned((uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
-            _mm256_store_pd(dst + i, tmp);
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                _mm256_stream_pd(dst + i, tmp);
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                _mm256_store_pd(dst + i, tmp);
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
@@ -54,14 +68,21 @@ static inline void zero256d(double *dst, int len)
     }
 }
 
-static inline void copy256d(double *src, double *dst, int len)
+SIMD_UTILS_API void copy256d(double *src, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
-            _mm256_store_pd(dst + i, _mm256_load_pd(src + i));
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                _mm256_stream_pd(dst + i, _mm256_load_pd(src + i));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                _mm256_store_pd(dst + i, _mm256_load_pd(src + i));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
@@ -74,14 +95,21 @@ static inline void copy256d(double *src, double *dst, int len)
     }
 }
 
-static inline void sqrt256d(double *src, double *dst, int len)
+SIMD_UTILS_API void sqrt256d(double *src, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
-            _mm256_store_pd(dst + i, _mm256_sqrt_pd(_mm256_load_pd(src + i)));
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                _mm256_stream_pd(dst + i, _mm256_sqrt_pd(_mm256_load_pd(src + i)));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                _mm256_store_pd(dst + i, _mm256_sqrt_pd(_mm256_load_pd(src + i)));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
@@ -94,7 +122,49 @@ static inline void sqrt256d(double *src, double *dst, int len)
     }
 }
 
-static inline void add256d(double *src1, double *src2, double *dst, int len)
+SIMD_UTILS_API void fabs256d(double *src, double *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_DOUBLE);
+    stop_len *= (2 * AVX_LEN_DOUBLE);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                v4sd src_tmp2 = _mm256_load_pd(src + i + AVX_LEN_DOUBLE);
+                v4sd dst_tmp = _mm256_and_pd(*(v4sd *) _pd256_positive_mask, src_tmp);
+                v4sd dst_tmp2 = _mm256_and_pd(*(v4sd *) _pd256_positive_mask, src_tmp2);
+                _mm256_stream_pd(dst + i, dst_tmp);
+                _mm256_stream_pd(dst + i + AVX_LEN_DOUBLE, dst_tmp2);
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                v4sd src_tmp2 = _mm256_load_pd(src + i + AVX_LEN_DOUBLE);
+                v4sd dst_tmp = _mm256_and_pd(*(v4sd *) _pd256_positive_mask, src_tmp);
+                v4sd dst_tmp2 = _mm256_and_pd(*(v4sd *) _pd256_positive_mask, src_tmp2);
+                _mm256_store_pd(dst + i, dst_tmp);
+                _mm256_store_pd(dst + i + AVX_LEN_DOUBLE, dst_tmp2);
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd src_tmp = _mm256_loadu_pd(src + i);
+            v4sd src_tmp2 = _mm256_loadu_pd(src + i + AVX_LEN_DOUBLE);
+            v4sd dst_tmp = _mm256_and_pd(*(v4sd *) _pd256_positive_mask, src_tmp);
+            v4sd dst_tmp2 = _mm256_and_pd(*(v4sd *) _pd256_positive_mask, src_tmp2);
+            _mm256_storeu_pd(dst + i, dst_tmp);
+            _mm256_storeu_pd(dst + i + AVX_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = fabs(src[i]);
+    }
+}
+
+SIMD_UTILS_API void add256d(double *src1, double *src2, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -114,7 +184,7 @@ static inline void add256d(double *src1, double *src2, double *dst, int len)
     }
 }
 
-static inline void mul256d(double *src1, double *src2, double *dst, int len)
+SIMD_UTILS_API void mul256d(double *src1, double *src2, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -134,7 +204,7 @@ static inline void mul256d(double *src1, double *src2, double *dst, int len)
     }
 }
 
-static inline void sub256d(double *src1, double *src2, double *dst, int len)
+SIMD_UTILS_API void sub256d(double *src1, double *src2, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -154,7 +224,7 @@ static inline void sub256d(double *src1, double *src2, double *dst, int len)
     }
 }
 
-static inline void div256d(double *src1, double *src2, double *dst, int len)
+SIMD_UTILS_API void div256d(double *src1, double *src2, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -175,7 +245,7 @@ static inline void div256d(double *src1, double *src2, double *dst, int len)
 }
 
 // TODO : "Immediate add/mul?"
-static inline void addc256d(double *src, double value, double *dst, int len)
+SIMD_UTILS_API void addc256d(double *src, double value, double *dst, int len)
 {
     const v4sd tmp = _mm256_set1_pd(value);
 
@@ -197,7 +267,7 @@ static inline void addc256d(double *src, double value, double *dst, int len)
     }
 }
 
-static inline void mulc256d(double *src, double value, double *dst, int len)
+SIMD_UTILS_API void mulc256d(double *src, double value, double *dst, int len)
 {
     const v4sd tmp = _mm256_set1_pd(value);
 
@@ -219,7 +289,7 @@ static inline void mulc256d(double *src, double value, double *dst, int len)
     }
 }
 
-static inline void muladd256d(double *_a, double *_b, double *_c, double *dst, int len)
+SIMD_UTILS_API void muladd256d(double *_a, double *_b, double *_c, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -246,7 +316,7 @@ static inline void muladd256d(double *_a, double *_b, double *_c, double *dst, i
     }
 }
 
-static inline void mulcadd256d(double *_a, double _b, double *_c, double *dst, int len)
+SIMD_UTILS_API void mulcadd256d(double *_a, double _b, double *_c, double *dst, int len)
 {
     v4sd b = _mm256_set1_pd(_b);
 
@@ -272,7 +342,7 @@ static inline void mulcadd256d(double *_a, double _b, double *_c, double *dst, i
     }
 }
 
-static inline void mulcaddc256d(double *_a, double _b, double _c, double *dst, int len)
+SIMD_UTILS_API void mulcaddc256d(double *_a, double _b, double _c, double *dst, int len)
 {
     v4sd b = _mm256_set1_pd(_b);
     v4sd c = _mm256_set1_pd(_c);
@@ -297,7 +367,7 @@ static inline void mulcaddc256d(double *_a, double _b, double _c, double *dst, i
     }
 }
 
-static inline void muladdc256d(double *_a, double *_b, double _c, double *dst, int len)
+SIMD_UTILS_API void muladdc256d(double *_a, double *_b, double _c, double *dst, int len)
 {
     v4sd c = _mm256_set1_pd(_c);
 
@@ -323,7 +393,7 @@ static inline void muladdc256d(double *_a, double *_b, double _c, double *dst, i
     }
 }
 
-static inline void rint256d(double *src, double *dst, int len)
+SIMD_UTILS_API void rint256d(double *src, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -347,7 +417,7 @@ static inline void rint256d(double *src, double *dst, int len)
     }
 }
 
-static inline void round256d(double *src, double *dst, int len)
+SIMD_UTILS_API void round256d(double *src, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -377,7 +447,7 @@ static inline void round256d(double *src, double *dst, int len)
     }
 }
 
-static inline void ceil256d(double *src, double *dst, int len)
+SIMD_UTILS_API void ceil256d(double *src, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -399,7 +469,7 @@ static inline void ceil256d(double *src, double *dst, int len)
     }
 }
 
-static inline void floor256d(double *src, double *dst, int len)
+SIMD_UTILS_API void floor256d(double *src, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -421,7 +491,7 @@ static inline void floor256d(double *src, double *dst, int len)
     }
 }
 
-static inline void trunc256d(double *src, double *dst, int len)
+SIMD_UTILS_API void trunc256d(double *src, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -443,7 +513,7 @@ static inline void trunc256d(double *src, double *dst, int len)
     }
 }
 
-static inline void vectorSlope256d(double *dst, int len, double offset, double slope)
+SIMD_UTILS_API void vectorSlope256d(double *dst, int len, double offset, double slope)
 {
     int stop_len = len / (2 * AVX_LEN_DOUBLE);
     stop_len *= (2 * AVX_LEN_DOUBLE);
@@ -484,7 +554,7 @@ static inline void vectorSlope256d(double *dst, int len, double offset, double s
     }
 }
 
-static inline void cplxtoreal256d(complex64_t *src, double *dstRe, double *dstIm, int len)
+SIMD_UTILS_API void cplxtoreal256d(complex64_t *src, double *dstRe, double *dstIm, int len)
 {
     int stop_len = 2 * len / (4 * AVX_LEN_DOUBLE);
     stop_len *= 4 * AVX_LEN_DOUBLE;
@@ -518,7 +588,7 @@ static inline void cplxtoreal256d(complex64_t *src, double *dstRe, double *dstIm
     }
 }
 
-static inline void realtocplx256d(double *srcRe, double *srcIm, complex64_t *dst, int len)
+SIMD_UTILS_API void realtocplx256d(double *srcRe, double *srcIm, complex64_t *dst, int len)
 {
     int stop_len = len / (2 * AVX_LEN_DOUBLE);
     stop_len *= 2 * AVX_LEN_DOUBLE;
@@ -629,7 +699,7 @@ static inline v4sd asin256_pd(v4sd x)
     return (z);
 }
 
-static inline void asin256d(double *src, double *dst, int len)
+SIMD_UTILS_API void asin256d(double *src, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -707,7 +777,7 @@ static inline v4sd atan256_pd(v4sd xx)
     // y = _mm256_blendv_pd(y, _mm256_xor_pd(*(v4sd *) _pd256_negative_mask, y), sign);
     y = _mm256_xor_pd(y, sign);
 
-    y = _mm256_blendv_pd(y, xx, _mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_EQ_OS));  // if (xx == 0) then return xx (x is fabs(xx))
+    y = _mm256_blendv_pd(y, xx, _mm256_cmp_pd(xx, _mm256_setzero_pd(), _CMP_EQ_OS));  // if (xx == 0) then return xx
     return (y);
 }
 
@@ -745,7 +815,7 @@ static inline v4sd atan2256_pd(v4sd y, v4sd x)
     return (z);
 }
 
-static inline void atan256d(double *src, double *dst, int len)
+SIMD_UTILS_API void atan256d(double *src, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -767,7 +837,7 @@ static inline void atan256d(double *src, double *dst, int len)
     }
 }
 
-static inline void atan2256d(double *src1, double *src2, double *dst, int len)
+SIMD_UTILS_API void atan2256d(double *src1, double *src2, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -787,7 +857,7 @@ static inline void atan2256d(double *src1, double *src2, double *dst, int len)
     }
 }
 
-static inline void atan2256d_interleaved(complex64_t *src, double *dst, int len)
+SIMD_UTILS_API void atan2256d_interleaved(complex64_t *src, double *dst, int len)
 {
     int stop_len = len / (2 * AVX_LEN_DOUBLE);
     stop_len *= 2 * AVX_LEN_DOUBLE;
@@ -904,7 +974,7 @@ static inline void sincos256_pd(v4sd x, v4sd *s, v4sd *c)
     *c = _mm256_xor_pd(xmm2, sign_bit_cos);
 }
 
-static inline void sincos256d(double *src, double *dst_sin, double *dst_cos, int len)
+SIMD_UTILS_API void sincos256d(double *src, double *dst_sin, double *dst_cos, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -935,7 +1005,7 @@ static inline void sincos256d(double *src, double *dst_sin, double *dst_cos, int
     }
 }
 
-static inline void sincos256d_interleaved(double *src, complex64_t *dst, int len)
+SIMD_UTILS_API void sincos256d_interleaved(double *src, complex64_t *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -965,7 +1035,7 @@ static inline void sincos256d_interleaved(double *src, complex64_t *dst, int len
     }
 }
 
-static inline void pol2cart2D256f_precise(float *r, float *theta, float *x, float *y, int len)
+SIMD_UTILS_API void pol2cart2D256f_precise(float *r, float *theta, float *x, float *y, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -1016,7 +1086,7 @@ static inline void pol2cart2D256f_precise(float *r, float *theta, float *x, floa
     }
 }
 
-static inline void cart2pol2D256f_precise(float *x, float *y, float *r, float *theta, int len)
+SIMD_UTILS_API void cart2pol2D256f_precise(float *x, float *y, float *r, float *theta, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -1108,15 +1178,23 @@ static inline v4sd exp256_pd(v4sd x)
     return (x);
 }
 
-static inline void exp256d(double *src, double *dst, int len)
+SIMD_UTILS_API void exp256d(double *src, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
-            v4sd src_tmp = _mm256_load_pd(src + i);
-            _mm256_store_pd(dst + i, exp256_pd(src_tmp));
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_stream_pd(dst + i, exp256_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_store_pd(dst + i, exp256_pd(src_tmp));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
@@ -1221,15 +1299,23 @@ static inline v4sd log256_pd(v4sd x)
     return (z);
 }
 
-static inline void ln256d(double *src, double *dst, int len)
+SIMD_UTILS_API void ln256d(double *src, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
-            v4sd src_tmp = _mm256_load_pd(src + i);
-            _mm256_store_pd(dst + i, log256_pd(src_tmp));
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_stream_pd(dst + i, log256_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_store_pd(dst + i, log256_pd(src_tmp));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
@@ -1309,15 +1395,23 @@ static inline v4sd tan256_pd(v4sd xx)
     return y;
 }
 
-static inline void tan256d(double *src, double *dst, int len)
+SIMD_UTILS_API void tan256d(double *src, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
-            v4sd src_tmp = _mm256_load_pd(src + i);
-            _mm256_store_pd(dst + i, tan256_pd(src_tmp));
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_stream_pd(dst + i, tan256_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_store_pd(dst + i, tan256_pd(src_tmp));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
@@ -1340,7 +1434,7 @@ static inline v4sd pow256_pd(v4sd x, v4sd y)
     return ret;
 }
 
-static inline void pow256d(double *x, double *y, double *dst, int len)
+SIMD_UTILS_API void pow256d(double *x, double *y, double *dst, int len)
 {
     int stop_len = len / (2* AVX_LEN_DOUBLE);
     stop_len *= ( 2*AVX_LEN_DOUBLE);
@@ -1374,76 +1468,2333 @@ static inline void pow256d(double *x, double *y, double *dst, int len)
     }
 }
 
-static inline void powcplx256d(complex64_t *x, complex64_t *y, complex64_t *dst, int len)
+#ifdef __AVX2__
+// log(1 + x), the rounding of u = 1 + x is compensated : log(u) * x / (u - 1)
+static inline v4sd log1p256_pd(v4sd x)
 {
-    int stop_len = len / (2* AVX_LEN_DOUBLE);
-    stop_len *= ( 2*AVX_LEN_DOUBLE);
+    v4sd u = _mm256_add_pd(*(v4sd *) _pd256_1, x);
+    v4sd d = _mm256_sub_pd(u, *(v4sd *) _pd256_1);
+    v4sd y = _mm256_mul_pd(log256_pd(u), _mm256_div_pd(x, d));
+    v4sd m_exact = _mm256_cmp_pd(d, _mm256_setzero_pd(), _CMP_EQ_OS);  // log(1 + x) = x
+    return _mm256_blendv_pd(y, x, m_exact);
+}
 
-    if (areAligned3((uintptr_t) (x), (uintptr_t) (y), (uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
-            v4sdx2 x_tmp = _mm256_load2_pd((double const *) (x) + i);
-            v4sdx2 y_tmp = _mm256_load2_pd((double const *) (y) + i);
-            v4sd x_tmp_re2 = _mm256_mul_pd(x_tmp.val[0], x_tmp.val[0]);
-            v4sd modx = _mm256_fmadd_pd_custom(x_tmp.val[1], x_tmp.val[1], x_tmp_re2);
-			modx = _mm256_sqrt_pd(modx);
-			v4sdx2 logx;
-			logx.val[0] = log256_pd(modx);
-			logx.val[1] = atan2256_pd(x_tmp.val[1], x_tmp.val[0]);
-			v4sdx2 ylogx;
-            v4sd ac = _mm256_mul_pd(logx.val[0], y_tmp.val[0]);     // ac
-            v4sd ad = _mm256_mul_pd(logx.val[0], y_tmp.val[1]);     // ad
-            ylogx.val[0] = _mm256_fnmadd_pd_custom(logx.val[1], y_tmp.val[1], ac);
-            ylogx.val[1] = _mm256_fmadd_pd_custom(logx.val[1], y_tmp.val[0], ad);
-			v4sd ex = exp256_pd(ylogx.val[0]);
-			v4sd cosylogx, sinylogx;
-			sincos256_pd(ylogx.val[1], &sinylogx, &cosylogx);
-			v4sdx2 dst_tmp;
-			dst_tmp.val[0] = _mm256_mul_pd(ex,cosylogx);
-			dst_tmp.val[1] = _mm256_mul_pd(ex,sinylogx);
-            _mm256_store2_pd((double*)(dst) + i, dst_tmp);
+static inline v4sd log2256_pd(v4sd x)
+{
+    v4sd y = log256_pd(x);
+    v4sd lo = _mm256_mul_pd(y, *(v4sd *) _pd256_log2e_lo);
+    return _mm256_fmadd_pd_custom(y, *(v4sd *) _pd256_cephes_LOG2E, lo);
+}
+
+static inline v4sd log10256_pd(v4sd x)
+{
+    v4sd y = log256_pd(x);
+    v4sd lo = _mm256_mul_pd(y, *(v4sd *) _pd256_log10e_lo);
+    return _mm256_fmadd_pd_custom(y, *(v4sd *) _pd256_log10e, lo);
+}
+
+static inline v4sd sinh256_pd(v4sd x)
+{
+    v4sd xabs = _mm256_and_pd(x, *(v4sd *) _pd256_positive_mask);
+    v4sd sign = _mm256_and_pd(x, *(v4sd *) _pd256_negative_mask);
+
+    // |x| <= 1 : x + x^3 P(x^2) / Q(x^2)
+    v4sd z = _mm256_mul_pd(xabs, xabs);
+    v4sd p = _mm256_fmadd_pd_custom(z, *(v4sd *) _pd256_sinh_p0, *(v4sd *) _pd256_sinh_p1);
+    p = _mm256_fmadd_pd_custom(z, p, *(v4sd *) _pd256_sinh_p2);
+    p = _mm256_fmadd_pd_custom(z, p, *(v4sd *) _pd256_sinh_p3);
+    v4sd q = _mm256_add_pd(z, *(v4sd *) _pd256_sinh_q0);
+    q = _mm256_fmadd_pd_custom(z, q, *(v4sd *) _pd256_sinh_q1);
+    q = _mm256_fmadd_pd_custom(z, q, *(v4sd *) _pd256_sinh_q2);
+    v4sd small = _mm256_fmadd_pd_custom(_mm256_mul_pd(xabs, z), _mm256_div_pd(p, q), xabs);
+
+    // |x| > 1 : (exp(|x|) - exp(-|x|)) / 2
+    v4sd e = exp256_pd(xabs);
+    v4sd large = _mm256_fmadd_pd_custom(e, *(v4sd *) _pd256_0p5, _mm256_div_pd(*(v4sd *) _pd256_min0p5, e));
+
+    v4sd m_large = _mm256_cmp_pd(xabs, *(v4sd *) _pd256_1, _CMP_GT_OS);
+    v4sd y = _mm256_blendv_pd(small, large, m_large);
+    return _mm256_xor_pd(y, sign);
+}
+
+static inline v4sd cosh256_pd(v4sd x)
+{
+    v4sd e = exp256_pd(_mm256_and_pd(x, *(v4sd *) _pd256_positive_mask));
+    return _mm256_fmadd_pd_custom(e, *(v4sd *) _pd256_0p5, _mm256_div_pd(*(v4sd *) _pd256_0p5, e));
+}
+
+static inline v4sd tanh256_pd(v4sd x)
+{
+    v4sd xabs = _mm256_and_pd(x, *(v4sd *) _pd256_positive_mask);
+    v4sd sign = _mm256_and_pd(x, *(v4sd *) _pd256_negative_mask);
+
+    // |x| < 0.625 : x + x^3 P(x^2) / Q(x^2)
+    v4sd z = _mm256_mul_pd(xabs, xabs);
+    v4sd p = _mm256_fmadd_pd_custom(z, *(v4sd *) _pd256_tanh_p0, *(v4sd *) _pd256_tanh_p1);
+    p = _mm256_fmadd_pd_custom(z, p, *(v4sd *) _pd256_tanh_p2);
+    v4sd q = _mm256_add_pd(z, *(v4sd *) _pd256_tanh_q0);
+    q = _mm256_fmadd_pd_custom(z, q, *(v4sd *) _pd256_tanh_q1);
+    q = _mm256_fmadd_pd_custom(z, q, *(v4sd *) _pd256_tanh_q2);
+    v4sd small = _mm256_fmadd_pd_custom(_mm256_mul_pd(xabs, z), _mm256_div_pd(p, q), xabs);
+
+    // |x| >= 0.625 : 1 - 2 / (exp(2|x|) + 1)
+    v4sd xmax = _mm256_min_pd(xabs, *(v4sd *) _pd256_tanh_max);
+    v4sd e = exp256_pd(_mm256_add_pd(xmax, xmax));
+    v4sd large = _mm256_sub_pd(*(v4sd *) _pd256_1, _mm256_div_pd(*(v4sd *) _pd256_2, _mm256_add_pd(e, *(v4sd *) _pd256_1)));
+
+    v4sd m_large = _mm256_cmp_pd(xabs, *(v4sd *) _pd256_0p625, _CMP_GE_OS);
+    v4sd y = _mm256_blendv_pd(small, large, m_large);
+    return _mm256_xor_pd(y, sign);
+}
+
+static inline v4sd asinh256_pd(v4sd x)
+{
+    v4sd xabs = _mm256_and_pd(x, *(v4sd *) _pd256_positive_mask);
+    v4sd sign = _mm256_and_pd(x, *(v4sd *) _pd256_negative_mask);
+
+    // log1p(|x| + x^2 / (1 + sqrt(1 + x^2)))
+    v4sd z = _mm256_mul_pd(xabs, xabs);
+    v4sd tmp = _mm256_add_pd(*(v4sd *) _pd256_1, _mm256_sqrt_pd(_mm256_add_pd(*(v4sd *) _pd256_1, z)));
+    v4sd small = log1p256_pd(_mm256_add_pd(xabs, _mm256_div_pd(z, tmp)));
+
+    // |x| > 1e8 : log(|x|) + log(2), x^2 could overflow
+    v4sd large = _mm256_add_pd(log256_pd(xabs), *(v4sd *) _pd256_cephes_LOGE2);
+
+    v4sd m_large = _mm256_cmp_pd(xabs, *(v4sd *) _pd256_asinh_big, _CMP_GT_OS);
+    v4sd y = _mm256_blendv_pd(small, large, m_large);
+    return _mm256_xor_pd(y, sign);
+}
+
+static inline v4sd acosh256_pd(v4sd x)
+{
+    // log1p(z + sqrt(2z + z^2)), z = x - 1
+    v4sd z = _mm256_sub_pd(x, *(v4sd *) _pd256_1);
+    v4sd tmp = _mm256_sqrt_pd(_mm256_fmadd_pd_custom(z, z, _mm256_add_pd(z, z)));
+    v4sd small = log1p256_pd(_mm256_add_pd(z, tmp));
+
+    // x > 1e8 : log(x) + log(2)
+    v4sd large = _mm256_add_pd(log256_pd(x), *(v4sd *) _pd256_cephes_LOGE2);
+
+    v4sd m_large = _mm256_cmp_pd(x, *(v4sd *) _pd256_asinh_big, _CMP_GT_OS);
+    return _mm256_blendv_pd(small, large, m_large);
+}
+
+static inline v4sd atanh256_pd(v4sd x)
+{
+    v4sd xabs = _mm256_and_pd(x, *(v4sd *) _pd256_positive_mask);
+    v4sd sign = _mm256_and_pd(x, *(v4sd *) _pd256_negative_mask);
+
+    // log1p(2|x| / (1 - |x|)) / 2
+    v4sd tmp = _mm256_div_pd(_mm256_add_pd(xabs, xabs), _mm256_sub_pd(*(v4sd *) _pd256_1, xabs));
+    v4sd y = _mm256_mul_pd(log1p256_pd(tmp), *(v4sd *) _pd256_0p5);
+    return _mm256_xor_pd(y, sign);
+}
+
+static inline v4sd cbrt256_pd(v4sd x)
+{
+    v4sd xabs = _mm256_and_pd(x, *(v4sd *) _pd256_positive_mask);
+    v4sd sign = _mm256_and_pd(x, *(v4sd *) _pd256_negative_mask);
+
+    // denormals are scaled by 2^54 to get a usable exponent
+    v4sd m_denorm = _mm256_cmp_pd(xabs, *(v4sd *) _pd256_dbl_min, _CMP_LT_OS);
+    v4sd xscaled = _mm256_mul_pd(xabs, *(v4sd *) _pd256_two54);
+    v4sd xnorm = _mm256_blendv_pd(xabs, xscaled, m_denorm);
+
+    // |x| = m 2^(3q + r), m in [1, 2), r in {0, 1, 2}
+    v4sd e = _mm256_castsi256_pd(_mm256_srli_epi64(_mm256_castpd_si256(xnorm), 52));
+    e = _mm256_sub_pd(_mm256_or_pd(e, *(v4sd *) _pd256_two52), *(v4sd *) _pd256_two52);
+    e = _mm256_sub_pd(e, *(v4sd *) _pd256_1023);
+    v4sd e54 = _mm256_sub_pd(e, *(v4sd *) _pd256_54);
+    e = _mm256_blendv_pd(e, e54, m_denorm);
+    v4sd q = _mm256_round_pd(_mm256_div_pd(e, *(v4sd *) _pd256_3), ROUNDTOFLOOR);
+    v4sd r = _mm256_sub_pd(e, _mm256_mul_pd(q, *(v4sd *) _pd256_3));
+    v4sd m = _mm256_or_pd(_mm256_and_pd(xnorm, *(v4sd *) _pd256_mant_mask), *(v4sd *) _pd256_1);
+    v4sd pow2r = _mm256_add_pd(_mm256_add_pd(r, *(v4sd *) _pd256_1023), *(v4sd *) _pd256_two52);
+    pow2r = _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(pow2r), 52));
+    m = _mm256_mul_pd(m, pow2r);  // in [1, 8)
+
+    // quadratic guess, two Halley iterations y (y^3 + 2m) / (2y^3 + m) and a Newton iteration
+    v4sd y = _mm256_fmadd_pd_custom(_mm256_fmadd_pd_custom(m, *(v4sd *) _pd256_cbrt_c2, *(v4sd *) _pd256_cbrt_c1), m, *(v4sd *) _pd256_cbrt_c0);
+    v4sd y3 = _mm256_mul_pd(_mm256_mul_pd(y, y), y);
+    y = _mm256_mul_pd(y, _mm256_div_pd(_mm256_add_pd(y3, _mm256_add_pd(m, m)), _mm256_fmadd_pd_custom(y3, *(v4sd *) _pd256_2, m)));
+    y3 = _mm256_mul_pd(_mm256_mul_pd(y, y), y);
+    y = _mm256_mul_pd(y, _mm256_div_pd(_mm256_add_pd(y3, _mm256_add_pd(m, m)), _mm256_fmadd_pd_custom(y3, *(v4sd *) _pd256_2, m)));
+    v4sd y2 = _mm256_mul_pd(y, y);
+    y = _mm256_sub_pd(y, _mm256_div_pd(_mm256_sub_pd(_mm256_mul_pd(y2, y), m), _mm256_mul_pd(y2, *(v4sd *) _pd256_3)));
+
+    // 2^q, q >= -360 so it is a normal number
+    v4sd pow2q = _mm256_add_pd(_mm256_add_pd(q, *(v4sd *) _pd256_1023), *(v4sd *) _pd256_two52);
+    pow2q = _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(pow2q), 52));
+    y = _mm256_or_pd(_mm256_mul_pd(y, pow2q), sign);
+
+    // cbrt(x) = x for 0, inf and NaN
+    v4sd m_zero = _mm256_cmp_pd(xabs, _mm256_setzero_pd(), _CMP_EQ_OS);
+    v4sd m_notfinite = _mm256_cmp_pd(xabs, *(v4sd *) _pd256_dbl_max, _CMP_NLE_US);
+    y = _mm256_blendv_pd(y, x, m_zero);
+    return _mm256_blendv_pd(y, x, m_notfinite);
+}
+
+static inline v4sd acos256_pd(v4sd x)
+{
+    v4sd xabs = _mm256_and_pd(x, *(v4sd *) _pd256_positive_mask);
+    v4sd m_large = _mm256_cmp_pd(xabs, *(v4sd *) _pd256_0p5, _CMP_GT_OS);
+    v4sd m_neg = _mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_LT_OS);
+
+    // |x| > 0.5 : acos(|x|) = 2 asin(sqrt((1 - |x|) / 2)), else acos(x) = PI/2 - asin(x)
+    v4sd s = _mm256_sqrt_pd(_mm256_mul_pd(_mm256_sub_pd(*(v4sd *) _pd256_1, xabs), *(v4sd *) _pd256_0p5));
+    v4sd a = asin256_pd(_mm256_blendv_pd(x, s, m_large));
+    v4sd small = _mm256_sub_pd(*(v4sd *) _pd256_PIO2F, _mm256_sub_pd(a, *(v4sd *) _pd256_PIO2_lo));
+    v4sd large = _mm256_add_pd(a, a);
+    v4sd large_neg = _mm256_sub_pd(*(v4sd *) _pd256_PIF, _mm256_sub_pd(large, *(v4sd *) _pd256_PI_lo));  // acos(x) = PI - acos(-x)
+    large = _mm256_blendv_pd(large, large_neg, m_neg);
+    return _mm256_blendv_pd(small, large, m_large);
+}
+
+// 1 / (1 + exp(-x)), exp(-x) being clamped to the range of exp256_pd
+static inline v4sd sigmoid256_pd(v4sd x)
+{
+    v4sd minus_x = _mm256_xor_pd(x, *(v4sd *) _pd256_negative_mask);
+    minus_x = _mm256_max_pd(*(v4sd *) _pd256_exp_min, minus_x);  // NaN is returned by the second operand
+    minus_x = _mm256_min_pd(*(v4sd *) _pd256_exp_max, minus_x);
+    return _mm256_div_pd(*(v4sd *) _pd256_1, _mm256_add_pd(*(v4sd *) _pd256_1, exp256_pd(minus_x)));
+}
+
+SIMD_UTILS_API void log2256d(double *src, double *dst, int len)
+{
+    int stop_len = len / AVX_LEN_DOUBLE;
+    stop_len *= AVX_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_stream_pd(dst + i, log2256_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_store_pd(dst + i, log2256_pd(src_tmp));
+            }
         }
     } else {
-        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
-            v4sdx2 x_tmp = _mm256_load2u_pd((double const *) (x) + i);
-            v4sdx2 y_tmp = _mm256_load2u_pd((double const *) (y) + i);
-            v4sd x_tmp_re2 = _mm256_mul_pd(x_tmp.val[0], x_tmp.val[0]);
-            v4sd modx = _mm256_fmadd_pd_custom(x_tmp.val[1], x_tmp.val[1], x_tmp_re2);
-			modx = _mm256_sqrt_pd(modx);
-			v4sdx2 logx;
-			logx.val[0] = log256_pd(modx);
-			logx.val[1] = atan2256_pd(x_tmp.val[1], x_tmp.val[0]);
-			v4sdx2 ylogx;
-            v4sd ac = _mm256_mul_pd(logx.val[0], y_tmp.val[0]);     // ac
-            v4sd ad = _mm256_mul_pd(logx.val[0], y_tmp.val[1]);     // ad
-            ylogx.val[0] = _mm256_fnmadd_pd_custom(logx.val[1], y_tmp.val[1], ac);
-            ylogx.val[1] = _mm256_fmadd_pd_custom(logx.val[1], y_tmp.val[0], ad);
-			v4sd ex = exp256_pd(ylogx.val[0]);
-			v4sd cosylogx, sinylogx;
-			sincos256_pd(ylogx.val[1], &sinylogx, &cosylogx);
-			v4sdx2 dst_tmp;
-			dst_tmp.val[0] = _mm256_mul_pd(ex,cosylogx);
-			dst_tmp.val[1] = _mm256_mul_pd(ex,sinylogx);
-            _mm256_store2u_pd((double*)(dst) + i, dst_tmp);
+        for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+            v4sd src_tmp = _mm256_loadu_pd(src + i);
+            _mm256_storeu_pd(dst + i, log2256_pd(src_tmp));
         }
     }
 
     for (int i = stop_len; i < len; i++) {
-		double x_tmp_re2 = x[i].re * x[i].re;
-		double modx = (x[i].im * x[i].im) + x_tmp_re2;
-		modx = sqrt(modx);
-		complex64_t logx;
-		logx.re = log(modx);
-		logx.im = atan2(x[i].im, x[i].re);
-		complex64_t ylogx;
-		double ac = logx.re * y[i].re;     // ac
-		double ad = logx.re * y[i].im;     // ad
-		ylogx.re = ac - (logx.im * y[i].im);
-		ylogx.im = (logx.im *  y[i].re) +  ad;
-		double ex = exp(ylogx.re);
-		double cosylogx, sinylogx;
-        sinylogx = sin(ylogx.im);	
-        cosylogx = cos(ylogx.im);		
-		dst[i].re = ex * cosylogx;
-		dst[i].im = ex * sinylogx;
+        dst[i] = log2(src[i]);
+    }
+}
+
+SIMD_UTILS_API void log10256d(double *src, double *dst, int len)
+{
+    int stop_len = len / AVX_LEN_DOUBLE;
+    stop_len *= AVX_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_stream_pd(dst + i, log10256_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_store_pd(dst + i, log10256_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+            v4sd src_tmp = _mm256_loadu_pd(src + i);
+            _mm256_storeu_pd(dst + i, log10256_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = log10(src[i]);
+    }
+}
+
+SIMD_UTILS_API void sinh256d(double *src, double *dst, int len)
+{
+    int stop_len = len / AVX_LEN_DOUBLE;
+    stop_len *= AVX_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_stream_pd(dst + i, sinh256_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_store_pd(dst + i, sinh256_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+            v4sd src_tmp = _mm256_loadu_pd(src + i);
+            _mm256_storeu_pd(dst + i, sinh256_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = sinh(src[i]);
+    }
+}
+
+SIMD_UTILS_API void cosh256d(double *src, double *dst, int len)
+{
+    int stop_len = len / AVX_LEN_DOUBLE;
+    stop_len *= AVX_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_stream_pd(dst + i, cosh256_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_store_pd(dst + i, cosh256_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+            v4sd src_tmp = _mm256_loadu_pd(src + i);
+            _mm256_storeu_pd(dst + i, cosh256_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = cosh(src[i]);
+    }
+}
+
+SIMD_UTILS_API void tanh256d(double *src, double *dst, int len)
+{
+    int stop_len = len / AVX_LEN_DOUBLE;
+    stop_len *= AVX_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_stream_pd(dst + i, tanh256_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_store_pd(dst + i, tanh256_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+            v4sd src_tmp = _mm256_loadu_pd(src + i);
+            _mm256_storeu_pd(dst + i, tanh256_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = tanh(src[i]);
     }
-}
\ No newline at end of file
+}
+
+SIMD_UTILS_API void asinh256d(double *src, double *dst, int len)
+{
+    int stop_len = len / AVX_LEN_DOUBLE;
+    stop_len *= AVX_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_stream_pd(dst + i, asinh256_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_store_pd(dst + i, asinh256_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+            v4sd src_tmp = _mm256_loadu_pd(src + i);
+            _mm256_storeu_pd(dst + i, asinh256_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = asinh(src[i]);
+    }
+}
+
+SIMD_UTILS_API void acosh256d(double *src, double *dst, int len)
+{
+    int stop_len = len / AVX_LEN_DOUBLE;
+    stop_len *= AVX_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_stream_pd(dst + i, acosh256_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_store_pd(dst + i, acosh256_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+            v4sd src_tmp = _mm256_loadu_pd(src + i);
+            _mm256_storeu_pd(dst + i, acosh256_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = acosh(src[i]);
+    }
+}
+
+SIMD_UTILS_API void atanh256d(double *src, double *dst, int len)
+{
+    int stop_len = len / AVX_LEN_DOUBLE;
+    stop_len *= AVX_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_stream_pd(dst + i, atanh256_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_store_pd(dst + i, atanh256_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+            v4sd src_tmp = _mm256_loadu_pd(src + i);
+            _mm256_storeu_pd(dst + i, atanh256_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = atanh(src[i]);
+    }
+}
+
+SIMD_UTILS_API void cbrt256d(double *src, double *dst, int len)
+{
+    int stop_len = len / AVX_LEN_DOUBLE;
+    stop_len *= AVX_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_stream_pd(dst + i, cbrt256_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_store_pd(dst + i, cbrt256_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+            v4sd src_tmp = _mm256_loadu_pd(src + i);
+            _mm256_storeu_pd(dst + i, cbrt256_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = cbrt(src[i]);
+    }
+}
+
+SIMD_UTILS_API void acos256d(double *src, double *dst, int len)
+{
+    int stop_len = len / AVX_LEN_DOUBLE;
+    stop_len *= AVX_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_stream_pd(dst + i, acos256_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_store_pd(dst + i, acos256_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+            v4sd src_tmp = _mm256_loadu_pd(src + i);
+            _mm256_storeu_pd(dst + i, acos256_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = acos(src[i]);
+    }
+}
+
+SIMD_UTILS_API void sigmoid256d(double *src, double *dst, int len)
+{
+    int stop_len = len / AVX_LEN_DOUBLE;
+    stop_len *= AVX_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_stream_pd(dst + i, sigmoid256_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+                v4sd src_tmp = _mm256_load_pd(src + i);
+                _mm256_store_pd(dst + i, sigmoid256_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+            v4sd src_tmp = _mm256_loadu_pd(src + i);
+            _mm256_storeu_pd(dst + i, sigmoid256_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = 1.0 / (1.0 + exp(-src[i]));
+    }
+}
+#endif
+
+SIMD_UTILS_API void powcplx256d(complex64_t *x, complex64_t *y, complex64_t *dst, int len)
+{
+    int stop_len = len / (2* AVX_LEN_DOUBLE);
+    stop_len *= ( 2*AVX_LEN_DOUBLE);
+
+    if (areAligned3((uintptr_t) (x), (uintptr_t) (y), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < 2 * stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sdx2 x_tmp = _mm256_load2_pd((double const *) (x) + i);
+            v4sdx2 y_tmp = _mm256_load2_pd((double const *) (y) + i);
+            v4sd x_tmp_re2 = _mm256_mul_pd(x_tmp.val[0], x_tmp.val[0]);
+            v4sd modx = _mm256_fmadd_pd_custom(x_tmp.val[1], x_tmp.val[1], x_tmp_re2);
+			modx = _mm256_sqrt_pd(modx);
+			v4sdx2 logx;
+			logx.val[0] = log256_pd(modx);
+			logx.val[1] = atan2256_pd(x_tmp.val[1], x_tmp.val[0]);
+			v4sdx2 ylogx;
+            v4sd ac = _mm256_mul_pd(logx.val[0], y_tmp.val[0]);     // ac
+            v4sd ad = _mm256_mul_pd(logx.val[0], y_tmp.val[1]);     // ad
+            ylogx.val[0] = _mm256_fnmadd_pd_custom(logx.val[1], y_tmp.val[1], ac);
+            ylogx.val[1] = _mm256_fmadd_pd_custom(logx.val[1], y_tmp.val[0], ad);
+			v4sd ex = exp256_pd(ylogx.val[0]);
+			v4sd cosylogx, sinylogx;
+			sincos256_pd(ylogx.val[1], &sinylogx, &cosylogx);
+			v4sdx2 dst_tmp;
+			dst_tmp.val[0] = _mm256_mul_pd(ex,cosylogx);
+			dst_tmp.val[1] = _mm256_mul_pd(ex,sinylogx);
+            _mm256_store2_pd((double*)(dst) + i, dst_tmp);
+        }
+    } else {
+        for (int i = 0; i < 2 * stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sdx2 x_tmp = _mm256_load2u_pd((double const *) (x) + i);
+            v4sdx2 y_tmp = _mm256_load2u_pd((double const *) (y) + i);
+            v4sd x_tmp_re2 = _mm256_mul_pd(x_tmp.val[0], x_tmp.val[0]);
+            v4sd modx = _mm256_fmadd_pd_custom(x_tmp.val[1], x_tmp.val[1], x_tmp_re2);
+			modx = _mm256_sqrt_pd(modx);
+			v4sdx2 logx;
+			logx.val[0] = log256_pd(modx);
+			logx.val[1] = atan2256_pd(x_tmp.val[1], x_tmp.val[0]);
+			v4sdx2 ylogx;
+            v4sd ac = _mm256_mul_pd(logx.val[0], y_tmp.val[0]);     // ac
+            v4sd ad = _mm256_mul_pd(logx.val[0], y_tmp.val[1]);     // ad
+            ylogx.val[0] = _mm256_fnmadd_pd_custom(logx.val[1], y_tmp.val[1], ac);
+            ylogx.val[1] = _mm256_fmadd_pd_custom(logx.val[1], y_tmp.val[0], ad);
+			v4sd ex = exp256_pd(ylogx.val[0]);
+			v4sd cosylogx, sinylogx;
+			sincos256_pd(ylogx.val[1], &sinylogx, &cosylogx);
+			v4sdx2 dst_tmp;
+			dst_tmp.val[0] = _mm256_mul_pd(ex,cosylogx);
+			dst_tmp.val[1] = _mm256_mul_pd(ex,sinylogx);
+            _mm256_store2u_pd((double*)(dst) + i, dst_tmp);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+		double x_tmp_re2 = x[i].re * x[i].re;
+		double modx = (x[i].im * x[i].im) + x_tmp_re2;
+		modx = sqrt(modx);
+		complex64_t logx;
+		logx.re = log(modx);
+		logx.im = atan2(x[i].im, x[i].re);
+		complex64_t ylogx;
+		double ac = logx.re * y[i].re;     // ac
+		double ad = logx.re * y[i].im;     // ad
+		ylogx.re = ac - (logx.im * y[i].im);
+		ylogx.im = (logx.im *  y[i].re) +  ad;
+		double ex = exp(ylogx.re);
+		double cosylogx, sinylogx;
+        sinylogx = sin(ylogx.im);	
+        cosylogx = cos(ylogx.im);		
+		dst[i].re = ex * cosylogx;
+		dst[i].im = ex * sinylogx;
+    }
+}
+
+/* FFT (see simd_utils_fft.h) */
+
+// radix-4 butterfly on AVX_LEN_DOUBLE points x[idx + r*n4], y = Y0re, Y0im, w1*Y1re, w1*Y1im, ...
+static inline void fft_radix4_256d(const double *xr, const double *xi, int idx, int n4, const v4sd *w, v4sd *y)
+{
+    v4sd ar = _mm256_loadu_pd(xr + idx), ai = _mm256_loadu_pd(xi + idx);
+    v4sd br = _mm256_loadu_pd(xr + idx + n4), bi = _mm256_loadu_pd(xi + idx + n4);
+    v4sd cr = _mm256_loadu_pd(xr + idx + 2 * n4), ci = _mm256_loadu_pd(xi + idx + 2 * n4);
+    v4sd dr = _mm256_loadu_pd(xr + idx + 3 * n4), di = _mm256_loadu_pd(xi + idx + 3 * n4);
+    v4sd apcr = _mm256_add_pd(ar, cr), apci = _mm256_add_pd(ai, ci);
+    v4sd amcr = _mm256_sub_pd(ar, cr), amci = _mm256_sub_pd(ai, ci);
+    v4sd bpdr = _mm256_add_pd(br, dr), bpdi = _mm256_add_pd(bi, di);
+    v4sd jbmdr = _mm256_sub_pd(bi, di), jbmdi = _mm256_sub_pd(dr, br);  // -j * (b - d)
+    v4sd t1r = _mm256_add_pd(amcr, jbmdr), t1i = _mm256_add_pd(amci, jbmdi);
+    v4sd t2r = _mm256_sub_pd(apcr, bpdr), t2i = _mm256_sub_pd(apci, bpdi);
+    v4sd t3r = _mm256_sub_pd(amcr, jbmdr), t3i = _mm256_sub_pd(amci, jbmdi);
+    y[0] = _mm256_add_pd(apcr, bpdr);
+    y[1] = _mm256_add_pd(apci, bpdi);
+    y[2] = _mm256_fnmadd_pd_custom(t1i, w[1], _mm256_mul_pd(t1r, w[0]));
+    y[3] = _mm256_fmadd_pd_custom(t1r, w[1], _mm256_mul_pd(t1i, w[0]));
+    y[4] = _mm256_fnmadd_pd_custom(t2i, w[3], _mm256_mul_pd(t2r, w[2]));
+    y[5] = _mm256_fmadd_pd_custom(t2r, w[3], _mm256_mul_pd(t2i, w[2]));
+    y[6] = _mm256_fnmadd_pd_custom(t3i, w[5], _mm256_mul_pd(t3r, w[4]));
+    y[7] = _mm256_fmadd_pd_custom(t3r, w[5], _mm256_mul_pd(t3i, w[4]));
+}
+
+// dst[4i + r] = yr[i]
+static inline void fft_store4_s1_256d(double *dst, v4sd y0, v4sd y1, v4sd y2, v4sd y3)
+{
+    v4sd t0 = _mm256_unpacklo_pd(y0, y1);  // points 0 and 2
+    v4sd t1 = _mm256_unpackhi_pd(y0, y1);  // points 1 and 3
+    v4sd t2 = _mm256_unpacklo_pd(y2, y3);
+    v4sd t3 = _mm256_unpackhi_pd(y2, y3);
+    _mm256_storeu_pd(dst, _mm256_permute2f128_pd(t0, t2, 0x20));
+    _mm256_storeu_pd(dst + AVX_LEN_DOUBLE, _mm256_permute2f128_pd(t1, t3, 0x20));
+    _mm256_storeu_pd(dst + 2 * AVX_LEN_DOUBLE, _mm256_permute2f128_pd(t0, t2, 0x31));
+    _mm256_storeu_pd(dst + 3 * AVX_LEN_DOUBLE, _mm256_permute2f128_pd(t1, t3, 0x31));
+}
+
+
+static inline v4sd fft_reverse256d(v4sd a)
+{
+    a = _mm256_permute2f128_pd(a, a, 0x01);
+    return _mm256_permute_pd(a, 0x5);
+}
+
+static inline void fft_radix4_stage256d(const fft_plan64_t *plan, int s, const double *xr, const double *xi, double *yr, double *yi)
+{
+    int n4 = plan->n / 4;
+    v4sd w[6], y[8];
+
+    if (s >= AVX_LEN_DOUBLE) {
+        const double *tw = fft_stage_twd(plan, s);
+        for (int p = 0; p < n4 / s; p++) {
+            for (int r = 0; r < 6; r++)
+                w[r] = _mm256_set1_pd(tw[6 * p + r]);
+            for (int q = 0; q < s; q += AVX_LEN_DOUBLE) {
+                int out = q + 4 * s * p;
+                fft_radix4_256d(xr, xi, q + s * p, n4, w, y);
+                for (int r = 0; r < 4; r++) {
+                    _mm256_storeu_pd(yr + out + r * s, y[2 * r]);
+                    _mm256_storeu_pd(yi + out + r * s, y[2 * r + 1]);
+                }
+            }
+        }
+    } else {
+        // strides smaller than a vector : twiddles per point, the 4 outputs are interleaved by chunks of s
+        const double *twx = plan->twx + ((s == 1) ? 0 : 6 * n4);
+        for (int idx = 0; idx < n4; idx += AVX_LEN_DOUBLE) {
+            for (int r = 0; r < 6; r++)
+                w[r] = _mm256_loadu_pd(twx + r * n4 + idx);
+            fft_radix4_256d(xr, xi, idx, n4, w, y);
+            for (int r = 0; r < 2; r++)
+                fft_store4_s1_256d((r ? yi : yr) + 4 * idx, y[r], y[2 + r], y[4 + r], y[6 + r]);
+        }
+    }
+}
+
+// last stage when log2(n) is odd, stride n/2 and no twiddles
+static inline void fft_radix2_stage256d(int n, const double *xr, const double *xi, double *yr, double *yi)
+{
+    int n2 = n / 2;
+    for (int q = 0; q < n2; q += AVX_LEN_DOUBLE) {
+        v4sd ar = _mm256_loadu_pd(xr + q), ai = _mm256_loadu_pd(xi + q);
+        v4sd br = _mm256_loadu_pd(xr + q + n2), bi = _mm256_loadu_pd(xi + q + n2);
+        _mm256_storeu_pd(yr + q, _mm256_add_pd(ar, br));
+        _mm256_storeu_pd(yi + q, _mm256_add_pd(ai, bi));
+        _mm256_storeu_pd(yr + q + n2, _mm256_sub_pd(ar, br));
+        _mm256_storeu_pd(yi + q + n2, _mm256_sub_pd(ai, bi));
+    }
+}
+
+static inline void fft_split_core256d(const fft_plan64_t *plan, double *srcRe, double *srcIm, double *dstRe, double *dstIm)
+{
+    int n = plan->n;
+    if ((n / 4) < AVX_LEN_DOUBLE) {
+        fft_split_cored_C(plan, srcRe, srcIm, dstRe, dstIm);
+        return;
+    }
+
+    int nb_stages = plan->log2n / 2 + (plan->log2n & 1);
+    double *xr = srcRe, *xi = srcIm;
+    int s = 1;
+    for (int stage = 0; stage < nb_stages; stage++) {
+        double *yr = fft_stage_outd(plan, stage, nb_stages, dstRe);
+        double *yi = (yr == dstRe) ? dstIm : yr + n;
+        if (s < n / 2 || !(plan->log2n & 1)) {
+            fft_radix4_stage256d(plan, s, xr, xi, yr, yi);
+            s *= 4;
+        } else {
+            fft_radix2_stage256d(n, xr, xi, yr, yi);
+        }
+        xr = yr;
+        xi = yi;
+    }
+}
+
+SIMD_UTILS_API void fft256d_split(fft_plan64_t *plan, double *srcRe, double *srcIm, double *dstRe, double *dstIm)
+{
+    fft_split_core256d(plan, srcRe, srcIm, dstRe, dstIm);
+}
+
+SIMD_UTILS_API void ifft256d_split(fft_plan64_t *plan, double *srcRe, double *srcIm, double *dstRe, double *dstIm)
+{
+    fft_split_core256d(plan, srcIm, srcRe, dstIm, dstRe);
+}
+
+SIMD_UTILS_API void fft256d(fft_plan64_t *plan, complex64_t *src, complex64_t *dst)
+{
+    double *re = plan->work + 4 * plan->n;
+    double *im = re + plan->n;
+    cplxtoreal256d(src, re, im, plan->n);
+    fft_split_core256d(plan, re, im, re, im);
+    realtocplx256d(re, im, dst, plan->n);
+}
+
+SIMD_UTILS_API void ifft256d(fft_plan64_t *plan, complex64_t *src, complex64_t *dst)
+{
+    double *re = plan->work + 4 * plan->n;
+    double *im = re + plan->n;
+    cplxtoreal256d(src, re, im, plan->n);
+    fft_split_core256d(plan, im, re, im, re);
+    realtocplx256d(re, im, dst, plan->n);
+}
+
+// src has plan->real_n points, dst the plan->real_n / 2 + 1 first bins
+SIMD_UTILS_API void rfft256d(fft_plan64_t *plan, double *src, complex64_t *dst)
+{
+    int n = plan->n;
+    double *re = plan->work + 4 * n;
+    double *im = re + n;
+    cplxtoreal256d((complex64_t *) src, re, im, n);
+    fft_split_core256d(plan, re, im, re, im);
+
+    v4sd half = _mm256_set1_pd(0.5);
+    int k = 1;
+    for (; (k + AVX_LEN_DOUBLE) <= n; k += AVX_LEN_DOUBLE) {
+        v4sd a = _mm256_loadu_pd(re + k), b = _mm256_loadu_pd(im + k);
+        v4sd c = fft_reverse256d(_mm256_loadu_pd(re + n - k - AVX_LEN_DOUBLE + 1));
+        v4sd d = fft_reverse256d(_mm256_loadu_pd(im + n - k - AVX_LEN_DOUBLE + 1));
+        v4sd wr = _mm256_loadu_pd(plan->rtw + k), wi = _mm256_loadu_pd(plan->rtw + n + k);
+        v4sd hs = _mm256_add_pd(a, c), hd = _mm256_sub_pd(b, d);
+        v4sd fr = _mm256_add_pd(b, d), fi = _mm256_sub_pd(c, a);
+        v4sdx2 out;
+        out.val[0] = _mm256_mul_pd(half, _mm256_fnmadd_pd_custom(wi, fi, _mm256_fmadd_pd_custom(wr, fr, hs)));
+        out.val[1] = _mm256_mul_pd(half, _mm256_fmadd_pd_custom(wi, fr, _mm256_fmadd_pd_custom(wr, fi, hd)));
+        _mm256_store2u_pd((double *) (dst + k), out);
+    }
+    rfft_postd_C(plan, re, im, dst, k);
+}
+
+// src has the plan->real_n / 2 + 1 first bins, dst plan->real_n points, not normalized
+SIMD_UTILS_API void irfft256d(fft_plan64_t *plan, complex64_t *src, double *dst)
+{
+    int n = plan->n;
+    double *re = plan->work + 4 * n;
+    double *im = re + n;
+
+    int k = 0;
+    for (; (k + AVX_LEN_DOUBLE) <= n; k += AVX_LEN_DOUBLE) {
+        v4sdx2 x = _mm256_load2u_pd((double *) (src + k));
+        v4sdx2 xc = _mm256_load2u_pd((double *) (src + n - k - AVX_LEN_DOUBLE + 1));
+        v4sd c = fft_reverse256d(xc.val[0]), d = fft_reverse256d(xc.val[1]);
+        v4sd wr = _mm256_loadu_pd(plan->rtw + k), wi = _mm256_loadu_pd(plan->rtw + n + k);
+        v4sd amc = _mm256_sub_pd(x.val[0], c), bpd = _mm256_add_pd(x.val[1], d);
+        v4sd zr = _mm256_fnmadd_pd_custom(bpd, wr, _mm256_add_pd(x.val[0], c));
+        v4sd zi = _mm256_fmadd_pd_custom(amc, wr, _mm256_sub_pd(x.val[1], d));
+        _mm256_storeu_pd(re + k, _mm256_fmadd_pd_custom(amc, wi, zr));
+        _mm256_storeu_pd(im + k, _mm256_fmadd_pd_custom(bpd, wi, zi));
+    }
+    irfft_pred_C(plan, src, re, im, k);
+
+    fft_split_core256d(plan, im, re, im, re);
+    realtocplx256d(re, im, (complex64_t *) dst, n);
+}
+
+/* FIR kernel and convolutions (see simd_utils_fir.h and simd_utils_conv.h) */
+
+// dst[i] = (dst[i] if accumulate) + sum_m taps[m] * src[i + m], 8 vectors of outputs per pass on the taps
+static inline void fir_kernel256d(const double *taps, int nb_taps, const double *src, double *dst, int len, int accumulate)
+{
+    int i = 0;
+    for (; (i + 8 * AVX_LEN_DOUBLE) <= len; i += 8 * AVX_LEN_DOUBLE) {
+        v4sd acc[8];
+        for (int k = 0; k < 8; k++)
+            acc[k] = accumulate ? _mm256_loadu_pd(dst + i + k * AVX_LEN_DOUBLE) : _mm256_setzero_pd();
+        const double *s = src + i;
+        for (int m = 0; m < nb_taps; m++) {
+            v4sd tap = _mm256_set1_pd(taps[m]);
+            acc[0] = _mm256_fmadd_pd_custom(tap, _mm256_loadu_pd(s + m), acc[0]);
+            acc[1] = _mm256_fmadd_pd_custom(tap, _mm256_loadu_pd(s + m + AVX_LEN_DOUBLE), acc[1]);
+            acc[2] = _mm256_fmadd_pd_custom(tap, _mm256_loadu_pd(s + m + 2 * AVX_LEN_DOUBLE), acc[2]);
+            acc[3] = _mm256_fmadd_pd_custom(tap, _mm256_loadu_pd(s + m + 3 * AVX_LEN_DOUBLE), acc[3]);
+            acc[4] = _mm256_fmadd_pd_custom(tap, _mm256_loadu_pd(s + m + 4 * AVX_LEN_DOUBLE), acc[4]);
+            acc[5] = _mm256_fmadd_pd_custom(tap, _mm256_loadu_pd(s + m + 5 * AVX_LEN_DOUBLE), acc[5]);
+            acc[6] = _mm256_fmadd_pd_custom(tap, _mm256_loadu_pd(s + m + 6 * AVX_LEN_DOUBLE), acc[6]);
+            acc[7] = _mm256_fmadd_pd_custom(tap, _mm256_loadu_pd(s + m + 7 * AVX_LEN_DOUBLE), acc[7]);
+        }
+        for (int k = 0; k < 8; k++)
+            _mm256_storeu_pd(dst + i + k * AVX_LEN_DOUBLE, acc[k]);
+    }
+
+    for (; (i + AVX_LEN_DOUBLE) <= len; i += AVX_LEN_DOUBLE) {
+        v4sd acc = accumulate ? _mm256_loadu_pd(dst + i) : _mm256_setzero_pd();
+        for (int m = 0; m < nb_taps; m++)
+            acc = _mm256_fmadd_pd_custom(_mm256_set1_pd(taps[m]), _mm256_loadu_pd(src + i + m), acc);
+        _mm256_storeu_pd(dst + i, acc);
+    }
+
+    if (i < len)
+        fir_kerneld_C(taps, nb_taps, src + i, dst + i, len - i, accumulate);
+}
+
+SIMD_UTILS_API void cplxvecmul256d(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len)
+{
+    int stop_len = len / (AVX_LEN_DOUBLE);
+    stop_len = stop_len * AVX_LEN_DOUBLE;
+
+    int i;
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (i = 0; i < 2 * stop_len; i += AVX_LEN_DOUBLE) {
+            v4sd src1_tmp = _mm256_load_pd((double *) (src1) + i);  // src1 = b0,a0 (little endian)
+            v4sd src2_tmp = _mm256_load_pd((double *) (src2) + i);  // src2 = d0,c0
+            v4sd tmp1 = _mm256_movedup_pd(src1_tmp);  // a0,a0
+            v4sd tmp2 = _mm256_permute_pd(src2_tmp, 0x5);  // c0,d0
+            v4sd tmp3 = _mm256_permute_pd(src1_tmp, 0xF);  // b0,b0
+            v4sd out = _mm256_mul_pd(tmp2, tmp3);
+            out = _mm256_fmaddsub_pd_custom(tmp1, src2_tmp, out);
+            _mm256_store_pd((double *) (dst) + i, out);
+        }
+    } else {
+        for (i = 0; i < 2 * stop_len; i += AVX_LEN_DOUBLE) {
+            v4sd src1_tmp = _mm256_loadu_pd((double *) (src1) + i);  // src1 = b0,a0 (little endian)
+            v4sd src2_tmp = _mm256_loadu_pd((double *) (src2) + i);  // src2 = d0,c0
+            v4sd tmp1 = _mm256_movedup_pd(src1_tmp);  // a0,a0
+            v4sd tmp2 = _mm256_permute_pd(src2_tmp, 0x5);  // c0,d0
+            v4sd tmp3 = _mm256_permute_pd(src1_tmp, 0xF);  // b0,b0
+            v4sd out = _mm256_mul_pd(tmp2, tmp3);
+            out = _mm256_fmaddsub_pd_custom(tmp1, src2_tmp, out);
+            _mm256_storeu_pd((double *) (dst) + i, out);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i].re = (src1[i].re * src2[i].re) - src1[i].im * src2[i].im;
+        dst[i].im = src1[i].re * src2[i].im + (src2[i].re * src1[i].im);
+    }
+}
+
+SIMD_UTILS_API void cplxvecmul256d_split(double *src1Re, double *src1Im, double *src2Re, double *src2Im, double *dstRe, double *dstIm, int len)
+{
+    int stop_len = len / AVX_LEN_DOUBLE;
+    stop_len *= AVX_LEN_DOUBLE;
+
+    if (areAligned3((uintptr_t) (src1Re), (uintptr_t) (src1Im), (uintptr_t) (src2Re), AVX_LEN_BYTES) &&
+        areAligned3((uintptr_t) (src2Im), (uintptr_t) (dstRe), (uintptr_t) (dstIm), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+            v4sd src1Re_tmp = _mm256_load_pd(src1Re + i);
+            v4sd src1Im_tmp = _mm256_load_pd(src1Im + i);
+            v4sd src2Re_tmp = _mm256_load_pd(src2Re + i);
+            v4sd src2Im_tmp = _mm256_load_pd(src2Im + i);
+            v4sd bc = _mm256_mul_pd(src1Im_tmp, src2Re_tmp);
+            v4sd ac = _mm256_mul_pd(src1Re_tmp, src2Re_tmp);
+            v4sd dstRe_tmp = _mm256_fnmadd_pd_custom(src1Im_tmp, src2Im_tmp, ac);  // ac - bd
+            v4sd dstIm_tmp = _mm256_fmadd_pd_custom(src1Re_tmp, src2Im_tmp, bc);   // ad + bc
+            _mm256_store_pd(dstRe + i, dstRe_tmp);
+            _mm256_store_pd(dstIm + i, dstIm_tmp);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+            v4sd src1Re_tmp = _mm256_loadu_pd(src1Re + i);
+            v4sd src1Im_tmp = _mm256_loadu_pd(src1Im + i);
+            v4sd src2Re_tmp = _mm256_loadu_pd(src2Re + i);
+            v4sd src2Im_tmp = _mm256_loadu_pd(src2Im + i);
+            v4sd bc = _mm256_mul_pd(src1Im_tmp, src2Re_tmp);
+            v4sd ac = _mm256_mul_pd(src1Re_tmp, src2Re_tmp);
+            v4sd dstRe_tmp = _mm256_fnmadd_pd_custom(src1Im_tmp, src2Im_tmp, ac);  // ac - bd
+            v4sd dstIm_tmp = _mm256_fmadd_pd_custom(src1Re_tmp, src2Im_tmp, bc);   // ad + bc
+            _mm256_storeu_pd(dstRe + i, dstRe_tmp);
+            _mm256_storeu_pd(dstIm + i, dstIm_tmp);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dstRe[i] = src1Re[i] * src2Re[i] - src1Im[i] * src2Im[i];
+        dstIm[i] = src1Re[i] * src2Im[i] + src2Re[i] * src1Im[i];
+    }
+}
+
+SIMD_UTILS_API void cplxconjvecmul256d(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len)
+{
+    int stop_len = len / (AVX_LEN_DOUBLE);
+    stop_len = stop_len * AVX_LEN_DOUBLE;
+
+    int i;
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (i = 0; i < 2 * stop_len; i += AVX_LEN_DOUBLE) {
+            v4sd src1_tmp = _mm256_load_pd((double *) (src1) + i);  // src1 = b0,a0 (little endian)
+            v4sd src2_tmp = _mm256_load_pd((double *) (src2) + i);  // src2 = d0,c0
+            v4sd tmp1 = _mm256_movedup_pd(src1_tmp);          // a0,a0
+            v4sd tmp2 = _mm256_mul_pd(tmp1, src2_tmp);  // a0d0,a0c0
+            v4sd tmp3 = _mm256_permute_pd(src2_tmp, 0x5);           // c0,d0
+            v4sd tmp4 = _mm256_permute_pd(src1_tmp, 0xF);          // b0,b0
+            v4sd out = _mm256_fmsubadd_pd_custom(tmp3, tmp4, tmp2);  // b0c0 - a0d0, a0c0 + b0d0
+            _mm256_store_pd((double *) (dst) + i, out);
+        }
+    } else {
+        for (i = 0; i < 2 * stop_len; i += AVX_LEN_DOUBLE) {
+            v4sd src1_tmp = _mm256_loadu_pd((double *) (src1) + i);  // src1 = b0,a0 (little endian)
+            v4sd src2_tmp = _mm256_loadu_pd((double *) (src2) + i);  // src2 = d0,c0
+            v4sd tmp1 = _mm256_movedup_pd(src1_tmp);          // a0,a0
+            v4sd tmp2 = _mm256_mul_pd(tmp1, src2_tmp);  // a0d0,a0c0
+            v4sd tmp3 = _mm256_permute_pd(src2_tmp, 0x5);           // c0,d0
+            v4sd tmp4 = _mm256_permute_pd(src1_tmp, 0xF);          // b0,b0
+            v4sd out = _mm256_fmsubadd_pd_custom(tmp3, tmp4, tmp2);  // b0c0 - a0d0, a0c0 + b0d0
+            _mm256_storeu_pd((double *) (dst) + i, out);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i].re = src1[i].re * src2[i].re + src1[i].im * src2[i].im;
+        dst[i].im = src2[i].re * src1[i].im - src1[i].re * src2[i].im;
+    }
+}
+
+SIMD_UTILS_API void cplxconjvecmul256d_split(double *src1Re, double *src1Im, double *src2Re, double *src2Im, double *dstRe, double *dstIm, int len)
+{
+    int stop_len = len / AVX_LEN_DOUBLE;
+    stop_len *= AVX_LEN_DOUBLE;
+
+    if (areAligned3((uintptr_t) (src1Re), (uintptr_t) (src1Im), (uintptr_t) (src2Re), AVX_LEN_BYTES) &&
+        areAligned3((uintptr_t) (src2Im), (uintptr_t) (dstRe), (uintptr_t) (dstIm), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+            v4sd src1Re_tmp = _mm256_load_pd(src1Re + i);
+            v4sd src1Im_tmp = _mm256_load_pd(src1Im + i);
+            v4sd src2Re_tmp = _mm256_load_pd(src2Re + i);
+            v4sd src2Im_tmp = _mm256_load_pd(src2Im + i);
+            v4sd bc = _mm256_mul_pd(src1Im_tmp, src2Re_tmp);
+            v4sd ac = _mm256_mul_pd(src1Re_tmp, src2Re_tmp);
+            v4sd dstRe_tmp = _mm256_fmadd_pd_custom(src1Im_tmp, src2Im_tmp, ac);   // ac + bd
+            v4sd dstIm_tmp = _mm256_fnmadd_pd_custom(src1Re_tmp, src2Im_tmp, bc);  // bc - ad
+            _mm256_store_pd(dstRe + i, dstRe_tmp);
+            _mm256_store_pd(dstIm + i, dstIm_tmp);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+            v4sd src1Re_tmp = _mm256_loadu_pd(src1Re + i);
+            v4sd src1Im_tmp = _mm256_loadu_pd(src1Im + i);
+            v4sd src2Re_tmp = _mm256_loadu_pd(src2Re + i);
+            v4sd src2Im_tmp = _mm256_loadu_pd(src2Im + i);
+            v4sd bc = _mm256_mul_pd(src1Im_tmp, src2Re_tmp);
+            v4sd ac = _mm256_mul_pd(src1Re_tmp, src2Re_tmp);
+            v4sd dstRe_tmp = _mm256_fmadd_pd_custom(src1Im_tmp, src2Im_tmp, ac);   // ac + bd
+            v4sd dstIm_tmp = _mm256_fnmadd_pd_custom(src1Re_tmp, src2Im_tmp, bc);  // bc - ad
+            _mm256_storeu_pd(dstRe + i, dstRe_tmp);
+            _mm256_storeu_pd(dstIm + i, dstIm_tmp);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dstRe[i] = src1Re[i] * src2Re[i] + src1Im[i] * src2Im[i];
+        dstIm[i] = src2Re[i] * src1Im[i] - src1Re[i] * src2Im[i];
+    }
+}
+
+SIMD_UTILS_API void cplxvecdiv256d(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len)
+{
+    int stop_len = len / (AVX_LEN_DOUBLE);
+    stop_len = stop_len * AVX_LEN_DOUBLE;
+
+    int i;
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (i = 0; i < 2 * stop_len; i += AVX_LEN_DOUBLE) {
+            v4sd src1_tmp = _mm256_load_pd((double *) (src1) + i);  // src1 = b0,a0 (little endian)
+            v4sd src2_tmp = _mm256_load_pd((double *) (src2) + i);  // src2 = d0,c0
+            v4sd tmp1 = _mm256_movedup_pd(src1_tmp);          // a0,a0
+            v4sd tmp2 = _mm256_mul_pd(tmp1, src2_tmp);  // a0d0,a0c0
+            v4sd tmp3 = _mm256_permute_pd(src2_tmp, 0x5);           // c0,d0
+            v4sd tmp4 = _mm256_permute_pd(src1_tmp, 0xF);          // b0,b0
+            v4sd out = _mm256_fmsubadd_pd_custom(tmp3, tmp4, tmp2);  // b0c0 - a0d0, a0c0 + b0d0
+            v4sd c2d2 = _mm256_mul_pd(src2_tmp, src2_tmp);
+            c2d2 = _mm256_add_pd(c2d2, _mm256_permute_pd(c2d2, 0x5));  // c0^2 + d0^2, c0^2 + d0^2
+            out = _mm256_div_pd(out, c2d2);
+            _mm256_store_pd((double *) (dst) + i, out);
+        }
+    } else {
+        for (i = 0; i < 2 * stop_len; i += AVX_LEN_DOUBLE) {
+            v4sd src1_tmp = _mm256_loadu_pd((double *) (src1) + i);  // src1 = b0,a0 (little endian)
+            v4sd src2_tmp = _mm256_loadu_pd((double *) (src2) + i);  // src2 = d0,c0
+            v4sd tmp1 = _mm256_movedup_pd(src1_tmp);          // a0,a0
+            v4sd tmp2 = _mm256_mul_pd(tmp1, src2_tmp);  // a0d0,a0c0
+            v4sd tmp3 = _mm256_permute_pd(src2_tmp, 0x5);           // c0,d0
+            v4sd tmp4 = _mm256_permute_pd(src1_tmp, 0xF);          // b0,b0
+            v4sd out = _mm256_fmsubadd_pd_custom(tmp3, tmp4, tmp2);  // b0c0 - a0d0, a0c0 + b0d0
+            v4sd c2d2 = _mm256_mul_pd(src2_tmp, src2_tmp);
+            c2d2 = _mm256_add_pd(c2d2, _mm256_permute_pd(c2d2, 0x5));  // c0^2 + d0^2, c0^2 + d0^2
+            out = _mm256_div_pd(out, c2d2);
+            _mm256_storeu_pd((double *) (dst) + i, out);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        double c2d2 = src2[i].re * src2[i].re + src2[i].im * src2[i].im;
+        dst[i].re = (src1[i].re * src2[i].re + src1[i].im * src2[i].im) / c2d2;
+        dst[i].im = (src2[i].re * src1[i].im - src1[i].re * src2[i].im) / c2d2;
+    }
+}
+
+SIMD_UTILS_API void cplxvecdiv256d_split(double *src1Re, double *src1Im, double *src2Re, double *src2Im, double *dstRe, double *dstIm, int len)
+{
+    int stop_len = len / AVX_LEN_DOUBLE;
+    stop_len *= AVX_LEN_DOUBLE;
+
+    if (areAligned3((uintptr_t) (src1Re), (uintptr_t) (src1Im), (uintptr_t) (src2Re), AVX_LEN_BYTES) &&
+        areAligned3((uintptr_t) (src2Im), (uintptr_t) (dstRe), (uintptr_t) (dstIm), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+            v4sd src1Re_tmp = _mm256_load_pd(src1Re + i);
+            v4sd src1Im_tmp = _mm256_load_pd(src1Im + i);
+            v4sd src2Re_tmp = _mm256_load_pd(src2Re + i);
+            v4sd src2Im_tmp = _mm256_load_pd(src2Im + i);
+            v4sd bc = _mm256_mul_pd(src1Im_tmp, src2Re_tmp);
+            v4sd ac = _mm256_mul_pd(src1Re_tmp, src2Re_tmp);
+            v4sd dstRe_tmp = _mm256_fmadd_pd_custom(src1Im_tmp, src2Im_tmp, ac);   // ac + bd
+            v4sd dstIm_tmp = _mm256_fnmadd_pd_custom(src1Re_tmp, src2Im_tmp, bc);  // bc - ad
+            v4sd c2d2 = _mm256_fmadd_pd_custom(src2Im_tmp, src2Im_tmp, _mm256_mul_pd(src2Re_tmp, src2Re_tmp));
+            dstRe_tmp = _mm256_div_pd(dstRe_tmp, c2d2);
+            dstIm_tmp = _mm256_div_pd(dstIm_tmp, c2d2);
+            _mm256_store_pd(dstRe + i, dstRe_tmp);
+            _mm256_store_pd(dstIm + i, dstIm_tmp);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+            v4sd src1Re_tmp = _mm256_loadu_pd(src1Re + i);
+            v4sd src1Im_tmp = _mm256_loadu_pd(src1Im + i);
+            v4sd src2Re_tmp = _mm256_loadu_pd(src2Re + i);
+            v4sd src2Im_tmp = _mm256_loadu_pd(src2Im + i);
+            v4sd bc = _mm256_mul_pd(src1Im_tmp, src2Re_tmp);
+            v4sd ac = _mm256_mul_pd(src1Re_tmp, src2Re_tmp);
+            v4sd dstRe_tmp = _mm256_fmadd_pd_custom(src1Im_tmp, src2Im_tmp, ac);   // ac + bd
+            v4sd dstIm_tmp = _mm256_fnmadd_pd_custom(src1Re_tmp, src2Im_tmp, bc);  // bc - ad
+            v4sd c2d2 = _mm256_fmadd_pd_custom(src2Im_tmp, src2Im_tmp, _mm256_mul_pd(src2Re_tmp, src2Re_tmp));
+            dstRe_tmp = _mm256_div_pd(dstRe_tmp, c2d2);
+            dstIm_tmp = _mm256_div_pd(dstIm_tmp, c2d2);
+            _mm256_storeu_pd(dstRe + i, dstRe_tmp);
+            _mm256_storeu_pd(dstIm + i, dstIm_tmp);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        double c2d2 = src2Re[i] * src2Re[i] + src2Im[i] * src2Im[i];
+        dstRe[i] = (src1Re[i] * src2Re[i] + src1Im[i] * src2Im[i]) / c2d2;
+        dstIm[i] = (src2Re[i] * src1Im[i] - src1Re[i] * src2Im[i]) / c2d2;
+    }
+}
+
+// prefer using cplxconjvecmulXd if you also need to do a multiply
+SIMD_UTILS_API void cplxconj256d(complex64_t *src, complex64_t *dst, int len)
+{
+    int stop_len = len / AVX_LEN_DOUBLE;
+    stop_len *= AVX_LEN_DOUBLE;
+
+    __attribute__((aligned(AVX_LEN_BYTES))) int64_t conj_mask[AVX_LEN_DOUBLE] = {0, (int64_t) 0x8000000000000000, 0, (int64_t) 0x8000000000000000};
+    v4sd conj_vec = _mm256_load_pd((double *) conj_mask);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < 2 * stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd src_tmp = _mm256_load_pd((double *) (src) + i);
+            v4sd src_tmp2 = _mm256_load_pd((double *) (src) + i + AVX_LEN_DOUBLE);
+            _mm256_store_pd((double *) (dst) + i, _mm256_xor_pd(src_tmp, conj_vec));
+            _mm256_store_pd((double *) (dst) + i + AVX_LEN_DOUBLE, _mm256_xor_pd(src_tmp2, conj_vec));
+        }
+    } else {
+        for (int i = 0; i < 2 * stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd src_tmp = _mm256_loadu_pd((double *) (src) + i);
+            v4sd src_tmp2 = _mm256_loadu_pd((double *) (src) + i + AVX_LEN_DOUBLE);
+            _mm256_storeu_pd((double *) (dst) + i, _mm256_xor_pd(src_tmp, conj_vec));
+            _mm256_storeu_pd((double *) (dst) + i + AVX_LEN_DOUBLE, _mm256_xor_pd(src_tmp2, conj_vec));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i].re = src[i].re;
+        dst[i].im = -src[i].im;
+    }
+}
+
+SIMD_UTILS_API void magnitude256d_split(double *srcRe, double *srcIm, double *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_DOUBLE);
+    stop_len *= 2 * AVX_LEN_DOUBLE;
+
+    if (areAligned3((uintptr_t) (srcRe), (uintptr_t) (srcIm), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd re_tmp = _mm256_load_pd(srcRe + i);
+            v4sd im_tmp = _mm256_load_pd(srcIm + i);
+            v4sd re_tmp2 = _mm256_load_pd(srcRe + i + AVX_LEN_DOUBLE);
+            v4sd im_tmp2 = _mm256_load_pd(srcIm + i + AVX_LEN_DOUBLE);
+            v4sd dst_tmp = _mm256_fmadd_pd_custom(im_tmp, im_tmp, _mm256_mul_pd(re_tmp, re_tmp));
+            v4sd dst_tmp2 = _mm256_fmadd_pd_custom(im_tmp2, im_tmp2, _mm256_mul_pd(re_tmp2, re_tmp2));
+            _mm256_store_pd(dst + i, _mm256_sqrt_pd(dst_tmp));
+            _mm256_store_pd(dst + i + AVX_LEN_DOUBLE, _mm256_sqrt_pd(dst_tmp2));
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd re_tmp = _mm256_loadu_pd(srcRe + i);
+            v4sd im_tmp = _mm256_loadu_pd(srcIm + i);
+            v4sd re_tmp2 = _mm256_loadu_pd(srcRe + i + AVX_LEN_DOUBLE);
+            v4sd im_tmp2 = _mm256_loadu_pd(srcIm + i + AVX_LEN_DOUBLE);
+            v4sd dst_tmp = _mm256_fmadd_pd_custom(im_tmp, im_tmp, _mm256_mul_pd(re_tmp, re_tmp));
+            v4sd dst_tmp2 = _mm256_fmadd_pd_custom(im_tmp2, im_tmp2, _mm256_mul_pd(re_tmp2, re_tmp2));
+            _mm256_storeu_pd(dst + i, _mm256_sqrt_pd(dst_tmp));
+            _mm256_storeu_pd(dst + i + AVX_LEN_DOUBLE, _mm256_sqrt_pd(dst_tmp2));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = sqrt(srcRe[i] * srcRe[i] + srcIm[i] * srcIm[i]);
+    }
+}
+
+SIMD_UTILS_API void magnitude256d_interleaved(complex64_t *src, double *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_DOUBLE);
+    stop_len *= 2 * AVX_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sdx2 src_split = _mm256_load2_pd((double *) (src + i));  // a0a1, b0b1
+            v4sdx2 src_split2 = _mm256_load2_pd((double *) (src + i + AVX_LEN_DOUBLE));
+            v4sd dst_tmp = _mm256_fmadd_pd_custom(src_split.val[1], src_split.val[1], _mm256_mul_pd(src_split.val[0], src_split.val[0]));
+            v4sd dst_tmp2 = _mm256_fmadd_pd_custom(src_split2.val[1], src_split2.val[1], _mm256_mul_pd(src_split2.val[0], src_split2.val[0]));
+            _mm256_store_pd(dst + i, _mm256_sqrt_pd(dst_tmp));
+            _mm256_store_pd(dst + i + AVX_LEN_DOUBLE, _mm256_sqrt_pd(dst_tmp2));
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sdx2 src_split = _mm256_load2u_pd((double *) (src + i));  // a0a1, b0b1
+            v4sdx2 src_split2 = _mm256_load2u_pd((double *) (src + i + AVX_LEN_DOUBLE));
+            v4sd dst_tmp = _mm256_fmadd_pd_custom(src_split.val[1], src_split.val[1], _mm256_mul_pd(src_split.val[0], src_split.val[0]));
+            v4sd dst_tmp2 = _mm256_fmadd_pd_custom(src_split2.val[1], src_split2.val[1], _mm256_mul_pd(src_split2.val[0], src_split2.val[0]));
+            _mm256_storeu_pd(dst + i, _mm256_sqrt_pd(dst_tmp));
+            _mm256_storeu_pd(dst + i + AVX_LEN_DOUBLE, _mm256_sqrt_pd(dst_tmp2));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = sqrt(src[i].re * src[i].re + src[i].im * src[i].im);
+    }
+}
+
+SIMD_UTILS_API void powerspect256d_split(double *srcRe, double *srcIm, double *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_DOUBLE);
+    stop_len *= 2 * AVX_LEN_DOUBLE;
+
+    if (areAligned3((uintptr_t) (srcRe), (uintptr_t) (srcIm), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd re_tmp = _mm256_load_pd(srcRe + i);
+            v4sd im_tmp = _mm256_load_pd(srcIm + i);
+            v4sd re_tmp2 = _mm256_load_pd(srcRe + i + AVX_LEN_DOUBLE);
+            v4sd im_tmp2 = _mm256_load_pd(srcIm + i + AVX_LEN_DOUBLE);
+            v4sd dst_tmp = _mm256_fmadd_pd_custom(im_tmp, im_tmp, _mm256_mul_pd(re_tmp, re_tmp));
+            v4sd dst_tmp2 = _mm256_fmadd_pd_custom(im_tmp2, im_tmp2, _mm256_mul_pd(re_tmp2, re_tmp2));
+            _mm256_store_pd(dst + i, dst_tmp);
+            _mm256_store_pd(dst + i + AVX_LEN_DOUBLE, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd re_tmp = _mm256_loadu_pd(srcRe + i);
+            v4sd im_tmp = _mm256_loadu_pd(srcIm + i);
+            v4sd re_tmp2 = _mm256_loadu_pd(srcRe + i + AVX_LEN_DOUBLE);
+            v4sd im_tmp2 = _mm256_loadu_pd(srcIm + i + AVX_LEN_DOUBLE);
+            v4sd dst_tmp = _mm256_fmadd_pd_custom(im_tmp, im_tmp, _mm256_mul_pd(re_tmp, re_tmp));
+            v4sd dst_tmp2 = _mm256_fmadd_pd_custom(im_tmp2, im_tmp2, _mm256_mul_pd(re_tmp2, re_tmp2));
+            _mm256_storeu_pd(dst + i, dst_tmp);
+            _mm256_storeu_pd(dst + i + AVX_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = srcRe[i] * srcRe[i] + srcIm[i] * srcIm[i];
+    }
+}
+
+SIMD_UTILS_API void powerspect256d_interleaved(complex64_t *src, double *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_DOUBLE);
+    stop_len *= 2 * AVX_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sdx2 src_split = _mm256_load2_pd((double *) (src + i));  // a0a1, b0b1
+            v4sdx2 src_split2 = _mm256_load2_pd((double *) (src + i + AVX_LEN_DOUBLE));
+            v4sd dst_tmp = _mm256_fmadd_pd_custom(src_split.val[1], src_split.val[1], _mm256_mul_pd(src_split.val[0], src_split.val[0]));
+            v4sd dst_tmp2 = _mm256_fmadd_pd_custom(src_split2.val[1], src_split2.val[1], _mm256_mul_pd(src_split2.val[0], src_split2.val[0]));
+            _mm256_store_pd(dst + i, dst_tmp);
+            _mm256_store_pd(dst + i + AVX_LEN_DOUBLE, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sdx2 src_split = _mm256_load2u_pd((double *) (src + i));  // a0a1, b0b1
+            v4sdx2 src_split2 = _mm256_load2u_pd((double *) (src + i + AVX_LEN_DOUBLE));
+            v4sd dst_tmp = _mm256_fmadd_pd_custom(src_split.val[1], src_split.val[1], _mm256_mul_pd(src_split.val[0], src_split.val[0]));
+            v4sd dst_tmp2 = _mm256_fmadd_pd_custom(src_split2.val[1], src_split2.val[1], _mm256_mul_pd(src_split2.val[0], src_split2.val[0]));
+            _mm256_storeu_pd(dst + i, dst_tmp);
+            _mm256_storeu_pd(dst + i + AVX_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src[i].re * src[i].re + src[i].im * src[i].im;
+    }
+}
+
+static inline void conv_block256d(conv64_t *conv)
+{
+    rfft256d(conv->plan, conv->buf, (complex64_t *) conv->work);
+    cplxvecmul256d((complex64_t *) conv->work, (complex64_t *) conv->spectrum, (complex64_t *) conv->out, conv->fft_len / 2 + 1);
+    irfft256d(conv->plan, (complex64_t *) conv->out, conv->out);
+}
+
+// returns len
+SIMD_UTILS_API int conv256d(conv64_t *conv, double *src, double *dst, int len)
+{
+    return conv_rund(conv, fir_kernel256d, conv_block256d, src, dst, len);
+}
+
+SIMD_UTILS_API void minmax256d(double *src, int len, double *min_value, double *max_value)
+{
+    int stop_len = (len - AVX_LEN_DOUBLE) / (2 * AVX_LEN_DOUBLE);
+    stop_len *= (2 * AVX_LEN_DOUBLE);
+    stop_len = (stop_len < 0) ? 0 : stop_len;
+
+    double min_s[AVX_LEN_DOUBLE] __attribute__((aligned(AVX_LEN_BYTES)));
+    double max_s[AVX_LEN_DOUBLE] __attribute__((aligned(AVX_LEN_BYTES)));
+    v4sd max_v, min_v, max_v2, min_v2;
+    v4sd src_tmp, src_tmp2;
+
+    double min_tmp = src[0];
+    double max_tmp = src[0];
+
+    if (len >= AVX_LEN_DOUBLE) {
+        if (isAligned((uintptr_t) (src), AVX_LEN_BYTES)) {
+            src_tmp = _mm256_load_pd(src + 0);
+            max_v = src_tmp;
+            min_v = src_tmp;
+            max_v2 = src_tmp;
+            min_v2 = src_tmp;
+
+            for (int i = AVX_LEN_DOUBLE; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+                src_tmp = _mm256_load_pd(src + i);
+                src_tmp2 = _mm256_load_pd(src + i + AVX_LEN_DOUBLE);
+                max_v = _mm256_max_pd(max_v, src_tmp);
+                min_v = _mm256_min_pd(min_v, src_tmp);
+                max_v2 = _mm256_max_pd(max_v2, src_tmp2);
+                min_v2 = _mm256_min_pd(min_v2, src_tmp2);
+            }
+        } else {
+            src_tmp = _mm256_loadu_pd(src + 0);
+            max_v = src_tmp;
+            min_v = src_tmp;
+            max_v2 = src_tmp;
+            min_v2 = src_tmp;
+
+            for (int i = AVX_LEN_DOUBLE; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+                src_tmp = _mm256_loadu_pd(src + i);
+                src_tmp2 = _mm256_loadu_pd(src + i + AVX_LEN_DOUBLE);
+                max_v = _mm256_max_pd(max_v, src_tmp);
+                min_v = _mm256_min_pd(min_v, src_tmp);
+                max_v2 = _mm256_max_pd(max_v2, src_tmp2);
+                min_v2 = _mm256_min_pd(min_v2, src_tmp2);
+            }
+        }
+
+        max_v = _mm256_max_pd(max_v, max_v2);
+        min_v = _mm256_min_pd(min_v, min_v2);
+
+        _mm256_store_pd(max_s, max_v);
+        _mm256_store_pd(min_s, min_v);
+
+        max_tmp = max_s[0];
+        min_tmp = min_s[0];
+        for (int i = 1; i < AVX_LEN_DOUBLE; i++) {
+            max_tmp = max_tmp > max_s[i] ? max_tmp : max_s[i];
+            min_tmp = min_tmp < min_s[i] ? min_tmp : min_s[i];
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        max_tmp = max_tmp > src[i] ? max_tmp : src[i];
+        min_tmp = min_tmp < src[i] ? min_tmp : src[i];
+    }
+
+    *max_value = max_tmp;
+    *min_value = min_tmp;
+}
+
+#ifdef __AVX2__
+// exp(x - max) / sum of exp(x - max) : the largest element gives 1, so the sum cannot overflow
+SIMD_UTILS_API void softmax256d(double *src, double *dst, int len)
+{
+    int stop_len = len / AVX_LEN_DOUBLE;
+    stop_len *= AVX_LEN_DOUBLE;
+
+    __attribute__((aligned(AVX_LEN_BYTES))) double accumulate[AVX_LEN_DOUBLE];
+    double min_value, max_value, acc = 0.0;
+
+    if (len <= 0)
+        return;
+
+    minmax256d(src, len, &min_value, &max_value);
+    v4sd max_vec = _mm256_set1_pd(max_value);
+    v4sd vec_acc = _mm256_setzero_pd();
+
+    for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+        v4sd src_tmp = _mm256_max_pd(_mm256_sub_pd(_mm256_loadu_pd(src + i), max_vec), *(v4sd *) _pd256_exp_min);
+        v4sd dst_tmp = exp256_pd(src_tmp);
+        vec_acc = _mm256_add_pd(vec_acc, dst_tmp);
+        _mm256_storeu_pd(dst + i, dst_tmp);
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = exp(src[i] - max_value);
+        acc += dst[i];
+    }
+    _mm256_store_pd(accumulate, vec_acc);
+    for (int i = 0; i < AVX_LEN_DOUBLE; i++) {
+        acc += accumulate[i];
+    }
+
+    v4sd acc_vec = _mm256_set1_pd(acc);
+    for (int i = 0; i < stop_len; i += AVX_LEN_DOUBLE) {
+        _mm256_storeu_pd(dst + i, _mm256_div_pd(_mm256_loadu_pd(dst + i), acc_vec));
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] /= acc;
+    }
+}
+#endif
+
+// first index of value in src, len if it is not found
+static inline int firsteq256d(double *src, int len, double value)
+{
+    int stop_len = len / (2 * AVX_LEN_DOUBLE);
+    stop_len *= (2 * AVX_LEN_DOUBLE);
+
+    v4sd value_v = _mm256_set1_pd(value);
+    for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+        uint32_t mask = (uint32_t) _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(src + i), value_v, _CMP_EQ_OQ));
+        mask |= (uint32_t) _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(src + i + AVX_LEN_DOUBLE), value_v, _CMP_EQ_OQ)) << 4;
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+    for (int i = stop_len; i < len; i++) {
+        if (src[i] == value)
+            return i;
+    }
+    return len;
+}
+
+SIMD_UTILS_API void maxloc256d(double *src, double *max, int *idx, int len)
+{
+    minmaxloc_rund(src, len, minmax256d, firsteq256d, NULL, NULL, max, idx);
+}
+
+SIMD_UTILS_API void minloc256d(double *src, double *min, int *idx, int len)
+{
+    minmaxloc_rund(src, len, minmax256d, firsteq256d, min, idx, NULL, NULL);
+}
+
+SIMD_UTILS_API void minmaxloc256d(double *src, int len, double *min_value, int *min_idx, double *max_value, int *max_idx)
+{
+    minmaxloc_rund(src, len, minmax256d, firsteq256d, min_value, min_idx, max_value, max_idx);
+}
+
+SIMD_UTILS_API void maxevery256d(double *src1, double *src2, double *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_DOUBLE);
+    stop_len *= (2 * AVX_LEN_DOUBLE);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd src1_tmp = _mm256_load_pd(src1 + i);
+            v4sd src2_tmp = _mm256_load_pd(src2 + i);
+            v4sd src1_tmp2 = _mm256_load_pd(src1 + i + AVX_LEN_DOUBLE);
+            v4sd src2_tmp2 = _mm256_load_pd(src2 + i + AVX_LEN_DOUBLE);
+            v4sd dst_tmp = _mm256_max_pd(src1_tmp, src2_tmp);
+            v4sd dst_tmp2 = _mm256_max_pd(src1_tmp2, src2_tmp2);
+            _mm256_store_pd(dst + i, dst_tmp);
+            _mm256_store_pd(dst + i + AVX_LEN_DOUBLE, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd src1_tmp = _mm256_loadu_pd(src1 + i);
+            v4sd src2_tmp = _mm256_loadu_pd(src2 + i);
+            v4sd src1_tmp2 = _mm256_loadu_pd(src1 + i + AVX_LEN_DOUBLE);
+            v4sd src2_tmp2 = _mm256_loadu_pd(src2 + i + AVX_LEN_DOUBLE);
+            v4sd dst_tmp = _mm256_max_pd(src1_tmp, src2_tmp);
+            v4sd dst_tmp2 = _mm256_max_pd(src1_tmp2, src2_tmp2);
+            _mm256_storeu_pd(dst + i, dst_tmp);
+            _mm256_storeu_pd(dst + i + AVX_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src1[i] > src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void minevery256d(double *src1, double *src2, double *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_DOUBLE);
+    stop_len *= (2 * AVX_LEN_DOUBLE);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd src1_tmp = _mm256_load_pd(src1 + i);
+            v4sd src2_tmp = _mm256_load_pd(src2 + i);
+            v4sd src1_tmp2 = _mm256_load_pd(src1 + i + AVX_LEN_DOUBLE);
+            v4sd src2_tmp2 = _mm256_load_pd(src2 + i + AVX_LEN_DOUBLE);
+            v4sd dst_tmp = _mm256_min_pd(src1_tmp, src2_tmp);
+            v4sd dst_tmp2 = _mm256_min_pd(src1_tmp2, src2_tmp2);
+            _mm256_store_pd(dst + i, dst_tmp);
+            _mm256_store_pd(dst + i + AVX_LEN_DOUBLE, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd src1_tmp = _mm256_loadu_pd(src1 + i);
+            v4sd src2_tmp = _mm256_loadu_pd(src2 + i);
+            v4sd src1_tmp2 = _mm256_loadu_pd(src1 + i + AVX_LEN_DOUBLE);
+            v4sd src2_tmp2 = _mm256_loadu_pd(src2 + i + AVX_LEN_DOUBLE);
+            v4sd dst_tmp = _mm256_min_pd(src1_tmp, src2_tmp);
+            v4sd dst_tmp2 = _mm256_min_pd(src1_tmp2, src2_tmp2);
+            _mm256_storeu_pd(dst + i, dst_tmp);
+            _mm256_storeu_pd(dst + i + AVX_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src1[i] < src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void threshold256_gt_d(double *src, double *dst, int len, double value)
+{
+    const v4sd pval = _mm256_set1_pd(value);
+
+    int stop_len = len / (2 * AVX_LEN_DOUBLE);
+    stop_len *= (2 * AVX_LEN_DOUBLE);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd src_tmp = _mm256_load_pd(src + i);
+            v4sd src_tmp2 = _mm256_load_pd(src + i + AVX_LEN_DOUBLE);
+            v4sd dst_tmp = _mm256_min_pd(src_tmp, pval);
+            v4sd dst_tmp2 = _mm256_min_pd(src_tmp2, pval);
+            _mm256_store_pd(dst + i, dst_tmp);
+            _mm256_store_pd(dst + i + AVX_LEN_DOUBLE, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd src_tmp = _mm256_loadu_pd(src + i);
+            v4sd src_tmp2 = _mm256_loadu_pd(src + i + AVX_LEN_DOUBLE);
+            v4sd dst_tmp = _mm256_min_pd(src_tmp, pval);
+            v4sd dst_tmp2 = _mm256_min_pd(src_tmp2, pval);
+            _mm256_storeu_pd(dst + i, dst_tmp);
+            _mm256_storeu_pd(dst + i + AVX_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src[i] < value ? src[i] : value;
+    }
+}
+
+SIMD_UTILS_API void threshold256_gtabs_d(double *src, double *dst, int len, double value)
+{
+    const v4sd pval = _mm256_set1_pd(value);
+
+    int stop_len = len / (2 * AVX_LEN_DOUBLE);
+    stop_len *= (2 * AVX_LEN_DOUBLE);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd src_tmp = _mm256_load_pd(src + i);
+            v4sd src_tmp2 = _mm256_load_pd(src + i + AVX_LEN_DOUBLE);
+            v4sd src_sign = _mm256_and_pd(src_tmp, *(v4sd *) _pd256_negative_mask);  // extract sign
+            v4sd src_abs = _mm256_and_pd(src_tmp, *(v4sd *) _pd256_positive_mask);   // take absolute value
+            v4sd dst_tmp = _mm256_xor_pd(_mm256_min_pd(src_abs, pval), src_sign);
+            v4sd src_sign2 = _mm256_and_pd(src_tmp2, *(v4sd *) _pd256_negative_mask);  // extract sign
+            v4sd src_abs2 = _mm256_and_pd(src_tmp2, *(v4sd *) _pd256_positive_mask);   // take absolute value
+            v4sd dst_tmp2 = _mm256_xor_pd(_mm256_min_pd(src_abs2, pval), src_sign2);
+            _mm256_store_pd(dst + i, dst_tmp);
+            _mm256_store_pd(dst + i + AVX_LEN_DOUBLE, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd src_tmp = _mm256_loadu_pd(src + i);
+            v4sd src_tmp2 = _mm256_loadu_pd(src + i + AVX_LEN_DOUBLE);
+            v4sd src_sign = _mm256_and_pd(src_tmp, *(v4sd *) _pd256_negative_mask);  // extract sign
+            v4sd src_abs = _mm256_and_pd(src_tmp, *(v4sd *) _pd256_positive_mask);   // take absolute value
+            v4sd dst_tmp = _mm256_xor_pd(_mm256_min_pd(src_abs, pval), src_sign);
+            v4sd src_sign2 = _mm256_and_pd(src_tmp2, *(v4sd *) _pd256_negative_mask);  // extract sign
+            v4sd src_abs2 = _mm256_and_pd(src_tmp2, *(v4sd *) _pd256_positive_mask);   // take absolute value
+            v4sd dst_tmp2 = _mm256_xor_pd(_mm256_min_pd(src_abs2, pval), src_sign2);
+            _mm256_storeu_pd(dst + i, dst_tmp);
+            _mm256_storeu_pd(dst + i + AVX_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        if (src[i] >= 0.0) {
+            dst[i] = src[i] > value ? value : src[i];
+        } else {
+            dst[i] = src[i] < (-value) ? (-value) : src[i];
+        }
+    }
+}
+
+SIMD_UTILS_API void threshold256_lt_d(double *src, double *dst, int len, double value)
+{
+    const v4sd pval = _mm256_set1_pd(value);
+
+    int stop_len = len / (2 * AVX_LEN_DOUBLE);
+    stop_len *= (2 * AVX_LEN_DOUBLE);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd src_tmp = _mm256_load_pd(src + i);
+            v4sd src_tmp2 = _mm256_load_pd(src + i + AVX_LEN_DOUBLE);
+            v4sd dst_tmp = _mm256_max_pd(src_tmp, pval);
+            v4sd dst_tmp2 = _mm256_max_pd(src_tmp2, pval);
+            _mm256_store_pd(dst + i, dst_tmp);
+            _mm256_store_pd(dst + i + AVX_LEN_DOUBLE, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd src_tmp = _mm256_loadu_pd(src + i);
+            v4sd src_tmp2 = _mm256_loadu_pd(src + i + AVX_LEN_DOUBLE);
+            v4sd dst_tmp = _mm256_max_pd(src_tmp, pval);
+            v4sd dst_tmp2 = _mm256_max_pd(src_tmp2, pval);
+            _mm256_storeu_pd(dst + i, dst_tmp);
+            _mm256_storeu_pd(dst + i + AVX_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src[i] > value ? src[i] : value;
+    }
+}
+
+SIMD_UTILS_API void threshold256_ltabs_d(double *src, double *dst, int len, double value)
+{
+    const v4sd pval = _mm256_set1_pd(value);
+
+    int stop_len = len / (2 * AVX_LEN_DOUBLE);
+    stop_len *= (2 * AVX_LEN_DOUBLE);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd src_tmp = _mm256_load_pd(src + i);
+            v4sd src_tmp2 = _mm256_load_pd(src + i + AVX_LEN_DOUBLE);
+            v4sd src_sign = _mm256_and_pd(src_tmp, *(v4sd *) _pd256_negative_mask);  // extract sign
+            v4sd src_abs = _mm256_and_pd(src_tmp, *(v4sd *) _pd256_positive_mask);   // take absolute value
+            v4sd dst_tmp = _mm256_xor_pd(_mm256_max_pd(src_abs, pval), src_sign);
+            v4sd src_sign2 = _mm256_and_pd(src_tmp2, *(v4sd *) _pd256_negative_mask);  // extract sign
+            v4sd src_abs2 = _mm256_and_pd(src_tmp2, *(v4sd *) _pd256_positive_mask);   // take absolute value
+            v4sd dst_tmp2 = _mm256_xor_pd(_mm256_max_pd(src_abs2, pval), src_sign2);
+            _mm256_store_pd(dst + i, dst_tmp);
+            _mm256_store_pd(dst + i + AVX_LEN_DOUBLE, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd src_tmp = _mm256_loadu_pd(src + i);
+            v4sd src_tmp2 = _mm256_loadu_pd(src + i + AVX_LEN_DOUBLE);
+            v4sd src_sign = _mm256_and_pd(src_tmp, *(v4sd *) _pd256_negative_mask);  // extract sign
+            v4sd src_abs = _mm256_and_pd(src_tmp, *(v4sd *) _pd256_positive_mask);   // take absolute value
+            v4sd dst_tmp = _mm256_xor_pd(_mm256_max_pd(src_abs, pval), src_sign);
+            v4sd src_sign2 = _mm256_and_pd(src_tmp2, *(v4sd *) _pd256_negative_mask);  // extract sign
+            v4sd src_abs2 = _mm256_and_pd(src_tmp2, *(v4sd *) _pd256_positive_mask);   // take absolute value
+            v4sd dst_tmp2 = _mm256_xor_pd(_mm256_max_pd(src_abs2, pval), src_sign2);
+            _mm256_storeu_pd(dst + i, dst_tmp);
+            _mm256_storeu_pd(dst + i + AVX_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        if (src[i] >= 0.0) {
+            dst[i] = src[i] < value ? value : src[i];
+        } else {
+            dst[i] = src[i] > (-value) ? (-value) : src[i];
+        }
+    }
+}
+
+SIMD_UTILS_API void threshold256_ltval_gtval_d(double *src, double *dst, int len, double ltlevel, double ltvalue, double gtlevel, double gtvalue)
+{
+    const v4sd ltlevel_v = _mm256_set1_pd(ltlevel);
+    const v4sd ltvalue_v = _mm256_set1_pd(ltvalue);
+    const v4sd gtlevel_v = _mm256_set1_pd(gtlevel);
+    const v4sd gtvalue_v = _mm256_set1_pd(gtvalue);
+
+    int stop_len = len / (2 * AVX_LEN_DOUBLE);
+    stop_len *= (2 * AVX_LEN_DOUBLE);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd src_tmp = _mm256_load_pd(src + i);
+            v4sd src_tmp2 = _mm256_load_pd(src + i + AVX_LEN_DOUBLE);
+            v4sd lt_mask = _mm256_cmp_pd(src_tmp, ltlevel_v, _CMP_LT_OS);
+            v4sd gt_mask = _mm256_cmp_pd(src_tmp, gtlevel_v, _CMP_GT_OS);
+            v4sd dst_tmp = _mm256_blendv_pd(src_tmp, ltvalue_v, lt_mask);
+            dst_tmp = _mm256_blendv_pd(dst_tmp, gtvalue_v, gt_mask);
+            v4sd lt_mask2 = _mm256_cmp_pd(src_tmp2, ltlevel_v, _CMP_LT_OS);
+            v4sd gt_mask2 = _mm256_cmp_pd(src_tmp2, gtlevel_v, _CMP_GT_OS);
+            v4sd dst_tmp2 = _mm256_blendv_pd(src_tmp2, ltvalue_v, lt_mask2);
+            dst_tmp2 = _mm256_blendv_pd(dst_tmp2, gtvalue_v, gt_mask2);
+            _mm256_store_pd(dst + i, dst_tmp);
+            _mm256_store_pd(dst + i + AVX_LEN_DOUBLE, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd src_tmp = _mm256_loadu_pd(src + i);
+            v4sd src_tmp2 = _mm256_loadu_pd(src + i + AVX_LEN_DOUBLE);
+            v4sd lt_mask = _mm256_cmp_pd(src_tmp, ltlevel_v, _CMP_LT_OS);
+            v4sd gt_mask = _mm256_cmp_pd(src_tmp, gtlevel_v, _CMP_GT_OS);
+            v4sd dst_tmp = _mm256_blendv_pd(src_tmp, ltvalue_v, lt_mask);
+            dst_tmp = _mm256_blendv_pd(dst_tmp, gtvalue_v, gt_mask);
+            v4sd lt_mask2 = _mm256_cmp_pd(src_tmp2, ltlevel_v, _CMP_LT_OS);
+            v4sd gt_mask2 = _mm256_cmp_pd(src_tmp2, gtlevel_v, _CMP_GT_OS);
+            v4sd dst_tmp2 = _mm256_blendv_pd(src_tmp2, ltvalue_v, lt_mask2);
+            dst_tmp2 = _mm256_blendv_pd(dst_tmp2, gtvalue_v, gt_mask2);
+            _mm256_storeu_pd(dst + i, dst_tmp);
+            _mm256_storeu_pd(dst + i + AVX_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        double tmp = src[i];
+        dst[i] = tmp < ltlevel ? ltvalue : tmp;
+        dst[i] = tmp > gtlevel ? gtvalue : dst[i];
+    }
+}
+
+SIMD_UTILS_API void sum256d(double *src, double *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_DOUBLE);
+    stop_len *= (2 * AVX_LEN_DOUBLE);
+
+    __attribute__((aligned(AVX_LEN_BYTES))) double accumulate[AVX_LEN_DOUBLE];
+    double tmp_acc = 0.0;
+    v4sd vec_acc1 = _mm256_setzero_pd();  // initialize the vector accumulator
+    v4sd vec_acc2 = _mm256_setzero_pd();  // initialize the vector accumulator
+
+    if (isAligned((uintptr_t) (src), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd vec_tmp1 = _mm256_load_pd(src + i);
+            vec_acc1 = _mm256_add_pd(vec_acc1, vec_tmp1);
+            v4sd vec_tmp2 = _mm256_load_pd(src + i + AVX_LEN_DOUBLE);
+            vec_acc2 = _mm256_add_pd(vec_acc2, vec_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd vec_tmp1 = _mm256_loadu_pd(src + i);
+            vec_acc1 = _mm256_add_pd(vec_acc1, vec_tmp1);
+            v4sd vec_tmp2 = _mm256_loadu_pd(src + i + AVX_LEN_DOUBLE);
+            vec_acc2 = _mm256_add_pd(vec_acc2, vec_tmp2);
+        }
+    }
+
+    vec_acc1 = _mm256_add_pd(vec_acc1, vec_acc2);
+    _mm256_store_pd(accumulate, vec_acc1);
+
+    for (int i = stop_len; i < len; i++) {
+        tmp_acc += src[i];
+    }
+
+    for (int i = 0; i < AVX_LEN_DOUBLE; i++) {
+        tmp_acc += accumulate[i];
+    }
+    *dst = tmp_acc;
+}
+
+SIMD_UTILS_API void mean256d(double *src, double *dst, int len)
+{
+    double coeff = 1.0 / ((double) len);
+    sum256d(src, dst, len);
+    *dst *= coeff;
+}
+
+SIMD_UTILS_API void dot256d(double *src1, double *src2, int len, double *dst)
+{
+    int stop_len = len / (2 * AVX_LEN_DOUBLE);
+    stop_len *= (2 * AVX_LEN_DOUBLE);
+
+    __attribute__((aligned(AVX_LEN_BYTES))) double accumulate[AVX_LEN_DOUBLE];
+    double tmp_acc = 0.0;
+    v4sd vec_acc1 = _mm256_setzero_pd();  // initialize the vector accumulator
+    v4sd vec_acc2 = _mm256_setzero_pd();  // initialize the vector accumulator
+
+    if (areAligned2((uintptr_t) (src1), (uintptr_t) (src2), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd vec_src1_tmp = _mm256_load_pd(src1 + i);
+            v4sd vec_src1_tmp2 = _mm256_load_pd(src1 + i + AVX_LEN_DOUBLE);
+            v4sd vec_src2_tmp = _mm256_load_pd(src2 + i);
+            v4sd vec_src2_tmp2 = _mm256_load_pd(src2 + i + AVX_LEN_DOUBLE);
+            vec_acc1 = _mm256_fmadd_pd_custom(vec_src1_tmp, vec_src2_tmp, vec_acc1);
+            vec_acc2 = _mm256_fmadd_pd_custom(vec_src1_tmp2, vec_src2_tmp2, vec_acc2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd vec_src1_tmp = _mm256_loadu_pd(src1 + i);
+            v4sd vec_src1_tmp2 = _mm256_loadu_pd(src1 + i + AVX_LEN_DOUBLE);
+            v4sd vec_src2_tmp = _mm256_loadu_pd(src2 + i);
+            v4sd vec_src2_tmp2 = _mm256_loadu_pd(src2 + i + AVX_LEN_DOUBLE);
+            vec_acc1 = _mm256_fmadd_pd_custom(vec_src1_tmp, vec_src2_tmp, vec_acc1);
+            vec_acc2 = _mm256_fmadd_pd_custom(vec_src1_tmp2, vec_src2_tmp2, vec_acc2);
+        }
+    }
+
+    vec_acc1 = _mm256_add_pd(vec_acc1, vec_acc2);
+    _mm256_store_pd(accumulate, vec_acc1);
+
+    for (int i = stop_len; i < len; i++) {
+        tmp_acc += src1[i] * src2[i];
+    }
+
+    for (int i = 0; i < AVX_LEN_DOUBLE; i++) {
+        tmp_acc += accumulate[i];
+    }
+    *dst = tmp_acc;
+}
+
+SIMD_UTILS_API void dotc256d(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst)
+{
+    int stop_len = len / (4 * AVX_LEN_DOUBLE);
+    stop_len *= (4 * AVX_LEN_DOUBLE);
+
+    v4sdx2 vec_acc1 = {{_mm256_setzero_pd(), _mm256_setzero_pd()}};  // initialize the vector accumulator
+    v4sdx2 vec_acc2 = {{_mm256_setzero_pd(), _mm256_setzero_pd()}};  // initialize the vector accumulator
+
+    complex64_t dst_tmp = {0.0, 0.0};
+    __attribute__((aligned(AVX_LEN_BYTES))) double accumulateRe[AVX_LEN_DOUBLE];
+    __attribute__((aligned(AVX_LEN_BYTES))) double accumulateIm[AVX_LEN_DOUBLE];
+
+    //  (ac -bd) + i(ad + bc)
+    if (areAligned2((uintptr_t) (src1), (uintptr_t) (src2), AVX_LEN_BYTES)) {
+        for (int i = 0; i < 2 * stop_len; i += 4 * AVX_LEN_DOUBLE) {
+            v4sdx2 src1_split = _mm256_load2_pd((double *) (src1) + i);  // a0a1, b0b1
+            v4sdx2 src2_split = _mm256_load2_pd((double *) (src2) + i);  // c0c1, d0d1
+            v4sdx2 src1_split2 = _mm256_load2_pd((double *) (src1) + i + 2 * AVX_LEN_DOUBLE);
+            v4sdx2 src2_split2 = _mm256_load2_pd((double *) (src2) + i + 2 * AVX_LEN_DOUBLE);
+            v4sd ac = _mm256_mul_pd(src1_split.val[0], src2_split.val[0]);     // ac
+            v4sd ad = _mm256_mul_pd(src1_split.val[0], src2_split.val[1]);     // ad
+            v4sd ac2 = _mm256_mul_pd(src1_split2.val[0], src2_split2.val[0]);  // ac
+            v4sd ad2 = _mm256_mul_pd(src1_split2.val[0], src2_split2.val[1]);  // ad
+            vec_acc1.val[0] = _mm256_add_pd(vec_acc1.val[0], _mm256_fnmadd_pd_custom(src1_split.val[1], src2_split.val[1], ac));
+            vec_acc1.val[1] = _mm256_add_pd(vec_acc1.val[1], _mm256_fmadd_pd_custom(src1_split.val[1], src2_split.val[0], ad));
+            vec_acc2.val[0] = _mm256_add_pd(vec_acc2.val[0], _mm256_fnmadd_pd_custom(src1_split2.val[1], src2_split2.val[1], ac2));
+            vec_acc2.val[1] = _mm256_add_pd(vec_acc2.val[1], _mm256_fmadd_pd_custom(src1_split2.val[1], src2_split2.val[0], ad2));
+        }
+    } else {
+        for (int i = 0; i < 2 * stop_len; i += 4 * AVX_LEN_DOUBLE) {
+            v4sdx2 src1_split = _mm256_load2u_pd((double *) (src1) + i);  // a0a1, b0b1
+            v4sdx2 src2_split = _mm256_load2u_pd((double *) (src2) + i);  // c0c1, d0d1
+            v4sdx2 src1_split2 = _mm256_load2u_pd((double *) (src1) + i + 2 * AVX_LEN_DOUBLE);
+            v4sdx2 src2_split2 = _mm256_load2u_pd((double *) (src2) + i + 2 * AVX_LEN_DOUBLE);
+            v4sd ac = _mm256_mul_pd(src1_split.val[0], src2_split.val[0]);     // ac
+            v4sd ad = _mm256_mul_pd(src1_split.val[0], src2_split.val[1]);     // ad
+            v4sd ac2 = _mm256_mul_pd(src1_split2.val[0], src2_split2.val[0]);  // ac
+            v4sd ad2 = _mm256_mul_pd(src1_split2.val[0], src2_split2.val[1]);  // ad
+            vec_acc1.val[0] = _mm256_add_pd(vec_acc1.val[0], _mm256_fnmadd_pd_custom(src1_split.val[1], src2_split.val[1], ac));
+            vec_acc1.val[1] = _mm256_add_pd(vec_acc1.val[1], _mm256_fmadd_pd_custom(src1_split.val[1], src2_split.val[0], ad));
+            vec_acc2.val[0] = _mm256_add_pd(vec_acc2.val[0], _mm256_fnmadd_pd_custom(src1_split2.val[1], src2_split2.val[1], ac2));
+            vec_acc2.val[1] = _mm256_add_pd(vec_acc2.val[1], _mm256_fmadd_pd_custom(src1_split2.val[1], src2_split2.val[0], ad2));
+        }
+    }
+
+    vec_acc1.val[0] = _mm256_add_pd(vec_acc1.val[0], vec_acc2.val[0]);
+    vec_acc1.val[1] = _mm256_add_pd(vec_acc1.val[1], vec_acc2.val[1]);
+    _mm256_store_pd(accumulateRe, vec_acc1.val[0]);
+    _mm256_store_pd(accumulateIm, vec_acc1.val[1]);
+
+    for (int i = stop_len; i < len; i++) {
+        dst_tmp.re += src1[i].re * src2[i].re - (src1[i].im * src2[i].im);
+        dst_tmp.im += src1[i].re * src2[i].im + (src2[i].re * src1[i].im);
+    }
+
+    for (int i = 0; i < AVX_LEN_DOUBLE; i++) {
+        dst_tmp.re += accumulateRe[i];
+        dst_tmp.im += accumulateIm[i];
+    }
+    dst->re = dst_tmp.re;
+    dst->im = dst_tmp.im;
+}
+
+// *acc + *cor += value, *cor gathers the rounding errors of the additions (TwoSum, see simd_utils_sum.h)
+static inline void kahan_add256d(v4sd *acc, v4sd *cor, v4sd value)
+{
+    v4sd t = _mm256_add_pd(*acc, value);
+    v4sd bp = _mm256_sub_pd(t, *acc);
+    v4sd err = _mm256_add_pd(_mm256_sub_pd(*acc, _mm256_sub_pd(t, bp)), _mm256_sub_pd(value, bp));
+    *cor = _mm256_add_pd(*cor, err);
+    *acc = t;
+}
+
+SIMD_UTILS_API void sumkahan256d(double *src, double *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_DOUBLE);
+    stop_len *= (2 * AVX_LEN_DOUBLE);
+
+    __attribute__((aligned(AVX_LEN_BYTES))) double accumulate[2 * AVX_LEN_DOUBLE];
+    __attribute__((aligned(AVX_LEN_BYTES))) double correction[2 * AVX_LEN_DOUBLE];
+    double tmp_acc = 0.0;
+    double tmp_cor = 0.0;
+    v4sd vec_acc1 = _mm256_setzero_pd();  // initialize the vector accumulator
+    v4sd vec_acc2 = _mm256_setzero_pd();  // initialize the vector accumulator
+    v4sd vec_cor1 = _mm256_setzero_pd();  // rounding errors of the accumulator
+    v4sd vec_cor2 = _mm256_setzero_pd();  // rounding errors of the accumulator
+
+    if (isAligned((uintptr_t) (src), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            kahan_add256d(&vec_acc1, &vec_cor1, _mm256_load_pd(src + i));
+            kahan_add256d(&vec_acc2, &vec_cor2, _mm256_load_pd(src + i + AVX_LEN_DOUBLE));
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            kahan_add256d(&vec_acc1, &vec_cor1, _mm256_loadu_pd(src + i));
+            kahan_add256d(&vec_acc2, &vec_cor2, _mm256_loadu_pd(src + i + AVX_LEN_DOUBLE));
+        }
+    }
+
+    _mm256_store_pd(accumulate, vec_acc1);
+    _mm256_store_pd(accumulate + AVX_LEN_DOUBLE, vec_acc2);
+    _mm256_store_pd(correction, vec_cor1);
+    _mm256_store_pd(correction + AVX_LEN_DOUBLE, vec_cor2);
+    kahan_foldd(accumulate, correction, 2 * AVX_LEN_DOUBLE, &tmp_acc, &tmp_cor);
+
+    for (int i = stop_len; i < len; i++) {
+        kahan_addd(&tmp_acc, &tmp_cor, src[i]);
+    }
+
+    *dst = tmp_acc + tmp_cor;
+}
+
+SIMD_UTILS_API void meankahan256d(double *src, double *dst, int len)
+{
+    double coeff = 1.0 / ((double) len);
+    sumkahan256d(src, dst, len);
+    *dst *= coeff;
+}
+
+/* The rounding errors of the products are prod - src1 * src2 computed with a FMA,
+ * they are 0 without FMA (only the additions are compensated) */
+SIMD_UTILS_API void dotkahan256d(double *src1, double *src2, int len, double *dst)
+{
+    int stop_len = len / (2 * AVX_LEN_DOUBLE);
+    stop_len *= (2 * AVX_LEN_DOUBLE);
+
+    __attribute__((aligned(AVX_LEN_BYTES))) double accumulate[2 * AVX_LEN_DOUBLE];
+    __attribute__((aligned(AVX_LEN_BYTES))) double correction[2 * AVX_LEN_DOUBLE];
+    double tmp_acc = 0.0;
+    double tmp_cor = 0.0;
+    v4sd vec_acc1 = _mm256_setzero_pd();  // initialize the vector accumulator
+    v4sd vec_acc2 = _mm256_setzero_pd();  // initialize the vector accumulator
+    v4sd vec_cor1 = _mm256_setzero_pd();  // rounding errors of the accumulator
+    v4sd vec_cor2 = _mm256_setzero_pd();  // rounding errors of the accumulator
+
+    if (areAligned2((uintptr_t) (src1), (uintptr_t) (src2), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd vec_src1_tmp = _mm256_load_pd(src1 + i);
+            v4sd vec_src1_tmp2 = _mm256_load_pd(src1 + i + AVX_LEN_DOUBLE);
+            v4sd vec_src2_tmp = _mm256_load_pd(src2 + i);
+            v4sd vec_src2_tmp2 = _mm256_load_pd(src2 + i + AVX_LEN_DOUBLE);
+            v4sd prod = _mm256_mul_pd(vec_src1_tmp, vec_src2_tmp);
+            v4sd prod2 = _mm256_mul_pd(vec_src1_tmp2, vec_src2_tmp2);
+            kahan_add256d(&vec_acc1, &vec_cor1, prod);
+            kahan_add256d(&vec_acc2, &vec_cor2, prod2);
+            vec_cor1 = _mm256_sub_pd(vec_cor1, _mm256_fnmadd_pd_custom(vec_src1_tmp, vec_src2_tmp, prod));
+            vec_cor2 = _mm256_sub_pd(vec_cor2, _mm256_fnmadd_pd_custom(vec_src1_tmp2, vec_src2_tmp2, prod2));
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd vec_src1_tmp = _mm256_loadu_pd(src1 + i);
+            v4sd vec_src1_tmp2 = _mm256_loadu_pd(src1 + i + AVX_LEN_DOUBLE);
+            v4sd vec_src2_tmp = _mm256_loadu_pd(src2 + i);
+            v4sd vec_src2_tmp2 = _mm256_loadu_pd(src2 + i + AVX_LEN_DOUBLE);
+            v4sd prod = _mm256_mul_pd(vec_src1_tmp, vec_src2_tmp);
+            v4sd prod2 = _mm256_mul_pd(vec_src1_tmp2, vec_src2_tmp2);
+            kahan_add256d(&vec_acc1, &vec_cor1, prod);
+            kahan_add256d(&vec_acc2, &vec_cor2, prod2);
+            vec_cor1 = _mm256_sub_pd(vec_cor1, _mm256_fnmadd_pd_custom(vec_src1_tmp, vec_src2_tmp, prod));
+            vec_cor2 = _mm256_sub_pd(vec_cor2, _mm256_fnmadd_pd_custom(vec_src1_tmp2, vec_src2_tmp2, prod2));
+        }
+    }
+
+    _mm256_store_pd(accumulate, vec_acc1);
+    _mm256_store_pd(accumulate + AVX_LEN_DOUBLE, vec_acc2);
+    _mm256_store_pd(correction, vec_cor1);
+    _mm256_store_pd(correction + AVX_LEN_DOUBLE, vec_cor2);
+    kahan_foldd(accumulate, correction, 2 * AVX_LEN_DOUBLE, &tmp_acc, &tmp_cor);
+
+    for (int i = stop_len; i < len; i++) {
+        kahan_addd(&tmp_acc, &tmp_cor, src1[i] * src2[i]);
+    }
+
+    *dst = tmp_acc + tmp_cor;
+}
+
+SIMD_UTILS_API void dotckahan256d(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst)
+{
+    int stop_len = len / (4 * AVX_LEN_DOUBLE);
+    stop_len *= (4 * AVX_LEN_DOUBLE);
+
+    __attribute__((aligned(AVX_LEN_BYTES))) double accumulateRe[2 * AVX_LEN_DOUBLE];
+    __attribute__((aligned(AVX_LEN_BYTES))) double accumulateIm[2 * AVX_LEN_DOUBLE];
+    __attribute__((aligned(AVX_LEN_BYTES))) double correctionRe[2 * AVX_LEN_DOUBLE];
+    __attribute__((aligned(AVX_LEN_BYTES))) double correctionIm[2 * AVX_LEN_DOUBLE];
+    complex64_t dst_tmp = {0.0, 0.0};
+    complex64_t dst_cor = {0.0, 0.0};
+    v4sdx2 vec_acc1 = {{_mm256_setzero_pd(), _mm256_setzero_pd()}};  // initialize the vector accumulator
+    v4sdx2 vec_acc2 = {{_mm256_setzero_pd(), _mm256_setzero_pd()}};  // initialize the vector accumulator
+    v4sdx2 vec_cor1 = {{_mm256_setzero_pd(), _mm256_setzero_pd()}};  // rounding errors of the accumulator
+    v4sdx2 vec_cor2 = {{_mm256_setzero_pd(), _mm256_setzero_pd()}};  // rounding errors of the accumulator
+
+    //  (ac -bd) + i(ad + bc)
+    if (areAligned2((uintptr_t) (src1), (uintptr_t) (src2), AVX_LEN_BYTES)) {
+        for (int i = 0; i < 2 * stop_len; i += 4 * AVX_LEN_DOUBLE) {
+            v4sdx2 src1_split = _mm256_load2_pd((double *) (src1) + i);  // a0a1, b0b1
+            v4sdx2 src2_split = _mm256_load2_pd((double *) (src2) + i);  // c0c1, d0d1
+            v4sdx2 src1_split2 = _mm256_load2_pd((double *) (src1) + i + 2 * AVX_LEN_DOUBLE);
+            v4sdx2 src2_split2 = _mm256_load2_pd((double *) (src2) + i + 2 * AVX_LEN_DOUBLE);
+            v4sd ac = _mm256_mul_pd(src1_split.val[0], src2_split.val[0]);     // ac
+            v4sd ad = _mm256_mul_pd(src1_split.val[0], src2_split.val[1]);     // ad
+            v4sd ac2 = _mm256_mul_pd(src1_split2.val[0], src2_split2.val[0]);  // ac
+            v4sd ad2 = _mm256_mul_pd(src1_split2.val[0], src2_split2.val[1]);  // ad
+            kahan_add256d(&vec_acc1.val[0], &vec_cor1.val[0], _mm256_fnmadd_pd_custom(src1_split.val[1], src2_split.val[1], ac));
+            kahan_add256d(&vec_acc1.val[1], &vec_cor1.val[1], _mm256_fmadd_pd_custom(src1_split.val[1], src2_split.val[0], ad));
+            kahan_add256d(&vec_acc2.val[0], &vec_cor2.val[0], _mm256_fnmadd_pd_custom(src1_split2.val[1], src2_split2.val[1], ac2));
+            kahan_add256d(&vec_acc2.val[1], &vec_cor2.val[1], _mm256_fmadd_pd_custom(src1_split2.val[1], src2_split2.val[0], ad2));
+        }
+    } else {
+        for (int i = 0; i < 2 * stop_len; i += 4 * AVX_LEN_DOUBLE) {
+            v4sdx2 src1_split = _mm256_load2u_pd((double *) (src1) + i);  // a0a1, b0b1
+            v4sdx2 src2_split = _mm256_load2u_pd((double *) (src2) + i);  // c0c1, d0d1
+            v4sdx2 src1_split2 = _mm256_load2u_pd((double *) (src1) + i + 2 * AVX_LEN_DOUBLE);
+            v4sdx2 src2_split2 = _mm256_load2u_pd((double *) (src2) + i + 2 * AVX_LEN_DOUBLE);
+            v4sd ac = _mm256_mul_pd(src1_split.val[0], src2_split.val[0]);     // ac
+            v4sd ad = _mm256_mul_pd(src1_split.val[0], src2_split.val[1]);     // ad
+            v4sd ac2 = _mm256_mul_pd(src1_split2.val[0], src2_split2.val[0]);  // ac
+            v4sd ad2 = _mm256_mul_pd(src1_split2.val[0], src2_split2.val[1]);  // ad
+            kahan_add256d(&vec_acc1.val[0], &vec_cor1.val[0], _mm256_fnmadd_pd_custom(src1_split.val[1], src2_split.val[1], ac));
+            kahan_add256d(&vec_acc1.val[1], &vec_cor1.val[1], _mm256_fmadd_pd_custom(src1_split.val[1], src2_split.val[0], ad));
+            kahan_add256d(&vec_acc2.val[0], &vec_cor2.val[0], _mm256_fnmadd_pd_custom(src1_split2.val[1], src2_split2.val[1], ac2));
+            kahan_add256d(&vec_acc2.val[1], &vec_cor2.val[1], _mm256_fmadd_pd_custom(src1_split2.val[1], src2_split2.val[0], ad2));
+        }
+    }
+
+    _mm256_store_pd(accumulateRe, vec_acc1.val[0]);
+    _mm256_store_pd(accumulateRe + AVX_LEN_DOUBLE, vec_acc2.val[0]);
+    _mm256_store_pd(accumulateIm, vec_acc1.val[1]);
+    _mm256_store_pd(accumulateIm + AVX_LEN_DOUBLE, vec_acc2.val[1]);
+    _mm256_store_pd(correctionRe, vec_cor1.val[0]);
+    _mm256_store_pd(correctionRe + AVX_LEN_DOUBLE, vec_cor2.val[0]);
+    _mm256_store_pd(correctionIm, vec_cor1.val[1]);
+    _mm256_store_pd(correctionIm + AVX_LEN_DOUBLE, vec_cor2.val[1]);
+    kahan_foldd(accumulateRe, correctionRe, 2 * AVX_LEN_DOUBLE, &dst_tmp.re, &dst_cor.re);
+    kahan_foldd(accumulateIm, correctionIm, 2 * AVX_LEN_DOUBLE, &dst_tmp.im, &dst_cor.im);
+
+    for (int i = stop_len; i < len; i++) {
+        kahan_addd(&dst_tmp.re, &dst_cor.re, src1[i].re * src2[i].re - (src1[i].im * src2[i].im));
+        kahan_addd(&dst_tmp.im, &dst_cor.im, src1[i].re * src2[i].im + (src2[i].re * src1[i].im));
+    }
+
+    dst->re = dst_tmp.re + dst_cor.re;
+    dst->im = dst_tmp.im + dst_cor.im;
+}
+
+SIMD_UTILS_API void sumpairwise256d(double *src, double *dst, int len)
+{
+    *dst = sum_pairwised(src, len, sum256d);
+}
+
+SIMD_UTILS_API void meanpairwise256d(double *src, double *dst, int len)
+{
+    double coeff = 1.0 / ((double) len);
+    sumpairwise256d(src, dst, len);
+    *dst *= coeff;
+}
+
+SIMD_UTILS_API void dotpairwise256d(double *src1, double *src2, int len, double *dst)
+{
+    *dst = dot_pairwised(src1, src2, len, dot256d);
+}
+
+SIMD_UTILS_API void dotcpairwise256d(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst)
+{
+    *dst = dotc_pairwised(src1, src2, len, dotc256d);
+}
+
+// sums of the powers of (src[i] - shift), see simd_utils_moments.h
+static inline void centered_sums256d(double *src, int len, double shift, double *sums)
+{
+    int stop_len = len / (2 * AVX_LEN_DOUBLE);
+    stop_len *= (2 * AVX_LEN_DOUBLE);
+
+    __attribute__((aligned(AVX_LEN_BYTES))) double accumulate[4 * AVX_LEN_DOUBLE];
+    v4sd shift_vec = _mm256_set1_pd(shift);
+    v4sd sum1_1 = _mm256_setzero_pd(), sum1_2 = _mm256_setzero_pd();  // d
+    v4sd sum2_1 = _mm256_setzero_pd(), sum2_2 = _mm256_setzero_pd();  // d^2
+    v4sd sum3_1 = _mm256_setzero_pd(), sum3_2 = _mm256_setzero_pd();  // d^3
+    v4sd sum4_1 = _mm256_setzero_pd(), sum4_2 = _mm256_setzero_pd();  // d^4
+
+    if (isAligned((uintptr_t) (src), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd d1 = _mm256_sub_pd(_mm256_load_pd(src + i), shift_vec);
+            v4sd d2 = _mm256_sub_pd(_mm256_load_pd(src + i + AVX_LEN_DOUBLE), shift_vec);
+            v4sd sq1 = _mm256_mul_pd(d1, d1);
+            v4sd sq2 = _mm256_mul_pd(d2, d2);
+            sum1_1 = _mm256_add_pd(sum1_1, d1);
+            sum1_2 = _mm256_add_pd(sum1_2, d2);
+            sum2_1 = _mm256_add_pd(sum2_1, sq1);
+            sum2_2 = _mm256_add_pd(sum2_2, sq2);
+            sum3_1 = _mm256_fmadd_pd_custom(sq1, d1, sum3_1);
+            sum3_2 = _mm256_fmadd_pd_custom(sq2, d2, sum3_2);
+            sum4_1 = _mm256_fmadd_pd_custom(sq1, sq1, sum4_1);
+            sum4_2 = _mm256_fmadd_pd_custom(sq2, sq2, sum4_2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+            v4sd d1 = _mm256_sub_pd(_mm256_loadu_pd(src + i), shift_vec);
+            v4sd d2 = _mm256_sub_pd(_mm256_loadu_pd(src + i + AVX_LEN_DOUBLE), shift_vec);
+            v4sd sq1 = _mm256_mul_pd(d1, d1);
+            v4sd sq2 = _mm256_mul_pd(d2, d2);
+            sum1_1 = _mm256_add_pd(sum1_1, d1);
+            sum1_2 = _mm256_add_pd(sum1_2, d2);
+            sum2_1 = _mm256_add_pd(sum2_1, sq1);
+            sum2_2 = _mm256_add_pd(sum2_2, sq2);
+            sum3_1 = _mm256_fmadd_pd_custom(sq1, d1, sum3_1);
+            sum3_2 = _mm256_fmadd_pd_custom(sq2, d2, sum3_2);
+            sum4_1 = _mm256_fmadd_pd_custom(sq1, sq1, sum4_1);
+            sum4_2 = _mm256_fmadd_pd_custom(sq2, sq2, sum4_2);
+        }
+    }
+
+    _mm256_store_pd(accumulate, _mm256_add_pd(sum1_1, sum1_2));
+    _mm256_store_pd(accumulate + AVX_LEN_DOUBLE, _mm256_add_pd(sum2_1, sum2_2));
+    _mm256_store_pd(accumulate + 2 * AVX_LEN_DOUBLE, _mm256_add_pd(sum3_1, sum3_2));
+    _mm256_store_pd(accumulate + 3 * AVX_LEN_DOUBLE, _mm256_add_pd(sum4_1, sum4_2));
+
+    for (int k = 0; k < 4; k++) {
+        sums[k] = 0.0;
+        for (int i = 0; i < AVX_LEN_DOUBLE; i++) {
+            sums[k] += (double) accumulate[k * AVX_LEN_DOUBLE + i];
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        double d = (double) (src[i] - shift);
+        double sq = d * d;
+        sums[0] += d;
+        sums[1] += sq;
+        sums[2] += sq * d;
+        sums[3] += sq * sq;
+    }
+}
+
+SIMD_UTILS_API void moments256d(double *src, int len, moments_t *m)
+{
+    moments_rund(src, len, sum256d, centered_sums256d, m);
+}
+
+// inclusive prefix sum of the lanes of x, within the 128 bits lanes then across them
+static inline v4sd prefix_lanes256d(v4sd x)
+{
+    v4sd tmp = _mm256_permute_pd(x, 0x0);
+    x = _mm256_add_pd(x, _mm256_blend_pd(tmp, _mm256_setzero_pd(), 0x5));
+    tmp = _mm256_permute_pd(x, 0xF);
+    return _mm256_add_pd(x, _mm256_permute2f128_pd(tmp, tmp, 0x08));
+}
+
+// last lane of x in all the lanes
+static inline v4sd last_lane256d(v4sd x)
+{
+    v4sd tmp = _mm256_permute_pd(x, 0xF);
+    return _mm256_permute2f128_pd(tmp, tmp, 0x11);
+}
+
+// lanes of x moved up by one, the first lane getting the last lane of prev
+static inline v4sd shift_lane256d(v4sd x, v4sd prev)
+{
+    v4sd rot = _mm256_permute_pd(x, 0x5);
+    v4sd rot_prev = _mm256_permute_pd(prev, 0x5);
+    return _mm256_blend_pd(rot, _mm256_permute2f128_pd(rot, rot_prev, 0x03), 0x5);
+}
+
+// prefix sums of src (see simd_utils.h), exclusive when exclusive is set
+static inline void prefixsum256d_run(double *src, double *dst, int len, double *carry, int exclusive)
+{
+    int stop_len = len / (2 * AVX_LEN_DOUBLE);
+    stop_len *= (2 * AVX_LEN_DOUBLE);
+
+    v4sd carry_vec = _mm256_set1_pd(carry ? *carry : 0.0);
+
+    // the carry only waits for one add per pair of vectors
+    for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+        v4sd a = prefix_lanes256d(_mm256_loadu_pd(src + i));
+        v4sd b = prefix_lanes256d(_mm256_loadu_pd(src + i + AVX_LEN_DOUBLE));
+        b = _mm256_add_pd(b, last_lane256d(a));
+        v4sd last = last_lane256d(b);
+        a = _mm256_add_pd(a, carry_vec);
+        b = _mm256_add_pd(b, carry_vec);
+        if (exclusive) {
+            _mm256_storeu_pd(dst + i, shift_lane256d(a, carry_vec));
+            _mm256_storeu_pd(dst + i + AVX_LEN_DOUBLE, shift_lane256d(b, a));
+        } else {
+            _mm256_storeu_pd(dst + i, a);
+            _mm256_storeu_pd(dst + i + AVX_LEN_DOUBLE, b);
+        }
+        carry_vec = _mm256_add_pd(carry_vec, last);
+    }
+
+    double carry_tmp = _mm_cvtsd_f64(_mm256_castpd256_pd128(carry_vec));
+    for (int i = stop_len; i < len; i++) {
+        double x = src[i];
+        if (exclusive) {
+            dst[i] = carry_tmp;
+            carry_tmp = carry_tmp + x;
+        } else {
+            carry_tmp = carry_tmp + x;
+            dst[i] = carry_tmp;
+        }
+    }
+
+    if (carry)
+        *carry = carry_tmp;
+}
+
+SIMD_UTILS_API void prefixsum256d(double *src, double *dst, int len, double *carry)
+{
+    prefixsum256d_run(src, dst, len, carry, 0);
+}
+
+SIMD_UTILS_API void prefixsum256d_excl(double *src, double *dst, int len, double *carry)
+{
+    prefixsum256d_run(src, dst, len, carry, 1);
+}
+
+SIMD_UTILS_API void diff256d(double *src, double *dst, int len, double *prev)
+{
+    int stop_len = len / (2 * AVX_LEN_DOUBLE);
+    stop_len *= (2 * AVX_LEN_DOUBLE);
+
+    double prev_tmp = prev ? *prev : 0.0;
+    double last = (len > 0) ? src[len - 1] : prev_tmp;  // before src is overwritten by dst
+    v4sd prev_vec = _mm256_set1_pd(prev_tmp);
+
+    for (int i = 0; i < stop_len; i += 2 * AVX_LEN_DOUBLE) {
+        v4sd a = _mm256_loadu_pd(src + i);
+        v4sd b = _mm256_loadu_pd(src + i + AVX_LEN_DOUBLE);
+        _mm256_storeu_pd(dst + i, _mm256_sub_pd(a, shift_lane256d(a, prev_vec)));
+        _mm256_storeu_pd(dst + i + AVX_LEN_DOUBLE, _mm256_sub_pd(b, shift_lane256d(b, a)));
+        prev_vec = b;
+    }
+
+    if (stop_len > 0)
+        prev_tmp = _mm_cvtsd_f64(_mm256_castpd256_pd128(last_lane256d(prev_vec)));
+    for (int i = stop_len; i < len; i++) {
+        double x = src[i];
+        dst[i] = x - prev_tmp;
+        prev_tmp = x;
+    }
+
+    if (prev)
+        *prev = last;
+}
+
+#ifdef __AVX2__
+// bitonic sort of the lanes of x
+static inline v4sd sort_lanes256d(v4sd x)
+{
+    v4sd p;
+    p = _mm256_permute_pd(x, 0x5);
+    x = _mm256_blend_pd(_mm256_min_pd(x, p), _mm256_max_pd(x, p), 0x6);
+    p = _mm256_permute2f128_pd(x, x, 0x01);
+    x = _mm256_blend_pd(_mm256_min_pd(x, p), _mm256_max_pd(x, p), 0xC);
+    p = _mm256_permute_pd(x, 0x5);
+    x = _mm256_blend_pd(_mm256_min_pd(x, p), _mm256_max_pd(x, p), 0xA);
+    return x;
+}
+
+// sorts the lanes of x, which are a bitonic sequence
+static inline v4sd sort_clean256d(v4sd x)
+{
+    v4sd p;
+    p = _mm256_permute2f128_pd(x, x, 0x01);
+    x = _mm256_blend_pd(_mm256_min_pd(x, p), _mm256_max_pd(x, p), 0xC);
+    p = _mm256_permute_pd(x, 0x5);
+    x = _mm256_blend_pd(_mm256_min_pd(x, p), _mm256_max_pd(x, p), 0xA);
+    return x;
+}
+
+// merges the sorted vectors a and b, a getting the lowest half
+static inline void sort_merge2256d(v4sd *a, v4sd *b)
+{
+    v4sd rev = _mm256_permute4x64_pd(*b, _MM_SHUFFLE(0, 1, 2, 3));
+    v4sd low = _mm256_min_pd(*a, rev);
+    v4sd high = _mm256_max_pd(*a, rev);
+    *a = sort_clean256d(low);
+    *b = sort_clean256d(high);
+}
+
+// merges the sorted sequences (a, b) and (c, d)
+static inline void sort_merge4256d(v4sd *a, v4sd *b, v4sd *c, v4sd *d)
+{
+    v4sd rev_c = _mm256_permute4x64_pd(*d, _MM_SHUFFLE(0, 1, 2, 3));
+    v4sd rev_d = _mm256_permute4x64_pd(*c, _MM_SHUFFLE(0, 1, 2, 3));
+    v4sd low0 = _mm256_min_pd(*a, rev_c);
+    v4sd high0 = _mm256_max_pd(*a, rev_c);
+    v4sd low1 = _mm256_min_pd(*b, rev_d);
+    v4sd high1 = _mm256_max_pd(*b, rev_d);
+    *a = sort_clean256d(_mm256_min_pd(low0, low1));
+    *b = sort_clean256d(_mm256_max_pd(low0, low1));
+    *c = sort_clean256d(_mm256_min_pd(high0, high1));
+    *d = sort_clean256d(_mm256_max_pd(high0, high1));
+}
+
+// sorts up to 4 vectors, padded with the largest value
+static inline void sort_small256d(double *src, int len)
+{
+    double tmp[4 * AVX_LEN_DOUBLE] __attribute__((aligned(AVX_LEN_BYTES)));
+
+    memcpy(tmp, src, len * sizeof(double));
+    for (int i = len; i < 4 * AVX_LEN_DOUBLE; i++) {
+        tmp[i] = INFINITY;
+    }
+
+    v4sd a = sort_lanes256d(_mm256_loadu_pd(tmp));
+    if (len <= AVX_LEN_DOUBLE) {
+        _mm256_storeu_pd(tmp, a);
+    } else if (len <= 2 * AVX_LEN_DOUBLE) {
+        v4sd b = sort_lanes256d(_mm256_loadu_pd(tmp + AVX_LEN_DOUBLE));
+        sort_merge2256d(&a, &b);
+        _mm256_storeu_pd(tmp, a);
+        _mm256_storeu_pd(tmp + AVX_LEN_DOUBLE, b);
+    } else {
+        v4sd b = sort_lanes256d(_mm256_loadu_pd(tmp + AVX_LEN_DOUBLE));
+        v4sd c = sort_lanes256d(_mm256_loadu_pd(tmp + 2 * AVX_LEN_DOUBLE));
+        v4sd d = sort_lanes256d(_mm256_loadu_pd(tmp + 3 * AVX_LEN_DOUBLE));
+        sort_merge2256d(&a, &b);
+        sort_merge2256d(&c, &d);
+        sort_merge4256d(&a, &b, &c, &d);
+        _mm256_storeu_pd(tmp, a);
+        _mm256_storeu_pd(tmp + AVX_LEN_DOUBLE, b);
+        _mm256_storeu_pd(tmp + 2 * AVX_LEN_DOUBLE, c);
+        _mm256_storeu_pd(tmp + 3 * AVX_LEN_DOUBLE, d);
+    }
+
+    memcpy(src, tmp, len * sizeof(double));
+}
+
+// packs the lanes of x lower than the pivot to [*left_w, ...) and the others to [..., *right_w)
+static inline void partition_store256d(double *src, v4sd x, v4sd pivot_vec, int *left_w, int *right_w)
+{
+    int mask = sort_double_mask(_mm256_movemask_pd(_mm256_cmp_pd(x, pivot_vec, _CMP_LT_OQ)));
+    int nb_low = __builtin_popcount(mask) / 2;
+    v8si idx = _mm256_srlv_epi32(_mm256_set1_epi32((int32_t) sort_perm8_lut[mask]), _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28));
+    v4sd packed = _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(x), idx));
+
+    // the full vector is stored on both ends (free space of a vector at least on each end)
+    _mm256_storeu_pd(src + *left_w, packed);
+    _mm256_storeu_pd(src + *right_w - AVX_LEN_DOUBLE, packed);
+    *left_w += nb_low;
+    *right_w -= AVX_LEN_DOUBLE - nb_low;
+}
+
+// number of elements lower than pivot, moved to the beginning of src (len >= 2 * AVX_LEN_DOUBLE)
+static inline int partition256d(double *src, int len, double pivot)
+{
+    v4sd pivot_vec = _mm256_set1_pd(pivot);
+    v4sd first = _mm256_loadu_pd(src);
+    v4sd last = _mm256_loadu_pd(src + len - AVX_LEN_DOUBLE);
+    int left = AVX_LEN_DOUBLE, right = len - 2 * AVX_LEN_DOUBLE;  // next vectors read from each end
+    int left_w = 0, right_w = len;             // free space [left_w, left) and [right + AVX_LEN_DOUBLE, right_w)
+
+    while (left <= right) {
+        v4sd x;
+        if ((left - left_w) <= (right_w - right - AVX_LEN_DOUBLE)) {
+            x = _mm256_loadu_pd(src + left);
+            left += AVX_LEN_DOUBLE;
+        } else {
+            x = _mm256_loadu_pd(src + right);
+            right -= AVX_LEN_DOUBLE;
+        }
+        partition_store256d(src, x, pivot_vec, &left_w, &right_w);
+    }
+
+    // the last elements (less than a vector) with the first and the last vectors
+    double tmp[3 * AVX_LEN_DOUBLE];
+    int nb_tmp = right + AVX_LEN_DOUBLE - left;
+    memcpy(tmp, src + left, nb_tmp * sizeof(double));
+    _mm256_storeu_pd(tmp + nb_tmp, first);
+    _mm256_storeu_pd(tmp + nb_tmp + AVX_LEN_DOUBLE, last);
+    sort_partition_taild(src, tmp, nb_tmp + 2 * AVX_LEN_DOUBLE, pivot, &left_w, &right_w);
+    return left_w;
+}
+
+SIMD_UTILS_API void sort256d(double *src, int len)
+{
+    sort_rund(src, len, 4 * AVX_LEN_DOUBLE, partition256d, sort_small256d);
+}
+
+#endif
@@ -163,7 +163,7 @@ static inline v8sf log2256_ps(v8sf x)
 }
 
 
-static inline void log10256f(float *src, float *dst, int len)
+SIMD_UTILS_API void log10256f(float *src, float *dst, int len)
 {
     const v8sf invln10f = _mm256_set1_ps((float) INVLN10);  //_mm256_broadcast_ss(&invln10f_mask);
 
@@ -171,9 +171,17 @@ static inline void log10256f(float *src, float *dst, int len)
     stop_len *= AVX_LEN_FLOAT;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
-            v8sf src_tmp = log256_ps(_mm256_load_ps(src + i));
-            _mm256_store_ps(dst + i, _mm256_mul_ps(src_tmp, invln10f));
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
+                v8sf src_tmp = log256_ps(_mm256_load_ps(src + i));
+                _mm256_stream_ps(dst + i, _mm256_mul_ps(src_tmp, invln10f));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
+                v8sf src_tmp = log256_ps(_mm256_load_ps(src + i));
+                _mm256_store_ps(dst + i, _mm256_mul_ps(src_tmp, invln10f));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
@@ -187,7 +195,7 @@ static inline void log10256f(float *src, float *dst, int len)
     }
 }
 
-static inline void log10256f_precise(float *src, float *dst, int len)
+SIMD_UTILS_API void log10256f_precise(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -209,7 +217,7 @@ static inline void log10256f_precise(float *src, float *dst, int len)
     }
 }
 
-static inline void log2256f(float *src, float *dst, int len)
+SIMD_UTILS_API void log2256f(float *src, float *dst, int len)
 {
     const v8sf invln2f = _mm256_set1_ps((float) INVLN2);  //_mm256_broadcast_ss(&invln10f_mask);
 
@@ -217,9 +225,17 @@ static inline void log2256f(float *src, float *dst, int len)
     stop_len *= AVX_LEN_FLOAT;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
-            v8sf src_tmp = log256_ps(_mm256_load_ps(src + i));
-            _mm256_store_ps(dst + i, _mm256_mul_ps(src_tmp, invln2f));
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
+                v8sf src_tmp = log256_ps(_mm256_load_ps(src + i));
+                _mm256_stream_ps(dst + i, _mm256_mul_ps(src_tmp, invln2f));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
+                v8sf src_tmp = log256_ps(_mm256_load_ps(src + i));
+                _mm256_store_ps(dst + i, _mm256_mul_ps(src_tmp, invln2f));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
@@ -233,7 +249,7 @@ static inline void log2256f(float *src, float *dst, int len)
     }
 }
 
-static inline void log2256f_precise(float *src, float *dst, int len)
+SIMD_UTILS_API void log2256f_precise(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -255,14 +271,21 @@ static inline void log2256f_precise(float *src, float *dst, int len)
     }
 }
 
-static inline void ln256f(float *src, float *dst, int len)
+SIMD_UTILS_API void ln256f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
-            _mm256_store_ps(dst + i, log256_ps(_mm256_load_ps(src + i)));
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
+                _mm256_stream_ps(dst + i, log256_ps(_mm256_load_ps(src + i)));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
+                _mm256_store_ps(dst + i, log256_ps(_mm256_load_ps(src + i)));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
@@ -275,14 +298,21 @@ static inline void ln256f(float *src, float *dst, int len)
     }
 }
 
-static inline void exp256f(float *src, float *dst, int len)
+SIMD_UTILS_API void exp256f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
-            _mm256_store_ps(dst + i, exp256_ps(_mm256_load_ps(src + i)));
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
+                _mm256_stream_ps(dst + i, exp256_ps(_mm256_load_ps(src + i)));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
+                _mm256_store_ps(dst + i, exp256_ps(_mm256_load_ps(src + i)));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
@@ -424,7 +454,7 @@ static inline v8sf cbrt256f_ps(v8sf xx)
     return x;
 }
 
-static inline void cbrt256f(float *src, float *dst, int len)
+SIMD_UTILS_API void cbrt256f(float *src, float *dst, int len)
 {
     int stop_len = len / (AVX_LEN_FLOAT);
     stop_len *= (AVX_LEN_FLOAT);
@@ -448,19 +478,31 @@ static inline void cbrt256f(float *src, float *dst, int len)
 }
 #endif
 
-static inline void fabs256f(float *src, float *dst, int len)
+SIMD_UTILS_API void fabs256f(float *src, float *dst, int len)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);
     stop_len *= (2 * AVX_LEN_FLOAT);
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
-            v8sf src_tmp = _mm256_load_ps(src + i);
-            v8sf src_tmp2 = _mm256_load_ps(src + i + AVX_LEN_FLOAT);
-            v8sf fabs1 = _mm256_and_ps(*(v8sf *) _ps256_pos_sign_mask, src_tmp);
-            v8sf fabs2 = _mm256_and_ps(*(v8sf *) _ps256_pos_sign_mask, src_tmp2);
-            _mm256_store_ps(dst + i, fabs1);
-            _mm256_store_ps(dst + i + AVX_LEN_FLOAT, fabs2);
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
+                v8sf src_tmp = _mm256_load_ps(src + i);
+                v8sf src_tmp2 = _mm256_load_ps(src + i + AVX_LEN_FLOAT);
+                v8sf fabs1 = _mm256_and_ps(*(v8sf *) _ps256_pos_sign_mask, src_tmp);
+                v8sf fabs2 = _mm256_and_ps(*(v8sf *) _ps256_pos_sign_mask, src_tmp2);
+                _mm256_stream_ps(dst + i, fabs1);
+                _mm256_stream_ps(dst + i + AVX_LEN_FLOAT, fabs2);
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
+                v8sf src_tmp = _mm256_load_ps(src + i);
+                v8sf src_tmp2 = _mm256_load_ps(src + i + AVX_LEN_FLOAT);
+                v8sf fabs1 = _mm256_and_ps(*(v8sf *) _ps256_pos_sign_mask, src_tmp);
+                v8sf fabs2 = _mm256_and_ps(*(v8sf *) _ps256_pos_sign_mask, src_tmp2);
+                _mm256_store_ps(dst + i, fabs1);
+                _mm256_store_ps(dst + i + AVX_LEN_FLOAT, fabs2);
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
@@ -478,16 +520,23 @@ static inline void fabs256f(float *src, float *dst, int len)
     }
 }
 
-static inline void set256f(float *dst, float value, int len)
+SIMD_UTILS_API void set256f(float *dst, float value, int len)
 {
     const v8sf tmp = _mm256_set1_ps(value);  //_mm256_broadcast_ss(&value); //avx broadcast vs mm_set_ps?
 
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
 
-    if (((uintptr_t) (const void *) (dst) % AVX_LEN_BYTES) == 0) {
-        for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
-            _mm256_store_ps(dst + i, tmp);
+    if (isAligned((uintptr_t) (dst), AVX_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
+                _mm256_stream_ps(dst + i, tmp);
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
+                _mm256_store_ps(dst + i, tmp);
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
@@ -500,16 +549,23 @@ static inline void set256f(float *dst, float value, int len)
     }
 }
 
-static inline void zero256f(float *dst, int len)
+SIMD_UTILS_API void zero256f(float *dst, int len)
 {
     const v8sf tmp = _mm256_setzero_ps();
 
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
 
-    if (((uintptr_t) (const void *) (dst) % AVX_LEN_BYTES) == 0) {
-        for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
-            _mm256_store_ps(dst + i, tmp);
+    if (isAligned((uintptr_t) (dst), AVX_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
+                _mm256_stream_ps(dst + i, tmp);
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
+                _mm256_store_ps(dst + i, tmp);
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
@@ -523,17 +579,27 @@ static inline void zero256f(float *dst, int len)
 }
 
 
-static inline void copy256f(float *src, float *dst, int len)
+SIMD_UTILS_API void copy256f(float *src, float *dst, int len)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);
     stop_len *= (2 * AVX_LEN_FLOAT);
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
-            v8sf src_tmp = _mm256_load_ps(src + i);
-            v8sf src_tmp2 = _mm256_load_ps(src + i + AVX_LEN_FLOAT);
-            _mm256_store_ps(dst + i, src_tmp);
-            _mm256_store_ps(dst + i + AVX_LEN_FLOAT, src_tmp2);
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
+                v8sf src_tmp = _mm256_load_ps(src + i);
+                v8sf src_tmp2 = _mm256_load_ps(src + i + AVX_LEN_FLOAT);
+                _mm256_stream_ps(dst + i, src_tmp);
+                _mm256_stream_ps(dst + i + AVX_LEN_FLOAT, src_tmp2);
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
+                v8sf src_tmp = _mm256_load_ps(src + i);
+                v8sf src_tmp2 = _mm256_load_ps(src + i + AVX_LEN_FLOAT);
+                _mm256_store_ps(dst + i, src_tmp);
+                _mm256_store_ps(dst + i + AVX_LEN_FLOAT, src_tmp2);
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
@@ -549,7 +615,7 @@ static inline void copy256f(float *src, float *dst, int len)
     }
 }
 
-static inline void add256f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void add256f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);
     stop_len *= (2 * AVX_LEN_FLOAT);
@@ -584,7 +650,7 @@ static inline void add256f(float *src1, float *src2, float *dst, int len)
 }
 
 
-static inline void mul256f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void mul256f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);
     stop_len *= (2 * AVX_LEN_FLOAT);
@@ -618,7 +684,7 @@ static inline void mul256f(float *src1, float *src2, float *dst, int len)
     }
 }
 
-static inline void sub256f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void sub256f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);
     stop_len *= (2 * AVX_LEN_FLOAT);
@@ -653,7 +719,7 @@ static inline void sub256f(float *src1, float *src2, float *dst, int len)
 }
 
 
-static inline void addc256f(float *src, float value, float *dst, int len)
+SIMD_UTILS_API void addc256f(float *src, float value, float *dst, int len)
 {
     const v8sf tmp = _mm256_set1_ps(value);  //_mm256_broadcast_ss(&value); //avx broadcast vs mm_set_ps?
 
@@ -685,7 +751,7 @@ static inline void addc256f(float *src, float value, float *dst, int len)
     }
 }
 
-static inline void mulc256f(float *src, float value, float *dst, int len)
+SIMD_UTILS_API void mulc256f(float *src, float value, float *dst, int len)
 {
     const v8sf tmp = _mm256_set1_ps(value);  //_mm256_broadcast_ss(&value); //avx broadcast vs mm_set_ps?
 
@@ -717,7 +783,7 @@ static inline void mulc256f(float *src, float value, float *dst, int len)
     }
 }
 
-static inline void muladd256f(float *_a, float *_b, float *_c, float *dst, int len)
+SIMD_UTILS_API void muladd256f(float *_a, float *_b, float *_c, float *dst, int len)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);
     stop_len *= (2 * AVX_LEN_FLOAT);
@@ -756,7 +822,7 @@ static inline void muladd256f(float *_a, float *_b, float *_c, float *dst, int l
     }
 }
 
-static inline void mulcadd256f(float *_a, float _b, float *_c, float *dst, int len)
+SIMD_UTILS_API void mulcadd256f(float *_a, float _b, float *_c, float *dst, int len)
 {
     v8sf b = _mm256_set1_ps(_b);
 
@@ -782,7 +848,7 @@ static inline void mulcadd256f(float *_a, float _b, float *_c, float *dst, int l
     }
 }
 
-static inline void mulcaddc256f(float *_a, float _b, float _c, float *dst, int len)
+SIMD_UTILS_API void mulcaddc256f(float *_a, float _b, float _c, float *dst, int len)
 {
     v8sf b = _mm256_set1_ps(_b);
     v8sf c = _mm256_set1_ps(_c);
@@ -807,7 +873,7 @@ static inline void mulcaddc256f(float *_a, float _b, float _c, float *dst, int l
     }
 }
 
-static inline void muladdc256f(float *_a, float *_b, float _c, float *dst, int len)
+SIMD_UTILS_API void muladdc256f(float *_a, float *_b, float _c, float *dst, int len)
 {
     v8sf c = _mm256_set1_ps(_c);
 
@@ -833,7 +899,7 @@ static inline void muladdc256f(float *_a, float *_b, float _c, float *dst, int l
     }
 }
 
-static inline void div256f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void div256f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -855,7 +921,7 @@ static inline void div256f(float *src1, float *src2, float *dst, int len)
 
 // TODO : remove previous index dependency to become Out Of Order
 // TODO: intel targets can do 2 mul/FMA per cycle but only one add => replace add_ps(a,b) by fmadd_ps(1.0f,a,b)
-static inline void vectorSlope256f(float *dst, int len, float offset, float slope)
+SIMD_UTILS_API void vectorSlope256f(float *dst, int len, float offset, float slope)
 {
     v8sf coef = _mm256_set_ps(7.0f * slope, 6.0f * slope, 5.0f * slope, 4.0f * slope, 3.0f * slope, 2.0f * slope, slope, 0.0f);
     v8sf slope16_vec = _mm256_set1_ps(16.0f * slope);
@@ -866,7 +932,7 @@ static inline void vectorSlope256f(float *dst, int len, float offset, float slop
     stop_len *= (2 * AVX_LEN_FLOAT);
 
     if (len >= 2*AVX_LEN_FLOAT) {
-        if (((uintptr_t) (const void *) (dst) % AVX_LEN_BYTES) == 0) {
+        if (isAligned((uintptr_t) (dst), AVX_LEN_BYTES)) {
             _mm256_store_ps(dst + 0, curVal);
             _mm256_store_ps(dst + AVX_LEN_FLOAT, curVal2);
         } else {
@@ -874,7 +940,7 @@ static inline void vectorSlope256f(float *dst, int len, float offset, float slop
             _mm256_storeu_ps(dst + AVX_LEN_FLOAT, curVal2);
         }
 
-        if (((uintptr_t) (const void *) (dst) % AVX_LEN_BYTES) == 0) {
+        if (isAligned((uintptr_t) (dst), AVX_LEN_BYTES)) {
             for (int i = 2 * AVX_LEN_FLOAT; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
                 curVal = _mm256_add_ps(curVal, slope16_vec);
                 _mm256_store_ps(dst + i, curVal);
@@ -899,7 +965,7 @@ static inline void vectorSlope256f(float *dst, int len, float offset, float slop
 #ifdef __AVX2__
 
 #if 0
-static inline void convertInt16ToFloat32_256(int16_t *src, float *dst, int len, int scale_factor)
+SIMD_UTILS_API void convertInt16ToFloat32_256(int16_t *src, float *dst, int len, int scale_factor)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);
     stop_len *= (2 * AVX_LEN_FLOAT);
@@ -949,7 +1015,7 @@ static inline void convertInt16ToFloat32_256(int16_t *src, float *dst, int len,
 }
 #else
 
-static inline void convertInt16ToFloat32_256(int16_t *src, float *dst, int len, int scale_factor)
+SIMD_UTILS_API void convertInt16ToFloat32_256(int16_t *src, float *dst, int len, int scale_factor)
 {
     int stop_len = len / (4 * AVX_LEN_FLOAT);
     stop_len *= (4 * AVX_LEN_FLOAT);
@@ -1025,7 +1091,7 @@ static inline void convertInt16ToFloat32_256(int16_t *src, float *dst, int len,
 }
 
 // Allow for integer up to 24bits without overflow
-static inline void convertInt32ToFloat32_256(int32_t *src, float *dst, int len, int scale_factor)
+SIMD_UTILS_API void convertInt32ToFloat32_256(int32_t *src, float *dst, int len, int scale_factor)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);
     stop_len *= (2 * AVX_LEN_FLOAT);
@@ -1063,7 +1129,7 @@ static inline void convertInt32ToFloat32_256(int32_t *src, float *dst, int len,
 }
 #endif
 
-static inline void convertFloat32ToU8_256(float *src, uint8_t *dst, int len, int rounding_mode, int scale_factor)
+SIMD_UTILS_API void convertFloat32ToU8_256(float *src, uint8_t *dst, int len, int rounding_mode, int scale_factor)
 {
     int stop_len = len / (4 * AVX_LEN_FLOAT);
     stop_len *= (4 * AVX_LEN_FLOAT);
@@ -1219,7 +1285,7 @@ static inline void convertFloat32ToU8_256(float *src, uint8_t *dst, int len, int
 
 // Thanks to :
 //  https://coderedirect.com/questions/559388/how-can-i-convert-a-vector-of-float-to-short-int-using-avx-instructions
-static inline void convertFloat32ToI16_256(float *src, int16_t *dst, int len, int rounding_mode, int scale_factor)
+SIMD_UTILS_API void convertFloat32ToI16_256(float *src, int16_t *dst, int len, int rounding_mode, int scale_factor)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);
     stop_len *= (2 * AVX_LEN_FLOAT);
@@ -1326,7 +1392,7 @@ static inline void convertFloat32ToI16_256(float *src, int16_t *dst, int len, in
     }
 }
 
-static inline void convertFloat32ToU16_256(float *src, uint16_t *dst, int len, int rounding_mode, int scale_factor)
+SIMD_UTILS_API void convertFloat32ToU16_256(float *src, uint16_t *dst, int len, int rounding_mode, int scale_factor)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);
     stop_len *= (2 * AVX_LEN_FLOAT);
@@ -1434,7 +1500,7 @@ static inline void convertFloat32ToU16_256(float *src, uint16_t *dst, int len, i
 
 // converts 32bits complex float to two arrays real and im
 // Work in progress => could be improved with custom SSE mm_load2_ps
-static inline void cplxtoreal256f(complex32_t *src, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxtoreal256f(complex32_t *src, float *dstRe, float *dstIm, int len)
 {
     int stop_len = 2 * len / (4 * AVX_LEN_FLOAT);
     stop_len *= 4 * AVX_LEN_FLOAT;
@@ -1533,7 +1599,7 @@ static inline void cplxtoreal256f(complex32_t *src, float *dstRe, float *dstIm,
     }
 }
 
-static inline void realtocplx256f(float *srcRe, float *srcIm, complex32_t *dst, int len)
+SIMD_UTILS_API void realtocplx256f(float *srcRe, float *srcIm, complex32_t *dst, int len)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);
     stop_len *= 2 * AVX_LEN_FLOAT;
@@ -1587,7 +1653,7 @@ static inline void realtocplx256f(float *srcRe, float *srcIm, complex32_t *dst,
     }
 }
 
-static inline void convert256_64f32f(double *src, float *dst, int len)
+SIMD_UTILS_API void convert256_64f32f(double *src, float *dst, int len)
 {
     int stop_len = len / (4 * AVX_LEN_DOUBLE);
     stop_len *= (4 * AVX_LEN_DOUBLE);
@@ -1633,7 +1699,7 @@ static inline void convert256_64f32f(double *src, float *dst, int len)
 }
 
 // Should we add more unrolling to improve this?
-static inline void convert256_32f64f(float *src, double *dst, int len)
+SIMD_UTILS_API void convert256_32f64f(float *src, double *dst, int len)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= 2 * SSE_LEN_FLOAT;
@@ -1663,7 +1729,7 @@ static inline void convert256_32f64f(float *src, double *dst, int len)
     }
 }
 
-static inline void flip256f(float *src, float *dst, int len)
+SIMD_UTILS_API void flip256f(float *src, float *dst, int len)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);
     stop_len *= (2 * AVX_LEN_FLOAT);
@@ -1713,7 +1779,7 @@ static inline void flip256f(float *src, float *dst, int len)
     }
 }
 
-static inline void maxevery256f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void maxevery256f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);
     stop_len *= (2 * AVX_LEN_FLOAT);
@@ -1747,7 +1813,7 @@ static inline void maxevery256f(float *src1, float *src2, float *dst, int len)
     }
 }
 
-static inline void minevery256f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void minevery256f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);
     stop_len *= (2 * AVX_LEN_FLOAT);
@@ -1781,7 +1847,7 @@ static inline void minevery256f(float *src1, float *src2, float *dst, int len)
     }
 }
 
-static inline void minmax256f(float *src, int len, float *min_value, float *max_value)
+SIMD_UTILS_API void minmax256f(float *src, int len, float *min_value, float *max_value)
 {
     int stop_len = (len - AVX_LEN_FLOAT) / (2 * AVX_LEN_FLOAT);
     stop_len *= (2 * AVX_LEN_FLOAT);
@@ -1840,8 +1906,8 @@ static inline void minmax256f(float *src, int len, float *min_value, float *max_
         min3 = _mm_shuffle_ps(min4, min4, _MM_SHUFFLE(0,1,2,3)); //min3 = _mm_permute_ps(min4, 0x0E);
         max4 = _mm_max_ps(max3, max4);
         min4 = _mm_min_ps(min3, min4);
-        max3 = _mm_shuffle_ps(max4, max4, _MM_SHUFFLE(1,0,1,0)); //max3 = _mm_permute_ps(max4, 0x01);
-        min3 = _mm_shuffle_ps(min4, min4, _MM_SHUFFLE(1,0,1,0)); //min3 = _mm_permute_ps(min4, 0x01);
+        max3 = _mm_shuffle_ps(max4, max4, _MM_SHUFFLE(2,3,0,1)); //max3 = _mm_permute_ps(max4, 0xB1);
+        min3 = _mm_shuffle_ps(min4, min4, _MM_SHUFFLE(2,3,0,1)); //min3 = _mm_permute_ps(min4, 0xB1);
         max4 = _mm_max_ps(max3, max4);
         min4 = _mm_min_ps(min3, min4);
         _mm_store_ss(&max_tmp, max4);
@@ -1880,7 +1946,7 @@ static inline void minmax256f(float *src, int len, float *min_value, float *max_
     *min_value = min_tmp;
 }
 
-static inline void threshold256_gt_f(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold256_gt_f(float *src, float *dst, int len, float value)
 {
     v8sf tmp = _mm256_set1_ps(value);  //_mm256_broadcast_ss(&value); //avx broadcast vs mm_set_ps?
 
@@ -1913,7 +1979,7 @@ static inline void threshold256_gt_f(float *src, float *dst, int len, float valu
 }
 
 #if 1
-static inline void threshold256_gtabs_f(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold256_gtabs_f(float *src, float *dst, int len, float value)
 {
     const v8sf pval = _mm256_set1_ps(value);
 
@@ -1961,7 +2027,7 @@ static inline void threshold256_gtabs_f(float *src, float *dst, int len, float v
     }
 }
 #else
-static inline void threshold256_gtabs_f(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold256_gtabs_f(float *src, float *dst, int len, float value)
 {
     const v8sf pval = _mm256_set1_ps(value);
     const v8sf mval = _mm256_set1_ps(-value);
@@ -2015,7 +2081,7 @@ static inline void threshold256_gtabs_f(float *src, float *dst, int len, float v
 }
 #endif
 
-static inline void threshold256_lt_f(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold256_lt_f(float *src, float *dst, int len, float value)
 {
     v8sf tmp = _mm256_set1_ps(value);  //_mm256_broadcast_ss(&value); //avx broadcast vs mm_set_ps?
 
@@ -2048,7 +2114,7 @@ static inline void threshold256_lt_f(float *src, float *dst, int len, float valu
 }
 
 #if 1
-static inline void threshold256_ltabs_f(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold256_ltabs_f(float *src, float *dst, int len, float value)
 {
     const v8sf pval = _mm256_set1_ps(value);
 
@@ -2096,7 +2162,7 @@ static inline void threshold256_ltabs_f(float *src, float *dst, int len, float v
     }
 }
 #else
-static inline void threshold256_ltabs_f(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold256_ltabs_f(float *src, float *dst, int len, float value)
 {
     const v8sf pval = _mm256_set1_ps(value);
     const v8sf mval = _mm256_set1_ps(-value);
@@ -2150,7 +2216,7 @@ static inline void threshold256_ltabs_f(float *src, float *dst, int len, float v
 }
 #endif
 
-static inline void threshold256_ltval_gtval_f(float *src, float *dst, int len, float ltlevel, float ltvalue, float gtlevel, float gtvalue)
+SIMD_UTILS_API void threshold256_ltval_gtval_f(float *src, float *dst, int len, float ltlevel, float ltvalue, float gtlevel, float gtvalue)
 {
     const v8sf ltlevel_v = _mm256_set1_ps(ltlevel);
     const v8sf ltvalue_v = _mm256_set1_ps(ltvalue);
@@ -2199,15 +2265,23 @@ static inline void threshold256_ltval_gtval_f(float *src, float *dst, int len, f
     }
 }
 
-static inline void sin256f(float *src, float *dst, int len)
+SIMD_UTILS_API void sin256f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
-            v8sf src_tmp = _mm256_load_ps(src + i);
-            _mm256_store_ps(dst + i, sin256_ps(src_tmp));
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
+                v8sf src_tmp = _mm256_load_ps(src + i);
+                _mm256_stream_ps(dst + i, sin256_ps(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
+                v8sf src_tmp = _mm256_load_ps(src + i);
+                _mm256_store_ps(dst + i, sin256_ps(src_tmp));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
@@ -2221,15 +2295,23 @@ static inline void sin256f(float *src, float *dst, int len)
     }
 }
 
-static inline void cos256f(float *src, float *dst, int len)
+SIMD_UTILS_API void cos256f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
-            v8sf src_tmp = _mm256_load_ps(src + i);
-            _mm256_store_ps(dst + i, cos256_ps(src_tmp));
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
+                v8sf src_tmp = _mm256_load_ps(src + i);
+                _mm256_stream_ps(dst + i, cos256_ps(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
+                v8sf src_tmp = _mm256_load_ps(src + i);
+                _mm256_store_ps(dst + i, cos256_ps(src_tmp));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
@@ -2243,7 +2325,7 @@ static inline void cos256f(float *src, float *dst, int len)
     }
 }
 
-static inline void sincos256f(float *src, float *dst_sin, float *dst_cos, int len)
+SIMD_UTILS_API void sincos256f(float *src, float *dst_sin, float *dst_cos, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -2274,7 +2356,7 @@ static inline void sincos256f(float *src, float *dst_sin, float *dst_cos, int le
 }
 
 // e^ix = cos(x) + i*sin(x)
-static inline void sincos256f_interleaved(float *src, complex32_t *dst, int len)
+SIMD_UTILS_API void sincos256f_interleaved(float *src, complex32_t *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -2360,7 +2442,7 @@ static inline v8sf acosh256f_ps(v8sf x)
 }
 #endif
 
-static inline void acosh256f(float *src, float *dst, int len)
+SIMD_UTILS_API void acosh256f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -2412,7 +2494,7 @@ static inline v8sf asinh256f_ps(v8sf xx)
     return z;
 }
 
-static inline void asinh256f(float *src, float *dst, int len)
+SIMD_UTILS_API void asinh256f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -2470,7 +2552,7 @@ static inline v8sf atanh256f_ps(v8sf x)
     return (z);
 }
 
-static inline void atanh256f(float *src, float *dst, int len)
+SIMD_UTILS_API void atanh256f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -2508,7 +2590,7 @@ static inline v8sf cosh256f_ps(v8sf xx)
     return y;
 }
 
-static inline void cosh256f(float *src, float *dst, int len)
+SIMD_UTILS_API void cosh256f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -2567,7 +2649,7 @@ static inline v8sf sinh256f_ps(v8sf x)
     return (z);
 }
 
-static inline void sinh256f(float *src, float *dst, int len)
+SIMD_UTILS_API void sinh256f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -2631,7 +2713,7 @@ static inline v8sf atan256f_ps(v8sf xx)
     return (y);
 }
 
-static inline void atan256f(float *src, float *dst, int len)
+SIMD_UTILS_API void atan256f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -2688,7 +2770,7 @@ static inline v8sf atan2256f_ps(v8sf y, v8sf x)
     return (z);
 }
 
-static inline void atan2256f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void atan2256f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -2708,7 +2790,7 @@ static inline void atan2256f(float *src1, float *src2, float *dst, int len)
     }
 }
 
-static inline void atan2256f_interleaved(complex32_t *src, float *dst, int len)
+SIMD_UTILS_API void atan2256f_interleaved(complex32_t *src, float *dst, int len)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);
     stop_len *= 2 * AVX_LEN_FLOAT;
@@ -2787,7 +2869,7 @@ static inline v8sf asin256f_ps(v8sf xx)
     return (z);
 }
 
-static inline void asin256f(float *src, float *dst, int len)
+SIMD_UTILS_API void asin256f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -2847,7 +2929,7 @@ static inline v8sf tanh256f_ps(v8sf xx)
     return (z);
 }
 
-static inline void tanh256f(float *src, float *dst, int len)
+SIMD_UTILS_API void tanh256f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -2959,15 +3041,23 @@ static inline v8sf tan256f_ps(v8sf xx)
     return (y);
 }
 
-static inline void tan256f(float *src, float *dst, int len)
+SIMD_UTILS_API void tan256f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
-            v8sf src_tmp = _mm256_load_ps(src + i);
-            _mm256_store_ps(dst + i, tan256f_ps(src_tmp));
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
+                v8sf src_tmp = _mm256_load_ps(src + i);
+                _mm256_stream_ps(dst + i, tan256f_ps(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
+                v8sf src_tmp = _mm256_load_ps(src + i);
+                _mm256_store_ps(dst + i, tan256f_ps(src_tmp));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
@@ -2983,7 +3073,7 @@ static inline void tan256f(float *src, float *dst, int len)
 
 #else
 
-static inline void tan256f(float *src, float *dst, int len)
+SIMD_UTILS_API void tan256f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -3006,7 +3096,7 @@ static inline void tan256f(float *src, float *dst, int len)
 }
 #endif
 
-static inline void magnitude256f_split(float *srcRe, float *srcIm, float *dst, int len)
+SIMD_UTILS_API void magnitude256f_split(float *srcRe, float *srcIm, float *dst, int len)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);
     stop_len *= (2 * AVX_LEN_FLOAT);
@@ -3048,7 +3138,7 @@ static inline void magnitude256f_split(float *srcRe, float *srcIm, float *dst, i
     }
 }
 
-static inline void powerspect256f_split(float *srcRe, float *srcIm, float *dst, int len)
+SIMD_UTILS_API void powerspect256f_split(float *srcRe, float *srcIm, float *dst, int len)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);
     stop_len *= (2 * AVX_LEN_FLOAT);
@@ -3086,7 +3176,7 @@ static inline void powerspect256f_split(float *srcRe, float *srcIm, float *dst,
     }
 }
 
-static inline void magnitude256f_interleaved(complex32_t *src, float *dst, int len)
+SIMD_UTILS_API void magnitude256f_interleaved(complex32_t *src, float *dst, int len)
 {
     int stop_len = len / (4 * AVX_LEN_FLOAT);
     stop_len *= 4 * AVX_LEN_FLOAT;
@@ -3155,7 +3245,7 @@ static inline void magnitude256f_interleaved(complex32_t *src, float *dst, int l
     }
 }
 
-static inline void powerspect256f_interleaved(complex32_t *src, float *dst, int len)
+SIMD_UTILS_API void powerspect256f_interleaved(complex32_t *src, float *dst, int len)
 {
     int stop_len = len / (4 * AVX_LEN_FLOAT);
     stop_len *= 4 * AVX_LEN_FLOAT;
@@ -3214,7 +3304,7 @@ static inline void powerspect256f_interleaved(complex32_t *src, float *dst, int
     }
 }
 
-static inline void subcrev256f(float *src, float value, float *dst, int len)
+SIMD_UTILS_API void subcrev256f(float *src, float value, float *dst, int len)
 {
     const v8sf tmp = _mm256_set1_ps(value);
 
@@ -3236,7 +3326,7 @@ static inline void subcrev256f(float *src, float value, float *dst, int len)
     }
 }
 
-static inline void sum256f(float *src, float *dst, int len)
+SIMD_UTILS_API void sum256f(float *src, float *dst, int len)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);
     stop_len *= (2 * AVX_LEN_FLOAT);
@@ -3281,14 +3371,14 @@ static inline void sum256f(float *src, float *dst, int len)
 }
 
 
-static inline void mean256f(float *src, float *dst, int len)
+SIMD_UTILS_API void mean256f(float *src, float *dst, int len)
 {
     float coeff = 1.0f / ((float) len);
     sum256f(src, dst, len);
     *dst *= coeff;
 }
 
-static inline void dot256f(float *src1, float *src2, int len, float *dst)
+SIMD_UTILS_API void dot256f(float *src1, float *src2, int len, float *dst)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);
     stop_len *= (2 * AVX_LEN_FLOAT);
@@ -3330,7 +3420,7 @@ static inline void dot256f(float *src1, float *src2, int len, float *dst)
     *dst = tmp_acc;
 }
 
-static inline void dotc256f(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst)
+SIMD_UTILS_API void dotc256f(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst)
 {
     int stop_len = len / (4 * AVX_LEN_FLOAT);
     stop_len *= (4 * AVX_LEN_FLOAT);
@@ -3410,177 +3500,1117 @@ static inline void dotc256f(complex32_t *src1, complex32_t *src2, int len, compl
     dst->im = dst_tmp.im;
 }
 
-static inline void sqrt256f(float *src, float *dst, int len)
+// *acc + *cor += value, *cor gathers the rounding errors of the additions (TwoSum, see simd_utils_sum.h)
+static inline void kahan_add256f(v8sf *acc, v8sf *cor, v8sf value)
+{
+    v8sf t = _mm256_add_ps(*acc, value);
+    v8sf bp = _mm256_sub_ps(t, *acc);
+    v8sf err = _mm256_add_ps(_mm256_sub_ps(*acc, _mm256_sub_ps(t, bp)), _mm256_sub_ps(value, bp));
+    *cor = _mm256_add_ps(*cor, err);
+    *acc = t;
+}
+
+SIMD_UTILS_API void sumkahan256f(float *src, float *dst, int len)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);
     stop_len *= (2 * AVX_LEN_FLOAT);
 
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+    __attribute__((aligned(AVX_LEN_BYTES))) float accumulate[2 * AVX_LEN_FLOAT];
+    __attribute__((aligned(AVX_LEN_BYTES))) float correction[2 * AVX_LEN_FLOAT];
+    float tmp_acc = 0.0f;
+    float tmp_cor = 0.0f;
+    v8sf vec_acc1 = _mm256_setzero_ps();  // initialize the vector accumulator
+    v8sf vec_acc2 = _mm256_setzero_ps();  // initialize the vector accumulator
+    v8sf vec_cor1 = _mm256_setzero_ps();  // rounding errors of the accumulator
+    v8sf vec_cor2 = _mm256_setzero_ps();  // rounding errors of the accumulator
+
+    if (isAligned((uintptr_t) (src), AVX_LEN_BYTES)) {
         for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
-            v8sf src_tmp = _mm256_load_ps(src + i);
-            v8sf src_tmp2 = _mm256_load_ps(src + i + AVX_LEN_FLOAT);
-            v8sf dst_tmp = _mm256_sqrt_ps(src_tmp);
-            v8sf dst_tmp2 = _mm256_sqrt_ps(src_tmp2);
-            _mm256_store_ps(dst + i, dst_tmp);
-            _mm256_store_ps(dst + i + AVX_LEN_FLOAT, dst_tmp2);
+            kahan_add256f(&vec_acc1, &vec_cor1, _mm256_load_ps(src + i));
+            kahan_add256f(&vec_acc2, &vec_cor2, _mm256_load_ps(src + i + AVX_LEN_FLOAT));
         }
     } else {
         for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
-            v8sf src_tmp = _mm256_loadu_ps(src + i);
-            v8sf src_tmp2 = _mm256_loadu_ps(src + i + AVX_LEN_FLOAT);
-            v8sf dst_tmp = _mm256_sqrt_ps(src_tmp);
-            v8sf dst_tmp2 = _mm256_sqrt_ps(src_tmp2);
-            _mm256_storeu_ps(dst + i, dst_tmp);
-            _mm256_storeu_ps(dst + i + AVX_LEN_FLOAT, dst_tmp2);
+            kahan_add256f(&vec_acc1, &vec_cor1, _mm256_loadu_ps(src + i));
+            kahan_add256f(&vec_acc2, &vec_cor2, _mm256_loadu_ps(src + i + AVX_LEN_FLOAT));
         }
     }
 
+    _mm256_store_ps(accumulate, vec_acc1);
+    _mm256_store_ps(accumulate + AVX_LEN_FLOAT, vec_acc2);
+    _mm256_store_ps(correction, vec_cor1);
+    _mm256_store_ps(correction + AVX_LEN_FLOAT, vec_cor2);
+    kahan_foldf(accumulate, correction, 2 * AVX_LEN_FLOAT, &tmp_acc, &tmp_cor);
+
     for (int i = stop_len; i < len; i++) {
-        dst[i] = sqrtf(src[i]);
+        kahan_addf(&tmp_acc, &tmp_cor, src[i]);
     }
+
+    *dst = tmp_acc + tmp_cor;
+}
+
+SIMD_UTILS_API void meankahan256f(float *src, float *dst, int len)
+{
+    float coeff = 1.0f / ((float) len);
+    sumkahan256f(src, dst, len);
+    *dst *= coeff;
 }
 
-static inline void rint256f(float *src, float *dst, int len)
+/* The rounding errors of the products are prod - src1 * src2 computed with a FMA,
+ * they are 0 without FMA (only the additions are compensated) */
+SIMD_UTILS_API void dotkahan256f(float *src1, float *src2, int len, float *dst)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);
     stop_len *= (2 * AVX_LEN_FLOAT);
 
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+    __attribute__((aligned(AVX_LEN_BYTES))) float accumulate[2 * AVX_LEN_FLOAT];
+    __attribute__((aligned(AVX_LEN_BYTES))) float correction[2 * AVX_LEN_FLOAT];
+    float tmp_acc = 0.0f;
+    float tmp_cor = 0.0f;
+    v8sf vec_acc1 = _mm256_setzero_ps();  // initialize the vector accumulator
+    v8sf vec_acc2 = _mm256_setzero_ps();  // initialize the vector accumulator
+    v8sf vec_cor1 = _mm256_setzero_ps();  // rounding errors of the accumulator
+    v8sf vec_cor2 = _mm256_setzero_ps();  // rounding errors of the accumulator
+
+    if (areAligned2((uintptr_t) (src1), (uintptr_t) (src2), AVX_LEN_BYTES)) {
         for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
-            v8sf src_tmp = _mm256_load_ps(src + i);
-            v8sf src_tmp2 = _mm256_load_ps(src + i + AVX_LEN_FLOAT);
-            v8sf dst_tmp = _mm256_round_ps(src_tmp, ROUNDTONEAREST);
-            v8sf dst_tmp2 = _mm256_round_ps(src_tmp2, ROUNDTONEAREST);
-            _mm256_store_ps(dst + i, dst_tmp);
-            _mm256_store_ps(dst + i + AVX_LEN_FLOAT, dst_tmp2);
+            v8sf vec_src1_tmp = _mm256_load_ps(src1 + i);
+            v8sf vec_src1_tmp2 = _mm256_load_ps(src1 + i + AVX_LEN_FLOAT);
+            v8sf vec_src2_tmp = _mm256_load_ps(src2 + i);
+            v8sf vec_src2_tmp2 = _mm256_load_ps(src2 + i + AVX_LEN_FLOAT);
+            v8sf prod = _mm256_mul_ps(vec_src1_tmp, vec_src2_tmp);
+            v8sf prod2 = _mm256_mul_ps(vec_src1_tmp2, vec_src2_tmp2);
+            kahan_add256f(&vec_acc1, &vec_cor1, prod);
+            kahan_add256f(&vec_acc2, &vec_cor2, prod2);
+            vec_cor1 = _mm256_sub_ps(vec_cor1, _mm256_fnmadd_ps_custom(vec_src1_tmp, vec_src2_tmp, prod));
+            vec_cor2 = _mm256_sub_ps(vec_cor2, _mm256_fnmadd_ps_custom(vec_src1_tmp2, vec_src2_tmp2, prod2));
         }
     } else {
         for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
-            v8sf src_tmp = _mm256_loadu_ps(src + i);
-            v8sf src_tmp2 = _mm256_loadu_ps(src + i + AVX_LEN_FLOAT);
-            v8sf dst_tmp = _mm256_round_ps(src_tmp, ROUNDTONEAREST);
-            v8sf dst_tmp2 = _mm256_round_ps(src_tmp2, ROUNDTONEAREST);
-            _mm256_storeu_ps(dst + i, dst_tmp);
-            _mm256_storeu_ps(dst + i + AVX_LEN_FLOAT, dst_tmp2);
+            v8sf vec_src1_tmp = _mm256_loadu_ps(src1 + i);
+            v8sf vec_src1_tmp2 = _mm256_loadu_ps(src1 + i + AVX_LEN_FLOAT);
+            v8sf vec_src2_tmp = _mm256_loadu_ps(src2 + i);
+            v8sf vec_src2_tmp2 = _mm256_loadu_ps(src2 + i + AVX_LEN_FLOAT);
+            v8sf prod = _mm256_mul_ps(vec_src1_tmp, vec_src2_tmp);
+            v8sf prod2 = _mm256_mul_ps(vec_src1_tmp2, vec_src2_tmp2);
+            kahan_add256f(&vec_acc1, &vec_cor1, prod);
+            kahan_add256f(&vec_acc2, &vec_cor2, prod2);
+            vec_cor1 = _mm256_sub_ps(vec_cor1, _mm256_fnmadd_ps_custom(vec_src1_tmp, vec_src2_tmp, prod));
+            vec_cor2 = _mm256_sub_ps(vec_cor2, _mm256_fnmadd_ps_custom(vec_src1_tmp2, vec_src2_tmp2, prod2));
         }
     }
 
+    _mm256_store_ps(accumulate, vec_acc1);
+    _mm256_store_ps(accumulate + AVX_LEN_FLOAT, vec_acc2);
+    _mm256_store_ps(correction, vec_cor1);
+    _mm256_store_ps(correction + AVX_LEN_FLOAT, vec_cor2);
+    kahan_foldf(accumulate, correction, 2 * AVX_LEN_FLOAT, &tmp_acc, &tmp_cor);
+
     for (int i = stop_len; i < len; i++) {
-        dst[i] = rintf(src[i]);
+        kahan_addf(&tmp_acc, &tmp_cor, src1[i] * src2[i]);
     }
+
+    *dst = tmp_acc + tmp_cor;
 }
 
-//rounds away from zero like IPP, whereas SSE/AVx/AVX512 rounds to nearest even (IEEE-754)
-static inline void round256f(float *src, float *dst, int len)
+SIMD_UTILS_API void dotckahan256f(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst)
 {
-    int stop_len = len / (2 * AVX_LEN_FLOAT);
-    stop_len *= (2 * AVX_LEN_FLOAT);
+    int stop_len = len / (4 * AVX_LEN_FLOAT);
+    stop_len *= (4 * AVX_LEN_FLOAT);
 
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
-            v8sf src_tmp = _mm256_load_ps(src + i);
-            v8sf src_tmp2 = _mm256_load_ps(src + i + AVX_LEN_FLOAT);
-            v8sf spe1 = _mm256_and_ps(src_tmp, *(v8sf*)_ps256_sign_mask);
-            spe1 = _mm256_or_ps(spe1,*(v8sf*)_ps256_mid_mask);
-            spe1 = _mm256_add_ps(src_tmp, spe1);
-            v8sf spe2 = _mm256_and_ps(src_tmp2, *(v8sf*)_ps256_sign_mask);
-            spe2 = _mm256_or_ps(spe2,*(v8sf*)_ps256_mid_mask);
-            spe2 = _mm256_add_ps(src_tmp2, spe2);
-            v8sf dst_tmp = _mm256_round_ps(spe1, ROUNDTOZERO);
-            v8sf dst_tmp2 = _mm256_round_ps(spe2, ROUNDTOZERO);
-            _mm256_store_ps(dst + i, dst_tmp);
-            _mm256_store_ps(dst + i + AVX_LEN_FLOAT, dst_tmp2);
+    __attribute__((aligned(AVX_LEN_BYTES))) float accumulateRe[2 * AVX_LEN_FLOAT];
+    __attribute__((aligned(AVX_LEN_BYTES))) float accumulateIm[2 * AVX_LEN_FLOAT];
+    __attribute__((aligned(AVX_LEN_BYTES))) float correctionRe[2 * AVX_LEN_FLOAT];
+    __attribute__((aligned(AVX_LEN_BYTES))) float correctionIm[2 * AVX_LEN_FLOAT];
+    complex32_t dst_tmp = {0.0f, 0.0f};
+    complex32_t dst_cor = {0.0f, 0.0f};
+    v8sfx2 vec_acc1 = {{_mm256_setzero_ps(), _mm256_setzero_ps()}};  // initialize the vector accumulator
+    v8sfx2 vec_acc2 = {{_mm256_setzero_ps(), _mm256_setzero_ps()}};  // initialize the vector accumulator
+    v8sfx2 vec_cor1 = {{_mm256_setzero_ps(), _mm256_setzero_ps()}};  // rounding errors of the accumulator
+    v8sfx2 vec_cor2 = {{_mm256_setzero_ps(), _mm256_setzero_ps()}};  // rounding errors of the accumulator
+
+    //  (ac -bd) + i(ad + bc)
+    if (areAligned2((uintptr_t) (src1), (uintptr_t) (src2), AVX_LEN_BYTES)) {
+        for (int i = 0; i < 2 * stop_len; i += 4 * AVX_LEN_FLOAT) {
+            v8sfx2 src1_split = _mm256_load2_ps((float *) (src1) + i);  // a0a1, b0b1
+            v8sfx2 src2_split = _mm256_load2_ps((float *) (src2) + i);  // c0c1, d0d1
+            v8sfx2 src1_split2 = _mm256_load2_ps((float *) (src1) + i + 2 * AVX_LEN_FLOAT);
+            v8sfx2 src2_split2 = _mm256_load2_ps((float *) (src2) + i + 2 * AVX_LEN_FLOAT);
+            v8sf ac = _mm256_mul_ps(src1_split.val[0], src2_split.val[0]);     // ac
+            v8sf ad = _mm256_mul_ps(src1_split.val[0], src2_split.val[1]);     // ad
+            v8sf ac2 = _mm256_mul_ps(src1_split2.val[0], src2_split2.val[0]);  // ac
+            v8sf ad2 = _mm256_mul_ps(src1_split2.val[0], src2_split2.val[1]);  // ad
+            kahan_add256f(&vec_acc1.val[0], &vec_cor1.val[0], _mm256_fnmadd_ps_custom(src1_split.val[1], src2_split.val[1], ac));
+            kahan_add256f(&vec_acc1.val[1], &vec_cor1.val[1], _mm256_fmadd_ps_custom(src1_split.val[1], src2_split.val[0], ad));
+            kahan_add256f(&vec_acc2.val[0], &vec_cor2.val[0], _mm256_fnmadd_ps_custom(src1_split2.val[1], src2_split2.val[1], ac2));
+            kahan_add256f(&vec_acc2.val[1], &vec_cor2.val[1], _mm256_fmadd_ps_custom(src1_split2.val[1], src2_split2.val[0], ad2));
         }
     } else {
-        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
-            v8sf src_tmp = _mm256_loadu_ps(src + i);
-            v8sf src_tmp2 = _mm256_loadu_ps(src + i + AVX_LEN_FLOAT);
-            v8sf spe1 = _mm256_and_ps(src_tmp, *(v8sf*)_ps256_sign_mask);
-            spe1 = _mm256_or_ps(spe1,*(v8sf*)_ps256_mid_mask);
-            spe1 = _mm256_add_ps(src_tmp, spe1);
-            v8sf spe2 = _mm256_and_ps(src_tmp2, *(v8sf*)_ps256_sign_mask);
-            spe2 = _mm256_or_ps(spe2,*(v8sf*)_ps256_mid_mask);
-            spe2 = _mm256_add_ps(src_tmp2, spe2);
-            v8sf dst_tmp = _mm256_round_ps(spe1, ROUNDTOZERO);
-            v8sf dst_tmp2 = _mm256_round_ps(spe2, ROUNDTOZERO);
-            _mm256_storeu_ps(dst + i, dst_tmp);
-            _mm256_storeu_ps(dst + i + AVX_LEN_FLOAT, dst_tmp2);
+        for (int i = 0; i < 2 * stop_len; i += 4 * AVX_LEN_FLOAT) {
+            v8sfx2 src1_split = _mm256_load2u_ps((float *) (src1) + i);  // a0a1, b0b1
+            v8sfx2 src2_split = _mm256_load2u_ps((float *) (src2) + i);  // c0c1, d0d1
+            v8sfx2 src1_split2 = _mm256_load2u_ps((float *) (src1) + i + 2 * AVX_LEN_FLOAT);
+            v8sfx2 src2_split2 = _mm256_load2u_ps((float *) (src2) + i + 2 * AVX_LEN_FLOAT);
+            v8sf ac = _mm256_mul_ps(src1_split.val[0], src2_split.val[0]);     // ac
+            v8sf ad = _mm256_mul_ps(src1_split.val[0], src2_split.val[1]);     // ad
+            v8sf ac2 = _mm256_mul_ps(src1_split2.val[0], src2_split2.val[0]);  // ac
+            v8sf ad2 = _mm256_mul_ps(src1_split2.val[0], src2_split2.val[1]);  // ad
+            kahan_add256f(&vec_acc1.val[0], &vec_cor1.val[0], _mm256_fnmadd_ps_custom(src1_split.val[1], src2_split.val[1], ac));
+            kahan_add256f(&vec_acc1.val[1], &vec_cor1.val[1], _mm256_fmadd_ps_custom(src1_split.val[1], src2_split.val[0], ad));
+            kahan_add256f(&vec_acc2.val[0], &vec_cor2.val[0], _mm256_fnmadd_ps_custom(src1_split2.val[1], src2_split2.val[1], ac2));
+            kahan_add256f(&vec_acc2.val[1], &vec_cor2.val[1], _mm256_fmadd_ps_custom(src1_split2.val[1], src2_split2.val[0], ad2));
         }
     }
 
+    _mm256_store_ps(accumulateRe, vec_acc1.val[0]);
+    _mm256_store_ps(accumulateRe + AVX_LEN_FLOAT, vec_acc2.val[0]);
+    _mm256_store_ps(accumulateIm, vec_acc1.val[1]);
+    _mm256_store_ps(accumulateIm + AVX_LEN_FLOAT, vec_acc2.val[1]);
+    _mm256_store_ps(correctionRe, vec_cor1.val[0]);
+    _mm256_store_ps(correctionRe + AVX_LEN_FLOAT, vec_cor2.val[0]);
+    _mm256_store_ps(correctionIm, vec_cor1.val[1]);
+    _mm256_store_ps(correctionIm + AVX_LEN_FLOAT, vec_cor2.val[1]);
+    kahan_foldf(accumulateRe, correctionRe, 2 * AVX_LEN_FLOAT, &dst_tmp.re, &dst_cor.re);
+    kahan_foldf(accumulateIm, correctionIm, 2 * AVX_LEN_FLOAT, &dst_tmp.im, &dst_cor.im);
+
     for (int i = stop_len; i < len; i++) {
-        dst[i] = roundf(src[i]);
+        kahan_addf(&dst_tmp.re, &dst_cor.re, src1[i].re * src2[i].re - (src1[i].im * src2[i].im));
+        kahan_addf(&dst_tmp.im, &dst_cor.im, src1[i].re * src2[i].im + (src2[i].re * src1[i].im));
     }
+
+    dst->re = dst_tmp.re + dst_cor.re;
+    dst->im = dst_tmp.im + dst_cor.im;
+}
+
+SIMD_UTILS_API void sumpairwise256f(float *src, float *dst, int len)
+{
+    *dst = sum_pairwisef(src, len, sum256f);
+}
+
+SIMD_UTILS_API void meanpairwise256f(float *src, float *dst, int len)
+{
+    float coeff = 1.0f / ((float) len);
+    sumpairwise256f(src, dst, len);
+    *dst *= coeff;
+}
+
+SIMD_UTILS_API void dotpairwise256f(float *src1, float *src2, int len, float *dst)
+{
+    *dst = dot_pairwisef(src1, src2, len, dot256f);
+}
+
+SIMD_UTILS_API void dotcpairwise256f(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst)
+{
+    *dst = dotc_pairwisef(src1, src2, len, dotc256f);
 }
 
-static inline void ceil256f(float *src, float *dst, int len)
+// sums of the powers of (src[i] - shift), see simd_utils_moments.h
+static inline void centered_sums256f(float *src, int len, float shift, double *sums)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);
     stop_len *= (2 * AVX_LEN_FLOAT);
 
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+    __attribute__((aligned(AVX_LEN_BYTES))) float accumulate[4 * AVX_LEN_FLOAT];
+    v8sf shift_vec = _mm256_set1_ps(shift);
+    v8sf sum1_1 = _mm256_setzero_ps(), sum1_2 = _mm256_setzero_ps();  // d
+    v8sf sum2_1 = _mm256_setzero_ps(), sum2_2 = _mm256_setzero_ps();  // d^2
+    v8sf sum3_1 = _mm256_setzero_ps(), sum3_2 = _mm256_setzero_ps();  // d^3
+    v8sf sum4_1 = _mm256_setzero_ps(), sum4_2 = _mm256_setzero_ps();  // d^4
+
+    if (isAligned((uintptr_t) (src), AVX_LEN_BYTES)) {
         for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
-            v8sf src_tmp = _mm256_load_ps(src + i);
-            v8sf src_tmp2 = _mm256_load_ps(src + i + AVX_LEN_FLOAT);
-            v8sf dst_tmp = _mm256_round_ps(src_tmp, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
-            v8sf dst_tmp2 = _mm256_round_ps(src_tmp2, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
-            _mm256_store_ps(dst + i, dst_tmp);
-            _mm256_store_ps(dst + i + AVX_LEN_FLOAT, dst_tmp2);
+            v8sf d1 = _mm256_sub_ps(_mm256_load_ps(src + i), shift_vec);
+            v8sf d2 = _mm256_sub_ps(_mm256_load_ps(src + i + AVX_LEN_FLOAT), shift_vec);
+            v8sf sq1 = _mm256_mul_ps(d1, d1);
+            v8sf sq2 = _mm256_mul_ps(d2, d2);
+            sum1_1 = _mm256_add_ps(sum1_1, d1);
+            sum1_2 = _mm256_add_ps(sum1_2, d2);
+            sum2_1 = _mm256_add_ps(sum2_1, sq1);
+            sum2_2 = _mm256_add_ps(sum2_2, sq2);
+            sum3_1 = _mm256_fmadd_ps_custom(sq1, d1, sum3_1);
+            sum3_2 = _mm256_fmadd_ps_custom(sq2, d2, sum3_2);
+            sum4_1 = _mm256_fmadd_ps_custom(sq1, sq1, sum4_1);
+            sum4_2 = _mm256_fmadd_ps_custom(sq2, sq2, sum4_2);
         }
     } else {
         for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
-            v8sf src_tmp = _mm256_loadu_ps(src + i);
-            v8sf src_tmp2 = _mm256_loadu_ps(src + i + AVX_LEN_FLOAT);
-            v8sf dst_tmp = _mm256_round_ps(src_tmp, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
-            v8sf dst_tmp2 = _mm256_round_ps(src_tmp2, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
-            _mm256_storeu_ps(dst + i, dst_tmp);
-            _mm256_storeu_ps(dst + i + AVX_LEN_FLOAT, dst_tmp2);
+            v8sf d1 = _mm256_sub_ps(_mm256_loadu_ps(src + i), shift_vec);
+            v8sf d2 = _mm256_sub_ps(_mm256_loadu_ps(src + i + AVX_LEN_FLOAT), shift_vec);
+            v8sf sq1 = _mm256_mul_ps(d1, d1);
+            v8sf sq2 = _mm256_mul_ps(d2, d2);
+            sum1_1 = _mm256_add_ps(sum1_1, d1);
+            sum1_2 = _mm256_add_ps(sum1_2, d2);
+            sum2_1 = _mm256_add_ps(sum2_1, sq1);
+            sum2_2 = _mm256_add_ps(sum2_2, sq2);
+            sum3_1 = _mm256_fmadd_ps_custom(sq1, d1, sum3_1);
+            sum3_2 = _mm256_fmadd_ps_custom(sq2, d2, sum3_2);
+            sum4_1 = _mm256_fmadd_ps_custom(sq1, sq1, sum4_1);
+            sum4_2 = _mm256_fmadd_ps_custom(sq2, sq2, sum4_2);
+        }
+    }
+
+    _mm256_store_ps(accumulate, _mm256_add_ps(sum1_1, sum1_2));
+    _mm256_store_ps(accumulate + AVX_LEN_FLOAT, _mm256_add_ps(sum2_1, sum2_2));
+    _mm256_store_ps(accumulate + 2 * AVX_LEN_FLOAT, _mm256_add_ps(sum3_1, sum3_2));
+    _mm256_store_ps(accumulate + 3 * AVX_LEN_FLOAT, _mm256_add_ps(sum4_1, sum4_2));
+
+    for (int k = 0; k < 4; k++) {
+        sums[k] = 0.0;
+        for (int i = 0; i < AVX_LEN_FLOAT; i++) {
+            sums[k] += (double) accumulate[k * AVX_LEN_FLOAT + i];
         }
     }
 
     for (int i = stop_len; i < len; i++) {
-        dst[i] = ceilf(src[i]);
+        double d = (double) (src[i] - shift);
+        double sq = d * d;
+        sums[0] += d;
+        sums[1] += sq;
+        sums[2] += sq * d;
+        sums[3] += sq * sq;
     }
 }
 
-static inline void floor256f(float *src, float *dst, int len)
+SIMD_UTILS_API void moments256f(float *src, int len, moments_t *m)
+{
+    moments_runf(src, len, sum256f, centered_sums256f, m);
+}
+
+// inclusive prefix sum of the lanes of x, within the 128 bits lanes then across them
+static inline v8sf prefix_lanes256f(v8sf x)
+{
+    v8sf zero = _mm256_setzero_ps();
+    v8sf tmp = _mm256_permute_ps(x, _MM_SHUFFLE(2, 1, 0, 0));
+    x = _mm256_add_ps(x, _mm256_blend_ps(tmp, zero, 0x11));
+    tmp = _mm256_permute_ps(x, _MM_SHUFFLE(1, 0, 0, 0));
+    x = _mm256_add_ps(x, _mm256_blend_ps(tmp, zero, 0x33));
+    tmp = _mm256_permute_ps(x, _MM_SHUFFLE(3, 3, 3, 3));
+    return _mm256_add_ps(x, _mm256_permute2f128_ps(tmp, tmp, 0x08));
+}
+
+// last lane of x in all the lanes
+static inline v8sf last_lane256f(v8sf x)
+{
+    v8sf tmp = _mm256_permute_ps(x, _MM_SHUFFLE(3, 3, 3, 3));
+    return _mm256_permute2f128_ps(tmp, tmp, 0x11);
+}
+
+// lanes of x moved up by one, the first lane getting the last lane of prev
+static inline v8sf shift_lane256f(v8sf x, v8sf prev)
+{
+    v8sf rot = _mm256_permute_ps(x, _MM_SHUFFLE(2, 1, 0, 3));
+    v8sf rot_prev = _mm256_permute_ps(prev, _MM_SHUFFLE(2, 1, 0, 3));
+    return _mm256_blend_ps(rot, _mm256_permute2f128_ps(rot, rot_prev, 0x03), 0x11);
+}
+
+// prefix sums of src (see simd_utils.h), exclusive when exclusive is set
+static inline void prefixsum256f_run(float *src, float *dst, int len, float *carry, int exclusive)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);
     stop_len *= (2 * AVX_LEN_FLOAT);
 
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
-            v8sf src_tmp = _mm256_load_ps(src + i);
-            v8sf src_tmp2 = _mm256_load_ps(src + i + AVX_LEN_FLOAT);
-            v8sf dst_tmp = _mm256_round_ps(src_tmp, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
-            v8sf dst_tmp2 = _mm256_round_ps(src_tmp2, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
-            _mm256_store_ps(dst + i, dst_tmp);
-            _mm256_store_ps(dst + i + AVX_LEN_FLOAT, dst_tmp2);
-        }
-    } else {
-        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
-            v8sf src_tmp = _mm256_loadu_ps(src + i);
-            v8sf src_tmp2 = _mm256_loadu_ps(src + i + AVX_LEN_FLOAT);
-            v8sf dst_tmp = _mm256_round_ps(src_tmp, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
-            v8sf dst_tmp2 = _mm256_round_ps(src_tmp2, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
-            _mm256_storeu_ps(dst + i, dst_tmp);
-            _mm256_storeu_ps(dst + i + AVX_LEN_FLOAT, dst_tmp2);
+    v8sf carry_vec = _mm256_set1_ps(carry ? *carry : 0.0f);
+
+    // the carry only waits for one add per pair of vectors
+    for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
+        v8sf a = prefix_lanes256f(_mm256_loadu_ps(src + i));
+        v8sf b = prefix_lanes256f(_mm256_loadu_ps(src + i + AVX_LEN_FLOAT));
+        b = _mm256_add_ps(b, last_lane256f(a));
+        v8sf last = last_lane256f(b);
+        a = _mm256_add_ps(a, carry_vec);
+        b = _mm256_add_ps(b, carry_vec);
+        if (exclusive) {
+            _mm256_storeu_ps(dst + i, shift_lane256f(a, carry_vec));
+            _mm256_storeu_ps(dst + i + AVX_LEN_FLOAT, shift_lane256f(b, a));
+        } else {
+            _mm256_storeu_ps(dst + i, a);
+            _mm256_storeu_ps(dst + i + AVX_LEN_FLOAT, b);
         }
+        carry_vec = _mm256_add_ps(carry_vec, last);
     }
 
+    float carry_tmp = _mm_cvtss_f32(_mm256_castps256_ps128(carry_vec));
     for (int i = stop_len; i < len; i++) {
-        dst[i] = floorf(src[i]);
+        float x = src[i];
+        if (exclusive) {
+            dst[i] = carry_tmp;
+            carry_tmp = carry_tmp + x;
+        } else {
+            carry_tmp = carry_tmp + x;
+            dst[i] = carry_tmp;
+        }
     }
+
+    if (carry)
+        *carry = carry_tmp;
+}
+
+SIMD_UTILS_API void prefixsum256f(float *src, float *dst, int len, float *carry)
+{
+    prefixsum256f_run(src, dst, len, carry, 0);
+}
+
+SIMD_UTILS_API void prefixsum256f_excl(float *src, float *dst, int len, float *carry)
+{
+    prefixsum256f_run(src, dst, len, carry, 1);
 }
 
-static inline void trunc256f(float *src, float *dst, int len)
+SIMD_UTILS_API void diff256f(float *src, float *dst, int len, float *prev)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);
     stop_len *= (2 * AVX_LEN_FLOAT);
 
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
-            v8sf src_tmp = _mm256_load_ps(src + i);
+    float prev_tmp = prev ? *prev : 0.0f;
+    float last = (len > 0) ? src[len - 1] : prev_tmp;  // before src is overwritten by dst
+    v8sf prev_vec = _mm256_set1_ps(prev_tmp);
+
+    for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
+        v8sf a = _mm256_loadu_ps(src + i);
+        v8sf b = _mm256_loadu_ps(src + i + AVX_LEN_FLOAT);
+        _mm256_storeu_ps(dst + i, _mm256_sub_ps(a, shift_lane256f(a, prev_vec)));
+        _mm256_storeu_ps(dst + i + AVX_LEN_FLOAT, _mm256_sub_ps(b, shift_lane256f(b, a)));
+        prev_vec = b;
+    }
+
+    if (stop_len > 0)
+        prev_tmp = _mm_cvtss_f32(_mm256_castps256_ps128(last_lane256f(prev_vec)));
+    for (int i = stop_len; i < len; i++) {
+        float x = src[i];
+        dst[i] = x - prev_tmp;
+        prev_tmp = x;
+    }
+
+    if (prev)
+        *prev = last;
+}
+
+#ifdef __AVX2__
+// bins of histogram256f, nb_bins outside of the bins (see simd_utils_hist.h)
+static inline void bins256f(float *src, int len, float low, float high, float scale, int nb_bins, int32_t *bins)
+{
+    int stop_len = len / AVX_LEN_FLOAT;
+    stop_len *= AVX_LEN_FLOAT;
+
+    v8sf low_vec = _mm256_set1_ps(low);
+    v8sf high_vec = _mm256_set1_ps(high);
+    v8sf scale_vec = _mm256_set1_ps(scale);
+    v8si last_vec = _mm256_set1_epi32(nb_bins - 1);
+    v8si out_vec = _mm256_set1_epi32(nb_bins);
+
+    if (isAligned((uintptr_t) (src), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
+            v8sf x = _mm256_load_ps(src + i);
+            v8sf in = _mm256_and_ps(_mm256_cmp_ps(x, low_vec, _CMP_GE_OQ), _mm256_cmp_ps(x, high_vec, _CMP_LE_OQ));
+            v8si bin = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_sub_ps(x, low_vec), scale_vec));
+            bin = _mm256_min_epi32(bin, last_vec);
+            _mm256_store_si256((v8si *) (bins + i), _mm256_blendv_epi8(out_vec, bin, _mm256_castps_si256(in)));
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
+            v8sf x = _mm256_loadu_ps(src + i);
+            v8sf in = _mm256_and_ps(_mm256_cmp_ps(x, low_vec, _CMP_GE_OQ), _mm256_cmp_ps(x, high_vec, _CMP_LE_OQ));
+            v8si bin = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_sub_ps(x, low_vec), scale_vec));
+            bin = _mm256_min_epi32(bin, last_vec);
+            _mm256_store_si256((v8si *) (bins + i), _mm256_blendv_epi8(out_vec, bin, _mm256_castps_si256(in)));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        bins[i] = hist_binf(src[i], low, high, scale, nb_bins);
+    }
+}
+
+SIMD_UTILS_API void histogram256f(float *src, int len, float low, float high, int nb_bins, uint32_t *hist)
+{
+    hist_state_t st;
+    float scale = hist_scalef(low, high, nb_bins);
+
+    hist_begin(&st, hist, nb_bins);
+    for (int start = 0; start < len; start += HIST_BLOCK_LEN) {
+        int block_len = hist_block_len(len, start);
+        bins256f(src + start, block_len, low, high, scale, nb_bins, st.bins);
+        hist_count(&st, block_len);
+    }
+    hist_end(&st);
+}
+
+// bins of histogram256f_edges, binary search of all the lanes at once
+static inline void bins256f_edges(float *src, int len, float *edges, int nb_bins, int step, int32_t *bins)
+{
+    int stop_len = len / AVX_LEN_FLOAT;
+    stop_len *= AVX_LEN_FLOAT;
+
+    v8sf first_vec = _mm256_set1_ps(edges[0]);
+    v8sf end_vec = _mm256_set1_ps(edges[nb_bins]);
+    v8si out_vec = _mm256_set1_epi32(nb_bins);
+
+    if (isAligned((uintptr_t) (src), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
+            v8sf x = _mm256_load_ps(src + i);
+            v8sf in = _mm256_and_ps(_mm256_cmp_ps(x, first_vec, _CMP_GE_OQ), _mm256_cmp_ps(x, end_vec, _CMP_LE_OQ));
+            v8si pos = _mm256_setzero_si256();
+            for (int s = step; s > 0; s >>= 1) {
+                v8si cand = _mm256_add_epi32(pos, _mm256_set1_epi32(s));
+                v8si valid = _mm256_cmpgt_epi32(out_vec, cand);  // cand < nb_bins
+                v8sf e = _mm256_mask_i32gather_ps(x, edges, cand, _mm256_castsi256_ps(valid), 4);
+                v8si take = _mm256_and_si256(valid, _mm256_castps_si256(_mm256_cmp_ps(e, x, _CMP_LE_OQ)));
+                pos = _mm256_blendv_epi8(pos, cand, take);
+            }
+            _mm256_store_si256((v8si *) (bins + i), _mm256_blendv_epi8(out_vec, pos, _mm256_castps_si256(in)));
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX_LEN_FLOAT) {
+            v8sf x = _mm256_loadu_ps(src + i);
+            v8sf in = _mm256_and_ps(_mm256_cmp_ps(x, first_vec, _CMP_GE_OQ), _mm256_cmp_ps(x, end_vec, _CMP_LE_OQ));
+            v8si pos = _mm256_setzero_si256();
+            for (int s = step; s > 0; s >>= 1) {
+                v8si cand = _mm256_add_epi32(pos, _mm256_set1_epi32(s));
+                v8si valid = _mm256_cmpgt_epi32(out_vec, cand);  // cand < nb_bins
+                v8sf e = _mm256_mask_i32gather_ps(x, edges, cand, _mm256_castsi256_ps(valid), 4);
+                v8si take = _mm256_and_si256(valid, _mm256_castps_si256(_mm256_cmp_ps(e, x, _CMP_LE_OQ)));
+                pos = _mm256_blendv_epi8(pos, cand, take);
+            }
+            _mm256_store_si256((v8si *) (bins + i), _mm256_blendv_epi8(out_vec, pos, _mm256_castps_si256(in)));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        bins[i] = hist_bin_edgesf(src[i], edges, nb_bins, step);
+    }
+}
+
+SIMD_UTILS_API void histogram256f_edges(float *src, int len, float *edges, int nb_bins, uint32_t *hist)
+{
+    hist_state_t st;
+    int step = hist_edges_step(nb_bins);
+
+    hist_begin(&st, hist, nb_bins);
+    for (int start = 0; start < len; start += HIST_BLOCK_LEN) {
+        int block_len = hist_block_len(len, start);
+        bins256f_edges(src + start, block_len, edges, nb_bins, step, st.bins);
+        hist_count(&st, block_len);
+    }
+    hist_end(&st);
+}
+
+// bitonic sort of the lanes of x
+static inline v8sf sort_lanes256f(v8sf x)
+{
+    v8sf p;
+    p = _mm256_permute_ps(x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm256_blend_ps(_mm256_min_ps(x, p), _mm256_max_ps(x, p), 0x66);
+    p = _mm256_permute_ps(x, _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm256_blend_ps(_mm256_min_ps(x, p), _mm256_max_ps(x, p), 0x3C);
+    p = _mm256_permute_ps(x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm256_blend_ps(_mm256_min_ps(x, p), _mm256_max_ps(x, p), 0x5A);
+    p = _mm256_permute2f128_ps(x, x, 0x01);
+    x = _mm256_blend_ps(_mm256_min_ps(x, p), _mm256_max_ps(x, p), 0xF0);
+    p = _mm256_permute_ps(x, _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm256_blend_ps(_mm256_min_ps(x, p), _mm256_max_ps(x, p), 0xCC);
+    p = _mm256_permute_ps(x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm256_blend_ps(_mm256_min_ps(x, p), _mm256_max_ps(x, p), 0xAA);
+    return x;
+}
+
+// sorts the lanes of x, which are a bitonic sequence
+static inline v8sf sort_clean256f(v8sf x)
+{
+    v8sf p;
+    p = _mm256_permute2f128_ps(x, x, 0x01);
+    x = _mm256_blend_ps(_mm256_min_ps(x, p), _mm256_max_ps(x, p), 0xF0);
+    p = _mm256_permute_ps(x, _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm256_blend_ps(_mm256_min_ps(x, p), _mm256_max_ps(x, p), 0xCC);
+    p = _mm256_permute_ps(x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm256_blend_ps(_mm256_min_ps(x, p), _mm256_max_ps(x, p), 0xAA);
+    return x;
+}
+
+// merges the sorted vectors a and b, a getting the lowest half
+static inline void sort_merge2256f(v8sf *a, v8sf *b)
+{
+    v8sf rev = _mm256_permutevar8x32_ps(*b, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+    v8sf low = _mm256_min_ps(*a, rev);
+    v8sf high = _mm256_max_ps(*a, rev);
+    *a = sort_clean256f(low);
+    *b = sort_clean256f(high);
+}
+
+// merges the sorted sequences (a, b) and (c, d)
+static inline void sort_merge4256f(v8sf *a, v8sf *b, v8sf *c, v8sf *d)
+{
+    v8sf rev_c = _mm256_permutevar8x32_ps(*d, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+    v8sf rev_d = _mm256_permutevar8x32_ps(*c, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+    v8sf low0 = _mm256_min_ps(*a, rev_c);
+    v8sf high0 = _mm256_max_ps(*a, rev_c);
+    v8sf low1 = _mm256_min_ps(*b, rev_d);
+    v8sf high1 = _mm256_max_ps(*b, rev_d);
+    *a = sort_clean256f(_mm256_min_ps(low0, low1));
+    *b = sort_clean256f(_mm256_max_ps(low0, low1));
+    *c = sort_clean256f(_mm256_min_ps(high0, high1));
+    *d = sort_clean256f(_mm256_max_ps(high0, high1));
+}
+
+// sorts up to 4 vectors, padded with the largest value
+static inline void sort_small256f(float *src, int len)
+{
+    float tmp[4 * AVX_LEN_FLOAT] __attribute__((aligned(AVX_LEN_BYTES)));
+
+    memcpy(tmp, src, len * sizeof(float));
+    for (int i = len; i < 4 * AVX_LEN_FLOAT; i++) {
+        tmp[i] = INFINITY;
+    }
+
+    v8sf a = sort_lanes256f(_mm256_loadu_ps(tmp));
+    if (len <= AVX_LEN_FLOAT) {
+        _mm256_storeu_ps(tmp, a);
+    } else if (len <= 2 * AVX_LEN_FLOAT) {
+        v8sf b = sort_lanes256f(_mm256_loadu_ps(tmp + AVX_LEN_FLOAT));
+        sort_merge2256f(&a, &b);
+        _mm256_storeu_ps(tmp, a);
+        _mm256_storeu_ps(tmp + AVX_LEN_FLOAT, b);
+    } else {
+        v8sf b = sort_lanes256f(_mm256_loadu_ps(tmp + AVX_LEN_FLOAT));
+        v8sf c = sort_lanes256f(_mm256_loadu_ps(tmp + 2 * AVX_LEN_FLOAT));
+        v8sf d = sort_lanes256f(_mm256_loadu_ps(tmp + 3 * AVX_LEN_FLOAT));
+        sort_merge2256f(&a, &b);
+        sort_merge2256f(&c, &d);
+        sort_merge4256f(&a, &b, &c, &d);
+        _mm256_storeu_ps(tmp, a);
+        _mm256_storeu_ps(tmp + AVX_LEN_FLOAT, b);
+        _mm256_storeu_ps(tmp + 2 * AVX_LEN_FLOAT, c);
+        _mm256_storeu_ps(tmp + 3 * AVX_LEN_FLOAT, d);
+    }
+
+    memcpy(src, tmp, len * sizeof(float));
+}
+
+// packs the lanes of x lower than the pivot to [*left_w, ...) and the others to [..., *right_w)
+static inline void partition_store256f(float *src, v8sf x, v8sf pivot_vec, int *left_w, int *right_w)
+{
+    int mask = _mm256_movemask_ps(_mm256_cmp_ps(x, pivot_vec, _CMP_LT_OQ));
+    int nb_low = __builtin_popcount(mask);
+    v8si idx = _mm256_srlv_epi32(_mm256_set1_epi32((int32_t) sort_perm8_lut[mask]), _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28));
+    v8sf packed = _mm256_permutevar8x32_ps(x, idx);
+
+    // the full vector is stored on both ends (free space of a vector at least on each end)
+    _mm256_storeu_ps(src + *left_w, packed);
+    _mm256_storeu_ps(src + *right_w - AVX_LEN_FLOAT, packed);
+    *left_w += nb_low;
+    *right_w -= AVX_LEN_FLOAT - nb_low;
+}
+
+// number of elements lower than pivot, moved to the beginning of src (len >= 2 * AVX_LEN_FLOAT)
+static inline int partition256f(float *src, int len, float pivot)
+{
+    v8sf pivot_vec = _mm256_set1_ps(pivot);
+    v8sf first = _mm256_loadu_ps(src);
+    v8sf last = _mm256_loadu_ps(src + len - AVX_LEN_FLOAT);
+    int left = AVX_LEN_FLOAT, right = len - 2 * AVX_LEN_FLOAT;  // next vectors read from each end
+    int left_w = 0, right_w = len;             // free space [left_w, left) and [right + AVX_LEN_FLOAT, right_w)
+
+    while (left <= right) {
+        v8sf x;
+        if ((left - left_w) <= (right_w - right - AVX_LEN_FLOAT)) {
+            x = _mm256_loadu_ps(src + left);
+            left += AVX_LEN_FLOAT;
+        } else {
+            x = _mm256_loadu_ps(src + right);
+            right -= AVX_LEN_FLOAT;
+        }
+        partition_store256f(src, x, pivot_vec, &left_w, &right_w);
+    }
+
+    // the last elements (less than a vector) with the first and the last vectors
+    float tmp[3 * AVX_LEN_FLOAT];
+    int nb_tmp = right + AVX_LEN_FLOAT - left;
+    memcpy(tmp, src + left, nb_tmp * sizeof(float));
+    _mm256_storeu_ps(tmp + nb_tmp, first);
+    _mm256_storeu_ps(tmp + nb_tmp + AVX_LEN_FLOAT, last);
+    sort_partition_tailf(src, tmp, nb_tmp + 2 * AVX_LEN_FLOAT, pivot, &left_w, &right_w);
+    return left_w;
+}
+
+SIMD_UTILS_API void sort256f(float *src, int len)
+{
+    sort_runf(src, len, 4 * AVX_LEN_FLOAT, partition256f, sort_small256f);
+}
+
+// bitonic sort of the lanes of the keys k, with their values v
+static inline void sort_lanes256f_kv(v8sf *k, v8si *v)
+{
+    v8sf pk;
+    v8si pv;
+    v8sf lt, gt, take;
+    pk = _mm256_permute_ps(*k, _MM_SHUFFLE(2, 3, 0, 1));
+    pv = _mm256_shuffle_epi32(*v, _MM_SHUFFLE(2, 3, 0, 1));
+    lt = _mm256_cmp_ps(pk, *k, _CMP_LT_OQ);
+    gt = _mm256_cmp_ps(pk, *k, _CMP_GT_OQ);
+    take = _mm256_blend_ps(lt, gt, 0x66);
+    *k = _mm256_blendv_ps(*k, pk, take);
+    *v = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(*v), _mm256_castsi256_ps(pv), take));
+    pk = _mm256_permute_ps(*k, _MM_SHUFFLE(1, 0, 3, 2));
+    pv = _mm256_shuffle_epi32(*v, _MM_SHUFFLE(1, 0, 3, 2));
+    lt = _mm256_cmp_ps(pk, *k, _CMP_LT_OQ);
+    gt = _mm256_cmp_ps(pk, *k, _CMP_GT_OQ);
+    take = _mm256_blend_ps(lt, gt, 0x3C);
+    *k = _mm256_blendv_ps(*k, pk, take);
+    *v = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(*v), _mm256_castsi256_ps(pv), take));
+    pk = _mm256_permute_ps(*k, _MM_SHUFFLE(2, 3, 0, 1));
+    pv = _mm256_shuffle_epi32(*v, _MM_SHUFFLE(2, 3, 0, 1));
+    lt = _mm256_cmp_ps(pk, *k, _CMP_LT_OQ);
+    gt = _mm256_cmp_ps(pk, *k, _CMP_GT_OQ);
+    take = _mm256_blend_ps(lt, gt, 0x5A);
+    *k = _mm256_blendv_ps(*k, pk, take);
+    *v = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(*v), _mm256_castsi256_ps(pv), take));
+    pk = _mm256_permute2f128_ps(*k, *k, 0x01);
+    pv = _mm256_permute2x128_si256(*v, *v, 0x01);
+    lt = _mm256_cmp_ps(pk, *k, _CMP_LT_OQ);
+    gt = _mm256_cmp_ps(pk, *k, _CMP_GT_OQ);
+    take = _mm256_blend_ps(lt, gt, 0xF0);
+    *k = _mm256_blendv_ps(*k, pk, take);
+    *v = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(*v), _mm256_castsi256_ps(pv), take));
+    pk = _mm256_permute_ps(*k, _MM_SHUFFLE(1, 0, 3, 2));
+    pv = _mm256_shuffle_epi32(*v, _MM_SHUFFLE(1, 0, 3, 2));
+    lt = _mm256_cmp_ps(pk, *k, _CMP_LT_OQ);
+    gt = _mm256_cmp_ps(pk, *k, _CMP_GT_OQ);
+    take = _mm256_blend_ps(lt, gt, 0xCC);
+    *k = _mm256_blendv_ps(*k, pk, take);
+    *v = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(*v), _mm256_castsi256_ps(pv), take));
+    pk = _mm256_permute_ps(*k, _MM_SHUFFLE(2, 3, 0, 1));
+    pv = _mm256_shuffle_epi32(*v, _MM_SHUFFLE(2, 3, 0, 1));
+    lt = _mm256_cmp_ps(pk, *k, _CMP_LT_OQ);
+    gt = _mm256_cmp_ps(pk, *k, _CMP_GT_OQ);
+    take = _mm256_blend_ps(lt, gt, 0xAA);
+    *k = _mm256_blendv_ps(*k, pk, take);
+    *v = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(*v), _mm256_castsi256_ps(pv), take));
+}
+
+// sorts the lanes of the keys k, which are a bitonic sequence, with their values v
+static inline void sort_clean256f_kv(v8sf *k, v8si *v)
+{
+    v8sf pk;
+    v8si pv;
+    v8sf lt, gt, take;
+    pk = _mm256_permute2f128_ps(*k, *k, 0x01);
+    pv = _mm256_permute2x128_si256(*v, *v, 0x01);
+    lt = _mm256_cmp_ps(pk, *k, _CMP_LT_OQ);
+    gt = _mm256_cmp_ps(pk, *k, _CMP_GT_OQ);
+    take = _mm256_blend_ps(lt, gt, 0xF0);
+    *k = _mm256_blendv_ps(*k, pk, take);
+    *v = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(*v), _mm256_castsi256_ps(pv), take));
+    pk = _mm256_permute_ps(*k, _MM_SHUFFLE(1, 0, 3, 2));
+    pv = _mm256_shuffle_epi32(*v, _MM_SHUFFLE(1, 0, 3, 2));
+    lt = _mm256_cmp_ps(pk, *k, _CMP_LT_OQ);
+    gt = _mm256_cmp_ps(pk, *k, _CMP_GT_OQ);
+    take = _mm256_blend_ps(lt, gt, 0xCC);
+    *k = _mm256_blendv_ps(*k, pk, take);
+    *v = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(*v), _mm256_castsi256_ps(pv), take));
+    pk = _mm256_permute_ps(*k, _MM_SHUFFLE(2, 3, 0, 1));
+    pv = _mm256_shuffle_epi32(*v, _MM_SHUFFLE(2, 3, 0, 1));
+    lt = _mm256_cmp_ps(pk, *k, _CMP_LT_OQ);
+    gt = _mm256_cmp_ps(pk, *k, _CMP_GT_OQ);
+    take = _mm256_blend_ps(lt, gt, 0xAA);
+    *k = _mm256_blendv_ps(*k, pk, take);
+    *v = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(*v), _mm256_castsi256_ps(pv), take));
+}
+
+// low = min(a, b), high = max(a, b) of the keys, with their values
+static inline void sort_minmax256f_kv(v8sf ka, v8si va, v8sf kb, v8si vb, v8sf *k_low, v8si *v_low, v8sf *k_high, v8si *v_high)
+{
+    v8sf take = _mm256_cmp_ps(kb, ka, _CMP_LT_OQ);
+    *k_low = _mm256_blendv_ps(ka, kb, take);
+    *v_low = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(va), _mm256_castsi256_ps(vb), take));
+    *k_high = _mm256_blendv_ps(kb, ka, take);
+    *v_high = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(vb), _mm256_castsi256_ps(va), take));
+}
+
+// merges the sorted vectors a and b, a getting the lowest half
+static inline void sort_merge2256f_kv(v8sf *ka, v8si *va, v8sf *kb, v8si *vb)
+{
+    sort_minmax256f_kv(*ka, *va, _mm256_permutevar8x32_ps(*kb, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0)), _mm256_permutevar8x32_epi32(*vb, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0)), ka, va, kb, vb);
+    sort_clean256f_kv(ka, va);
+    sort_clean256f_kv(kb, vb);
+}
+
+// merges the sorted sequences (a, b) and (c, d)
+static inline void sort_merge4256f_kv(v8sf *ka, v8si *va, v8sf *kb, v8si *vb, v8sf *kc, v8si *vc, v8sf *kd, v8si *vd)
+{
+    v8sf k_low0, k_high0, k_low1, k_high1;
+    v8si v_low0, v_high0, v_low1, v_high1;
+    sort_minmax256f_kv(*ka, *va, _mm256_permutevar8x32_ps(*kd, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0)), _mm256_permutevar8x32_epi32(*vd, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0)), &k_low0, &v_low0, &k_high0, &v_high0);
+    sort_minmax256f_kv(*kb, *vb, _mm256_permutevar8x32_ps(*kc, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0)), _mm256_permutevar8x32_epi32(*vc, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0)), &k_low1, &v_low1, &k_high1, &v_high1);
+    sort_minmax256f_kv(k_low0, v_low0, k_low1, v_low1, ka, va, kb, vb);
+    sort_minmax256f_kv(k_high0, v_high0, k_high1, v_high1, kc, vc, kd, vd);
+    sort_clean256f_kv(ka, va);
+    sort_clean256f_kv(kb, vb);
+    sort_clean256f_kv(kc, vc);
+    sort_clean256f_kv(kd, vd);
+}
+
+// sorts up to 4 vectors, padded with +inf keys (insertion sort if there are +inf keys, which could be swapped with the padding)
+static inline void sort_small256f_kv(float *keys, int32_t *values, int len)
+{
+    float tmp_keys[4 * AVX_LEN_FLOAT] __attribute__((aligned(AVX_LEN_BYTES)));
+    int32_t tmp_values[4 * AVX_LEN_FLOAT] __attribute__((aligned(AVX_LEN_BYTES)));
+
+    for (int i = 0; i < len; i++) {
+        if (keys[i] == INFINITY) {
+            insertion_sortf_kv(keys, values, len);
+            return;
+        }
+    }
+    memcpy(tmp_keys, keys, len * sizeof(float));
+    memcpy(tmp_values, values, len * sizeof(int32_t));
+    for (int i = len; i < 4 * AVX_LEN_FLOAT; i++) {
+        tmp_keys[i] = INFINITY;
+        tmp_values[i] = 0;
+    }
+
+    v8sf ka = _mm256_loadu_ps(tmp_keys), kb, kc, kd;
+    v8si va = _mm256_loadu_si256((v8si *) (tmp_values)), vb, vc, vd;
+    sort_lanes256f_kv(&ka, &va);
+    if (len > AVX_LEN_FLOAT) {
+        kb = _mm256_loadu_ps(tmp_keys + AVX_LEN_FLOAT);
+        vb = _mm256_loadu_si256((v8si *) (tmp_values + AVX_LEN_FLOAT));
+        sort_lanes256f_kv(&kb, &vb);
+        sort_merge2256f_kv(&ka, &va, &kb, &vb);
+        _mm256_storeu_ps(tmp_keys + AVX_LEN_FLOAT, kb);
+        _mm256_storeu_si256((v8si *) (tmp_values + AVX_LEN_FLOAT), vb);
+    }
+    if (len > 2 * AVX_LEN_FLOAT) {
+        kc = _mm256_loadu_ps(tmp_keys + 2 * AVX_LEN_FLOAT);
+        vc = _mm256_loadu_si256((v8si *) (tmp_values + 2 * AVX_LEN_FLOAT));
+        kd = _mm256_loadu_ps(tmp_keys + 3 * AVX_LEN_FLOAT);
+        vd = _mm256_loadu_si256((v8si *) (tmp_values + 3 * AVX_LEN_FLOAT));
+        sort_lanes256f_kv(&kc, &vc);
+        sort_lanes256f_kv(&kd, &vd);
+        sort_merge2256f_kv(&kc, &vc, &kd, &vd);
+        sort_merge4256f_kv(&ka, &va, &kb, &vb, &kc, &vc, &kd, &vd);
+        _mm256_storeu_ps(tmp_keys + AVX_LEN_FLOAT, kb);
+        _mm256_storeu_si256((v8si *) (tmp_values + AVX_LEN_FLOAT), vb);
+        _mm256_storeu_ps(tmp_keys + 2 * AVX_LEN_FLOAT, kc);
+        _mm256_storeu_si256((v8si *) (tmp_values + 2 * AVX_LEN_FLOAT), vc);
+        _mm256_storeu_ps(tmp_keys + 3 * AVX_LEN_FLOAT, kd);
+        _mm256_storeu_si256((v8si *) (tmp_values + 3 * AVX_LEN_FLOAT), vd);
+    }
+    _mm256_storeu_ps(tmp_keys, ka);
+    _mm256_storeu_si256((v8si *) (tmp_values), va);
+
+    memcpy(keys, tmp_keys, len * sizeof(float));
+    memcpy(values, tmp_values, len * sizeof(int32_t));
+}
+
+// packs the keys lower than the pivot (with their values) to [*left_w, ...) and the others to [..., *right_w)
+static inline void partition_store256f_kv(float *keys, int32_t *values, v8sf k, v8si v, v8sf pivot_vec, int *left_w, int *right_w)
+{
+    int mask = _mm256_movemask_ps(_mm256_cmp_ps(k, pivot_vec, _CMP_LT_OQ));
+    int nb_low = __builtin_popcount(mask);
+    v8si idx = _mm256_srlv_epi32(_mm256_set1_epi32((int32_t) sort_perm8_lut[mask]), _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28));
+    v8sf packed_k = _mm256_permutevar8x32_ps(k, idx);
+    v8si packed_v = _mm256_permutevar8x32_epi32(v, idx);
+
+    _mm256_storeu_ps(keys + *left_w, packed_k);
+    _mm256_storeu_si256((v8si *) (values + *left_w), packed_v);
+    _mm256_storeu_ps(keys + *right_w - AVX_LEN_FLOAT, packed_k);
+    _mm256_storeu_si256((v8si *) (values + *right_w - AVX_LEN_FLOAT), packed_v);
+    *left_w += nb_low;
+    *right_w -= AVX_LEN_FLOAT - nb_low;
+}
+
+// number of keys lower than pivot, moved to the beginning of keys with their values (len >= 2 * AVX_LEN_FLOAT)
+static inline int partition256f_kv(float *keys, int32_t *values, int len, float pivot)
+{
+    v8sf pivot_vec = _mm256_set1_ps(pivot);
+    v8sf first_k = _mm256_loadu_ps(keys);
+    v8si first_v = _mm256_loadu_si256((v8si *) (values));
+    v8sf last_k = _mm256_loadu_ps(keys + len - AVX_LEN_FLOAT);
+    v8si last_v = _mm256_loadu_si256((v8si *) (values + len - AVX_LEN_FLOAT));
+    int left = AVX_LEN_FLOAT, right = len - 2 * AVX_LEN_FLOAT;  // next vectors read from each end
+    int left_w = 0, right_w = len;             // free space [left_w, left) and [right + AVX_LEN_FLOAT, right_w)
+
+    while (left <= right) {
+        v8sf k;
+        v8si v;
+        if ((left - left_w) <= (right_w - right - AVX_LEN_FLOAT)) {
+            k = _mm256_loadu_ps(keys + left);
+            v = _mm256_loadu_si256((v8si *) (values + left));
+            left += AVX_LEN_FLOAT;
+        } else {
+            k = _mm256_loadu_ps(keys + right);
+            v = _mm256_loadu_si256((v8si *) (values + right));
+            right -= AVX_LEN_FLOAT;
+        }
+        partition_store256f_kv(keys, values, k, v, pivot_vec, &left_w, &right_w);
+    }
+
+    // the last elements (less than a vector) with the first and the last vectors
+    float tmp_keys[3 * AVX_LEN_FLOAT];
+    int32_t tmp_values[3 * AVX_LEN_FLOAT];
+    int nb_tmp = right + AVX_LEN_FLOAT - left;
+    memcpy(tmp_keys, keys + left, nb_tmp * sizeof(float));
+    memcpy(tmp_values, values + left, nb_tmp * sizeof(int32_t));
+    _mm256_storeu_ps(tmp_keys + nb_tmp, first_k);
+    _mm256_storeu_si256((v8si *) (tmp_values + nb_tmp), first_v);
+    _mm256_storeu_ps(tmp_keys + nb_tmp + AVX_LEN_FLOAT, last_k);
+    _mm256_storeu_si256((v8si *) (tmp_values + nb_tmp + AVX_LEN_FLOAT), last_v);
+    sort_partition_tailf_kv(keys, values, tmp_keys, tmp_values, nb_tmp + 2 * AVX_LEN_FLOAT, pivot, &left_w, &right_w);
+    return left_w;
+}
+
+SIMD_UTILS_API void sort256f_kv(float *keys, int32_t *values, int len)
+{
+    sort_runf_kv(keys, values, len, 4 * AVX_LEN_FLOAT, partition256f_kv, sort_small256f_kv);
+}
+
+// indices of the elements of src greater than threshold (see simd_utils_topk.h)
+static inline int filter_gt256f(float *src, int len, float threshold, int32_t *idx)
+{
+    int stop_len = len / (2 * AVX_LEN_FLOAT);
+    stop_len *= (2 * AVX_LEN_FLOAT);
+    v8sf thr = _mm256_set1_ps(threshold);
+    int nb = 0;
+
+    for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
+        v8sf x0 = _mm256_loadu_ps(src + i);
+        v8sf x1 = _mm256_loadu_ps(src + i + AVX_LEN_FLOAT);
+        uint32_t mask = (uint32_t) _mm256_movemask_ps(_mm256_cmp_ps(x0, thr, _CMP_GT_OQ)) | ((uint32_t) _mm256_movemask_ps(_mm256_cmp_ps(x1, thr, _CMP_GT_OQ)) << AVX_LEN_FLOAT);
+        while (mask) {
+            idx[nb++] = i + __builtin_ctz(mask);
+            mask &= mask - 1;
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        if (src[i] > threshold)
+            idx[nb++] = i;
+    }
+    return nb;
+}
+
+// indices of the elements of src lower than threshold (see simd_utils_topk.h)
+static inline int filter_lt256f(float *src, int len, float threshold, int32_t *idx)
+{
+    int stop_len = len / (2 * AVX_LEN_FLOAT);
+    stop_len *= (2 * AVX_LEN_FLOAT);
+    v8sf thr = _mm256_set1_ps(threshold);
+    int nb = 0;
+
+    for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
+        v8sf x0 = _mm256_loadu_ps(src + i);
+        v8sf x1 = _mm256_loadu_ps(src + i + AVX_LEN_FLOAT);
+        uint32_t mask = (uint32_t) _mm256_movemask_ps(_mm256_cmp_ps(x0, thr, _CMP_LT_OQ)) | ((uint32_t) _mm256_movemask_ps(_mm256_cmp_ps(x1, thr, _CMP_LT_OQ)) << AVX_LEN_FLOAT);
+        while (mask) {
+            idx[nb++] = i + __builtin_ctz(mask);
+            mask &= mask - 1;
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        if (src[i] < threshold)
+            idx[nb++] = i;
+    }
+    return nb;
+}
+
+SIMD_UTILS_API void topk256f(float *src, int len, int k, float *dst, int32_t *idx)
+{
+    topk_runf(src, len, k, dst, idx, 1, filter_gt256f);
+}
+
+SIMD_UTILS_API void bottomk256f(float *src, int len, int k, float *dst, int32_t *idx)
+{
+    topk_runf(src, len, k, dst, idx, 0, filter_lt256f);
+}
+
+SIMD_UTILS_API void partialsort256f(float *src, int len, int k)
+{
+    partialsort_runf(src, len, k, 4 * AVX_LEN_FLOAT, partition256f, sort_small256f);
+}
+#endif /* __AVX2__ */
+
+SIMD_UTILS_API void sqrt256f(float *src, float *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_FLOAT);
+    stop_len *= (2 * AVX_LEN_FLOAT);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
+                v8sf src_tmp = _mm256_load_ps(src + i);
+                v8sf src_tmp2 = _mm256_load_ps(src + i + AVX_LEN_FLOAT);
+                v8sf dst_tmp = _mm256_sqrt_ps(src_tmp);
+                v8sf dst_tmp2 = _mm256_sqrt_ps(src_tmp2);
+                _mm256_stream_ps(dst + i, dst_tmp);
+                _mm256_stream_ps(dst + i + AVX_LEN_FLOAT, dst_tmp2);
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
+                v8sf src_tmp = _mm256_load_ps(src + i);
+                v8sf src_tmp2 = _mm256_load_ps(src + i + AVX_LEN_FLOAT);
+                v8sf dst_tmp = _mm256_sqrt_ps(src_tmp);
+                v8sf dst_tmp2 = _mm256_sqrt_ps(src_tmp2);
+                _mm256_store_ps(dst + i, dst_tmp);
+                _mm256_store_ps(dst + i + AVX_LEN_FLOAT, dst_tmp2);
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
+            v8sf src_tmp = _mm256_loadu_ps(src + i);
+            v8sf src_tmp2 = _mm256_loadu_ps(src + i + AVX_LEN_FLOAT);
+            v8sf dst_tmp = _mm256_sqrt_ps(src_tmp);
+            v8sf dst_tmp2 = _mm256_sqrt_ps(src_tmp2);
+            _mm256_storeu_ps(dst + i, dst_tmp);
+            _mm256_storeu_ps(dst + i + AVX_LEN_FLOAT, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = sqrtf(src[i]);
+    }
+}
+
+SIMD_UTILS_API void rint256f(float *src, float *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_FLOAT);
+    stop_len *= (2 * AVX_LEN_FLOAT);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
+            v8sf src_tmp = _mm256_load_ps(src + i);
+            v8sf src_tmp2 = _mm256_load_ps(src + i + AVX_LEN_FLOAT);
+            v8sf dst_tmp = _mm256_round_ps(src_tmp, ROUNDTONEAREST);
+            v8sf dst_tmp2 = _mm256_round_ps(src_tmp2, ROUNDTONEAREST);
+            _mm256_store_ps(dst + i, dst_tmp);
+            _mm256_store_ps(dst + i + AVX_LEN_FLOAT, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
+            v8sf src_tmp = _mm256_loadu_ps(src + i);
+            v8sf src_tmp2 = _mm256_loadu_ps(src + i + AVX_LEN_FLOAT);
+            v8sf dst_tmp = _mm256_round_ps(src_tmp, ROUNDTONEAREST);
+            v8sf dst_tmp2 = _mm256_round_ps(src_tmp2, ROUNDTONEAREST);
+            _mm256_storeu_ps(dst + i, dst_tmp);
+            _mm256_storeu_ps(dst + i + AVX_LEN_FLOAT, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = rintf(src[i]);
+    }
+}
+
+//rounds away from zero like IPP, whereas SSE/AVx/AVX512 rounds to nearest even (IEEE-754)
+SIMD_UTILS_API void round256f(float *src, float *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_FLOAT);
+    stop_len *= (2 * AVX_LEN_FLOAT);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
+            v8sf src_tmp = _mm256_load_ps(src + i);
+            v8sf src_tmp2 = _mm256_load_ps(src + i + AVX_LEN_FLOAT);
+            v8sf spe1 = _mm256_and_ps(src_tmp, *(v8sf*)_ps256_sign_mask);
+            spe1 = _mm256_or_ps(spe1,*(v8sf*)_ps256_mid_mask);
+            spe1 = _mm256_add_ps(src_tmp, spe1);
+            v8sf spe2 = _mm256_and_ps(src_tmp2, *(v8sf*)_ps256_sign_mask);
+            spe2 = _mm256_or_ps(spe2,*(v8sf*)_ps256_mid_mask);
+            spe2 = _mm256_add_ps(src_tmp2, spe2);
+            v8sf dst_tmp = _mm256_round_ps(spe1, ROUNDTOZERO);
+            v8sf dst_tmp2 = _mm256_round_ps(spe2, ROUNDTOZERO);
+            _mm256_store_ps(dst + i, dst_tmp);
+            _mm256_store_ps(dst + i + AVX_LEN_FLOAT, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
+            v8sf src_tmp = _mm256_loadu_ps(src + i);
+            v8sf src_tmp2 = _mm256_loadu_ps(src + i + AVX_LEN_FLOAT);
+            v8sf spe1 = _mm256_and_ps(src_tmp, *(v8sf*)_ps256_sign_mask);
+            spe1 = _mm256_or_ps(spe1,*(v8sf*)_ps256_mid_mask);
+            spe1 = _mm256_add_ps(src_tmp, spe1);
+            v8sf spe2 = _mm256_and_ps(src_tmp2, *(v8sf*)_ps256_sign_mask);
+            spe2 = _mm256_or_ps(spe2,*(v8sf*)_ps256_mid_mask);
+            spe2 = _mm256_add_ps(src_tmp2, spe2);
+            v8sf dst_tmp = _mm256_round_ps(spe1, ROUNDTOZERO);
+            v8sf dst_tmp2 = _mm256_round_ps(spe2, ROUNDTOZERO);
+            _mm256_storeu_ps(dst + i, dst_tmp);
+            _mm256_storeu_ps(dst + i + AVX_LEN_FLOAT, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = roundf(src[i]);
+    }
+}
+
+SIMD_UTILS_API void ceil256f(float *src, float *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_FLOAT);
+    stop_len *= (2 * AVX_LEN_FLOAT);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
+            v8sf src_tmp = _mm256_load_ps(src + i);
+            v8sf src_tmp2 = _mm256_load_ps(src + i + AVX_LEN_FLOAT);
+            v8sf dst_tmp = _mm256_round_ps(src_tmp, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+            v8sf dst_tmp2 = _mm256_round_ps(src_tmp2, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+            _mm256_store_ps(dst + i, dst_tmp);
+            _mm256_store_ps(dst + i + AVX_LEN_FLOAT, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
+            v8sf src_tmp = _mm256_loadu_ps(src + i);
+            v8sf src_tmp2 = _mm256_loadu_ps(src + i + AVX_LEN_FLOAT);
+            v8sf dst_tmp = _mm256_round_ps(src_tmp, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+            v8sf dst_tmp2 = _mm256_round_ps(src_tmp2, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+            _mm256_storeu_ps(dst + i, dst_tmp);
+            _mm256_storeu_ps(dst + i + AVX_LEN_FLOAT, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = ceilf(src[i]);
+    }
+}
+
+SIMD_UTILS_API void floor256f(float *src, float *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_FLOAT);
+    stop_len *= (2 * AVX_LEN_FLOAT);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
+            v8sf src_tmp = _mm256_load_ps(src + i);
+            v8sf src_tmp2 = _mm256_load_ps(src + i + AVX_LEN_FLOAT);
+            v8sf dst_tmp = _mm256_round_ps(src_tmp, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+            v8sf dst_tmp2 = _mm256_round_ps(src_tmp2, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+            _mm256_store_ps(dst + i, dst_tmp);
+            _mm256_store_ps(dst + i + AVX_LEN_FLOAT, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
+            v8sf src_tmp = _mm256_loadu_ps(src + i);
+            v8sf src_tmp2 = _mm256_loadu_ps(src + i + AVX_LEN_FLOAT);
+            v8sf dst_tmp = _mm256_round_ps(src_tmp, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+            v8sf dst_tmp2 = _mm256_round_ps(src_tmp2, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+            _mm256_storeu_ps(dst + i, dst_tmp);
+            _mm256_storeu_ps(dst + i + AVX_LEN_FLOAT, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = floorf(src[i]);
+    }
+}
+
+SIMD_UTILS_API void trunc256f(float *src, float *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_FLOAT);
+    stop_len *= (2 * AVX_LEN_FLOAT);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
+            v8sf src_tmp = _mm256_load_ps(src + i);
             v8sf src_tmp2 = _mm256_load_ps(src + i + AVX_LEN_FLOAT);
             v8sf dst_tmp = _mm256_round_ps(src_tmp, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
             v8sf dst_tmp2 = _mm256_round_ps(src_tmp2, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
@@ -3603,7 +4633,7 @@ static inline void trunc256f(float *src, float *dst, int len)
     }
 }
 
-static inline void cplxvecdiv256f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxvecdiv256f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
 
 {
     int stop_len = len / (AVX_LEN_FLOAT);  //(len << 1) >> 2;
@@ -3651,7 +4681,7 @@ static inline void cplxvecdiv256f(complex32_t *src1, complex32_t *src2, complex3
     }
 }
 
-static inline void cplxvecdiv256f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxvecdiv256f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);
     stop_len *= 2 * AVX_LEN_FLOAT;
@@ -3736,7 +4766,7 @@ static inline void cplxvecdiv256f_split(float *src1Re, float *src1Im, float *src
     }
 }
 
-static inline void cplxvecmul256f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxvecmul256f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
 {
     int stop_len = len / (AVX_LEN_FLOAT);  //(len << 1) >> 2;
     stop_len = stop_len * AVX_LEN_FLOAT;   // stop_len << 2;
@@ -3772,7 +4802,7 @@ static inline void cplxvecmul256f(complex32_t *src1, complex32_t *src2, complex3
     }
 }
 
-static inline void cplxvecmul256f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxvecmul256f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
 {
     int stop_len = len / (AVX_LEN_FLOAT);
     stop_len = stop_len * AVX_LEN_FLOAT;
@@ -3814,7 +4844,7 @@ static inline void cplxvecmul256f_split(float *src1Re, float *src1Im, float *src
     }
 }
 
-static inline void cplxconjvecmul256f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxconjvecmul256f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
 {
     int stop_len = len / (AVX_LEN_FLOAT);  //(len << 1) >> 2;
     stop_len = stop_len * AVX_LEN_FLOAT;   // stop_len << 2;
@@ -3864,7 +4894,7 @@ static inline void cplxconjvecmul256f(complex32_t *src1, complex32_t *src2, comp
     }
 }
 
-static inline void cplxconjvecmul256f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxconjvecmul256f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
 {
     int stop_len = len / (AVX_LEN_FLOAT);
     stop_len = stop_len * AVX_LEN_FLOAT;
@@ -3907,7 +4937,7 @@ static inline void cplxconjvecmul256f_split(float *src1Re, float *src1Im, float
 }
 
 // prefer using cplxconjvecmulXf if you also need to do a multiply
-static inline void cplxconj256f(complex32_t *src, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxconj256f(complex32_t *src, complex32_t *dst, int len)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);  //(len << 1) >> 2;
     stop_len *= 2 * AVX_LEN_FLOAT;             // stop_len << 2;
@@ -3942,7 +4972,7 @@ static inline void cplxconj256f(complex32_t *src, complex32_t *dst, int len)
     }
 }
 
-static inline void sigmoid256f(float *src, float *dst, int len)
+SIMD_UTILS_API void sigmoid256f(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -3966,7 +4996,7 @@ static inline void sigmoid256f(float *src, float *dst, int len)
     }
 }
 
-static inline void PRelu256f(float *src, float *dst, float alpha, int len)
+SIMD_UTILS_API void PRelu256f(float *src, float *dst, float alpha, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -4001,7 +5031,7 @@ static inline void PRelu256f(float *src, float *dst, float alpha, int len)
 }
 
 // to be improved
-static inline void softmax256f(float *src, float *dst, int len)
+SIMD_UTILS_API void softmax256f(float *src, float *dst, int len)
 {
     int stop_len = len / (AVX_LEN_FLOAT);
     stop_len *= (AVX_LEN_FLOAT);
@@ -4062,7 +5092,7 @@ static inline void softmax256f(float *src, float *dst, int len)
     }
 }
 
-static inline void pol2cart2D256f(float *r, float *theta, float *x, float *y, int len)
+SIMD_UTILS_API void pol2cart2D256f(float *r, float *theta, float *x, float *y, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -4102,7 +5132,7 @@ static inline void pol2cart2D256f(float *r, float *theta, float *x, float *y, in
     }
 }
 
-static inline void cart2pol2D256f(float *x, float *y, float *r, float *theta, int len)
+SIMD_UTILS_API void cart2pol2D256f(float *x, float *y, float *r, float *theta, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -4138,7 +5168,7 @@ static inline void cart2pol2D256f(float *x, float *y, float *r, float *theta, in
     }
 }
 
-static inline void modf256f(float *src, float *integer, float *remainder, int len)
+SIMD_UTILS_API void modf256f(float *src, float *integer, float *remainder, int len)
 {
     int stop_len = len / (2 * AVX_LEN_FLOAT);
     stop_len *= (2 * AVX_LEN_FLOAT);
@@ -4177,7 +5207,7 @@ static inline void modf256f(float *src, float *integer, float *remainder, int le
 }
 
 //F16C introduced in the same time as AVX, so not SSE code
-static inline void fp32tofp16128 (float* src, uint16_t* dst, size_t len)
+SIMD_UTILS_API void fp32tofp16128 (float* src, uint16_t* dst, size_t len)
 {
     int stop_len = len / (2*SSE_LEN_FLOAT);
     stop_len *= (2*SSE_LEN_FLOAT);
@@ -4202,12 +5232,12 @@ static inline void fp32tofp16128 (float* src, uint16_t* dst, size_t len)
 		} 	
 	}
 		
-    for (int i = stop_len; i < len; i++) {
+    for (size_t i = stop_len; i < len; i++) {
         dst[i] = float2half_rn(src[i]);
     }	
 }
 
-static inline void fp32tofp16256 (float* src, uint16_t* dst, size_t len)
+SIMD_UTILS_API void fp32tofp16256 (float* src, uint16_t* dst, size_t len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -4226,13 +5256,13 @@ static inline void fp32tofp16256 (float* src, uint16_t* dst, size_t len)
 		}
 	}
 	
-    for (int i = stop_len; i < len; i++) {
+    for (size_t i = stop_len; i < len; i++) {
         dst[i] = float2half_rn(src[i]);
     }	
 }
 
 //F16C introduced in the same time as AVX, so not SSE code
-static inline  void fp16tofp32128 (uint16_t* src, float* dst, size_t len)
+SIMD_UTILS_API void fp16tofp32128 (uint16_t* src, float* dst, size_t len)
 {
     int stop_len = len / (2*SSE_LEN_FLOAT);
     stop_len *= (2*SSE_LEN_FLOAT);
@@ -4257,12 +5287,12 @@ static inline  void fp16tofp32128 (uint16_t* src, float* dst, size_t len)
 		}	
 	}
    
-    for (int i = stop_len; i < len; i++) {
+    for (size_t i = stop_len; i < len; i++) {
 		dst[i] = uint32_as_float(Float16ToFloat32(src[i]));
     }	
 }
 
-static inline void fp16tofp32256 (uint16_t* src, float* dst, size_t len)
+SIMD_UTILS_API void fp16tofp32256 (uint16_t* src, float* dst, size_t len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -4281,7 +5311,7 @@ static inline void fp16tofp32256 (uint16_t* src, float* dst, size_t len)
 		}
 	}
 	   
-    for (int i = stop_len; i < len; i++) {
+    for (size_t i = stop_len; i < len; i++) {
 		dst[i] = uint32_as_float(Float16ToFloat32(src[i]));
     }	
 }
@@ -4294,7 +5324,7 @@ static inline v8sf pow256_ps(v8sf x, v8sf y)
     return ret;
 }
 
-static inline void pow256f(float *x, float *y, float *dst, int len)
+SIMD_UTILS_API void pow256f(float *x, float *y, float *dst, int len)
 {
     int stop_len = len / (2* AVX_LEN_FLOAT);
     stop_len *= ( 2*AVX_LEN_FLOAT);
@@ -4328,13 +5358,13 @@ static inline void pow256f(float *x, float *y, float *dst, int len)
     }
 }
 
-static inline void powcplx256f(complex32_t *x, complex32_t *y, complex32_t *dst, int len)
+SIMD_UTILS_API void powcplx256f(complex32_t *x, complex32_t *y, complex32_t *dst, int len)
 {
     int stop_len = len / (2* AVX_LEN_FLOAT);
     stop_len *= ( 2*AVX_LEN_FLOAT);
 
     if (areAligned3((uintptr_t) (x), (uintptr_t) (y), (uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
+        for (int i = 0; i < 2 * stop_len; i += 2 * AVX_LEN_FLOAT) {
             v8sfx2 x_tmp = _mm256_load2_ps((float const *) (x) + i);
             v8sfx2 y_tmp = _mm256_load2_ps((float const *) (y) + i);
             v8sf x_tmp_re2 = _mm256_mul_ps(x_tmp.val[0], x_tmp.val[0]);
@@ -4357,7 +5387,7 @@ static inline void powcplx256f(complex32_t *x, complex32_t *y, complex32_t *dst,
             _mm256_store2_ps((float*)(dst) + i, dst_tmp);
         }
     } else {
-        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
+        for (int i = 0; i < 2 * stop_len; i += 2 * AVX_LEN_FLOAT) {
             v8sfx2 x_tmp = _mm256_load2u_ps((float const *) (x) + i);
             v8sfx2 y_tmp = _mm256_load2u_ps((float const *) (y) + i);
             v8sf x_tmp_re2 = _mm256_mul_ps(x_tmp.val[0], x_tmp.val[0]);
@@ -4399,4 +5429,581 @@ static inline void powcplx256f(complex32_t *x, complex32_t *y, complex32_t *dst,
 		dst[i].re = ex * cosylogx;
 		dst[i].im = ex * sinylogx;
     }
-}
\ No newline at end of file
+}
+
+// Applies one stage of a pipeline on a block (in may be equal to out).
+// offset is the position of the block in the whole array, used for the array operands
+SIMD_UTILS_API void pipeline_apply256f(const pipeline_op_t *op, float *in, float *out, int offset, int len)
+{
+    switch (op->op) {
+    case PipeMulC:
+        mulc256f(in, op->value, out, len);
+        break;
+    case PipeAddC:
+        addc256f(in, op->value, out, len);
+        break;
+    case PipeMul:
+        mul256f(in, op->src + offset, out, len);
+        break;
+    case PipeAdd:
+        add256f(in, op->src + offset, out, len);
+        break;
+    case PipeSub:
+        sub256f(in, op->src + offset, out, len);
+        break;
+    case PipeDiv:
+        div256f(in, op->src + offset, out, len);
+        break;
+    case PipeThresholdGt:
+        threshold256_gt_f(in, out, len, op->value);
+        break;
+    case PipeThresholdLt:
+        threshold256_lt_f(in, out, len, op->value);
+        break;
+    case PipeFabs:
+        fabs256f(in, out, len);
+        break;
+    case PipeSqrt:
+        sqrt256f(in, out, len);
+        break;
+    case PipeExp:
+        exp256f(in, out, len);
+        break;
+    case PipeLn:
+        ln256f(in, out, len);
+        break;
+    case PipeLog10:
+        log10256f(in, out, len);
+        break;
+    case PipeLog2:
+        log2256f(in, out, len);
+        break;
+    case PipeCbrt:
+        cbrt256f(in, out, len);
+        break;
+    case PipeSin:
+        sin256f(in, out, len);
+        break;
+    case PipeCos:
+        cos256f(in, out, len);
+        break;
+    case PipeTan:
+        tan256f(in, out, len);
+        break;
+    case PipeTanh:
+        tanh256f(in, out, len);
+        break;
+    case PipeAtan:
+        atan256f(in, out, len);
+        break;
+    case PipeSigmoid:
+        sigmoid256f(in, out, len);
+        break;
+    default:
+        if (in != out)
+            copy256f(in, out, len);
+        break;
+    }
+}
+
+/* Applies the chain of operations ops[0] ... ops[nb_ops - 1] on src, block by block,
+ * so that each block stays in L1 cache between two operations */
+SIMD_UTILS_API void pipeline256f(float *src, float *dst, int len, const pipeline_op_t *ops, int nb_ops)
+{
+    if (nb_ops <= 0) {
+        if (src != dst)
+            copy256f(src, dst, len);
+        return;
+    }
+
+    for (int i = 0; i < len; i += PIPELINE_BLOCK_FLOAT) {
+        int block_len = ((len - i) < PIPELINE_BLOCK_FLOAT) ? (len - i) : PIPELINE_BLOCK_FLOAT;
+        pipeline_apply256f(&ops[0], src + i, dst + i, i, block_len);
+        for (int k = 1; k < nb_ops; k++) {
+            pipeline_apply256f(&ops[k], dst + i, dst + i, i, block_len);
+        }
+    }
+}
+
+// Same as pipeline256f followed by a sum, without writing the intermediate array
+SIMD_UTILS_API void pipeline256f_sum(float *src, float *dst, int len, const pipeline_op_t *ops, int nb_ops)
+{
+    __attribute__((aligned(AVX_LEN_BYTES))) float block[PIPELINE_BLOCK_FLOAT];
+    double acc = 0.0;
+
+    for (int i = 0; i < len; i += PIPELINE_BLOCK_FLOAT) {
+        int block_len = ((len - i) < PIPELINE_BLOCK_FLOAT) ? (len - i) : PIPELINE_BLOCK_FLOAT;
+        float *in = src + i;
+        float block_sum;
+        for (int k = 0; k < nb_ops; k++) {
+            pipeline_apply256f(&ops[k], in, block, i, block_len);
+            in = block;
+        }
+        sum256f(in, &block_sum, block_len);
+        acc += (double) block_sum;
+    }
+
+    *dst = (float) acc;
+}
+
+/* FFT (see simd_utils_fft.h) */
+
+// radix-4 butterfly on AVX_LEN_FLOAT points x[idx + r*n4], y = Y0re, Y0im, w1*Y1re, w1*Y1im, ...
+static inline void fft_radix4_256f(const float *xr, const float *xi, int idx, int n4, const v8sf *w, v8sf *y)
+{
+    v8sf ar = _mm256_loadu_ps(xr + idx), ai = _mm256_loadu_ps(xi + idx);
+    v8sf br = _mm256_loadu_ps(xr + idx + n4), bi = _mm256_loadu_ps(xi + idx + n4);
+    v8sf cr = _mm256_loadu_ps(xr + idx + 2 * n4), ci = _mm256_loadu_ps(xi + idx + 2 * n4);
+    v8sf dr = _mm256_loadu_ps(xr + idx + 3 * n4), di = _mm256_loadu_ps(xi + idx + 3 * n4);
+    v8sf apcr = _mm256_add_ps(ar, cr), apci = _mm256_add_ps(ai, ci);
+    v8sf amcr = _mm256_sub_ps(ar, cr), amci = _mm256_sub_ps(ai, ci);
+    v8sf bpdr = _mm256_add_ps(br, dr), bpdi = _mm256_add_ps(bi, di);
+    v8sf jbmdr = _mm256_sub_ps(bi, di), jbmdi = _mm256_sub_ps(dr, br);  // -j * (b - d)
+    v8sf t1r = _mm256_add_ps(amcr, jbmdr), t1i = _mm256_add_ps(amci, jbmdi);
+    v8sf t2r = _mm256_sub_ps(apcr, bpdr), t2i = _mm256_sub_ps(apci, bpdi);
+    v8sf t3r = _mm256_sub_ps(amcr, jbmdr), t3i = _mm256_sub_ps(amci, jbmdi);
+    y[0] = _mm256_add_ps(apcr, bpdr);
+    y[1] = _mm256_add_ps(apci, bpdi);
+    y[2] = _mm256_fnmadd_ps_custom(t1i, w[1], _mm256_mul_ps(t1r, w[0]));
+    y[3] = _mm256_fmadd_ps_custom(t1r, w[1], _mm256_mul_ps(t1i, w[0]));
+    y[4] = _mm256_fnmadd_ps_custom(t2i, w[3], _mm256_mul_ps(t2r, w[2]));
+    y[5] = _mm256_fmadd_ps_custom(t2r, w[3], _mm256_mul_ps(t2i, w[2]));
+    y[6] = _mm256_fnmadd_ps_custom(t3i, w[5], _mm256_mul_ps(t3r, w[4]));
+    y[7] = _mm256_fmadd_ps_custom(t3r, w[5], _mm256_mul_ps(t3i, w[4]));
+}
+
+// dst[4i + r] = yr[i]
+static inline void fft_store4_s1_256f(float *dst, v8sf y0, v8sf y1, v8sf y2, v8sf y3)
+{
+    v8sf t0 = _mm256_unpacklo_ps(y0, y1);
+    v8sf t1 = _mm256_unpackhi_ps(y0, y1);
+    v8sf t2 = _mm256_unpacklo_ps(y2, y3);
+    v8sf t3 = _mm256_unpackhi_ps(y2, y3);
+    v8sf r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));  // points 0 and 4
+    v8sf r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));  // points 1 and 5
+    v8sf r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));  // points 2 and 6
+    v8sf r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));  // points 3 and 7
+    _mm256_storeu_ps(dst, _mm256_permute2f128_ps(r0, r1, 0x20));
+    _mm256_storeu_ps(dst + AVX_LEN_FLOAT, _mm256_permute2f128_ps(r2, r3, 0x20));
+    _mm256_storeu_ps(dst + 2 * AVX_LEN_FLOAT, _mm256_permute2f128_ps(r0, r1, 0x31));
+    _mm256_storeu_ps(dst + 3 * AVX_LEN_FLOAT, _mm256_permute2f128_ps(r2, r3, 0x31));
+}
+
+// dst[16p + 4r + q] = yr[4p + q]
+static inline void fft_store4_s4_256f(float *dst, v8sf y0, v8sf y1, v8sf y2, v8sf y3)
+{
+    _mm256_storeu_ps(dst, _mm256_permute2f128_ps(y0, y1, 0x20));
+    _mm256_storeu_ps(dst + AVX_LEN_FLOAT, _mm256_permute2f128_ps(y2, y3, 0x20));
+    _mm256_storeu_ps(dst + 2 * AVX_LEN_FLOAT, _mm256_permute2f128_ps(y0, y1, 0x31));
+    _mm256_storeu_ps(dst + 3 * AVX_LEN_FLOAT, _mm256_permute2f128_ps(y2, y3, 0x31));
+}
+
+
+static inline v8sf fft_reverse256f(v8sf a)
+{
+    a = _mm256_permute2f128_ps(a, a, 0x01);
+    return _mm256_permute_ps(a, _MM_SHUFFLE(0, 1, 2, 3));
+}
+
+static inline void fft_radix4_stage256f(const fft_plan32_t *plan, int s, const float *xr, const float *xi, float *yr, float *yi)
+{
+    int n4 = plan->n / 4;
+    v8sf w[6], y[8];
+
+    if (s >= AVX_LEN_FLOAT) {
+        const float *tw = fft_stage_twf(plan, s);
+        for (int p = 0; p < n4 / s; p++) {
+            for (int r = 0; r < 6; r++)
+                w[r] = _mm256_set1_ps(tw[6 * p + r]);
+            for (int q = 0; q < s; q += AVX_LEN_FLOAT) {
+                int out = q + 4 * s * p;
+                fft_radix4_256f(xr, xi, q + s * p, n4, w, y);
+                for (int r = 0; r < 4; r++) {
+                    _mm256_storeu_ps(yr + out + r * s, y[2 * r]);
+                    _mm256_storeu_ps(yi + out + r * s, y[2 * r + 1]);
+                }
+            }
+        }
+    } else {
+        // strides smaller than a vector : twiddles per point, the 4 outputs are interleaved by chunks of s
+        const float *twx = plan->twx + ((s == 1) ? 0 : 6 * n4);
+        for (int idx = 0; idx < n4; idx += AVX_LEN_FLOAT) {
+            for (int r = 0; r < 6; r++)
+                w[r] = _mm256_loadu_ps(twx + r * n4 + idx);
+            fft_radix4_256f(xr, xi, idx, n4, w, y);
+            for (int r = 0; r < 2; r++) {
+                if (s == 1)
+                    fft_store4_s1_256f((r ? yi : yr) + 4 * idx, y[r], y[2 + r], y[4 + r], y[6 + r]);
+                else
+                    fft_store4_s4_256f((r ? yi : yr) + 4 * idx, y[r], y[2 + r], y[4 + r], y[6 + r]);
+            }
+        }
+    }
+}
+
+// last stage when log2(n) is odd, stride n/2 and no twiddles
+static inline void fft_radix2_stage256f(int n, const float *xr, const float *xi, float *yr, float *yi)
+{
+    int n2 = n / 2;
+    for (int q = 0; q < n2; q += AVX_LEN_FLOAT) {
+        v8sf ar = _mm256_loadu_ps(xr + q), ai = _mm256_loadu_ps(xi + q);
+        v8sf br = _mm256_loadu_ps(xr + q + n2), bi = _mm256_loadu_ps(xi + q + n2);
+        _mm256_storeu_ps(yr + q, _mm256_add_ps(ar, br));
+        _mm256_storeu_ps(yi + q, _mm256_add_ps(ai, bi));
+        _mm256_storeu_ps(yr + q + n2, _mm256_sub_ps(ar, br));
+        _mm256_storeu_ps(yi + q + n2, _mm256_sub_ps(ai, bi));
+    }
+}
+
+static inline void fft_split_core256f(const fft_plan32_t *plan, float *srcRe, float *srcIm, float *dstRe, float *dstIm)
+{
+    int n = plan->n;
+    if ((n / 4) < AVX_LEN_FLOAT) {
+        fft_split_coref_C(plan, srcRe, srcIm, dstRe, dstIm);
+        return;
+    }
+
+    int nb_stages = plan->log2n / 2 + (plan->log2n & 1);
+    float *xr = srcRe, *xi = srcIm;
+    int s = 1;
+    for (int stage = 0; stage < nb_stages; stage++) {
+        float *yr = fft_stage_outf(plan, stage, nb_stages, dstRe);
+        float *yi = (yr == dstRe) ? dstIm : yr + n;
+        if (s < n / 2 || !(plan->log2n & 1)) {
+            fft_radix4_stage256f(plan, s, xr, xi, yr, yi);
+            s *= 4;
+        } else {
+            fft_radix2_stage256f(n, xr, xi, yr, yi);
+        }
+        xr = yr;
+        xi = yi;
+    }
+}
+
+SIMD_UTILS_API void fft256f_split(fft_plan32_t *plan, float *srcRe, float *srcIm, float *dstRe, float *dstIm)
+{
+    fft_split_core256f(plan, srcRe, srcIm, dstRe, dstIm);
+}
+
+SIMD_UTILS_API void ifft256f_split(fft_plan32_t *plan, float *srcRe, float *srcIm, float *dstRe, float *dstIm)
+{
+    fft_split_core256f(plan, srcIm, srcRe, dstIm, dstRe);
+}
+
+SIMD_UTILS_API void fft256f(fft_plan32_t *plan, complex32_t *src, complex32_t *dst)
+{
+    float *re = plan->work + 4 * plan->n;
+    float *im = re + plan->n;
+    cplxtoreal256f(src, re, im, plan->n);
+    fft_split_core256f(plan, re, im, re, im);
+    realtocplx256f(re, im, dst, plan->n);
+}
+
+SIMD_UTILS_API void ifft256f(fft_plan32_t *plan, complex32_t *src, complex32_t *dst)
+{
+    float *re = plan->work + 4 * plan->n;
+    float *im = re + plan->n;
+    cplxtoreal256f(src, re, im, plan->n);
+    fft_split_core256f(plan, im, re, im, re);
+    realtocplx256f(re, im, dst, plan->n);
+}
+
+// src has plan->real_n points, dst the plan->real_n / 2 + 1 first bins
+SIMD_UTILS_API void rfft256f(fft_plan32_t *plan, float *src, complex32_t *dst)
+{
+    int n = plan->n;
+    float *re = plan->work + 4 * n;
+    float *im = re + n;
+    cplxtoreal256f((complex32_t *) src, re, im, n);
+    fft_split_core256f(plan, re, im, re, im);
+
+    v8sf half = _mm256_set1_ps(0.5f);
+    int k = 1;
+    for (; (k + AVX_LEN_FLOAT) <= n; k += AVX_LEN_FLOAT) {
+        v8sf a = _mm256_loadu_ps(re + k), b = _mm256_loadu_ps(im + k);
+        v8sf c = fft_reverse256f(_mm256_loadu_ps(re + n - k - AVX_LEN_FLOAT + 1));
+        v8sf d = fft_reverse256f(_mm256_loadu_ps(im + n - k - AVX_LEN_FLOAT + 1));
+        v8sf wr = _mm256_loadu_ps(plan->rtw + k), wi = _mm256_loadu_ps(plan->rtw + n + k);
+        v8sf hs = _mm256_add_ps(a, c), hd = _mm256_sub_ps(b, d);
+        v8sf fr = _mm256_add_ps(b, d), fi = _mm256_sub_ps(c, a);
+        v8sfx2 out;
+        out.val[0] = _mm256_mul_ps(half, _mm256_fnmadd_ps_custom(wi, fi, _mm256_fmadd_ps_custom(wr, fr, hs)));
+        out.val[1] = _mm256_mul_ps(half, _mm256_fmadd_ps_custom(wi, fr, _mm256_fmadd_ps_custom(wr, fi, hd)));
+        _mm256_store2u_ps((float *) (dst + k), out);
+    }
+    rfft_postf_C(plan, re, im, dst, k);
+}
+
+// src has the plan->real_n / 2 + 1 first bins, dst plan->real_n points, not normalized
+SIMD_UTILS_API void irfft256f(fft_plan32_t *plan, complex32_t *src, float *dst)
+{
+    int n = plan->n;
+    float *re = plan->work + 4 * n;
+    float *im = re + n;
+
+    int k = 0;
+    for (; (k + AVX_LEN_FLOAT) <= n; k += AVX_LEN_FLOAT) {
+        v8sfx2 x = _mm256_load2u_ps((float *) (src + k));
+        v8sfx2 xc = _mm256_load2u_ps((float *) (src + n - k - AVX_LEN_FLOAT + 1));
+        v8sf c = fft_reverse256f(xc.val[0]), d = fft_reverse256f(xc.val[1]);
+        v8sf wr = _mm256_loadu_ps(plan->rtw + k), wi = _mm256_loadu_ps(plan->rtw + n + k);
+        v8sf amc = _mm256_sub_ps(x.val[0], c), bpd = _mm256_add_ps(x.val[1], d);
+        v8sf zr = _mm256_fnmadd_ps_custom(bpd, wr, _mm256_add_ps(x.val[0], c));
+        v8sf zi = _mm256_fmadd_ps_custom(amc, wr, _mm256_sub_ps(x.val[1], d));
+        _mm256_storeu_ps(re + k, _mm256_fmadd_ps_custom(amc, wi, zr));
+        _mm256_storeu_ps(im + k, _mm256_fmadd_ps_custom(bpd, wi, zi));
+    }
+    irfft_pref_C(plan, src, re, im, k);
+
+    fft_split_core256f(plan, im, re, im, re);
+    realtocplx256f(re, im, (complex32_t *) dst, n);
+}
+
+/* FIR filters (see simd_utils_fir.h) */
+
+// dst[i] = (dst[i] if accumulate) + sum_m taps[m] * src[i + m]
+// 8 vectors of outputs per pass on the taps, enough independent FMAs to hide their latency
+static inline void fir_kernel256f(const float *taps, int nb_taps, const float *src, float *dst, int len, int accumulate)
+{
+    int i = 0;
+    for (; (i + 8 * AVX_LEN_FLOAT) <= len; i += 8 * AVX_LEN_FLOAT) {
+        v8sf acc[8];
+        for (int k = 0; k < 8; k++)
+            acc[k] = accumulate ? _mm256_loadu_ps(dst + i + k * AVX_LEN_FLOAT) : _mm256_setzero_ps();
+        const float *s = src + i;
+        int m = 0;
+        /* 4 taps spaced by one vector per step : the vectors loaded for a tap are reused
+         * by the next ones (11 loads for 32 FMAs instead of one load per FMA) */
+        for (; (m + 4 * AVX_LEN_FLOAT) <= nb_taps; m += 4 * AVX_LEN_FLOAT) {
+            for (int r = 0; r < AVX_LEN_FLOAT; r++) {
+                const float *b = s + m + r;
+                v8sf tap[4], in[11];
+                for (int g = 0; g < 4; g++)
+                    tap[g] = _mm256_set1_ps(taps[m + r + g * AVX_LEN_FLOAT]);
+                for (int k = 0; k < 11; k++)
+                    in[k] = _mm256_loadu_ps(b + k * AVX_LEN_FLOAT);
+                for (int k = 0; k < 8; k++) {
+                    acc[k] = _mm256_fmadd_ps_custom(tap[0], in[k], acc[k]);
+                    acc[k] = _mm256_fmadd_ps_custom(tap[1], in[k + 1], acc[k]);
+                    acc[k] = _mm256_fmadd_ps_custom(tap[2], in[k + 2], acc[k]);
+                    acc[k] = _mm256_fmadd_ps_custom(tap[3], in[k + 3], acc[k]);
+                }
+            }
+        }
+        for (; m < nb_taps; m++) {
+            v8sf tap = _mm256_set1_ps(taps[m]);
+            acc[0] = _mm256_fmadd_ps_custom(tap, _mm256_loadu_ps(s + m), acc[0]);
+            acc[1] = _mm256_fmadd_ps_custom(tap, _mm256_loadu_ps(s + m + AVX_LEN_FLOAT), acc[1]);
+            acc[2] = _mm256_fmadd_ps_custom(tap, _mm256_loadu_ps(s + m + 2 * AVX_LEN_FLOAT), acc[2]);
+            acc[3] = _mm256_fmadd_ps_custom(tap, _mm256_loadu_ps(s + m + 3 * AVX_LEN_FLOAT), acc[3]);
+            acc[4] = _mm256_fmadd_ps_custom(tap, _mm256_loadu_ps(s + m + 4 * AVX_LEN_FLOAT), acc[4]);
+            acc[5] = _mm256_fmadd_ps_custom(tap, _mm256_loadu_ps(s + m + 5 * AVX_LEN_FLOAT), acc[5]);
+            acc[6] = _mm256_fmadd_ps_custom(tap, _mm256_loadu_ps(s + m + 6 * AVX_LEN_FLOAT), acc[6]);
+            acc[7] = _mm256_fmadd_ps_custom(tap, _mm256_loadu_ps(s + m + 7 * AVX_LEN_FLOAT), acc[7]);
+        }
+        for (int k = 0; k < 8; k++)
+            _mm256_storeu_ps(dst + i + k * AVX_LEN_FLOAT, acc[k]);
+    }
+
+    for (; (i + AVX_LEN_FLOAT) <= len; i += AVX_LEN_FLOAT) {
+        v8sf acc = accumulate ? _mm256_loadu_ps(dst + i) : _mm256_setzero_ps();
+        for (int m = 0; m < nb_taps; m++)
+            acc = _mm256_fmadd_ps_custom(_mm256_set1_ps(taps[m]), _mm256_loadu_ps(src + i + m), acc);
+        _mm256_storeu_ps(dst + i, acc);
+    }
+
+    if (i < len)
+        fir_kernelf_C(taps, nb_taps, src + i, dst + i, len - i, accumulate);
+}
+
+// complex taps (real parts then imaginary parts) on interleaved complex samples
+static inline void fir_kernel256f_cplx(const float *taps, int nb_taps, const float *src, float *dst, int len, int accumulate)
+{
+    const float *taps_im = taps + nb_taps;
+    int i = 0;
+    // dst = sum taps_re * src + j * sum taps_im * src
+    for (; (i + AVX_LEN_FLOAT) <= len; i += AVX_LEN_FLOAT) {
+        v8sf re0 = _mm256_setzero_ps(), re1 = _mm256_setzero_ps();
+        v8sf im0 = _mm256_setzero_ps(), im1 = _mm256_setzero_ps();
+        const float *s = src + 2 * i;
+        for (int m = 0; m < nb_taps; m++) {
+            v8sf tap_re = _mm256_set1_ps(taps[m]);
+            v8sf tap_im = _mm256_set1_ps(taps_im[m]);
+            v8sf s0 = _mm256_loadu_ps(s + 2 * m);
+            v8sf s1 = _mm256_loadu_ps(s + 2 * m + AVX_LEN_FLOAT);
+            re0 = _mm256_fmadd_ps_custom(tap_re, s0, re0);
+            re1 = _mm256_fmadd_ps_custom(tap_re, s1, re1);
+            im0 = _mm256_fmadd_ps_custom(tap_im, s0, im0);
+            im1 = _mm256_fmadd_ps_custom(tap_im, s1, im1);
+        }
+        v8sf out0 = _mm256_addsub_ps(re0, _mm256_permute_ps(im0, _MM_SHUFFLE(2, 3, 0, 1)));
+        v8sf out1 = _mm256_addsub_ps(re1, _mm256_permute_ps(im1, _MM_SHUFFLE(2, 3, 0, 1)));
+        if (accumulate) {
+            out0 = _mm256_add_ps(out0, _mm256_loadu_ps(dst + 2 * i));
+            out1 = _mm256_add_ps(out1, _mm256_loadu_ps(dst + 2 * i + AVX_LEN_FLOAT));
+        }
+        _mm256_storeu_ps(dst + 2 * i, out0);
+        _mm256_storeu_ps(dst + 2 * i + AVX_LEN_FLOAT, out1);
+    }
+
+    if (i < len)
+        fir_kernelf_cplx_C(taps, nb_taps, src + 2 * i, dst + 2 * i, len - i, accumulate);
+}
+
+// returns the number of outputs, -1 if fir is a complex filter
+SIMD_UTILS_API int fir256f(fir32_t *fir, float *src, float *dst, int len)
+{
+    if (fir->cplx)
+        return -1;
+    return fir_runf(fir, fir_kernel256f, src, NULL, dst, NULL, len);
+}
+
+SIMD_UTILS_API int fir256f_cplx(fir32_t *fir, complex32_t *src, complex32_t *dst, int len)
+{
+    if (!fir->cplx)
+        return -1;
+    return fir_runf(fir, fir_kernel256f_cplx, (float *) src, NULL, (float *) dst, NULL, len);
+}
+
+SIMD_UTILS_API int fir256f_split(fir32_t *fir, float *srcRe, float *srcIm, float *dstRe, float *dstIm, int len)
+{
+    if (!fir->cplx)
+        return -1;
+    return fir_runf(fir, fir_kernel256f_cplx, srcRe, srcIm, dstRe, dstIm, len);
+}
+
+/* IIR filters (see simd_utils_iir.h) */
+
+// channels c0 to c0 + AVX_LEN_FLOAT - 1, filtered in lockstep
+static inline void iir_lanes256f(iir32_t *iir, int c0, const float *src, float *dst, int len)
+{
+    int C = iir->nb_channels;
+    int S = iir->stride;
+    for (int i = 0; i < len; i++) {
+        v8sf x = _mm256_loadu_ps(src + (size_t) i * C + c0);
+        for (int s = 0; s < iir->nb_stages; s++) {
+            const float *c = iir->coefs + (size_t) s * 5 * S + c0;
+            float *z = iir->state + (size_t) s * 2 * S + c0;
+            v8sf y = _mm256_fmadd_ps_custom(_mm256_load_ps(c), x, _mm256_load_ps(z));
+            v8sf z1 = _mm256_fmadd_ps_custom(_mm256_load_ps(c + S), x, _mm256_load_ps(z + S));
+            v8sf z2 = _mm256_mul_ps(_mm256_load_ps(c + 2 * S), x);
+            _mm256_store_ps(z, _mm256_fnmadd_ps_custom(_mm256_load_ps(c + 3 * S), y, z1));
+            _mm256_store_ps(z + S, _mm256_fnmadd_ps_custom(_mm256_load_ps(c + 4 * S), y, z2));
+            x = y;
+        }
+        _mm256_storeu_ps(dst + (size_t) i * C + c0, x);
+    }
+}
+
+/* one channel in the block state space form, blocks of AVX_LEN_FLOAT frames,
+ * every stage of a block before the next block */
+static inline void iir_ss_kernel256f(iir32_t *iir, int channel, const float *src, float *dst, int len)
+{
+    int C = iir->stride;
+    int i = 0;
+    for (; (i + AVX_LEN_FLOAT) <= len; i += AVX_LEN_FLOAT) {
+        for (int s = 0; s < iir->nb_stages; s++) {
+            const float *x = (s ? dst : src) + i;
+            const float *m = iir32_ss(iir, s, channel);
+            const float *z = iir->state + (size_t) s * 2 * C + channel;
+            float x1 = x[AVX_LEN_FLOAT - 1], x2 = x[AVX_LEN_FLOAT - 2];
+            // D * x, by columns
+            v8sf acc0 = _mm256_mul_ps(_mm256_load_ps(m), _mm256_set1_ps(x[0]));
+            v8sf acc1 = _mm256_mul_ps(_mm256_load_ps(m + IIR_SS_LEN), _mm256_set1_ps(x[1]));
+            for (int j = 2; j < AVX_LEN_FLOAT; j += 2) {
+                acc0 = _mm256_fmadd_ps_custom(_mm256_load_ps(m + j * IIR_SS_LEN), _mm256_set1_ps(x[j]), acc0);
+                acc1 = _mm256_fmadd_ps_custom(_mm256_load_ps(m + (j + 1) * IIR_SS_LEN), _mm256_set1_ps(x[j + 1]), acc1);
+            }
+            // + c1 * z1 + c2 * z2
+            v8sf y = _mm256_fmadd_ps_custom(_mm256_load_ps(m + IIR_SS_LEN * IIR_SS_LEN), _mm256_set1_ps(z[0]), _mm256_add_ps(acc0, acc1));
+            y = _mm256_fmadd_ps_custom(_mm256_load_ps(m + (IIR_SS_LEN + 1) * IIR_SS_LEN), _mm256_set1_ps(z[C]), y);
+            _mm256_storeu_ps(dst + i, y);
+            iir_ss_update(iir, s, channel, x1, x2, dst[i + AVX_LEN_FLOAT - 1], dst[i + AVX_LEN_FLOAT - 2]);
+        }
+    }
+
+    if (i < len) {
+        for (int s = 0; s < iir->nb_stages; s++)
+            iir_biquadf_C(iir, s, channel, (s ? dst : src) + i, dst + i, len - i, 1);
+    }
+}
+
+/* len frames of nb_channels interleaved channels, src and dst can be the same array.
+ * Groups of channels are filtered in lockstep, the remaining ones (or a single
+ * channel) in the block state space form. */
+SIMD_UTILS_API void iir256f(iir32_t *iir, float *src, float *dst, int len)
+{
+    int C = iir->nb_channels;
+    int c = 0;
+    if (C > 1) {
+        for (; (c + AVX_LEN_FLOAT) <= C; c += AVX_LEN_FLOAT)
+            iir_lanes256f(iir, c, src, dst, len);
+    }
+    for (; c < C; c++)
+        iir_ss_runf(iir, iir_ss_kernel256f, c, src, dst, len);
+}
+
+/* Convolutions (see simd_utils_conv.h) */
+
+static inline void conv_block256f(conv32_t *conv)
+{
+    if (conv->cplx) {
+        fft256f(conv->plan, (complex32_t *) conv->buf, (complex32_t *) conv->work);
+        cplxvecmul256f((complex32_t *) conv->work, (complex32_t *) conv->spectrum, (complex32_t *) conv->out, conv->fft_len);
+        ifft256f(conv->plan, (complex32_t *) conv->out, (complex32_t *) conv->out);
+    } else {
+        rfft256f(conv->plan, conv->buf, (complex32_t *) conv->work);
+        cplxvecmul256f((complex32_t *) conv->work, (complex32_t *) conv->spectrum, (complex32_t *) conv->out, conv->fft_len / 2 + 1);
+        irfft256f(conv->plan, (complex32_t *) conv->out, conv->out);
+    }
+}
+
+// returns len, -1 if conv is a complex convolution
+SIMD_UTILS_API int conv256f(conv32_t *conv, float *src, float *dst, int len)
+{
+    if (conv->cplx)
+        return -1;
+    return conv_runf(conv, fir_kernel256f, conv_block256f, src, dst, len);
+}
+
+SIMD_UTILS_API int conv256f_cplx(conv32_t *conv, complex32_t *src, complex32_t *dst, int len)
+{
+    if (!conv->cplx)
+        return -1;
+    return conv_runf(conv, fir_kernel256f_cplx, conv_block256f, (float *) src, (float *) dst, len);
+}
+
+// first index of value in src, len if it is not found
+static inline int firsteq256f(float *src, int len, float value)
+{
+    int stop_len = len / (2 * AVX_LEN_FLOAT);
+    stop_len *= (2 * AVX_LEN_FLOAT);
+
+    v8sf value_v = _mm256_set1_ps(value);
+    for (int i = 0; i < stop_len; i += 2 * AVX_LEN_FLOAT) {
+        uint32_t mask = (uint32_t) _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(src + i), value_v, _CMP_EQ_OQ));
+        mask |= (uint32_t) _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(src + i + AVX_LEN_FLOAT), value_v, _CMP_EQ_OQ)) << 8;
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+    for (int i = stop_len; i < len; i++) {
+        if (src[i] == value)
+            return i;
+    }
+    return len;
+}
+
+SIMD_UTILS_API void maxloc256f(float *src, float *max, int *idx, int len)
+{
+    minmaxloc_runf(src, len, minmax256f, firsteq256f, NULL, NULL, max, idx);
+}
+
+SIMD_UTILS_API void minloc256f(float *src, float *min, int *idx, int len)
+{
+    minmaxloc_runf(src, len, minmax256f, firsteq256f, min, idx, NULL, NULL);
+}
+
+SIMD_UTILS_API void minmaxloc256f(float *src, int len, float *min_value, int *min_idx, float *max_value, int *max_idx)
+{
+    minmaxloc_runf(src, len, minmax256f, firsteq256f, min_value, min_idx, max_value, max_idx);
+}
@@ -10,7 +10,7 @@
 #include "immintrin.h"
 
 #ifdef __AVX2__
-static inline void add256s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+SIMD_UTILS_API void add256s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
 {
     int stop_len = len / AVX_LEN_INT32;
     stop_len *= AVX_LEN_INT32;
@@ -33,7 +33,7 @@ static inline void add256s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
 }
 
 // Works only for Integers stored on 32bits smaller than 16bits
-static inline void mul256s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+SIMD_UTILS_API void mul256s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
 {
     int stop_len = len / (2 * AVX_LEN_INT32);
     stop_len *= (2 * AVX_LEN_INT32);
@@ -67,7 +67,7 @@ static inline void mul256s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
     }
 }
 
-static inline void sub256s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+SIMD_UTILS_API void sub256s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
 {
     int stop_len = len / AVX_LEN_INT32;
     stop_len *= AVX_LEN_INT32;
@@ -89,7 +89,7 @@ static inline void sub256s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
     }
 }
 
-static inline void addc256s(int32_t *src, int32_t value, int32_t *dst, int len)
+SIMD_UTILS_API void addc256s(int32_t *src, int32_t value, int32_t *dst, int len)
 {
     int stop_len = len / AVX_LEN_INT32;
     stop_len *= AVX_LEN_INT32;
@@ -111,7 +111,7 @@ static inline void addc256s(int32_t *src, int32_t value, int32_t *dst, int len)
     }
 }
 
-static inline void vectorSlope256s(int *dst, int len, int offset, int slope)
+SIMD_UTILS_API void vectorSlope256s(int *dst, int len, int offset, int slope)
 {
     v8si coef = _mm256_set_epi32(7 * slope, 6 * slope, 5 * slope, 4 * slope, 3 * slope, 2 * slope, slope, 0);
     v8si slope16_vec = _mm256_set1_epi32(16 * slope);
@@ -154,7 +154,7 @@ static inline void vectorSlope256s(int *dst, int len, int offset, int slope)
 
 // Experimental
 
-static inline void copy256s(int32_t *src, int32_t *dst, int len)
+SIMD_UTILS_API void copy256s(int32_t *src, int32_t *dst, int len)
 {
     int stop_len = len / AVX_LEN_INT32;
     stop_len *= AVX_LEN_INT32;
@@ -179,7 +179,7 @@ static inline void copy256s(int32_t *src, int32_t *dst, int len)
     }
 }
 
-static inline void copy256s_2(int32_t *src, int32_t *dst, int len)
+SIMD_UTILS_API void copy256s_2(int32_t *src, int32_t *dst, int len)
 {
     int stop_len = len / (2 * AVX_LEN_INT32);
     stop_len *= (2 * AVX_LEN_INT32);
@@ -213,29 +213,41 @@ static inline void copy256s_2(int32_t *src, int32_t *dst, int len)
     }
 }
 
-static inline void fast_copy256s(int32_t *src, int32_t *dst, int len)
+SIMD_UTILS_API void fast_copy256s(int32_t *src, int32_t *dst, int len)
 {
-    /*int stop_len = len / AVX_LEN_INT32;
+    // the streaming loads and stores need aligned pointers
+    if (!areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        copy256s(src, dst, len);
+        return;
+    }
+
+    int stop_len = len / AVX_LEN_INT32;
     stop_len *= AVX_LEN_INT32;
 
 #ifdef OMP
 #pragma omp parallel for schedule(auto)
 #endif
     for (int i = 0; i < stop_len; i += AVX_LEN_INT32) {
-        _mm256_stream_si256((__m256i *) (dst + i), _mm256_stream_load_si256((__m256i *) (src + i)));
+        __m256i tmp1 = _mm256_stream_load_si256((__m256i *) (src + i));
+        _mm256_stream_si256((__m256i *) (dst + i), tmp1);
     }
-    _mm_mfence();
+    _mm_sfence();
 
     for (int i = stop_len; i < len; i++) {
         dst[i] = src[i];
     }
-	*/
 }
 
 
-static inline void fast_copy256s_2(int32_t *src, int32_t *dst, int len)
+SIMD_UTILS_API void fast_copy256s_2(int32_t *src, int32_t *dst, int len)
 {
-    /*int stop_len = len / (2 * AVX_LEN_INT32);
+    // the streaming loads and stores need aligned pointers
+    if (!areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        copy256s(src, dst, len);
+        return;
+    }
+
+    int stop_len = len / (2 * AVX_LEN_INT32);
     stop_len *= (2 * AVX_LEN_INT32);
 
 #ifdef OMP
@@ -247,16 +259,22 @@ static inline void fast_copy256s_2(int32_t *src, int32_t *dst, int len)
         _mm256_stream_si256((__m256i *) (dst + i), tmp1);
         _mm256_stream_si256((__m256i *) (dst + i + AVX_LEN_INT32), tmp2);
     }
-    _mm_mfence();
+    _mm_sfence();
 
     for (int i = stop_len; i < len; i++) {
         dst[i] = src[i];
-    }*/
+    }
 }
 
-static inline void fast_copy256s_4(int32_t *src, int32_t *dst, int len)
+SIMD_UTILS_API void fast_copy256s_4(int32_t *src, int32_t *dst, int len)
 {
-    /*int stop_len = len / (4 * AVX_LEN_INT32);
+    // the streaming loads and stores need aligned pointers
+    if (!areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        copy256s(src, dst, len);
+        return;
+    }
+
+    int stop_len = len / (4 * AVX_LEN_INT32);
     stop_len *= (4 * AVX_LEN_INT32);
 
 #ifdef OMP
@@ -272,11 +290,11 @@ static inline void fast_copy256s_4(int32_t *src, int32_t *dst, int len)
         _mm256_stream_si256((__m256i *) (dst + i + 2 * AVX_LEN_INT32), tmp3);
         _mm256_stream_si256((__m256i *) (dst + i + 3 * AVX_LEN_INT32), tmp4);
     }
-    _mm_mfence();
+    _mm_sfence();
 
     for (int i = stop_len; i < len; i++) {
         dst[i] = src[i];
-    }*/
+    }
 }
 
 static inline __m256i _mm256_absdiff_epi16(__m256i a, __m256i b)
@@ -324,7 +342,7 @@ static inline __m256i _mm256_absdiff_epi8(__m256i a, __m256i b)
 #endif
 }
 
-static inline void absdiff16s_256s(int16_t *src1, int16_t *src2, int16_t *dst, int len)
+SIMD_UTILS_API void absdiff16s_256s(int16_t *src1, int16_t *src2, int16_t *dst, int len)
 {
     int stop_len = len / AVX_LEN_INT16;
     stop_len *= AVX_LEN_INT16;
@@ -349,157 +367,172 @@ static inline void absdiff16s_256s(int16_t *src1, int16_t *src2, int16_t *dst, i
     }
 }
 
-static inline void powerspect16s_256s_interleaved(complex16s_t *src, int32_t *dst, int len)
+SIMD_UTILS_API void addsat16s_256s(int16_t *src1, int16_t *src2, int16_t *dst, int len)
 {
-    int stop_len = len / AVX_LEN_INT32;
-    stop_len *= AVX_LEN_INT32;
+    int stop_len = len / (2 * AVX_LEN_INT16);
+    stop_len *= (2 * AVX_LEN_INT16);
 
-    int j = 0;
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX_LEN_INT32) {
-            __m256i reim = _mm256_load_si256((__m256i *) ((const int16_t *) src + j));
-            // print8i(reim); printf("\n");
-            _mm256_store_si256((__m256i *) (dst + i), _mm256_madd_epi16(reim, reim));
-            j += AVX_LEN_INT16;
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT16) {
+            v8si a = _mm256_load_si256((__m256i *) (src1 + i));
+            v8si b = _mm256_load_si256((__m256i *) (src2 + i));
+            v8si a2 = _mm256_load_si256((__m256i *) (src1 + i + AVX_LEN_INT16));
+            v8si b2 = _mm256_load_si256((__m256i *) (src2 + i + AVX_LEN_INT16));
+            v8si res = _mm256_adds_epi16(a, b);
+            v8si res2 = _mm256_adds_epi16(a2, b2);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT16), res2);
         }
     } else {
-        for (int i = 0; i < stop_len; i += AVX_LEN_INT32) {
-            __m256i reim = _mm256_loadu_si256((__m256i *) ((const int16_t *) src + j));
-            _mm256_storeu_si256((__m256i *) (dst + i), _mm256_madd_epi16(reim, reim));
-            j += AVX_LEN_INT16;
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT16) {
+            v8si a = _mm256_loadu_si256((__m256i *) (src1 + i));
+            v8si b = _mm256_loadu_si256((__m256i *) (src2 + i));
+            v8si a2 = _mm256_loadu_si256((__m256i *) (src1 + i + AVX_LEN_INT16));
+            v8si b2 = _mm256_loadu_si256((__m256i *) (src2 + i + AVX_LEN_INT16));
+            v8si res = _mm256_adds_epi16(a, b);
+            v8si res2 = _mm256_adds_epi16(a2, b2);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT16), res2);
         }
     }
 
     for (int i = stop_len; i < len; i++) {
-        dst[i] = (int32_t) src[i].re * (int32_t) src[i].re + (int32_t) src[i].im * (int32_t) src[i].im;
+        int32_t tmp = (int32_t) src1[i] + (int32_t) src2[i];
+        dst[i] = (int16_t) (tmp > INT16_MAX ? INT16_MAX : (tmp < INT16_MIN ? INT16_MIN : tmp));
     }
 }
 
-static inline void sum16s32s256(int16_t *src, int len, int32_t *dst, int scale_factor)
+SIMD_UTILS_API void subsat16s_256s(int16_t *src1, int16_t *src2, int16_t *dst, int len)
 {
-    int stop_len = len / (4 * AVX_LEN_INT16);
-    stop_len *= (4 * AVX_LEN_INT16);
-
-    __attribute__((aligned(AVX_LEN_BYTES))) int32_t accumulate[AVX_LEN_INT32] = {0, 0, 0, 0,
-                                                                                 0, 0, 0, 0};
-    int32_t tmp_acc = 0;
-    int16_t scale = 1 << scale_factor;
-    v8si one = _mm256_set1_epi16(1);
-    v8si vec_acc1 = _mm256_setzero_si256();  // initialize the vector accumulator
-    v8si vec_acc2 = _mm256_setzero_si256();  // initialize the vector accumulator
+    int stop_len = len / (2 * AVX_LEN_INT16);
+    stop_len *= (2 * AVX_LEN_INT16);
 
-    if (isAligned((uintptr_t) (src), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 4 * AVX_LEN_INT16) {
-            v8si vec_src_tmp = _mm256_load_si256((__m256i *) ((const int16_t *) src + i));
-            v8si vec_src_tmp2 = _mm256_load_si256((__m256i *) ((const int16_t *) src + i + AVX_LEN_INT16));
-            v8si vec_src_tmp3 = _mm256_load_si256((__m256i *) ((const int16_t *) src + i + 2 * AVX_LEN_INT16));
-            v8si vec_src_tmp4 = _mm256_load_si256((__m256i *) ((const int16_t *) src + i + 3 * AVX_LEN_INT16));
-            vec_src_tmp = _mm256_madd_epi16(vec_src_tmp, one);
-            vec_src_tmp2 = _mm256_madd_epi16(vec_src_tmp2, one);
-            vec_src_tmp3 = _mm256_madd_epi16(vec_src_tmp3, one);
-            vec_src_tmp4 = _mm256_madd_epi16(vec_src_tmp4, one);
-            vec_src_tmp = _mm256_add_epi32(vec_src_tmp, vec_src_tmp2);
-            vec_src_tmp3 = _mm256_add_epi32(vec_src_tmp3, vec_src_tmp4);
-            vec_acc1 = _mm256_add_epi32(vec_src_tmp, vec_acc1);
-            vec_acc2 = _mm256_add_epi32(vec_src_tmp3, vec_acc2);
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT16) {
+            v8si a = _mm256_load_si256((__m256i *) (src1 + i));
+            v8si b = _mm256_load_si256((__m256i *) (src2 + i));
+            v8si a2 = _mm256_load_si256((__m256i *) (src1 + i + AVX_LEN_INT16));
+            v8si b2 = _mm256_load_si256((__m256i *) (src2 + i + AVX_LEN_INT16));
+            v8si res = _mm256_subs_epi16(a, b);
+            v8si res2 = _mm256_subs_epi16(a2, b2);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT16), res2);
         }
     } else {
-        for (int i = 0; i < stop_len; i += 4 * AVX_LEN_INT16) {
-            v8si vec_src_tmp = _mm256_loadu_si256((__m256i *) ((const int16_t *) src + i));
-            v8si vec_src_tmp2 = _mm256_loadu_si256((__m256i *) ((const int16_t *) src + i + AVX_LEN_INT16));
-            v8si vec_src_tmp3 = _mm256_loadu_si256((__m256i *) ((const int16_t *) src + i + 2 * AVX_LEN_INT16));
-            v8si vec_src_tmp4 = _mm256_loadu_si256((__m256i *) ((const int16_t *) src + i + 3 * AVX_LEN_INT16));
-            vec_src_tmp = _mm256_madd_epi16(vec_src_tmp, one);
-            vec_src_tmp2 = _mm256_madd_epi16(vec_src_tmp2, one);
-            vec_src_tmp3 = _mm256_madd_epi16(vec_src_tmp3, one);
-            vec_src_tmp4 = _mm256_madd_epi16(vec_src_tmp4, one);
-            vec_src_tmp = _mm256_add_epi32(vec_src_tmp, vec_src_tmp2);
-            vec_src_tmp3 = _mm256_add_epi32(vec_src_tmp3, vec_src_tmp4);
-            vec_acc1 = _mm256_add_epi32(vec_src_tmp, vec_acc1);
-            vec_acc2 = _mm256_add_epi32(vec_src_tmp3, vec_acc2);
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT16) {
+            v8si a = _mm256_loadu_si256((__m256i *) (src1 + i));
+            v8si b = _mm256_loadu_si256((__m256i *) (src2 + i));
+            v8si a2 = _mm256_loadu_si256((__m256i *) (src1 + i + AVX_LEN_INT16));
+            v8si b2 = _mm256_loadu_si256((__m256i *) (src2 + i + AVX_LEN_INT16));
+            v8si res = _mm256_subs_epi16(a, b);
+            v8si res2 = _mm256_subs_epi16(a2, b2);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT16), res2);
         }
     }
 
-    vec_acc1 = _mm256_add_epi32(vec_acc1, vec_acc2);
-    _mm256_store_si256((v8si *) accumulate, vec_acc1);
-
     for (int i = stop_len; i < len; i++) {
-        tmp_acc += (int32_t) src[i];
+        int32_t tmp = (int32_t) src1[i] - (int32_t) src2[i];
+        dst[i] = (int16_t) (tmp > INT16_MAX ? INT16_MAX : (tmp < INT16_MIN ? INT16_MIN : tmp));
     }
-
-    tmp_acc = tmp_acc + accumulate[0] + accumulate[1] + accumulate[2] + accumulate[3] +
-              accumulate[4] + accumulate[5] + accumulate[6] + accumulate[7];
-    tmp_acc /= scale;
-    *dst = tmp_acc;
 }
 
-static inline void flip256s(int32_t *src, int32_t *dst, int len)
+// high 16 bits of the 32 bits products
+SIMD_UTILS_API void mulhi16s_256s(int16_t *src1, int16_t *src2, int16_t *dst, int len)
 {
-    int stop_len = len / (2 * AVX_LEN_INT32);
-    stop_len *= (2 * AVX_LEN_INT32);
+    int stop_len = len / (2 * AVX_LEN_INT16);
+    stop_len *= (2 * AVX_LEN_INT16);
 
-    int mini = ((len - 1) < (2 * AVX_LEN_INT32)) ? (len - 1) : (2 * AVX_LEN_INT32);
-    for (int i = 0; i < mini; i++) {
-        dst[len - i - 1] = src[i];
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT16) {
+            v8si a = _mm256_load_si256((__m256i *) (src1 + i));
+            v8si b = _mm256_load_si256((__m256i *) (src2 + i));
+            v8si a2 = _mm256_load_si256((__m256i *) (src1 + i + AVX_LEN_INT16));
+            v8si b2 = _mm256_load_si256((__m256i *) (src2 + i + AVX_LEN_INT16));
+            v8si res = _mm256_mulhi_epi16(a, b);
+            v8si res2 = _mm256_mulhi_epi16(a2, b2);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT16), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT16) {
+            v8si a = _mm256_loadu_si256((__m256i *) (src1 + i));
+            v8si b = _mm256_loadu_si256((__m256i *) (src2 + i));
+            v8si a2 = _mm256_loadu_si256((__m256i *) (src1 + i + AVX_LEN_INT16));
+            v8si b2 = _mm256_loadu_si256((__m256i *) (src2 + i + AVX_LEN_INT16));
+            v8si res = _mm256_mulhi_epi16(a, b);
+            v8si res2 = _mm256_mulhi_epi16(a2, b2);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT16), res2);
+        }
     }
 
-    // Since we work in reverse we do not know for sure if destination address will be aligned
-    // Could it be improved?
-    v8si reverse_reg = _mm256_set_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = (int16_t) (((int32_t) src1[i] * (int32_t) src2[i]) >> 16);
+    }
+}
 
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst + len - AVX_LEN_INT32), AVX_LEN_BYTES)) {
-        for (int i = 2 * AVX_LEN_INT32; i < stop_len; i += 2 * AVX_LEN_INT32) {
-            v8si src_tmp = _mm256_load_si256((__m256i *) (src + i));                   // load a,b,c,d,e,f,g,h
-            v8si src_tmp2 = _mm256_load_si256((__m256i *) (src + i + AVX_LEN_INT32));  // load a,b,c,d,e,f,g,h
+// Q15 product rounded to nearest, (-1) * (-1) wraps to -1 as with pmulhrsw
+SIMD_UTILS_API void mulhrs16s_256s(int16_t *src1, int16_t *src2, int16_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_INT16);
+    stop_len *= (2 * AVX_LEN_INT16);
 
-            v8si src_tmp_flip = _mm256_permutevar8x32_epi32(src_tmp, reverse_reg);                // reverse lanes abcdefgh to hgfedcba
-            v8si src_tmp_flip2 = _mm256_permutevar8x32_epi32(src_tmp2, reverse_reg);              // reverse lanes abcdefgh to hgfedcba
-            _mm256_storeu_si256((__m256i *) (dst + len - i - AVX_LEN_INT32), src_tmp_flip);       // store the flipped vector
-            _mm256_storeu_si256((__m256i *) (dst + len - i - 2 * AVX_LEN_INT32), src_tmp_flip2);  // store the flipped vector
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT16) {
+            v8si a = _mm256_load_si256((__m256i *) (src1 + i));
+            v8si b = _mm256_load_si256((__m256i *) (src2 + i));
+            v8si a2 = _mm256_load_si256((__m256i *) (src1 + i + AVX_LEN_INT16));
+            v8si b2 = _mm256_load_si256((__m256i *) (src2 + i + AVX_LEN_INT16));
+            v8si res = _mm256_mulhrs_epi16(a, b);
+            v8si res2 = _mm256_mulhrs_epi16(a2, b2);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT16), res2);
         }
     } else {
-        for (int i = 2 * AVX_LEN_INT32; i < stop_len; i += 2 * AVX_LEN_INT32) {
-            v8si src_tmp = _mm256_loadu_si256((__m256i *) (src + i));                   // load a,b,c,d,e,f,g,h
-            v8si src_tmp2 = _mm256_loadu_si256((__m256i *) (src + i + AVX_LEN_INT32));  // load a,b,c,d,e,f,g,h
-            v8si src_tmp_flip = _mm256_permutevar8x32_epi32(src_tmp, reverse_reg);      // reverse lanes abcdefgh to hgfedcba
-            v8si src_tmp_flip2 = _mm256_permutevar8x32_epi32(src_tmp2, reverse_reg);    // reverse lanes abcdefgh to hgfedcba
-
-            _mm256_storeu_si256((__m256i *) (dst + len - i - AVX_LEN_INT32), src_tmp_flip);       // store the flipped vector
-            _mm256_storeu_si256((__m256i *) (dst + len - i - 2 * AVX_LEN_INT32), src_tmp_flip2);  // store the flipped vector
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT16) {
+            v8si a = _mm256_loadu_si256((__m256i *) (src1 + i));
+            v8si b = _mm256_loadu_si256((__m256i *) (src2 + i));
+            v8si a2 = _mm256_loadu_si256((__m256i *) (src1 + i + AVX_LEN_INT16));
+            v8si b2 = _mm256_loadu_si256((__m256i *) (src2 + i + AVX_LEN_INT16));
+            v8si res = _mm256_mulhrs_epi16(a, b);
+            v8si res2 = _mm256_mulhrs_epi16(a2, b2);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT16), res2);
         }
     }
 
     for (int i = stop_len; i < len; i++) {
-        dst[len - i - 1] = src[i];
+        dst[i] = (int16_t) ((((int32_t) src1[i] * (int32_t) src2[i] >> 14) + 1) >> 1);
     }
 }
 
-static inline void maxevery256s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+SIMD_UTILS_API void maxevery16s_256s(int16_t *src1, int16_t *src2, int16_t *dst, int len)
 {
-    int stop_len = len / (2 * AVX_LEN_INT32);
-    stop_len *= (2 * AVX_LEN_INT32);
+    int stop_len = len / (2 * AVX_LEN_INT16);
+    stop_len *= (2 * AVX_LEN_INT16);
 
     if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
-            v8si src1_tmp = _mm256_load_si256((__m256i *) ((const int32_t *) src1 + i));
-            v8si src2_tmp = _mm256_load_si256((__m256i *) ((const int32_t *) src2 + i));
-            v8si src1_tmp2 = _mm256_load_si256((__m256i *) ((const int32_t *) src1 + i + AVX_LEN_INT32));
-            v8si src2_tmp2 = _mm256_load_si256((__m256i *) ((const int32_t *) src2 + i + AVX_LEN_INT32));
-            v8si max1 = _mm256_max_epi32(src1_tmp, src2_tmp);
-            v8si max2 = _mm256_max_epi32(src1_tmp2, src2_tmp2);
-            _mm256_store_si256((__m256i *) (dst + i), max1);
-            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT32), max2);
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT16) {
+            v8si a = _mm256_load_si256((__m256i *) (src1 + i));
+            v8si b = _mm256_load_si256((__m256i *) (src2 + i));
+            v8si a2 = _mm256_load_si256((__m256i *) (src1 + i + AVX_LEN_INT16));
+            v8si b2 = _mm256_load_si256((__m256i *) (src2 + i + AVX_LEN_INT16));
+            v8si res = _mm256_max_epi16(a, b);
+            v8si res2 = _mm256_max_epi16(a2, b2);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT16), res2);
         }
     } else {
-        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
-            v8si src1_tmp = _mm256_loadu_si256((__m256i *) (src1 + i));
-            v8si src2_tmp = _mm256_loadu_si256((__m256i *) (src2 + i));
-            v8si src1_tmp2 = _mm256_loadu_si256((__m256i *) (src1 + i + AVX_LEN_INT32));
-            v8si src2_tmp2 = _mm256_loadu_si256((__m256i *) (src2 + i + AVX_LEN_INT32));
-            v8si max1 = _mm256_max_epi32(src1_tmp, src2_tmp);
-            v8si max2 = _mm256_max_epi32(src1_tmp2, src2_tmp2);
-            _mm256_storeu_si256((__m256i *) (dst + i), max1);
-            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT32), max2);
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT16) {
+            v8si a = _mm256_loadu_si256((__m256i *) (src1 + i));
+            v8si b = _mm256_loadu_si256((__m256i *) (src2 + i));
+            v8si a2 = _mm256_loadu_si256((__m256i *) (src1 + i + AVX_LEN_INT16));
+            v8si b2 = _mm256_loadu_si256((__m256i *) (src2 + i + AVX_LEN_INT16));
+            v8si res = _mm256_max_epi16(a, b);
+            v8si res2 = _mm256_max_epi16(a2, b2);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT16), res2);
         }
     }
 
@@ -508,32 +541,32 @@ static inline void maxevery256s(int32_t *src1, int32_t *src2, int32_t *dst, int
     }
 }
 
-static inline void minevery256s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+SIMD_UTILS_API void minevery16s_256s(int16_t *src1, int16_t *src2, int16_t *dst, int len)
 {
-    int stop_len = len / (2 * AVX_LEN_INT32);
-    stop_len *= (2 * AVX_LEN_INT32);
+    int stop_len = len / (2 * AVX_LEN_INT16);
+    stop_len *= (2 * AVX_LEN_INT16);
 
     if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
-            v8si src1_tmp = _mm256_load_si256((__m256i *) ((const int32_t *) src1 + i));
-            v8si src2_tmp = _mm256_load_si256((__m256i *) ((const int32_t *) src2 + i));
-            v8si src1_tmp2 = _mm256_load_si256((__m256i *) ((const int32_t *) src1 + i + AVX_LEN_INT32));
-            v8si src2_tmp2 = _mm256_load_si256((__m256i *) ((const int32_t *) src2 + i + AVX_LEN_INT32));
-            v8si min1 = _mm256_min_epi32(src1_tmp, src2_tmp);
-            v8si min2 = _mm256_min_epi32(src1_tmp2, src2_tmp2);
-            _mm256_store_si256((__m256i *) (dst + i), min1);
-            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT32), min2);
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT16) {
+            v8si a = _mm256_load_si256((__m256i *) (src1 + i));
+            v8si b = _mm256_load_si256((__m256i *) (src2 + i));
+            v8si a2 = _mm256_load_si256((__m256i *) (src1 + i + AVX_LEN_INT16));
+            v8si b2 = _mm256_load_si256((__m256i *) (src2 + i + AVX_LEN_INT16));
+            v8si res = _mm256_min_epi16(a, b);
+            v8si res2 = _mm256_min_epi16(a2, b2);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT16), res2);
         }
     } else {
-        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
-            v8si src1_tmp = _mm256_loadu_si256((__m256i *) (src1 + i));
-            v8si src2_tmp = _mm256_loadu_si256((__m256i *) (src2 + i));
-            v8si src1_tmp2 = _mm256_loadu_si256((__m256i *) (src1 + i + AVX_LEN_INT32));
-            v8si src2_tmp2 = _mm256_loadu_si256((__m256i *) (src2 + i + AVX_LEN_INT32));
-            v8si min1 = _mm256_min_epi32(src1_tmp, src2_tmp);
-            v8si min2 = _mm256_min_epi32(src1_tmp2, src2_tmp2);
-            _mm256_storeu_si256((__m256i *) (dst + i), min1);
-            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT32), min2);
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT16) {
+            v8si a = _mm256_loadu_si256((__m256i *) (src1 + i));
+            v8si b = _mm256_loadu_si256((__m256i *) (src2 + i));
+            v8si a2 = _mm256_loadu_si256((__m256i *) (src1 + i + AVX_LEN_INT16));
+            v8si b2 = _mm256_loadu_si256((__m256i *) (src2 + i + AVX_LEN_INT16));
+            v8si res = _mm256_min_epi16(a, b);
+            v8si res2 = _mm256_min_epi16(a2, b2);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT16), res2);
         }
     }
 
@@ -542,196 +575,332 @@ static inline void minevery256s(int32_t *src1, int32_t *src2, int32_t *dst, int
     }
 }
 
-static inline void minmax256s(int32_t *src, int len, int32_t *min_value, int32_t *max_value)
+// saturated, abs(-32768) is 32767
+SIMD_UTILS_API void abs16s_256s(int16_t *src, int16_t *dst, int len)
 {
-    int stop_len = (len - AVX_LEN_INT32) / (2 * AVX_LEN_INT32);
-    stop_len *= (2 * AVX_LEN_INT32);
-    stop_len = (stop_len < 0) ? 0 : stop_len;
+    const v8si zero = _mm256_setzero_si256();
 
-    v8si max_v, min_v, max_v2, min_v2;
-    v8si src_tmp, src_tmp2;
+    int stop_len = len / (2 * AVX_LEN_INT16);
+    stop_len *= (2 * AVX_LEN_INT16);
 
-    int32_t min_tmp = src[0];
-    int32_t max_tmp = src[0];
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT16) {
+            v8si a = _mm256_load_si256((__m256i *) (src + i));
+            v8si a2 = _mm256_load_si256((__m256i *) (src + i + AVX_LEN_INT16));
+            v8si res = _mm256_max_epi16(a, _mm256_subs_epi16(zero, a));
+            v8si res2 = _mm256_max_epi16(a2, _mm256_subs_epi16(zero, a2));
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT16), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT16) {
+            v8si a = _mm256_loadu_si256((__m256i *) (src + i));
+            v8si a2 = _mm256_loadu_si256((__m256i *) (src + i + AVX_LEN_INT16));
+            v8si res = _mm256_max_epi16(a, _mm256_subs_epi16(zero, a));
+            v8si res2 = _mm256_max_epi16(a2, _mm256_subs_epi16(zero, a2));
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT16), res2);
+        }
+    }
 
-    __attribute__((aligned(SSE_LEN_BYTES))) int32_t max_f[SSE_LEN_INT32];
-    __attribute__((aligned(SSE_LEN_BYTES))) int32_t min_f[SSE_LEN_INT32];
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src[i] == INT16_MIN ? INT16_MAX : (int16_t) abs(src[i]);
+    }
+}
 
-    if (len >= AVX_LEN_INT32) {
-        if (isAligned((uintptr_t) (src), AVX_LEN_BYTES)) {
-            src_tmp = _mm256_load_si256((__m256i *) (src + 0));
-            max_v = src_tmp;
-            min_v = src_tmp;
-            max_v2 = src_tmp;
-            min_v2 = src_tmp;
+SIMD_UTILS_API void threshold_gt16s_256s(int16_t *src, int16_t *dst, int len, int16_t value)
+{
+    const v8si val = _mm256_set1_epi16(value);
 
-            for (int i = AVX_LEN_INT32; i < stop_len; i += 2 * AVX_LEN_INT32) {
-                src_tmp = _mm256_load_si256((__m256i *) (src + i));
-                src_tmp2 = _mm256_load_si256((__m256i *) (src + i + AVX_LEN_INT32));
-                max_v = _mm256_max_epi32(max_v, src_tmp);
-                min_v = _mm256_min_epi32(min_v, src_tmp);
-                max_v2 = _mm256_max_epi32(max_v2, src_tmp2);
-                min_v2 = _mm256_min_epi32(min_v2, src_tmp2);
-            }
-        } else {
-            src_tmp = _mm256_loadu_si256((__m256i *) (src + 0));
-            max_v = src_tmp;
-            min_v = src_tmp;
-            max_v2 = src_tmp;
-            min_v2 = src_tmp;
+    int stop_len = len / (2 * AVX_LEN_INT16);
+    stop_len *= (2 * AVX_LEN_INT16);
 
-            for (int i = AVX_LEN_INT32; i < stop_len; i += 2 * AVX_LEN_INT32) {
-                src_tmp = _mm256_loadu_si256((__m256i *) (src + i));
-                src_tmp2 = _mm256_loadu_si256((__m256i *) (src + i + AVX_LEN_INT32));
-                max_v = _mm256_max_epi32(max_v, src_tmp);
-                min_v = _mm256_min_epi32(min_v, src_tmp);
-                max_v2 = _mm256_max_epi32(max_v2, src_tmp2);
-                min_v2 = _mm256_min_epi32(min_v2, src_tmp2);
-            }
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT16) {
+            v8si a = _mm256_load_si256((__m256i *) (src + i));
+            v8si a2 = _mm256_load_si256((__m256i *) (src + i + AVX_LEN_INT16));
+            v8si res = _mm256_min_epi16(a, val);
+            v8si res2 = _mm256_min_epi16(a2, val);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT16), res2);
         }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT16) {
+            v8si a = _mm256_loadu_si256((__m256i *) (src + i));
+            v8si a2 = _mm256_loadu_si256((__m256i *) (src + i + AVX_LEN_INT16));
+            v8si res = _mm256_min_epi16(a, val);
+            v8si res2 = _mm256_min_epi16(a2, val);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT16), res2);
+        }
+    }
 
-        max_v = _mm256_max_epi32(max_v, max_v2);
-        min_v = _mm256_min_epi32(min_v, min_v2);
-
-        v4si max3 = _mm256_castsi256_si128(max_v);
-        v4si min3 = _mm256_castsi256_si128(min_v);
-        v4si max4 = _mm256_extracti128_si256(max_v, 1);
-        v4si min4 = _mm256_extracti128_si256(min_v, 1);
-        max4 = _mm_max_epi32(max3, max4);
-        min4 = _mm_min_epi32(min3, min4);
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src[i] < value ? src[i] : value;
+    }
+}
 
-        _mm_store_si128((__m128i *) (max_f), max4);
-        _mm_store_si128((__m128i *) (min_f), min4);
+SIMD_UTILS_API void threshold_lt16s_256s(int16_t *src, int16_t *dst, int len, int16_t value)
+{
+    const v8si val = _mm256_set1_epi16(value);
 
-        max_tmp = max_f[0];
-        max_tmp = max_tmp > max_f[1] ? max_tmp : max_f[1];
-        max_tmp = max_tmp > max_f[2] ? max_tmp : max_f[2];
-        max_tmp = max_tmp > max_f[3] ? max_tmp : max_f[3];
+    int stop_len = len / (2 * AVX_LEN_INT16);
+    stop_len *= (2 * AVX_LEN_INT16);
 
-        min_tmp = min_f[0];
-        min_tmp = min_tmp < min_f[1] ? min_tmp : min_f[1];
-        min_tmp = min_tmp < min_f[2] ? min_tmp : min_f[2];
-        min_tmp = min_tmp < min_f[3] ? min_tmp : min_f[3];
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT16) {
+            v8si a = _mm256_load_si256((__m256i *) (src + i));
+            v8si a2 = _mm256_load_si256((__m256i *) (src + i + AVX_LEN_INT16));
+            v8si res = _mm256_max_epi16(a, val);
+            v8si res2 = _mm256_max_epi16(a2, val);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT16), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT16) {
+            v8si a = _mm256_loadu_si256((__m256i *) (src + i));
+            v8si a2 = _mm256_loadu_si256((__m256i *) (src + i + AVX_LEN_INT16));
+            v8si res = _mm256_max_epi16(a, val);
+            v8si res2 = _mm256_max_epi16(a2, val);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT16), res2);
+        }
     }
 
     for (int i = stop_len; i < len; i++) {
-        max_tmp = max_tmp > src[i] ? max_tmp : src[i];
-        min_tmp = min_tmp < src[i] ? min_tmp : src[i];
+        dst[i] = src[i] > value ? src[i] : value;
     }
-
-    *max_value = max_tmp;
-    *min_value = min_tmp;
 }
 
-static inline void threshold256_gt_s(int32_t *src, int32_t *dst, int len, int32_t value)
+SIMD_UTILS_API void addsatu8_256(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len)
 {
-    const v8si tmp = _mm256_set1_epi32(value);
-
-    int stop_len = len / (2 * AVX_LEN_INT32);
-    stop_len *= (2 * AVX_LEN_INT32);
+    int stop_len = len / (2 * AVX_LEN_INT8);
+    stop_len *= (2 * AVX_LEN_INT8);
 
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
-            v8si src_tmp = _mm256_load_si256((__m256i *) (src + i));
-            v8si src_tmp2 = _mm256_load_si256((__m256i *) (src + i + AVX_LEN_INT32));
-            v8si dst_tmp = _mm256_min_epi32(src_tmp, tmp);
-            v8si dst_tmp2 = _mm256_min_epi32(src_tmp2, tmp);
-            _mm256_store_si256((__m256i *) (dst + i), dst_tmp);
-            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT32), dst_tmp2);
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT8) {
+            v8si a = _mm256_load_si256((__m256i *) (src1 + i));
+            v8si b = _mm256_load_si256((__m256i *) (src2 + i));
+            v8si a2 = _mm256_load_si256((__m256i *) (src1 + i + AVX_LEN_INT8));
+            v8si b2 = _mm256_load_si256((__m256i *) (src2 + i + AVX_LEN_INT8));
+            v8si res = _mm256_adds_epu8(a, b);
+            v8si res2 = _mm256_adds_epu8(a2, b2);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT8), res2);
         }
     } else {
-        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
-            v8si src_tmp = _mm256_loadu_si256((__m256i *) (src + i));
-            v8si src_tmp2 = _mm256_loadu_si256((__m256i *) (src + i + AVX_LEN_INT32));
-            v8si dst_tmp = _mm256_min_epi32(src_tmp, tmp);
-            v8si dst_tmp2 = _mm256_min_epi32(src_tmp2, tmp);
-            _mm256_storeu_si256((__m256i *) (dst + i), dst_tmp);
-            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT32), dst_tmp2);
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT8) {
+            v8si a = _mm256_loadu_si256((__m256i *) (src1 + i));
+            v8si b = _mm256_loadu_si256((__m256i *) (src2 + i));
+            v8si a2 = _mm256_loadu_si256((__m256i *) (src1 + i + AVX_LEN_INT8));
+            v8si b2 = _mm256_loadu_si256((__m256i *) (src2 + i + AVX_LEN_INT8));
+            v8si res = _mm256_adds_epu8(a, b);
+            v8si res2 = _mm256_adds_epu8(a2, b2);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT8), res2);
         }
     }
 
     for (int i = stop_len; i < len; i++) {
-        dst[i] = src[i] < value ? src[i] : value;
+        int tmp = (int) src1[i] + (int) src2[i];
+        dst[i] = (uint8_t) (tmp > UINT8_MAX ? UINT8_MAX : (tmp < 0 ? 0 : tmp));
     }
 }
 
-static inline void threshold256_gtabs_s(int32_t *src, int32_t *dst, int len, int32_t value)
+SIMD_UTILS_API void subsatu8_256(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len)
 {
-    const v8si pval = _mm256_set1_epi32(value);
-    const v8si mval = _mm256_set1_epi32(-value);
+    int stop_len = len / (2 * AVX_LEN_INT8);
+    stop_len *= (2 * AVX_LEN_INT8);
 
-    int stop_len = len / (2 * AVX_LEN_INT32);
-    stop_len *= (2 * AVX_LEN_INT32);
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT8) {
+            v8si a = _mm256_load_si256((__m256i *) (src1 + i));
+            v8si b = _mm256_load_si256((__m256i *) (src2 + i));
+            v8si a2 = _mm256_load_si256((__m256i *) (src1 + i + AVX_LEN_INT8));
+            v8si b2 = _mm256_load_si256((__m256i *) (src2 + i + AVX_LEN_INT8));
+            v8si res = _mm256_subs_epu8(a, b);
+            v8si res2 = _mm256_subs_epu8(a2, b2);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT8), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT8) {
+            v8si a = _mm256_loadu_si256((__m256i *) (src1 + i));
+            v8si b = _mm256_loadu_si256((__m256i *) (src2 + i));
+            v8si a2 = _mm256_loadu_si256((__m256i *) (src1 + i + AVX_LEN_INT8));
+            v8si b2 = _mm256_loadu_si256((__m256i *) (src2 + i + AVX_LEN_INT8));
+            v8si res = _mm256_subs_epu8(a, b);
+            v8si res2 = _mm256_subs_epu8(a2, b2);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT8), res2);
+        }
+    }
 
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
-            v8si src_tmp = _mm256_load_si256((__m256i *) (src + i));
-            v8si src_tmp2 = _mm256_load_si256((__m256i *) (src + i + AVX_LEN_INT32));
-            v8si src_abs = _mm256_abs_epi32(src_tmp);
-            v8si src_abs2 = _mm256_abs_epi32(src_tmp2);
-            v8si eqmask = _mm256_cmpeq_epi32(src_abs, src_tmp);  // if A = abs(A), then A is >= 0 (mask 0xFFFFFFFF)
-            v8si eqmask2 = _mm256_cmpeq_epi32(src_abs2, src_tmp2);
-            v8si max = _mm256_min_epi32(src_tmp, pval);
-            v8si max2 = _mm256_min_epi32(src_tmp2, pval);
-            v8si min = _mm256_max_epi32(src_tmp, mval);
-            v8si min2 = _mm256_max_epi32(src_tmp2, mval);
-            v8si dst_tmp = _mm256_blendv_epi8(min, max, eqmask);
-            v8si dst_tmp2 = _mm256_blendv_epi8(min2, max2, eqmask2);
-            _mm256_store_si256((__m256i *) (dst + i), dst_tmp);
-            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT32), dst_tmp2);
+    for (int i = stop_len; i < len; i++) {
+        int tmp = (int) src1[i] - (int) src2[i];
+        dst[i] = (uint8_t) (tmp > UINT8_MAX ? UINT8_MAX : (tmp < 0 ? 0 : tmp));
+    }
+}
+
+// one of the two saturated differences is 0
+SIMD_UTILS_API void absdiffu8_256(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_INT8);
+    stop_len *= (2 * AVX_LEN_INT8);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT8) {
+            v8si a = _mm256_load_si256((__m256i *) (src1 + i));
+            v8si b = _mm256_load_si256((__m256i *) (src2 + i));
+            v8si a2 = _mm256_load_si256((__m256i *) (src1 + i + AVX_LEN_INT8));
+            v8si b2 = _mm256_load_si256((__m256i *) (src2 + i + AVX_LEN_INT8));
+            v8si res = _mm256_or_si256(_mm256_subs_epu8(a, b), _mm256_subs_epu8(b, a));
+            v8si res2 = _mm256_or_si256(_mm256_subs_epu8(a2, b2), _mm256_subs_epu8(b2, a2));
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT8), res2);
         }
     } else {
-        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
-            v8si src_tmp = _mm256_loadu_si256((__m256i *) (src + i));
-            v8si src_tmp2 = _mm256_loadu_si256((__m256i *) (src + i + AVX_LEN_INT32));
-            v8si src_abs = _mm256_abs_epi32(src_tmp);
-            v8si src_abs2 = _mm256_abs_epi32(src_tmp2);
-            v8si eqmask = _mm256_cmpeq_epi32(src_abs, src_tmp);  // if A = abs(A), then A is >= 0 (mask 0xFFFFFFFF)
-            v8si eqmask2 = _mm256_cmpeq_epi32(src_abs2, src_tmp2);
-            v8si max = _mm256_min_epi32(src_tmp, pval);
-            v8si max2 = _mm256_min_epi32(src_tmp2, pval);
-            v8si min = _mm256_max_epi32(src_tmp, mval);
-            v8si min2 = _mm256_max_epi32(src_tmp2, mval);
-            v8si dst_tmp = _mm256_blendv_epi8(min, max, eqmask);
-            v8si dst_tmp2 = _mm256_blendv_epi8(min2, max2, eqmask2);
-            _mm256_storeu_si256((__m256i *) (dst + i), dst_tmp);
-            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT32), dst_tmp2);
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT8) {
+            v8si a = _mm256_loadu_si256((__m256i *) (src1 + i));
+            v8si b = _mm256_loadu_si256((__m256i *) (src2 + i));
+            v8si a2 = _mm256_loadu_si256((__m256i *) (src1 + i + AVX_LEN_INT8));
+            v8si b2 = _mm256_loadu_si256((__m256i *) (src2 + i + AVX_LEN_INT8));
+            v8si res = _mm256_or_si256(_mm256_subs_epu8(a, b), _mm256_subs_epu8(b, a));
+            v8si res2 = _mm256_or_si256(_mm256_subs_epu8(a2, b2), _mm256_subs_epu8(b2, a2));
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT8), res2);
         }
     }
 
     for (int i = stop_len; i < len; i++) {
-        if (src[i] >= 0) {
-            dst[i] = src[i] > value ? value : src[i];
-        } else {
-            dst[i] = src[i] < (-value) ? (-value) : src[i];
+        dst[i] = src1[i] > src2[i] ? src1[i] - src2[i] : src2[i] - src1[i];
+    }
+}
+
+SIMD_UTILS_API void maxeveryu8_256(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_INT8);
+    stop_len *= (2 * AVX_LEN_INT8);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT8) {
+            v8si a = _mm256_load_si256((__m256i *) (src1 + i));
+            v8si b = _mm256_load_si256((__m256i *) (src2 + i));
+            v8si a2 = _mm256_load_si256((__m256i *) (src1 + i + AVX_LEN_INT8));
+            v8si b2 = _mm256_load_si256((__m256i *) (src2 + i + AVX_LEN_INT8));
+            v8si res = _mm256_max_epu8(a, b);
+            v8si res2 = _mm256_max_epu8(a2, b2);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT8), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT8) {
+            v8si a = _mm256_loadu_si256((__m256i *) (src1 + i));
+            v8si b = _mm256_loadu_si256((__m256i *) (src2 + i));
+            v8si a2 = _mm256_loadu_si256((__m256i *) (src1 + i + AVX_LEN_INT8));
+            v8si b2 = _mm256_loadu_si256((__m256i *) (src2 + i + AVX_LEN_INT8));
+            v8si res = _mm256_max_epu8(a, b);
+            v8si res2 = _mm256_max_epu8(a2, b2);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT8), res2);
         }
     }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src1[i] > src2[i] ? src1[i] : src2[i];
+    }
 }
 
-static inline void threshold256_lt_s(int32_t *src, int32_t *dst, int len, int32_t value)
+SIMD_UTILS_API void mineveryu8_256(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len)
 {
-    const v8si tmp = _mm256_set1_epi32(value);
+    int stop_len = len / (2 * AVX_LEN_INT8);
+    stop_len *= (2 * AVX_LEN_INT8);
 
-    int stop_len = len / (2 * AVX_LEN_INT32);
-    stop_len *= (2 * AVX_LEN_INT32);
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT8) {
+            v8si a = _mm256_load_si256((__m256i *) (src1 + i));
+            v8si b = _mm256_load_si256((__m256i *) (src2 + i));
+            v8si a2 = _mm256_load_si256((__m256i *) (src1 + i + AVX_LEN_INT8));
+            v8si b2 = _mm256_load_si256((__m256i *) (src2 + i + AVX_LEN_INT8));
+            v8si res = _mm256_min_epu8(a, b);
+            v8si res2 = _mm256_min_epu8(a2, b2);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT8), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT8) {
+            v8si a = _mm256_loadu_si256((__m256i *) (src1 + i));
+            v8si b = _mm256_loadu_si256((__m256i *) (src2 + i));
+            v8si a2 = _mm256_loadu_si256((__m256i *) (src1 + i + AVX_LEN_INT8));
+            v8si b2 = _mm256_loadu_si256((__m256i *) (src2 + i + AVX_LEN_INT8));
+            v8si res = _mm256_min_epu8(a, b);
+            v8si res2 = _mm256_min_epu8(a2, b2);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT8), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src1[i] < src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void threshold_gtu8_256(uint8_t *src, uint8_t *dst, int len, uint8_t value)
+{
+    const v8si val = _mm256_set1_epi8((char) value);
+
+    int stop_len = len / (2 * AVX_LEN_INT8);
+    stop_len *= (2 * AVX_LEN_INT8);
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
-            v8si src_tmp = _mm256_load_si256((__m256i *) (src + i));
-            v8si src_tmp2 = _mm256_load_si256((__m256i *) (src + i + AVX_LEN_INT32));
-            v8si dst_tmp = _mm256_max_epi32(src_tmp, tmp);
-            v8si dst_tmp2 = _mm256_max_epi32(src_tmp2, tmp);
-            _mm256_store_si256((__m256i *) (dst + i), dst_tmp);
-            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT32), dst_tmp2);
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT8) {
+            v8si a = _mm256_load_si256((__m256i *) (src + i));
+            v8si a2 = _mm256_load_si256((__m256i *) (src + i + AVX_LEN_INT8));
+            v8si res = _mm256_min_epu8(a, val);
+            v8si res2 = _mm256_min_epu8(a2, val);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT8), res2);
         }
     } else {
-        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
-            v8si src_tmp = _mm256_loadu_si256((__m256i *) (src + i));
-            v8si src_tmp2 = _mm256_loadu_si256((__m256i *) (src + i + AVX_LEN_INT32));
-            v8si dst_tmp = _mm256_max_epi32(src_tmp, tmp);
-            v8si dst_tmp2 = _mm256_max_epi32(src_tmp2, tmp);
-            _mm256_storeu_si256((__m256i *) (dst + i), dst_tmp);
-            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT32), dst_tmp2);
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT8) {
+            v8si a = _mm256_loadu_si256((__m256i *) (src + i));
+            v8si a2 = _mm256_loadu_si256((__m256i *) (src + i + AVX_LEN_INT8));
+            v8si res = _mm256_min_epu8(a, val);
+            v8si res2 = _mm256_min_epu8(a2, val);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT8), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src[i] < value ? src[i] : value;
+    }
+}
+
+SIMD_UTILS_API void threshold_ltu8_256(uint8_t *src, uint8_t *dst, int len, uint8_t value)
+{
+    const v8si val = _mm256_set1_epi8((char) value);
+
+    int stop_len = len / (2 * AVX_LEN_INT8);
+    stop_len *= (2 * AVX_LEN_INT8);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT8) {
+            v8si a = _mm256_load_si256((__m256i *) (src + i));
+            v8si a2 = _mm256_load_si256((__m256i *) (src + i + AVX_LEN_INT8));
+            v8si res = _mm256_max_epu8(a, val);
+            v8si res2 = _mm256_max_epu8(a2, val);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT8), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT8) {
+            v8si a = _mm256_loadu_si256((__m256i *) (src + i));
+            v8si a2 = _mm256_loadu_si256((__m256i *) (src + i + AVX_LEN_INT8));
+            v8si res = _mm256_max_epu8(a, val);
+            v8si res2 = _mm256_max_epu8(a2, val);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT8), res2);
         }
     }
 
@@ -740,132 +909,1791 @@ static inline void threshold256_lt_s(int32_t *src, int32_t *dst, int len, int32_
     }
 }
 
-static inline void threshold256_ltabs_s(int32_t *src, int32_t *dst, int len, int32_t value)
+// src >> scale_factor saturated to [0, 255]
+SIMD_UTILS_API void convertInt16ToU8_256(int16_t *src, uint8_t *dst, int len, int scale_factor)
 {
-    const v8si pval = _mm256_set1_epi32(value);
-    const v8si mval = _mm256_set1_epi32(-value);
+    int stop_len = len / AVX_LEN_INT8;
+    stop_len *= AVX_LEN_INT8;
 
-    int stop_len = len / (2 * AVX_LEN_INT32);
-    stop_len *= (2 * AVX_LEN_INT32);
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += AVX_LEN_INT8) {
+            v8si a = _mm256_load_si256((__m256i *) (src + i));
+            v8si a2 = _mm256_load_si256((__m256i *) (src + i + AVX_LEN_INT16));
+            v8si res = _mm256_packus_epi16(_mm256_srai_epi16(a, scale_factor), _mm256_srai_epi16(a2, scale_factor));
+            res = _mm256_permute4x64_epi64(res, 0xD8);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX_LEN_INT8) {
+            v8si a = _mm256_loadu_si256((__m256i *) (src + i));
+            v8si a2 = _mm256_loadu_si256((__m256i *) (src + i + AVX_LEN_INT16));
+            v8si res = _mm256_packus_epi16(_mm256_srai_epi16(a, scale_factor), _mm256_srai_epi16(a2, scale_factor));
+            res = _mm256_permute4x64_epi64(res, 0xD8);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        int16_t tmp = (int16_t) (src[i] >> scale_factor);
+        dst[i] = (uint8_t) (tmp > UINT8_MAX ? UINT8_MAX : (tmp < 0 ? 0 : tmp));
+    }
+}
+
+// src << scale_factor, scale_factor up to 7
+SIMD_UTILS_API void convertU8ToInt16_256(uint8_t *src, int16_t *dst, int len, int scale_factor)
+{
+    int stop_len = len / AVX_LEN_INT8;
+    stop_len *= AVX_LEN_INT8;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
-            v8si src_tmp = _mm256_load_si256((__m256i *) (src + i));
-            v8si src_tmp2 = _mm256_load_si256((__m256i *) (src + i + AVX_LEN_INT32));
-            v8si src_abs = _mm256_abs_epi32(src_tmp);
-            v8si src_abs2 = _mm256_abs_epi32(src_tmp2);
-            v8si eqmask = _mm256_cmpeq_epi32(src_abs, src_tmp);  // if A = abs(A), then A is >= 0 (mask 0xFFFFFFFF)
-            v8si eqmask2 = _mm256_cmpeq_epi32(src_abs2, src_tmp2);
-            v8si max = _mm256_max_epi32(src_tmp, pval);
-            v8si max2 = _mm256_max_epi32(src_tmp2, pval);
-            v8si min = _mm256_min_epi32(src_tmp, mval);
-            v8si min2 = _mm256_min_epi32(src_tmp2, mval);
-            v8si dst_tmp = _mm256_blendv_epi8(min, max, eqmask);
-            v8si dst_tmp2 = _mm256_blendv_epi8(min2, max2, eqmask2);
-            _mm256_store_si256((__m256i *) (dst + i), dst_tmp);
-            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT32), dst_tmp2);
+        for (int i = 0; i < stop_len; i += AVX_LEN_INT8) {
+            v8si a = _mm256_load_si256((__m256i *) (src + i));
+            v8si res = _mm256_slli_epi16(_mm256_cvtepu8_epi16(_mm256_castsi256_si128(a)), scale_factor);
+            v8si res2 = _mm256_slli_epi16(_mm256_cvtepu8_epi16(_mm256_extracti128_si256(a, 1)), scale_factor);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT16), res2);
         }
     } else {
-        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
-            v8si src_tmp = _mm256_loadu_si256((__m256i *) (src + i));
-            v8si src_tmp2 = _mm256_loadu_si256((__m256i *) (src + i + AVX_LEN_INT32));
-            v8si src_abs = _mm256_abs_epi32(src_tmp);
-            v8si src_abs2 = _mm256_abs_epi32(src_tmp2);
-            v8si eqmask = _mm256_cmpeq_epi32(src_abs, src_tmp);  // if A = abs(A), then A is >= 0 (mask 0xFFFFFFFF)
-            v8si eqmask2 = _mm256_cmpeq_epi32(src_abs2, src_tmp2);
-            v8si max = _mm256_max_epi32(src_tmp, pval);
-            v8si max2 = _mm256_max_epi32(src_tmp2, pval);
-            v8si min = _mm256_min_epi32(src_tmp, mval);
-            v8si min2 = _mm256_min_epi32(src_tmp2, mval);
-            v8si dst_tmp = _mm256_blendv_epi8(min, max, eqmask);
-            v8si dst_tmp2 = _mm256_blendv_epi8(min2, max2, eqmask2);
-            _mm256_storeu_si256((__m256i *) (dst + i), dst_tmp);
-            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT32), dst_tmp2);
+        for (int i = 0; i < stop_len; i += AVX_LEN_INT8) {
+            v8si a = _mm256_loadu_si256((__m256i *) (src + i));
+            v8si res = _mm256_slli_epi16(_mm256_cvtepu8_epi16(_mm256_castsi256_si128(a)), scale_factor);
+            v8si res2 = _mm256_slli_epi16(_mm256_cvtepu8_epi16(_mm256_extracti128_si256(a, 1)), scale_factor);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT16), res2);
         }
     }
 
     for (int i = stop_len; i < len; i++) {
-        if (src[i] >= 0) {
-            dst[i] = src[i] < value ? value : src[i];
-        } else {
-            dst[i] = src[i] > (-value) ? (-value) : src[i];
+        dst[i] = (int16_t) (src[i] << scale_factor);
+    }
+}
+
+SIMD_UTILS_API void add64s_256s(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_INT64);
+    stop_len *= (2 * AVX_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            v4sid a = _mm256_load_si256((__m256i *) (src1 + i));
+            v4sid b = _mm256_load_si256((__m256i *) (src2 + i));
+            v4sid a2 = _mm256_load_si256((__m256i *) (src1 + i + AVX_LEN_INT64));
+            v4sid b2 = _mm256_load_si256((__m256i *) (src2 + i + AVX_LEN_INT64));
+            v4sid res = _mm256_add_epi64(a, b);
+            v4sid res2 = _mm256_add_epi64(a2, b2);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT64), res2);
         }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            v4sid a = _mm256_loadu_si256((__m256i *) (src1 + i));
+            v4sid b = _mm256_loadu_si256((__m256i *) (src2 + i));
+            v4sid a2 = _mm256_loadu_si256((__m256i *) (src1 + i + AVX_LEN_INT64));
+            v4sid b2 = _mm256_loadu_si256((__m256i *) (src2 + i + AVX_LEN_INT64));
+            v4sid res = _mm256_add_epi64(a, b);
+            v4sid res2 = _mm256_add_epi64(a2, b2);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = (int64_t) ((uint64_t) src1[i] + (uint64_t) src2[i]);
     }
 }
 
-// no cmplt_epi32 with AVX2. gt(b,a) = le(a,b), not lt. To be improved?
-static inline void threshold256_ltval_gtval_s(int32_t *src, int32_t *dst, int len, int32_t ltlevel, int32_t ltvalue, int32_t gtlevel, int32_t gtvalue)
+SIMD_UTILS_API void sub64s_256s(int64_t *src1, int64_t *src2, int64_t *dst, int len)
 {
-    const v8si ltlevel_v = _mm256_set1_epi32(ltlevel);
-    const v8si ltvalue_v = _mm256_set1_epi32(ltvalue);
-    const v8si gtlevel_v = _mm256_set1_epi32(gtlevel);
-    const v8si gtvalue_v = _mm256_set1_epi32(gtvalue);
+    int stop_len = len / (2 * AVX_LEN_INT64);
+    stop_len *= (2 * AVX_LEN_INT64);
 
-    int stop_len = len / (2 * AVX_LEN_FLOAT);
-    stop_len *= (2 * AVX_LEN_FLOAT);
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            v4sid a = _mm256_load_si256((__m256i *) (src1 + i));
+            v4sid b = _mm256_load_si256((__m256i *) (src2 + i));
+            v4sid a2 = _mm256_load_si256((__m256i *) (src1 + i + AVX_LEN_INT64));
+            v4sid b2 = _mm256_load_si256((__m256i *) (src2 + i + AVX_LEN_INT64));
+            v4sid res = _mm256_sub_epi64(a, b);
+            v4sid res2 = _mm256_sub_epi64(a2, b2);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            v4sid a = _mm256_loadu_si256((__m256i *) (src1 + i));
+            v4sid b = _mm256_loadu_si256((__m256i *) (src2 + i));
+            v4sid a2 = _mm256_loadu_si256((__m256i *) (src1 + i + AVX_LEN_INT64));
+            v4sid b2 = _mm256_loadu_si256((__m256i *) (src2 + i + AVX_LEN_INT64));
+            v4sid res = _mm256_sub_epi64(a, b);
+            v4sid res2 = _mm256_sub_epi64(a2, b2);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT64), res2);
+        }
+    }
 
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
-            v8si src_tmp = _mm256_load_si256((v8si *) (src + i));
-            v8si src_tmp2 = _mm256_load_si256((v8si *) (src + i + AVX_LEN_INT32));
-            v8si lt_mask = _mm256_cmpgt_epi32(ltlevel_v, src_tmp);
-            v8si gt_mask = _mm256_cmpgt_epi32(src_tmp, gtlevel_v);
-            v8si dst_tmp = _mm256_blendv_epi8(src_tmp, ltvalue_v, lt_mask);
-            dst_tmp = _mm256_blendv_epi8(dst_tmp, gtvalue_v, gt_mask);
-            _mm256_store_si256((v8si *) (dst + i), dst_tmp);
-            v8si lt_mask2 = _mm256_cmpgt_epi32(ltlevel_v, src_tmp2);
-            v8si gt_mask2 = _mm256_cmpgt_epi32(src_tmp2, gtlevel_v);
-            v8si dst_tmp2 = _mm256_blendv_epi8(src_tmp2, ltvalue_v, lt_mask2);
-            dst_tmp2 = _mm256_blendv_epi8(dst_tmp2, gtvalue_v, gt_mask2);
-            _mm256_store_si256((v8si *) (dst + i + AVX_LEN_INT32), dst_tmp2);
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = (int64_t) ((uint64_t) src1[i] - (uint64_t) src2[i]);
+    }
+}
+
+// low 64 bits of the products
+SIMD_UTILS_API void mul64s_256s(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_INT64);
+    stop_len *= (2 * AVX_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            v4sid a = _mm256_load_si256((__m256i *) (src1 + i));
+            v4sid b = _mm256_load_si256((__m256i *) (src2 + i));
+            v4sid a2 = _mm256_load_si256((__m256i *) (src1 + i + AVX_LEN_INT64));
+            v4sid b2 = _mm256_load_si256((__m256i *) (src2 + i + AVX_LEN_INT64));
+            v4sid res = _mm256_mullo_epi64_custom(a, b);
+            v4sid res2 = _mm256_mullo_epi64_custom(a2, b2);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT64), res2);
         }
     } else {
-        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
-            v8si src_tmp = _mm256_loadu_si256((v8si *) (src + i));
-            v8si src_tmp2 = _mm256_loadu_si256((v8si *) (src + i + AVX_LEN_INT32));
-            v8si lt_mask = _mm256_cmpgt_epi32(ltlevel_v, src_tmp);
-            v8si gt_mask = _mm256_cmpgt_epi32(src_tmp, gtlevel_v);
-            v8si dst_tmp = _mm256_blendv_epi8(src_tmp, ltvalue_v, lt_mask);
-            dst_tmp = _mm256_blendv_epi8(dst_tmp, gtvalue_v, gt_mask);
-            _mm256_storeu_si256((v8si *) (dst + i), dst_tmp);
-            v8si lt_mask2 = _mm256_cmpgt_epi32(ltlevel_v, src_tmp2);
-            v8si gt_mask2 = _mm256_cmpgt_epi32(src_tmp2, gtlevel_v);
-            v8si dst_tmp2 = _mm256_blendv_epi8(src_tmp2, ltvalue_v, lt_mask2);
-            dst_tmp2 = _mm256_blendv_epi8(dst_tmp2, gtvalue_v, gt_mask2);
-            _mm256_storeu_si256((v8si *) (dst + i + AVX_LEN_INT32), dst_tmp2);
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            v4sid a = _mm256_loadu_si256((__m256i *) (src1 + i));
+            v4sid b = _mm256_loadu_si256((__m256i *) (src2 + i));
+            v4sid a2 = _mm256_loadu_si256((__m256i *) (src1 + i + AVX_LEN_INT64));
+            v4sid b2 = _mm256_loadu_si256((__m256i *) (src2 + i + AVX_LEN_INT64));
+            v4sid res = _mm256_mullo_epi64_custom(a, b);
+            v4sid res2 = _mm256_mullo_epi64_custom(a2, b2);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT64), res2);
         }
     }
 
     for (int i = stop_len; i < len; i++) {
-        dst[i] = src[i] < ltlevel ? ltvalue : src[i];
-        dst[i] = src[i] > gtlevel ? gtvalue : dst[i];
+        dst[i] = (int64_t) ((uint64_t) src1[i] * (uint64_t) src2[i]);
     }
 }
 
-// is it useful to unroll?
-static inline void gatheri_256s(int32_t *src, int32_t *dst, int stride, int offset, int len)
+SIMD_UTILS_API void sum64s_256s(int64_t *src, int64_t *dst, int len)
 {
-    int stop_len = len / (AVX_LEN_INT32);
-    stop_len *= (AVX_LEN_INT32);
+    int stop_len = len / (2 * AVX_LEN_INT64);
+    stop_len *= (2 * AVX_LEN_INT64);
 
-    v8si vindex = _mm256_setr_epi32(offset, stride + offset, 2 * stride + offset, 3 * stride + offset,
-                                    4 * stride + offset, 5 * stride + offset, 6 * stride + offset, 7 * stride + offset);
+    __attribute__((aligned(AVX_LEN_BYTES))) int64_t accumulate[AVX_LEN_INT64];
+    int64_t tmp_acc = 0;
+    v4sid vec_acc1 = _mm256_setzero_si256();
+    v4sid vec_acc2 = _mm256_setzero_si256();
 
-    if (isAligned((uintptr_t) (dst), AVX_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += AVX_LEN_INT32) {
-            v8si tmp = _mm256_i32gather_epi32((const int *) (src + i * AVX_LEN_INT32), vindex, 1);
-            _mm256_store_si256((v8si *) (dst + i * AVX_LEN_INT32), tmp);
+    if (isAligned((uintptr_t) (src), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            vec_acc1 = _mm256_add_epi64(vec_acc1, _mm256_load_si256((__m256i *) (src + i)));
+            vec_acc2 = _mm256_add_epi64(vec_acc2, _mm256_load_si256((__m256i *) (src + i + AVX_LEN_INT64)));
         }
     } else {
-        for (int i = 0; i < stop_len; i += AVX_LEN_INT32) {
-            v8si tmp = _mm256_i32gather_epi32((const int *) (src + i * AVX_LEN_INT32), vindex, 1);
-            _mm256_storeu_si256((v8si *) (dst + i * AVX_LEN_INT32), tmp);
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            vec_acc1 = _mm256_add_epi64(vec_acc1, _mm256_loadu_si256((__m256i *) (src + i)));
+            vec_acc2 = _mm256_add_epi64(vec_acc2, _mm256_loadu_si256((__m256i *) (src + i + AVX_LEN_INT64)));
         }
     }
+    _mm256_store_si256((__m256i *) accumulate, _mm256_add_epi64(vec_acc1, vec_acc2));
 
     for (int i = stop_len; i < len; i++) {
-        dst[i] = src[i * stride + offset];
+        tmp_acc += src[i];
+    }
+
+    for (int i = 0; i < AVX_LEN_INT64; i++) {
+        tmp_acc += accumulate[i];
+    }
+
+    *dst = tmp_acc;
+}
+
+SIMD_UTILS_API void maxevery64s_256s(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_INT64);
+    stop_len *= (2 * AVX_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            v4sid a = _mm256_load_si256((__m256i *) (src1 + i));
+            v4sid b = _mm256_load_si256((__m256i *) (src2 + i));
+            v4sid a2 = _mm256_load_si256((__m256i *) (src1 + i + AVX_LEN_INT64));
+            v4sid b2 = _mm256_load_si256((__m256i *) (src2 + i + AVX_LEN_INT64));
+            v4sid res = _mm256_max_epi64_custom(a, b);
+            v4sid res2 = _mm256_max_epi64_custom(a2, b2);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            v4sid a = _mm256_loadu_si256((__m256i *) (src1 + i));
+            v4sid b = _mm256_loadu_si256((__m256i *) (src2 + i));
+            v4sid a2 = _mm256_loadu_si256((__m256i *) (src1 + i + AVX_LEN_INT64));
+            v4sid b2 = _mm256_loadu_si256((__m256i *) (src2 + i + AVX_LEN_INT64));
+            v4sid res = _mm256_max_epi64_custom(a, b);
+            v4sid res2 = _mm256_max_epi64_custom(a2, b2);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT64), res2);
+        }
     }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src1[i] > src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void minevery64s_256s(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_INT64);
+    stop_len *= (2 * AVX_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            v4sid a = _mm256_load_si256((__m256i *) (src1 + i));
+            v4sid b = _mm256_load_si256((__m256i *) (src2 + i));
+            v4sid a2 = _mm256_load_si256((__m256i *) (src1 + i + AVX_LEN_INT64));
+            v4sid b2 = _mm256_load_si256((__m256i *) (src2 + i + AVX_LEN_INT64));
+            v4sid res = _mm256_min_epi64_custom(a, b);
+            v4sid res2 = _mm256_min_epi64_custom(a2, b2);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            v4sid a = _mm256_loadu_si256((__m256i *) (src1 + i));
+            v4sid b = _mm256_loadu_si256((__m256i *) (src2 + i));
+            v4sid a2 = _mm256_loadu_si256((__m256i *) (src1 + i + AVX_LEN_INT64));
+            v4sid b2 = _mm256_loadu_si256((__m256i *) (src2 + i + AVX_LEN_INT64));
+            v4sid res = _mm256_min_epi64_custom(a, b);
+            v4sid res2 = _mm256_min_epi64_custom(a2, b2);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src1[i] < src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void maxeveryu64_256(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_INT64);
+    stop_len *= (2 * AVX_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            v4sid a = _mm256_load_si256((__m256i *) (src1 + i));
+            v4sid b = _mm256_load_si256((__m256i *) (src2 + i));
+            v4sid a2 = _mm256_load_si256((__m256i *) (src1 + i + AVX_LEN_INT64));
+            v4sid b2 = _mm256_load_si256((__m256i *) (src2 + i + AVX_LEN_INT64));
+            v4sid res = _mm256_max_epu64_custom(a, b);
+            v4sid res2 = _mm256_max_epu64_custom(a2, b2);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            v4sid a = _mm256_loadu_si256((__m256i *) (src1 + i));
+            v4sid b = _mm256_loadu_si256((__m256i *) (src2 + i));
+            v4sid a2 = _mm256_loadu_si256((__m256i *) (src1 + i + AVX_LEN_INT64));
+            v4sid b2 = _mm256_loadu_si256((__m256i *) (src2 + i + AVX_LEN_INT64));
+            v4sid res = _mm256_max_epu64_custom(a, b);
+            v4sid res2 = _mm256_max_epu64_custom(a2, b2);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src1[i] > src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void mineveryu64_256(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_INT64);
+    stop_len *= (2 * AVX_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            v4sid a = _mm256_load_si256((__m256i *) (src1 + i));
+            v4sid b = _mm256_load_si256((__m256i *) (src2 + i));
+            v4sid a2 = _mm256_load_si256((__m256i *) (src1 + i + AVX_LEN_INT64));
+            v4sid b2 = _mm256_load_si256((__m256i *) (src2 + i + AVX_LEN_INT64));
+            v4sid res = _mm256_min_epu64_custom(a, b);
+            v4sid res2 = _mm256_min_epu64_custom(a2, b2);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            v4sid a = _mm256_loadu_si256((__m256i *) (src1 + i));
+            v4sid b = _mm256_loadu_si256((__m256i *) (src2 + i));
+            v4sid a2 = _mm256_loadu_si256((__m256i *) (src1 + i + AVX_LEN_INT64));
+            v4sid b2 = _mm256_loadu_si256((__m256i *) (src2 + i + AVX_LEN_INT64));
+            v4sid res = _mm256_min_epu64_custom(a, b);
+            v4sid res2 = _mm256_min_epu64_custom(a2, b2);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src1[i] < src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void minmax64s_256s(int64_t *src, int len, int64_t *min_value, int64_t *max_value)
+{
+    if (len <= 0)
+        return;
+
+    int stop_len = len / AVX_LEN_INT64;
+    stop_len *= AVX_LEN_INT64;
+
+    __attribute__((aligned(AVX_LEN_BYTES))) int64_t max_f[AVX_LEN_INT64];
+    __attribute__((aligned(AVX_LEN_BYTES))) int64_t min_f[AVX_LEN_INT64];
+    int64_t max_tmp = src[0];
+    int64_t min_tmp = src[0];
+    v4sid max_v = _mm256_set1_epi64x((int64_t) src[0]);
+    v4sid min_v = max_v;
+
+    if (isAligned((uintptr_t) (src), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += AVX_LEN_INT64) {
+            v4sid a = _mm256_load_si256((__m256i *) (src + i));
+            max_v = _mm256_max_epi64_custom(max_v, a);
+            min_v = _mm256_min_epi64_custom(min_v, a);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX_LEN_INT64) {
+            v4sid a = _mm256_loadu_si256((__m256i *) (src + i));
+            max_v = _mm256_max_epi64_custom(max_v, a);
+            min_v = _mm256_min_epi64_custom(min_v, a);
+        }
+    }
+    _mm256_store_si256((__m256i *) max_f, max_v);
+    _mm256_store_si256((__m256i *) min_f, min_v);
+
+    for (int i = 0; i < AVX_LEN_INT64; i++) {
+        max_tmp = max_f[i] > max_tmp ? max_f[i] : max_tmp;
+        min_tmp = min_f[i] < min_tmp ? min_f[i] : min_tmp;
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        max_tmp = src[i] > max_tmp ? src[i] : max_tmp;
+        min_tmp = src[i] < min_tmp ? src[i] : min_tmp;
+    }
+
+    *max_value = max_tmp;
+    *min_value = min_tmp;
+}
+
+SIMD_UTILS_API void minmaxu64_256(uint64_t *src, int len, uint64_t *min_value, uint64_t *max_value)
+{
+    if (len <= 0)
+        return;
+
+    int stop_len = len / AVX_LEN_INT64;
+    stop_len *= AVX_LEN_INT64;
+
+    __attribute__((aligned(AVX_LEN_BYTES))) uint64_t max_f[AVX_LEN_INT64];
+    __attribute__((aligned(AVX_LEN_BYTES))) uint64_t min_f[AVX_LEN_INT64];
+    uint64_t max_tmp = src[0];
+    uint64_t min_tmp = src[0];
+    v4sid max_v = _mm256_set1_epi64x((int64_t) src[0]);
+    v4sid min_v = max_v;
+
+    if (isAligned((uintptr_t) (src), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += AVX_LEN_INT64) {
+            v4sid a = _mm256_load_si256((__m256i *) (src + i));
+            max_v = _mm256_max_epu64_custom(max_v, a);
+            min_v = _mm256_min_epu64_custom(min_v, a);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX_LEN_INT64) {
+            v4sid a = _mm256_loadu_si256((__m256i *) (src + i));
+            max_v = _mm256_max_epu64_custom(max_v, a);
+            min_v = _mm256_min_epu64_custom(min_v, a);
+        }
+    }
+    _mm256_store_si256((__m256i *) max_f, max_v);
+    _mm256_store_si256((__m256i *) min_f, min_v);
+
+    for (int i = 0; i < AVX_LEN_INT64; i++) {
+        max_tmp = max_f[i] > max_tmp ? max_f[i] : max_tmp;
+        min_tmp = min_f[i] < min_tmp ? min_f[i] : min_tmp;
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        max_tmp = src[i] > max_tmp ? src[i] : max_tmp;
+        min_tmp = src[i] < min_tmp ? src[i] : min_tmp;
+    }
+
+    *max_value = max_tmp;
+    *min_value = min_tmp;
+}
+
+// dst is all ones where the comparison holds, 0 elsewhere
+SIMD_UTILS_API void cmpeq64s_256s(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_INT64);
+    stop_len *= (2 * AVX_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            v4sid a = _mm256_load_si256((__m256i *) (src1 + i));
+            v4sid b = _mm256_load_si256((__m256i *) (src2 + i));
+            v4sid a2 = _mm256_load_si256((__m256i *) (src1 + i + AVX_LEN_INT64));
+            v4sid b2 = _mm256_load_si256((__m256i *) (src2 + i + AVX_LEN_INT64));
+            v4sid res = _mm256_cmpeq_epi64(a, b);
+            v4sid res2 = _mm256_cmpeq_epi64(a2, b2);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            v4sid a = _mm256_loadu_si256((__m256i *) (src1 + i));
+            v4sid b = _mm256_loadu_si256((__m256i *) (src2 + i));
+            v4sid a2 = _mm256_loadu_si256((__m256i *) (src1 + i + AVX_LEN_INT64));
+            v4sid b2 = _mm256_loadu_si256((__m256i *) (src2 + i + AVX_LEN_INT64));
+            v4sid res = _mm256_cmpeq_epi64(a, b);
+            v4sid res2 = _mm256_cmpeq_epi64(a2, b2);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src1[i] == src2[i] ? -1 : 0;
+    }
+}
+
+SIMD_UTILS_API void cmpgt64s_256s(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_INT64);
+    stop_len *= (2 * AVX_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            v4sid a = _mm256_load_si256((__m256i *) (src1 + i));
+            v4sid b = _mm256_load_si256((__m256i *) (src2 + i));
+            v4sid a2 = _mm256_load_si256((__m256i *) (src1 + i + AVX_LEN_INT64));
+            v4sid b2 = _mm256_load_si256((__m256i *) (src2 + i + AVX_LEN_INT64));
+            v4sid res = _mm256_cmpgt_epi64(a, b);
+            v4sid res2 = _mm256_cmpgt_epi64(a2, b2);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            v4sid a = _mm256_loadu_si256((__m256i *) (src1 + i));
+            v4sid b = _mm256_loadu_si256((__m256i *) (src2 + i));
+            v4sid a2 = _mm256_loadu_si256((__m256i *) (src1 + i + AVX_LEN_INT64));
+            v4sid b2 = _mm256_loadu_si256((__m256i *) (src2 + i + AVX_LEN_INT64));
+            v4sid res = _mm256_cmpgt_epi64(a, b);
+            v4sid res2 = _mm256_cmpgt_epi64(a2, b2);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src1[i] > src2[i] ? -1 : 0;
+    }
+}
+
+SIMD_UTILS_API void cmpgtu64_256(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_INT64);
+    stop_len *= (2 * AVX_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            v4sid a = _mm256_load_si256((__m256i *) (src1 + i));
+            v4sid b = _mm256_load_si256((__m256i *) (src2 + i));
+            v4sid a2 = _mm256_load_si256((__m256i *) (src1 + i + AVX_LEN_INT64));
+            v4sid b2 = _mm256_load_si256((__m256i *) (src2 + i + AVX_LEN_INT64));
+            v4sid res = _mm256_cmpgt_epu64_custom(a, b);
+            v4sid res2 = _mm256_cmpgt_epu64_custom(a2, b2);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            v4sid a = _mm256_loadu_si256((__m256i *) (src1 + i));
+            v4sid b = _mm256_loadu_si256((__m256i *) (src2 + i));
+            v4sid a2 = _mm256_loadu_si256((__m256i *) (src1 + i + AVX_LEN_INT64));
+            v4sid b2 = _mm256_loadu_si256((__m256i *) (src2 + i + AVX_LEN_INT64));
+            v4sid res = _mm256_cmpgt_epu64_custom(a, b);
+            v4sid res2 = _mm256_cmpgt_epu64_custom(a2, b2);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src1[i] > src2[i] ? UINT64_MAX : 0;
+    }
+}
+
+// shift in [0, 63]
+SIMD_UTILS_API void sll64s_256s(int64_t *src, int64_t *dst, int len, int shift)
+{
+    int stop_len = len / (2 * AVX_LEN_INT64);
+    stop_len *= (2 * AVX_LEN_INT64);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            v4sid a = _mm256_load_si256((__m256i *) (src + i));
+            v4sid a2 = _mm256_load_si256((__m256i *) (src + i + AVX_LEN_INT64));
+            v4sid res = _mm256_slli_epi64(a, shift);
+            v4sid res2 = _mm256_slli_epi64(a2, shift);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            v4sid a = _mm256_loadu_si256((__m256i *) (src + i));
+            v4sid a2 = _mm256_loadu_si256((__m256i *) (src + i + AVX_LEN_INT64));
+            v4sid res = _mm256_slli_epi64(a, shift);
+            v4sid res2 = _mm256_slli_epi64(a2, shift);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = (int64_t) ((uint64_t) src[i] << shift);
+    }
+}
+
+SIMD_UTILS_API void sra64s_256s(int64_t *src, int64_t *dst, int len, int shift)
+{
+    int stop_len = len / (2 * AVX_LEN_INT64);
+    stop_len *= (2 * AVX_LEN_INT64);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            v4sid a = _mm256_load_si256((__m256i *) (src + i));
+            v4sid a2 = _mm256_load_si256((__m256i *) (src + i + AVX_LEN_INT64));
+            v4sid res = _mm256_srai_epi64_custom(a, shift);
+            v4sid res2 = _mm256_srai_epi64_custom(a2, shift);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            v4sid a = _mm256_loadu_si256((__m256i *) (src + i));
+            v4sid a2 = _mm256_loadu_si256((__m256i *) (src + i + AVX_LEN_INT64));
+            v4sid res = _mm256_srai_epi64_custom(a, shift);
+            v4sid res2 = _mm256_srai_epi64_custom(a2, shift);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src[i] >> shift;
+    }
+}
+
+SIMD_UTILS_API void srlu64_256(uint64_t *src, uint64_t *dst, int len, int shift)
+{
+    int stop_len = len / (2 * AVX_LEN_INT64);
+    stop_len *= (2 * AVX_LEN_INT64);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            v4sid a = _mm256_load_si256((__m256i *) (src + i));
+            v4sid a2 = _mm256_load_si256((__m256i *) (src + i + AVX_LEN_INT64));
+            v4sid res = _mm256_srli_epi64(a, shift);
+            v4sid res2 = _mm256_srli_epi64(a2, shift);
+            _mm256_store_si256((__m256i *) (dst + i), res);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT64) {
+            v4sid a = _mm256_loadu_si256((__m256i *) (src + i));
+            v4sid a2 = _mm256_loadu_si256((__m256i *) (src + i + AVX_LEN_INT64));
+            v4sid res = _mm256_srli_epi64(a, shift);
+            v4sid res2 = _mm256_srli_epi64(a2, shift);
+            _mm256_storeu_si256((__m256i *) (dst + i), res);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src[i] >> shift;
+    }
+}
+
+SIMD_UTILS_API void powerspect16s_256s_interleaved(complex16s_t *src, int32_t *dst, int len)
+{
+    int stop_len = len / AVX_LEN_INT32;
+    stop_len *= AVX_LEN_INT32;
+
+    int j = 0;
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += AVX_LEN_INT32) {
+            __m256i reim = _mm256_load_si256((__m256i *) ((const int16_t *) src + j));
+            // print8i(reim); printf("\n");
+            _mm256_store_si256((__m256i *) (dst + i), _mm256_madd_epi16(reim, reim));
+            j += AVX_LEN_INT16;
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX_LEN_INT32) {
+            __m256i reim = _mm256_loadu_si256((__m256i *) ((const int16_t *) src + j));
+            _mm256_storeu_si256((__m256i *) (dst + i), _mm256_madd_epi16(reim, reim));
+            j += AVX_LEN_INT16;
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = (int32_t) src[i].re * (int32_t) src[i].re + (int32_t) src[i].im * (int32_t) src[i].im;
+    }
+}
+
+SIMD_UTILS_API void sum16s32s256(int16_t *src, int len, int32_t *dst, int scale_factor)
+{
+    int stop_len = len / (4 * AVX_LEN_INT16);
+    stop_len *= (4 * AVX_LEN_INT16);
+
+    __attribute__((aligned(AVX_LEN_BYTES))) int32_t accumulate[AVX_LEN_INT32] = {0, 0, 0, 0,
+                                                                                 0, 0, 0, 0};
+    int32_t tmp_acc = 0;
+    int16_t scale = 1 << scale_factor;
+    v8si one = _mm256_set1_epi16(1);
+    v8si vec_acc1 = _mm256_setzero_si256();  // initialize the vector accumulator
+    v8si vec_acc2 = _mm256_setzero_si256();  // initialize the vector accumulator
+
+    if (isAligned((uintptr_t) (src), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 4 * AVX_LEN_INT16) {
+            v8si vec_src_tmp = _mm256_load_si256((__m256i *) ((const int16_t *) src + i));
+            v8si vec_src_tmp2 = _mm256_load_si256((__m256i *) ((const int16_t *) src + i + AVX_LEN_INT16));
+            v8si vec_src_tmp3 = _mm256_load_si256((__m256i *) ((const int16_t *) src + i + 2 * AVX_LEN_INT16));
+            v8si vec_src_tmp4 = _mm256_load_si256((__m256i *) ((const int16_t *) src + i + 3 * AVX_LEN_INT16));
+            vec_src_tmp = _mm256_madd_epi16(vec_src_tmp, one);
+            vec_src_tmp2 = _mm256_madd_epi16(vec_src_tmp2, one);
+            vec_src_tmp3 = _mm256_madd_epi16(vec_src_tmp3, one);
+            vec_src_tmp4 = _mm256_madd_epi16(vec_src_tmp4, one);
+            vec_src_tmp = _mm256_add_epi32(vec_src_tmp, vec_src_tmp2);
+            vec_src_tmp3 = _mm256_add_epi32(vec_src_tmp3, vec_src_tmp4);
+            vec_acc1 = _mm256_add_epi32(vec_src_tmp, vec_acc1);
+            vec_acc2 = _mm256_add_epi32(vec_src_tmp3, vec_acc2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 4 * AVX_LEN_INT16) {
+            v8si vec_src_tmp = _mm256_loadu_si256((__m256i *) ((const int16_t *) src + i));
+            v8si vec_src_tmp2 = _mm256_loadu_si256((__m256i *) ((const int16_t *) src + i + AVX_LEN_INT16));
+            v8si vec_src_tmp3 = _mm256_loadu_si256((__m256i *) ((const int16_t *) src + i + 2 * AVX_LEN_INT16));
+            v8si vec_src_tmp4 = _mm256_loadu_si256((__m256i *) ((const int16_t *) src + i + 3 * AVX_LEN_INT16));
+            vec_src_tmp = _mm256_madd_epi16(vec_src_tmp, one);
+            vec_src_tmp2 = _mm256_madd_epi16(vec_src_tmp2, one);
+            vec_src_tmp3 = _mm256_madd_epi16(vec_src_tmp3, one);
+            vec_src_tmp4 = _mm256_madd_epi16(vec_src_tmp4, one);
+            vec_src_tmp = _mm256_add_epi32(vec_src_tmp, vec_src_tmp2);
+            vec_src_tmp3 = _mm256_add_epi32(vec_src_tmp3, vec_src_tmp4);
+            vec_acc1 = _mm256_add_epi32(vec_src_tmp, vec_acc1);
+            vec_acc2 = _mm256_add_epi32(vec_src_tmp3, vec_acc2);
+        }
+    }
+
+    vec_acc1 = _mm256_add_epi32(vec_acc1, vec_acc2);
+    _mm256_store_si256((v8si *) accumulate, vec_acc1);
+
+    for (int i = stop_len; i < len; i++) {
+        tmp_acc += (int32_t) src[i];
+    }
+
+    tmp_acc = tmp_acc + accumulate[0] + accumulate[1] + accumulate[2] + accumulate[3] +
+              accumulate[4] + accumulate[5] + accumulate[6] + accumulate[7];
+    tmp_acc /= scale;
+    *dst = tmp_acc;
+}
+
+SIMD_UTILS_API void flip256s(int32_t *src, int32_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_INT32);
+    stop_len *= (2 * AVX_LEN_INT32);
+
+    int mini = ((len - 1) < (2 * AVX_LEN_INT32)) ? (len - 1) : (2 * AVX_LEN_INT32);
+    for (int i = 0; i < mini; i++) {
+        dst[len - i - 1] = src[i];
+    }
+
+    // Since we work in reverse we do not know for sure if destination address will be aligned
+    // Could it be improved?
+    v8si reverse_reg = _mm256_set_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst + len - AVX_LEN_INT32), AVX_LEN_BYTES)) {
+        for (int i = 2 * AVX_LEN_INT32; i < stop_len; i += 2 * AVX_LEN_INT32) {
+            v8si src_tmp = _mm256_load_si256((__m256i *) (src + i));                   // load a,b,c,d,e,f,g,h
+            v8si src_tmp2 = _mm256_load_si256((__m256i *) (src + i + AVX_LEN_INT32));  // load a,b,c,d,e,f,g,h
+
+            v8si src_tmp_flip = _mm256_permutevar8x32_epi32(src_tmp, reverse_reg);                // reverse lanes abcdefgh to hgfedcba
+            v8si src_tmp_flip2 = _mm256_permutevar8x32_epi32(src_tmp2, reverse_reg);              // reverse lanes abcdefgh to hgfedcba
+            _mm256_storeu_si256((__m256i *) (dst + len - i - AVX_LEN_INT32), src_tmp_flip);       // store the flipped vector
+            _mm256_storeu_si256((__m256i *) (dst + len - i - 2 * AVX_LEN_INT32), src_tmp_flip2);  // store the flipped vector
+        }
+    } else {
+        for (int i = 2 * AVX_LEN_INT32; i < stop_len; i += 2 * AVX_LEN_INT32) {
+            v8si src_tmp = _mm256_loadu_si256((__m256i *) (src + i));                   // load a,b,c,d,e,f,g,h
+            v8si src_tmp2 = _mm256_loadu_si256((__m256i *) (src + i + AVX_LEN_INT32));  // load a,b,c,d,e,f,g,h
+            v8si src_tmp_flip = _mm256_permutevar8x32_epi32(src_tmp, reverse_reg);      // reverse lanes abcdefgh to hgfedcba
+            v8si src_tmp_flip2 = _mm256_permutevar8x32_epi32(src_tmp2, reverse_reg);    // reverse lanes abcdefgh to hgfedcba
+
+            _mm256_storeu_si256((__m256i *) (dst + len - i - AVX_LEN_INT32), src_tmp_flip);       // store the flipped vector
+            _mm256_storeu_si256((__m256i *) (dst + len - i - 2 * AVX_LEN_INT32), src_tmp_flip2);  // store the flipped vector
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[len - i - 1] = src[i];
+    }
+}
+
+SIMD_UTILS_API void maxevery256s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_INT32);
+    stop_len *= (2 * AVX_LEN_INT32);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
+            v8si src1_tmp = _mm256_load_si256((__m256i *) ((const int32_t *) src1 + i));
+            v8si src2_tmp = _mm256_load_si256((__m256i *) ((const int32_t *) src2 + i));
+            v8si src1_tmp2 = _mm256_load_si256((__m256i *) ((const int32_t *) src1 + i + AVX_LEN_INT32));
+            v8si src2_tmp2 = _mm256_load_si256((__m256i *) ((const int32_t *) src2 + i + AVX_LEN_INT32));
+            v8si max1 = _mm256_max_epi32(src1_tmp, src2_tmp);
+            v8si max2 = _mm256_max_epi32(src1_tmp2, src2_tmp2);
+            _mm256_store_si256((__m256i *) (dst + i), max1);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT32), max2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
+            v8si src1_tmp = _mm256_loadu_si256((__m256i *) (src1 + i));
+            v8si src2_tmp = _mm256_loadu_si256((__m256i *) (src2 + i));
+            v8si src1_tmp2 = _mm256_loadu_si256((__m256i *) (src1 + i + AVX_LEN_INT32));
+            v8si src2_tmp2 = _mm256_loadu_si256((__m256i *) (src2 + i + AVX_LEN_INT32));
+            v8si max1 = _mm256_max_epi32(src1_tmp, src2_tmp);
+            v8si max2 = _mm256_max_epi32(src1_tmp2, src2_tmp2);
+            _mm256_storeu_si256((__m256i *) (dst + i), max1);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT32), max2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src1[i] > src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void minevery256s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+{
+    int stop_len = len / (2 * AVX_LEN_INT32);
+    stop_len *= (2 * AVX_LEN_INT32);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
+            v8si src1_tmp = _mm256_load_si256((__m256i *) ((const int32_t *) src1 + i));
+            v8si src2_tmp = _mm256_load_si256((__m256i *) ((const int32_t *) src2 + i));
+            v8si src1_tmp2 = _mm256_load_si256((__m256i *) ((const int32_t *) src1 + i + AVX_LEN_INT32));
+            v8si src2_tmp2 = _mm256_load_si256((__m256i *) ((const int32_t *) src2 + i + AVX_LEN_INT32));
+            v8si min1 = _mm256_min_epi32(src1_tmp, src2_tmp);
+            v8si min2 = _mm256_min_epi32(src1_tmp2, src2_tmp2);
+            _mm256_store_si256((__m256i *) (dst + i), min1);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT32), min2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
+            v8si src1_tmp = _mm256_loadu_si256((__m256i *) (src1 + i));
+            v8si src2_tmp = _mm256_loadu_si256((__m256i *) (src2 + i));
+            v8si src1_tmp2 = _mm256_loadu_si256((__m256i *) (src1 + i + AVX_LEN_INT32));
+            v8si src2_tmp2 = _mm256_loadu_si256((__m256i *) (src2 + i + AVX_LEN_INT32));
+            v8si min1 = _mm256_min_epi32(src1_tmp, src2_tmp);
+            v8si min2 = _mm256_min_epi32(src1_tmp2, src2_tmp2);
+            _mm256_storeu_si256((__m256i *) (dst + i), min1);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT32), min2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src1[i] < src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void minmax256s(int32_t *src, int len, int32_t *min_value, int32_t *max_value)
+{
+    int stop_len = (len - AVX_LEN_INT32) / (2 * AVX_LEN_INT32);
+    stop_len *= (2 * AVX_LEN_INT32);
+    stop_len = (stop_len < 0) ? 0 : stop_len;
+
+    v8si max_v, min_v, max_v2, min_v2;
+    v8si src_tmp, src_tmp2;
+
+    int32_t min_tmp = src[0];
+    int32_t max_tmp = src[0];
+
+    __attribute__((aligned(SSE_LEN_BYTES))) int32_t max_f[SSE_LEN_INT32];
+    __attribute__((aligned(SSE_LEN_BYTES))) int32_t min_f[SSE_LEN_INT32];
+
+    if (len >= AVX_LEN_INT32) {
+        if (isAligned((uintptr_t) (src), AVX_LEN_BYTES)) {
+            src_tmp = _mm256_load_si256((__m256i *) (src + 0));
+            max_v = src_tmp;
+            min_v = src_tmp;
+            max_v2 = src_tmp;
+            min_v2 = src_tmp;
+
+            for (int i = AVX_LEN_INT32; i < stop_len; i += 2 * AVX_LEN_INT32) {
+                src_tmp = _mm256_load_si256((__m256i *) (src + i));
+                src_tmp2 = _mm256_load_si256((__m256i *) (src + i + AVX_LEN_INT32));
+                max_v = _mm256_max_epi32(max_v, src_tmp);
+                min_v = _mm256_min_epi32(min_v, src_tmp);
+                max_v2 = _mm256_max_epi32(max_v2, src_tmp2);
+                min_v2 = _mm256_min_epi32(min_v2, src_tmp2);
+            }
+        } else {
+            src_tmp = _mm256_loadu_si256((__m256i *) (src + 0));
+            max_v = src_tmp;
+            min_v = src_tmp;
+            max_v2 = src_tmp;
+            min_v2 = src_tmp;
+
+            for (int i = AVX_LEN_INT32; i < stop_len; i += 2 * AVX_LEN_INT32) {
+                src_tmp = _mm256_loadu_si256((__m256i *) (src + i));
+                src_tmp2 = _mm256_loadu_si256((__m256i *) (src + i + AVX_LEN_INT32));
+                max_v = _mm256_max_epi32(max_v, src_tmp);
+                min_v = _mm256_min_epi32(min_v, src_tmp);
+                max_v2 = _mm256_max_epi32(max_v2, src_tmp2);
+                min_v2 = _mm256_min_epi32(min_v2, src_tmp2);
+            }
+        }
+
+        max_v = _mm256_max_epi32(max_v, max_v2);
+        min_v = _mm256_min_epi32(min_v, min_v2);
+
+        v4si max3 = _mm256_castsi256_si128(max_v);
+        v4si min3 = _mm256_castsi256_si128(min_v);
+        v4si max4 = _mm256_extracti128_si256(max_v, 1);
+        v4si min4 = _mm256_extracti128_si256(min_v, 1);
+        max4 = _mm_max_epi32(max3, max4);
+        min4 = _mm_min_epi32(min3, min4);
+
+        _mm_store_si128((__m128i *) (max_f), max4);
+        _mm_store_si128((__m128i *) (min_f), min4);
+
+        max_tmp = max_f[0];
+        max_tmp = max_tmp > max_f[1] ? max_tmp : max_f[1];
+        max_tmp = max_tmp > max_f[2] ? max_tmp : max_f[2];
+        max_tmp = max_tmp > max_f[3] ? max_tmp : max_f[3];
+
+        min_tmp = min_f[0];
+        min_tmp = min_tmp < min_f[1] ? min_tmp : min_f[1];
+        min_tmp = min_tmp < min_f[2] ? min_tmp : min_f[2];
+        min_tmp = min_tmp < min_f[3] ? min_tmp : min_f[3];
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        max_tmp = max_tmp > src[i] ? max_tmp : src[i];
+        min_tmp = min_tmp < src[i] ? min_tmp : src[i];
+    }
+
+    *max_value = max_tmp;
+    *min_value = min_tmp;
+}
+
+SIMD_UTILS_API void threshold256_gt_s(int32_t *src, int32_t *dst, int len, int32_t value)
+{
+    const v8si tmp = _mm256_set1_epi32(value);
+
+    int stop_len = len / (2 * AVX_LEN_INT32);
+    stop_len *= (2 * AVX_LEN_INT32);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
+            v8si src_tmp = _mm256_load_si256((__m256i *) (src + i));
+            v8si src_tmp2 = _mm256_load_si256((__m256i *) (src + i + AVX_LEN_INT32));
+            v8si dst_tmp = _mm256_min_epi32(src_tmp, tmp);
+            v8si dst_tmp2 = _mm256_min_epi32(src_tmp2, tmp);
+            _mm256_store_si256((__m256i *) (dst + i), dst_tmp);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT32), dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
+            v8si src_tmp = _mm256_loadu_si256((__m256i *) (src + i));
+            v8si src_tmp2 = _mm256_loadu_si256((__m256i *) (src + i + AVX_LEN_INT32));
+            v8si dst_tmp = _mm256_min_epi32(src_tmp, tmp);
+            v8si dst_tmp2 = _mm256_min_epi32(src_tmp2, tmp);
+            _mm256_storeu_si256((__m256i *) (dst + i), dst_tmp);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT32), dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src[i] < value ? src[i] : value;
+    }
+}
+
+SIMD_UTILS_API void threshold256_gtabs_s(int32_t *src, int32_t *dst, int len, int32_t value)
+{
+    const v8si pval = _mm256_set1_epi32(value);
+    const v8si mval = _mm256_set1_epi32(-value);
+
+    int stop_len = len / (2 * AVX_LEN_INT32);
+    stop_len *= (2 * AVX_LEN_INT32);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
+            v8si src_tmp = _mm256_load_si256((__m256i *) (src + i));
+            v8si src_tmp2 = _mm256_load_si256((__m256i *) (src + i + AVX_LEN_INT32));
+            v8si src_abs = _mm256_abs_epi32(src_tmp);
+            v8si src_abs2 = _mm256_abs_epi32(src_tmp2);
+            v8si eqmask = _mm256_cmpeq_epi32(src_abs, src_tmp);  // if A = abs(A), then A is >= 0 (mask 0xFFFFFFFF)
+            v8si eqmask2 = _mm256_cmpeq_epi32(src_abs2, src_tmp2);
+            v8si max = _mm256_min_epi32(src_tmp, pval);
+            v8si max2 = _mm256_min_epi32(src_tmp2, pval);
+            v8si min = _mm256_max_epi32(src_tmp, mval);
+            v8si min2 = _mm256_max_epi32(src_tmp2, mval);
+            v8si dst_tmp = _mm256_blendv_epi8(min, max, eqmask);
+            v8si dst_tmp2 = _mm256_blendv_epi8(min2, max2, eqmask2);
+            _mm256_store_si256((__m256i *) (dst + i), dst_tmp);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT32), dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
+            v8si src_tmp = _mm256_loadu_si256((__m256i *) (src + i));
+            v8si src_tmp2 = _mm256_loadu_si256((__m256i *) (src + i + AVX_LEN_INT32));
+            v8si src_abs = _mm256_abs_epi32(src_tmp);
+            v8si src_abs2 = _mm256_abs_epi32(src_tmp2);
+            v8si eqmask = _mm256_cmpeq_epi32(src_abs, src_tmp);  // if A = abs(A), then A is >= 0 (mask 0xFFFFFFFF)
+            v8si eqmask2 = _mm256_cmpeq_epi32(src_abs2, src_tmp2);
+            v8si max = _mm256_min_epi32(src_tmp, pval);
+            v8si max2 = _mm256_min_epi32(src_tmp2, pval);
+            v8si min = _mm256_max_epi32(src_tmp, mval);
+            v8si min2 = _mm256_max_epi32(src_tmp2, mval);
+            v8si dst_tmp = _mm256_blendv_epi8(min, max, eqmask);
+            v8si dst_tmp2 = _mm256_blendv_epi8(min2, max2, eqmask2);
+            _mm256_storeu_si256((__m256i *) (dst + i), dst_tmp);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT32), dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        if (src[i] >= 0) {
+            dst[i] = src[i] > value ? value : src[i];
+        } else {
+            dst[i] = src[i] < (-value) ? (-value) : src[i];
+        }
+    }
+}
+
+SIMD_UTILS_API void threshold256_lt_s(int32_t *src, int32_t *dst, int len, int32_t value)
+{
+    const v8si tmp = _mm256_set1_epi32(value);
+
+    int stop_len = len / (2 * AVX_LEN_INT32);
+    stop_len *= (2 * AVX_LEN_INT32);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
+            v8si src_tmp = _mm256_load_si256((__m256i *) (src + i));
+            v8si src_tmp2 = _mm256_load_si256((__m256i *) (src + i + AVX_LEN_INT32));
+            v8si dst_tmp = _mm256_max_epi32(src_tmp, tmp);
+            v8si dst_tmp2 = _mm256_max_epi32(src_tmp2, tmp);
+            _mm256_store_si256((__m256i *) (dst + i), dst_tmp);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT32), dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
+            v8si src_tmp = _mm256_loadu_si256((__m256i *) (src + i));
+            v8si src_tmp2 = _mm256_loadu_si256((__m256i *) (src + i + AVX_LEN_INT32));
+            v8si dst_tmp = _mm256_max_epi32(src_tmp, tmp);
+            v8si dst_tmp2 = _mm256_max_epi32(src_tmp2, tmp);
+            _mm256_storeu_si256((__m256i *) (dst + i), dst_tmp);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT32), dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src[i] > value ? src[i] : value;
+    }
+}
+
+SIMD_UTILS_API void threshold256_ltabs_s(int32_t *src, int32_t *dst, int len, int32_t value)
+{
+    const v8si pval = _mm256_set1_epi32(value);
+    const v8si mval = _mm256_set1_epi32(-value);
+
+    int stop_len = len / (2 * AVX_LEN_INT32);
+    stop_len *= (2 * AVX_LEN_INT32);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
+            v8si src_tmp = _mm256_load_si256((__m256i *) (src + i));
+            v8si src_tmp2 = _mm256_load_si256((__m256i *) (src + i + AVX_LEN_INT32));
+            v8si src_abs = _mm256_abs_epi32(src_tmp);
+            v8si src_abs2 = _mm256_abs_epi32(src_tmp2);
+            v8si eqmask = _mm256_cmpeq_epi32(src_abs, src_tmp);  // if A = abs(A), then A is >= 0 (mask 0xFFFFFFFF)
+            v8si eqmask2 = _mm256_cmpeq_epi32(src_abs2, src_tmp2);
+            v8si max = _mm256_max_epi32(src_tmp, pval);
+            v8si max2 = _mm256_max_epi32(src_tmp2, pval);
+            v8si min = _mm256_min_epi32(src_tmp, mval);
+            v8si min2 = _mm256_min_epi32(src_tmp2, mval);
+            v8si dst_tmp = _mm256_blendv_epi8(min, max, eqmask);
+            v8si dst_tmp2 = _mm256_blendv_epi8(min2, max2, eqmask2);
+            _mm256_store_si256((__m256i *) (dst + i), dst_tmp);
+            _mm256_store_si256((__m256i *) (dst + i + AVX_LEN_INT32), dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
+            v8si src_tmp = _mm256_loadu_si256((__m256i *) (src + i));
+            v8si src_tmp2 = _mm256_loadu_si256((__m256i *) (src + i + AVX_LEN_INT32));
+            v8si src_abs = _mm256_abs_epi32(src_tmp);
+            v8si src_abs2 = _mm256_abs_epi32(src_tmp2);
+            v8si eqmask = _mm256_cmpeq_epi32(src_abs, src_tmp);  // if A = abs(A), then A is >= 0 (mask 0xFFFFFFFF)
+            v8si eqmask2 = _mm256_cmpeq_epi32(src_abs2, src_tmp2);
+            v8si max = _mm256_max_epi32(src_tmp, pval);
+            v8si max2 = _mm256_max_epi32(src_tmp2, pval);
+            v8si min = _mm256_min_epi32(src_tmp, mval);
+            v8si min2 = _mm256_min_epi32(src_tmp2, mval);
+            v8si dst_tmp = _mm256_blendv_epi8(min, max, eqmask);
+            v8si dst_tmp2 = _mm256_blendv_epi8(min2, max2, eqmask2);
+            _mm256_storeu_si256((__m256i *) (dst + i), dst_tmp);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT32), dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        if (src[i] >= 0) {
+            dst[i] = src[i] < value ? value : src[i];
+        } else {
+            dst[i] = src[i] > (-value) ? (-value) : src[i];
+        }
+    }
+}
+
+// no cmplt_epi32 with AVX2. gt(b,a) = le(a,b), not lt. To be improved?
+SIMD_UTILS_API void threshold256_ltval_gtval_s(int32_t *src, int32_t *dst, int len, int32_t ltlevel, int32_t ltvalue, int32_t gtlevel, int32_t gtvalue)
+{
+    const v8si ltlevel_v = _mm256_set1_epi32(ltlevel);
+    const v8si ltvalue_v = _mm256_set1_epi32(ltvalue);
+    const v8si gtlevel_v = _mm256_set1_epi32(gtlevel);
+    const v8si gtvalue_v = _mm256_set1_epi32(gtvalue);
+
+    int stop_len = len / (2 * AVX_LEN_FLOAT);
+    stop_len *= (2 * AVX_LEN_FLOAT);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
+            v8si src_tmp = _mm256_load_si256((v8si *) (src + i));
+            v8si src_tmp2 = _mm256_load_si256((v8si *) (src + i + AVX_LEN_INT32));
+            v8si lt_mask = _mm256_cmpgt_epi32(ltlevel_v, src_tmp);
+            v8si gt_mask = _mm256_cmpgt_epi32(src_tmp, gtlevel_v);
+            v8si dst_tmp = _mm256_blendv_epi8(src_tmp, ltvalue_v, lt_mask);
+            dst_tmp = _mm256_blendv_epi8(dst_tmp, gtvalue_v, gt_mask);
+            _mm256_store_si256((v8si *) (dst + i), dst_tmp);
+            v8si lt_mask2 = _mm256_cmpgt_epi32(ltlevel_v, src_tmp2);
+            v8si gt_mask2 = _mm256_cmpgt_epi32(src_tmp2, gtlevel_v);
+            v8si dst_tmp2 = _mm256_blendv_epi8(src_tmp2, ltvalue_v, lt_mask2);
+            dst_tmp2 = _mm256_blendv_epi8(dst_tmp2, gtvalue_v, gt_mask2);
+            _mm256_store_si256((v8si *) (dst + i + AVX_LEN_INT32), dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
+            v8si src_tmp = _mm256_loadu_si256((v8si *) (src + i));
+            v8si src_tmp2 = _mm256_loadu_si256((v8si *) (src + i + AVX_LEN_INT32));
+            v8si lt_mask = _mm256_cmpgt_epi32(ltlevel_v, src_tmp);
+            v8si gt_mask = _mm256_cmpgt_epi32(src_tmp, gtlevel_v);
+            v8si dst_tmp = _mm256_blendv_epi8(src_tmp, ltvalue_v, lt_mask);
+            dst_tmp = _mm256_blendv_epi8(dst_tmp, gtvalue_v, gt_mask);
+            _mm256_storeu_si256((v8si *) (dst + i), dst_tmp);
+            v8si lt_mask2 = _mm256_cmpgt_epi32(ltlevel_v, src_tmp2);
+            v8si gt_mask2 = _mm256_cmpgt_epi32(src_tmp2, gtlevel_v);
+            v8si dst_tmp2 = _mm256_blendv_epi8(src_tmp2, ltvalue_v, lt_mask2);
+            dst_tmp2 = _mm256_blendv_epi8(dst_tmp2, gtvalue_v, gt_mask2);
+            _mm256_storeu_si256((v8si *) (dst + i + AVX_LEN_INT32), dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src[i] < ltlevel ? ltvalue : src[i];
+        dst[i] = src[i] > gtlevel ? gtvalue : dst[i];
+    }
+}
+
+// is it useful to unroll?
+SIMD_UTILS_API void gatheri_256s(int32_t *src, int32_t *dst, int stride, int offset, int len)
+{
+    int stop_len = len / (AVX_LEN_INT32);
+    stop_len *= (AVX_LEN_INT32);
+
+    v8si vindex = _mm256_setr_epi32(offset, stride + offset, 2 * stride + offset, 3 * stride + offset,
+                                    4 * stride + offset, 5 * stride + offset, 6 * stride + offset, 7 * stride + offset);
+
+    if (isAligned((uintptr_t) (dst), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += AVX_LEN_INT32) {
+            v8si tmp = _mm256_i32gather_epi32((const int *) (src + i * AVX_LEN_INT32), vindex, 1);
+            _mm256_store_si256((v8si *) (dst + i * AVX_LEN_INT32), tmp);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX_LEN_INT32) {
+            v8si tmp = _mm256_i32gather_epi32((const int *) (src + i * AVX_LEN_INT32), vindex, 1);
+            _mm256_storeu_si256((v8si *) (dst + i * AVX_LEN_INT32), tmp);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src[i * stride + offset];
+    }
+}
+
+// first index of value in src, len if it is not found
+static inline int firsteq256s(int32_t *src, int len, int32_t value)
+{
+    int stop_len = len / (2 * AVX_LEN_INT32);
+    stop_len *= (2 * AVX_LEN_INT32);
+
+    v8si value_v = _mm256_set1_epi32(value);
+    for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
+        uint32_t mask = (uint32_t) _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_loadu_si256((__m256i *) (src + i)), value_v)));
+        mask |= (uint32_t) _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_loadu_si256((__m256i *) (src + i + AVX_LEN_INT32)), value_v))) << 8;
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+    for (int i = stop_len; i < len; i++) {
+        if (src[i] == value)
+            return i;
+    }
+    return len;
+}
+
+SIMD_UTILS_API void maxloc256s(int32_t *src, int32_t *max, int *idx, int len)
+{
+    minmaxloc_runs(src, len, minmax256s, firsteq256s, NULL, NULL, max, idx);
+}
+
+SIMD_UTILS_API void minloc256s(int32_t *src, int32_t *min, int *idx, int len)
+{
+    minmaxloc_runs(src, len, minmax256s, firsteq256s, min, idx, NULL, NULL);
+}
+
+SIMD_UTILS_API void minmaxloc256s(int32_t *src, int len, int32_t *min_value, int *min_idx, int32_t *max_value, int *max_idx)
+{
+    minmaxloc_runs(src, len, minmax256s, firsteq256s, min_value, min_idx, max_value, max_idx);
+}
+
+SIMD_UTILS_API void minmax16s_256s(int16_t *src, int len, int16_t *min_value, int16_t *max_value)
+{
+    int stop_len = (len - AVX_LEN_INT16) / (2 * AVX_LEN_INT16);
+    stop_len *= (2 * AVX_LEN_INT16);
+    stop_len = (stop_len < 0) ? 0 : stop_len;
+
+    int16_t min_s[AVX_LEN_INT16] __attribute__((aligned(AVX_LEN_BYTES)));
+    int16_t max_s[AVX_LEN_INT16] __attribute__((aligned(AVX_LEN_BYTES)));
+    __m256i max_v, min_v, max_v2, min_v2;
+    __m256i src_tmp, src_tmp2;
+
+    int16_t min_tmp = src[0];
+    int16_t max_tmp = src[0];
+
+    if (len >= AVX_LEN_INT16) {
+        if (isAligned((uintptr_t) (src), AVX_LEN_BYTES)) {
+            src_tmp = _mm256_load_si256((__m256i *) (src + 0));
+            max_v = src_tmp;
+            min_v = src_tmp;
+            max_v2 = src_tmp;
+            min_v2 = src_tmp;
+
+            for (int i = AVX_LEN_INT16; i < stop_len; i += 2 * AVX_LEN_INT16) {
+                src_tmp = _mm256_load_si256((__m256i *) (src + i));
+                src_tmp2 = _mm256_load_si256((__m256i *) (src + i + AVX_LEN_INT16));
+                max_v = _mm256_max_epi16(max_v, src_tmp);
+                min_v = _mm256_min_epi16(min_v, src_tmp);
+                max_v2 = _mm256_max_epi16(max_v2, src_tmp2);
+                min_v2 = _mm256_min_epi16(min_v2, src_tmp2);
+            }
+        } else {
+            src_tmp = _mm256_loadu_si256((__m256i *) (src + 0));
+            max_v = src_tmp;
+            min_v = src_tmp;
+            max_v2 = src_tmp;
+            min_v2 = src_tmp;
+
+            for (int i = AVX_LEN_INT16; i < stop_len; i += 2 * AVX_LEN_INT16) {
+                src_tmp = _mm256_loadu_si256((__m256i *) (src + i));
+                src_tmp2 = _mm256_loadu_si256((__m256i *) (src + i + AVX_LEN_INT16));
+                max_v = _mm256_max_epi16(max_v, src_tmp);
+                min_v = _mm256_min_epi16(min_v, src_tmp);
+                max_v2 = _mm256_max_epi16(max_v2, src_tmp2);
+                min_v2 = _mm256_min_epi16(min_v2, src_tmp2);
+            }
+        }
+
+        max_v = _mm256_max_epi16(max_v, max_v2);
+        min_v = _mm256_min_epi16(min_v, min_v2);
+
+        _mm256_store_si256((__m256i *) (max_s), max_v);
+        _mm256_store_si256((__m256i *) (min_s), min_v);
+
+        max_tmp = max_s[0];
+        min_tmp = min_s[0];
+        for (int i = 1; i < AVX_LEN_INT16; i++) {
+            max_tmp = max_tmp > max_s[i] ? max_tmp : max_s[i];
+            min_tmp = min_tmp < min_s[i] ? min_tmp : min_s[i];
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        max_tmp = max_tmp > src[i] ? max_tmp : src[i];
+        min_tmp = min_tmp < src[i] ? min_tmp : src[i];
+    }
+
+    *max_value = max_tmp;
+    *min_value = min_tmp;
+}
+
+// first index of value in src, len if it is not found
+static inline int firsteq16s_256s(int16_t *src, int len, int16_t value)
+{
+    int stop_len = len / (2 * AVX_LEN_INT16);
+    stop_len *= (2 * AVX_LEN_INT16);
+
+    __m256i value_v = _mm256_set1_epi16(value);
+    for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT16) {
+        uint64_t mask = (uint64_t) _mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_loadu_si256((__m256i *) (src + i)), value_v));
+        mask |= (uint64_t) _mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_loadu_si256((__m256i *) (src + i + AVX_LEN_INT16)), value_v)) << 32;
+        if (mask)
+            return i + (__builtin_ctzll(mask) >> 1);
+    }
+    for (int i = stop_len; i < len; i++) {
+        if (src[i] == value)
+            return i;
+    }
+    return len;
+}
+
+SIMD_UTILS_API void maxloc16s_256s(int16_t *src, int16_t *max, int *idx, int len)
+{
+    minmaxloc_run16s(src, len, minmax16s_256s, firsteq16s_256s, NULL, NULL, max, idx);
+}
+
+SIMD_UTILS_API void minloc16s_256s(int16_t *src, int16_t *min, int *idx, int len)
+{
+    minmaxloc_run16s(src, len, minmax16s_256s, firsteq16s_256s, min, idx, NULL, NULL);
+}
+
+SIMD_UTILS_API void minmaxloc16s_256s(int16_t *src, int len, int16_t *min_value, int *min_idx, int16_t *max_value, int *max_idx)
+{
+    minmaxloc_run16s(src, len, minmax16s_256s, firsteq16s_256s, min_value, min_idx, max_value, max_idx);
+}
+
+// bins of histogram256s and histogram16s_256s, nb_bins outside of the bins (see simd_utils_hist.h)
+static inline v8si hist_bin256s(v8si x, v8si low_vec, __m128i shift, v8si last_vec, v8si out_vec)
+{
+    v8si bin = _mm256_sra_epi32(_mm256_sub_epi32(x, low_vec), shift);  // negative below low
+    v8si in = _mm256_cmpeq_epi32(_mm256_min_epu32(bin, last_vec), bin);          // 0 <= bin <= nb_bins - 1
+    return _mm256_blendv_epi8(out_vec, bin, in);
+}
+
+static inline void bins256s(int32_t *src, int len, int32_t low, int shift, int nb_bins, int32_t *bins)
+{
+    int stop_len = len / AVX_LEN_INT32;
+    stop_len *= AVX_LEN_INT32;
+
+    v8si low_vec = _mm256_set1_epi32(low);
+    __m128i shift_vec = _mm_cvtsi32_si128(shift);
+    v8si last_vec = _mm256_set1_epi32(nb_bins - 1);
+    v8si out_vec = _mm256_set1_epi32(nb_bins);
+
+    if (isAligned((uintptr_t) (src), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += AVX_LEN_INT32) {
+            v8si x = _mm256_load_si256((v8si *) (src + i));
+            _mm256_store_si256((v8si *) (bins + i), hist_bin256s(x, low_vec, shift_vec, last_vec, out_vec));
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX_LEN_INT32) {
+            v8si x = _mm256_loadu_si256((v8si *) (src + i));
+            _mm256_store_si256((v8si *) (bins + i), hist_bin256s(x, low_vec, shift_vec, last_vec, out_vec));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        bins[i] = hist_bini(src[i], low, shift, nb_bins);
+    }
+}
+
+SIMD_UTILS_API void histogram256s(int32_t *src, int len, int32_t low, int shift, int nb_bins, uint32_t *hist)
+{
+    hist_state_t st;
+
+    hist_begin(&st, hist, nb_bins);
+    for (int start = 0; start < len; start += HIST_BLOCK_LEN) {
+        int block_len = hist_block_len(len, start);
+        bins256s(src + start, block_len, low, shift, nb_bins, st.bins);
+        hist_count(&st, block_len);
+    }
+    hist_end(&st);
+}
+
+static inline void bins16s_256s(int16_t *src, int len, int32_t low, int shift, int nb_bins, int32_t *bins)
+{
+    int stop_len = len / AVX_LEN_INT16;
+    stop_len *= AVX_LEN_INT16;
+
+    v8si low_vec = _mm256_set1_epi32(low);
+    __m128i shift_vec = _mm_cvtsi32_si128(shift);
+    v8si last_vec = _mm256_set1_epi32(nb_bins - 1);
+    v8si out_vec = _mm256_set1_epi32(nb_bins);
+
+    if (isAligned((uintptr_t) (src), AVX_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += AVX_LEN_INT16) {
+            v8si x = _mm256_load_si256((v8si *) (src + i));
+            _mm256_store_si256((v8si *) (bins + i), hist_bin256s(_mm256_cvtepi16_epi32(_mm256_castsi256_si128(x)), low_vec, shift_vec, last_vec, out_vec));
+            _mm256_store_si256((v8si *) (bins + i + AVX_LEN_INT32), hist_bin256s(_mm256_cvtepi16_epi32(_mm256_extractf128_si256(x, 1)), low_vec, shift_vec, last_vec, out_vec));
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += AVX_LEN_INT16) {
+            v8si x = _mm256_loadu_si256((v8si *) (src + i));
+            _mm256_store_si256((v8si *) (bins + i), hist_bin256s(_mm256_cvtepi16_epi32(_mm256_castsi256_si128(x)), low_vec, shift_vec, last_vec, out_vec));
+            _mm256_store_si256((v8si *) (bins + i + AVX_LEN_INT32), hist_bin256s(_mm256_cvtepi16_epi32(_mm256_extractf128_si256(x, 1)), low_vec, shift_vec, last_vec, out_vec));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        bins[i] = hist_bini((int32_t) src[i], low, shift, nb_bins);
+    }
+}
+
+SIMD_UTILS_API void histogram16s_256s(int16_t *src, int len, int16_t low, int shift, int nb_bins, uint32_t *hist)
+{
+    hist_state_t st;
+
+    hist_begin(&st, hist, nb_bins);
+    for (int start = 0; start < len; start += HIST_BLOCK_LEN) {
+        int block_len = hist_block_len(len, start);
+        bins16s_256s(src + start, block_len, (int32_t) low, shift, nb_bins, st.bins);
+        hist_count(&st, block_len);
+    }
+    hist_end(&st);
+}
+
+// the values are the bins, only the sub-histograms are needed
+SIMD_UTILS_API void histogramu8_256(uint8_t *src, int len, uint32_t *hist)
+{
+    hist_count_u8(src, len, hist);
+}
+
+// inclusive prefix sum of the lanes of x, within the 128 bits lanes then across them
+static inline v8si prefix_lanes256s(v8si x)
+{
+    x = _mm256_add_epi32(x, _mm256_slli_si256(x, 4));
+    x = _mm256_add_epi32(x, _mm256_slli_si256(x, 8));
+    v8si tmp = _mm256_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+    return _mm256_add_epi32(x, _mm256_permute2x128_si256(tmp, tmp, 0x08));
+}
+
+// last lane of x in all the lanes
+static inline v8si last_lane256s(v8si x)
+{
+    v8si tmp = _mm256_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+    return _mm256_permute2x128_si256(tmp, tmp, 0x11);
+}
+
+// lanes of x moved up by one, the first lane getting the last lane of prev
+static inline v8si shift_lane256s(v8si x, v8si prev)
+{
+    return _mm256_alignr_epi8(x, _mm256_permute2x128_si256(x, prev, 0x03), 12);
+}
+
+// prefix sums of src (see simd_utils.h), exclusive when exclusive is set
+static inline void prefixsum256s_run(int32_t *src, int32_t *dst, int len, int32_t *carry, int exclusive)
+{
+    int stop_len = len / (2 * AVX_LEN_INT32);
+    stop_len *= (2 * AVX_LEN_INT32);
+
+    v8si carry_vec = _mm256_set1_epi32(carry ? *carry : 0);
+
+    // the carry only waits for one add per pair of vectors
+    for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
+        v8si a = prefix_lanes256s(_mm256_loadu_si256((v8si *) (src + i)));
+        v8si b = prefix_lanes256s(_mm256_loadu_si256((v8si *) (src + i + AVX_LEN_INT32)));
+        b = _mm256_add_epi32(b, last_lane256s(a));
+        v8si last = last_lane256s(b);
+        a = _mm256_add_epi32(a, carry_vec);
+        b = _mm256_add_epi32(b, carry_vec);
+        if (exclusive) {
+            _mm256_storeu_si256((v8si *) (dst + i), shift_lane256s(a, carry_vec));
+            _mm256_storeu_si256((v8si *) (dst + i + AVX_LEN_INT32), shift_lane256s(b, a));
+        } else {
+            _mm256_storeu_si256((v8si *) (dst + i), a);
+            _mm256_storeu_si256((v8si *) (dst + i + AVX_LEN_INT32), b);
+        }
+        carry_vec = _mm256_add_epi32(carry_vec, last);
+    }
+
+    int32_t carry_tmp = _mm_cvtsi128_si32(_mm256_castsi256_si128(carry_vec));
+    for (int i = stop_len; i < len; i++) {
+        int32_t x = src[i];
+        if (exclusive) {
+            dst[i] = carry_tmp;
+            carry_tmp = (int32_t) ((uint32_t) carry_tmp + (uint32_t) x);
+        } else {
+            carry_tmp = (int32_t) ((uint32_t) carry_tmp + (uint32_t) x);
+            dst[i] = carry_tmp;
+        }
+    }
+
+    if (carry)
+        *carry = carry_tmp;
+}
+
+SIMD_UTILS_API void prefixsum256s(int32_t *src, int32_t *dst, int len, int32_t *carry)
+{
+    prefixsum256s_run(src, dst, len, carry, 0);
+}
+
+SIMD_UTILS_API void prefixsum256s_excl(int32_t *src, int32_t *dst, int len, int32_t *carry)
+{
+    prefixsum256s_run(src, dst, len, carry, 1);
+}
+
+SIMD_UTILS_API void diff256s(int32_t *src, int32_t *dst, int len, int32_t *prev)
+{
+    int stop_len = len / (2 * AVX_LEN_INT32);
+    stop_len *= (2 * AVX_LEN_INT32);
+
+    int32_t prev_tmp = prev ? *prev : 0;
+    int32_t last = (len > 0) ? src[len - 1] : prev_tmp;  // before src is overwritten by dst
+    v8si prev_vec = _mm256_set1_epi32(prev_tmp);
+
+    for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
+        v8si a = _mm256_loadu_si256((v8si *) (src + i));
+        v8si b = _mm256_loadu_si256((v8si *) (src + i + AVX_LEN_INT32));
+        _mm256_storeu_si256((v8si *) (dst + i), _mm256_sub_epi32(a, shift_lane256s(a, prev_vec)));
+        _mm256_storeu_si256((v8si *) (dst + i + AVX_LEN_INT32), _mm256_sub_epi32(b, shift_lane256s(b, a)));
+        prev_vec = b;
+    }
+
+    if (stop_len > 0)
+        prev_tmp = _mm_cvtsi128_si32(_mm256_castsi256_si128(last_lane256s(prev_vec)));
+    for (int i = stop_len; i < len; i++) {
+        int32_t x = src[i];
+        dst[i] = (int32_t) ((uint32_t) x - (uint32_t) prev_tmp);
+        prev_tmp = x;
+    }
+
+    if (prev)
+        *prev = last;
+}
+
+// inclusive prefix sum of the lanes of x, within the 128 bits lanes then across them
+static inline __m256i prefix_lanes16s_256s(__m256i x)
+{
+    x = _mm256_add_epi16(x, _mm256_slli_si256(x, 2));
+    x = _mm256_add_epi16(x, _mm256_slli_si256(x, 4));
+    x = _mm256_add_epi16(x, _mm256_slli_si256(x, 8));
+    __m256i tmp = _mm256_shufflehi_epi16(x, _MM_SHUFFLE(3, 3, 3, 3));
+    tmp = _mm256_unpackhi_epi64(tmp, tmp);
+    return _mm256_add_epi16(x, _mm256_permute2x128_si256(tmp, tmp, 0x08));
+}
+
+// last lane of x in all the lanes
+static inline __m256i last_lane16s_256s(__m256i x)
+{
+    __m256i tmp = _mm256_shufflehi_epi16(x, _MM_SHUFFLE(3, 3, 3, 3));
+    tmp = _mm256_unpackhi_epi64(tmp, tmp);
+    return _mm256_permute2x128_si256(tmp, tmp, 0x11);
+}
+
+// lanes of x moved up by one, the first lane getting the last lane of prev
+static inline __m256i shift_lane16s_256s(__m256i x, __m256i prev)
+{
+    return _mm256_alignr_epi8(x, _mm256_permute2x128_si256(x, prev, 0x03), 14);
+}
+
+// prefix sums of src (see simd_utils.h), exclusive when exclusive is set
+static inline void prefixsum16s_256s_run(int16_t *src, int16_t *dst, int len, int16_t *carry, int exclusive)
+{
+    int stop_len = len / (2 * AVX_LEN_INT16);
+    stop_len *= (2 * AVX_LEN_INT16);
+
+    __m256i carry_vec = _mm256_set1_epi16(carry ? *carry : 0);
+
+    // the carry only waits for one add per pair of vectors
+    for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT16) {
+        __m256i a = prefix_lanes16s_256s(_mm256_loadu_si256((__m256i *) (src + i)));
+        __m256i b = prefix_lanes16s_256s(_mm256_loadu_si256((__m256i *) (src + i + AVX_LEN_INT16)));
+        b = _mm256_add_epi16(b, last_lane16s_256s(a));
+        __m256i last = last_lane16s_256s(b);
+        a = _mm256_add_epi16(a, carry_vec);
+        b = _mm256_add_epi16(b, carry_vec);
+        if (exclusive) {
+            _mm256_storeu_si256((__m256i *) (dst + i), shift_lane16s_256s(a, carry_vec));
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT16), shift_lane16s_256s(b, a));
+        } else {
+            _mm256_storeu_si256((__m256i *) (dst + i), a);
+            _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT16), b);
+        }
+        carry_vec = _mm256_add_epi16(carry_vec, last);
+    }
+
+    int16_t carry_tmp = (int16_t) _mm_cvtsi128_si32(_mm256_castsi256_si128(carry_vec));
+    for (int i = stop_len; i < len; i++) {
+        int16_t x = src[i];
+        if (exclusive) {
+            dst[i] = carry_tmp;
+            carry_tmp = (int16_t) (carry_tmp + x);
+        } else {
+            carry_tmp = (int16_t) (carry_tmp + x);
+            dst[i] = carry_tmp;
+        }
+    }
+
+    if (carry)
+        *carry = carry_tmp;
+}
+
+SIMD_UTILS_API void prefixsum16s_256s(int16_t *src, int16_t *dst, int len, int16_t *carry)
+{
+    prefixsum16s_256s_run(src, dst, len, carry, 0);
+}
+
+SIMD_UTILS_API void prefixsum16s_256s_excl(int16_t *src, int16_t *dst, int len, int16_t *carry)
+{
+    prefixsum16s_256s_run(src, dst, len, carry, 1);
+}
+
+SIMD_UTILS_API void diff16s_256s(int16_t *src, int16_t *dst, int len, int16_t *prev)
+{
+    int stop_len = len / (2 * AVX_LEN_INT16);
+    stop_len *= (2 * AVX_LEN_INT16);
+
+    int16_t prev_tmp = prev ? *prev : 0;
+    int16_t last = (len > 0) ? src[len - 1] : prev_tmp;  // before src is overwritten by dst
+    __m256i prev_vec = _mm256_set1_epi16(prev_tmp);
+
+    for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT16) {
+        __m256i a = _mm256_loadu_si256((__m256i *) (src + i));
+        __m256i b = _mm256_loadu_si256((__m256i *) (src + i + AVX_LEN_INT16));
+        _mm256_storeu_si256((__m256i *) (dst + i), _mm256_sub_epi16(a, shift_lane16s_256s(a, prev_vec)));
+        _mm256_storeu_si256((__m256i *) (dst + i + AVX_LEN_INT16), _mm256_sub_epi16(b, shift_lane16s_256s(b, a)));
+        prev_vec = b;
+    }
+
+    if (stop_len > 0)
+        prev_tmp = (int16_t) _mm_cvtsi128_si32(_mm256_castsi256_si128(last_lane16s_256s(prev_vec)));
+    for (int i = stop_len; i < len; i++) {
+        int16_t x = src[i];
+        dst[i] = (int16_t) (x - prev_tmp);
+        prev_tmp = x;
+    }
+
+    if (prev)
+        *prev = last;
+}
+
+// bitonic sort of the lanes of x
+static inline v8si sort_lanes256s(v8si x)
+{
+    v8si p;
+    p = _mm256_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm256_blend_epi32(_mm256_min_epi32(x, p), _mm256_max_epi32(x, p), 0x66);
+    p = _mm256_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm256_blend_epi32(_mm256_min_epi32(x, p), _mm256_max_epi32(x, p), 0x3C);
+    p = _mm256_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm256_blend_epi32(_mm256_min_epi32(x, p), _mm256_max_epi32(x, p), 0x5A);
+    p = _mm256_permute2x128_si256(x, x, 0x01);
+    x = _mm256_blend_epi32(_mm256_min_epi32(x, p), _mm256_max_epi32(x, p), 0xF0);
+    p = _mm256_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm256_blend_epi32(_mm256_min_epi32(x, p), _mm256_max_epi32(x, p), 0xCC);
+    p = _mm256_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm256_blend_epi32(_mm256_min_epi32(x, p), _mm256_max_epi32(x, p), 0xAA);
+    return x;
+}
+
+// sorts the lanes of x, which are a bitonic sequence
+static inline v8si sort_clean256s(v8si x)
+{
+    v8si p;
+    p = _mm256_permute2x128_si256(x, x, 0x01);
+    x = _mm256_blend_epi32(_mm256_min_epi32(x, p), _mm256_max_epi32(x, p), 0xF0);
+    p = _mm256_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm256_blend_epi32(_mm256_min_epi32(x, p), _mm256_max_epi32(x, p), 0xCC);
+    p = _mm256_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm256_blend_epi32(_mm256_min_epi32(x, p), _mm256_max_epi32(x, p), 0xAA);
+    return x;
+}
+
+// merges the sorted vectors a and b, a getting the lowest half
+static inline void sort_merge2256s(v8si *a, v8si *b)
+{
+    v8si rev = _mm256_permutevar8x32_epi32(*b, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+    v8si low = _mm256_min_epi32(*a, rev);
+    v8si high = _mm256_max_epi32(*a, rev);
+    *a = sort_clean256s(low);
+    *b = sort_clean256s(high);
+}
+
+// merges the sorted sequences (a, b) and (c, d)
+static inline void sort_merge4256s(v8si *a, v8si *b, v8si *c, v8si *d)
+{
+    v8si rev_c = _mm256_permutevar8x32_epi32(*d, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+    v8si rev_d = _mm256_permutevar8x32_epi32(*c, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+    v8si low0 = _mm256_min_epi32(*a, rev_c);
+    v8si high0 = _mm256_max_epi32(*a, rev_c);
+    v8si low1 = _mm256_min_epi32(*b, rev_d);
+    v8si high1 = _mm256_max_epi32(*b, rev_d);
+    *a = sort_clean256s(_mm256_min_epi32(low0, low1));
+    *b = sort_clean256s(_mm256_max_epi32(low0, low1));
+    *c = sort_clean256s(_mm256_min_epi32(high0, high1));
+    *d = sort_clean256s(_mm256_max_epi32(high0, high1));
+}
+
+// sorts up to 4 vectors, padded with the largest value
+static inline void sort_small256s(int32_t *src, int len)
+{
+    int32_t tmp[4 * AVX_LEN_INT32] __attribute__((aligned(AVX_LEN_BYTES)));
+
+    memcpy(tmp, src, len * sizeof(int32_t));
+    for (int i = len; i < 4 * AVX_LEN_INT32; i++) {
+        tmp[i] = INT32_MAX;
+    }
+
+    v8si a = sort_lanes256s(_mm256_loadu_si256((v8si *) (tmp)));
+    if (len <= AVX_LEN_INT32) {
+        _mm256_storeu_si256((v8si *) (tmp), a);
+    } else if (len <= 2 * AVX_LEN_INT32) {
+        v8si b = sort_lanes256s(_mm256_loadu_si256((v8si *) (tmp + AVX_LEN_INT32)));
+        sort_merge2256s(&a, &b);
+        _mm256_storeu_si256((v8si *) (tmp), a);
+        _mm256_storeu_si256((v8si *) (tmp + AVX_LEN_INT32), b);
+    } else {
+        v8si b = sort_lanes256s(_mm256_loadu_si256((v8si *) (tmp + AVX_LEN_INT32)));
+        v8si c = sort_lanes256s(_mm256_loadu_si256((v8si *) (tmp + 2 * AVX_LEN_INT32)));
+        v8si d = sort_lanes256s(_mm256_loadu_si256((v8si *) (tmp + 3 * AVX_LEN_INT32)));
+        sort_merge2256s(&a, &b);
+        sort_merge2256s(&c, &d);
+        sort_merge4256s(&a, &b, &c, &d);
+        _mm256_storeu_si256((v8si *) (tmp), a);
+        _mm256_storeu_si256((v8si *) (tmp + AVX_LEN_INT32), b);
+        _mm256_storeu_si256((v8si *) (tmp + 2 * AVX_LEN_INT32), c);
+        _mm256_storeu_si256((v8si *) (tmp + 3 * AVX_LEN_INT32), d);
+    }
+
+    memcpy(src, tmp, len * sizeof(int32_t));
+}
+
+// packs the lanes of x lower than the pivot to [*left_w, ...) and the others to [..., *right_w)
+static inline void partition_store256s(int32_t *src, v8si x, v8si pivot_vec, int *left_w, int *right_w)
+{
+    int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(pivot_vec, x)));
+    int nb_low = __builtin_popcount(mask);
+    v8si idx = _mm256_srlv_epi32(_mm256_set1_epi32((int32_t) sort_perm8_lut[mask]), _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28));
+    v8si packed = _mm256_permutevar8x32_epi32(x, idx);
+
+    // the full vector is stored on both ends (free space of a vector at least on each end)
+    _mm256_storeu_si256((v8si *) (src + *left_w), packed);
+    _mm256_storeu_si256((v8si *) (src + *right_w - AVX_LEN_INT32), packed);
+    *left_w += nb_low;
+    *right_w -= AVX_LEN_INT32 - nb_low;
+}
+
+// number of elements lower than pivot, moved to the beginning of src (len >= 2 * AVX_LEN_INT32)
+static inline int partition256s(int32_t *src, int len, int32_t pivot)
+{
+    v8si pivot_vec = _mm256_set1_epi32(pivot);
+    v8si first = _mm256_loadu_si256((v8si *) (src));
+    v8si last = _mm256_loadu_si256((v8si *) (src + len - AVX_LEN_INT32));
+    int left = AVX_LEN_INT32, right = len - 2 * AVX_LEN_INT32;  // next vectors read from each end
+    int left_w = 0, right_w = len;             // free space [left_w, left) and [right + AVX_LEN_INT32, right_w)
+
+    while (left <= right) {
+        v8si x;
+        if ((left - left_w) <= (right_w - right - AVX_LEN_INT32)) {
+            x = _mm256_loadu_si256((v8si *) (src + left));
+            left += AVX_LEN_INT32;
+        } else {
+            x = _mm256_loadu_si256((v8si *) (src + right));
+            right -= AVX_LEN_INT32;
+        }
+        partition_store256s(src, x, pivot_vec, &left_w, &right_w);
+    }
+
+    // the last elements (less than a vector) with the first and the last vectors
+    int32_t tmp[3 * AVX_LEN_INT32];
+    int nb_tmp = right + AVX_LEN_INT32 - left;
+    memcpy(tmp, src + left, nb_tmp * sizeof(int32_t));
+    _mm256_storeu_si256((v8si *) (tmp + nb_tmp), first);
+    _mm256_storeu_si256((v8si *) (tmp + nb_tmp + AVX_LEN_INT32), last);
+    sort_partition_tails(src, tmp, nb_tmp + 2 * AVX_LEN_INT32, pivot, &left_w, &right_w);
+    return left_w;
+}
+
+SIMD_UTILS_API void sort256s(int32_t *src, int len)
+{
+    sort_runs(src, len, 4 * AVX_LEN_INT32, partition256s, sort_small256s);
+}
+
+// indices of the elements of src greater than threshold (see simd_utils_topk.h)
+static inline int filter_gt256s(int32_t *src, int len, int32_t threshold, int32_t *idx)
+{
+    int stop_len = len / (2 * AVX_LEN_INT32);
+    stop_len *= (2 * AVX_LEN_INT32);
+    v8si thr = _mm256_set1_epi32(threshold);
+    int nb = 0;
+
+    for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
+        v8si x0 = _mm256_loadu_si256((v8si *) (src + i));
+        v8si x1 = _mm256_loadu_si256((v8si *) (src + i + AVX_LEN_INT32));
+        uint32_t mask = (uint32_t) _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(x0, thr))) | ((uint32_t) _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(x1, thr))) << AVX_LEN_INT32);
+        while (mask) {
+            idx[nb++] = i + __builtin_ctz(mask);
+            mask &= mask - 1;
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        if (src[i] > threshold)
+            idx[nb++] = i;
+    }
+    return nb;
+}
+
+// indices of the elements of src lower than threshold (see simd_utils_topk.h)
+static inline int filter_lt256s(int32_t *src, int len, int32_t threshold, int32_t *idx)
+{
+    int stop_len = len / (2 * AVX_LEN_INT32);
+    stop_len *= (2 * AVX_LEN_INT32);
+    v8si thr = _mm256_set1_epi32(threshold);
+    int nb = 0;
+
+    for (int i = 0; i < stop_len; i += 2 * AVX_LEN_INT32) {
+        v8si x0 = _mm256_loadu_si256((v8si *) (src + i));
+        v8si x1 = _mm256_loadu_si256((v8si *) (src + i + AVX_LEN_INT32));
+        uint32_t mask = (uint32_t) _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(thr, x0))) | ((uint32_t) _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(thr, x1))) << AVX_LEN_INT32);
+        while (mask) {
+            idx[nb++] = i + __builtin_ctz(mask);
+            mask &= mask - 1;
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        if (src[i] < threshold)
+            idx[nb++] = i;
+    }
+    return nb;
+}
+
+SIMD_UTILS_API void topk256s(int32_t *src, int len, int k, int32_t *dst, int32_t *idx)
+{
+    topk_runs(src, len, k, dst, idx, 1, filter_gt256s);
+}
+
+SIMD_UTILS_API void bottomk256s(int32_t *src, int len, int k, int32_t *dst, int32_t *idx)
+{
+    topk_runs(src, len, k, dst, idx, 0, filter_lt256s);
+}
+
+SIMD_UTILS_API void partialsort256s(int32_t *src, int len, int k)
+{
+    partialsort_runs(src, len, k, 4 * AVX_LEN_INT32, partition256s, sort_small256s);
 }
 
 #endif
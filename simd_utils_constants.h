@@ -1128,41 +1128,10 @@ static const int64_t inv_sign_maskd = ~SIGN_MASKD;
 #define M_PI 3.14159265358979323846264338327950288
 #endif
 
-typedef struct {
-	int16_t re;
-	int16_t im;
-} complex16s_t;
-
-typedef struct {
-	int32_t re;
-	int32_t im;
-} complex32s_t;
-
-typedef struct {
-	float re;
-	float im;
-} complex32_t;
+#include "simd_utils_types.h"
 
-typedef struct {
-	double re;
-	double im;
-} complex64_t;
-
-typedef enum {
-    RndZero,
-    RndNear,
-    RndFinancial,
-} FloatRoundingMode;
-
-typedef  struct {
-	int16_t x;
-	int16_t y;
-} point_t;
-
-typedef struct {
-	point_t* modified_points;
-	int counter;
-} modified_t;
+// 4KB blocks, so that a block, its array operand and the output fit in L1 cache
+#define PIPELINE_BLOCK_FLOAT 1024
 
 #ifndef max
 #define max(a,b) ((a) > (b))? (a):(b)
@@ -1329,8 +1298,10 @@ static const v16u8 flip_vector = {12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1
 #ifdef SSE
 
 #define SSE_LEN_BYTES 16  // Size of SSE lane
+#define SSE_LEN_INT8 16   // number of int8 with an SSE lane
 #define SSE_LEN_INT16 8   // number of int16 with an SSE lane
 #define SSE_LEN_INT32 4   // number of int32 with an SSE lane
+#define SSE_LEN_INT64 2   // number of int64 with an SSE lane
 #define SSE_LEN_FLOAT 4   // number of float with an SSE lane
 #define SSE_LEN_DOUBLE 2  // number of double with an SSE lane
 
@@ -1740,6 +1711,38 @@ _PD_CONST(TAN_mDP2, -7.94662735614792836714E-9);
 _PD_CONST(TAN_mDP3, -3.06161699786838294307E-17);
 _PD_CONST(tanlossth, 1.073741824e9);
 _PD_CONST(PDEPI64U, 0x0010000000000000);
+_PD_CONST(log2e_lo, 2.0355273740931033e-17);  // log2(e) - cephes_LOG2E
+_PD_CONST(log10e, 0.4342944819032518);  // log10(e)
+_PD_CONST(log10e_lo, 1.098319650216765e-17);  // log10(e) - log10e
+_PD_CONST(PIO2_lo, 6.123233995736766e-17);  // PI/2 - PIO2F
+_PD_CONST(PI_lo, 1.2246467991473532e-16);  // PI - PIF
+_PD_CONST(sinh_p0, -7.89474443963537015605E-1);
+_PD_CONST(sinh_p1, -1.63725857525983828727E2);
+_PD_CONST(sinh_p2, -1.15614435765005216044E4);
+_PD_CONST(sinh_p3, -3.51754964808151394800E5);
+_PD_CONST(sinh_q0, -2.77711081420602794433E2);
+_PD_CONST(sinh_q1, 3.61578279834431989373E4);
+_PD_CONST(sinh_q2, -2.11052978884890840399E6);
+_PD_CONST(tanh_p0, -9.64399179425052238628E-1);
+_PD_CONST(tanh_p1, -9.92877231001918586564E1);
+_PD_CONST(tanh_p2, -1.61468768441708447952E3);
+_PD_CONST(tanh_q0, 1.12811678491632931402E2);
+_PD_CONST(tanh_q1, 2.23548839060100448583E3);
+_PD_CONST(tanh_q2, 4.84406305325125486048E3);
+_PD_CONST(tanh_max, 22.0);  // tanh(x) rounds to 1 above
+_PD_CONST(asinh_big, 1e8);  // asinh(x) = log(2x) above
+_PD_CONST(cbrt_c0, 0.8015231020535846);  // x^(1/3) ~ c0 + c1 x + c2 x^2 on [1, 8]
+_PD_CONST(cbrt_c1, 0.24785613855326197);
+_PD_CONST(cbrt_c2, -0.012732316238328267);
+_PD_CONST(two52, 4503599627370496.0);  // 2^52, holds an integer in its mantissa
+_PD_CONST(two54, 18014398509481984.0);
+_PD_CONST(1023, 1023.0);
+_PD_CONST(54, 54.0);
+_PD_CONST(dbl_min, 2.2250738585072014e-308);  // DBL_MIN
+_PD_CONST(dbl_max, 1.7976931348623157e308);  // DBL_MAX
+_PD_CONST(3, 3.0);
+_PD_CONST(exp_min, -708.0);  // smallest argument of the exp functions (no denormals)
+_PD_CONST(exp_max, 709.0);
 
 
 #endif  // SSE/ARM
@@ -1748,8 +1751,10 @@ _PD_CONST(PDEPI64U, 0x0010000000000000);
 #ifdef AVX
 
 #define AVX_LEN_BYTES 32  // Size of AVX lane
+#define AVX_LEN_INT8 32   // number of int8 with an AVX lane
 #define AVX_LEN_INT16 16  // number of int16 with an AVX lane
 #define AVX_LEN_INT32 8   // number of int32 with an AVX lane
+#define AVX_LEN_INT64 4   // number of int64 with an AVX lane
 #define AVX_LEN_FLOAT 8   // number of float with an AVX lane
 #define AVX_LEN_DOUBLE 4  // number of double with an AVX lane
 
@@ -1784,7 +1789,8 @@ typedef struct {
     v4sd val[2];
 } v4sdx2;
 
-#ifndef __AVX2__
+// DISPATCH builds the AVX backend with AVX2 enabled (see simd_utils.h)
+#if !defined(__AVX2__) && !defined(DISPATCH)
 
 typedef union imm_xmm_union {
     v8si imm;
@@ -2171,6 +2177,38 @@ _PD256_CONST(cephes_exp_q3, 2.00000000000000000009e0);
 
 _PD256_CONST(cephes_exp_minC1, -0.693145751953125);
 _PD256_CONST(cephes_exp_minC2, -1.42860682030941723212e-6);
+_PD256_CONST(log2e_lo, 2.0355273740931033e-17);  // log2(e) - cephes_LOG2E
+_PD256_CONST(log10e, 0.4342944819032518);  // log10(e)
+_PD256_CONST(log10e_lo, 1.098319650216765e-17);  // log10(e) - log10e
+_PD256_CONST(PIO2_lo, 6.123233995736766e-17);  // PI/2 - PIO2F
+_PD256_CONST(PI_lo, 1.2246467991473532e-16);  // PI - PIF
+_PD256_CONST(sinh_p0, -7.89474443963537015605E-1);
+_PD256_CONST(sinh_p1, -1.63725857525983828727E2);
+_PD256_CONST(sinh_p2, -1.15614435765005216044E4);
+_PD256_CONST(sinh_p3, -3.51754964808151394800E5);
+_PD256_CONST(sinh_q0, -2.77711081420602794433E2);
+_PD256_CONST(sinh_q1, 3.61578279834431989373E4);
+_PD256_CONST(sinh_q2, -2.11052978884890840399E6);
+_PD256_CONST(tanh_p0, -9.64399179425052238628E-1);
+_PD256_CONST(tanh_p1, -9.92877231001918586564E1);
+_PD256_CONST(tanh_p2, -1.61468768441708447952E3);
+_PD256_CONST(tanh_q0, 1.12811678491632931402E2);
+_PD256_CONST(tanh_q1, 2.23548839060100448583E3);
+_PD256_CONST(tanh_q2, 4.84406305325125486048E3);
+_PD256_CONST(tanh_max, 22.0);  // tanh(x) rounds to 1 above
+_PD256_CONST(asinh_big, 1e8);  // asinh(x) = log(2x) above
+_PD256_CONST(cbrt_c0, 0.8015231020535846);  // x^(1/3) ~ c0 + c1 x + c2 x^2 on [1, 8]
+_PD256_CONST(cbrt_c1, 0.24785613855326197);
+_PD256_CONST(cbrt_c2, -0.012732316238328267);
+_PD256_CONST(two52, 4503599627370496.0);  // 2^52, holds an integer in its mantissa
+_PD256_CONST(two54, 18014398509481984.0);
+_PD256_CONST(1023, 1023.0);
+_PD256_CONST(54, 54.0);
+_PD256_CONST(dbl_min, 2.2250738585072014e-308);  // DBL_MIN
+_PD256_CONST(dbl_max, 1.7976931348623157e308);  // DBL_MAX
+_PD256_CONST(3, 3.0);
+_PD256_CONST(exp_min, -708.0);  // smallest argument of the exp functions (no denormals)
+_PD256_CONST(exp_max, 709.0);
 
 #endif
 
@@ -2178,8 +2216,10 @@ _PD256_CONST(cephes_exp_minC2, -1.42860682030941723212e-6);
 #ifdef AVX512
 
 #define AVX512_LEN_BYTES 64  // Size of AVX512 lane
+#define AVX512_LEN_INT8 64   // number of int8 with an AVX512 lane
 #define AVX512_LEN_INT16 32  // number of int16 with an AVX512 lane
 #define AVX512_LEN_INT32 16  // number of int32 with an AVX512 lane
+#define AVX512_LEN_INT64 8   // number of int64 with an AVX512 lane
 #define AVX512_LEN_FLOAT 16  // number of float with an AVX512 lane
 #define AVX512_LEN_DOUBLE 8  // number of double with an AVX512 lane
 
@@ -2556,6 +2596,38 @@ _PD512_CONST(exp_lo, -709.436139303);
 _PD512_CONST(0p625, 0.625);
 _PD512_CONST(0p66, 0.66);
 _PD512_CONST(1em8, 1E-8);
+_PD512_CONST(log2e_lo, 2.0355273740931033e-17);  // log2(e) - cephes_LOG2E
+_PD512_CONST(log10e, 0.4342944819032518);  // log10(e)
+_PD512_CONST(log10e_lo, 1.098319650216765e-17);  // log10(e) - log10e
+_PD512_CONST(PIO2_lo, 6.123233995736766e-17);  // PI/2 - PIO2F
+_PD512_CONST(PI_lo, 1.2246467991473532e-16);  // PI - PIF
+_PD512_CONST(sinh_p0, -7.89474443963537015605E-1);
+_PD512_CONST(sinh_p1, -1.63725857525983828727E2);
+_PD512_CONST(sinh_p2, -1.15614435765005216044E4);
+_PD512_CONST(sinh_p3, -3.51754964808151394800E5);
+_PD512_CONST(sinh_q0, -2.77711081420602794433E2);
+_PD512_CONST(sinh_q1, 3.61578279834431989373E4);
+_PD512_CONST(sinh_q2, -2.11052978884890840399E6);
+_PD512_CONST(tanh_p0, -9.64399179425052238628E-1);
+_PD512_CONST(tanh_p1, -9.92877231001918586564E1);
+_PD512_CONST(tanh_p2, -1.61468768441708447952E3);
+_PD512_CONST(tanh_q0, 1.12811678491632931402E2);
+_PD512_CONST(tanh_q1, 2.23548839060100448583E3);
+_PD512_CONST(tanh_q2, 4.84406305325125486048E3);
+_PD512_CONST(tanh_max, 22.0);  // tanh(x) rounds to 1 above
+_PD512_CONST(asinh_big, 1e8);  // asinh(x) = log(2x) above
+_PD512_CONST(cbrt_c0, 0.8015231020535846);  // x^(1/3) ~ c0 + c1 x + c2 x^2 on [1, 8]
+_PD512_CONST(cbrt_c1, 0.24785613855326197);
+_PD512_CONST(cbrt_c2, -0.012732316238328267);
+_PD512_CONST(two52, 4503599627370496.0);  // 2^52, holds an integer in its mantissa
+_PD512_CONST(two54, 18014398509481984.0);
+_PD512_CONST(1023, 1023.0);
+_PD512_CONST(54, 54.0);
+_PD512_CONST(dbl_min, 2.2250738585072014e-308);  // DBL_MIN
+_PD512_CONST(dbl_max, 1.7976931348623157e308);  // DBL_MAX
+_PD512_CONST(3, 3.0);
+_PD512_CONST(exp_min, -708.0);  // smallest argument of the exp functions (no denormals)
+_PD512_CONST(exp_max, 709.0);
 #endif
 
 
@@ -0,0 +1,340 @@
+/*
+ * Project : SIMD_Utils
+ * Version : 0.2.6
+ * Author  : JishinMaster
+ * Licence : BSD-2
+ */
+
+#pragma once
+
+/* Streaming convolutions and cross-correlations.
+ *
+ * A convolution keeps the last len - 1 inputs between calls and filters each call of
+ * n samples into n outputs : dst[i] = sum_k kernel[k] * src[i - k], the samples before
+ * the first call being zeros.
+ * A cross-correlation is the convolution by the conjugated reversed template :
+ * dst[i] = sum_k conj(tmpl[k]) * src[i - len + 1 + k], the correlation of the template
+ * with the len samples ending at src[i].
+ *
+ * Kernels of up to CONV_DIRECT_MAX_LEN taps use the direct form, the FIR kernels of
+ * simd_utils_fir.h on blocks of CONV_BLOCK_LEN samples. Longer ones use overlap-save :
+ * blocks of fft_len - len + 1 new samples, after the len - 1 previous ones, are
+ * transformed, multiplied by the spectrum of the kernel and transformed back, the first
+ * len - 1 outputs (wrapped around) being dropped. fft_len is the power of 2 at least
+ * 4 * len. A shorter call is zero padded to a block, so calls of fft_len - len + 1
+ * samples or more are the most efficient.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+// longest kernel of the direct form
+#ifndef CONV_DIRECT_MAX_LEN
+#define CONV_DIRECT_MAX_LEN 64
+#endif
+
+// samples filtered at once by the direct form
+#ifndef CONV_BLOCK_LEN
+#define CONV_BLOCK_LEN 1024
+#endif
+
+// longest kernel, so that fft_len fits the plans
+#define CONV_MAX_LEN (1 << 26)
+
+/* overlap-save of a block, conv->buf (fft_len samples) to conv->out : the product of the
+ * spectra is written in out, then transformed back in place */
+typedef void (*conv_blockf_t)(conv32_t *conv);
+typedef void (*conv_blockd_t)(conv64_t *conv);
+
+static inline int conv_fft_len(int len)
+{
+    if (len <= CONV_DIRECT_MAX_LEN)
+        return 0;
+    int n = 64;
+    while (n < 4 * len)
+        n *= 2;
+    return n;
+}
+
+/* Single allocation of the structure and its arrays (sizes in elements of elt_size bytes),
+ * arrays[i] receives the address of the array i */
+static inline void *conv_alloc(size_t struct_size, size_t elt_size, const size_t sizes[5], void **arrays[5])
+{
+    size_t total = struct_size + FFT_PLAN_ALIGN;
+    for (int i = 0; i < 5; i++)
+        total += fft_align_up(sizes[i] * elt_size);
+    char *p = (char *) malloc(total);
+    if (!p)
+        return NULL;
+    char *a = (char *) fft_align_up((uintptr_t) p + struct_size);
+    for (int i = 0; i < 5; i++) {
+        *arrays[i] = (void *) a;
+        a += fft_align_up(sizes[i] * elt_size);
+    }
+    return p;
+}
+
+/* kernel holds len real or interleaved complex values, the kernel of a cross-correlation
+ * is conjugated and reversed */
+static inline conv32_t *conv32_create_(const float *kernel, int len, int cplx, int xcorr)
+{
+    if ((len < 1) || (len > CONV_MAX_LEN))
+        return NULL;
+
+    int c = cplx ? 2 : 1;
+    int fft_len = conv_fft_len(len);
+    size_t sizes[5];
+    sizes[0] = fft_len ? 0 : (size_t) len * c;
+    sizes[1] = fft_len ? (cplx ? 2 * (size_t) fft_len : (size_t) fft_len + 2) : 0;
+    sizes[2] = fft_len ? (size_t) fft_len * c : (size_t) (len - 1 + CONV_BLOCK_LEN) * c;
+    sizes[3] = sizes[1];
+    sizes[4] = sizes[1];
+
+    conv32_t *conv;
+    void **arrays[5];
+    float *taps, *spectrum, *buf, *work, *out;
+    arrays[0] = (void **) &taps;
+    arrays[1] = (void **) &spectrum;
+    arrays[2] = (void **) &buf;
+    arrays[3] = (void **) &work;
+    arrays[4] = (void **) &out;
+    conv = (conv32_t *) conv_alloc(sizeof(conv32_t), sizeof(float), sizes, arrays);
+    if (!conv)
+        return NULL;
+    conv->len = len;
+    conv->cplx = cplx;
+    conv->fft_len = fft_len;
+    conv->taps = taps;
+    conv->spectrum = spectrum;
+    conv->buf = buf;
+    conv->work = work;
+    conv->out = out;
+    conv->plan = NULL;
+
+    if (!fft_len) {
+        // reversed taps of the FIR kernels, taps[m] = h[len - 1 - m]
+        for (int m = 0; m < len; m++) {
+            int k = xcorr ? m : (len - 1 - m);
+            taps[m] = kernel[k * c];
+            if (cplx)
+                taps[len + m] = xcorr ? -kernel[k * c + 1] : kernel[k * c + 1];
+        }
+        return conv;
+    }
+
+    conv->plan = cplx ? fft_plan32_create(fft_len) : rfft_plan32_create(fft_len);
+    if (!conv->plan) {
+        free(conv);
+        return NULL;
+    }
+
+    // kernel zero padded to fft_len in out, then its spectrum (the inverse transforms scale by fft_len)
+    memset(out, 0, (size_t) fft_len * c * sizeof(float));
+    for (int m = 0; m < len; m++) {
+        int k = xcorr ? (len - 1 - m) : m;
+        out[m * c] = kernel[k * c];
+        if (cplx)
+            out[m * c + 1] = xcorr ? -kernel[k * c + 1] : kernel[k * c + 1];
+    }
+    fft_plan32_t *plan = conv->plan;
+    float *re = plan->work + 4 * plan->n;
+    float *im = re + plan->n;
+    for (int i = 0; i < plan->n; i++) {
+        re[i] = out[2 * i];
+        im[i] = out[2 * i + 1];
+    }
+    fft_split_coref_C(plan, re, im, re, im);
+    float scale = 1.0f / (float) fft_len;
+    if (cplx) {
+        for (int i = 0; i < plan->n; i++) {
+            spectrum[2 * i] = re[i] * scale;
+            spectrum[2 * i + 1] = im[i] * scale;
+        }
+    } else {
+        rfft_postf_C(plan, re, im, (complex32_t *) spectrum, 1);
+        for (int i = 0; i < fft_len + 2; i++)
+            spectrum[i] *= scale;
+    }
+    return conv;
+}
+
+static inline conv64_t *conv64_create_(const double *kernel, int len, int xcorr)
+{
+    if ((len < 1) || (len > CONV_MAX_LEN))
+        return NULL;
+
+    int fft_len = conv_fft_len(len);
+    size_t sizes[5];
+    sizes[0] = fft_len ? 0 : (size_t) len;
+    sizes[1] = fft_len ? (size_t) fft_len + 2 : 0;
+    sizes[2] = fft_len ? (size_t) fft_len : (size_t) (len - 1 + CONV_BLOCK_LEN);
+    sizes[3] = sizes[1];
+    sizes[4] = sizes[1];
+
+    conv64_t *conv;
+    void **arrays[5];
+    double *taps, *spectrum, *buf, *work, *out;
+    arrays[0] = (void **) &taps;
+    arrays[1] = (void **) &spectrum;
+    arrays[2] = (void **) &buf;
+    arrays[3] = (void **) &work;
+    arrays[4] = (void **) &out;
+    conv = (conv64_t *) conv_alloc(sizeof(conv64_t), sizeof(double), sizes, arrays);
+    if (!conv)
+        return NULL;
+    conv->len = len;
+    conv->fft_len = fft_len;
+    conv->taps = taps;
+    conv->spectrum = spectrum;
+    conv->buf = buf;
+    conv->work = work;
+    conv->out = out;
+    conv->plan = NULL;
+
+    if (!fft_len) {
+        for (int m = 0; m < len; m++)
+            taps[m] = kernel[xcorr ? m : (len - 1 - m)];
+        return conv;
+    }
+
+    conv->plan = rfft_plan64_create(fft_len);
+    if (!conv->plan) {
+        free(conv);
+        return NULL;
+    }
+
+    memset(out, 0, (size_t) fft_len * sizeof(double));
+    for (int m = 0; m < len; m++)
+        out[m] = kernel[xcorr ? (len - 1 - m) : m];
+    fft_plan64_t *plan = conv->plan;
+    double *re = plan->work + 4 * plan->n;
+    double *im = re + plan->n;
+    for (int i = 0; i < plan->n; i++) {
+        re[i] = out[2 * i];
+        im[i] = out[2 * i + 1];
+    }
+    fft_split_cored_C(plan, re, im, re, im);
+    rfft_postd_C(plan, re, im, (complex64_t *) spectrum, 1);
+    double scale = 1.0 / (double) fft_len;
+    for (int i = 0; i < fft_len + 2; i++)
+        spectrum[i] *= scale;
+    return conv;
+}
+
+// clears the previous inputs
+SIMD_UTILS_API void conv32_reset(conv32_t *conv)
+{
+    memset(conv->buf, 0, (size_t) (conv->len - 1) * (conv->cplx ? 2 : 1) * sizeof(float));
+}
+
+SIMD_UTILS_API void conv64_reset(conv64_t *conv)
+{
+    memset(conv->buf, 0, (size_t) (conv->len - 1) * sizeof(double));
+}
+
+// convolution by the len taps of kernel, NULL if len is not supported
+SIMD_UTILS_API conv32_t *conv32_create(float *kernel, int len)
+{
+    conv32_t *conv = conv32_create_(kernel, len, 0, 0);
+    if (conv)
+        conv32_reset(conv);
+    return conv;
+}
+
+SIMD_UTILS_API conv32_t *conv32_create_cplx(complex32_t *kernel, int len)
+{
+    conv32_t *conv = conv32_create_((const float *) kernel, len, 1, 0);
+    if (conv)
+        conv32_reset(conv);
+    return conv;
+}
+
+// cross-correlation with the len samples of tmpl
+SIMD_UTILS_API conv32_t *xcorr32_create(float *tmpl, int len)
+{
+    conv32_t *conv = conv32_create_(tmpl, len, 0, 1);
+    if (conv)
+        conv32_reset(conv);
+    return conv;
+}
+
+SIMD_UTILS_API conv32_t *xcorr32_create_cplx(complex32_t *tmpl, int len)
+{
+    conv32_t *conv = conv32_create_((const float *) tmpl, len, 1, 1);
+    if (conv)
+        conv32_reset(conv);
+    return conv;
+}
+
+SIMD_UTILS_API void conv32_destroy(conv32_t *conv)
+{
+    if (conv->plan)
+        fft_plan32_destroy(conv->plan);
+    free(conv);
+}
+
+SIMD_UTILS_API conv64_t *conv64_create(double *kernel, int len)
+{
+    conv64_t *conv = conv64_create_(kernel, len, 0);
+    if (conv)
+        conv64_reset(conv);
+    return conv;
+}
+
+SIMD_UTILS_API conv64_t *xcorr64_create(double *tmpl, int len)
+{
+    conv64_t *conv = conv64_create_(tmpl, len, 1);
+    if (conv)
+        conv64_reset(conv);
+    return conv;
+}
+
+SIMD_UTILS_API void conv64_destroy(conv64_t *conv)
+{
+    if (conv->plan)
+        fft_plan64_destroy(conv->plan);
+    free(conv);
+}
+
+/* Filters len samples (interleaved for complex convolutions) into len outputs with the
+ * direct kernel or the overlap-save block, returns len */
+static inline int conv_runf(conv32_t *conv, fir_kernelf_t kernel, conv_blockf_t block, const float *src, float *dst, int len)
+{
+    int c = conv->cplx ? 2 : 1;
+    size_t hist = (size_t) (conv->len - 1) * c;
+    int block_len = conv->fft_len ? (conv->fft_len - conv->len + 1) : CONV_BLOCK_LEN;
+    for (int pos = 0; pos < len; pos += block_len) {
+        int count = ((len - pos) < block_len) ? (len - pos) : block_len;
+        memcpy(conv->buf + hist, src + (size_t) pos * c, (size_t) count * c * sizeof(float));
+        if (conv->fft_len) {
+            if (count < block_len)
+                memset(conv->buf + hist + (size_t) count * c, 0, (size_t) (block_len - count) * c * sizeof(float));
+            block(conv);
+            memcpy(dst + (size_t) pos * c, conv->out + hist, (size_t) count * c * sizeof(float));
+        } else {
+            kernel(conv->taps, conv->len, conv->buf, dst + (size_t) pos * c, count, 0);
+        }
+        memmove(conv->buf, conv->buf + (size_t) count * c, hist * sizeof(float));
+    }
+    return len;
+}
+
+static inline int conv_rund(conv64_t *conv, fir_kerneld_t kernel, conv_blockd_t block, const double *src, double *dst, int len)
+{
+    size_t hist = (size_t) (conv->len - 1);
+    int block_len = conv->fft_len ? (conv->fft_len - conv->len + 1) : CONV_BLOCK_LEN;
+    for (int pos = 0; pos < len; pos += block_len) {
+        int count = ((len - pos) < block_len) ? (len - pos) : block_len;
+        memcpy(conv->buf + hist, src + pos, (size_t) count * sizeof(double));
+        if (conv->fft_len) {
+            if (count < block_len)
+                memset(conv->buf + hist + count, 0, (size_t) (block_len - count) * sizeof(double));
+            block(conv);
+            memcpy(dst + pos, conv->out + hist, (size_t) count * sizeof(double));
+        } else {
+            kernel(conv->taps, conv->len, conv->buf, dst + pos, count, 0);
+        }
+        memmove(conv->buf, conv->buf + count, hist * sizeof(double));
+    }
+    return len;
+}
@@ -0,0 +1,2120 @@
+/*
+ * Project : SIMD_Utils
+ * Version : 0.2.6
+ * Author  : JishinMaster
+ * Licence : BSD-2
+ */
+
+#pragma once
+
+/* Runtime CPU dispatch for x86 targets.
+ *
+ * With -DDISPATCH, simd_utils.h compiles the SSE, AVX and AVX512 backends into the
+ * same translation unit, each one with its own target options, so the binary itself
+ * only requires the baseline given on the command line (e.g -msse4.2).
+ * The best backend supported by the CPU and the OS is then selected once at startup,
+ * and the functions below (named like the RISCV vector API, e.g addf_vec) forward to
+ * add128f, add256f or add512f through a function pointer table.
+ *
+ * The SIMD_UTILS_ISA environment variable (sse, avx2 or avx512) can be used to select
+ * a lower backend than the detected one, for testing purposes.
+ */
+
+#include <cpuid.h>
+#include <stdlib.h>
+#include <string.h>
+
+// cpuid leaf 1, ECX
+#define CPUID_SSE41_BIT (1 << 19)
+#define CPUID_SSE42_BIT (1 << 20)
+#define CPUID_FMA_BIT (1 << 12)
+#define CPUID_OSXSAVE_BIT (1 << 27)
+#define CPUID_AVX_BIT (1 << 28)
+#define CPUID_F16C_BIT (1 << 29)
+// cpuid leaf 7, EBX
+#define CPUID_AVX2_BIT (1 << 5)
+#define CPUID_AVX512F_BIT (1 << 16)
+#define CPUID_AVX512DQ_BIT (1 << 17)
+#define CPUID_AVX512CD_BIT (1 << 28)
+#define CPUID_AVX512BW_BIT (1 << 30)
+#define CPUID_AVX512VL_BIT (1u << 31)
+// XCR0 : XMM and YMM states, then opmask, ZMM_Hi256 and Hi16_ZMM states
+#define XCR0_AVX_STATE 0x06
+#define XCR0_AVX512_STATE 0xE6
+
+// _xgetbv() needs -mxsave, which the baseline build does not have
+static inline uint64_t simd_utils_xgetbv(uint32_t index)
+{
+    uint32_t eax, edx;
+    __asm__ volatile("xgetbv"
+                     : "=a"(eax), "=d"(edx)
+                     : "c"(index));
+    return ((uint64_t) edx << 32) | eax;
+}
+
+// Returns the best backend usable on this CPU, checking that the OS saves the wider registers
+SIMD_UTILS_API int simd_utils_cpu_isa(void)
+{
+    uint32_t eax, ebx, ecx, edx;
+    uint32_t ecx1, ebx7 = 0;
+    uint64_t xcr0 = 0;
+
+    if (!__get_cpuid(1, &eax, &ebx, &ecx1, &edx))
+        return SimdIsaSSE;
+
+    if (__get_cpuid_max(0, NULL) >= 7) {
+        __get_cpuid_count(7, 0, &eax, &ebx7, &ecx, &edx);
+    }
+
+    if (ecx1 & CPUID_OSXSAVE_BIT)
+        xcr0 = simd_utils_xgetbv(0);
+
+    uint32_t avx2_mask = CPUID_AVX2_BIT;
+    uint32_t avx512_mask = CPUID_AVX512F_BIT | CPUID_AVX512DQ_BIT | CPUID_AVX512CD_BIT | CPUID_AVX512BW_BIT | CPUID_AVX512VL_BIT;
+    uint32_t avx_mask = CPUID_AVX_BIT | CPUID_FMA_BIT | CPUID_F16C_BIT;
+    int avx2_ok = ((ecx1 & avx_mask) == avx_mask) &&
+                  ((ebx7 & avx2_mask) == avx2_mask) &&
+                  ((xcr0 & XCR0_AVX_STATE) == XCR0_AVX_STATE);
+
+    if (avx2_ok && ((ebx7 & avx512_mask) == avx512_mask) && ((xcr0 & XCR0_AVX512_STATE) == XCR0_AVX512_STATE))
+        return SimdIsaAVX512;
+    if (avx2_ok)
+        return SimdIsaAVX2;
+    return SimdIsaSSE;
+}
+
+SIMD_UTILS_API const char *simd_utils_isa_name(int isa)
+{
+    switch (isa) {
+    case SimdIsaAVX512:
+        return "avx512";
+    case SimdIsaAVX2:
+        return "avx2";
+    default:
+        return "sse";
+    }
+}
+
+typedef struct {
+    int isa;
+    void (*setf)(float *, float, int);
+    void (*zerof)(float *, int);
+    void (*copyf)(float *, float *, int);
+    void (*addf)(float *, float *, float *, int);
+    void (*subf)(float *, float *, float *, int);
+    void (*mulf)(float *, float *, float *, int);
+    void (*divf)(float *, float *, float *, int);
+    void (*addcf)(float *, float, float *, int);
+    void (*mulcf)(float *, float, float *, int);
+    void (*muladdf)(float *, float *, float *, float *, int);
+    void (*sqrtf)(float *, float *, int);
+    void (*fabsf)(float *, float *, int);
+    void (*expf)(float *, float *, int);
+    void (*lnf)(float *, float *, int);
+    void (*log10f)(float *, float *, int);
+    void (*log2f)(float *, float *, int);
+    void (*cbrtf)(float *, float *, int);
+    void (*sinf)(float *, float *, int);
+    void (*cosf)(float *, float *, int);
+    void (*sincosf)(float *, float *, float *, int);
+    void (*tanf)(float *, float *, int);
+    void (*tanhf)(float *, float *, int);
+    void (*atanf)(float *, float *, int);
+    void (*atan2f)(float *, float *, float *, int);
+    void (*asinf)(float *, float *, int);
+    void (*sigmoidf)(float *, float *, int);
+    void (*softmaxf)(float *, float *, int);
+    void (*sumf)(float *, float *, int);
+    void (*meanf)(float *, float *, int);
+    void (*dotf)(float *, float *, int, float *);
+    void (*sumkahanf)(float *, float *, int);
+    void (*meankahanf)(float *, float *, int);
+    void (*sumpairwisef)(float *, float *, int);
+    void (*meanpairwisef)(float *, float *, int);
+    void (*dotkahanf)(float *, float *, int, float *);
+    void (*dotpairwisef)(float *, float *, int, float *);
+    void (*dotcf)(complex32_t *, complex32_t *, int, complex32_t *);
+    void (*dotckahanf)(complex32_t *, complex32_t *, int, complex32_t *);
+    void (*dotcpairwisef)(complex32_t *, complex32_t *, int, complex32_t *);
+    void (*sumd)(double *, double *, int);
+    void (*meand)(double *, double *, int);
+    void (*dotd)(double *, double *, int, double *);
+    void (*dotcd)(complex64_t *, complex64_t *, int, complex64_t *);
+    void (*sumkahand)(double *, double *, int);
+    void (*meankahand)(double *, double *, int);
+    void (*sumpairwised)(double *, double *, int);
+    void (*meanpairwised)(double *, double *, int);
+    void (*dotkahand)(double *, double *, int, double *);
+    void (*dotpairwised)(double *, double *, int, double *);
+    void (*dotckahand)(complex64_t *, complex64_t *, int, complex64_t *);
+    void (*dotcpairwised)(complex64_t *, complex64_t *, int, complex64_t *);
+    void (*momentsf)(float *, int, moments_t *);
+    void (*momentsd)(double *, int, moments_t *);
+    void (*histogramu8)(uint8_t *, int, uint32_t *);
+    void (*histogram16s)(int16_t *, int, int16_t, int, int, uint32_t *);
+    void (*histograms)(int32_t *, int, int32_t, int, int, uint32_t *);
+    void (*histogramf)(float *, int, float, float, int, uint32_t *);
+    void (*histogramf_edges)(float *, int, float *, int, uint32_t *);
+    void (*prefixsumf)(float *, float *, int, float *);
+    void (*prefixsumf_excl)(float *, float *, int, float *);
+    void (*difff)(float *, float *, int, float *);
+    void (*prefixsumd)(double *, double *, int, double *);
+    void (*prefixsumd_excl)(double *, double *, int, double *);
+    void (*diffd)(double *, double *, int, double *);
+    void (*prefixsums)(int32_t *, int32_t *, int, int32_t *);
+    void (*prefixsums_excl)(int32_t *, int32_t *, int, int32_t *);
+    void (*diffs)(int32_t *, int32_t *, int, int32_t *);
+    void (*prefixsum16s)(int16_t *, int16_t *, int, int16_t *);
+    void (*prefixsum16s_excl)(int16_t *, int16_t *, int, int16_t *);
+    void (*diff16s)(int16_t *, int16_t *, int, int16_t *);
+    void (*sortf)(float *, int);
+    void (*sortd)(double *, int);
+    void (*sorts)(int32_t *, int);
+    void (*sortf_kv)(float *, int32_t *, int);
+    void (*topkf)(float *, int, int, float *, int32_t *);
+    void (*bottomkf)(float *, int, int, float *, int32_t *);
+    void (*topks)(int32_t *, int, int, int32_t *, int32_t *);
+    void (*bottomks)(int32_t *, int, int, int32_t *, int32_t *);
+    void (*partialsortf)(float *, int, int);
+    void (*partialsorts)(int32_t *, int, int);
+    void (*minmaxf)(float *, int, float *, float *);
+    void (*maxlocf)(float *, float *, int *, int);
+    void (*minlocf)(float *, float *, int *, int);
+    void (*minmaxlocf)(float *, int, float *, int *, float *, int *);
+    void (*minmaxd)(double *, int, double *, double *);
+    void (*maxlocd)(double *, double *, int *, int);
+    void (*minlocd)(double *, double *, int *, int);
+    void (*minmaxlocd)(double *, int, double *, int *, double *, int *);
+    void (*maxeveryd)(double *, double *, double *, int);
+    void (*mineveryd)(double *, double *, double *, int);
+    void (*threshold_gt_d)(double *, double *, int, double);
+    void (*threshold_lt_d)(double *, double *, int, double);
+    void (*maxlocs)(int32_t *, int32_t *, int *, int);
+    void (*minlocs)(int32_t *, int32_t *, int *, int);
+    void (*minmaxlocs)(int32_t *, int, int32_t *, int *, int32_t *, int *);
+    void (*minmax16s)(int16_t *, int, int16_t *, int16_t *);
+    void (*maxloc16s)(int16_t *, int16_t *, int *, int);
+    void (*minloc16s)(int16_t *, int16_t *, int *, int);
+    void (*minmaxloc16s)(int16_t *, int, int16_t *, int *, int16_t *, int *);
+    void (*addsat16s)(int16_t *, int16_t *, int16_t *, int);
+    void (*subsat16s)(int16_t *, int16_t *, int16_t *, int);
+    void (*mulhi16s)(int16_t *, int16_t *, int16_t *, int);
+    void (*mulhrs16s)(int16_t *, int16_t *, int16_t *, int);
+    void (*maxevery16s)(int16_t *, int16_t *, int16_t *, int);
+    void (*minevery16s)(int16_t *, int16_t *, int16_t *, int);
+    void (*abs16s)(int16_t *, int16_t *, int);
+    void (*threshold_gt16s)(int16_t *, int16_t *, int, int16_t);
+    void (*threshold_lt16s)(int16_t *, int16_t *, int, int16_t);
+    void (*addsatu8)(uint8_t *, uint8_t *, uint8_t *, int);
+    void (*subsatu8)(uint8_t *, uint8_t *, uint8_t *, int);
+    void (*absdiffu8)(uint8_t *, uint8_t *, uint8_t *, int);
+    void (*maxeveryu8)(uint8_t *, uint8_t *, uint8_t *, int);
+    void (*mineveryu8)(uint8_t *, uint8_t *, uint8_t *, int);
+    void (*threshold_gtu8)(uint8_t *, uint8_t *, int, uint8_t);
+    void (*threshold_ltu8)(uint8_t *, uint8_t *, int, uint8_t);
+    void (*convertInt16ToU8)(int16_t *, uint8_t *, int, int);
+    void (*convertU8ToInt16)(uint8_t *, int16_t *, int, int);
+    void (*add64s)(int64_t *, int64_t *, int64_t *, int);
+    void (*sub64s)(int64_t *, int64_t *, int64_t *, int);
+    void (*mul64s)(int64_t *, int64_t *, int64_t *, int);
+    void (*sum64s)(int64_t *, int64_t *, int);
+    void (*maxevery64s)(int64_t *, int64_t *, int64_t *, int);
+    void (*minevery64s)(int64_t *, int64_t *, int64_t *, int);
+    void (*maxeveryu64)(uint64_t *, uint64_t *, uint64_t *, int);
+    void (*mineveryu64)(uint64_t *, uint64_t *, uint64_t *, int);
+    void (*minmax64s)(int64_t *, int, int64_t *, int64_t *);
+    void (*minmaxu64)(uint64_t *, int, uint64_t *, uint64_t *);
+    void (*cmpeq64s)(int64_t *, int64_t *, int64_t *, int);
+    void (*cmpgt64s)(int64_t *, int64_t *, int64_t *, int);
+    void (*cmpgtu64)(uint64_t *, uint64_t *, uint64_t *, int);
+    void (*sll64s)(int64_t *, int64_t *, int, int);
+    void (*sra64s)(int64_t *, int64_t *, int, int);
+    void (*srlu64)(uint64_t *, uint64_t *, int, int);
+    void (*maxeveryf)(float *, float *, float *, int);
+    void (*mineveryf)(float *, float *, float *, int);
+    void (*threshold_gt_f)(float *, float *, int, float);
+    void (*threshold_lt_f)(float *, float *, int, float);
+    void (*cplxvecmulf)(complex32_t *, complex32_t *, complex32_t *, int);
+    void (*magnitudef_split)(float *, float *, float *, int);
+    void (*powerspectf_split)(float *, float *, float *, int);
+    void (*pipelinef)(float *, float *, int, const pipeline_op_t *, int);
+    void (*pipelinef_sum)(float *, float *, int, const pipeline_op_t *, int);
+    void (*fftf)(fft_plan32_t *, complex32_t *, complex32_t *);
+    void (*ifftf)(fft_plan32_t *, complex32_t *, complex32_t *);
+    void (*fftf_split)(fft_plan32_t *, float *, float *, float *, float *);
+    void (*ifftf_split)(fft_plan32_t *, float *, float *, float *, float *);
+    void (*rfftf)(fft_plan32_t *, float *, complex32_t *);
+    void (*irfftf)(fft_plan32_t *, complex32_t *, float *);
+    int (*firf)(fir32_t *, float *, float *, int);
+    int (*firf_cplx)(fir32_t *, complex32_t *, complex32_t *, int);
+    int (*firf_split)(fir32_t *, float *, float *, float *, float *, int);
+    void (*iirf)(iir32_t *, float *, float *, int);
+    int (*convf)(conv32_t *, float *, float *, int);
+    int (*convf_cplx)(conv32_t *, complex32_t *, complex32_t *, int);
+    void (*setd)(double *, double, int);
+    void (*copyd)(double *, double *, int);
+    void (*addd)(double *, double *, double *, int);
+    void (*subd)(double *, double *, double *, int);
+    void (*muld)(double *, double *, double *, int);
+    void (*divd)(double *, double *, double *, int);
+    void (*sqrtd)(double *, double *, int);
+    void (*fabsd)(double *, double *, int);
+    void (*expd)(double *, double *, int);
+    void (*lnd)(double *, double *, int);
+    void (*log2d)(double *, double *, int);
+    void (*log10d)(double *, double *, int);
+    void (*sinhd)(double *, double *, int);
+    void (*coshd)(double *, double *, int);
+    void (*tanhd)(double *, double *, int);
+    void (*asinhd)(double *, double *, int);
+    void (*acoshd)(double *, double *, int);
+    void (*atanhd)(double *, double *, int);
+    void (*cbrtd)(double *, double *, int);
+    void (*acosd)(double *, double *, int);
+    void (*sigmoidd)(double *, double *, int);
+    void (*softmaxd)(double *, double *, int);
+    void (*sincosd)(double *, double *, double *, int);
+    void (*atand)(double *, double *, int);
+    void (*asind)(double *, double *, int);
+    void (*fftd)(fft_plan64_t *, complex64_t *, complex64_t *);
+    void (*ifftd)(fft_plan64_t *, complex64_t *, complex64_t *);
+    void (*fftd_split)(fft_plan64_t *, double *, double *, double *, double *);
+    void (*ifftd_split)(fft_plan64_t *, double *, double *, double *, double *);
+    void (*rfftd)(fft_plan64_t *, double *, complex64_t *);
+    void (*irfftd)(fft_plan64_t *, complex64_t *, double *);
+    void (*cplxvecmuld)(complex64_t *, complex64_t *, complex64_t *, int);
+    void (*cplxconjvecmuld)(complex64_t *, complex64_t *, complex64_t *, int);
+    void (*cplxvecdivd)(complex64_t *, complex64_t *, complex64_t *, int);
+    void (*cplxconjd)(complex64_t *, complex64_t *, int);
+    void (*magnituded_split)(double *, double *, double *, int);
+    void (*magnituded_interleaved)(complex64_t *, double *, int);
+    void (*powerspectd_split)(double *, double *, double *, int);
+    void (*powerspectd_interleaved)(complex64_t *, double *, int);
+    int (*convd)(conv64_t *, double *, double *, int);
+    void (*adds)(int32_t *, int32_t *, int32_t *, int);
+    void (*subs)(int32_t *, int32_t *, int32_t *, int);
+    void (*muls)(int32_t *, int32_t *, int32_t *, int);
+} dispatch_table_t;
+
+// Starts on the baseline backend, so calls made before the constructor are still valid
+static dispatch_table_t simd_dispatch = {
+    SimdIsaSSE,
+    set128f,
+    zero128f,
+    copy128f,
+    add128f,
+    sub128f,
+    mul128f,
+    div128f,
+    addc128f,
+    mulc128f,
+    muladd128f,
+    sqrt128f,
+    fabs128f,
+    exp128f,
+    ln128f,
+    log10128f,
+    log2128f,
+    cbrt128f,
+    sin128f,
+    cos128f,
+    sincos128f,
+    tan128f,
+    tanh128f,
+    atan128f,
+    atan2128f,
+    asin128f,
+    sigmoid128f,
+    softmax128f,
+    sum128f,
+    mean128f,
+    dot128f,
+    sumkahan128f,
+    meankahan128f,
+    sumpairwise128f,
+    meanpairwise128f,
+    dotkahan128f,
+    dotpairwise128f,
+    dotc128f,
+    dotckahan128f,
+    dotcpairwise128f,
+    sum128d,
+    mean128d,
+    dot128d,
+    dotc128d,
+    sumkahan128d,
+    meankahan128d,
+    sumpairwise128d,
+    meanpairwise128d,
+    dotkahan128d,
+    dotpairwise128d,
+    dotckahan128d,
+    dotcpairwise128d,
+    moments128f,
+    moments128d,
+    histogramu8_128,
+    histogram16s_128s,
+    histogram128s,
+    histogram128f,
+    histogram128f_edges,
+    prefixsum128f,
+    prefixsum128f_excl,
+    diff128f,
+    prefixsum128d,
+    prefixsum128d_excl,
+    diff128d,
+    prefixsum128s,
+    prefixsum128s_excl,
+    diff128s,
+    prefixsum16s_128s,
+    prefixsum16s_128s_excl,
+    diff16s_128s,
+    sort128f,
+    sort128d,
+    sort128s,
+    sort128f_kv,
+    topk128f,
+    bottomk128f,
+    topk128s,
+    bottomk128s,
+    partialsort128f,
+    partialsort128s,
+    minmax128f,
+    maxloc128f,
+    minloc128f,
+    minmaxloc128f,
+    minmax128d,
+    maxloc128d,
+    minloc128d,
+    minmaxloc128d,
+    maxevery128d,
+    minevery128d,
+    threshold128_gt_d,
+    threshold128_lt_d,
+    maxloc128s,
+    minloc128s,
+    minmaxloc128s,
+    minmax16s_128s,
+    maxloc16s_128s,
+    minloc16s_128s,
+    minmaxloc16s_128s,
+    addsat16s_128s,
+    subsat16s_128s,
+    mulhi16s_128s,
+    mulhrs16s_128s,
+    maxevery16s_128s,
+    minevery16s_128s,
+    abs16s_128s,
+    threshold_gt16s_128s,
+    threshold_lt16s_128s,
+    addsatu8_128,
+    subsatu8_128,
+    absdiffu8_128,
+    maxeveryu8_128,
+    mineveryu8_128,
+    threshold_gtu8_128,
+    threshold_ltu8_128,
+    convertInt16ToU8_128,
+    convertU8ToInt16_128,
+    add64s_128s,
+    sub64s_128s,
+    mul64s_128s,
+    sum64s_128s,
+    maxevery64s_128s,
+    minevery64s_128s,
+    maxeveryu64_128,
+    mineveryu64_128,
+    minmax64s_128s,
+    minmaxu64_128,
+    cmpeq64s_128s,
+    cmpgt64s_128s,
+    cmpgtu64_128,
+    sll64s_128s,
+    sra64s_128s,
+    srlu64_128,
+    maxevery128f,
+    minevery128f,
+    threshold128_gt_f,
+    threshold128_lt_f,
+    cplxvecmul128f,
+    magnitude128f_split,
+    powerspect128f_split,
+    pipeline128f,
+    pipeline128f_sum,
+    fft128f,
+    ifft128f,
+    fft128f_split,
+    ifft128f_split,
+    rfft128f,
+    irfft128f,
+    fir128f,
+    fir128f_cplx,
+    fir128f_split,
+    iir128f,
+    conv128f,
+    conv128f_cplx,
+    set128d,
+    copy128d,
+    add128d,
+    sub128d,
+    mul128d,
+    div128d,
+    sqrt128d,
+    fabs128d,
+    exp128d,
+    ln128d,
+    log2128d,
+    log10128d,
+    sinh128d,
+    cosh128d,
+    tanh128d,
+    asinh128d,
+    acosh128d,
+    atanh128d,
+    cbrt128d,
+    acos128d,
+    sigmoid128d,
+    softmax128d,
+    sincos128d,
+    atan128d,
+    asin128d,
+    fft128d,
+    ifft128d,
+    fft128d_split,
+    ifft128d_split,
+    rfft128d,
+    irfft128d,
+    cplxvecmul128d,
+    cplxconjvecmul128d,
+    cplxvecdiv128d,
+    cplxconj128d,
+    magnitude128d_split,
+    magnitude128d_interleaved,
+    powerspect128d_split,
+    powerspect128d_interleaved,
+    conv128d,
+    add128s,
+    sub128s,
+    mul128s};
+
+static inline void simd_utils_dispatch_set(dispatch_table_t *table, int isa)
+{
+    switch (isa) {
+    case SimdIsaAVX512:
+        table->setf = set512f;
+        table->zerof = zero512f;
+        table->copyf = copy512f;
+        table->addf = add512f;
+        table->subf = sub512f;
+        table->mulf = mul512f;
+        table->divf = div512f;
+        table->addcf = addc512f;
+        table->mulcf = mulc512f;
+        table->muladdf = muladd512f;
+        table->sqrtf = sqrt512f;
+        table->fabsf = fabs512f;
+        table->expf = exp512f;
+        table->lnf = ln512f;
+        table->log10f = log10512f;
+        table->log2f = log2512f;
+        table->cbrtf = cbrt512f;
+        table->sinf = sin512f;
+        table->cosf = cos512f;
+        table->sincosf = sincos512f;
+        table->tanf = tan512f;
+        table->tanhf = tanh512f;
+        table->atanf = atan512f;
+        table->atan2f = atan2512f;
+        table->asinf = asin512f;
+        table->sigmoidf = sigmoid512f;
+        table->softmaxf = softmax512f;
+        table->sumf = sum512f;
+        table->meanf = mean512f;
+        table->dotf = dot512f;
+        table->sumkahanf = sumkahan512f;
+        table->meankahanf = meankahan512f;
+        table->sumpairwisef = sumpairwise512f;
+        table->meanpairwisef = meanpairwise512f;
+        table->dotkahanf = dotkahan512f;
+        table->dotpairwisef = dotpairwise512f;
+        table->dotcf = dotc512f;
+        table->dotckahanf = dotckahan512f;
+        table->dotcpairwisef = dotcpairwise512f;
+        table->sumd = sum512d;
+        table->meand = mean512d;
+        table->dotd = dot512d;
+        table->dotcd = dotc512d;
+        table->sumkahand = sumkahan512d;
+        table->meankahand = meankahan512d;
+        table->sumpairwised = sumpairwise512d;
+        table->meanpairwised = meanpairwise512d;
+        table->dotkahand = dotkahan512d;
+        table->dotpairwised = dotpairwise512d;
+        table->dotckahand = dotckahan512d;
+        table->dotcpairwised = dotcpairwise512d;
+        table->momentsf = moments512f;
+        table->momentsd = moments512d;
+        table->histogramu8 = histogramu8_512;
+        table->histogram16s = histogram16s_512s;
+        table->histograms = histogram512s;
+        table->histogramf = histogram512f;
+        table->histogramf_edges = histogram512f_edges;
+        table->prefixsumf = prefixsum512f;
+        table->prefixsumf_excl = prefixsum512f_excl;
+        table->difff = diff512f;
+        table->prefixsumd = prefixsum512d;
+        table->prefixsumd_excl = prefixsum512d_excl;
+        table->diffd = diff512d;
+        table->prefixsums = prefixsum512s;
+        table->prefixsums_excl = prefixsum512s_excl;
+        table->diffs = diff512s;
+        table->prefixsum16s = prefixsum16s_512s;
+        table->prefixsum16s_excl = prefixsum16s_512s_excl;
+        table->diff16s = diff16s_512s;
+        table->sortf = sort512f;
+        table->sortd = sort512d;
+        table->sorts = sort512s;
+        table->sortf_kv = sort512f_kv;
+        table->topkf = topk512f;
+        table->bottomkf = bottomk512f;
+        table->topks = topk512s;
+        table->bottomks = bottomk512s;
+        table->partialsortf = partialsort512f;
+        table->partialsorts = partialsort512s;
+        table->minmaxf = minmax512f;
+        table->maxlocf = maxloc512f;
+        table->minlocf = minloc512f;
+        table->minmaxlocf = minmaxloc512f;
+        table->minmaxd = minmax512d;
+        table->maxlocd = maxloc512d;
+        table->minlocd = minloc512d;
+        table->minmaxlocd = minmaxloc512d;
+        table->maxeveryd = maxevery512d;
+        table->mineveryd = minevery512d;
+        table->threshold_gt_d = threshold512_gt_d;
+        table->threshold_lt_d = threshold512_lt_d;
+        table->maxlocs = maxloc512s;
+        table->minlocs = minloc512s;
+        table->minmaxlocs = minmaxloc512s;
+        table->minmax16s = minmax16s_512s;
+        table->maxloc16s = maxloc16s_512s;
+        table->minloc16s = minloc16s_512s;
+        table->minmaxloc16s = minmaxloc16s_512s;
+        table->addsat16s = addsat16s_512s;
+        table->subsat16s = subsat16s_512s;
+        table->mulhi16s = mulhi16s_512s;
+        table->mulhrs16s = mulhrs16s_512s;
+        table->maxevery16s = maxevery16s_512s;
+        table->minevery16s = minevery16s_512s;
+        table->abs16s = abs16s_512s;
+        table->threshold_gt16s = threshold_gt16s_512s;
+        table->threshold_lt16s = threshold_lt16s_512s;
+        table->addsatu8 = addsatu8_512;
+        table->subsatu8 = subsatu8_512;
+        table->absdiffu8 = absdiffu8_512;
+        table->maxeveryu8 = maxeveryu8_512;
+        table->mineveryu8 = mineveryu8_512;
+        table->threshold_gtu8 = threshold_gtu8_512;
+        table->threshold_ltu8 = threshold_ltu8_512;
+        table->convertInt16ToU8 = convertInt16ToU8_512;
+        table->convertU8ToInt16 = convertU8ToInt16_512;
+        table->add64s = add64s_512s;
+        table->sub64s = sub64s_512s;
+        table->mul64s = mul64s_512s;
+        table->sum64s = sum64s_512s;
+        table->maxevery64s = maxevery64s_512s;
+        table->minevery64s = minevery64s_512s;
+        table->maxeveryu64 = maxeveryu64_512;
+        table->mineveryu64 = mineveryu64_512;
+        table->minmax64s = minmax64s_512s;
+        table->minmaxu64 = minmaxu64_512;
+        table->cmpeq64s = cmpeq64s_512s;
+        table->cmpgt64s = cmpgt64s_512s;
+        table->cmpgtu64 = cmpgtu64_512;
+        table->sll64s = sll64s_512s;
+        table->sra64s = sra64s_512s;
+        table->srlu64 = srlu64_512;
+        table->maxeveryf = maxevery512f;
+        table->mineveryf = minevery512f;
+        table->threshold_gt_f = threshold512_gt_f;
+        table->threshold_lt_f = threshold512_lt_f;
+        table->cplxvecmulf = cplxvecmul512f;
+        table->magnitudef_split = magnitude512f_split;
+        table->powerspectf_split = powerspect512f_split;
+        table->pipelinef = pipeline512f;
+        table->pipelinef_sum = pipeline512f_sum;
+        table->fftf = fft512f;
+        table->ifftf = ifft512f;
+        table->fftf_split = fft512f_split;
+        table->ifftf_split = ifft512f_split;
+        table->rfftf = rfft512f;
+        table->irfftf = irfft512f;
+        table->firf = fir512f;
+        table->firf_cplx = fir512f_cplx;
+        table->firf_split = fir512f_split;
+        table->iirf = iir512f;
+        table->convf = conv512f;
+        table->convf_cplx = conv512f_cplx;
+        table->setd = set512d;
+        table->copyd = copy512d;
+        table->addd = add512d;
+        table->subd = sub512d;
+        table->muld = mul512d;
+        table->divd = div512d;
+        table->sqrtd = sqrt512d;
+        table->fabsd = fabs512d;
+        table->expd = exp512d;
+        table->lnd = ln512d;
+        table->log2d = log2512d;
+        table->log10d = log10512d;
+        table->sinhd = sinh512d;
+        table->coshd = cosh512d;
+        table->tanhd = tanh512d;
+        table->asinhd = asinh512d;
+        table->acoshd = acosh512d;
+        table->atanhd = atanh512d;
+        table->cbrtd = cbrt512d;
+        table->acosd = acos512d;
+        table->sigmoidd = sigmoid512d;
+        table->softmaxd = softmax512d;
+        table->sincosd = sincos512d;
+        table->atand = atan512d;
+        table->asind = asin512d;
+        table->fftd = fft512d;
+        table->ifftd = ifft512d;
+        table->fftd_split = fft512d_split;
+        table->ifftd_split = ifft512d_split;
+        table->rfftd = rfft512d;
+        table->irfftd = irfft512d;
+        table->cplxvecmuld = cplxvecmul512d;
+        table->cplxconjvecmuld = cplxconjvecmul512d;
+        table->cplxvecdivd = cplxvecdiv512d;
+        table->cplxconjd = cplxconj512d;
+        table->magnituded_split = magnitude512d_split;
+        table->magnituded_interleaved = magnitude512d_interleaved;
+        table->powerspectd_split = powerspect512d_split;
+        table->powerspectd_interleaved = powerspect512d_interleaved;
+        table->convd = conv512d;
+        table->adds = add512s;
+        table->subs = sub512s;
+        table->muls = mul512s;
+        break;
+    case SimdIsaAVX2:
+        table->setf = set256f;
+        table->zerof = zero256f;
+        table->copyf = copy256f;
+        table->addf = add256f;
+        table->subf = sub256f;
+        table->mulf = mul256f;
+        table->divf = div256f;
+        table->addcf = addc256f;
+        table->mulcf = mulc256f;
+        table->muladdf = muladd256f;
+        table->sqrtf = sqrt256f;
+        table->fabsf = fabs256f;
+        table->expf = exp256f;
+        table->lnf = ln256f;
+        table->log10f = log10256f;
+        table->log2f = log2256f;
+        table->cbrtf = cbrt256f;
+        table->sinf = sin256f;
+        table->cosf = cos256f;
+        table->sincosf = sincos256f;
+        table->tanf = tan256f;
+        table->tanhf = tanh256f;
+        table->atanf = atan256f;
+        table->atan2f = atan2256f;
+        table->asinf = asin256f;
+        table->sigmoidf = sigmoid256f;
+        table->softmaxf = softmax256f;
+        table->sumf = sum256f;
+        table->meanf = mean256f;
+        table->dotf = dot256f;
+        table->sumkahanf = sumkahan256f;
+        table->meankahanf = meankahan256f;
+        table->sumpairwisef = sumpairwise256f;
+        table->meanpairwisef = meanpairwise256f;
+        table->dotkahanf = dotkahan256f;
+        table->dotpairwisef = dotpairwise256f;
+        table->dotcf = dotc256f;
+        table->dotckahanf = dotckahan256f;
+        table->dotcpairwisef = dotcpairwise256f;
+        table->sumd = sum256d;
+        table->meand = mean256d;
+        table->dotd = dot256d;
+        table->dotcd = dotc256d;
+        table->sumkahand = sumkahan256d;
+        table->meankahand = meankahan256d;
+        table->sumpairwised = sumpairwise256d;
+        table->meanpairwised = meanpairwise256d;
+        table->dotkahand = dotkahan256d;
+        table->dotpairwised = dotpairwise256d;
+        table->dotckahand = dotckahan256d;
+        table->dotcpairwised = dotcpairwise256d;
+        table->momentsf = moments256f;
+        table->momentsd = moments256d;
+        table->histogramu8 = histogramu8_256;
+        table->histogram16s = histogram16s_256s;
+        table->histograms = histogram256s;
+        table->histogramf = histogram256f;
+        table->histogramf_edges = histogram256f_edges;
+        table->prefixsumf = prefixsum256f;
+        table->prefixsumf_excl = prefixsum256f_excl;
+        table->difff = diff256f;
+        table->prefixsumd = prefixsum256d;
+        table->prefixsumd_excl = prefixsum256d_excl;
+        table->diffd = diff256d;
+        table->prefixsums = prefixsum256s;
+        table->prefixsums_excl = prefixsum256s_excl;
+        table->diffs = diff256s;
+        table->prefixsum16s = prefixsum16s_256s;
+        table->prefixsum16s_excl = prefixsum16s_256s_excl;
+        table->diff16s = diff16s_256s;
+        table->sortf = sort256f;
+        table->sortd = sort256d;
+        table->sorts = sort256s;
+        table->sortf_kv = sort256f_kv;
+        table->topkf = topk256f;
+        table->bottomkf = bottomk256f;
+        table->topks = topk256s;
+        table->bottomks = bottomk256s;
+        table->partialsortf = partialsort256f;
+        table->partialsorts = partialsort256s;
+        table->minmaxf = minmax256f;
+        table->maxlocf = maxloc256f;
+        table->minlocf = minloc256f;
+        table->minmaxlocf = minmaxloc256f;
+        table->minmaxd = minmax256d;
+        table->maxlocd = maxloc256d;
+        table->minlocd = minloc256d;
+        table->minmaxlocd = minmaxloc256d;
+        table->maxeveryd = maxevery256d;
+        table->mineveryd = minevery256d;
+        table->threshold_gt_d = threshold256_gt_d;
+        table->threshold_lt_d = threshold256_lt_d;
+        table->maxlocs = maxloc256s;
+        table->minlocs = minloc256s;
+        table->minmaxlocs = minmaxloc256s;
+        table->minmax16s = minmax16s_256s;
+        table->maxloc16s = maxloc16s_256s;
+        table->minloc16s = minloc16s_256s;
+        table->minmaxloc16s = minmaxloc16s_256s;
+        table->addsat16s = addsat16s_256s;
+        table->subsat16s = subsat16s_256s;
+        table->mulhi16s = mulhi16s_256s;
+        table->mulhrs16s = mulhrs16s_256s;
+        table->maxevery16s = maxevery16s_256s;
+        table->minevery16s = minevery16s_256s;
+        table->abs16s = abs16s_256s;
+        table->threshold_gt16s = threshold_gt16s_256s;
+        table->threshold_lt16s = threshold_lt16s_256s;
+        table->addsatu8 = addsatu8_256;
+        table->subsatu8 = subsatu8_256;
+        table->absdiffu8 = absdiffu8_256;
+        table->maxeveryu8 = maxeveryu8_256;
+        table->mineveryu8 = mineveryu8_256;
+        table->threshold_gtu8 = threshold_gtu8_256;
+        table->threshold_ltu8 = threshold_ltu8_256;
+        table->convertInt16ToU8 = convertInt16ToU8_256;
+        table->convertU8ToInt16 = convertU8ToInt16_256;
+        table->add64s = add64s_256s;
+        table->sub64s = sub64s_256s;
+        table->mul64s = mul64s_256s;
+        table->sum64s = sum64s_256s;
+        table->maxevery64s = maxevery64s_256s;
+        table->minevery64s = minevery64s_256s;
+        table->maxeveryu64 = maxeveryu64_256;
+        table->mineveryu64 = mineveryu64_256;
+        table->minmax64s = minmax64s_256s;
+        table->minmaxu64 = minmaxu64_256;
+        table->cmpeq64s = cmpeq64s_256s;
+        table->cmpgt64s = cmpgt64s_256s;
+        table->cmpgtu64 = cmpgtu64_256;
+        table->sll64s = sll64s_256s;
+        table->sra64s = sra64s_256s;
+        table->srlu64 = srlu64_256;
+        table->maxeveryf = maxevery256f;
+        table->mineveryf = minevery256f;
+        table->threshold_gt_f = threshold256_gt_f;
+        table->threshold_lt_f = threshold256_lt_f;
+        table->cplxvecmulf = cplxvecmul256f;
+        table->magnitudef_split = magnitude256f_split;
+        table->powerspectf_split = powerspect256f_split;
+        table->pipelinef = pipeline256f;
+        table->pipelinef_sum = pipeline256f_sum;
+        table->fftf = fft256f;
+        table->ifftf = ifft256f;
+        table->fftf_split = fft256f_split;
+        table->ifftf_split = ifft256f_split;
+        table->rfftf = rfft256f;
+        table->irfftf = irfft256f;
+        table->firf = fir256f;
+        table->firf_cplx = fir256f_cplx;
+        table->firf_split = fir256f_split;
+        table->iirf = iir256f;
+        table->convf = conv256f;
+        table->convf_cplx = conv256f_cplx;
+        table->setd = set256d;
+        table->copyd = copy256d;
+        table->addd = add256d;
+        table->subd = sub256d;
+        table->muld = mul256d;
+        table->divd = div256d;
+        table->sqrtd = sqrt256d;
+        table->fabsd = fabs256d;
+        table->expd = exp256d;
+        table->lnd = ln256d;
+        table->log2d = log2256d;
+        table->log10d = log10256d;
+        table->sinhd = sinh256d;
+        table->coshd = cosh256d;
+        table->tanhd = tanh256d;
+        table->asinhd = asinh256d;
+        table->acoshd = acosh256d;
+        table->atanhd = atanh256d;
+        table->cbrtd = cbrt256d;
+        table->acosd = acos256d;
+        table->sigmoidd = sigmoid256d;
+        table->softmaxd = softmax256d;
+        table->sincosd = sincos256d;
+        table->atand = atan256d;
+        table->asind = asin256d;
+        table->fftd = fft256d;
+        table->ifftd = ifft256d;
+        table->fftd_split = fft256d_split;
+        table->ifftd_split = ifft256d_split;
+        table->rfftd = rfft256d;
+        table->irfftd = irfft256d;
+        table->cplxvecmuld = cplxvecmul256d;
+        table->cplxconjvecmuld = cplxconjvecmul256d;
+        table->cplxvecdivd = cplxvecdiv256d;
+        table->cplxconjd = cplxconj256d;
+        table->magnituded_split = magnitude256d_split;
+        table->magnituded_interleaved = magnitude256d_interleaved;
+        table->powerspectd_split = powerspect256d_split;
+        table->powerspectd_interleaved = powerspect256d_interleaved;
+        table->convd = conv256d;
+        table->adds = add256s;
+        table->subs = sub256s;
+        table->muls = mul256s;
+        break;
+    default:
+        isa = SimdIsaSSE;
+        table->setf = set128f;
+        table->zerof = zero128f;
+        table->copyf = copy128f;
+        table->addf = add128f;
+        table->subf = sub128f;
+        table->mulf = mul128f;
+        table->divf = div128f;
+        table->addcf = addc128f;
+        table->mulcf = mulc128f;
+        table->muladdf = muladd128f;
+        table->sqrtf = sqrt128f;
+        table->fabsf = fabs128f;
+        table->expf = exp128f;
+        table->lnf = ln128f;
+        table->log10f = log10128f;
+        table->log2f = log2128f;
+        table->cbrtf = cbrt128f;
+        table->sinf = sin128f;
+        table->cosf = cos128f;
+        table->sincosf = sincos128f;
+        table->tanf = tan128f;
+        table->tanhf = tanh128f;
+        table->atanf = atan128f;
+        table->atan2f = atan2128f;
+        table->asinf = asin128f;
+        table->sigmoidf = sigmoid128f;
+        table->softmaxf = softmax128f;
+        table->sumf = sum128f;
+        table->meanf = mean128f;
+        table->dotf = dot128f;
+        table->sumkahanf = sumkahan128f;
+        table->meankahanf = meankahan128f;
+        table->sumpairwisef = sumpairwise128f;
+        table->meanpairwisef = meanpairwise128f;
+        table->dotkahanf = dotkahan128f;
+        table->dotpairwisef = dotpairwise128f;
+        table->dotcf = dotc128f;
+        table->dotckahanf = dotckahan128f;
+        table->dotcpairwisef = dotcpairwise128f;
+        table->sumd = sum128d;
+        table->meand = mean128d;
+        table->dotd = dot128d;
+        table->dotcd = dotc128d;
+        table->sumkahand = sumkahan128d;
+        table->meankahand = meankahan128d;
+        table->sumpairwised = sumpairwise128d;
+        table->meanpairwised = meanpairwise128d;
+        table->dotkahand = dotkahan128d;
+        table->dotpairwised = dotpairwise128d;
+        table->dotckahand = dotckahan128d;
+        table->dotcpairwised = dotcpairwise128d;
+        table->momentsf = moments128f;
+        table->momentsd = moments128d;
+        table->histogramu8 = histogramu8_128;
+        table->histogram16s = histogram16s_128s;
+        table->histograms = histogram128s;
+        table->histogramf = histogram128f;
+        table->histogramf_edges = histogram128f_edges;
+        table->prefixsumf = prefixsum128f;
+        table->prefixsumf_excl = prefixsum128f_excl;
+        table->difff = diff128f;
+        table->prefixsumd = prefixsum128d;
+        table->prefixsumd_excl = prefixsum128d_excl;
+        table->diffd = diff128d;
+        table->prefixsums = prefixsum128s;
+        table->prefixsums_excl = prefixsum128s_excl;
+        table->diffs = diff128s;
+        table->prefixsum16s = prefixsum16s_128s;
+        table->prefixsum16s_excl = prefixsum16s_128s_excl;
+        table->diff16s = diff16s_128s;
+        table->sortf = sort128f;
+        table->sortd = sort128d;
+        table->sorts = sort128s;
+        table->sortf_kv = sort128f_kv;
+        table->topkf = topk128f;
+        table->bottomkf = bottomk128f;
+        table->topks = topk128s;
+        table->bottomks = bottomk128s;
+        table->partialsortf = partialsort128f;
+        table->partialsorts = partialsort128s;
+        table->minmaxf = minmax128f;
+        table->maxlocf = maxloc128f;
+        table->minlocf = minloc128f;
+        table->minmaxlocf = minmaxloc128f;
+        table->minmaxd = minmax128d;
+        table->maxlocd = maxloc128d;
+        table->minlocd = minloc128d;
+        table->minmaxlocd = minmaxloc128d;
+        table->maxeveryd = maxevery128d;
+        table->mineveryd = minevery128d;
+        table->threshold_gt_d = threshold128_gt_d;
+        table->threshold_lt_d = threshold128_lt_d;
+        table->maxlocs = maxloc128s;
+        table->minlocs = minloc128s;
+        table->minmaxlocs = minmaxloc128s;
+        table->minmax16s = minmax16s_128s;
+        table->maxloc16s = maxloc16s_128s;
+        table->minloc16s = minloc16s_128s;
+        table->minmaxloc16s = minmaxloc16s_128s;
+        table->addsat16s = addsat16s_128s;
+        table->subsat16s = subsat16s_128s;
+        table->mulhi16s = mulhi16s_128s;
+        table->mulhrs16s = mulhrs16s_128s;
+        table->maxevery16s = maxevery16s_128s;
+        table->minevery16s = minevery16s_128s;
+        table->abs16s = abs16s_128s;
+        table->threshold_gt16s = threshold_gt16s_128s;
+        table->threshold_lt16s = threshold_lt16s_128s;
+        table->addsatu8 = addsatu8_128;
+        table->subsatu8 = subsatu8_128;
+        table->absdiffu8 = absdiffu8_128;
+        table->maxeveryu8 = maxeveryu8_128;
+        table->mineveryu8 = mineveryu8_128;
+        table->threshold_gtu8 = threshold_gtu8_128;
+        table->threshold_ltu8 = threshold_ltu8_128;
+        table->convertInt16ToU8 = convertInt16ToU8_128;
+        table->convertU8ToInt16 = convertU8ToInt16_128;
+        table->add64s = add64s_128s;
+        table->sub64s = sub64s_128s;
+        table->mul64s = mul64s_128s;
+        table->sum64s = sum64s_128s;
+        table->maxevery64s = maxevery64s_128s;
+        table->minevery64s = minevery64s_128s;
+        table->maxeveryu64 = maxeveryu64_128;
+        table->mineveryu64 = mineveryu64_128;
+        table->minmax64s = minmax64s_128s;
+        table->minmaxu64 = minmaxu64_128;
+        table->cmpeq64s = cmpeq64s_128s;
+        table->cmpgt64s = cmpgt64s_128s;
+        table->cmpgtu64 = cmpgtu64_128;
+        table->sll64s = sll64s_128s;
+        table->sra64s = sra64s_128s;
+        table->srlu64 = srlu64_128;
+        table->maxeveryf = maxevery128f;
+        table->mineveryf = minevery128f;
+        table->threshold_gt_f = threshold128_gt_f;
+        table->threshold_lt_f = threshold128_lt_f;
+        table->cplxvecmulf = cplxvecmul128f;
+        table->magnitudef_split = magnitude128f_split;
+        table->powerspectf_split = powerspect128f_split;
+        table->pipelinef = pipeline128f;
+        table->pipelinef_sum = pipeline128f_sum;
+        table->fftf = fft128f;
+        table->ifftf = ifft128f;
+        table->fftf_split = fft128f_split;
+        table->ifftf_split = ifft128f_split;
+        table->rfftf = rfft128f;
+        table->irfftf = irfft128f;
+        table->firf = fir128f;
+        table->firf_cplx = fir128f_cplx;
+        table->firf_split = fir128f_split;
+        table->iirf = iir128f;
+        table->convf = conv128f;
+        table->convf_cplx = conv128f_cplx;
+        table->setd = set128d;
+        table->copyd = copy128d;
+        table->addd = add128d;
+        table->subd = sub128d;
+        table->muld = mul128d;
+        table->divd = div128d;
+        table->sqrtd = sqrt128d;
+        table->fabsd = fabs128d;
+        table->expd = exp128d;
+        table->lnd = ln128d;
+        table->log2d = log2128d;
+        table->log10d = log10128d;
+        table->sinhd = sinh128d;
+        table->coshd = cosh128d;
+        table->tanhd = tanh128d;
+        table->asinhd = asinh128d;
+        table->acoshd = acosh128d;
+        table->atanhd = atanh128d;
+        table->cbrtd = cbrt128d;
+        table->acosd = acos128d;
+        table->sigmoidd = sigmoid128d;
+        table->softmaxd = softmax128d;
+        table->sincosd = sincos128d;
+        table->atand = atan128d;
+        table->asind = asin128d;
+        table->fftd = fft128d;
+        table->ifftd = ifft128d;
+        table->fftd_split = fft128d_split;
+        table->ifftd_split = ifft128d_split;
+        table->rfftd = rfft128d;
+        table->irfftd = irfft128d;
+        table->cplxvecmuld = cplxvecmul128d;
+        table->cplxconjvecmuld = cplxconjvecmul128d;
+        table->cplxvecdivd = cplxvecdiv128d;
+        table->cplxconjd = cplxconj128d;
+        table->magnituded_split = magnitude128d_split;
+        table->magnituded_interleaved = magnitude128d_interleaved;
+        table->powerspectd_split = powerspect128d_split;
+        table->powerspectd_interleaved = powerspect128d_interleaved;
+        table->convd = conv128d;
+        table->adds = add128s;
+        table->subs = sub128s;
+        table->muls = mul128s;
+        break;
+    }
+    table->isa = isa;
+}
+
+/* Selects the backend for the current CPU. Called automatically at startup,
+ * it can also be called again with a lower isa to force a given backend (the
+ * request is clamped to what the CPU supports). Not thread safe. */
+SIMD_UTILS_API int simd_utils_dispatch_init(int isa)
+{
+    int cpu_isa = simd_utils_cpu_isa();
+    if ((isa <= 0) || (isa > cpu_isa))
+        isa = cpu_isa;
+    simd_utils_dispatch_set(&simd_dispatch, isa);
+    return isa;
+}
+
+SIMD_UTILS_API int simd_utils_dispatch_isa(void)
+{
+    return simd_dispatch.isa;
+}
+
+static void __attribute__((constructor)) simd_utils_dispatch_constructor(void)
+{
+    int isa = 0;
+    const char *env = getenv("SIMD_UTILS_ISA");
+    if (env != NULL) {
+        if (strcmp(env, "sse") == 0)
+            isa = SimdIsaSSE;
+        else if (strcmp(env, "avx2") == 0)
+            isa = SimdIsaAVX2;
+        else if (strcmp(env, "avx512") == 0)
+            isa = SimdIsaAVX512;
+    }
+    simd_utils_dispatch_init(isa);
+}
+
+SIMD_UTILS_API void setf_vec(float *dst, float value, int len)
+{
+    simd_dispatch.setf(dst, value, len);
+}
+
+SIMD_UTILS_API void zerof_vec(float *dst, int len)
+{
+    simd_dispatch.zerof(dst, len);
+}
+
+SIMD_UTILS_API void copyf_vec(float *src, float *dst, int len)
+{
+    simd_dispatch.copyf(src, dst, len);
+}
+
+SIMD_UTILS_API void addf_vec(float *src1, float *src2, float *dst, int len)
+{
+    simd_dispatch.addf(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void subf_vec(float *src1, float *src2, float *dst, int len)
+{
+    simd_dispatch.subf(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void mulf_vec(float *src1, float *src2, float *dst, int len)
+{
+    simd_dispatch.mulf(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void divf_vec(float *src1, float *src2, float *dst, int len)
+{
+    simd_dispatch.divf(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void addcf_vec(float *src, float value, float *dst, int len)
+{
+    simd_dispatch.addcf(src, value, dst, len);
+}
+
+SIMD_UTILS_API void mulcf_vec(float *src, float value, float *dst, int len)
+{
+    simd_dispatch.mulcf(src, value, dst, len);
+}
+
+SIMD_UTILS_API void muladdf_vec(float *_a, float *_b, float *_c, float *dst, int len)
+{
+    simd_dispatch.muladdf(_a, _b, _c, dst, len);
+}
+
+SIMD_UTILS_API void sqrtf_vec(float *src, float *dst, int len)
+{
+    simd_dispatch.sqrtf(src, dst, len);
+}
+
+SIMD_UTILS_API void fabsf_vec(float *src, float *dst, int len)
+{
+    simd_dispatch.fabsf(src, dst, len);
+}
+
+SIMD_UTILS_API void expf_vec(float *src, float *dst, int len)
+{
+    simd_dispatch.expf(src, dst, len);
+}
+
+SIMD_UTILS_API void lnf_vec(float *src, float *dst, int len)
+{
+    simd_dispatch.lnf(src, dst, len);
+}
+
+SIMD_UTILS_API void log10f_vec(float *src, float *dst, int len)
+{
+    simd_dispatch.log10f(src, dst, len);
+}
+
+SIMD_UTILS_API void log2f_vec(float *src, float *dst, int len)
+{
+    simd_dispatch.log2f(src, dst, len);
+}
+
+SIMD_UTILS_API void cbrtf_vec(float *src, float *dst, int len)
+{
+    simd_dispatch.cbrtf(src, dst, len);
+}
+
+SIMD_UTILS_API void sinf_vec(float *src, float *dst, int len)
+{
+    simd_dispatch.sinf(src, dst, len);
+}
+
+SIMD_UTILS_API void cosf_vec(float *src, float *dst, int len)
+{
+    simd_dispatch.cosf(src, dst, len);
+}
+
+SIMD_UTILS_API void sincosf_vec(float *src, float *dst_sin, float *dst_cos, int len)
+{
+    simd_dispatch.sincosf(src, dst_sin, dst_cos, len);
+}
+
+SIMD_UTILS_API void tanf_vec(float *src, float *dst, int len)
+{
+    simd_dispatch.tanf(src, dst, len);
+}
+
+SIMD_UTILS_API void tanhf_vec(float *src, float *dst, int len)
+{
+    simd_dispatch.tanhf(src, dst, len);
+}
+
+SIMD_UTILS_API void atanf_vec(float *src, float *dst, int len)
+{
+    simd_dispatch.atanf(src, dst, len);
+}
+
+SIMD_UTILS_API void atan2f_vec(float *src1, float *src2, float *dst, int len)
+{
+    simd_dispatch.atan2f(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void asinf_vec(float *src, float *dst, int len)
+{
+    simd_dispatch.asinf(src, dst, len);
+}
+
+SIMD_UTILS_API void sigmoidf_vec(float *src, float *dst, int len)
+{
+    simd_dispatch.sigmoidf(src, dst, len);
+}
+
+SIMD_UTILS_API void softmaxf_vec(float *src, float *dst, int len)
+{
+    simd_dispatch.softmaxf(src, dst, len);
+}
+
+SIMD_UTILS_API void sumf_vec(float *src, float *dst, int len)
+{
+    simd_dispatch.sumf(src, dst, len);
+}
+
+SIMD_UTILS_API void meanf_vec(float *src, float *dst, int len)
+{
+    simd_dispatch.meanf(src, dst, len);
+}
+
+SIMD_UTILS_API void dotf_vec(float *src1, float *src2, int len, float *dst)
+{
+    simd_dispatch.dotf(src1, src2, len, dst);
+}
+
+SIMD_UTILS_API void sumkahanf_vec(float *src, float *dst, int len)
+{
+    simd_dispatch.sumkahanf(src, dst, len);
+}
+
+SIMD_UTILS_API void meankahanf_vec(float *src, float *dst, int len)
+{
+    simd_dispatch.meankahanf(src, dst, len);
+}
+
+SIMD_UTILS_API void sumpairwisef_vec(float *src, float *dst, int len)
+{
+    simd_dispatch.sumpairwisef(src, dst, len);
+}
+
+SIMD_UTILS_API void meanpairwisef_vec(float *src, float *dst, int len)
+{
+    simd_dispatch.meanpairwisef(src, dst, len);
+}
+
+SIMD_UTILS_API void dotkahanf_vec(float *src1, float *src2, int len, float *dst)
+{
+    simd_dispatch.dotkahanf(src1, src2, len, dst);
+}
+
+SIMD_UTILS_API void dotpairwisef_vec(float *src1, float *src2, int len, float *dst)
+{
+    simd_dispatch.dotpairwisef(src1, src2, len, dst);
+}
+
+SIMD_UTILS_API void dotcf_vec(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst)
+{
+    simd_dispatch.dotcf(src1, src2, len, dst);
+}
+
+SIMD_UTILS_API void dotckahanf_vec(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst)
+{
+    simd_dispatch.dotckahanf(src1, src2, len, dst);
+}
+
+SIMD_UTILS_API void dotcpairwisef_vec(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst)
+{
+    simd_dispatch.dotcpairwisef(src1, src2, len, dst);
+}
+
+SIMD_UTILS_API void sumd_vec(double *src, double *dst, int len)
+{
+    simd_dispatch.sumd(src, dst, len);
+}
+
+SIMD_UTILS_API void meand_vec(double *src, double *dst, int len)
+{
+    simd_dispatch.meand(src, dst, len);
+}
+
+SIMD_UTILS_API void dotd_vec(double *src1, double *src2, int len, double *dst)
+{
+    simd_dispatch.dotd(src1, src2, len, dst);
+}
+
+SIMD_UTILS_API void dotcd_vec(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst)
+{
+    simd_dispatch.dotcd(src1, src2, len, dst);
+}
+
+SIMD_UTILS_API void sumkahand_vec(double *src, double *dst, int len)
+{
+    simd_dispatch.sumkahand(src, dst, len);
+}
+
+SIMD_UTILS_API void meankahand_vec(double *src, double *dst, int len)
+{
+    simd_dispatch.meankahand(src, dst, len);
+}
+
+SIMD_UTILS_API void sumpairwised_vec(double *src, double *dst, int len)
+{
+    simd_dispatch.sumpairwised(src, dst, len);
+}
+
+SIMD_UTILS_API void meanpairwised_vec(double *src, double *dst, int len)
+{
+    simd_dispatch.meanpairwised(src, dst, len);
+}
+
+SIMD_UTILS_API void dotkahand_vec(double *src1, double *src2, int len, double *dst)
+{
+    simd_dispatch.dotkahand(src1, src2, len, dst);
+}
+
+SIMD_UTILS_API void dotpairwised_vec(double *src1, double *src2, int len, double *dst)
+{
+    simd_dispatch.dotpairwised(src1, src2, len, dst);
+}
+
+SIMD_UTILS_API void dotckahand_vec(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst)
+{
+    simd_dispatch.dotckahand(src1, src2, len, dst);
+}
+
+SIMD_UTILS_API void dotcpairwised_vec(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst)
+{
+    simd_dispatch.dotcpairwised(src1, src2, len, dst);
+}
+
+SIMD_UTILS_API void momentsf_vec(float *src, int len, moments_t *m)
+{
+    simd_dispatch.momentsf(src, len, m);
+}
+
+SIMD_UTILS_API void momentsd_vec(double *src, int len, moments_t *m)
+{
+    simd_dispatch.momentsd(src, len, m);
+}
+
+SIMD_UTILS_API void histogramu8_vec(uint8_t *src, int len, uint32_t *hist)
+{
+    simd_dispatch.histogramu8(src, len, hist);
+}
+
+SIMD_UTILS_API void histogram16s_vec(int16_t *src, int len, int16_t low, int shift, int nb_bins, uint32_t *hist)
+{
+    simd_dispatch.histogram16s(src, len, low, shift, nb_bins, hist);
+}
+
+SIMD_UTILS_API void histograms_vec(int32_t *src, int len, int32_t low, int shift, int nb_bins, uint32_t *hist)
+{
+    simd_dispatch.histograms(src, len, low, shift, nb_bins, hist);
+}
+
+SIMD_UTILS_API void histogramf_vec(float *src, int len, float low, float high, int nb_bins, uint32_t *hist)
+{
+    simd_dispatch.histogramf(src, len, low, high, nb_bins, hist);
+}
+
+SIMD_UTILS_API void histogramf_edges_vec(float *src, int len, float *edges, int nb_bins, uint32_t *hist)
+{
+    simd_dispatch.histogramf_edges(src, len, edges, nb_bins, hist);
+}
+
+SIMD_UTILS_API void prefixsumf_vec(float *src, float *dst, int len, float *carry)
+{
+    simd_dispatch.prefixsumf(src, dst, len, carry);
+}
+
+SIMD_UTILS_API void prefixsumf_excl_vec(float *src, float *dst, int len, float *carry)
+{
+    simd_dispatch.prefixsumf_excl(src, dst, len, carry);
+}
+
+SIMD_UTILS_API void difff_vec(float *src, float *dst, int len, float *prev)
+{
+    simd_dispatch.difff(src, dst, len, prev);
+}
+
+SIMD_UTILS_API void prefixsumd_vec(double *src, double *dst, int len, double *carry)
+{
+    simd_dispatch.prefixsumd(src, dst, len, carry);
+}
+
+SIMD_UTILS_API void prefixsumd_excl_vec(double *src, double *dst, int len, double *carry)
+{
+    simd_dispatch.prefixsumd_excl(src, dst, len, carry);
+}
+
+SIMD_UTILS_API void diffd_vec(double *src, double *dst, int len, double *prev)
+{
+    simd_dispatch.diffd(src, dst, len, prev);
+}
+
+SIMD_UTILS_API void prefixsums_vec(int32_t *src, int32_t *dst, int len, int32_t *carry)
+{
+    simd_dispatch.prefixsums(src, dst, len, carry);
+}
+
+SIMD_UTILS_API void prefixsums_excl_vec(int32_t *src, int32_t *dst, int len, int32_t *carry)
+{
+    simd_dispatch.prefixsums_excl(src, dst, len, carry);
+}
+
+SIMD_UTILS_API void diffs_vec(int32_t *src, int32_t *dst, int len, int32_t *prev)
+{
+    simd_dispatch.diffs(src, dst, len, prev);
+}
+
+SIMD_UTILS_API void prefixsum16s_vec(int16_t *src, int16_t *dst, int len, int16_t *carry)
+{
+    simd_dispatch.prefixsum16s(src, dst, len, carry);
+}
+
+SIMD_UTILS_API void prefixsum16s_excl_vec(int16_t *src, int16_t *dst, int len, int16_t *carry)
+{
+    simd_dispatch.prefixsum16s_excl(src, dst, len, carry);
+}
+
+SIMD_UTILS_API void diff16s_vec(int16_t *src, int16_t *dst, int len, int16_t *prev)
+{
+    simd_dispatch.diff16s(src, dst, len, prev);
+}
+
+SIMD_UTILS_API void sortf_vec(float *src, int len)
+{
+    simd_dispatch.sortf(src, len);
+}
+
+SIMD_UTILS_API void sortd_vec(double *src, int len)
+{
+    simd_dispatch.sortd(src, len);
+}
+
+SIMD_UTILS_API void sorts_vec(int32_t *src, int len)
+{
+    simd_dispatch.sorts(src, len);
+}
+
+SIMD_UTILS_API void sortf_kv_vec(float *keys, int32_t *values, int len)
+{
+    simd_dispatch.sortf_kv(keys, values, len);
+}
+
+SIMD_UTILS_API void topkf_vec(float *src, int len, int k, float *dst, int32_t *idx)
+{
+    simd_dispatch.topkf(src, len, k, dst, idx);
+}
+
+SIMD_UTILS_API void bottomkf_vec(float *src, int len, int k, float *dst, int32_t *idx)
+{
+    simd_dispatch.bottomkf(src, len, k, dst, idx);
+}
+
+SIMD_UTILS_API void topks_vec(int32_t *src, int len, int k, int32_t *dst, int32_t *idx)
+{
+    simd_dispatch.topks(src, len, k, dst, idx);
+}
+
+SIMD_UTILS_API void bottomks_vec(int32_t *src, int len, int k, int32_t *dst, int32_t *idx)
+{
+    simd_dispatch.bottomks(src, len, k, dst, idx);
+}
+
+SIMD_UTILS_API void partialsortf_vec(float *src, int len, int k)
+{
+    simd_dispatch.partialsortf(src, len, k);
+}
+
+SIMD_UTILS_API void partialsorts_vec(int32_t *src, int len, int k)
+{
+    simd_dispatch.partialsorts(src, len, k);
+}
+
+SIMD_UTILS_API void minmaxf_vec(float *src, int len, float *min_value, float *max_value)
+{
+    simd_dispatch.minmaxf(src, len, min_value, max_value);
+}
+
+SIMD_UTILS_API void maxlocf_vec(float *src, float *max, int *idx, int len)
+{
+    simd_dispatch.maxlocf(src, max, idx, len);
+}
+
+SIMD_UTILS_API void minlocf_vec(float *src, float *min, int *idx, int len)
+{
+    simd_dispatch.minlocf(src, min, idx, len);
+}
+
+SIMD_UTILS_API void minmaxlocf_vec(float *src, int len, float *min_value, int *min_idx, float *max_value, int *max_idx)
+{
+    simd_dispatch.minmaxlocf(src, len, min_value, min_idx, max_value, max_idx);
+}
+
+SIMD_UTILS_API void minmaxd_vec(double *src, int len, double *min_value, double *max_value)
+{
+    simd_dispatch.minmaxd(src, len, min_value, max_value);
+}
+
+SIMD_UTILS_API void maxlocd_vec(double *src, double *max, int *idx, int len)
+{
+    simd_dispatch.maxlocd(src, max, idx, len);
+}
+
+SIMD_UTILS_API void minlocd_vec(double *src, double *min, int *idx, int len)
+{
+    simd_dispatch.minlocd(src, min, idx, len);
+}
+
+SIMD_UTILS_API void minmaxlocd_vec(double *src, int len, double *min_value, int *min_idx, double *max_value, int *max_idx)
+{
+    simd_dispatch.minmaxlocd(src, len, min_value, min_idx, max_value, max_idx);
+}
+
+SIMD_UTILS_API void maxeveryd_vec(double *src1, double *src2, double *dst, int len)
+{
+    simd_dispatch.maxeveryd(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void mineveryd_vec(double *src1, double *src2, double *dst, int len)
+{
+    simd_dispatch.mineveryd(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void threshold_gt_d_vec(double *src, double *dst, int len, double value)
+{
+    simd_dispatch.threshold_gt_d(src, dst, len, value);
+}
+
+SIMD_UTILS_API void threshold_lt_d_vec(double *src, double *dst, int len, double value)
+{
+    simd_dispatch.threshold_lt_d(src, dst, len, value);
+}
+
+SIMD_UTILS_API void maxlocs_vec(int32_t *src, int32_t *max, int *idx, int len)
+{
+    simd_dispatch.maxlocs(src, max, idx, len);
+}
+
+SIMD_UTILS_API void minlocs_vec(int32_t *src, int32_t *min, int *idx, int len)
+{
+    simd_dispatch.minlocs(src, min, idx, len);
+}
+
+SIMD_UTILS_API void minmaxlocs_vec(int32_t *src, int len, int32_t *min_value, int *min_idx, int32_t *max_value, int *max_idx)
+{
+    simd_dispatch.minmaxlocs(src, len, min_value, min_idx, max_value, max_idx);
+}
+
+SIMD_UTILS_API void minmax16s_vec(int16_t *src, int len, int16_t *min_value, int16_t *max_value)
+{
+    simd_dispatch.minmax16s(src, len, min_value, max_value);
+}
+
+SIMD_UTILS_API void maxloc16s_vec(int16_t *src, int16_t *max, int *idx, int len)
+{
+    simd_dispatch.maxloc16s(src, max, idx, len);
+}
+
+SIMD_UTILS_API void minloc16s_vec(int16_t *src, int16_t *min, int *idx, int len)
+{
+    simd_dispatch.minloc16s(src, min, idx, len);
+}
+
+SIMD_UTILS_API void minmaxloc16s_vec(int16_t *src, int len, int16_t *min_value, int *min_idx, int16_t *max_value, int *max_idx)
+{
+    simd_dispatch.minmaxloc16s(src, len, min_value, min_idx, max_value, max_idx);
+}
+
+SIMD_UTILS_API void addsat16s_vec(int16_t *src1, int16_t *src2, int16_t *dst, int len)
+{
+    simd_dispatch.addsat16s(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void subsat16s_vec(int16_t *src1, int16_t *src2, int16_t *dst, int len)
+{
+    simd_dispatch.subsat16s(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void mulhi16s_vec(int16_t *src1, int16_t *src2, int16_t *dst, int len)
+{
+    simd_dispatch.mulhi16s(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void mulhrs16s_vec(int16_t *src1, int16_t *src2, int16_t *dst, int len)
+{
+    simd_dispatch.mulhrs16s(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void maxevery16s_vec(int16_t *src1, int16_t *src2, int16_t *dst, int len)
+{
+    simd_dispatch.maxevery16s(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void minevery16s_vec(int16_t *src1, int16_t *src2, int16_t *dst, int len)
+{
+    simd_dispatch.minevery16s(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void abs16s_vec(int16_t *src, int16_t *dst, int len)
+{
+    simd_dispatch.abs16s(src, dst, len);
+}
+
+SIMD_UTILS_API void threshold_gt16s_vec(int16_t *src, int16_t *dst, int len, int16_t value)
+{
+    simd_dispatch.threshold_gt16s(src, dst, len, value);
+}
+
+SIMD_UTILS_API void threshold_lt16s_vec(int16_t *src, int16_t *dst, int len, int16_t value)
+{
+    simd_dispatch.threshold_lt16s(src, dst, len, value);
+}
+
+SIMD_UTILS_API void addsatu8_vec(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len)
+{
+    simd_dispatch.addsatu8(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void subsatu8_vec(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len)
+{
+    simd_dispatch.subsatu8(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void absdiffu8_vec(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len)
+{
+    simd_dispatch.absdiffu8(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void maxeveryu8_vec(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len)
+{
+    simd_dispatch.maxeveryu8(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void mineveryu8_vec(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len)
+{
+    simd_dispatch.mineveryu8(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void threshold_gtu8_vec(uint8_t *src, uint8_t *dst, int len, uint8_t value)
+{
+    simd_dispatch.threshold_gtu8(src, dst, len, value);
+}
+
+SIMD_UTILS_API void threshold_ltu8_vec(uint8_t *src, uint8_t *dst, int len, uint8_t value)
+{
+    simd_dispatch.threshold_ltu8(src, dst, len, value);
+}
+
+SIMD_UTILS_API void convertInt16ToU8_vec(int16_t *src, uint8_t *dst, int len, int scale_factor)
+{
+    simd_dispatch.convertInt16ToU8(src, dst, len, scale_factor);
+}
+
+SIMD_UTILS_API void convertU8ToInt16_vec(uint8_t *src, int16_t *dst, int len, int scale_factor)
+{
+    simd_dispatch.convertU8ToInt16(src, dst, len, scale_factor);
+}
+
+SIMD_UTILS_API void add64s_vec(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+    simd_dispatch.add64s(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void sub64s_vec(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+    simd_dispatch.sub64s(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void mul64s_vec(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+    simd_dispatch.mul64s(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void sum64s_vec(int64_t *src, int64_t *dst, int len)
+{
+    simd_dispatch.sum64s(src, dst, len);
+}
+
+SIMD_UTILS_API void maxevery64s_vec(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+    simd_dispatch.maxevery64s(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void minevery64s_vec(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+    simd_dispatch.minevery64s(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void maxeveryu64_vec(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len)
+{
+    simd_dispatch.maxeveryu64(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void mineveryu64_vec(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len)
+{
+    simd_dispatch.mineveryu64(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void minmax64s_vec(int64_t *src, int len, int64_t *min_value, int64_t *max_value)
+{
+    simd_dispatch.minmax64s(src, len, min_value, max_value);
+}
+
+SIMD_UTILS_API void minmaxu64_vec(uint64_t *src, int len, uint64_t *min_value, uint64_t *max_value)
+{
+    simd_dispatch.minmaxu64(src, len, min_value, max_value);
+}
+
+SIMD_UTILS_API void cmpeq64s_vec(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+    simd_dispatch.cmpeq64s(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void cmpgt64s_vec(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+    simd_dispatch.cmpgt64s(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void cmpgtu64_vec(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len)
+{
+    simd_dispatch.cmpgtu64(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void sll64s_vec(int64_t *src, int64_t *dst, int len, int shift)
+{
+    simd_dispatch.sll64s(src, dst, len, shift);
+}
+
+SIMD_UTILS_API void sra64s_vec(int64_t *src, int64_t *dst, int len, int shift)
+{
+    simd_dispatch.sra64s(src, dst, len, shift);
+}
+
+SIMD_UTILS_API void srlu64_vec(uint64_t *src, uint64_t *dst, int len, int shift)
+{
+    simd_dispatch.srlu64(src, dst, len, shift);
+}
+
+SIMD_UTILS_API void maxeveryf_vec(float *src1, float *src2, float *dst, int len)
+{
+    simd_dispatch.maxeveryf(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void mineveryf_vec(float *src1, float *src2, float *dst, int len)
+{
+    simd_dispatch.mineveryf(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void threshold_gt_f_vec(float *src, float *dst, int len, float value)
+{
+    simd_dispatch.threshold_gt_f(src, dst, len, value);
+}
+
+SIMD_UTILS_API void threshold_lt_f_vec(float *src, float *dst, int len, float value)
+{
+    simd_dispatch.threshold_lt_f(src, dst, len, value);
+}
+
+SIMD_UTILS_API void cplxvecmulf_vec(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
+{
+    simd_dispatch.cplxvecmulf(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void magnitudef_split_vec(float *srcRe, float *srcIm, float *dst, int len)
+{
+    simd_dispatch.magnitudef_split(srcRe, srcIm, dst, len);
+}
+
+SIMD_UTILS_API void powerspectf_split_vec(float *srcRe, float *srcIm, float *dst, int len)
+{
+    simd_dispatch.powerspectf_split(srcRe, srcIm, dst, len);
+}
+
+SIMD_UTILS_API void pipelinef_vec(float *src, float *dst, int len, const pipeline_op_t *ops, int nb_ops)
+{
+    simd_dispatch.pipelinef(src, dst, len, ops, nb_ops);
+}
+
+SIMD_UTILS_API void pipelinef_sum_vec(float *src, float *dst, int len, const pipeline_op_t *ops, int nb_ops)
+{
+    simd_dispatch.pipelinef_sum(src, dst, len, ops, nb_ops);
+}
+
+SIMD_UTILS_API void fftf_vec(fft_plan32_t *plan, complex32_t *src, complex32_t *dst)
+{
+    simd_dispatch.fftf(plan, src, dst);
+}
+
+SIMD_UTILS_API void ifftf_vec(fft_plan32_t *plan, complex32_t *src, complex32_t *dst)
+{
+    simd_dispatch.ifftf(plan, src, dst);
+}
+
+SIMD_UTILS_API void fftf_split_vec(fft_plan32_t *plan, float *srcRe, float *srcIm, float *dstRe, float *dstIm)
+{
+    simd_dispatch.fftf_split(plan, srcRe, srcIm, dstRe, dstIm);
+}
+
+SIMD_UTILS_API void ifftf_split_vec(fft_plan32_t *plan, float *srcRe, float *srcIm, float *dstRe, float *dstIm)
+{
+    simd_dispatch.ifftf_split(plan, srcRe, srcIm, dstRe, dstIm);
+}
+
+SIMD_UTILS_API void rfftf_vec(fft_plan32_t *plan, float *src, complex32_t *dst)
+{
+    simd_dispatch.rfftf(plan, src, dst);
+}
+
+SIMD_UTILS_API void irfftf_vec(fft_plan32_t *plan, complex32_t *src, float *dst)
+{
+    simd_dispatch.irfftf(plan, src, dst);
+}
+
+SIMD_UTILS_API int firf_vec(fir32_t *fir, float *src, float *dst, int len)
+{
+    return simd_dispatch.firf(fir, src, dst, len);
+}
+
+SIMD_UTILS_API int firf_cplx_vec(fir32_t *fir, complex32_t *src, complex32_t *dst, int len)
+{
+    return simd_dispatch.firf_cplx(fir, src, dst, len);
+}
+
+SIMD_UTILS_API int firf_split_vec(fir32_t *fir, float *srcRe, float *srcIm, float *dstRe, float *dstIm, int len)
+{
+    return simd_dispatch.firf_split(fir, srcRe, srcIm, dstRe, dstIm, len);
+}
+
+SIMD_UTILS_API void iirf_vec(iir32_t *iir, float *src, float *dst, int len)
+{
+    simd_dispatch.iirf(iir, src, dst, len);
+}
+
+SIMD_UTILS_API int convf_vec(conv32_t *conv, float *src, float *dst, int len)
+{
+    return simd_dispatch.convf(conv, src, dst, len);
+}
+
+SIMD_UTILS_API int convf_cplx_vec(conv32_t *conv, complex32_t *src, complex32_t *dst, int len)
+{
+    return simd_dispatch.convf_cplx(conv, src, dst, len);
+}
+
+SIMD_UTILS_API void setd_vec(double *dst, double value, int len)
+{
+    simd_dispatch.setd(dst, value, len);
+}
+
+SIMD_UTILS_API void copyd_vec(double *src, double *dst, int len)
+{
+    simd_dispatch.copyd(src, dst, len);
+}
+
+SIMD_UTILS_API void addd_vec(double *src1, double *src2, double *dst, int len)
+{
+    simd_dispatch.addd(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void subd_vec(double *src1, double *src2, double *dst, int len)
+{
+    simd_dispatch.subd(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void muld_vec(double *src1, double *src2, double *dst, int len)
+{
+    simd_dispatch.muld(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void divd_vec(double *src1, double *src2, double *dst, int len)
+{
+    simd_dispatch.divd(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void sqrtd_vec(double *src, double *dst, int len)
+{
+    simd_dispatch.sqrtd(src, dst, len);
+}
+
+SIMD_UTILS_API void fabsd_vec(double *src, double *dst, int len)
+{
+    simd_dispatch.fabsd(src, dst, len);
+}
+
+SIMD_UTILS_API void expd_vec(double *src, double *dst, int len)
+{
+    simd_dispatch.expd(src, dst, len);
+}
+
+SIMD_UTILS_API void lnd_vec(double *src, double *dst, int len)
+{
+    simd_dispatch.lnd(src, dst, len);
+}
+
+SIMD_UTILS_API void log2d_vec(double *src, double *dst, int len)
+{
+    simd_dispatch.log2d(src, dst, len);
+}
+
+SIMD_UTILS_API void log10d_vec(double *src, double *dst, int len)
+{
+    simd_dispatch.log10d(src, dst, len);
+}
+
+SIMD_UTILS_API void sinhd_vec(double *src, double *dst, int len)
+{
+    simd_dispatch.sinhd(src, dst, len);
+}
+
+SIMD_UTILS_API void coshd_vec(double *src, double *dst, int len)
+{
+    simd_dispatch.coshd(src, dst, len);
+}
+
+SIMD_UTILS_API void tanhd_vec(double *src, double *dst, int len)
+{
+    simd_dispatch.tanhd(src, dst, len);
+}
+
+SIMD_UTILS_API void asinhd_vec(double *src, double *dst, int len)
+{
+    simd_dispatch.asinhd(src, dst, len);
+}
+
+SIMD_UTILS_API void acoshd_vec(double *src, double *dst, int len)
+{
+    simd_dispatch.acoshd(src, dst, len);
+}
+
+SIMD_UTILS_API void atanhd_vec(double *src, double *dst, int len)
+{
+    simd_dispatch.atanhd(src, dst, len);
+}
+
+SIMD_UTILS_API void cbrtd_vec(double *src, double *dst, int len)
+{
+    simd_dispatch.cbrtd(src, dst, len);
+}
+
+SIMD_UTILS_API void acosd_vec(double *src, double *dst, int len)
+{
+    simd_dispatch.acosd(src, dst, len);
+}
+
+SIMD_UTILS_API void sigmoidd_vec(double *src, double *dst, int len)
+{
+    simd_dispatch.sigmoidd(src, dst, len);
+}
+
+SIMD_UTILS_API void softmaxd_vec(double *src, double *dst, int len)
+{
+    simd_dispatch.softmaxd(src, dst, len);
+}
+
+SIMD_UTILS_API void sincosd_vec(double *src, double *dst_sin, double *dst_cos, int len)
+{
+    simd_dispatch.sincosd(src, dst_sin, dst_cos, len);
+}
+
+SIMD_UTILS_API void atand_vec(double *src, double *dst, int len)
+{
+    simd_dispatch.atand(src, dst, len);
+}
+
+SIMD_UTILS_API void asind_vec(double *src, double *dst, int len)
+{
+    simd_dispatch.asind(src, dst, len);
+}
+
+SIMD_UTILS_API void fftd_vec(fft_plan64_t *plan, complex64_t *src, complex64_t *dst)
+{
+    simd_dispatch.fftd(plan, src, dst);
+}
+
+SIMD_UTILS_API void ifftd_vec(fft_plan64_t *plan, complex64_t *src, complex64_t *dst)
+{
+    simd_dispatch.ifftd(plan, src, dst);
+}
+
+SIMD_UTILS_API void fftd_split_vec(fft_plan64_t *plan, double *srcRe, double *srcIm, double *dstRe, double *dstIm)
+{
+    simd_dispatch.fftd_split(plan, srcRe, srcIm, dstRe, dstIm);
+}
+
+SIMD_UTILS_API void ifftd_split_vec(fft_plan64_t *plan, double *srcRe, double *srcIm, double *dstRe, double *dstIm)
+{
+    simd_dispatch.ifftd_split(plan, srcRe, srcIm, dstRe, dstIm);
+}
+
+SIMD_UTILS_API void rfftd_vec(fft_plan64_t *plan, double *src, complex64_t *dst)
+{
+    simd_dispatch.rfftd(plan, src, dst);
+}
+
+SIMD_UTILS_API void irfftd_vec(fft_plan64_t *plan, complex64_t *src, double *dst)
+{
+    simd_dispatch.irfftd(plan, src, dst);
+}
+
+SIMD_UTILS_API void cplxvecmuld_vec(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len)
+{
+    simd_dispatch.cplxvecmuld(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void cplxconjvecmuld_vec(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len)
+{
+    simd_dispatch.cplxconjvecmuld(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void cplxvecdivd_vec(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len)
+{
+    simd_dispatch.cplxvecdivd(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void cplxconjd_vec(complex64_t *src, complex64_t *dst, int len)
+{
+    simd_dispatch.cplxconjd(src, dst, len);
+}
+
+SIMD_UTILS_API void magnituded_split_vec(double *srcRe, double *srcIm, double *dst, int len)
+{
+    simd_dispatch.magnituded_split(srcRe, srcIm, dst, len);
+}
+
+SIMD_UTILS_API void magnituded_interleaved_vec(complex64_t *src, double *dst, int len)
+{
+    simd_dispatch.magnituded_interleaved(src, dst, len);
+}
+
+SIMD_UTILS_API void powerspectd_split_vec(double *srcRe, double *srcIm, double *dst, int len)
+{
+    simd_dispatch.powerspectd_split(srcRe, srcIm, dst, len);
+}
+
+SIMD_UTILS_API void powerspectd_interleaved_vec(complex64_t *src, double *dst, int len)
+{
+    simd_dispatch.powerspectd_interleaved(src, dst, len);
+}
+
+SIMD_UTILS_API int convd_vec(conv64_t *conv, double *src, double *dst, int len)
+{
+    return simd_dispatch.convd(conv, src, dst, len);
+}
+
+SIMD_UTILS_API void adds_vec(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+{
+    simd_dispatch.adds(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void subs_vec(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+{
+    simd_dispatch.subs(src1, src2, dst, len);
+}
+
+SIMD_UTILS_API void muls_vec(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+{
+    simd_dispatch.muls(src1, src2, dst, len);
+}
@@ -0,0 +1,467 @@
+/*
+ * Project : SIMD_Utils
+ * Version : 0.2.6
+ * Author  : JishinMaster
+ * Licence : BSD-2
+ */
+
+#pragma once
+
+/* FFT plans and the scalar parts of the transforms.
+ *
+ * The complex transform of n = 2^k points is a Stockham (autosort) FFT on split
+ * real/imaginary buffers : radix-4 stages of stride s = 1, 4, 16, ... then a radix-2
+ * stage when k is odd. Stage j reads x[q + s*p + r*n/4] and writes
+ * y[q + s*(4p + r)] = w^(r*p) * Y_r, so every load is contiguous whatever the stride,
+ * and no bit reversal pass is needed. The stages ping-pong between two work buffers
+ * of the plan, the input is only read by the first stage : src and dst can alias.
+ *
+ * The forward transform computes X[k] = sum x[i] exp(-2*pi*j*i*k/n), the inverse
+ * sum X[k] exp(2*pi*j*i*k/n) : like FFTW, none of them is normalized.
+ * The inverse transform is the forward one with the real and imaginary parts swapped
+ * on the input and on the output.
+ *
+ * The real transform of 2n points runs the complex transform of n points on
+ * z[i] = x[2i] + j*x[2i+1], then recombines the n + 1 first bins (the others are
+ * their conjugates) with the twiddles W_(2n)^k.
+ *
+ * A plan holds the work buffers of its transforms : use one plan per thread.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// alignment of the arrays of a plan, enough for AVX512
+#define FFT_PLAN_ALIGN 64
+
+static inline int fft_log2(int n)
+{
+    int log2n = 0;
+    if (n < 1 || n > (1 << 30))
+        return -1;
+    while ((1 << log2n) < n)
+        log2n++;
+    return ((1 << log2n) == n) ? log2n : -1;
+}
+
+// number of floats (or doubles) of the compact twiddle table of a n points plan
+static inline size_t fft_tw_len(int n, int log2n)
+{
+    size_t len = 0;
+    for (int j = 0; j < log2n / 2; j++)
+        len += 6 * (size_t) (n >> (2 * j + 2));
+    return len;
+}
+
+static inline size_t fft_twx_len(int n, int log2n)
+{
+    int nb_expanded = (log2n / 2 < 2) ? log2n / 2 : 2;
+    return (size_t) nb_expanded * 6 * (size_t) (n / 4);
+}
+
+static inline size_t fft_align_up(size_t offset)
+{
+    return (offset + FFT_PLAN_ALIGN - 1) & ~((size_t) (FFT_PLAN_ALIGN - 1));
+}
+
+/* The plan and its arrays are a single allocation, released with free.
+ * offsets[] are the offsets of work, tw, twx and rtw from the start of the block. */
+static inline void *fft_plan_alloc(int n, int log2n, int real, size_t elt_size, size_t struct_size, size_t offsets[4])
+{
+    size_t sizes[4] = {6 * (size_t) n, fft_tw_len(n, log2n), fft_twx_len(n, log2n), real ? 2 * (size_t) n : 0};
+    size_t total = struct_size + FFT_PLAN_ALIGN;
+    for (int i = 0; i < 4; i++)
+        total += fft_align_up(sizes[i] * elt_size);
+
+    char *p = (char *) malloc(total);
+    if (!p)
+        return NULL;
+    size_t offset = (size_t) ((char *) fft_align_up((uintptr_t) p + struct_size) - p);
+    for (int i = 0; i < 4; i++) {
+        offsets[i] = offset;
+        offset += fft_align_up(sizes[i] * elt_size);
+    }
+    return (void *) p;
+}
+
+static inline void fft_twiddle(int r, int p, int ncur, double *re, double *im)
+{
+    double angle = -2.0 * M_PI * (double) ((long long) r * p) / (double) ncur;
+    *re = cos(angle);
+    *im = sin(angle);
+}
+
+#define FFT_PLAN_FILL(plan, elt_t)                                                    \
+    do {                                                                              \
+        int n_ = (plan)->n;                                                           \
+        int n4_ = n_ / 4;                                                             \
+        elt_t *tw_ = (plan)->tw;                                                      \
+        for (int j = 0; j < (plan)->log2n / 2; j++) {                                 \
+            int ncur = n_ >> (2 * j);                                                 \
+            int m = ncur / 4;                                                         \
+            for (int p = 0; p < m; p++) {                                             \
+                for (int r = 1; r < 4; r++) {                                         \
+                    double re, im;                                                    \
+                    fft_twiddle(r, p, ncur, &re, &im);                                \
+                    tw_[6 * p + 2 * (r - 1)] = (elt_t) re;                            \
+                    tw_[6 * p + 2 * (r - 1) + 1] = (elt_t) im;                        \
+                }                                                                     \
+            }                                                                         \
+            if (j < 2) {                                                              \
+                elt_t *twx_ = (plan)->twx + (size_t) j * 6 * n4_;                     \
+                for (int idx = 0; idx < n4_; idx++) {                                 \
+                    int p = idx >> (2 * j);                                           \
+                    for (int r = 1; r < 4; r++) {                                     \
+                        twx_[(2 * (r - 1)) * n4_ + idx] = tw_[6 * p + 2 * (r - 1)];   \
+                        twx_[(2 * (r - 1) + 1) * n4_ + idx] =                         \
+                            tw_[6 * p + 2 * (r - 1) + 1];                             \
+                    }                                                                 \
+                }                                                                     \
+            }                                                                         \
+            tw_ += 6 * m;                                                             \
+        }                                                                             \
+        if ((plan)->real_n) {                                                         \
+            for (int k = 0; k < n_; k++) {                                            \
+                double re, im;                                                        \
+                fft_twiddle(1, k, 2 * n_, &re, &im);                                  \
+                (plan)->rtw[k] = (elt_t) re;                                          \
+                (plan)->rtw[n_ + k] = (elt_t) im;                                     \
+            }                                                                         \
+        }                                                                             \
+    } while (0)
+
+static inline fft_plan32_t *fft_plan32_create_(int n, int real)
+{
+    int log2n = fft_log2(n);
+    if (log2n < 0)
+        return NULL;
+    size_t offsets[4];
+    char *p0 = (char *) fft_plan_alloc(n, log2n, real, sizeof(float), sizeof(fft_plan32_t), offsets);
+    if (!p0)
+        return NULL;
+    fft_plan32_t *plan = (fft_plan32_t *) p0;
+    plan->n = n;
+    plan->real_n = real ? 2 * n : 0;
+    plan->log2n = log2n;
+    plan->work = (float *) (p0 + offsets[0]);
+    plan->tw = (float *) (p0 + offsets[1]);
+    plan->twx = (float *) (p0 + offsets[2]);
+    plan->rtw = real ? (float *) (p0 + offsets[3]) : NULL;
+    FFT_PLAN_FILL(plan, float);
+    return plan;
+}
+
+static inline fft_plan64_t *fft_plan64_create_(int n, int real)
+{
+    int log2n = fft_log2(n);
+    if (log2n < 0)
+        return NULL;
+    size_t offsets[4];
+    char *p0 = (char *) fft_plan_alloc(n, log2n, real, sizeof(double), sizeof(fft_plan64_t), offsets);
+    if (!p0)
+        return NULL;
+    fft_plan64_t *plan = (fft_plan64_t *) p0;
+    plan->n = n;
+    plan->real_n = real ? 2 * n : 0;
+    plan->log2n = log2n;
+    plan->work = (double *) (p0 + offsets[0]);
+    plan->tw = (double *) (p0 + offsets[1]);
+    plan->twx = (double *) (p0 + offsets[2]);
+    plan->rtw = real ? (double *) (p0 + offsets[3]) : NULL;
+    FFT_PLAN_FILL(plan, double);
+    return plan;
+}
+
+// complex plan of n points (power of 2), NULL if n is not supported
+SIMD_UTILS_API fft_plan32_t *fft_plan32_create(int n)
+{
+    return fft_plan32_create_(n, 0);
+}
+
+// real plan of n points (power of 2, at least 2), used by rfftXf/irfftXf, NULL for other sizes
+SIMD_UTILS_API fft_plan32_t *rfft_plan32_create(int n)
+{
+    if (n < 2 || (n & (n - 1)) != 0)
+        return NULL;
+    return fft_plan32_create_(n / 2, 1);
+}
+
+SIMD_UTILS_API void fft_plan32_destroy(fft_plan32_t *plan)
+{
+    free(plan);
+}
+
+SIMD_UTILS_API fft_plan64_t *fft_plan64_create(int n)
+{
+    return fft_plan64_create_(n, 0);
+}
+
+SIMD_UTILS_API fft_plan64_t *rfft_plan64_create(int n)
+{
+    if (n < 2 || (n & (n - 1)) != 0)
+        return NULL;
+    return fft_plan64_create_(n / 2, 1);
+}
+
+SIMD_UTILS_API void fft_plan64_destroy(fft_plan64_t *plan)
+{
+    free(plan);
+}
+
+// twiddles of the radix-4 stage of stride s, s = 4^j
+static inline const float *fft_stage_twf(const fft_plan32_t *plan, int s)
+{
+    const float *tw = plan->tw;
+    for (int s_ = 1; s_ < s; s_ *= 4)
+        tw += 6 * (plan->n / (4 * s_));
+    return tw;
+}
+
+static inline const double *fft_stage_twd(const fft_plan64_t *plan, int s)
+{
+    const double *tw = plan->tw;
+    for (int s_ = 1; s_ < s; s_ *= 4)
+        tw += 6 * (plan->n / (4 * s_));
+    return tw;
+}
+
+static inline void fft_radix4_stagef_C(const float *tw, int n, int s, const float *xr, const float *xi, float *yr, float *yi)
+{
+    int n4 = n / 4;
+    int m = n4 / s;
+    for (int p = 0; p < m; p++) {
+        float w1r = tw[6 * p], w1i = tw[6 * p + 1];
+        float w2r = tw[6 * p + 2], w2i = tw[6 * p + 3];
+        float w3r = tw[6 * p + 4], w3i = tw[6 * p + 5];
+        for (int q = 0; q < s; q++) {
+            int idx = q + s * p;
+            int out = q + 4 * s * p;
+            float apcr = xr[idx] + xr[idx + 2 * n4], apci = xi[idx] + xi[idx + 2 * n4];
+            float amcr = xr[idx] - xr[idx + 2 * n4], amci = xi[idx] - xi[idx + 2 * n4];
+            float bpdr = xr[idx + n4] + xr[idx + 3 * n4], bpdi = xi[idx + n4] + xi[idx + 3 * n4];
+            // -j * (b - d)
+            float jbmdr = xi[idx + n4] - xi[idx + 3 * n4], jbmdi = xr[idx + 3 * n4] - xr[idx + n4];
+            float t1r = amcr + jbmdr, t1i = amci + jbmdi;
+            float t2r = apcr - bpdr, t2i = apci - bpdi;
+            float t3r = amcr - jbmdr, t3i = amci - jbmdi;
+            yr[out] = apcr + bpdr;
+            yi[out] = apci + bpdi;
+            yr[out + s] = t1r * w1r - t1i * w1i;
+            yi[out + s] = t1r * w1i + t1i * w1r;
+            yr[out + 2 * s] = t2r * w2r - t2i * w2i;
+            yi[out + 2 * s] = t2r * w2i + t2i * w2r;
+            yr[out + 3 * s] = t3r * w3r - t3i * w3i;
+            yi[out + 3 * s] = t3r * w3i + t3i * w3r;
+        }
+    }
+}
+
+static inline void fft_radix4_staged_C(const double *tw, int n, int s, const double *xr, const double *xi, double *yr, double *yi)
+{
+    int n4 = n / 4;
+    int m = n4 / s;
+    for (int p = 0; p < m; p++) {
+        double w1r = tw[6 * p], w1i = tw[6 * p + 1];
+        double w2r = tw[6 * p + 2], w2i = tw[6 * p + 3];
+        double w3r = tw[6 * p + 4], w3i = tw[6 * p + 5];
+        for (int q = 0; q < s; q++) {
+            int idx = q + s * p;
+            int out = q + 4 * s * p;
+            double apcr = xr[idx] + xr[idx + 2 * n4], apci = xi[idx] + xi[idx + 2 * n4];
+            double amcr = xr[idx] - xr[idx + 2 * n4], amci = xi[idx] - xi[idx + 2 * n4];
+            double bpdr = xr[idx + n4] + xr[idx + 3 * n4], bpdi = xi[idx + n4] + xi[idx + 3 * n4];
+            double jbmdr = xi[idx + n4] - xi[idx + 3 * n4], jbmdi = xr[idx + 3 * n4] - xr[idx + n4];
+            double t1r = amcr + jbmdr, t1i = amci + jbmdi;
+            double t2r = apcr - bpdr, t2i = apci - bpdi;
+            double t3r = amcr - jbmdr, t3i = amci - jbmdi;
+            yr[out] = apcr + bpdr;
+            yi[out] = apci + bpdi;
+            yr[out + s] = t1r * w1r - t1i * w1i;
+            yi[out + s] = t1r * w1i + t1i * w1r;
+            yr[out + 2 * s] = t2r * w2r - t2i * w2i;
+            yi[out + 2 * s] = t2r * w2i + t2i * w2r;
+            yr[out + 3 * s] = t3r * w3r - t3i * w3i;
+            yi[out + 3 * s] = t3r * w3i + t3i * w3r;
+        }
+    }
+}
+
+// last stage when log2(n) is odd, stride n/2 and no twiddles
+static inline void fft_radix2_stagef_C(int n, const float *xr, const float *xi, float *yr, float *yi, int start)
+{
+    int n2 = n / 2;
+    for (int q = start; q < n2; q++) {
+        float ar = xr[q], ai = xi[q];
+        float br = xr[q + n2], bi = xi[q + n2];
+        yr[q] = ar + br;
+        yi[q] = ai + bi;
+        yr[q + n2] = ar - br;
+        yi[q + n2] = ai - bi;
+    }
+}
+
+static inline void fft_radix2_staged_C(int n, const double *xr, const double *xi, double *yr, double *yi, int start)
+{
+    int n2 = n / 2;
+    for (int q = start; q < n2; q++) {
+        double ar = xr[q], ai = xi[q];
+        double br = xr[q + n2], bi = xi[q + n2];
+        yr[q] = ar + br;
+        yi[q] = ai + bi;
+        yr[q + n2] = ar - br;
+        yi[q + n2] = ai - bi;
+    }
+}
+
+/* Output buffer of the stage "stage" among "nb_stages" : the last one writes to dst,
+ * the others alternate between the two work buffers (re at 0 and n, im at n apart). */
+static inline float *fft_stage_outf(const fft_plan32_t *plan, int stage, int nb_stages, float *dstRe)
+{
+    if (stage == nb_stages - 1)
+        return dstRe;
+    return plan->work + (stage & 1) * 2 * plan->n;
+}
+
+static inline double *fft_stage_outd(const fft_plan64_t *plan, int stage, int nb_stages, double *dstRe)
+{
+    if (stage == nb_stages - 1)
+        return dstRe;
+    return plan->work + (stage & 1) * 2 * plan->n;
+}
+
+/* Plain C transform, used by the C reference and by the backends
+ * for the sizes smaller than their vector length. */
+static inline void fft_split_coref_C(const fft_plan32_t *plan, float *srcRe, float *srcIm, float *dstRe, float *dstIm)
+{
+    int n = plan->n;
+    int nb_stages = plan->log2n / 2 + (plan->log2n & 1);
+    if (nb_stages == 0) {
+        dstRe[0] = srcRe[0];
+        dstIm[0] = srcIm[0];
+        return;
+    }
+    float *xr = srcRe, *xi = srcIm;
+    float *wr = plan->work, *wi = plan->work + n;
+    int s = 1;
+    for (int stage = 0; stage < nb_stages; stage++) {
+        // a single stage goes through a work buffer, src and dst may alias
+        float *yr = (nb_stages == 1) ? wr : fft_stage_outf(plan, stage, nb_stages, dstRe);
+        float *yi = (nb_stages == 1) ? wi : ((yr == dstRe) ? dstIm : yr + n);
+        if (s < n / 2 || !(plan->log2n & 1)) {
+            fft_radix4_stagef_C(fft_stage_twf(plan, s), n, s, xr, xi, yr, yi);
+            s *= 4;
+        } else {
+            fft_radix2_stagef_C(n, xr, xi, yr, yi, 0);
+        }
+        xr = yr;
+        xi = yi;
+    }
+    if (nb_stages == 1) {
+        for (int i = 0; i < n; i++) {
+            dstRe[i] = wr[i];
+            dstIm[i] = wi[i];
+        }
+    }
+}
+
+static inline void fft_split_cored_C(const fft_plan64_t *plan, double *srcRe, double *srcIm, double *dstRe, double *dstIm)
+{
+    int n = plan->n;
+    int nb_stages = plan->log2n / 2 + (plan->log2n & 1);
+    if (nb_stages == 0) {
+        dstRe[0] = srcRe[0];
+        dstIm[0] = srcIm[0];
+        return;
+    }
+    double *xr = srcRe, *xi = srcIm;
+    double *wr = plan->work, *wi = plan->work + n;
+    int s = 1;
+    for (int stage = 0; stage < nb_stages; stage++) {
+        double *yr = (nb_stages == 1) ? wr : fft_stage_outd(plan, stage, nb_stages, dstRe);
+        double *yi = (nb_stages == 1) ? wi : ((yr == dstRe) ? dstIm : yr + n);
+        if (s < n / 2 || !(plan->log2n & 1)) {
+            fft_radix4_staged_C(fft_stage_twd(plan, s), n, s, xr, xi, yr, yi);
+            s *= 4;
+        } else {
+            fft_radix2_staged_C(n, xr, xi, yr, yi, 0);
+        }
+        xr = yr;
+        xi = yi;
+    }
+    if (nb_stages == 1) {
+        for (int i = 0; i < n; i++) {
+            dstRe[i] = wr[i];
+            dstIm[i] = wi[i];
+        }
+    }
+}
+
+/* rfft : X[k] = (Z[k] + conj(Z[n-k])) / 2 - j/2 * W^k * (Z[k] - conj(Z[n-k]))
+ * for k in [start, n), plus the real bins X[0] and X[n]. */
+static inline void rfft_postf_C(const fft_plan32_t *plan, const float *zr, const float *zi, complex32_t *dst, int start)
+{
+    int n = plan->n;
+    for (int k = (start > 1) ? start : 1; k < n; k++) {
+        float a = zr[k], b = zi[k];
+        float c = zr[n - k], d = zi[n - k];
+        float wr = plan->rtw[k], wi = plan->rtw[n + k];
+        float hs = a + c, hd = b - d, fr = b + d, fi = c - a;
+        dst[k].re = 0.5f * (hs + wr * fr - wi * fi);
+        dst[k].im = 0.5f * (hd + wr * fi + wi * fr);
+    }
+    float z0r = zr[0], z0i = zi[0];
+    dst[0].re = z0r + z0i;
+    dst[0].im = 0.0f;
+    dst[n].re = z0r - z0i;
+    dst[n].im = 0.0f;
+}
+
+static inline void rfft_postd_C(const fft_plan64_t *plan, const double *zr, const double *zi, complex64_t *dst, int start)
+{
+    int n = plan->n;
+    for (int k = (start > 1) ? start : 1; k < n; k++) {
+        double a = zr[k], b = zi[k];
+        double c = zr[n - k], d = zi[n - k];
+        double wr = plan->rtw[k], wi = plan->rtw[n + k];
+        double hs = a + c, hd = b - d, fr = b + d, fi = c - a;
+        dst[k].re = 0.5 * (hs + wr * fr - wi * fi);
+        dst[k].im = 0.5 * (hd + wr * fi + wi * fr);
+    }
+    double z0r = zr[0], z0i = zi[0];
+    dst[0].re = z0r + z0i;
+    dst[0].im = 0.0;
+    dst[n].re = z0r - z0i;
+    dst[n].im = 0.0;
+}
+
+/* irfft : Z[k] = X[k] + conj(X[n-k]) + j * conj(W^k) * (X[k] - conj(X[n-k])) for k in [start, n),
+ * twice the spectrum of z, so that irfft(rfft(x)) = 2n * x like the complex transforms. */
+static inline void irfft_pref_C(const fft_plan32_t *plan, const complex32_t *src, float *zr, float *zi, int start)
+{
+    int n = plan->n;
+    for (int k = start; k < n; k++) {
+        float a = src[k].re, b = src[k].im;
+        float c = src[n - k].re, d = src[n - k].im;
+        float wr = plan->rtw[k], wi = plan->rtw[n + k];
+        float amc = a - c, bpd = b + d;
+        zr[k] = a + c - bpd * wr + amc * wi;
+        zi[k] = b - d + amc * wr + bpd * wi;
+    }
+}
+
+static inline void irfft_pred_C(const fft_plan64_t *plan, const complex64_t *src, double *zr, double *zi, int start)
+{
+    int n = plan->n;
+    for (int k = start; k < n; k++) {
+        double a = src[k].re, b = src[k].im;
+        double c = src[n - k].re, d = src[n - k].im;
+        double wr = plan->rtw[k], wi = plan->rtw[n + k];
+        double amc = a - c, bpd = b + d;
+        zr[k] = a + c - bpd * wr + amc * wi;
+        zi[k] = b - d + amc * wr + bpd * wi;
+    }
+}
@@ -0,0 +1,280 @@
+/*
+ * Project : SIMD_Utils
+ * Version : 0.2.6
+ * Author  : JishinMaster
+ * Licence : BSD-2
+ */
+
+#pragma once
+
+/* Stateful FIR filters, with polyphase decimation and interpolation.
+ *
+ * A filter keeps its taps and its delay line between calls, so a stream can be
+ * processed by blocks of any length. The input is appended to a linear buffer
+ * holding the last samples of the previous calls, and the outputs are computed
+ * by blocks of FIR_BLOCK_LEN : the backend kernels accumulate several vectors of
+ * consecutive outputs in registers, broadcasting each tap once per block
+ * (dst[i] = sum taps_rev[m] * src[i + m]), instead of one dot product per output.
+ *
+ * Decimation by D splits the reversed taps in D branches of ceil(nb_taps / D) taps,
+ * each one applied to one of the D phases of the input (deinterleaved in the work
+ * buffer), only the kept outputs are computed.
+ * Interpolation by L applies L branches to the input and interleaves their outputs,
+ * the zeros inserted between the input samples are never multiplied.
+ * The gain of the interpolation is the one of the taps (use taps * L for a unit gain).
+ *
+ * Complex filters (complex taps and samples) work on interleaved samples,
+ * the split functions interleave their input and deinterleave their output.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+// outputs (or inputs for interpolations) computed per inner block
+#ifndef FIR_BLOCK_LEN
+#define FIR_BLOCK_LEN 1024
+#endif
+
+// dst[i] = (dst[i] if accumulate) + sum_m taps[m] * src[i + m] for i < len
+// complex kernels : taps holds nb_taps real parts then nb_taps imaginary parts
+typedef void (*fir_kernelf_t)(const float *taps, int nb_taps, const float *src, float *dst, int len, int accumulate);
+
+// plain C kernels, also used for the tails of the backends
+static inline void fir_kernelf_C(const float *taps, int nb_taps, const float *src, float *dst, int len, int accumulate)
+{
+    for (int i = 0; i < len; i++) {
+        float acc = accumulate ? dst[i] : 0.0f;
+        for (int m = 0; m < nb_taps; m++)
+            acc += taps[m] * src[i + m];
+        dst[i] = acc;
+    }
+}
+
+static inline void fir_kernelf_cplx_C(const float *taps, int nb_taps, const float *src, float *dst, int len, int accumulate)
+{
+    const float *taps_im = taps + nb_taps;
+    for (int i = 0; i < len; i++) {
+        float acc_re = accumulate ? dst[2 * i] : 0.0f;
+        float acc_im = accumulate ? dst[2 * i + 1] : 0.0f;
+        for (int m = 0; m < nb_taps; m++) {
+            float re = src[2 * (i + m)], im = src[2 * (i + m) + 1];
+            acc_re += taps[m] * re - taps_im[m] * im;
+            acc_im += taps[m] * im + taps_im[m] * re;
+        }
+        dst[2 * i] = acc_re;
+        dst[2 * i + 1] = acc_im;
+    }
+}
+
+// double kernels, used by the convolutions of doubles (simd_utils_conv.h)
+typedef void (*fir_kerneld_t)(const double *taps, int nb_taps, const double *src, double *dst, int len, int accumulate);
+
+static inline void fir_kerneld_C(const double *taps, int nb_taps, const double *src, double *dst, int len, int accumulate)
+{
+    for (int i = 0; i < len; i++) {
+        double acc = accumulate ? dst[i] : 0.0;
+        for (int m = 0; m < nb_taps; m++)
+            acc += taps[m] * src[i + m];
+        dst[i] = acc;
+    }
+}
+
+static inline fir32_t *fir32_create_(int nb_taps, int up, int down, int cplx)
+{
+    if ((nb_taps < 1) || (up < 1) || (down < 1) || ((up > 1) && (down > 1)))
+        return NULL;
+
+    int c = cplx ? 2 : 1;
+    int nb_branches = (up > 1) ? up : down;
+    int phase_len = (nb_taps + nb_branches - 1) / nb_branches;
+    size_t buf_cap, work_len, out_len;
+    if (up > 1) {
+        buf_cap = (size_t) phase_len - 1 + FIR_BLOCK_LEN;
+        work_len = FIR_BLOCK_LEN;
+        out_len = (size_t) up * FIR_BLOCK_LEN;
+    } else {
+        buf_cap = (size_t) phase_len * down - 1 + (size_t) FIR_BLOCK_LEN * down;
+        work_len = (down > 1) ? (size_t) down * (FIR_BLOCK_LEN + phase_len - 1) : 0;
+        out_len = FIR_BLOCK_LEN;
+    }
+    size_t sizes[4] = {(size_t) nb_branches * phase_len * c, buf_cap * c, work_len * c, out_len * c};
+
+    size_t total = sizeof(fir32_t) + FFT_PLAN_ALIGN;
+    for (int i = 0; i < 4; i++)
+        total += fft_align_up(sizes[i] * sizeof(float));
+    char *p = (char *) malloc(total);
+    if (!p)
+        return NULL;
+    fir32_t *fir = (fir32_t *) p;
+    float **arrays[4] = {&fir->taps, &fir->buf, &fir->work, &fir->out};
+    char *a = (char *) fft_align_up((uintptr_t) p + sizeof(fir32_t));
+    for (int i = 0; i < 4; i++) {
+        *arrays[i] = (float *) a;
+        a += fft_align_up(sizes[i] * sizeof(float));
+    }
+
+    fir->nb_taps = nb_taps;
+    fir->phase_len = phase_len;
+    fir->up = up;
+    fir->down = down;
+    fir->cplx = cplx;
+    return fir;
+}
+
+/* Reversed taps of the branches : with decimation, branch r holds the taps m = j * down + r
+ * of the reversed taps, padded with zeros at the start to phase_len * down.
+ * With interpolation, branch p holds the taps j * up + p, reversed. */
+static inline void fir32_set_tap(fir32_t *fir, int k, float re, float im)
+{
+    int T = fir->phase_len;
+    int c = fir->cplx ? 2 : 1;
+    int branch, j;
+    if (fir->up > 1) {
+        branch = k % fir->up;
+        j = T - 1 - k / fir->up;
+    } else {
+        int m = T * fir->down - 1 - k;  // index in the padded reversed taps
+        branch = m % fir->down;
+        j = m / fir->down;
+    }
+    fir->taps[branch * T * c + j] = re;
+    if (fir->cplx)
+        fir->taps[branch * T * c + T + j] = im;
+}
+
+// clears the delay line
+SIMD_UTILS_API void fir32_reset(fir32_t *fir)
+{
+    int c = fir->cplx ? 2 : 1;
+    fir->buf_len = (fir->up > 1) ? (fir->phase_len - 1) : (fir->phase_len * fir->down - 1);
+    memset(fir->buf, 0, (size_t) fir->buf_len * c * sizeof(float));
+}
+
+/* Real filter of nb_taps taps, interpolating by up or decimating by down (1 for none,
+ * not both), NULL if the parameters are not supported */
+SIMD_UTILS_API fir32_t *fir32_create(float *taps, int nb_taps, int up, int down)
+{
+    fir32_t *fir = fir32_create_(nb_taps, up, down, 0);
+    if (!fir)
+        return NULL;
+    int nb_branches = (up > 1) ? up : down;
+    memset(fir->taps, 0, (size_t) nb_branches * fir->phase_len * sizeof(float));
+    for (int k = 0; k < nb_taps; k++)
+        fir32_set_tap(fir, k, taps[k], 0.0f);
+    fir32_reset(fir);
+    return fir;
+}
+
+SIMD_UTILS_API fir32_t *fir32_create_cplx(complex32_t *taps, int nb_taps, int up, int down)
+{
+    fir32_t *fir = fir32_create_(nb_taps, up, down, 1);
+    if (!fir)
+        return NULL;
+    int nb_branches = (up > 1) ? up : down;
+    memset(fir->taps, 0, (size_t) nb_branches * fir->phase_len * 2 * sizeof(float));
+    for (int k = 0; k < nb_taps; k++)
+        fir32_set_tap(fir, k, taps[k].re, taps[k].im);
+    fir32_reset(fir);
+    return fir;
+}
+
+SIMD_UTILS_API void fir32_destroy(fir32_t *fir)
+{
+    free(fir);
+}
+
+// appends count samples of src (interleaved from src0 and src1 for the split functions)
+static inline void fir_load_inputf(fir32_t *fir, const float *src0, const float *src1, int pos, int count)
+{
+    int c = fir->cplx ? 2 : 1;
+    float *b = fir->buf + (size_t) fir->buf_len * c;
+    if (src1) {
+        for (int i = 0; i < count; i++) {
+            b[2 * i] = src0[pos + i];
+            b[2 * i + 1] = src1[pos + i];
+        }
+    } else {
+        memcpy(b, src0 + (size_t) pos * c, (size_t) count * c * sizeof(float));
+    }
+    fir->buf_len += count;
+}
+
+static inline void fir_store_splitf(const float *out, float *dst0, float *dst1, int count)
+{
+    for (int i = 0; i < count; i++) {
+        dst0[i] = out[2 * i];
+        dst1[i] = out[2 * i + 1];
+    }
+}
+
+/* Filters len input samples, returns the number of output samples :
+ * len * up, or the number of outputs whose last input sample has been received
+ * when decimating (at most len / down + 1).
+ * src1/dst1 are the imaginary arrays of the split functions, NULL otherwise. */
+static inline int fir_runf(fir32_t *fir, fir_kernelf_t kernel, const float *src0, const float *src1, float *dst0, float *dst1, int len)
+{
+    int c = fir->cplx ? 2 : 1;
+    int T = fir->phase_len;
+    int nb_out = 0;
+    int pos = 0;
+
+    if (fir->up > 1) {
+        int L = fir->up;
+        while (pos < len) {
+            int count = ((len - pos) < FIR_BLOCK_LEN) ? (len - pos) : FIR_BLOCK_LEN;
+            fir_load_inputf(fir, src0, src1, pos, count);
+            pos += count;
+
+            float *out = dst1 ? fir->out : dst0 + (size_t) nb_out * c;
+            for (int p = 0; p < L; p++) {
+                float *branch_out = fir->work;
+                kernel(fir->taps + (size_t) p * T * c, T, fir->buf, branch_out, count, 0);
+                for (int n = 0; n < count; n++) {
+                    for (int k = 0; k < c; k++)
+                        out[((size_t) n * L + p) * c + k] = branch_out[n * c + k];
+                }
+            }
+            if (dst1)
+                fir_store_splitf(out, dst0 + nb_out, dst1 + nb_out, count * L);
+            nb_out += count * L;
+
+            memmove(fir->buf, fir->buf + (size_t) count * c, (size_t) (T - 1) * c * sizeof(float));
+            fir->buf_len = T - 1;
+        }
+        return nb_out;
+    }
+
+    int D = fir->down;
+    int span = T * D;
+    int buf_cap = span - 1 + FIR_BLOCK_LEN * D;
+    while (pos < len) {
+        int count = ((len - pos) < (buf_cap - fir->buf_len)) ? (len - pos) : (buf_cap - fir->buf_len);
+        fir_load_inputf(fir, src0, src1, pos, count);
+        pos += count;
+        if (fir->buf_len < span)
+            continue;
+
+        int nout = (fir->buf_len - span) / D + 1;
+        float *out = dst1 ? fir->out : dst0 + (size_t) nb_out * c;
+        if (D == 1) {
+            kernel(fir->taps, T, fir->buf, out, nout, 0);
+        } else {
+            for (int r = 0; r < D; r++) {
+                float *phase = fir->work + (size_t) r * (FIR_BLOCK_LEN + T - 1) * c;
+                for (int k = 0; k < nout + T - 1; k++) {
+                    for (int i = 0; i < c; i++)
+                        phase[k * c + i] = fir->buf[((size_t) k * D + r) * c + i];
+                }
+                kernel(fir->taps + (size_t) r * T * c, T, phase, out, nout, r > 0);
+            }
+        }
+        if (dst1)
+            fir_store_splitf(out, dst0 + nb_out, dst1 + nb_out, nout);
+        nb_out += nout;
+
+        int consumed = nout * D;
+        memmove(fir->buf, fir->buf + (size_t) consumed * c, (size_t) (fir->buf_len - consumed) * c * sizeof(float));
+        fir->buf_len -= consumed;
+    }
+    return nb_out;
+}
@@ -0,0 +1,180 @@
+/*
+ * Project : SIMD_Utils
+ * Version : 0.2.6
+ * Author  : JishinMaster
+ * Licence : BSD-2
+ */
+
+#pragma once
+
+/* Histograms (histogramu8_X, histogram16s_Xs, histogramXs, histogramXf, histogramXf_edges).
+ *
+ * The counts are added to hist, which should be cleared by the caller before the first call.
+ * The elements outside of the bins (and NaNs) are not counted :
+ * - histogramu8_X : 256 bins, one per value.
+ * - histogram16s_Xs, histogramXs : bin (x - low) >> shift, for nb_bins bins of width 1 << shift
+ *   (low + (nb_bins << shift) should not overflow an int32).
+ * - histogramXf : nb_bins bins of width (high - low) / nb_bins, x == high is in the last bin.
+ * - histogramXf_edges : bin i holds edges[i] <= x < edges[i + 1], for nb_bins + 1 sorted edges,
+ *   x == edges[nb_bins] is in the last bin. The bins are found by a branchless binary search
+ *   of all the lanes at once (gathers of the edges).
+ *
+ * Incrementing the same bin in consecutive elements stalls on the store forwarding of the
+ * counter, which is frequent with images or signals (flat areas, saturation). The SSE and AVX
+ * backends compute the bins of HIST_BLOCK_LEN elements with vectors, then count them in
+ * HIST_NB_SUB sub-histograms (consecutive elements go to different sub-histograms), added
+ * to hist at the end. With more than HIST_SUB_MAX_BINS bins, the sub-histograms would not
+ * fit in the L1 cache and hist is incremented directly.
+ * The AVX512 backend counts a vector of bins at once with gather/scatter : the conflict
+ * detection (vpconflictd) gives for each lane the number of previous lanes holding the same
+ * bin, so that the last of them (whose scatter is kept) stores the count of all of them.
+ * The 256 bins of histogramu8_X are always counted in sub-histograms (no bin to compute,
+ * the scalar increments are faster than gather/scatter).
+ */
+
+#ifndef HIST_NB_SUB
+#define HIST_NB_SUB 4
+#endif
+
+#ifndef HIST_SUB_MAX_BINS
+#define HIST_SUB_MAX_BINS 1024
+#endif
+
+#ifndef HIST_BLOCK_LEN
+#define HIST_BLOCK_LEN 1024
+#endif
+
+/* bins of a block and sub-histograms, the lanes outside of the bins get the bin nb_bins
+ * (an extra counter of each sub-histogram, dropped at the end) */
+typedef struct {
+    uint32_t *hist;
+    int nb_bins;
+    int stride;  // counters per sub-histogram, 0 if hist is incremented directly
+    __attribute__((aligned(64))) int32_t bins[HIST_BLOCK_LEN];
+    uint32_t sub[HIST_NB_SUB * (HIST_SUB_MAX_BINS + 1)];
+} hist_state_t;
+
+static inline int hist_block_len(int len, int start)
+{
+    return ((len - start) < HIST_BLOCK_LEN) ? (len - start) : HIST_BLOCK_LEN;
+}
+
+static inline void hist_begin(hist_state_t *st, uint32_t *hist, int nb_bins)
+{
+    st->hist = hist;
+    st->nb_bins = nb_bins;
+    st->stride = (nb_bins <= HIST_SUB_MAX_BINS) ? (nb_bins + 1) : 0;
+    if (st->stride)
+        memset(st->sub, 0, HIST_NB_SUB * st->stride * sizeof(uint32_t));
+}
+
+// counts the len bins of st->bins
+static inline void hist_count(hist_state_t *st, int len)
+{
+    int32_t *bins = st->bins;
+
+    if (st->stride == 0) {
+        for (int i = 0; i < len; i++) {
+            if (bins[i] < st->nb_bins)
+                st->hist[bins[i]]++;
+        }
+        return;
+    }
+
+    uint32_t *sub0 = st->sub;
+    uint32_t *sub1 = sub0 + st->stride;
+    uint32_t *sub2 = sub1 + st->stride;
+    uint32_t *sub3 = sub2 + st->stride;
+    int stop_len = len / HIST_NB_SUB;
+    stop_len *= HIST_NB_SUB;
+
+    for (int i = 0; i < stop_len; i += HIST_NB_SUB) {
+        sub0[bins[i]]++;
+        sub1[bins[i + 1]]++;
+        sub2[bins[i + 2]]++;
+        sub3[bins[i + 3]]++;
+    }
+    for (int i = stop_len; i < len; i++) {
+        sub0[bins[i]]++;
+    }
+}
+
+static inline void hist_end(hist_state_t *st)
+{
+    if (st->stride == 0)
+        return;
+    for (int b = 0; b < st->nb_bins; b++) {
+        uint32_t count = 0;
+        for (int k = 0; k < HIST_NB_SUB; k++) {
+            count += st->sub[k * st->stride + b];
+        }
+        st->hist[b] += count;
+    }
+}
+
+// 256 bins of the values of src, in sub-histograms
+static inline void hist_count_u8(uint8_t *src, int len, uint32_t *hist)
+{
+    uint32_t sub[HIST_NB_SUB][256] = {{0}};
+    int stop_len = len / HIST_NB_SUB;
+    stop_len *= HIST_NB_SUB;
+
+    for (int i = 0; i < stop_len; i += HIST_NB_SUB) {
+        sub[0][src[i]]++;
+        sub[1][src[i + 1]]++;
+        sub[2][src[i + 2]]++;
+        sub[3][src[i + 3]]++;
+    }
+    for (int i = stop_len; i < len; i++) {
+        sub[0][src[i]]++;
+    }
+
+    for (int b = 0; b < 256; b++) {
+        hist[b] += sub[0][b] + sub[1][b] + sub[2][b] + sub[3][b];
+    }
+}
+
+// scale of the bins of histogramXf
+static inline float hist_scalef(float low, float high, int nb_bins)
+{
+    return (float) nb_bins / (high - low);
+}
+
+// bin of x in histogramXs/histogram16s_Xs, nb_bins if it is outside of the bins
+static inline int32_t hist_bini(int32_t x, int32_t low, int shift, int nb_bins)
+{
+    int32_t bin = ((int32_t) ((uint32_t) x - (uint32_t) low)) >> shift;  // negative below low
+    return ((uint32_t) bin < (uint32_t) nb_bins) ? bin : nb_bins;
+}
+
+// bin of x in histogramXf, nb_bins if it is outside of the bins
+static inline int32_t hist_binf(float x, float low, float high, float scale, int nb_bins)
+{
+    if (!((x >= low) && (x <= high)))
+        return nb_bins;
+    int32_t bin = (int32_t) ((x - low) * scale);
+    return (bin < (nb_bins - 1)) ? bin : (nb_bins - 1);
+}
+
+// largest power of 2 <= nb_bins, first step of the binary search of histogramXf_edges
+static inline int hist_edges_step(int nb_bins)
+{
+    int step = 1;
+    while (2 * step <= nb_bins)
+        step *= 2;
+    return step;
+}
+
+// bin of x in histogramXf_edges, nb_bins if it is outside of the bins
+static inline int32_t hist_bin_edgesf(float x, float *edges, int nb_bins, int step)
+{
+    if (!((x >= edges[0]) && (x <= edges[nb_bins])))
+        return nb_bins;
+    int32_t pos = 0;  // last i < nb_bins with edges[i] <= x
+    for (; step > 0; step >>= 1) {
+        int32_t cand = pos + step;
+        if ((cand < nb_bins) && (edges[cand] <= x))
+            pos = cand;
+    }
+    return pos;
+}
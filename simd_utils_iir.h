@@ -0,0 +1,184 @@
+/*
+ * Project : SIMD_Utils
+ * Version : 0.2.6
+ * Author  : JishinMaster
+ * Licence : BSD-2
+ */
+
+#pragma once
+
+/* Cascades of biquads (direct form II transposed), for one or several channels.
+ *
+ * Each stage computes y = b0 * x + z1, z1 = b1 * x - a1 * y + z2, z2 = b2 * x - a2 * y
+ * (a0 is 1). The samples of the channels are interleaved (src[frame * nb_channels + channel]).
+ *
+ * With several channels, a vector holds one sample of consecutive channels, which are
+ * filtered in lockstep : the recursion is the same as the scalar one, on vectors.
+ * The remaining channels (and a single channel) use the block state space form : a block
+ * of N outputs only depends on the N inputs of the block and on the state before it,
+ * y = D * x + c1 * z1 + c2 * z2, with D the lower triangular Toeplitz matrix of the
+ * impulse response and c1, c2 the responses to the states. The N outputs are computed
+ * at once and the state is updated from the last two inputs and outputs, so the
+ * recursion is done once per block instead of once per sample.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+// maximum vector length (AVX512), block of the state space form and padding of the channels
+#define IIR_SS_LEN 16
+// floats of the state space matrices of a stage : D (by columns), c1 and c2
+#define IIR_SS_SIZE ((IIR_SS_LEN + 2) * IIR_SS_LEN)
+
+// frames of a channel deinterleaved at once for the state space kernels
+#ifndef IIR_BLOCK_LEN
+#define IIR_BLOCK_LEN 1024
+#endif
+
+// filters len frames of channel (of stride nb_channels), contiguous for stride 1
+typedef void (*iir_ss_kernelf_t)(iir32_t *iir, int channel, const float *src, float *dst, int len);
+
+static inline float *iir32_ss(iir32_t *iir, int stage, int channel)
+{
+    return iir->ss + ((size_t) stage * iir->nb_channels + channel) * IIR_SS_SIZE;
+}
+
+/* One stage of one channel, the scalar recursion. src and dst have a stride of
+ * stride floats, they can be the same array. */
+static inline void iir_biquadf_C(iir32_t *iir, int stage, int channel, const float *src, float *dst, int len, int stride)
+{
+    int C = iir->stride;
+    const float *c = iir->coefs + (size_t) stage * 5 * C + channel;
+    float *z = iir->state + (size_t) stage * 2 * C + channel;
+    float b0 = c[0], b1 = c[C], b2 = c[2 * C], a1 = c[3 * C], a2 = c[4 * C];
+    float z1 = z[0], z2 = z[C];
+    for (int i = 0; i < len; i++) {
+        float x = src[(size_t) i * stride];
+        float y = b0 * x + z1;
+        z1 = b1 * x - a1 * y + z2;
+        z2 = b2 * x - a2 * y;
+        dst[(size_t) i * stride] = y;
+    }
+    z[0] = z1;
+    z[C] = z2;
+}
+
+/* Updates the state after a block of the state space kernels from its last two inputs
+ * (x1 the last one) and outputs */
+static inline void iir_ss_update(iir32_t *iir, int stage, int channel, float x1, float x2, float y1, float y2)
+{
+    int C = iir->stride;
+    const float *c = iir->coefs + (size_t) stage * 5 * C + channel;
+    float *z = iir->state + (size_t) stage * 2 * C + channel;
+    float b1 = c[C], b2 = c[2 * C], a1 = c[3 * C], a2 = c[4 * C];
+    z[0] = b1 * x1 - a1 * y1 + b2 * x2 - a2 * y2;
+    z[C] = b2 * x1 - a2 * y1;
+}
+
+// plain C state space kernel, the scalar recursion of every stage
+static inline void iir_ss_kernelf_C(iir32_t *iir, int channel, const float *src, float *dst, int len)
+{
+    for (int s = 0; s < iir->nb_stages; s++)
+        iir_biquadf_C(iir, s, channel, s ? dst : src, dst, len, 1);
+}
+
+/* Runs a state space kernel on one channel, deinterleaving it by blocks
+ * of IIR_BLOCK_LEN frames when there are several channels */
+static inline void iir_ss_runf(iir32_t *iir, iir_ss_kernelf_t kernel, int channel, const float *src, float *dst, int len)
+{
+    int C = iir->nb_channels;
+    if (C == 1) {
+        kernel(iir, 0, src, dst, len);
+        return;
+    }
+    for (int pos = 0; pos < len; pos += IIR_BLOCK_LEN) {
+        int count = ((len - pos) < IIR_BLOCK_LEN) ? (len - pos) : IIR_BLOCK_LEN;
+        for (int i = 0; i < count; i++)
+            iir->work[i] = src[(size_t) (pos + i) * C + channel];
+        kernel(iir, channel, iir->work, iir->work, count);
+        for (int i = 0; i < count; i++)
+            dst[(size_t) (pos + i) * C + channel] = iir->work[i];
+    }
+}
+
+// clears the state of every stage and channel
+SIMD_UTILS_API void iir32_reset(iir32_t *iir)
+{
+    memset(iir->state, 0, (size_t) iir->nb_stages * 2 * iir->stride * sizeof(float));
+}
+
+/* Sets the nb_stages * 5 coefficients (b0, b1, b2, a1, a2 of each stage, a0 being 1)
+ * of one channel */
+SIMD_UTILS_API void iir32_set_coefs(iir32_t *iir, int channel, float *coefs)
+{
+    int C = iir->stride;
+    for (int s = 0; s < iir->nb_stages; s++) {
+        const float *c = coefs + 5 * s;
+        for (int k = 0; k < 5; k++)
+            iir->coefs[((size_t) s * 5 + k) * C + channel] = c[k];
+
+        /* responses of the first IIR_SS_LEN outputs to an impulse (h),
+         * to z1 = 1 (c1) and to z2 = 1 (c2), computed in double */
+        double resp[3][IIR_SS_LEN];
+        for (int r = 0; r < 3; r++) {
+            double z1 = (r == 1) ? 1.0 : 0.0, z2 = (r == 2) ? 1.0 : 0.0;
+            for (int i = 0; i < IIR_SS_LEN; i++) {
+                double x = ((r == 0) && (i == 0)) ? 1.0 : 0.0;
+                double y = c[0] * x + z1;
+                z1 = c[1] * x - c[3] * y + z2;
+                z2 = c[2] * x - c[4] * y;
+                resp[r][i] = y;
+            }
+        }
+
+        float *m = iir32_ss(iir, s, channel);
+        for (int j = 0; j < IIR_SS_LEN; j++) {
+            for (int i = 0; i < IIR_SS_LEN; i++)
+                m[j * IIR_SS_LEN + i] = (i >= j) ? (float) resp[0][i - j] : 0.0f;
+        }
+        for (int i = 0; i < IIR_SS_LEN; i++) {
+            m[IIR_SS_LEN * IIR_SS_LEN + i] = (float) resp[1][i];
+            m[(IIR_SS_LEN + 1) * IIR_SS_LEN + i] = (float) resp[2][i];
+        }
+    }
+}
+
+/* Cascade of nb_stages biquads, with the same coefficients (nb_stages * 5 floats,
+ * b0, b1, b2, a1, a2 of each stage) for the nb_channels channels, NULL if the
+ * parameters are not supported. iir32_set_coefs changes the coefficients of a channel. */
+SIMD_UTILS_API iir32_t *iir32_create(float *coefs, int nb_stages, int nb_channels)
+{
+    if ((nb_stages < 1) || (nb_channels < 1))
+        return NULL;
+
+    int stride = (nb_channels + IIR_SS_LEN - 1) / IIR_SS_LEN * IIR_SS_LEN;
+    size_t sc = (size_t) nb_stages * stride;
+    size_t sizes[4] = {sc * 5, sc * 2, (size_t) nb_stages * nb_channels * IIR_SS_SIZE, IIR_BLOCK_LEN};
+    size_t total = sizeof(iir32_t) + FFT_PLAN_ALIGN;
+    for (int i = 0; i < 4; i++)
+        total += fft_align_up(sizes[i] * sizeof(float));
+    char *p = (char *) malloc(total);
+    if (!p)
+        return NULL;
+    iir32_t *iir = (iir32_t *) p;
+    float **arrays[4] = {&iir->coefs, &iir->state, &iir->ss, &iir->work};
+    char *a = (char *) fft_align_up((uintptr_t) p + sizeof(iir32_t));
+    for (int i = 0; i < 4; i++) {
+        *arrays[i] = (float *) a;
+        a += fft_align_up(sizes[i] * sizeof(float));
+    }
+
+    iir->nb_stages = nb_stages;
+    iir->nb_channels = nb_channels;
+    iir->stride = stride;
+    memset(iir->coefs, 0, sc * 5 * sizeof(float));
+    for (int ch = 0; ch < nb_channels; ch++)
+        iir32_set_coefs(iir, ch, coefs);
+    iir32_reset(iir);
+    return iir;
+}
+
+SIMD_UTILS_API void iir32_destroy(iir32_t *iir)
+{
+    free(iir);
+}
@@ -0,0 +1,14 @@
+/*
+ * Project : SIMD_Utils
+ * Version : 0.2.6
+ * Author  : JishinMaster
+ * Licence : BSD-2
+ */
+
+/* Translation unit of the prebuilt simd_utils library (see SIMD_UTILS_EXTERN in simd_utils.h).
+ * It is compiled with the defines of one backend (e.g -DDISPATCH or -DSSE -DAVX -DAVX512 -DFMA),
+ * and includes simd_utils_api.h to check the prototypes against the definitions. */
+
+#define SIMD_UTILS_IMPL
+#include "simd_utils.h"
+#include "simd_utils_api.h"
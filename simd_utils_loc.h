@@ -0,0 +1,177 @@
+/*
+ * Project : SIMD_Utils
+ * Version : 0.2.6
+ * Author  : JishinMaster
+ * Licence : BSD-2
+ */
+
+#pragma once
+
+/* Locations of the minimum and the maximum (maxlocXf, minlocXf, minmaxlocXf, and the
+ * double, int32 and int16 versions).
+ *
+ * Tracking the index of each lane costs a compare and a blend per vector on top of the
+ * min/max, so the array is instead reduced by blocks of LOC_BLOCK_LEN elements with the
+ * minmax kernels of the backends, keeping the first block holding the minimum and the
+ * first block holding the maximum. The index is then searched in these blocks (still
+ * in the cache) with the "first equal" kernels of the backends, which stop at the first
+ * match : the index of the first occurrence is returned, as with the C versions.
+ *
+ * NaNs are not supported (the index of a NaN is never searched for).
+ */
+
+#ifndef LOC_BLOCK_LEN
+#define LOC_BLOCK_LEN 2048
+#endif
+
+typedef void (*minmaxf_kernel_t)(float *src, int len, float *min_value, float *max_value);
+typedef void (*minmaxd_kernel_t)(double *src, int len, double *min_value, double *max_value);
+typedef void (*minmaxs_kernel_t)(int32_t *src, int len, int32_t *min_value, int32_t *max_value);
+typedef void (*minmax16s_kernel_t)(int16_t *src, int len, int16_t *min_value, int16_t *max_value);
+
+// first index i < len with src[i] == value, len if there is none
+typedef int (*firsteqf_kernel_t)(float *src, int len, float value);
+typedef int (*firsteqd_kernel_t)(double *src, int len, double value);
+typedef int (*firsteqs_kernel_t)(int32_t *src, int len, int32_t value);
+typedef int (*firsteq16s_kernel_t)(int16_t *src, int len, int16_t value);
+
+static inline int loc_block_len(int len, int start)
+{
+    return ((len - start) < LOC_BLOCK_LEN) ? (len - start) : LOC_BLOCK_LEN;
+}
+
+// index in the block starting at start, 0 if the value is not found (NaN)
+static inline int loc_index(int start, int found, int block_len)
+{
+    return (found < block_len) ? (start + found) : 0;
+}
+
+/* Minimum and/or maximum with their index, min_idx or max_idx NULL to skip the search
+ * of the minimum or of the maximum. len should be at least 1. */
+static inline void minmaxloc_runf(float *src, int len, minmaxf_kernel_t minmax, firsteqf_kernel_t firsteq,
+                                  float *min_value, int *min_idx, float *max_value, int *max_idx)
+{
+    int min_start = 0, max_start = 0;
+    float min_tmp, max_tmp;
+
+    minmax(src, loc_block_len(len, 0), &min_tmp, &max_tmp);
+    for (int start = LOC_BLOCK_LEN; start < len; start += LOC_BLOCK_LEN) {
+        float min_block, max_block;
+        minmax(src + start, loc_block_len(len, start), &min_block, &max_block);
+        if (min_block < min_tmp) {
+            min_tmp = min_block;
+            min_start = start;
+        }
+        if (max_block > max_tmp) {
+            max_tmp = max_block;
+            max_start = start;
+        }
+    }
+
+    if (min_idx) {
+        int block_len = loc_block_len(len, min_start);
+        *min_idx = loc_index(min_start, firsteq(src + min_start, block_len, min_tmp), block_len);
+        *min_value = min_tmp;
+    }
+    if (max_idx) {
+        int block_len = loc_block_len(len, max_start);
+        *max_idx = loc_index(max_start, firsteq(src + max_start, block_len, max_tmp), block_len);
+        *max_value = max_tmp;
+    }
+}
+
+static inline void minmaxloc_rund(double *src, int len, minmaxd_kernel_t minmax, firsteqd_kernel_t firsteq,
+                                  double *min_value, int *min_idx, double *max_value, int *max_idx)
+{
+    int min_start = 0, max_start = 0;
+    double min_tmp, max_tmp;
+
+    minmax(src, loc_block_len(len, 0), &min_tmp, &max_tmp);
+    for (int start = LOC_BLOCK_LEN; start < len; start += LOC_BLOCK_LEN) {
+        double min_block, max_block;
+        minmax(src + start, loc_block_len(len, start), &min_block, &max_block);
+        if (min_block < min_tmp) {
+            min_tmp = min_block;
+            min_start = start;
+        }
+        if (max_block > max_tmp) {
+            max_tmp = max_block;
+            max_start = start;
+        }
+    }
+
+    if (min_idx) {
+        int block_len = loc_block_len(len, min_start);
+        *min_idx = loc_index(min_start, firsteq(src + min_start, block_len, min_tmp), block_len);
+        *min_value = min_tmp;
+    }
+    if (max_idx) {
+        int block_len = loc_block_len(len, max_start);
+        *max_idx = loc_index(max_start, firsteq(src + max_start, block_len, max_tmp), block_len);
+        *max_value = max_tmp;
+    }
+}
+
+static inline void minmaxloc_runs(int32_t *src, int len, minmaxs_kernel_t minmax, firsteqs_kernel_t firsteq,
+                                  int32_t *min_value, int *min_idx, int32_t *max_value, int *max_idx)
+{
+    int min_start = 0, max_start = 0;
+    int32_t min_tmp, max_tmp;
+
+    minmax(src, loc_block_len(len, 0), &min_tmp, &max_tmp);
+    for (int start = LOC_BLOCK_LEN; start < len; start += LOC_BLOCK_LEN) {
+        int32_t min_block, max_block;
+        minmax(src + start, loc_block_len(len, start), &min_block, &max_block);
+        if (min_block < min_tmp) {
+            min_tmp = min_block;
+            min_start = start;
+        }
+        if (max_block > max_tmp) {
+            max_tmp = max_block;
+            max_start = start;
+        }
+    }
+
+    if (min_idx) {
+        int block_len = loc_block_len(len, min_start);
+        *min_idx = loc_index(min_start, firsteq(src + min_start, block_len, min_tmp), block_len);
+        *min_value = min_tmp;
+    }
+    if (max_idx) {
+        int block_len = loc_block_len(len, max_start);
+        *max_idx = loc_index(max_start, firsteq(src + max_start, block_len, max_tmp), block_len);
+        *max_value = max_tmp;
+    }
+}
+
+static inline void minmaxloc_run16s(int16_t *src, int len, minmax16s_kernel_t minmax, firsteq16s_kernel_t firsteq,
+                                    int16_t *min_value, int *min_idx, int16_t *max_value, int *max_idx)
+{
+    int min_start = 0, max_start = 0;
+    int16_t min_tmp, max_tmp;
+
+    minmax(src, loc_block_len(len, 0), &min_tmp, &max_tmp);
+    for (int start = LOC_BLOCK_LEN; start < len; start += LOC_BLOCK_LEN) {
+        int16_t min_block, max_block;
+        minmax(src + start, loc_block_len(len, start), &min_block, &max_block);
+        if (min_block < min_tmp) {
+            min_tmp = min_block;
+            min_start = start;
+        }
+        if (max_block > max_tmp) {
+            max_tmp = max_block;
+            max_start = start;
+        }
+    }
+
+    if (min_idx) {
+        int block_len = loc_block_len(len, min_start);
+        *min_idx = loc_index(min_start, firsteq(src + min_start, block_len, min_tmp), block_len);
+        *min_value = min_tmp;
+    }
+    if (max_idx) {
+        int block_len = loc_block_len(len, max_start);
+        *max_idx = loc_index(max_start, firsteq(src + max_start, block_len, max_tmp), block_len);
+        *max_value = max_tmp;
+    }
+}
@@ -0,0 +1,141 @@
+/*
+ * Project : SIMD_Utils
+ * Version : 0.2.6
+ * Author  : JishinMaster
+ * Licence : BSD-2
+ */
+
+#pragma once
+
+/* Mean, variance, standard deviation, skewness and kurtosis (momentsXf, momentsXd).
+ *
+ * The moments of an array are accumulated in a moments_t : its count, its mean and the sums
+ * of the 2nd, 3rd and 4th powers of the deviations from the mean. Two moments_t are merged
+ * with the formulas of Chan and Pebay (moments_merge), so that the moments of parts of an
+ * array (chunks of a thread pool, blocks of a stream) give the moments of the whole array.
+ *
+ * Updating the mean for each element (Welford) is a serial dependency, so the backends
+ * instead reduce the array by blocks of MOMENTS_BLOCK_LEN elements : the mean of the block
+ * is computed by the sum kernel, then the sums of the powers of the deviations from this
+ * mean by the centered kernel, while the block is still in the cache. The small error of
+ * the mean of the block is corrected exactly from the sum of the deviations, and the block
+ * is merged into the moments_t. The array is read once from the memory, and the sums of
+ * the squares never cancel each other as with the textbook single pass formula.
+ *
+ * The merges and the corrections are computed in double, also for float arrays.
+ */
+
+#ifndef MOMENTS_BLOCK_LEN
+#define MOMENTS_BLOCK_LEN 1024
+#endif
+
+// sums[k] = sum of (src[i] - shift)^(k + 1), k = 0..3
+typedef void (*centeredf_kernel_t)(float *src, int len, float shift, double *sums);
+typedef void (*centeredd_kernel_t)(double *src, int len, double shift, double *sums);
+
+SIMD_UTILS_API void moments_init(moments_t *m)
+{
+    m->n = 0.0;
+    m->mean = 0.0;
+    m->m2 = 0.0;
+    m->m3 = 0.0;
+    m->m4 = 0.0;
+}
+
+// dst = moments of the elements of dst and of src
+SIMD_UTILS_API void moments_merge(moments_t *dst, const moments_t *src)
+{
+    double na = dst->n, nb = src->n;
+    double n = na + nb;
+
+    if (nb == 0.0)
+        return;
+    if (na == 0.0) {
+        *dst = *src;
+        return;
+    }
+
+    double delta = src->mean - dst->mean;
+    double delta_n = delta / n;
+    double delta_n2 = delta_n * delta_n;
+    double nab = na * nb;
+
+    double m2 = dst->m2 + src->m2 + delta * delta_n * nab;
+    double m3 = dst->m3 + src->m3 + delta * delta_n2 * nab * (na - nb) + 3.0 * delta_n * (na * src->m2 - nb * dst->m2);
+    double m4 = dst->m4 + src->m4 + delta * delta_n2 * delta_n * nab * (na * na - nab + nb * nb) +
+                6.0 * delta_n2 * (na * na * src->m2 + nb * nb * dst->m2) + 4.0 * delta_n * (na * src->m3 - nb * dst->m3);
+
+    dst->mean += delta_n * nb;
+    dst->m2 = m2;
+    dst->m3 = m3;
+    dst->m4 = m4;
+    dst->n = n;
+}
+
+SIMD_UTILS_API double moments_mean(const moments_t *m)
+{
+    return m->mean;
+}
+
+// ddof = 0 for the variance of the population, 1 for the unbiased estimator of a sample
+SIMD_UTILS_API double moments_variance(const moments_t *m, int ddof)
+{
+    return m->m2 / (m->n - (double) ddof);
+}
+
+SIMD_UTILS_API double moments_stddev(const moments_t *m, int ddof)
+{
+    return sqrt(moments_variance(m, ddof));
+}
+
+SIMD_UTILS_API double moments_skewness(const moments_t *m)
+{
+    return sqrt(m->n) * m->m3 / (m->m2 * sqrt(m->m2));
+}
+
+// excess kurtosis (0 for a normal distribution)
+SIMD_UTILS_API double moments_kurtosis(const moments_t *m)
+{
+    return m->n * m->m4 / (m->m2 * m->m2) - 3.0;
+}
+
+// merges the block of n elements whose sums of the powers of (x - shift) are sums into m
+static inline void moments_add_block(moments_t *m, int n, double shift, const double *sums)
+{
+    moments_t block;
+    double c = sums[0] / (double) n;  // mean - shift
+    double c2 = c * c;
+
+    block.n = (double) n;
+    block.mean = shift + c;
+    block.m2 = sums[1] - c * sums[0];
+    block.m3 = sums[2] - 3.0 * c * sums[1] + 2.0 * c2 * sums[0];
+    block.m4 = sums[3] - 4.0 * c * sums[2] + 6.0 * c2 * sums[1] - 3.0 * c2 * c * sums[0];
+    moments_merge(m, &block);
+}
+
+static inline void moments_runf(float *src, int len, sumf_kernel_t sum, centeredf_kernel_t centered, moments_t *m)
+{
+    for (int start = 0; start < len; start += MOMENTS_BLOCK_LEN) {
+        int block_len = ((len - start) < MOMENTS_BLOCK_LEN) ? (len - start) : MOMENTS_BLOCK_LEN;
+        float shift;
+        double sums[4];
+        sum(src + start, &shift, block_len);
+        shift /= (float) block_len;
+        centered(src + start, block_len, shift, sums);
+        moments_add_block(m, block_len, (double) shift, sums);
+    }
+}
+
+static inline void moments_rund(double *src, int len, sumd_kernel_t sum, centeredd_kernel_t centered, moments_t *m)
+{
+    for (int start = 0; start < len; start += MOMENTS_BLOCK_LEN) {
+        int block_len = ((len - start) < MOMENTS_BLOCK_LEN) ? (len - start) : MOMENTS_BLOCK_LEN;
+        double shift;
+        double sums[4];
+        sum(src + start, &shift, block_len);
+        shift /= (double) block_len;
+        centered(src + start, block_len, shift, sums);
+        moments_add_block(m, block_len, shift, sums);
+    }
+}
@@ -16,7 +16,7 @@
 
 #if ELEN >= 64
 
-static inline void rintd_vec(double *src, double *dst, int len)
+SIMD_UTILS_API void rintd_vec(double *src, double *dst, int len)
 {
     size_t i;
     double *src_tmp = src;
@@ -31,7 +31,7 @@ static inline void rintd_vec(double *src, double *dst, int len)
     }
 }
 
-static inline void roundd_vec(double *src, double *dst, int len)
+SIMD_UTILS_API void roundd_vec(double *src, double *dst, int len)
 {
     uint32_t reg_ori;
     reg_ori = _MM_GET_ROUNDING_MODE();
@@ -40,7 +40,7 @@ static inline void roundd_vec(double *src, double *dst, int len)
     _MM_SET_ROUNDING_MODE(reg_ori);
 }
 
-static inline void ceild_vec(double *src, double *dst, int len)
+SIMD_UTILS_API void ceild_vec(double *src, double *dst, int len)
 {
     uint32_t reg_ori;
     reg_ori = _MM_GET_ROUNDING_MODE();
@@ -49,7 +49,7 @@ static inline void ceild_vec(double *src, double *dst, int len)
     _MM_SET_ROUNDING_MODE(reg_ori);
 }
 
-static inline void floord_vec(double *src, double *dst, int len)
+SIMD_UTILS_API void floord_vec(double *src, double *dst, int len)
 {
     uint32_t reg_ori;
     reg_ori = _MM_GET_ROUNDING_MODE();
@@ -58,7 +58,7 @@ static inline void floord_vec(double *src, double *dst, int len)
     _MM_SET_ROUNDING_MODE(reg_ori);
 }
 
-static inline void truncd_vec(double *src, double *dst, int len)
+SIMD_UTILS_API void truncd_vec(double *src, double *dst, int len)
 {
     uint32_t reg_ori;
     reg_ori = _MM_GET_ROUNDING_MODE();
@@ -86,7 +86,7 @@ void addd_vec(double *a, double *b, double *c, int len)
     }
 }
 
-static inline void addcd_vec(double *src, double value, double *dst, int len)
+SIMD_UTILS_API void addcd_vec(double *src, double value, double *dst, int len)
 {
     size_t i;
     double *src_tmp = src;
@@ -101,7 +101,7 @@ static inline void addcd_vec(double *src, double value, double *dst, int len)
     }
 }
 
-static inline void muld_vec(double *a, double *b, double *c, int len)
+SIMD_UTILS_API void muld_vec(double *a, double *b, double *c, int len)
 {
     size_t i;
     double *a_tmp = a;
@@ -120,7 +120,7 @@ static inline void muld_vec(double *a, double *b, double *c, int len)
     }
 }
 
-static inline void divd_vec(double *a, double *b, double *c, int len)
+SIMD_UTILS_API void divd_vec(double *a, double *b, double *c, int len)
 {
     size_t i;
     double *a_tmp = a;
@@ -139,7 +139,7 @@ static inline void divd_vec(double *a, double *b, double *c, int len)
     }
 }
 
-static inline void subd_vec(double *a, double *b, double *c, int len)
+SIMD_UTILS_API void subd_vec(double *a, double *b, double *c, int len)
 {
     size_t i;
     double *a_tmp = a;
@@ -158,7 +158,7 @@ static inline void subd_vec(double *a, double *b, double *c, int len)
     }
 }
 
-static inline void muladdd_vec(double *a, double *b, double *c, double *dst, int len)
+SIMD_UTILS_API void muladdd_vec(double *a, double *b, double *c, double *dst, int len)
 {
     size_t i;
     double *a_tmp = a;
@@ -181,7 +181,7 @@ static inline void muladdd_vec(double *a, double *b, double *c, double *dst, int
     }
 }
 
-static inline void mulcaddd_vec(double *a, double b, double *c, double *dst, int len)
+SIMD_UTILS_API void mulcaddd_vec(double *a, double b, double *c, double *dst, int len)
 {
     size_t i;
     double *a_tmp = a;
@@ -201,7 +201,7 @@ static inline void mulcaddd_vec(double *a, double b, double *c, double *dst, int
     }
 }
 
-static inline void mulcaddcd_vec(double *a, double b, double c, double *dst, int len)
+SIMD_UTILS_API void mulcaddcd_vec(double *a, double b, double c, double *dst, int len)
 {
     size_t i;
     double *a_tmp = a;
@@ -219,7 +219,7 @@ static inline void mulcaddcd_vec(double *a, double b, double c, double *dst, int
     }
 }
 
-static inline void muladdcd_vec(double *a, double *b, double c, double *dst, int len)
+SIMD_UTILS_API void muladdcd_vec(double *a, double *b, double c, double *dst, int len)
 {
     size_t i;
     double *a_tmp = a;
@@ -240,7 +240,7 @@ static inline void muladdcd_vec(double *a, double *b, double c, double *dst, int
     }
 }
 
-static inline void mulcd_vec(double *src, double value, double *dst, int len)
+SIMD_UTILS_API void mulcd_vec(double *src, double value, double *dst, int len)
 {
     size_t i;
     double *src_tmp = src;
@@ -255,7 +255,7 @@ static inline void mulcd_vec(double *src, double value, double *dst, int len)
     }
 }
 
-static inline void setd_vec(double *dst, double value, int len)
+SIMD_UTILS_API void setd_vec(double *dst, double value, int len)
 {
     size_t i;
     double *dst_tmp = dst;
@@ -266,12 +266,12 @@ static inline void setd_vec(double *dst, double value, int len)
     }
 }
 
-static inline void zerod_vec(double *dst, int len)
+SIMD_UTILS_API void zerod_vec(double *dst, int len)
 {
     setd_vec(dst, 0.0, len);
 }
 
-static inline void copyd_vec(double *src, double *dst, int len)
+SIMD_UTILS_API void copyd_vec(double *src, double *dst, int len)
 {
     size_t i;
     double *src_tmp = src;
@@ -284,7 +284,7 @@ static inline void copyd_vec(double *src, double *dst, int len)
     }
 }
 
-static inline void sqrtd_vec(double *src, double *dst, int len)
+SIMD_UTILS_API void sqrtd_vec(double *src, double *dst, int len)
 {
     size_t i;
     double *src_tmp = src;
@@ -300,7 +300,7 @@ static inline void sqrtd_vec(double *src, double *dst, int len)
     }
 }
 
-static inline void fabsd_vec(double *src, double *dst, int len)
+SIMD_UTILS_API void fabsd_vec(double *src, double *dst, int len)
 {
     size_t i;
     double *src_tmp = src;
@@ -316,7 +316,7 @@ static inline void fabsd_vec(double *src, double *dst, int len)
     }
 }
 
-static inline void sumd_vec(double *src, double *dst, int len)
+SIMD_UTILS_API void sumd_vec(double *src, double *dst, int len)
 {
     size_t i;
     double *src_tmp = src;
@@ -341,14 +341,14 @@ static inline void sumd_vec(double *src, double *dst, int len)
     *dst = acc[0];
 }
 
-static inline void meand_vec(double *src, double *dst, int len)
+SIMD_UTILS_API void meand_vec(double *src, double *dst, int len)
 {
     double coeff = 1.0 / ((double) len);
     sumd_vec(src, dst, len);
     *dst *= coeff;
 }
 
-static inline void vectorSloped_vec(double *dst, int len, double offset, double slope)
+SIMD_UTILS_API void vectorSloped_vec(double *dst, int len, double offset, double slope)
 {
     size_t i;
     double *dst_tmp = dst;
@@ -377,7 +377,7 @@ static inline void vectorSloped_vec(double *dst, int len, double offset, double
     }
 }
 
-static inline void cplxtoreald_vec(complex64_t *src, double *dstRe, double *dstIm, int len)
+SIMD_UTILS_API void cplxtoreald_vec(complex64_t *src, double *dstRe, double *dstIm, int len)
 {
     size_t i;
     double *src_tmp = (double *) src;
@@ -397,7 +397,7 @@ static inline void cplxtoreald_vec(complex64_t *src, double *dstRe, double *dstI
     }
 }
 
-static inline void realtocplxd_vec(double *srcRe, double *srcIm, complex64_t *dst, int len)
+SIMD_UTILS_API void realtocplxd_vec(double *srcRe, double *srcIm, complex64_t *dst, int len)
 {
     size_t i;
 
@@ -524,7 +524,7 @@ static inline void sincos_pd(V_ELT_DOUBLEH x,
     *cos_tmp = y_cos;
 }
 
-static inline void sincosd_vec(double *src, double *s, double *c, int len)
+SIMD_UTILS_API void sincosd_vec(double *src, double *s, double *c, int len)
 {
     size_t i;
     double *src_tmp = src;
@@ -561,7 +561,7 @@ static inline void sincosd_vec(double *src, double *s, double *c, int len)
 }
 
 //TODO : check with a real target, QEMU shows low precision
-static inline void sincosd_interleaved_vec(double *src, complex64_t *dst, int len)
+SIMD_UTILS_API void sincosd_interleaved_vec(double *src, complex64_t *dst, int len)
 {
     size_t i;
     double *src_tmp = src;
@@ -666,13 +666,13 @@ static inline V_ELT_DOUBLEH atand_pd(V_ELT_DOUBLEH xx,
 	z = VMERGE_DOUBLEH(flageq2, z, tmp, i);
     z = VADD1_DOUBLEH_MASK(flageq1, z, MOREBITSd, i);
 	y = VADD_DOUBLEH(y, z, i);
-	V_ELT_BOOL64H xeq0 = VEQ1_DOUBLEH_BOOLH(x, 0.0, i);
+	V_ELT_BOOL64H xeq0 = VEQ1_DOUBLEH_BOOLH(xx, 0.0, i);
     y = VINTERP_INTH_DOUBLEH(VXOR_INT64H(VINTERP_DOUBLEH_INTH(y), sign, i));
 	y = VMERGE_DOUBLEH(xeq0, y, xx, i);
     return y;
 }
 
-static inline void atand_vec(double *src, double *dst, int len)
+SIMD_UTILS_API void atand_vec(double *src, double *dst, int len)
 {
     size_t i;
     double *src_tmp = src;
@@ -752,7 +752,7 @@ static inline V_ELT_DOUBLEH atan2_pd(V_ELT_DOUBLEH y, V_ELT_DOUBLEH x, V_ELT_DOU
     return z;
 }
 
-static inline void atan2d_vec(double *src1, double *src2, double *dst, int len)
+SIMD_UTILS_API void atan2d_vec(double *src1, double *src2, double *dst, int len)
 {
     size_t i;
     double *src1_tmp = src1;
@@ -787,7 +787,7 @@ static inline void atan2d_vec(double *src1, double *src2, double *dst, int len)
     }
 }
 
-static inline void atan2d_interleaved_vec(complex64_t *src, double *dst, int len)
+SIMD_UTILS_API void atan2d_interleaved_vec(complex64_t *src, double *dst, int len)
 {
     size_t i;
     double *src_tmp = (double*)src;
@@ -868,7 +868,7 @@ static inline V_ELT_DOUBLEH exp_pd(V_ELT_DOUBLEH x,
     return x;
 }
 
-static inline void expd_vec(double *src, double *dst, int len)
+SIMD_UTILS_API void expd_vec(double *src, double *dst, int len)
 {
     size_t i;
     double *src_tmp = src;
@@ -903,7 +903,7 @@ static inline void expd_vec(double *src, double *dst, int len)
 
 //Work in progress
 //Should improve precision or check on real hardware
-static inline void asind_vec(double *src, double *dst, int len)
+SIMD_UTILS_API void asind_vec(double *src, double *dst, int len)
 {
     size_t i;
     double *src_tmp = src;
@@ -1003,35 +1003,35 @@ static inline void asind_vec(double *src, double *dst, int len)
 
 #warning "No support for double precision functions"
 
-static inline void rintd_vec(double *src, double *dst, int len) {}
-static inline void ceild_vec(double *src, double *dst, int len) {}
-static inline void floord_vec(double *src, double *dst, int len) {}
-static inline void truncd_vec(double *src, double *dst, int len) {}
+SIMD_UTILS_API void rintd_vec(double *src, double *dst, int len) {}
+SIMD_UTILS_API void ceild_vec(double *src, double *dst, int len) {}
+SIMD_UTILS_API void floord_vec(double *src, double *dst, int len) {}
+SIMD_UTILS_API void truncd_vec(double *src, double *dst, int len) {}
 void addd_vec(double *a, double *b, double *c, int len) {}
-static inline void addcd_vec(double *src, double value, double *dst, int len) {}
-static inline void muld_vec(double *a, double *b, double *c, int len) {}
-static inline void divd_vec(double *a, double *b, double *c, int len) {}
-static inline void subd_vec(double *a, double *b, double *c, int len) {}
-static inline void muladdd_vec(double *a, double *b, double *c, double *dst, int len) {}
-static inline void mulcaddd_vec(double *a, double b, double *c, double *dst, int len) {}
-static inline void mulcaddcd_vec(double *a, double b, double c, double *dst, int len) {}
-static inline void muladdcd_vec(double *a, double *b, double c, double *dst, int len) {}
-static inline void mulcd_vec(double *src, double value, double *dst, int len) {}
-static inline void setd_vec(double *dst, double value, int len) {}
-static inline void zerod_vec(double *dst, int len) {}
-static inline void copyd_vec(double *src, double *dst, int len) {}
-static inline void sqrtd_vec(double *src, double *dst, int len) {}
-static inline void fabsd_vec(double *src, double *dst, int len) {}
-static inline void sumd_vec(double *src, double *dst, int len) {}
-static inline void meand_vec(double *src, double *dst, int len) {}
-static inline void vectorSloped_vec(double *dst, int len, double offset, double slope) {}
-static inline void cplxtoreald_vec(complex64_t *src, double *dstRe, double *dstIm, int len) {}
-static inline void realtocplxd_vec(double *srcRe, double *srcIm, complex64_t *dst, int len) {}
-static inline void sincosd_vec(double *src, double *s, double *c, int len) {}
-static inline void sincosd_interleaved_vec(double *src, complex64_t *dst, int len) {}
-static inline void atand_vec(double *src, double *dst, int len) {}
-static inline void atan2d_vec(double *src1, double *src2, double *dst, int len) {}
-static inline void atan2d_interleaved_vec(complex64_t *src, double *dst, int len) {}
-static inline void asind_vec(double *src, double *dst, int len) {}
-static inline void expd_vec(double *src, double *dst, int len) {}
+SIMD_UTILS_API void addcd_vec(double *src, double value, double *dst, int len) {}
+SIMD_UTILS_API void muld_vec(double *a, double *b, double *c, int len) {}
+SIMD_UTILS_API void divd_vec(double *a, double *b, double *c, int len) {}
+SIMD_UTILS_API void subd_vec(double *a, double *b, double *c, int len) {}
+SIMD_UTILS_API void muladdd_vec(double *a, double *b, double *c, double *dst, int len) {}
+SIMD_UTILS_API void mulcaddd_vec(double *a, double b, double *c, double *dst, int len) {}
+SIMD_UTILS_API void mulcaddcd_vec(double *a, double b, double c, double *dst, int len) {}
+SIMD_UTILS_API void muladdcd_vec(double *a, double *b, double c, double *dst, int len) {}
+SIMD_UTILS_API void mulcd_vec(double *src, double value, double *dst, int len) {}
+SIMD_UTILS_API void setd_vec(double *dst, double value, int len) {}
+SIMD_UTILS_API void zerod_vec(double *dst, int len) {}
+SIMD_UTILS_API void copyd_vec(double *src, double *dst, int len) {}
+SIMD_UTILS_API void sqrtd_vec(double *src, double *dst, int len) {}
+SIMD_UTILS_API void fabsd_vec(double *src, double *dst, int len) {}
+SIMD_UTILS_API void sumd_vec(double *src, double *dst, int len) {}
+SIMD_UTILS_API void meand_vec(double *src, double *dst, int len) {}
+SIMD_UTILS_API void vectorSloped_vec(double *dst, int len, double offset, double slope) {}
+SIMD_UTILS_API void cplxtoreald_vec(complex64_t *src, double *dstRe, double *dstIm, int len) {}
+SIMD_UTILS_API void realtocplxd_vec(double *srcRe, double *srcIm, complex64_t *dst, int len) {}
+SIMD_UTILS_API void sincosd_vec(double *src, double *s, double *c, int len) {}
+SIMD_UTILS_API void sincosd_interleaved_vec(double *src, complex64_t *dst, int len) {}
+SIMD_UTILS_API void atand_vec(double *src, double *dst, int len) {}
+SIMD_UTILS_API void atan2d_vec(double *src1, double *src2, double *dst, int len) {}
+SIMD_UTILS_API void atan2d_interleaved_vec(complex64_t *src, double *dst, int len) {}
+SIMD_UTILS_API void asind_vec(double *src, double *dst, int len) {}
+SIMD_UTILS_API void expd_vec(double *src, double *dst, int len) {}
 #endif
@@ -40,7 +40,7 @@ void addf_vec(float *a, float *b, float *c, int len)
     }
 }
 
-static inline void addcf_vec(float *src, float value, float *dst, int len)
+SIMD_UTILS_API void addcf_vec(float *src, float value, float *dst, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -55,7 +55,7 @@ static inline void addcf_vec(float *src, float value, float *dst, int len)
     }
 }
 
-static inline void mulf_vec(float *a, float *b, float *c, int len)
+SIMD_UTILS_API void mulf_vec(float *a, float *b, float *c, int len)
 {
     size_t i;
     float *a_tmp = a;
@@ -74,7 +74,7 @@ static inline void mulf_vec(float *a, float *b, float *c, int len)
     }
 }
 
-static inline void divf_vec(float *a, float *b, float *c, int len)
+SIMD_UTILS_API void divf_vec(float *a, float *b, float *c, int len)
 {
     size_t i;
     float *a_tmp = a;
@@ -93,7 +93,7 @@ static inline void divf_vec(float *a, float *b, float *c, int len)
     }
 }
 
-static inline void subf_vec(float *a, float *b, float *c, int len)
+SIMD_UTILS_API void subf_vec(float *a, float *b, float *c, int len)
 {
     size_t i;
     float *a_tmp = a;
@@ -112,7 +112,7 @@ static inline void subf_vec(float *a, float *b, float *c, int len)
     }
 }
 
-static inline void subcrevf_vec(float *src, float value, float *dst, int len)
+SIMD_UTILS_API void subcrevf_vec(float *src, float value, float *dst, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -126,7 +126,7 @@ static inline void subcrevf_vec(float *src, float value, float *dst, int len)
     }
 }
 
-static inline void muladdf_vec(float *a, float *b, float *c, float *dst, int len)
+SIMD_UTILS_API void muladdf_vec(float *a, float *b, float *c, float *dst, int len)
 {
     size_t i;
     float *a_tmp = a;
@@ -149,7 +149,7 @@ static inline void muladdf_vec(float *a, float *b, float *c, float *dst, int len
     }
 }
 
-static inline void mulcaddf_vec(float *a, float b, float *c, float *dst, int len)
+SIMD_UTILS_API void mulcaddf_vec(float *a, float b, float *c, float *dst, int len)
 {
     size_t i;
     float *a_tmp = a;
@@ -169,7 +169,7 @@ static inline void mulcaddf_vec(float *a, float b, float *c, float *dst, int len
     }
 }
 
-static inline void mulcaddcf_vec(float *a, float b, float c, float *dst, int len)
+SIMD_UTILS_API void mulcaddcf_vec(float *a, float b, float c, float *dst, int len)
 {
     size_t i;
     float *a_tmp = a;
@@ -187,7 +187,7 @@ static inline void mulcaddcf_vec(float *a, float b, float c, float *dst, int len
     }
 }
 
-static inline void muladdcf_vec(float *a, float *b, float c, float *dst, int len)
+SIMD_UTILS_API void muladdcf_vec(float *a, float *b, float c, float *dst, int len)
 {
     size_t i;
     float *a_tmp = a;
@@ -208,7 +208,7 @@ static inline void muladdcf_vec(float *a, float *b, float c, float *dst, int len
     }
 }
 
-static inline void mulcf_vec(float *src, float value, float *dst, int len)
+SIMD_UTILS_API void mulcf_vec(float *src, float value, float *dst, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -224,7 +224,7 @@ static inline void mulcf_vec(float *src, float value, float *dst, int len)
 }
 
 // TODO : could be improved with FMA
-static inline void sinf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void sinf_vec(float *src, float *dst, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -328,7 +328,7 @@ static inline void sinf_vec(float *src, float *dst, int len)
 #endif
 }
 
-static inline void cosf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void cosf_vec(float *src, float *dst, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -586,7 +586,7 @@ void sincosf_ps(V_ELT_FLOATH x,
 #endif	
 }
 
-static inline void sincosf_vec(float *src, float *s, float *c, int len)
+SIMD_UTILS_API void sincosf_vec(float *src, float *s, float *c, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -614,7 +614,7 @@ static inline void sincosf_vec(float *src, float *s, float *c, int len)
     }
 }
 
-static inline void sincosf_interleaved_vec(float *src, complex32_t *dst, int len)
+SIMD_UTILS_API void sincosf_interleaved_vec(float *src, complex32_t *dst, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -639,7 +639,7 @@ static inline void sincosf_interleaved_vec(float *src, complex32_t *dst, int len
     }
 }
 
-static inline void tanf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void tanf_vec(float *src, float *dst, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -716,7 +716,7 @@ static inline void tanf_vec(float *src, float *dst, int len)
     }
 }
 
-static inline void sumf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void sumf_vec(float *src, float *dst, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -754,14 +754,14 @@ static inline void sumf_vec(float *src, float *dst, int len)
 #endif
 }
 
-static inline void meanf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void meanf_vec(float *src, float *dst, int len)
 {
     float coeff = 1.0f / ((float) len);
     sumf_vec(src, dst, len);
     *dst *= coeff;
 }
 
-static inline void dotf_vec(float *src1, float *src2, int len, float *dst)
+SIMD_UTILS_API void dotf_vec(float *src1, float *src2, int len, float *dst)
 {
     size_t i;
     float *src_tmp1 = src1;
@@ -785,7 +785,7 @@ static inline void dotf_vec(float *src1, float *src2, int len, float *dst)
     VSTORE_FLOATHH(dst, acc, 1);
 }
 
-static inline void dotcf_vec(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst)
+SIMD_UTILS_API void dotcf_vec(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst)
 {
     size_t i;
     float *src1_tmp = (float *) src1;
@@ -834,7 +834,7 @@ static inline void dotcf_vec(complex32_t *src1, complex32_t *src2, int len, comp
     }
 }
 
-static inline void cplxtorealf_vec(complex32_t *src, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxtorealf_vec(complex32_t *src, float *dstRe, float *dstIm, int len)
 {
     size_t i;
     float *src_tmp = (float *) src;
@@ -854,7 +854,7 @@ static inline void cplxtorealf_vec(complex32_t *src, float *dstRe, float *dstIm,
     }
 }
 
-static inline void realtocplxf_vec(float *srcRe, float *srcIm, complex32_t *dst, int len)
+SIMD_UTILS_API void realtocplxf_vec(float *srcRe, float *srcIm, complex32_t *dst, int len)
 {
     size_t i;
 
@@ -875,7 +875,7 @@ static inline void realtocplxf_vec(float *srcRe, float *srcIm, complex32_t *dst,
 
 // Work in progress
 // We work on m4 instead of m8 in order to use load/store interleaved
-static inline void cplxvecmulf_vec(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxvecmulf_vec(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
 {
     size_t i;
     float *src1_tmp = (float *) src1;
@@ -912,7 +912,7 @@ static inline void cplxvecmulf_vec(complex32_t *src1, complex32_t *src2, complex
     }
 }
 
-static inline void cplxvecmulf_vec_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxvecmulf_vec_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
 {
     size_t i;
     float *src1Re_tmp = src1Re;
@@ -944,7 +944,7 @@ static inline void cplxvecmulf_vec_split(float *src1Re, float *src1Im, float *sr
     }
 }
 
-static inline void cplxvecdivf_vec(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxvecdivf_vec(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
 {
     size_t i;
     float *src1_tmp = (float *) src1;
@@ -989,7 +989,7 @@ static inline void cplxvecdivf_vec(complex32_t *src1, complex32_t *src2, complex
     }
 }
 
-static inline void cplxvecdivf_vec_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxvecdivf_vec_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
 {
     size_t i;
     float *src1Re_tmp = src1Re;
@@ -1027,7 +1027,7 @@ static inline void cplxvecdivf_vec_split(float *src1Re, float *src1Im, float *sr
     }
 }
 
-static inline void cplxconjf_vec(complex32_t *src, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxconjf_vec(complex32_t *src, complex32_t *dst, int len)
 {
     size_t i;
     float *src_tmp = (float *) src;
@@ -1055,7 +1055,7 @@ static inline void cplxconjf_vec(complex32_t *src, complex32_t *dst, int len)
     }
 }
 
-static inline void cplxconjvecmulf_vec(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxconjvecmulf_vec(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
 {
     size_t i;
     float *src1_tmp = (float *) src1;
@@ -1091,7 +1091,7 @@ static inline void cplxconjvecmulf_vec(complex32_t *src1, complex32_t *src2, com
     }
 }
 
-static inline void cplxconjvecmulf_vec_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxconjvecmulf_vec_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
 {
     size_t i;
     float *src1Re_tmp = src1Re;
@@ -1122,7 +1122,7 @@ static inline void cplxconjvecmulf_vec_split(float *src1Re, float *src1Im, float
     }
 }
 
-static inline void magnitudef_split_vec(float *srcRe, float *srcIm, float *dst, int len)
+SIMD_UTILS_API void magnitudef_split_vec(float *srcRe, float *srcIm, float *dst, int len)
 {
     size_t i;
     float *srcRe_tmp = srcRe;
@@ -1143,7 +1143,7 @@ static inline void magnitudef_split_vec(float *srcRe, float *srcIm, float *dst,
     }
 }
 
-static inline void powerspectf_split_vec(float *srcRe, float *srcIm, float *dst, int len)
+SIMD_UTILS_API void powerspectf_split_vec(float *srcRe, float *srcIm, float *dst, int len)
 {
     size_t i;
     float *srcRe_tmp = srcRe;
@@ -1164,7 +1164,7 @@ static inline void powerspectf_split_vec(float *srcRe, float *srcIm, float *dst,
     }
 }
 
-static inline void powerspectf_interleaved_vec(complex32_t *src, float *dst, int len)
+SIMD_UTILS_API void powerspectf_interleaved_vec(complex32_t *src, float *dst, int len)
 {
     size_t i;
     float *src_tmp = (float *) src;
@@ -1202,7 +1202,7 @@ static inline void powerspectf_interleaved_vec(complex32_t *src, float *dst, int
 #endif
 }
 
-static inline void magnitudef_interleaved_vec(complex32_t *src, float *dst, int len)
+SIMD_UTILS_API void magnitudef_interleaved_vec(complex32_t *src, float *dst, int len)
 {
     size_t i;
     float *src_tmp = (float *) src;
@@ -1240,7 +1240,7 @@ static inline void magnitudef_interleaved_vec(complex32_t *src, float *dst, int
 #endif
 }
 
-static inline void maxeveryf_vec(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void maxeveryf_vec(float *src1, float *src2, float *dst, int len)
 {
     size_t i;
     float *src1_tmp = src1;
@@ -1259,7 +1259,7 @@ static inline void maxeveryf_vec(float *src1, float *src2, float *dst, int len)
     }
 }
 
-static inline void mineveryf_vec(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void mineveryf_vec(float *src1, float *src2, float *dst, int len)
 {
     size_t i;
     float *src1_tmp = src1;
@@ -1278,7 +1278,7 @@ static inline void mineveryf_vec(float *src1, float *src2, float *dst, int len)
     }
 }
 
-static inline void minmaxf_vec(float *src, int len, float *min_value, float *max_value)
+SIMD_UTILS_API void minmaxf_vec(float *src, int len, float *min_value, float *max_value)
 {
     size_t i, i_last;
 
@@ -1305,7 +1305,7 @@ static inline void minmaxf_vec(float *src, int len, float *min_value, float *max
     VSTORE_FLOATHH(max_value, max0, 1);
 }
 
-static inline void threshold_gt_f_vec(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold_gt_f_vec(float *src, float *dst, int len, float value)
 {
     size_t i;
     float *src_tmp = src;
@@ -1321,7 +1321,7 @@ static inline void threshold_gt_f_vec(float *src, float *dst, int len, float val
     }
 }
 
-static inline void threshold_lt_f_vec(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold_lt_f_vec(float *src, float *dst, int len, float value)
 {
     size_t i;
     float *src_tmp = src;
@@ -1337,7 +1337,7 @@ static inline void threshold_lt_f_vec(float *src, float *dst, int len, float val
     }
 }
 
-static inline void threshold_gtabs_f_vec(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold_gtabs_f_vec(float *src, float *dst, int len, float value)
 {
     size_t i;
     float *src_tmp = src;
@@ -1367,7 +1367,7 @@ static inline void threshold_gtabs_f_vec(float *src, float *dst, int len, float
     }
 }
 
-static inline void threshold_ltabs_f_vec(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold_ltabs_f_vec(float *src, float *dst, int len, float value)
 {
     size_t i;
     float *src_tmp = src;
@@ -1386,7 +1386,7 @@ static inline void threshold_ltabs_f_vec(float *src, float *dst, int len, float
     }
 }
 
-static inline void threshold_ltval_gtval_f_vec(float *src, float *dst, int len, float ltlevel, float ltvalue, float gtlevel, float gtvalue)
+SIMD_UTILS_API void threshold_ltval_gtval_f_vec(float *src, float *dst, int len, float ltlevel, float ltvalue, float gtlevel, float gtvalue)
 {
     size_t i;
     float *src_tmp = src;
@@ -1405,7 +1405,7 @@ static inline void threshold_ltval_gtval_f_vec(float *src, float *dst, int len,
     }
 }
 
-static inline void sqrtf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void sqrtf_vec(float *src, float *dst, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -1421,7 +1421,7 @@ static inline void sqrtf_vec(float *src, float *dst, int len)
     }
 }
 
-static inline void fabsf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void fabsf_vec(float *src, float *dst, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -1439,7 +1439,7 @@ static inline void fabsf_vec(float *src, float *dst, int len)
 
 #if 1  // should be faster
 
-static inline void log10f_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void log10f_vec(float *src, float *dst, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -1518,7 +1518,7 @@ static inline void log10f_vec(float *src, float *dst, int len)
 }
 #else
 
-static inline void log10f_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void log10f_vec(float *src, float *dst, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -1654,7 +1654,7 @@ static inline V_ELT_FLOATH log_ps(V_ELT_FLOATH x,
     return x;
 }
 
-static inline void lnf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void lnf_vec(float *src, float *dst, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -1684,7 +1684,7 @@ static inline void lnf_vec(float *src, float *dst, int len)
     }
 }
 
-static inline void log2f_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void log2f_vec(float *src, float *dst, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -1804,7 +1804,7 @@ static inline V_ELT_FLOATH atanf_ps(V_ELT_FLOATH xx,
     return y;
 }
 
-static inline void atanf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void atanf_vec(float *src, float *dst, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -1860,7 +1860,7 @@ static inline V_ELT_FLOATH atan2f_ps(V_ELT_FLOATH y, V_ELT_FLOATH x, V_ELT_FLOAT
     return z;
 }
 
-static inline void atan2f_vec(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void atan2f_vec(float *src1, float *src2, float *dst, int len)
 {
     size_t i;
     float *src1_tmp = src1;
@@ -1887,7 +1887,7 @@ static inline void atan2f_vec(float *src1, float *src2, float *dst, int len)
     }
 }
 
-static inline void atan2f_interleaved_vec(complex32_t *src, float *dst, int len)
+SIMD_UTILS_API void atan2f_interleaved_vec(complex32_t *src, float *dst, int len)
 {
     size_t i;
     float *src_tmp = (float *) src;
@@ -1912,7 +1912,7 @@ static inline void atan2f_interleaved_vec(complex32_t *src, float *dst, int len)
     }
 }
 
-static inline void asinf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void asinf_vec(float *src, float *dst, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -1969,7 +1969,7 @@ static inline void asinf_vec(float *src, float *dst, int len)
     }
 }
 
-static inline void acoshf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void acoshf_vec(float *src, float *dst, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -2041,7 +2041,7 @@ static inline void acoshf_vec(float *src, float *dst, int len)
     }
 }
 
-static inline void asinhf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void asinhf_vec(float *src, float *dst, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -2108,7 +2108,7 @@ static inline void asinhf_vec(float *src, float *dst, int len)
     }
 }
 
-static inline void atanhf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void atanhf_vec(float *src, float *dst, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -2229,7 +2229,7 @@ static inline V_ELT_FLOATH exp_ps(V_ELT_FLOATH x,
     return z;
 }
 
-static inline void expf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void expf_vec(float *src, float *dst, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -2261,7 +2261,7 @@ static inline void expf_vec(float *src, float *dst, int len)
     _MM_SET_ROUNDING_MODE(reg_ori);
 }
 
-static inline void coshf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void coshf_vec(float *src, float *dst, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -2304,7 +2304,7 @@ static inline void coshf_vec(float *src, float *dst, int len)
 }
 
 // TODO : ULP bigger than X86?
-static inline void sinhf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void sinhf_vec(float *src, float *dst, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -2367,7 +2367,7 @@ static inline void sinhf_vec(float *src, float *dst, int len)
     }
 }
 
-static inline void tanhf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void tanhf_vec(float *src, float *dst, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -2438,7 +2438,7 @@ static inline void tanhf_vec(float *src, float *dst, int len)
     _MM_SET_ROUNDING_MODE(reg_ori);
 }
 
-static inline void vectorSlopef_vec(float *dst, int len, float offset, float slope)
+SIMD_UTILS_API void vectorSlopef_vec(float *dst, int len, float offset, float slope)
 {
     size_t i;
     float *dst_tmp = dst;
@@ -2467,7 +2467,7 @@ static inline void vectorSlopef_vec(float *dst, int len, float offset, float slo
     }
 }
 
-static inline void setf_vec(float *dst, float value, int len)
+SIMD_UTILS_API void setf_vec(float *dst, float value, int len)
 {
     size_t i;
     float *dst_tmp = dst;
@@ -2478,12 +2478,12 @@ static inline void setf_vec(float *dst, float value, int len)
     }
 }
 
-static inline void zerof_vec(float *dst, int len)
+SIMD_UTILS_API void zerof_vec(float *dst, int len)
 {
     setf_vec(dst, 0.0f, len);
 }
 
-static inline void copyf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void copyf_vec(float *src, float *dst, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -2496,7 +2496,7 @@ static inline void copyf_vec(float *src, float *dst, int len)
     }
 }
 
-static inline void modf_vec(float *src, float *integer, float *remainder, int len)
+SIMD_UTILS_API void modf_vec(float *src, float *integer, float *remainder, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -2528,7 +2528,7 @@ static inline void modf_vec(float *src, float *integer, float *remainder, int le
 }
 
 // IEEE 754 round to nearest even
-static inline void rintf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void rintf_vec(float *src, float *dst, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -2544,7 +2544,7 @@ static inline void rintf_vec(float *src, float *dst, int len)
 }
 
 //C Roundf, round away from zero
-static inline void roundf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void roundf_vec(float *src, float *dst, int len)
 {
     uint32_t reg_ori;
     reg_ori = _MM_GET_ROUNDING_MODE();
@@ -2553,7 +2553,7 @@ static inline void roundf_vec(float *src, float *dst, int len)
     _MM_SET_ROUNDING_MODE(reg_ori);
 }
 
-static inline void ceilf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void ceilf_vec(float *src, float *dst, int len)
 {
     uint32_t reg_ori;
     reg_ori = _MM_GET_ROUNDING_MODE();
@@ -2562,7 +2562,7 @@ static inline void ceilf_vec(float *src, float *dst, int len)
     _MM_SET_ROUNDING_MODE(reg_ori);
 }
 
-static inline void floorf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void floorf_vec(float *src, float *dst, int len)
 {
     uint32_t reg_ori;
     reg_ori = _MM_GET_ROUNDING_MODE();
@@ -2571,7 +2571,7 @@ static inline void floorf_vec(float *src, float *dst, int len)
     _MM_SET_ROUNDING_MODE(reg_ori);
 }
 
-static inline void truncf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void truncf_vec(float *src, float *dst, int len)
 {
     uint32_t reg_ori;
     reg_ori = _MM_GET_ROUNDING_MODE();
@@ -2581,7 +2581,7 @@ static inline void truncf_vec(float *src, float *dst, int len)
 }
 
 #if 1  // should be a better version
-static inline void flipf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void flipf_vec(float *src, float *dst, int len)
 {
     size_t i;
     i = VSETVL32(len);
@@ -2619,7 +2619,7 @@ static inline void flipf_vec(float *src, float *dst, int len)
     }
 }
 #else
-static inline void flipf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void flipf_vec(float *src, float *dst, int len)
 {
     size_t i;
     int j = len;
@@ -2666,7 +2666,7 @@ static inline V_ELT_FLOATH power_of_twof(V_ELT_INTH b, size_t i)
     return f;
 }
 
-static inline void cbrtf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void cbrtf_vec(float *src, float *dst, int len)
 {
 #ifdef NO_RTZ
     uint32_t reg_ori;
@@ -2773,7 +2773,7 @@ static inline void cbrtf_vec(float *src, float *dst, int len)
 }
 #endif
 
-static inline void convertInt16ToFloat32_vec(int16_t *src, float *dst, int len, int scale_factor)
+SIMD_UTILS_API void convertInt16ToFloat32_vec(int16_t *src, float *dst, int len, int scale_factor)
 {
     float scale_fact_mult = 1.0f / (float) (1 << scale_factor);
     size_t i;
@@ -2794,7 +2794,7 @@ static inline void convertInt16ToFloat32_vec(int16_t *src, float *dst, int len,
 }
 
 // TODO: specific case for RISCV RndFinancial?
-static inline void convertFloat32ToI16_vec(float *src, int16_t *dst, int len, int rounding_mode, int scale_factor)
+SIMD_UTILS_API void convertFloat32ToI16_vec(float *src, int16_t *dst, int len, int rounding_mode, int scale_factor)
 {
     float scale_fact_mult = 1.0f / (float) (1 << scale_factor);
 
@@ -2832,7 +2832,7 @@ static inline void convertFloat32ToI16_vec(float *src, int16_t *dst, int len, in
 
 // TODO: specific case for RISCV RndFinancial?
 //  could scale factor come directly from VCVT_UINT_USHORTH? (shift parameter)
-static inline void convertFloat32ToU16_vec(float *src, uint16_t *dst, int len, int rounding_mode, int scale_factor)
+SIMD_UTILS_API void convertFloat32ToU16_vec(float *src, uint16_t *dst, int len, int rounding_mode, int scale_factor)
 {
     float scale_fact_mult = 1.0f / (float) (1 << scale_factor);
 
@@ -2868,7 +2868,7 @@ static inline void convertFloat32ToU16_vec(float *src, uint16_t *dst, int len, i
     _MM_SET_ROUNDING_MODE(reg_ori);
 }
 
-static inline void convertFloat32ToU8_vec(float *src, uint8_t *dst, int len, int rounding_mode, int scale_factor)
+SIMD_UTILS_API void convertFloat32ToU8_vec(float *src, uint8_t *dst, int len, int rounding_mode, int scale_factor)
 {
     float scale_fact_mult = 1.0f / (float) (1 << scale_factor);
 
@@ -2906,7 +2906,7 @@ static inline void convertFloat32ToU8_vec(float *src, uint8_t *dst, int len, int
     _MM_SET_ROUNDING_MODE(reg_ori);
 }
 
-static inline void pol2cart2Df_vec(float *r, float *theta, float *x, float *y, int len)
+SIMD_UTILS_API void pol2cart2Df_vec(float *r, float *theta, float *x, float *y, int len)
 {
     float *r_tmp = r;
     float *theta_tmp = theta;
@@ -2939,7 +2939,7 @@ static inline void pol2cart2Df_vec(float *r, float *theta, float *x, float *y, i
     }
 }
 
-static inline void cart2pol2Df_vec(float *x, float *y, float *r, float *theta, int len)
+SIMD_UTILS_API void cart2pol2Df_vec(float *x, float *y, float *r, float *theta, int len)
 {
     float *r_tmp = r;
     float *theta_tmp = theta;
@@ -2983,7 +2983,7 @@ static inline void cart2pol2Df_vec(float *x, float *y, float *r, float *theta, i
 #endif
 }
 
-static inline void PReluf_vec(float *src, float *dst, float alpha, int len)
+SIMD_UTILS_API void PReluf_vec(float *src, float *dst, float alpha, int len)
 {
     float *src_tmp = src;
     float *dst_tmp = dst;
@@ -3002,7 +3002,7 @@ static inline void PReluf_vec(float *src, float *dst, float alpha, int len)
     }
 }
 
-static inline void sigmoidf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void sigmoidf_vec(float *src, float *dst, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -3037,7 +3037,7 @@ static inline void sigmoidf_vec(float *src, float *dst, int len)
     _MM_SET_ROUNDING_MODE(reg_ori);
 }
 
-static inline void softmaxf_vec(float *src, float *dst, int len)
+SIMD_UTILS_API void softmaxf_vec(float *src, float *dst, int len)
 {
     size_t i;
     size_t i_last;
@@ -3090,7 +3090,7 @@ static inline void softmaxf_vec(float *src, float *dst, int len)
 }
 
 #if ELEN >= 64
-static inline void convert_32f64f_vec(float *src, double *dst, int len)
+SIMD_UTILS_API void convert_32f64f_vec(float *src, double *dst, int len)
 {
     size_t i;
     float *src_tmp = src;
@@ -3103,7 +3103,7 @@ static inline void convert_32f64f_vec(float *src, double *dst, int len)
     }
 }
 
-static inline void convert_64f32f_vec(double *src, float *dst, int len)
+SIMD_UTILS_API void convert_64f32f_vec(double *src, float *dst, int len)
 {
     size_t i;
     double *src_tmp = src;
@@ -3118,9 +3118,9 @@ static inline void convert_64f32f_vec(double *src, float *dst, int len)
 #else
 
 #warning "No support for double precision functions"
-static inline void convert_32f64f_vec(float *src, double *dst, int len)
+SIMD_UTILS_API void convert_32f64f_vec(float *src, double *dst, int len)
 {
 }
-static inline void convert_64f32f_vec(double *src, float *dst, int len) {}
+SIMD_UTILS_API void convert_64f32f_vec(double *src, float *dst, int len) {}
 
 #endif  // ELEN >= 64
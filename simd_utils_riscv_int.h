@@ -14,7 +14,7 @@
 #include <stdlib.h>
 #include <string.h>
 
-static inline void copys_vec(int32_t *src, int32_t *dst, int len)
+SIMD_UTILS_API void copys_vec(int32_t *src, int32_t *dst, int len)
 {
     size_t i;
     int32_t *src_tmp = src;
@@ -27,7 +27,7 @@ static inline void copys_vec(int32_t *src, int32_t *dst, int len)
     }
 }
 
-static inline void subs_vec(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+SIMD_UTILS_API void subs_vec(int32_t *src1, int32_t *src2, int32_t *dst, int len)
 {
     size_t i;
     int32_t *src1_tmp = src1;
@@ -45,7 +45,7 @@ static inline void subs_vec(int32_t *src1, int32_t *src2, int32_t *dst, int len)
     }
 }
 
-static inline void adds_vec(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+SIMD_UTILS_API void adds_vec(int32_t *src1, int32_t *src2, int32_t *dst, int len)
 {
     size_t i;
     int32_t *src1_tmp = src1;
@@ -63,7 +63,7 @@ static inline void adds_vec(int32_t *src1, int32_t *src2, int32_t *dst, int len)
     }
 }
 
-static inline void addcs_vec(int32_t *src, int32_t value, int32_t *dst, int len)
+SIMD_UTILS_API void addcs_vec(int32_t *src, int32_t value, int32_t *dst, int len)
 {
     size_t i;
     int32_t *src_tmp = src;
@@ -78,7 +78,7 @@ static inline void addcs_vec(int32_t *src, int32_t value, int32_t *dst, int len)
     }
 }
 
-static inline void muls_vec(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+SIMD_UTILS_API void muls_vec(int32_t *src1, int32_t *src2, int32_t *dst, int len)
 {
     size_t i;
     int32_t *src1_tmp = src1;
@@ -96,7 +96,7 @@ static inline void muls_vec(int32_t *src1, int32_t *src2, int32_t *dst, int len)
     }
 }
 
-static inline void mulcs_vec(int32_t *src, int32_t value, int32_t *dst, int len)
+SIMD_UTILS_API void mulcs_vec(int32_t *src, int32_t value, int32_t *dst, int len)
 {
     size_t i;
     int32_t *src_tmp = src;
@@ -111,7 +111,7 @@ static inline void mulcs_vec(int32_t *src, int32_t value, int32_t *dst, int len)
     }
 }
 
-static inline void vectorSlopes_vec(int32_t *dst, int len, int32_t offset, int32_t slope)
+SIMD_UTILS_API void vectorSlopes_vec(int32_t *dst, int len, int32_t offset, int32_t slope)
 {
     size_t i;
     int32_t *dst_tmp = dst;
@@ -140,7 +140,7 @@ static inline void vectorSlopes_vec(int32_t *dst, int len, int32_t offset, int32
     }
 }
 
-static inline void threshold_gt_s_vec(int32_t *src, int32_t *dst, int len, float value)
+SIMD_UTILS_API void threshold_gt_s_vec(int32_t *src, int32_t *dst, int len, float value)
 {
     size_t i;
     int32_t *src_tmp = src;
@@ -156,7 +156,7 @@ static inline void threshold_gt_s_vec(int32_t *src, int32_t *dst, int len, float
     }
 }
 
-static inline void threshold_lt_s_vec(int32_t *src, int32_t *dst, int len, float value)
+SIMD_UTILS_API void threshold_lt_s_vec(int32_t *src, int32_t *dst, int len, float value)
 {
     size_t i;
     int32_t *src_tmp = src;
@@ -172,7 +172,7 @@ static inline void threshold_lt_s_vec(int32_t *src, int32_t *dst, int len, float
     }
 }
 
-static inline void threshold_gtabs_s_vec(int32_t *src, int32_t *dst, int len, int32_t value)
+SIMD_UTILS_API void threshold_gtabs_s_vec(int32_t *src, int32_t *dst, int len, int32_t value)
 {
     size_t i;
     int32_t *src_tmp = src;
@@ -193,7 +193,7 @@ static inline void threshold_gtabs_s_vec(int32_t *src, int32_t *dst, int len, in
     }
 }
 
-static inline void threshold_ltabs_s_vec(int32_t *src, int32_t *dst, int len, int32_t value)
+SIMD_UTILS_API void threshold_ltabs_s_vec(int32_t *src, int32_t *dst, int len, int32_t value)
 {
     size_t i;
     int32_t *src_tmp = src;
@@ -214,7 +214,7 @@ static inline void threshold_ltabs_s_vec(int32_t *src, int32_t *dst, int len, in
     }
 }
 
-static inline void minmaxs_vec(int32_t *src, int len, int32_t *min_value, int32_t *max_value)
+SIMD_UTILS_API void minmaxs_vec(int32_t *src, int len, int32_t *min_value, int32_t *max_value)
 {
     size_t i, i_last;
 
@@ -241,7 +241,7 @@ static inline void minmaxs_vec(int32_t *src, int len, int32_t *min_value, int32_
     VSTORE_INTHH(max_value, max0, 1);
 }
 
-static inline void maxeverys_vec(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+SIMD_UTILS_API void maxeverys_vec(int32_t *src1, int32_t *src2, int32_t *dst, int len)
 {
     size_t i;
     int32_t *src1_tmp = src1;
@@ -260,7 +260,7 @@ static inline void maxeverys_vec(int32_t *src1, int32_t *src2, int32_t *dst, int
     }
 }
 
-static inline void mineverys_vec(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+SIMD_UTILS_API void mineverys_vec(int32_t *src1, int32_t *src2, int32_t *dst, int len)
 {
     size_t i;
     int32_t *src1_tmp = src1;
@@ -279,7 +279,7 @@ static inline void mineverys_vec(int32_t *src1, int32_t *src2, int32_t *dst, int
     }
 }
 
-static inline void threshold_ltval_gtval_s_vec(int32_t *src, int32_t *dst, int len, int32_t ltlevel, int32_t ltvalue, int32_t gtlevel, int32_t gtvalue)
+SIMD_UTILS_API void threshold_ltval_gtval_s_vec(int32_t *src, int32_t *dst, int len, int32_t ltlevel, int32_t ltvalue, int32_t gtlevel, int32_t gtvalue)
 {
     size_t i;
     int32_t *src_tmp = src;
@@ -298,7 +298,7 @@ static inline void threshold_ltval_gtval_s_vec(int32_t *src, int32_t *dst, int l
     }
 }
 
-static inline void flips_vec(int32_t *src, int32_t *dst, int len)
+SIMD_UTILS_API void flips_vec(int32_t *src, int32_t *dst, int len)
 {
     size_t i;
     i = VSETVL32(len);
@@ -337,7 +337,7 @@ static inline void flips_vec(int32_t *src, int32_t *dst, int len)
 }
 
 // Could it be improved? would need proper latency & cpi
-static inline void sum16s32s_vec(int16_t *src, int len, int32_t *dst, int scale_factor)
+SIMD_UTILS_API void sum16s32s_vec(int16_t *src, int len, int32_t *dst, int scale_factor)
 {
     size_t i;
     int16_t *src_tmp = src;
@@ -356,7 +356,7 @@ static inline void sum16s32s_vec(int16_t *src, int len, int32_t *dst, int scale_
     *dst /= scale;
 }
 
-static inline void absdiff16s_vec(int16_t *src1, int16_t *src2, int16_t *dst, int len)
+SIMD_UTILS_API void absdiff16s_vec(int16_t *src1, int16_t *src2, int16_t *dst, int len)
 {
     size_t i;
     int16_t *src1_tmp = src1;
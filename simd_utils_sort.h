@@ -0,0 +1,736 @@
+/*
+ * Project : SIMD_Utils
+ * Version : 0.2.6
+ * Author  : JishinMaster
+ * Licence : BSD-2
+ */
+
+#pragma once
+
+/* Sorts in ascending order (sortXf, sortXd, sortXs) and key-value sorts (sortXf_kv, float keys
+ * with int32 values, e.g. indices for an argsort).
+ *
+ * The array is sorted by a quicksort whose partitions are done by the backends : the elements
+ * lower than the pivot are packed to the left of each vector, the others to the right (compress
+ * on AVX512, a permutation from a table of the lane masks on AVX2 and SSE), and the vectors are
+ * stored on both ends of the array, read in place from the end which has the least free space.
+ * Partitions of at most small_len elements (4 vectors) are sorted in registers by bitonic
+ * networks : each vector is sorted, then the vectors are merged two by two (min/max with the
+ * reversed vector, then the half-cleaners of the bitonic merge).
+ *
+ * The pivot is the median of 3 medians of 3 elements. When it is the minimum of the partition,
+ * the elements equal to it are moved to the left and left out, so that many equal elements keep
+ * the partitions progressing. After 2 * log2(len) levels of partitions, the partition is sorted by
+ * a heapsort, keeping the O(n log n) bound. NaNs are not supported. The key-value sorts are not
+ * stable.
+ *
+ * The partial sorts (partialsortXf, partialsortXs) move the k smallest elements to the beginning
+ * of the array, sorted : the partitions are only done on the side holding the k-th element
+ * (quickselect), then the k first elements are sorted.
+ */
+
+// partitions of at least SORT_NINTHER_LEN elements take their pivot from 9 elements, 3 below
+#ifndef SORT_NINTHER_LEN
+#define SORT_NINTHER_LEN 128
+#endif
+
+// number of elements lower than pivot, which are moved to the beginning of src
+typedef int (*partitionf_kernel_t)(float *src, int len, float pivot);
+typedef int (*partitiond_kernel_t)(double *src, int len, double pivot);
+typedef int (*partitions_kernel_t)(int32_t *src, int len, int32_t pivot);
+typedef int (*partitionf_kv_kernel_t)(float *keys, int32_t *values, int len, float pivot);
+
+// sorts of at most small_len elements
+typedef void (*sortsmallf_kernel_t)(float *src, int len);
+typedef void (*sortsmalld_kernel_t)(double *src, int len);
+typedef void (*sortsmalls_kernel_t)(int32_t *src, int len);
+typedef void (*sortsmallf_kv_kernel_t)(float *keys, int32_t *values, int len);
+
+/* Permutations packing the lanes whose bit is set in the mask to the left, and the others to the
+ * right, in order. sort_perm8_lut : index of the lane j in the nibble j (8 lanes of 32 bits, or
+ * 4 lanes of 64 bits with each bit of the mask doubled), sort_shuffle4_lut : bytes of a shuffle of
+ * 4 lanes of 32 bits (or 2 lanes of 64 bits). */
+static const uint32_t sort_perm8_lut[256] __attribute__((aligned(64))) = {
+    0x76543210, 0x76543210, 0x76543201, 0x76543210, 0x76543102, 0x76543120, 0x76543021, 0x76543210,
+    0x76542103, 0x76542130, 0x76542031, 0x76542310, 0x76541032, 0x76541320, 0x76540321, 0x76543210,
+    0x76532104, 0x76532140, 0x76532041, 0x76532410, 0x76531042, 0x76531420, 0x76530421, 0x76534210,
+    0x76521043, 0x76521430, 0x76520431, 0x76524310, 0x76510432, 0x76514320, 0x76504321, 0x76543210,
+    0x76432105, 0x76432150, 0x76432051, 0x76432510, 0x76431052, 0x76431520, 0x76430521, 0x76435210,
+    0x76421053, 0x76421530, 0x76420531, 0x76425310, 0x76410532, 0x76415320, 0x76405321, 0x76453210,
+    0x76321054, 0x76321540, 0x76320541, 0x76325410, 0x76310542, 0x76315420, 0x76305421, 0x76354210,
+    0x76210543, 0x76215430, 0x76205431, 0x76254310, 0x76105432, 0x76154320, 0x76054321, 0x76543210,
+    0x75432106, 0x75432160, 0x75432061, 0x75432610, 0x75431062, 0x75431620, 0x75430621, 0x75436210,
+    0x75421063, 0x75421630, 0x75420631, 0x75426310, 0x75410632, 0x75416320, 0x75406321, 0x75463210,
+    0x75321064, 0x75321640, 0x75320641, 0x75326410, 0x75310642, 0x75316420, 0x75306421, 0x75364210,
+    0x75210643, 0x75216430, 0x75206431, 0x75264310, 0x75106432, 0x75164320, 0x75064321, 0x75643210,
+    0x74321065, 0x74321650, 0x74320651, 0x74326510, 0x74310652, 0x74316520, 0x74306521, 0x74365210,
+    0x74210653, 0x74216530, 0x74206531, 0x74265310, 0x74106532, 0x74165320, 0x74065321, 0x74653210,
+    0x73210654, 0x73216540, 0x73206541, 0x73265410, 0x73106542, 0x73165420, 0x73065421, 0x73654210,
+    0x72106543, 0x72165430, 0x72065431, 0x72654310, 0x71065432, 0x71654320, 0x70654321, 0x76543210,
+    0x65432107, 0x65432170, 0x65432071, 0x65432710, 0x65431072, 0x65431720, 0x65430721, 0x65437210,
+    0x65421073, 0x65421730, 0x65420731, 0x65427310, 0x65410732, 0x65417320, 0x65407321, 0x65473210,
+    0x65321074, 0x65321740, 0x65320741, 0x65327410, 0x65310742, 0x65317420, 0x65307421, 0x65374210,
+    0x65210743, 0x65217430, 0x65207431, 0x65274310, 0x65107432, 0x65174320, 0x65074321, 0x65743210,
+    0x64321075, 0x64321750, 0x64320751, 0x64327510, 0x64310752, 0x64317520, 0x64307521, 0x64375210,
+    0x64210753, 0x64217530, 0x64207531, 0x64275310, 0x64107532, 0x64175320, 0x64075321, 0x64753210,
+    0x63210754, 0x63217540, 0x63207541, 0x63275410, 0x63107542, 0x63175420, 0x63075421, 0x63754210,
+    0x62107543, 0x62175430, 0x62075431, 0x62754310, 0x61075432, 0x61754320, 0x60754321, 0x67543210,
+    0x54321076, 0x54321760, 0x54320761, 0x54327610, 0x54310762, 0x54317620, 0x54307621, 0x54376210,
+    0x54210763, 0x54217630, 0x54207631, 0x54276310, 0x54107632, 0x54176320, 0x54076321, 0x54763210,
+    0x53210764, 0x53217640, 0x53207641, 0x53276410, 0x53107642, 0x53176420, 0x53076421, 0x53764210,
+    0x52107643, 0x52176430, 0x52076431, 0x52764310, 0x51076432, 0x51764320, 0x50764321, 0x57643210,
+    0x43210765, 0x43217650, 0x43207651, 0x43276510, 0x43107652, 0x43176520, 0x43076521, 0x43765210,
+    0x42107653, 0x42176530, 0x42076531, 0x42765310, 0x41076532, 0x41765320, 0x40765321, 0x47653210,
+    0x32107654, 0x32176540, 0x32076541, 0x32765410, 0x31076542, 0x31765420, 0x30765421, 0x37654210,
+    0x21076543, 0x21765430, 0x20765431, 0x27654310, 0x10765432, 0x17654320, 0x07654321, 0x76543210,
+};
+
+static const uint8_t sort_shuffle4_lut[16][16] __attribute__((aligned(64))) = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {4, 5, 6, 7, 0, 1, 2, 3, 8, 9, 10, 11, 12, 13, 14, 15},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {8, 9, 10, 11, 0, 1, 2, 3, 4, 5, 6, 7, 12, 13, 14, 15},
+    {0, 1, 2, 3, 8, 9, 10, 11, 4, 5, 6, 7, 12, 13, 14, 15},
+    {4, 5, 6, 7, 8, 9, 10, 11, 0, 1, 2, 3, 12, 13, 14, 15},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11},
+    {0, 1, 2, 3, 12, 13, 14, 15, 4, 5, 6, 7, 8, 9, 10, 11},
+    {4, 5, 6, 7, 12, 13, 14, 15, 0, 1, 2, 3, 8, 9, 10, 11},
+    {0, 1, 2, 3, 4, 5, 6, 7, 12, 13, 14, 15, 8, 9, 10, 11},
+    {8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7},
+    {0, 1, 2, 3, 8, 9, 10, 11, 12, 13, 14, 15, 4, 5, 6, 7},
+    {4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+};
+
+// mask of 4 lanes of 64 bits to the mask of their 8 halves
+static inline int sort_double_mask(int mask)
+{
+    return ((mask & 1) * 3) | ((mask & 2) * 6) | ((mask & 4) * 12) | ((mask & 8) * 24);
+}
+
+static inline int sort_depth(int len)
+{
+    int depth = 0;
+    while (len > 1) {
+        len >>= 1;
+        depth += 2;
+    }
+    return depth;
+}
+
+static inline void sort_swapf(float *src, int a, int b)
+{
+    float tmp = src[a];
+    src[a] = src[b];
+    src[b] = tmp;
+}
+
+static inline void insertion_sortf(float *src, int len)
+{
+    for (int i = 1; i < len; i++) {
+        float key = src[i];
+        int j = i;
+        for (; (j > 0) && (key < src[j - 1]); j--) {
+            src[j] = src[j - 1];
+        }
+        src[j] = key;
+    }
+}
+
+static inline void sort_siftf(float *src, int root, int len)
+{
+    for (int child = 2 * root + 1; child < len; child = 2 * root + 1) {
+        if ((child + 1 < len) && (src[child] < src[child + 1]))
+            child++;
+        if (!(src[root] < src[child]))
+            return;
+        sort_swapf(src, root, child);
+        root = child;
+    }
+}
+
+static inline void heapsortf(float *src, int len)
+{
+    for (int i = len / 2 - 1; i >= 0; i--) {
+        sort_siftf(src, i, len);
+    }
+    for (int i = len - 1; i > 0; i--) {
+        sort_swapf(src, 0, i);
+        sort_siftf(src, 0, i);
+    }
+}
+
+static inline int sort_partitionf(float *src, int len, float pivot)
+{
+    int i = 0, j = len - 1;
+    for (;;) {
+        while ((i <= j) && (src[i] < pivot))
+            i++;
+        while ((i <= j) && !(src[j] < pivot))
+            j--;
+        if (i >= j)
+            return i;
+        sort_swapf(src, i, j);
+        i++;
+        j--;
+    }
+}
+
+// partitions the n elements of tmp into the free space [*left_w, *right_w) of the vector partitions
+static inline void sort_partition_tailf(float *src, float *tmp, int n, float pivot, int *left_w, int *right_w)
+{
+    for (int i = 0; i < n; i++) {
+        if (tmp[i] < pivot)
+            src[(*left_w)++] = tmp[i];
+        else
+            src[--(*right_w)] = tmp[i];
+    }
+}
+
+static inline float sort_median3f(float a, float b, float c)
+{
+    if (a < b)
+        return (b < c) ? b : ((a < c) ? c : a);
+    return (a < c) ? a : ((b < c) ? c : b);
+}
+
+static inline float sort_pivotf(float *src, int len)
+{
+    if (len < SORT_NINTHER_LEN)
+        return sort_median3f(src[len / 4], src[len / 2], src[(3 * len) / 4]);
+    int step = len / 8;
+    float a = sort_median3f(src[0], src[step], src[2 * step]);
+    float b = sort_median3f(src[3 * step], src[4 * step], src[5 * step]);
+    float c = sort_median3f(src[6 * step], src[7 * step], src[len - 1]);
+    return sort_median3f(a, b, c);
+}
+
+static inline void sort_swapd(double *src, int a, int b)
+{
+    double tmp = src[a];
+    src[a] = src[b];
+    src[b] = tmp;
+}
+
+static inline void insertion_sortd(double *src, int len)
+{
+    for (int i = 1; i < len; i++) {
+        double key = src[i];
+        int j = i;
+        for (; (j > 0) && (key < src[j - 1]); j--) {
+            src[j] = src[j - 1];
+        }
+        src[j] = key;
+    }
+}
+
+static inline void sort_siftd(double *src, int root, int len)
+{
+    for (int child = 2 * root + 1; child < len; child = 2 * root + 1) {
+        if ((child + 1 < len) && (src[child] < src[child + 1]))
+            child++;
+        if (!(src[root] < src[child]))
+            return;
+        sort_swapd(src, root, child);
+        root = child;
+    }
+}
+
+static inline void heapsortd(double *src, int len)
+{
+    for (int i = len / 2 - 1; i >= 0; i--) {
+        sort_siftd(src, i, len);
+    }
+    for (int i = len - 1; i > 0; i--) {
+        sort_swapd(src, 0, i);
+        sort_siftd(src, 0, i);
+    }
+}
+
+static inline int sort_partitiond(double *src, int len, double pivot)
+{
+    int i = 0, j = len - 1;
+    for (;;) {
+        while ((i <= j) && (src[i] < pivot))
+            i++;
+        while ((i <= j) && !(src[j] < pivot))
+            j--;
+        if (i >= j)
+            return i;
+        sort_swapd(src, i, j);
+        i++;
+        j--;
+    }
+}
+
+// partitions the n elements of tmp into the free space [*left_w, *right_w) of the vector partitions
+static inline void sort_partition_taild(double *src, double *tmp, int n, double pivot, int *left_w, int *right_w)
+{
+    for (int i = 0; i < n; i++) {
+        if (tmp[i] < pivot)
+            src[(*left_w)++] = tmp[i];
+        else
+            src[--(*right_w)] = tmp[i];
+    }
+}
+
+static inline double sort_median3d(double a, double b, double c)
+{
+    if (a < b)
+        return (b < c) ? b : ((a < c) ? c : a);
+    return (a < c) ? a : ((b < c) ? c : b);
+}
+
+static inline double sort_pivotd(double *src, int len)
+{
+    if (len < SORT_NINTHER_LEN)
+        return sort_median3d(src[len / 4], src[len / 2], src[(3 * len) / 4]);
+    int step = len / 8;
+    double a = sort_median3d(src[0], src[step], src[2 * step]);
+    double b = sort_median3d(src[3 * step], src[4 * step], src[5 * step]);
+    double c = sort_median3d(src[6 * step], src[7 * step], src[len - 1]);
+    return sort_median3d(a, b, c);
+}
+
+static inline void sort_swaps(int32_t *src, int a, int b)
+{
+    int32_t tmp = src[a];
+    src[a] = src[b];
+    src[b] = tmp;
+}
+
+static inline void insertion_sorts(int32_t *src, int len)
+{
+    for (int i = 1; i < len; i++) {
+        int32_t key = src[i];
+        int j = i;
+        for (; (j > 0) && (key < src[j - 1]); j--) {
+            src[j] = src[j - 1];
+        }
+        src[j] = key;
+    }
+}
+
+static inline void sort_sifts(int32_t *src, int root, int len)
+{
+    for (int child = 2 * root + 1; child < len; child = 2 * root + 1) {
+        if ((child + 1 < len) && (src[child] < src[child + 1]))
+            child++;
+        if (!(src[root] < src[child]))
+            return;
+        sort_swaps(src, root, child);
+        root = child;
+    }
+}
+
+static inline void heapsorts(int32_t *src, int len)
+{
+    for (int i = len / 2 - 1; i >= 0; i--) {
+        sort_sifts(src, i, len);
+    }
+    for (int i = len - 1; i > 0; i--) {
+        sort_swaps(src, 0, i);
+        sort_sifts(src, 0, i);
+    }
+}
+
+static inline int sort_partitions(int32_t *src, int len, int32_t pivot)
+{
+    int i = 0, j = len - 1;
+    for (;;) {
+        while ((i <= j) && (src[i] < pivot))
+            i++;
+        while ((i <= j) && !(src[j] < pivot))
+            j--;
+        if (i >= j)
+            return i;
+        sort_swaps(src, i, j);
+        i++;
+        j--;
+    }
+}
+
+// partitions the n elements of tmp into the free space [*left_w, *right_w) of the vector partitions
+static inline void sort_partition_tails(int32_t *src, int32_t *tmp, int n, int32_t pivot, int *left_w, int *right_w)
+{
+    for (int i = 0; i < n; i++) {
+        if (tmp[i] < pivot)
+            src[(*left_w)++] = tmp[i];
+        else
+            src[--(*right_w)] = tmp[i];
+    }
+}
+
+static inline int32_t sort_median3s(int32_t a, int32_t b, int32_t c)
+{
+    if (a < b)
+        return (b < c) ? b : ((a < c) ? c : a);
+    return (a < c) ? a : ((b < c) ? c : b);
+}
+
+static inline int32_t sort_pivots(int32_t *src, int len)
+{
+    if (len < SORT_NINTHER_LEN)
+        return sort_median3s(src[len / 4], src[len / 2], src[(3 * len) / 4]);
+    int step = len / 8;
+    int32_t a = sort_median3s(src[0], src[step], src[2 * step]);
+    int32_t b = sort_median3s(src[3 * step], src[4 * step], src[5 * step]);
+    int32_t c = sort_median3s(src[6 * step], src[7 * step], src[len - 1]);
+    return sort_median3s(a, b, c);
+}
+
+static inline void sort_swapf_kv(float *keys, int32_t *values, int a, int b)
+{
+    float tmp = keys[a];
+    keys[a] = keys[b];
+    keys[b] = tmp;
+    int32_t value = values[a];
+    values[a] = values[b];
+    values[b] = value;
+}
+
+static inline void insertion_sortf_kv(float *keys, int32_t *values, int len)
+{
+    for (int i = 1; i < len; i++) {
+        float key = keys[i];
+        int32_t value = values[i];
+        int j = i;
+        for (; (j > 0) && (key < keys[j - 1]); j--) {
+            keys[j] = keys[j - 1];
+            values[j] = values[j - 1];
+        }
+        keys[j] = key;
+        values[j] = value;
+    }
+}
+
+static inline void sort_siftf_kv(float *keys, int32_t *values, int root, int len)
+{
+    for (int child = 2 * root + 1; child < len; child = 2 * root + 1) {
+        if ((child + 1 < len) && (keys[child] < keys[child + 1]))
+            child++;
+        if (!(keys[root] < keys[child]))
+            return;
+        sort_swapf_kv(keys, values, root, child);
+        root = child;
+    }
+}
+
+static inline void heapsortf_kv(float *keys, int32_t *values, int len)
+{
+    for (int i = len / 2 - 1; i >= 0; i--) {
+        sort_siftf_kv(keys, values, i, len);
+    }
+    for (int i = len - 1; i > 0; i--) {
+        sort_swapf_kv(keys, values, 0, i);
+        sort_siftf_kv(keys, values, 0, i);
+    }
+}
+
+static inline int sort_partitionf_kv(float *keys, int32_t *values, int len, float pivot)
+{
+    int i = 0, j = len - 1;
+    for (;;) {
+        while ((i <= j) && (keys[i] < pivot))
+            i++;
+        while ((i <= j) && !(keys[j] < pivot))
+            j--;
+        if (i >= j)
+            return i;
+        sort_swapf_kv(keys, values, i, j);
+        i++;
+        j--;
+    }
+}
+
+// partitions the n elements of tmp into the free space [*left_w, *right_w) of the vector partitions
+static inline void sort_partition_tailf_kv(float *keys, int32_t *values, float *tmp_keys, int32_t *tmp_values, int n, float pivot,
+                                           int *left_w, int *right_w)
+{
+    for (int i = 0; i < n; i++) {
+        int pos = (tmp_keys[i] < pivot) ? (*left_w)++ : --(*right_w);
+        keys[pos] = tmp_keys[i];
+        values[pos] = tmp_values[i];
+    }
+}
+
+// smallest value greater than pivot, 0 if there is none
+static inline int sort_nextf(float pivot, float *next)
+{
+    if (pivot == INFINITY)
+        return 0;
+    *next = nextafterf(pivot, INFINITY);
+    return 1;
+}
+
+static inline int sort_nextd(double pivot, double *next)
+{
+    if (pivot == INFINITY)
+        return 0;
+    *next = nextafter(pivot, INFINITY);
+    return 1;
+}
+
+static inline int sort_nexts(int32_t pivot, int32_t *next)
+{
+    if (pivot == INT32_MAX)
+        return 0;
+    *next = pivot + 1;
+    return 1;
+}
+
+static inline void sort_loopf(float *src, int len, int small_len, partitionf_kernel_t partition, sortsmallf_kernel_t small, int depth)
+{
+    while (len > small_len) {
+        if (depth-- == 0) {
+            heapsortf(src, len);
+            return;
+        }
+
+        float pivot = sort_pivotf(src, len);
+        int k = partition(src, len, pivot);
+        if (k == 0) {
+            // pivot is the minimum, the elements equal to it are sorted
+            float next;
+            if (!sort_nextf(pivot, &next))
+                return;
+            k = partition(src, len, next);
+            src += k;
+            len -= k;
+            continue;
+        }
+
+        // recursion on the smallest part, the stack stays in O(log n)
+        if (k < len - k) {
+            sort_loopf(src, k, small_len, partition, small, depth);
+            src += k;
+            len -= k;
+        } else {
+            sort_loopf(src + k, len - k, small_len, partition, small, depth);
+            len = k;
+        }
+    }
+    small(src, len);
+}
+
+static inline void sort_runf(float *src, int len, int small_len, partitionf_kernel_t partition, sortsmallf_kernel_t small)
+{
+    sort_loopf(src, len, small_len, partition, small, sort_depth(len));
+}
+
+static inline void sort_loopd(double *src, int len, int small_len, partitiond_kernel_t partition, sortsmalld_kernel_t small, int depth)
+{
+    while (len > small_len) {
+        if (depth-- == 0) {
+            heapsortd(src, len);
+            return;
+        }
+
+        double pivot = sort_pivotd(src, len);
+        int k = partition(src, len, pivot);
+        if (k == 0) {
+            // pivot is the minimum, the elements equal to it are sorted
+            double next;
+            if (!sort_nextd(pivot, &next))
+                return;
+            k = partition(src, len, next);
+            src += k;
+            len -= k;
+            continue;
+        }
+
+        // recursion on the smallest part, the stack stays in O(log n)
+        if (k < len - k) {
+            sort_loopd(src, k, small_len, partition, small, depth);
+            src += k;
+            len -= k;
+        } else {
+            sort_loopd(src + k, len - k, small_len, partition, small, depth);
+            len = k;
+        }
+    }
+    small(src, len);
+}
+
+static inline void sort_rund(double *src, int len, int small_len, partitiond_kernel_t partition, sortsmalld_kernel_t small)
+{
+    sort_loopd(src, len, small_len, partition, small, sort_depth(len));
+}
+
+static inline void sort_loops(int32_t *src, int len, int small_len, partitions_kernel_t partition, sortsmalls_kernel_t small, int depth)
+{
+    while (len > small_len) {
+        if (depth-- == 0) {
+            heapsorts(src, len);
+            return;
+        }
+
+        int32_t pivot = sort_pivots(src, len);
+        int k = partition(src, len, pivot);
+        if (k == 0) {
+            // pivot is the minimum, the elements equal to it are sorted
+            int32_t next;
+            if (!sort_nexts(pivot, &next))
+                return;
+            k = partition(src, len, next);
+            src += k;
+            len -= k;
+            continue;
+        }
+
+        // recursion on the smallest part, the stack stays in O(log n)
+        if (k < len - k) {
+            sort_loops(src, k, small_len, partition, small, depth);
+            src += k;
+            len -= k;
+        } else {
+            sort_loops(src + k, len - k, small_len, partition, small, depth);
+            len = k;
+        }
+    }
+    small(src, len);
+}
+
+static inline void sort_runs(int32_t *src, int len, int small_len, partitions_kernel_t partition, sortsmalls_kernel_t small)
+{
+    sort_loops(src, len, small_len, partition, small, sort_depth(len));
+}
+
+static inline void sort_loopf_kv(float *keys, int32_t *values, int len, int small_len, partitionf_kv_kernel_t partition, sortsmallf_kv_kernel_t small, int depth)
+{
+    while (len > small_len) {
+        if (depth-- == 0) {
+            heapsortf_kv(keys, values, len);
+            return;
+        }
+
+        float pivot = sort_pivotf(keys, len);
+        int k = partition(keys, values, len, pivot);
+        if (k == 0) {
+            // pivot is the minimum, the elements equal to it are sorted
+            float next;
+            if (!sort_nextf(pivot, &next))
+                return;
+            k = partition(keys, values, len, next);
+            keys += k;
+            values += k;
+            len -= k;
+            continue;
+        }
+
+        // recursion on the smallest part, the stack stays in O(log n)
+        if (k < len - k) {
+            sort_loopf_kv(keys, values, k, small_len, partition, small, depth);
+            keys += k;
+            values += k;
+            len -= k;
+        } else {
+            sort_loopf_kv(keys + k, values + k, len - k, small_len, partition, small, depth);
+            len = k;
+        }
+    }
+    small(keys, values, len);
+}
+
+static inline void sort_runf_kv(float *keys, int32_t *values, int len, int small_len, partitionf_kv_kernel_t partition, sortsmallf_kv_kernel_t small)
+{
+    sort_loopf_kv(keys, values, len, small_len, partition, small, sort_depth(len));
+}
+
+/* Moves the k smallest elements to src[0..k), sorted, the other elements are left unsorted
+ * after them (the whole array if k >= len) : the partitions which do not hold the k-th element are
+ * not sorted. */
+static inline void partialsort_runf(float *src, int len, int k, int small_len, partitionf_kernel_t partition, sortsmallf_kernel_t small)
+{
+    float *part = src;  // partition holding the k-th element
+    int part_len = len;
+    int depth = sort_depth(len);
+
+    if (k > len)
+        k = len;
+    while (part_len > small_len) {
+        int k_part = k - (int) (part - src);
+        if (depth-- == 0) {
+            heapsortf(part, part_len);
+            break;
+        }
+
+        float pivot = sort_pivotf(part, part_len);
+        int m = partition(part, part_len, pivot);
+        if (m == 0) {
+            // pivot is the minimum, the elements equal to it are in place
+            float next;
+            if (!sort_nextf(pivot, &next))
+                break;
+            m = partition(part, part_len, next);
+            if (m >= k_part)
+                break;
+            part += m;
+            part_len -= m;
+            continue;
+        }
+
+        if (m == k_part)
+            break;
+        if (m > k_part) {
+            part_len = m;
+        } else {
+            part += m;
+            part_len -= m;
+        }
+    }
+    if (part_len <= small_len)
+        small(part, part_len);
+
+    sort_loopf(src, k, small_len, partition, small, sort_depth(k));
+}
+
+/* Moves the k smallest elements to src[0..k), sorted, the other elements are left unsorted
+ * after them (the whole array if k >= len) : the partitions which do not hold the k-th element are
+ * not sorted. */
+static inline void partialsort_runs(int32_t *src, int len, int k, int small_len, partitions_kernel_t partition, sortsmalls_kernel_t small)
+{
+    int32_t *part = src;  // partition holding the k-th element
+    int part_len = len;
+    int depth = sort_depth(len);
+
+    if (k > len)
+        k = len;
+    while (part_len > small_len) {
+        int k_part = k - (int) (part - src);
+        if (depth-- == 0) {
+            heapsorts(part, part_len);
+            break;
+        }
+
+        int32_t pivot = sort_pivots(part, part_len);
+        int m = partition(part, part_len, pivot);
+        if (m == 0) {
+            // pivot is the minimum, the elements equal to it are in place
+            int32_t next;
+            if (!sort_nexts(pivot, &next))
+                break;
+            m = partition(part, part_len, next);
+            if (m >= k_part)
+                break;
+            part += m;
+            part_len -= m;
+            continue;
+        }
+
+        if (m == k_part)
+            break;
+        if (m > k_part) {
+            part_len = m;
+        } else {
+            part += m;
+            part_len -= m;
+        }
+    }
+    if (part_len <= small_len)
+        small(part, part_len);
+
+    sort_loops(src, k, small_len, partition, small, sort_depth(k));
+}
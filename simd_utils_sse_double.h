@@ -13,7 +13,7 @@
 #include "sse2neon_wrapper.h"
 #endif
 
-static inline void set128d(double *dst, double value, int len)
+SIMD_UTILS_API void set128d(double *dst, double value, int len)
 {
     const v2sd tmp = _mm_set1_pd(value);
 
@@ -21,8 +21,15 @@ static inline void set128d(double *dst, double value, int len)
     stop_len *= SSE_LEN_DOUBLE;
 
     if (isAligned((uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
-            _mm_store_pd(dst + i, tmp);
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                _mm_stream_pd(dst + i, tmp);
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                _mm_store_pd(dst + i, tmp);
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
@@ -35,7 +42,7 @@ static inline void set128d(double *dst, double value, int len)
     }
 }
 
-static inline void zero128d(double *dst, int len)
+SIMD_UTILS_API void zero128d(double *dst, int len)
 {
     const v2sd tmp = _mm_setzero_pd();
 
@@ -43,8 +50,15 @@ static inline void zero128d(double *dst, int len)
     stop_len *= SSE_LEN_DOUBLE;
 
     if (isAligned((uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
-            _mm_store_pd(dst + i, tmp);
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                _mm_stream_pd(dst + i, tmp);
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                _mm_store_pd(dst + i, tmp);
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
@@ -57,14 +71,21 @@ static inline void zero128d(double *dst, int len)
     }
 }
 
-static inline void copy128d(double *src, double *dst, int len)
+SIMD_UTILS_API void copy128d(double *src, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
-            _mm_store_pd(dst + i, _mm_load_pd(src + i));
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                _mm_stream_pd(dst + i, _mm_load_pd(src + i));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                _mm_store_pd(dst + i, _mm_load_pd(src + i));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
@@ -77,14 +98,21 @@ static inline void copy128d(double *src, double *dst, int len)
     }
 }
 
-static inline void sqrt128d(double *src, double *dst, int len)
+SIMD_UTILS_API void sqrt128d(double *src, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
-            _mm_store_pd(dst + i, _mm_sqrt_pd(_mm_load_pd(src + i)));
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                _mm_stream_pd(dst + i, _mm_sqrt_pd(_mm_load_pd(src + i)));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                _mm_store_pd(dst + i, _mm_sqrt_pd(_mm_load_pd(src + i)));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
@@ -97,7 +125,49 @@ static inline void sqrt128d(double *src, double *dst, int len)
     }
 }
 
-static inline void add128d(double *src1, double *src2, double *dst, int len)
+SIMD_UTILS_API void fabs128d(double *src, double *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_DOUBLE);
+    stop_len *= (2 * SSE_LEN_DOUBLE);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                v2sd src_tmp2 = _mm_load_pd(src + i + SSE_LEN_DOUBLE);
+                v2sd dst_tmp = _mm_and_pd(*(v2sd *) _pd_positive_mask, src_tmp);
+                v2sd dst_tmp2 = _mm_and_pd(*(v2sd *) _pd_positive_mask, src_tmp2);
+                _mm_stream_pd(dst + i, dst_tmp);
+                _mm_stream_pd(dst + i + SSE_LEN_DOUBLE, dst_tmp2);
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                v2sd src_tmp2 = _mm_load_pd(src + i + SSE_LEN_DOUBLE);
+                v2sd dst_tmp = _mm_and_pd(*(v2sd *) _pd_positive_mask, src_tmp);
+                v2sd dst_tmp2 = _mm_and_pd(*(v2sd *) _pd_positive_mask, src_tmp2);
+                _mm_store_pd(dst + i, dst_tmp);
+                _mm_store_pd(dst + i + SSE_LEN_DOUBLE, dst_tmp2);
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd src_tmp = _mm_loadu_pd(src + i);
+            v2sd src_tmp2 = _mm_loadu_pd(src + i + SSE_LEN_DOUBLE);
+            v2sd dst_tmp = _mm_and_pd(*(v2sd *) _pd_positive_mask, src_tmp);
+            v2sd dst_tmp2 = _mm_and_pd(*(v2sd *) _pd_positive_mask, src_tmp2);
+            _mm_storeu_pd(dst + i, dst_tmp);
+            _mm_storeu_pd(dst + i + SSE_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = fabs(src[i]);
+    }
+}
+
+SIMD_UTILS_API void add128d(double *src1, double *src2, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -117,7 +187,7 @@ static inline void add128d(double *src1, double *src2, double *dst, int len)
     }
 }
 
-static inline void mul128d(double *src1, double *src2, double *dst, int len)
+SIMD_UTILS_API void mul128d(double *src1, double *src2, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -137,7 +207,7 @@ static inline void mul128d(double *src1, double *src2, double *dst, int len)
     }
 }
 
-static inline void sub128d(double *src1, double *src2, double *dst, int len)
+SIMD_UTILS_API void sub128d(double *src1, double *src2, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -157,7 +227,7 @@ static inline void sub128d(double *src1, double *src2, double *dst, int len)
     }
 }
 
-static inline void div128d(double *src1, double *src2, double *dst, int len)
+SIMD_UTILS_API void div128d(double *src1, double *src2, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -178,7 +248,7 @@ static inline void div128d(double *src1, double *src2, double *dst, int len)
 }
 
 // TODO : "Immediate add/mul?"
-static inline void addc128d(double *src, double value, double *dst, int len)
+SIMD_UTILS_API void addc128d(double *src, double value, double *dst, int len)
 {
     const v2sd tmp = _mm_set1_pd(value);
 
@@ -200,7 +270,7 @@ static inline void addc128d(double *src, double value, double *dst, int len)
     }
 }
 
-static inline void mulc128d(double *src, double value, double *dst, int len)
+SIMD_UTILS_API void mulc128d(double *src, double value, double *dst, int len)
 {
     const v2sd tmp = _mm_set1_pd(value);
 
@@ -222,7 +292,7 @@ static inline void mulc128d(double *src, double value, double *dst, int len)
     }
 }
 
-static inline void muladd128d(double *_a, double *_b, double *_c, double *dst, int len)
+SIMD_UTILS_API void muladd128d(double *_a, double *_b, double *_c, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -249,7 +319,7 @@ static inline void muladd128d(double *_a, double *_b, double *_c, double *dst, i
     }
 }
 
-static inline void mulcadd128d(double *_a, double _b, double *_c, double *dst, int len)
+SIMD_UTILS_API void mulcadd128d(double *_a, double _b, double *_c, double *dst, int len)
 {
     v2sd b = _mm_set1_pd(_b);
 
@@ -275,7 +345,7 @@ static inline void mulcadd128d(double *_a, double _b, double *_c, double *dst, i
     }
 }
 
-static inline void mulcaddc128d(double *_a, double _b, double _c, double *dst, int len)
+SIMD_UTILS_API void mulcaddc128d(double *_a, double _b, double _c, double *dst, int len)
 {
     v2sd b = _mm_set1_pd(_b);
     v2sd c = _mm_set1_pd(_c);
@@ -300,7 +370,7 @@ static inline void mulcaddc128d(double *_a, double _b, double _c, double *dst, i
     }
 }
 
-static inline void muladdc128d(double *_a, double *_b, double _c, double *dst, int len)
+SIMD_UTILS_API void muladdc128d(double *_a, double *_b, double _c, double *dst, int len)
 {
     v2sd c = _mm_set1_pd(_c);
 
@@ -326,7 +396,7 @@ static inline void muladdc128d(double *_a, double *_b, double _c, double *dst, i
     }
 }
 
-static inline void rint128d(double *src, double *dst, int len)
+SIMD_UTILS_API void rint128d(double *src, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -350,7 +420,7 @@ static inline void rint128d(double *src, double *dst, int len)
     }
 }
 
-static inline void round128d(double *src, double *dst, int len)
+SIMD_UTILS_API void round128d(double *src, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -380,7 +450,7 @@ static inline void round128d(double *src, double *dst, int len)
     }
 }
 
-static inline void ceil128d(double *src, double *dst, int len)
+SIMD_UTILS_API void ceil128d(double *src, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -402,7 +472,7 @@ static inline void ceil128d(double *src, double *dst, int len)
     }
 }
 
-static inline void floor128d(double *src, double *dst, int len)
+SIMD_UTILS_API void floor128d(double *src, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -424,7 +494,7 @@ static inline void floor128d(double *src, double *dst, int len)
     }
 }
 
-static inline void trunc128d(double *src, double *dst, int len)
+SIMD_UTILS_API void trunc128d(double *src, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -446,7 +516,7 @@ static inline void trunc128d(double *src, double *dst, int len)
     }
 }
 
-static inline void vectorSlope128d(double *dst, int len, double offset, double slope)
+SIMD_UTILS_API void vectorSlope128d(double *dst, int len, double offset, double slope)
 {
     int stop_len = len / (2 * SSE_LEN_DOUBLE);
     stop_len *= (2 * SSE_LEN_DOUBLE);
@@ -487,7 +557,7 @@ static inline void vectorSlope128d(double *dst, int len, double offset, double s
     }
 }
 
-static inline void cplxtoreal128d(complex64_t *src, double *dstRe, double *dstIm, int len)
+SIMD_UTILS_API void cplxtoreal128d(complex64_t *src, double *dstRe, double *dstIm, int len)
 {
     int stop_len = 2 * len / (4 * SSE_LEN_DOUBLE);
     stop_len *= 4 * SSE_LEN_DOUBLE;
@@ -521,7 +591,7 @@ static inline void cplxtoreal128d(complex64_t *src, double *dstRe, double *dstIm
     }
 }
 
-static inline void realtocplx128d(double *srcRe, double *srcIm, complex64_t *dst, int len)
+SIMD_UTILS_API void realtocplx128d(double *srcRe, double *srcIm, complex64_t *dst, int len)
 {
     int stop_len = len / (2 * SSE_LEN_DOUBLE);
     stop_len *= 2 * SSE_LEN_DOUBLE;
@@ -659,7 +729,7 @@ static inline void sincos_pd(v2sd x, v2sd *s, v2sd *c)
     *c = _mm_xor_pd(xmm2, sign_bit_cos);
 }
 
-static inline void sincos128d(double *src, double *dst_sin, double *dst_cos, int len)
+SIMD_UTILS_API void sincos128d(double *src, double *dst_sin, double *dst_cos, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -690,7 +760,7 @@ static inline void sincos128d(double *src, double *dst_sin, double *dst_cos, int
     }
 }
 
-static inline void sincos128d_interleaved(double *src, complex64_t *dst, int len)
+SIMD_UTILS_API void sincos128d_interleaved(double *src, complex64_t *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -835,7 +905,7 @@ static inline v2sd atan_pd(v2sd xx)
     tmp2 = _mm_add_pd(x, *(v2sd *) _pd_1);
     tmp = _mm_div_pd(tmp, tmp2);
     x = _mm_blendv_pd(tmp, x, inftan3pi8inf0p66);
-    xeqzero = _mm_cmpeq_pd(x, _mm_setzero_pd());
+    xeqzero = _mm_cmpeq_pd(xx, _mm_setzero_pd());  // on the input, the reduced x is also 0 for xx == +/-1
 
     tmp2 = _mm_cmpeq_pd(*(v2sd *) _pd_PIO4, y);
     flag = _mm_blendv_pd(flag, *(v2sd *) _pd_2, tmp2);  // if y = PIO4 then flag = 2
@@ -928,7 +998,7 @@ static inline v2sd atan2_pd(v2sd y, v2sd x)
     return (z);
 }
 
-static inline void atan128d(double *src, double *dst, int len)
+SIMD_UTILS_API void atan128d(double *src, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -950,7 +1020,7 @@ static inline void atan128d(double *src, double *dst, int len)
     }
 }
 
-static inline void atan2128d(double *src1, double *src2, double *dst, int len)
+SIMD_UTILS_API void atan2128d(double *src1, double *src2, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -970,7 +1040,7 @@ static inline void atan2128d(double *src1, double *src2, double *dst, int len)
     }
 }
 
-static inline void atan2128d_interleaved(complex64_t *src, double *dst, int len)
+SIMD_UTILS_API void atan2128d_interleaved(complex64_t *src, double *dst, int len)
 {
     int stop_len = len / (2 * SSE_LEN_DOUBLE);
     stop_len *= 2 * SSE_LEN_DOUBLE;
@@ -999,7 +1069,7 @@ static inline void atan2128d_interleaved(complex64_t *src, double *dst, int len)
     }
 }
 
-static inline void asin128d(double *src, double *dst, int len)
+SIMD_UTILS_API void asin128d(double *src, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -1024,7 +1094,7 @@ static inline void asin128d(double *src, double *dst, int len)
 // Work in progress
 // from atan
 // asin(x) = atan( x / sqrt( 1 - x*x ) )
-static inline void asin128d_(double *src, double *dst, int len)
+SIMD_UTILS_API void asin128d_(double *src, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -1050,7 +1120,7 @@ static inline void asin128d_(double *src, double *dst, int len)
     }
 }
 
-static inline void pol2cart2D128f_precise(float *r, float *theta, float *x, float *y, int len)
+SIMD_UTILS_API void pol2cart2D128f_precise(float *r, float *theta, float *x, float *y, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -1113,7 +1183,7 @@ static inline void pol2cart2D128f_precise(float *r, float *theta, float *x, floa
     }
 }
 
-static inline void cart2pol2D128f_precise(float *x, float *y, float *r, float *theta, int len)
+SIMD_UTILS_API void cart2pol2D128f_precise(float *x, float *y, float *r, float *theta, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -1217,15 +1287,23 @@ static inline v2sd exp_pd(v2sd x)
     return (x);
 }
 
-static inline void exp128d(double *src, double *dst, int len)
+SIMD_UTILS_API void exp128d(double *src, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
-            v2sd src_tmp = _mm_load_pd(src + i);
-            _mm_store_pd(dst + i, exp_pd(src_tmp));
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_stream_pd(dst + i, exp_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_store_pd(dst + i, exp_pd(src_tmp));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
@@ -1327,15 +1405,23 @@ static inline v2sd log_pd(v2sd x)
     return (z);
 }
 
-static inline void ln128d(double *src, double *dst, int len)
+SIMD_UTILS_API void ln128d(double *src, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
-            v2sd src_tmp = _mm_load_pd(src + i);
-            _mm_store_pd(dst + i, log_pd(src_tmp));
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_stream_pd(dst + i, log_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_store_pd(dst + i, log_pd(src_tmp));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
@@ -1345,7 +1431,7 @@ static inline void ln128d(double *src, double *dst, int len)
     }
 
     for (int i = stop_len; i < len; i++) {
-        dst[i] = exp(src[i]);
+        dst[i] = log(src[i]);
     }
 }
 
@@ -1436,15 +1522,23 @@ static inline v2sd tan_pd(v2sd xx)
     return y;
 }
 
-static inline void tan128d(double *src, double *dst, int len)
+SIMD_UTILS_API void tan128d(double *src, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
-            v2sd src_tmp = _mm_load_pd(src + i);
-            _mm_store_pd(dst + i, tan_pd(src_tmp));
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_stream_pd(dst + i, tan_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_store_pd(dst + i, tan_pd(src_tmp));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
@@ -1466,7 +1560,7 @@ static inline v2sd pow_pd(v2sd x, v2sd y)
     return ret;
 }
 
-static inline void pow128d(double *x, double *y, double *dst, int len)
+SIMD_UTILS_API void pow128d(double *x, double *y, double *dst, int len)
 {
     int stop_len = len / (2* SSE_LEN_DOUBLE);
     stop_len *= ( 2*SSE_LEN_DOUBLE);
@@ -1500,76 +1594,2309 @@ static inline void pow128d(double *x, double *y, double *dst, int len)
     }
 }
 
-static inline void powcplx128d(complex64_t *x, complex64_t *y, complex64_t *dst, int len)
+// log(1 + x), the rounding of u = 1 + x is compensated : log(u) * x / (u - 1)
+static inline v2sd log1p_pd(v2sd x)
 {
-    int stop_len = len / (2* SSE_LEN_DOUBLE);
-    stop_len *= ( 2*SSE_LEN_DOUBLE);
+    v2sd u = _mm_add_pd(*(v2sd *) _pd_1, x);
+    v2sd d = _mm_sub_pd(u, *(v2sd *) _pd_1);
+    v2sd y = _mm_mul_pd(log_pd(u), _mm_div_pd(x, d));
+    v2sd m_exact = _mm_cmpeq_pd(d, _mm_setzero_pd());  // log(1 + x) = x
+    return _mm_blendv_pd(y, x, m_exact);
+}
 
-    if (areAligned3((uintptr_t) (x), (uintptr_t) (y), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
-            v2sdx2 x_tmp = _mm_load2_pd((double const *) (x) + i);
-            v2sdx2 y_tmp = _mm_load2_pd((double const *) (y) + i);
-            v2sd x_tmp_re2 = _mm_mul_pd(x_tmp.val[0], x_tmp.val[0]);
-            v2sd modx = _mm_fmadd_pd_custom(x_tmp.val[1], x_tmp.val[1], x_tmp_re2);
-			modx = _mm_sqrt_pd(modx);
-			v2sdx2 logx;
-			logx.val[0] = log_pd(modx);
-			logx.val[1] = atan2_pd(x_tmp.val[1], x_tmp.val[0]);
-			v2sdx2 ylogx;
-            v2sd ac = _mm_mul_pd(logx.val[0], y_tmp.val[0]);     // ac
-            v2sd ad = _mm_mul_pd(logx.val[0], y_tmp.val[1]);     // ad
-            ylogx.val[0] = _mm_fnmadd_pd_custom(logx.val[1], y_tmp.val[1], ac);
-            ylogx.val[1] = _mm_fmadd_pd_custom(logx.val[1], y_tmp.val[0], ad);
-			v2sd ex = exp_pd(ylogx.val[0]);
-			v2sd cosylogx, sinylogx;
-			sincos_pd(ylogx.val[1], &sinylogx, &cosylogx);
-			v2sdx2 dst_tmp;
-			dst_tmp.val[0] = _mm_mul_pd(ex,cosylogx);
-			dst_tmp.val[1] = _mm_mul_pd(ex,sinylogx);
-            _mm_store2_pd((double*)(dst) + i, dst_tmp);
+static inline v2sd log2_pd(v2sd x)
+{
+    v2sd y = log_pd(x);
+    v2sd lo = _mm_mul_pd(y, *(v2sd *) _pd_log2e_lo);
+    return _mm_fmadd_pd_custom(y, *(v2sd *) _pd_cephes_LOG2E, lo);
+}
+
+static inline v2sd log10_pd(v2sd x)
+{
+    v2sd y = log_pd(x);
+    v2sd lo = _mm_mul_pd(y, *(v2sd *) _pd_log10e_lo);
+    return _mm_fmadd_pd_custom(y, *(v2sd *) _pd_log10e, lo);
+}
+
+static inline v2sd sinh_pd(v2sd x)
+{
+    v2sd xabs = _mm_and_pd(x, *(v2sd *) _pd_positive_mask);
+    v2sd sign = _mm_and_pd(x, *(v2sd *) _pd_negative_mask);
+
+    // |x| <= 1 : x + x^3 P(x^2) / Q(x^2)
+    v2sd z = _mm_mul_pd(xabs, xabs);
+    v2sd p = _mm_fmadd_pd_custom(z, *(v2sd *) _pd_sinh_p0, *(v2sd *) _pd_sinh_p1);
+    p = _mm_fmadd_pd_custom(z, p, *(v2sd *) _pd_sinh_p2);
+    p = _mm_fmadd_pd_custom(z, p, *(v2sd *) _pd_sinh_p3);
+    v2sd q = _mm_add_pd(z, *(v2sd *) _pd_sinh_q0);
+    q = _mm_fmadd_pd_custom(z, q, *(v2sd *) _pd_sinh_q1);
+    q = _mm_fmadd_pd_custom(z, q, *(v2sd *) _pd_sinh_q2);
+    v2sd small = _mm_fmadd_pd_custom(_mm_mul_pd(xabs, z), _mm_div_pd(p, q), xabs);
+
+    // |x| > 1 : (exp(|x|) - exp(-|x|)) / 2
+    v2sd e = exp_pd(xabs);
+    v2sd large = _mm_fmadd_pd_custom(e, *(v2sd *) _pd_0p5, _mm_div_pd(*(v2sd *) _pd_min0p5, e));
+
+    v2sd m_large = _mm_cmpgt_pd(xabs, *(v2sd *) _pd_1);
+    v2sd y = _mm_blendv_pd(small, large, m_large);
+    return _mm_xor_pd(y, sign);
+}
+
+static inline v2sd cosh_pd(v2sd x)
+{
+    v2sd e = exp_pd(_mm_and_pd(x, *(v2sd *) _pd_positive_mask));
+    return _mm_fmadd_pd_custom(e, *(v2sd *) _pd_0p5, _mm_div_pd(*(v2sd *) _pd_0p5, e));
+}
+
+static inline v2sd tanh_pd(v2sd x)
+{
+    v2sd xabs = _mm_and_pd(x, *(v2sd *) _pd_positive_mask);
+    v2sd sign = _mm_and_pd(x, *(v2sd *) _pd_negative_mask);
+
+    // |x| < 0.625 : x + x^3 P(x^2) / Q(x^2)
+    v2sd z = _mm_mul_pd(xabs, xabs);
+    v2sd p = _mm_fmadd_pd_custom(z, *(v2sd *) _pd_tanh_p0, *(v2sd *) _pd_tanh_p1);
+    p = _mm_fmadd_pd_custom(z, p, *(v2sd *) _pd_tanh_p2);
+    v2sd q = _mm_add_pd(z, *(v2sd *) _pd_tanh_q0);
+    q = _mm_fmadd_pd_custom(z, q, *(v2sd *) _pd_tanh_q1);
+    q = _mm_fmadd_pd_custom(z, q, *(v2sd *) _pd_tanh_q2);
+    v2sd small = _mm_fmadd_pd_custom(_mm_mul_pd(xabs, z), _mm_div_pd(p, q), xabs);
+
+    // |x| >= 0.625 : 1 - 2 / (exp(2|x|) + 1)
+    v2sd xmax = _mm_min_pd(xabs, *(v2sd *) _pd_tanh_max);
+    v2sd e = exp_pd(_mm_add_pd(xmax, xmax));
+    v2sd large = _mm_sub_pd(*(v2sd *) _pd_1, _mm_div_pd(*(v2sd *) _pd_2, _mm_add_pd(e, *(v2sd *) _pd_1)));
+
+    v2sd m_large = _mm_cmpge_pd(xabs, *(v2sd *) _pd_0p625);
+    v2sd y = _mm_blendv_pd(small, large, m_large);
+    return _mm_xor_pd(y, sign);
+}
+
+static inline v2sd asinh_pd(v2sd x)
+{
+    v2sd xabs = _mm_and_pd(x, *(v2sd *) _pd_positive_mask);
+    v2sd sign = _mm_and_pd(x, *(v2sd *) _pd_negative_mask);
+
+    // log1p(|x| + x^2 / (1 + sqrt(1 + x^2)))
+    v2sd z = _mm_mul_pd(xabs, xabs);
+    v2sd tmp = _mm_add_pd(*(v2sd *) _pd_1, _mm_sqrt_pd(_mm_add_pd(*(v2sd *) _pd_1, z)));
+    v2sd small = log1p_pd(_mm_add_pd(xabs, _mm_div_pd(z, tmp)));
+
+    // |x| > 1e8 : log(|x|) + log(2), x^2 could overflow
+    v2sd large = _mm_add_pd(log_pd(xabs), *(v2sd *) _pd_cephes_LOGE2);
+
+    v2sd m_large = _mm_cmpgt_pd(xabs, *(v2sd *) _pd_asinh_big);
+    v2sd y = _mm_blendv_pd(small, large, m_large);
+    return _mm_xor_pd(y, sign);
+}
+
+static inline v2sd acosh_pd(v2sd x)
+{
+    // log1p(z + sqrt(2z + z^2)), z = x - 1
+    v2sd z = _mm_sub_pd(x, *(v2sd *) _pd_1);
+    v2sd tmp = _mm_sqrt_pd(_mm_fmadd_pd_custom(z, z, _mm_add_pd(z, z)));
+    v2sd small = log1p_pd(_mm_add_pd(z, tmp));
+
+    // x > 1e8 : log(x) + log(2)
+    v2sd large = _mm_add_pd(log_pd(x), *(v2sd *) _pd_cephes_LOGE2);
+
+    v2sd m_large = _mm_cmpgt_pd(x, *(v2sd *) _pd_asinh_big);
+    return _mm_blendv_pd(small, large, m_large);
+}
+
+static inline v2sd atanh_pd(v2sd x)
+{
+    v2sd xabs = _mm_and_pd(x, *(v2sd *) _pd_positive_mask);
+    v2sd sign = _mm_and_pd(x, *(v2sd *) _pd_negative_mask);
+
+    // log1p(2|x| / (1 - |x|)) / 2
+    v2sd tmp = _mm_div_pd(_mm_add_pd(xabs, xabs), _mm_sub_pd(*(v2sd *) _pd_1, xabs));
+    v2sd y = _mm_mul_pd(log1p_pd(tmp), *(v2sd *) _pd_0p5);
+    return _mm_xor_pd(y, sign);
+}
+
+static inline v2sd cbrt_pd(v2sd x)
+{
+    v2sd xabs = _mm_and_pd(x, *(v2sd *) _pd_positive_mask);
+    v2sd sign = _mm_and_pd(x, *(v2sd *) _pd_negative_mask);
+
+    // denormals are scaled by 2^54 to get a usable exponent
+    v2sd m_denorm = _mm_cmplt_pd(xabs, *(v2sd *) _pd_dbl_min);
+    v2sd xscaled = _mm_mul_pd(xabs, *(v2sd *) _pd_two54);
+    v2sd xnorm = _mm_blendv_pd(xabs, xscaled, m_denorm);
+
+    // |x| = m 2^(3q + r), m in [1, 2), r in {0, 1, 2}
+    v2sd e = _mm_castsi128_pd(_mm_srli_epi64(_mm_castpd_si128(xnorm), 52));
+    e = _mm_sub_pd(_mm_or_pd(e, *(v2sd *) _pd_two52), *(v2sd *) _pd_two52);
+    e = _mm_sub_pd(e, *(v2sd *) _pd_1023);
+    v2sd e54 = _mm_sub_pd(e, *(v2sd *) _pd_54);
+    e = _mm_blendv_pd(e, e54, m_denorm);
+    v2sd q = _mm_round_pd(_mm_div_pd(e, *(v2sd *) _pd_3), ROUNDTOFLOOR);
+    v2sd r = _mm_sub_pd(e, _mm_mul_pd(q, *(v2sd *) _pd_3));
+    v2sd m = _mm_or_pd(_mm_and_pd(xnorm, *(v2sd *) _pd_mant_mask), *(v2sd *) _pd_1);
+    v2sd pow2r = _mm_add_pd(_mm_add_pd(r, *(v2sd *) _pd_1023), *(v2sd *) _pd_two52);
+    pow2r = _mm_castsi128_pd(_mm_slli_epi64(_mm_castpd_si128(pow2r), 52));
+    m = _mm_mul_pd(m, pow2r);  // in [1, 8)
+
+    // quadratic guess, two Halley iterations y (y^3 + 2m) / (2y^3 + m) and a Newton iteration
+    v2sd y = _mm_fmadd_pd_custom(_mm_fmadd_pd_custom(m, *(v2sd *) _pd_cbrt_c2, *(v2sd *) _pd_cbrt_c1), m, *(v2sd *) _pd_cbrt_c0);
+    v2sd y3 = _mm_mul_pd(_mm_mul_pd(y, y), y);
+    y = _mm_mul_pd(y, _mm_div_pd(_mm_add_pd(y3, _mm_add_pd(m, m)), _mm_fmadd_pd_custom(y3, *(v2sd *) _pd_2, m)));
+    y3 = _mm_mul_pd(_mm_mul_pd(y, y), y);
+    y = _mm_mul_pd(y, _mm_div_pd(_mm_add_pd(y3, _mm_add_pd(m, m)), _mm_fmadd_pd_custom(y3, *(v2sd *) _pd_2, m)));
+    v2sd y2 = _mm_mul_pd(y, y);
+    y = _mm_sub_pd(y, _mm_div_pd(_mm_sub_pd(_mm_mul_pd(y2, y), m), _mm_mul_pd(y2, *(v2sd *) _pd_3)));
+
+    // 2^q, q >= -360 so it is a normal number
+    v2sd pow2q = _mm_add_pd(_mm_add_pd(q, *(v2sd *) _pd_1023), *(v2sd *) _pd_two52);
+    pow2q = _mm_castsi128_pd(_mm_slli_epi64(_mm_castpd_si128(pow2q), 52));
+    y = _mm_or_pd(_mm_mul_pd(y, pow2q), sign);
+
+    // cbrt(x) = x for 0, inf and NaN
+    v2sd m_zero = _mm_cmpeq_pd(xabs, _mm_setzero_pd());
+    v2sd m_notfinite = _mm_cmpnle_pd(xabs, *(v2sd *) _pd_dbl_max);
+    y = _mm_blendv_pd(y, x, m_zero);
+    return _mm_blendv_pd(y, x, m_notfinite);
+}
+
+static inline v2sd acos_pd(v2sd x)
+{
+    v2sd xabs = _mm_and_pd(x, *(v2sd *) _pd_positive_mask);
+    v2sd m_large = _mm_cmpgt_pd(xabs, *(v2sd *) _pd_0p5);
+    v2sd m_neg = _mm_cmplt_pd(x, _mm_setzero_pd());
+
+    // |x| > 0.5 : acos(|x|) = 2 asin(sqrt((1 - |x|) / 2)), else acos(x) = PI/2 - asin(x)
+    v2sd s = _mm_sqrt_pd(_mm_mul_pd(_mm_sub_pd(*(v2sd *) _pd_1, xabs), *(v2sd *) _pd_0p5));
+    v2sd a = asin_pd(_mm_blendv_pd(x, s, m_large));
+    v2sd small = _mm_sub_pd(*(v2sd *) _pd_PIO2F, _mm_sub_pd(a, *(v2sd *) _pd_PIO2_lo));
+    v2sd large = _mm_add_pd(a, a);
+    v2sd large_neg = _mm_sub_pd(*(v2sd *) _pd_PIF, _mm_sub_pd(large, *(v2sd *) _pd_PI_lo));  // acos(x) = PI - acos(-x)
+    large = _mm_blendv_pd(large, large_neg, m_neg);
+    return _mm_blendv_pd(small, large, m_large);
+}
+
+// 1 / (1 + exp(-x)), exp(-x) being clamped to the range of exp256_pd
+static inline v2sd sigmoid_pd(v2sd x)
+{
+    v2sd minus_x = _mm_xor_pd(x, *(v2sd *) _pd_negative_mask);
+    minus_x = _mm_max_pd(*(v2sd *) _pd_exp_min, minus_x);  // NaN is returned by the second operand
+    minus_x = _mm_min_pd(*(v2sd *) _pd_exp_max, minus_x);
+    return _mm_div_pd(*(v2sd *) _pd_1, _mm_add_pd(*(v2sd *) _pd_1, exp_pd(minus_x)));
+}
+
+SIMD_UTILS_API void log2128d(double *src, double *dst, int len)
+{
+    int stop_len = len / SSE_LEN_DOUBLE;
+    stop_len *= SSE_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_stream_pd(dst + i, log2_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_store_pd(dst + i, log2_pd(src_tmp));
+            }
         }
     } else {
-        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
-            v2sdx2 x_tmp = _mm_load2u_pd((double const *) (x) + i);
-            v2sdx2 y_tmp = _mm_load2u_pd((double const *) (y) + i);
-            v2sd x_tmp_re2 = _mm_mul_pd(x_tmp.val[0], x_tmp.val[0]);
-            v2sd modx = _mm_fmadd_pd_custom(x_tmp.val[1], x_tmp.val[1], x_tmp_re2);
-			modx = _mm_sqrt_pd(modx);
-			v2sdx2 logx;
-			logx.val[0] = log_pd(modx);
-			logx.val[1] = atan2_pd(x_tmp.val[1], x_tmp.val[0]);
-			v2sdx2 ylogx;
-            v2sd ac = _mm_mul_pd(logx.val[0], y_tmp.val[0]);     // ac
-            v2sd ad = _mm_mul_pd(logx.val[0], y_tmp.val[1]);     // ad
-            ylogx.val[0] = _mm_fnmadd_pd_custom(logx.val[1], y_tmp.val[1], ac);
-            ylogx.val[1] = _mm_fmadd_pd_custom(logx.val[1], y_tmp.val[0], ad);
-			v2sd ex = exp_pd(ylogx.val[0]);
-			v2sd cosylogx, sinylogx;
-			sincos_pd(ylogx.val[1], &sinylogx, &cosylogx);
-			v2sdx2 dst_tmp;
-			dst_tmp.val[0] = _mm_mul_pd(ex,cosylogx);
-			dst_tmp.val[1] = _mm_mul_pd(ex,sinylogx);
-            _mm_store2u_pd((double*)(dst) + i, dst_tmp);
+        for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+            v2sd src_tmp = _mm_loadu_pd(src + i);
+            _mm_storeu_pd(dst + i, log2_pd(src_tmp));
         }
     }
 
     for (int i = stop_len; i < len; i++) {
-		double x_tmp_re2 = x[i].re * x[i].re;
-		double modx = (x[i].im * x[i].im) + x_tmp_re2;
-		modx = sqrt(modx);
-		complex64_t logx;
-		logx.re = log(modx);
-		logx.im = atan2(x[i].im, x[i].re);
-		complex64_t ylogx;
-		double ac = logx.re * y[i].re;     // ac
-		double ad = logx.re * y[i].im;     // ad
-		ylogx.re = ac - (logx.im * y[i].im);
-		ylogx.im = (logx.im *  y[i].re) +  ad;
-		double ex = exp(ylogx.re);
-		double cosylogx, sinylogx;
-        sinylogx = sin(ylogx.im);	
-        cosylogx = cos(ylogx.im);		
-		dst[i].re = ex * cosylogx;
-		dst[i].im = ex * sinylogx;
+        dst[i] = log2(src[i]);
+    }
+}
+
+SIMD_UTILS_API void log10128d(double *src, double *dst, int len)
+{
+    int stop_len = len / SSE_LEN_DOUBLE;
+    stop_len *= SSE_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_stream_pd(dst + i, log10_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_store_pd(dst + i, log10_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+            v2sd src_tmp = _mm_loadu_pd(src + i);
+            _mm_storeu_pd(dst + i, log10_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = log10(src[i]);
+    }
+}
+
+SIMD_UTILS_API void sinh128d(double *src, double *dst, int len)
+{
+    int stop_len = len / SSE_LEN_DOUBLE;
+    stop_len *= SSE_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_stream_pd(dst + i, sinh_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_store_pd(dst + i, sinh_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+            v2sd src_tmp = _mm_loadu_pd(src + i);
+            _mm_storeu_pd(dst + i, sinh_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = sinh(src[i]);
+    }
+}
+
+SIMD_UTILS_API void cosh128d(double *src, double *dst, int len)
+{
+    int stop_len = len / SSE_LEN_DOUBLE;
+    stop_len *= SSE_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_stream_pd(dst + i, cosh_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_store_pd(dst + i, cosh_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+            v2sd src_tmp = _mm_loadu_pd(src + i);
+            _mm_storeu_pd(dst + i, cosh_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = cosh(src[i]);
+    }
+}
+
+SIMD_UTILS_API void tanh128d(double *src, double *dst, int len)
+{
+    int stop_len = len / SSE_LEN_DOUBLE;
+    stop_len *= SSE_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_stream_pd(dst + i, tanh_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_store_pd(dst + i, tanh_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+            v2sd src_tmp = _mm_loadu_pd(src + i);
+            _mm_storeu_pd(dst + i, tanh_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = tanh(src[i]);
     }
-}
\ No newline at end of file
+}
+
+SIMD_UTILS_API void asinh128d(double *src, double *dst, int len)
+{
+    int stop_len = len / SSE_LEN_DOUBLE;
+    stop_len *= SSE_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_stream_pd(dst + i, asinh_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_store_pd(dst + i, asinh_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+            v2sd src_tmp = _mm_loadu_pd(src + i);
+            _mm_storeu_pd(dst + i, asinh_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = asinh(src[i]);
+    }
+}
+
+SIMD_UTILS_API void acosh128d(double *src, double *dst, int len)
+{
+    int stop_len = len / SSE_LEN_DOUBLE;
+    stop_len *= SSE_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_stream_pd(dst + i, acosh_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_store_pd(dst + i, acosh_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+            v2sd src_tmp = _mm_loadu_pd(src + i);
+            _mm_storeu_pd(dst + i, acosh_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = acosh(src[i]);
+    }
+}
+
+SIMD_UTILS_API void atanh128d(double *src, double *dst, int len)
+{
+    int stop_len = len / SSE_LEN_DOUBLE;
+    stop_len *= SSE_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_stream_pd(dst + i, atanh_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_store_pd(dst + i, atanh_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+            v2sd src_tmp = _mm_loadu_pd(src + i);
+            _mm_storeu_pd(dst + i, atanh_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = atanh(src[i]);
+    }
+}
+
+SIMD_UTILS_API void cbrt128d(double *src, double *dst, int len)
+{
+    int stop_len = len / SSE_LEN_DOUBLE;
+    stop_len *= SSE_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_stream_pd(dst + i, cbrt_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_store_pd(dst + i, cbrt_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+            v2sd src_tmp = _mm_loadu_pd(src + i);
+            _mm_storeu_pd(dst + i, cbrt_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = cbrt(src[i]);
+    }
+}
+
+SIMD_UTILS_API void acos128d(double *src, double *dst, int len)
+{
+    int stop_len = len / SSE_LEN_DOUBLE;
+    stop_len *= SSE_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_stream_pd(dst + i, acos_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_store_pd(dst + i, acos_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+            v2sd src_tmp = _mm_loadu_pd(src + i);
+            _mm_storeu_pd(dst + i, acos_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = acos(src[i]);
+    }
+}
+
+SIMD_UTILS_API void sigmoid128d(double *src, double *dst, int len)
+{
+    int stop_len = len / SSE_LEN_DOUBLE;
+    stop_len *= SSE_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(double))) {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_stream_pd(dst + i, sigmoid_pd(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+                v2sd src_tmp = _mm_load_pd(src + i);
+                _mm_store_pd(dst + i, sigmoid_pd(src_tmp));
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+            v2sd src_tmp = _mm_loadu_pd(src + i);
+            _mm_storeu_pd(dst + i, sigmoid_pd(src_tmp));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = 1.0 / (1.0 + exp(-src[i]));
+    }
+}
+
+SIMD_UTILS_API void powcplx128d(complex64_t *x, complex64_t *y, complex64_t *dst, int len)
+{
+    int stop_len = len / (2* SSE_LEN_DOUBLE);
+    stop_len *= ( 2*SSE_LEN_DOUBLE);
+
+    if (areAligned3((uintptr_t) (x), (uintptr_t) (y), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < 2 * stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sdx2 x_tmp = _mm_load2_pd((double const *) (x) + i);
+            v2sdx2 y_tmp = _mm_load2_pd((double const *) (y) + i);
+            v2sd x_tmp_re2 = _mm_mul_pd(x_tmp.val[0], x_tmp.val[0]);
+            v2sd modx = _mm_fmadd_pd_custom(x_tmp.val[1], x_tmp.val[1], x_tmp_re2);
+			modx = _mm_sqrt_pd(modx);
+			v2sdx2 logx;
+			logx.val[0] = log_pd(modx);
+			logx.val[1] = atan2_pd(x_tmp.val[1], x_tmp.val[0]);
+			v2sdx2 ylogx;
+            v2sd ac = _mm_mul_pd(logx.val[0], y_tmp.val[0]);     // ac
+            v2sd ad = _mm_mul_pd(logx.val[0], y_tmp.val[1]);     // ad
+            ylogx.val[0] = _mm_fnmadd_pd_custom(logx.val[1], y_tmp.val[1], ac);
+            ylogx.val[1] = _mm_fmadd_pd_custom(logx.val[1], y_tmp.val[0], ad);
+			v2sd ex = exp_pd(ylogx.val[0]);
+			v2sd cosylogx, sinylogx;
+			sincos_pd(ylogx.val[1], &sinylogx, &cosylogx);
+			v2sdx2 dst_tmp;
+			dst_tmp.val[0] = _mm_mul_pd(ex,cosylogx);
+			dst_tmp.val[1] = _mm_mul_pd(ex,sinylogx);
+            _mm_store2_pd((double*)(dst) + i, dst_tmp);
+        }
+    } else {
+        for (int i = 0; i < 2 * stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sdx2 x_tmp = _mm_load2u_pd((double const *) (x) + i);
+            v2sdx2 y_tmp = _mm_load2u_pd((double const *) (y) + i);
+            v2sd x_tmp_re2 = _mm_mul_pd(x_tmp.val[0], x_tmp.val[0]);
+            v2sd modx = _mm_fmadd_pd_custom(x_tmp.val[1], x_tmp.val[1], x_tmp_re2);
+			modx = _mm_sqrt_pd(modx);
+			v2sdx2 logx;
+			logx.val[0] = log_pd(modx);
+			logx.val[1] = atan2_pd(x_tmp.val[1], x_tmp.val[0]);
+			v2sdx2 ylogx;
+            v2sd ac = _mm_mul_pd(logx.val[0], y_tmp.val[0]);     // ac
+            v2sd ad = _mm_mul_pd(logx.val[0], y_tmp.val[1]);     // ad
+            ylogx.val[0] = _mm_fnmadd_pd_custom(logx.val[1], y_tmp.val[1], ac);
+            ylogx.val[1] = _mm_fmadd_pd_custom(logx.val[1], y_tmp.val[0], ad);
+			v2sd ex = exp_pd(ylogx.val[0]);
+			v2sd cosylogx, sinylogx;
+			sincos_pd(ylogx.val[1], &sinylogx, &cosylogx);
+			v2sdx2 dst_tmp;
+			dst_tmp.val[0] = _mm_mul_pd(ex,cosylogx);
+			dst_tmp.val[1] = _mm_mul_pd(ex,sinylogx);
+            _mm_store2u_pd((double*)(dst) + i, dst_tmp);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+		double x_tmp_re2 = x[i].re * x[i].re;
+		double modx = (x[i].im * x[i].im) + x_tmp_re2;
+		modx = sqrt(modx);
+		complex64_t logx;
+		logx.re = log(modx);
+		logx.im = atan2(x[i].im, x[i].re);
+		complex64_t ylogx;
+		double ac = logx.re * y[i].re;     // ac
+		double ad = logx.re * y[i].im;     // ad
+		ylogx.re = ac - (logx.im * y[i].im);
+		ylogx.im = (logx.im *  y[i].re) +  ad;
+		double ex = exp(ylogx.re);
+		double cosylogx, sinylogx;
+        sinylogx = sin(ylogx.im);	
+        cosylogx = cos(ylogx.im);		
+		dst[i].re = ex * cosylogx;
+		dst[i].im = ex * sinylogx;
+    }
+}
+
+/* FFT (see simd_utils_fft.h) */
+
+// radix-4 butterfly on SSE_LEN_DOUBLE points x[idx + r*n4], y = Y0re, Y0im, w1*Y1re, w1*Y1im, ...
+static inline void fft_radix4_128d(const double *xr, const double *xi, int idx, int n4, const v2sd *w, v2sd *y)
+{
+    v2sd ar = _mm_loadu_pd(xr + idx), ai = _mm_loadu_pd(xi + idx);
+    v2sd br = _mm_loadu_pd(xr + idx + n4), bi = _mm_loadu_pd(xi + idx + n4);
+    v2sd cr = _mm_loadu_pd(xr + idx + 2 * n4), ci = _mm_loadu_pd(xi + idx + 2 * n4);
+    v2sd dr = _mm_loadu_pd(xr + idx + 3 * n4), di = _mm_loadu_pd(xi + idx + 3 * n4);
+    v2sd apcr = _mm_add_pd(ar, cr), apci = _mm_add_pd(ai, ci);
+    v2sd amcr = _mm_sub_pd(ar, cr), amci = _mm_sub_pd(ai, ci);
+    v2sd bpdr = _mm_add_pd(br, dr), bpdi = _mm_add_pd(bi, di);
+    v2sd jbmdr = _mm_sub_pd(bi, di), jbmdi = _mm_sub_pd(dr, br);  // -j * (b - d)
+    v2sd t1r = _mm_add_pd(amcr, jbmdr), t1i = _mm_add_pd(amci, jbmdi);
+    v2sd t2r = _mm_sub_pd(apcr, bpdr), t2i = _mm_sub_pd(apci, bpdi);
+    v2sd t3r = _mm_sub_pd(amcr, jbmdr), t3i = _mm_sub_pd(amci, jbmdi);
+    y[0] = _mm_add_pd(apcr, bpdr);
+    y[1] = _mm_add_pd(apci, bpdi);
+    y[2] = _mm_fnmadd_pd_custom(t1i, w[1], _mm_mul_pd(t1r, w[0]));
+    y[3] = _mm_fmadd_pd_custom(t1r, w[1], _mm_mul_pd(t1i, w[0]));
+    y[4] = _mm_fnmadd_pd_custom(t2i, w[3], _mm_mul_pd(t2r, w[2]));
+    y[5] = _mm_fmadd_pd_custom(t2r, w[3], _mm_mul_pd(t2i, w[2]));
+    y[6] = _mm_fnmadd_pd_custom(t3i, w[5], _mm_mul_pd(t3r, w[4]));
+    y[7] = _mm_fmadd_pd_custom(t3r, w[5], _mm_mul_pd(t3i, w[4]));
+}
+
+// dst[4i + r] = yr[i]
+static inline void fft_store4_s1_128d(double *dst, v2sd y0, v2sd y1, v2sd y2, v2sd y3)
+{
+    _mm_storeu_pd(dst, _mm_unpacklo_pd(y0, y1));
+    _mm_storeu_pd(dst + SSE_LEN_DOUBLE, _mm_unpacklo_pd(y2, y3));
+    _mm_storeu_pd(dst + 2 * SSE_LEN_DOUBLE, _mm_unpackhi_pd(y0, y1));
+    _mm_storeu_pd(dst + 3 * SSE_LEN_DOUBLE, _mm_unpackhi_pd(y2, y3));
+}
+
+
+static inline v2sd fft_reverse128d(v2sd a)
+{
+    return _mm_shuffle_pd(a, a, 0x1);
+}
+
+static inline void fft_radix4_stage128d(const fft_plan64_t *plan, int s, const double *xr, const double *xi, double *yr, double *yi)
+{
+    int n4 = plan->n / 4;
+    v2sd w[6], y[8];
+
+    if (s >= SSE_LEN_DOUBLE) {
+        const double *tw = fft_stage_twd(plan, s);
+        for (int p = 0; p < n4 / s; p++) {
+            for (int r = 0; r < 6; r++)
+                w[r] = _mm_set1_pd(tw[6 * p + r]);
+            for (int q = 0; q < s; q += SSE_LEN_DOUBLE) {
+                int out = q + 4 * s * p;
+                fft_radix4_128d(xr, xi, q + s * p, n4, w, y);
+                for (int r = 0; r < 4; r++) {
+                    _mm_storeu_pd(yr + out + r * s, y[2 * r]);
+                    _mm_storeu_pd(yi + out + r * s, y[2 * r + 1]);
+                }
+            }
+        }
+    } else {
+        // strides smaller than a vector : twiddles per point, the 4 outputs are interleaved by chunks of s
+        const double *twx = plan->twx + ((s == 1) ? 0 : 6 * n4);
+        for (int idx = 0; idx < n4; idx += SSE_LEN_DOUBLE) {
+            for (int r = 0; r < 6; r++)
+                w[r] = _mm_loadu_pd(twx + r * n4 + idx);
+            fft_radix4_128d(xr, xi, idx, n4, w, y);
+            for (int r = 0; r < 2; r++)
+                fft_store4_s1_128d((r ? yi : yr) + 4 * idx, y[r], y[2 + r], y[4 + r], y[6 + r]);
+        }
+    }
+}
+
+// last stage when log2(n) is odd, stride n/2 and no twiddles
+static inline void fft_radix2_stage128d(int n, const double *xr, const double *xi, double *yr, double *yi)
+{
+    int n2 = n / 2;
+    for (int q = 0; q < n2; q += SSE_LEN_DOUBLE) {
+        v2sd ar = _mm_loadu_pd(xr + q), ai = _mm_loadu_pd(xi + q);
+        v2sd br = _mm_loadu_pd(xr + q + n2), bi = _mm_loadu_pd(xi + q + n2);
+        _mm_storeu_pd(yr + q, _mm_add_pd(ar, br));
+        _mm_storeu_pd(yi + q, _mm_add_pd(ai, bi));
+        _mm_storeu_pd(yr + q + n2, _mm_sub_pd(ar, br));
+        _mm_storeu_pd(yi + q + n2, _mm_sub_pd(ai, bi));
+    }
+}
+
+static inline void fft_split_core128d(const fft_plan64_t *plan, double *srcRe, double *srcIm, double *dstRe, double *dstIm)
+{
+    int n = plan->n;
+    if ((n / 4) < SSE_LEN_DOUBLE) {
+        fft_split_cored_C(plan, srcRe, srcIm, dstRe, dstIm);
+        return;
+    }
+
+    int nb_stages = plan->log2n / 2 + (plan->log2n & 1);
+    double *xr = srcRe, *xi = srcIm;
+    int s = 1;
+    for (int stage = 0; stage < nb_stages; stage++) {
+        double *yr = fft_stage_outd(plan, stage, nb_stages, dstRe);
+        double *yi = (yr == dstRe) ? dstIm : yr + n;
+        if (s < n / 2 || !(plan->log2n & 1)) {
+            fft_radix4_stage128d(plan, s, xr, xi, yr, yi);
+            s *= 4;
+        } else {
+            fft_radix2_stage128d(n, xr, xi, yr, yi);
+        }
+        xr = yr;
+        xi = yi;
+    }
+}
+
+SIMD_UTILS_API void fft128d_split(fft_plan64_t *plan, double *srcRe, double *srcIm, double *dstRe, double *dstIm)
+{
+    fft_split_core128d(plan, srcRe, srcIm, dstRe, dstIm);
+}
+
+SIMD_UTILS_API void ifft128d_split(fft_plan64_t *plan, double *srcRe, double *srcIm, double *dstRe, double *dstIm)
+{
+    fft_split_core128d(plan, srcIm, srcRe, dstIm, dstRe);
+}
+
+SIMD_UTILS_API void fft128d(fft_plan64_t *plan, complex64_t *src, complex64_t *dst)
+{
+    double *re = plan->work + 4 * plan->n;
+    double *im = re + plan->n;
+    cplxtoreal128d(src, re, im, plan->n);
+    fft_split_core128d(plan, re, im, re, im);
+    realtocplx128d(re, im, dst, plan->n);
+}
+
+SIMD_UTILS_API void ifft128d(fft_plan64_t *plan, complex64_t *src, complex64_t *dst)
+{
+    double *re = plan->work + 4 * plan->n;
+    double *im = re + plan->n;
+    cplxtoreal128d(src, re, im, plan->n);
+    fft_split_core128d(plan, im, re, im, re);
+    realtocplx128d(re, im, dst, plan->n);
+}
+
+// src has plan->real_n points, dst the plan->real_n / 2 + 1 first bins
+SIMD_UTILS_API void rfft128d(fft_plan64_t *plan, double *src, complex64_t *dst)
+{
+    int n = plan->n;
+    double *re = plan->work + 4 * n;
+    double *im = re + n;
+    cplxtoreal128d((complex64_t *) src, re, im, n);
+    fft_split_core128d(plan, re, im, re, im);
+
+    v2sd half = _mm_set1_pd(0.5);
+    int k = 1;
+    for (; (k + SSE_LEN_DOUBLE) <= n; k += SSE_LEN_DOUBLE) {
+        v2sd a = _mm_loadu_pd(re + k), b = _mm_loadu_pd(im + k);
+        v2sd c = fft_reverse128d(_mm_loadu_pd(re + n - k - SSE_LEN_DOUBLE + 1));
+        v2sd d = fft_reverse128d(_mm_loadu_pd(im + n - k - SSE_LEN_DOUBLE + 1));
+        v2sd wr = _mm_loadu_pd(plan->rtw + k), wi = _mm_loadu_pd(plan->rtw + n + k);
+        v2sd hs = _mm_add_pd(a, c), hd = _mm_sub_pd(b, d);
+        v2sd fr = _mm_add_pd(b, d), fi = _mm_sub_pd(c, a);
+        v2sdx2 out;
+        out.val[0] = _mm_mul_pd(half, _mm_fnmadd_pd_custom(wi, fi, _mm_fmadd_pd_custom(wr, fr, hs)));
+        out.val[1] = _mm_mul_pd(half, _mm_fmadd_pd_custom(wi, fr, _mm_fmadd_pd_custom(wr, fi, hd)));
+        _mm_store2u_pd((double *) (dst + k), out);
+    }
+    rfft_postd_C(plan, re, im, dst, k);
+}
+
+// src has the plan->real_n / 2 + 1 first bins, dst plan->real_n points, not normalized
+SIMD_UTILS_API void irfft128d(fft_plan64_t *plan, complex64_t *src, double *dst)
+{
+    int n = plan->n;
+    double *re = plan->work + 4 * n;
+    double *im = re + n;
+
+    int k = 0;
+    for (; (k + SSE_LEN_DOUBLE) <= n; k += SSE_LEN_DOUBLE) {
+        v2sdx2 x = _mm_load2u_pd((double *) (src + k));
+        v2sdx2 xc = _mm_load2u_pd((double *) (src + n - k - SSE_LEN_DOUBLE + 1));
+        v2sd c = fft_reverse128d(xc.val[0]), d = fft_reverse128d(xc.val[1]);
+        v2sd wr = _mm_loadu_pd(plan->rtw + k), wi = _mm_loadu_pd(plan->rtw + n + k);
+        v2sd amc = _mm_sub_pd(x.val[0], c), bpd = _mm_add_pd(x.val[1], d);
+        v2sd zr = _mm_fnmadd_pd_custom(bpd, wr, _mm_add_pd(x.val[0], c));
+        v2sd zi = _mm_fmadd_pd_custom(amc, wr, _mm_sub_pd(x.val[1], d));
+        _mm_storeu_pd(re + k, _mm_fmadd_pd_custom(amc, wi, zr));
+        _mm_storeu_pd(im + k, _mm_fmadd_pd_custom(bpd, wi, zi));
+    }
+    irfft_pred_C(plan, src, re, im, k);
+
+    fft_split_core128d(plan, im, re, im, re);
+    realtocplx128d(re, im, (complex64_t *) dst, n);
+}
+
+/* FIR kernel and convolutions (see simd_utils_fir.h and simd_utils_conv.h) */
+
+// dst[i] = (dst[i] if accumulate) + sum_m taps[m] * src[i + m], 8 vectors of outputs per pass on the taps
+static inline void fir_kernel128d(const double *taps, int nb_taps, const double *src, double *dst, int len, int accumulate)
+{
+    int i = 0;
+    for (; (i + 8 * SSE_LEN_DOUBLE) <= len; i += 8 * SSE_LEN_DOUBLE) {
+        v2sd acc[8];
+        for (int k = 0; k < 8; k++)
+            acc[k] = accumulate ? _mm_loadu_pd(dst + i + k * SSE_LEN_DOUBLE) : _mm_setzero_pd();
+        const double *s = src + i;
+        for (int m = 0; m < nb_taps; m++) {
+            v2sd tap = _mm_set1_pd(taps[m]);
+            acc[0] = _mm_fmadd_pd_custom(tap, _mm_loadu_pd(s + m), acc[0]);
+            acc[1] = _mm_fmadd_pd_custom(tap, _mm_loadu_pd(s + m + SSE_LEN_DOUBLE), acc[1]);
+            acc[2] = _mm_fmadd_pd_custom(tap, _mm_loadu_pd(s + m + 2 * SSE_LEN_DOUBLE), acc[2]);
+            acc[3] = _mm_fmadd_pd_custom(tap, _mm_loadu_pd(s + m + 3 * SSE_LEN_DOUBLE), acc[3]);
+            acc[4] = _mm_fmadd_pd_custom(tap, _mm_loadu_pd(s + m + 4 * SSE_LEN_DOUBLE), acc[4]);
+            acc[5] = _mm_fmadd_pd_custom(tap, _mm_loadu_pd(s + m + 5 * SSE_LEN_DOUBLE), acc[5]);
+            acc[6] = _mm_fmadd_pd_custom(tap, _mm_loadu_pd(s + m + 6 * SSE_LEN_DOUBLE), acc[6]);
+            acc[7] = _mm_fmadd_pd_custom(tap, _mm_loadu_pd(s + m + 7 * SSE_LEN_DOUBLE), acc[7]);
+        }
+        for (int k = 0; k < 8; k++)
+            _mm_storeu_pd(dst + i + k * SSE_LEN_DOUBLE, acc[k]);
+    }
+
+    for (; (i + SSE_LEN_DOUBLE) <= len; i += SSE_LEN_DOUBLE) {
+        v2sd acc = accumulate ? _mm_loadu_pd(dst + i) : _mm_setzero_pd();
+        for (int m = 0; m < nb_taps; m++)
+            acc = _mm_fmadd_pd_custom(_mm_set1_pd(taps[m]), _mm_loadu_pd(src + i + m), acc);
+        _mm_storeu_pd(dst + i, acc);
+    }
+
+    if (i < len)
+        fir_kerneld_C(taps, nb_taps, src + i, dst + i, len - i, accumulate);
+}
+
+SIMD_UTILS_API void cplxvecmul128d(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len)
+{
+    int stop_len = len / (SSE_LEN_DOUBLE);
+    stop_len = stop_len * SSE_LEN_DOUBLE;
+
+    int i;
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (i = 0; i < 2 * stop_len; i += SSE_LEN_DOUBLE) {
+            v2sd src1_tmp = _mm_load_pd((double *) (src1) + i);  // src1 = b0,a0 (little endian)
+            v2sd src2_tmp = _mm_load_pd((double *) (src2) + i);  // src2 = d0,c0
+            v2sd tmp1 = _mm_movedup_pd(src1_tmp);  // a0,a0
+            v2sd tmp2 = _mm_shuffle_pd(src2_tmp, src2_tmp, 1);  // c0,d0
+            v2sd tmp3 = _mm_unpackhi_pd(src1_tmp, src1_tmp);  // b0,b0
+            v2sd out = _mm_mul_pd(tmp2, tmp3);
+            out = _mm_fmaddsub_pd_custom(tmp1, src2_tmp, out);
+            _mm_store_pd((double *) (dst) + i, out);
+        }
+    } else {
+        for (i = 0; i < 2 * stop_len; i += SSE_LEN_DOUBLE) {
+            v2sd src1_tmp = _mm_loadu_pd((double *) (src1) + i);  // src1 = b0,a0 (little endian)
+            v2sd src2_tmp = _mm_loadu_pd((double *) (src2) + i);  // src2 = d0,c0
+            v2sd tmp1 = _mm_movedup_pd(src1_tmp);  // a0,a0
+            v2sd tmp2 = _mm_shuffle_pd(src2_tmp, src2_tmp, 1);  // c0,d0
+            v2sd tmp3 = _mm_unpackhi_pd(src1_tmp, src1_tmp);  // b0,b0
+            v2sd out = _mm_mul_pd(tmp2, tmp3);
+            out = _mm_fmaddsub_pd_custom(tmp1, src2_tmp, out);
+            _mm_storeu_pd((double *) (dst) + i, out);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i].re = (src1[i].re * src2[i].re) - src1[i].im * src2[i].im;
+        dst[i].im = src1[i].re * src2[i].im + (src2[i].re * src1[i].im);
+    }
+}
+
+SIMD_UTILS_API void cplxvecmul128d_split(double *src1Re, double *src1Im, double *src2Re, double *src2Im, double *dstRe, double *dstIm, int len)
+{
+    int stop_len = len / SSE_LEN_DOUBLE;
+    stop_len *= SSE_LEN_DOUBLE;
+
+    if (areAligned3((uintptr_t) (src1Re), (uintptr_t) (src1Im), (uintptr_t) (src2Re), SSE_LEN_BYTES) &&
+        areAligned3((uintptr_t) (src2Im), (uintptr_t) (dstRe), (uintptr_t) (dstIm), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+            v2sd src1Re_tmp = _mm_load_pd(src1Re + i);
+            v2sd src1Im_tmp = _mm_load_pd(src1Im + i);
+            v2sd src2Re_tmp = _mm_load_pd(src2Re + i);
+            v2sd src2Im_tmp = _mm_load_pd(src2Im + i);
+            v2sd bc = _mm_mul_pd(src1Im_tmp, src2Re_tmp);
+            v2sd ac = _mm_mul_pd(src1Re_tmp, src2Re_tmp);
+            v2sd dstRe_tmp = _mm_fnmadd_pd_custom(src1Im_tmp, src2Im_tmp, ac);  // ac - bd
+            v2sd dstIm_tmp = _mm_fmadd_pd_custom(src1Re_tmp, src2Im_tmp, bc);   // ad + bc
+            _mm_store_pd(dstRe + i, dstRe_tmp);
+            _mm_store_pd(dstIm + i, dstIm_tmp);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+            v2sd src1Re_tmp = _mm_loadu_pd(src1Re + i);
+            v2sd src1Im_tmp = _mm_loadu_pd(src1Im + i);
+            v2sd src2Re_tmp = _mm_loadu_pd(src2Re + i);
+            v2sd src2Im_tmp = _mm_loadu_pd(src2Im + i);
+            v2sd bc = _mm_mul_pd(src1Im_tmp, src2Re_tmp);
+            v2sd ac = _mm_mul_pd(src1Re_tmp, src2Re_tmp);
+            v2sd dstRe_tmp = _mm_fnmadd_pd_custom(src1Im_tmp, src2Im_tmp, ac);  // ac - bd
+            v2sd dstIm_tmp = _mm_fmadd_pd_custom(src1Re_tmp, src2Im_tmp, bc);   // ad + bc
+            _mm_storeu_pd(dstRe + i, dstRe_tmp);
+            _mm_storeu_pd(dstIm + i, dstIm_tmp);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dstRe[i] = src1Re[i] * src2Re[i] - src1Im[i] * src2Im[i];
+        dstIm[i] = src1Re[i] * src2Im[i] + src2Re[i] * src1Im[i];
+    }
+}
+
+SIMD_UTILS_API void cplxconjvecmul128d(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len)
+{
+    int stop_len = len / (SSE_LEN_DOUBLE);
+    stop_len = stop_len * SSE_LEN_DOUBLE;
+
+    int i;
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (i = 0; i < 2 * stop_len; i += SSE_LEN_DOUBLE) {
+            v2sd src1_tmp = _mm_load_pd((double *) (src1) + i);  // src1 = b0,a0 (little endian)
+            v2sd src2_tmp = _mm_load_pd((double *) (src2) + i);  // src2 = d0,c0
+            v2sd tmp1 = _mm_movedup_pd(src1_tmp);          // a0,a0
+            v2sd tmp2 = _mm_mul_pd(tmp1, src2_tmp);  // a0d0,a0c0
+            v2sd tmp3 = _mm_shuffle_pd(src2_tmp, src2_tmp, 1);           // c0,d0
+            v2sd tmp4 = _mm_unpackhi_pd(src1_tmp, src1_tmp);          // b0,b0
+            v2sd out = _mm_fmsubadd_pd_custom(tmp3, tmp4, tmp2);  // b0c0 - a0d0, a0c0 + b0d0
+            _mm_store_pd((double *) (dst) + i, out);
+        }
+    } else {
+        for (i = 0; i < 2 * stop_len; i += SSE_LEN_DOUBLE) {
+            v2sd src1_tmp = _mm_loadu_pd((double *) (src1) + i);  // src1 = b0,a0 (little endian)
+            v2sd src2_tmp = _mm_loadu_pd((double *) (src2) + i);  // src2 = d0,c0
+            v2sd tmp1 = _mm_movedup_pd(src1_tmp);          // a0,a0
+            v2sd tmp2 = _mm_mul_pd(tmp1, src2_tmp);  // a0d0,a0c0
+            v2sd tmp3 = _mm_shuffle_pd(src2_tmp, src2_tmp, 1);           // c0,d0
+            v2sd tmp4 = _mm_unpackhi_pd(src1_tmp, src1_tmp);          // b0,b0
+            v2sd out = _mm_fmsubadd_pd_custom(tmp3, tmp4, tmp2);  // b0c0 - a0d0, a0c0 + b0d0
+            _mm_storeu_pd((double *) (dst) + i, out);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i].re = src1[i].re * src2[i].re + src1[i].im * src2[i].im;
+        dst[i].im = src2[i].re * src1[i].im - src1[i].re * src2[i].im;
+    }
+}
+
+SIMD_UTILS_API void cplxconjvecmul128d_split(double *src1Re, double *src1Im, double *src2Re, double *src2Im, double *dstRe, double *dstIm, int len)
+{
+    int stop_len = len / SSE_LEN_DOUBLE;
+    stop_len *= SSE_LEN_DOUBLE;
+
+    if (areAligned3((uintptr_t) (src1Re), (uintptr_t) (src1Im), (uintptr_t) (src2Re), SSE_LEN_BYTES) &&
+        areAligned3((uintptr_t) (src2Im), (uintptr_t) (dstRe), (uintptr_t) (dstIm), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+            v2sd src1Re_tmp = _mm_load_pd(src1Re + i);
+            v2sd src1Im_tmp = _mm_load_pd(src1Im + i);
+            v2sd src2Re_tmp = _mm_load_pd(src2Re + i);
+            v2sd src2Im_tmp = _mm_load_pd(src2Im + i);
+            v2sd bc = _mm_mul_pd(src1Im_tmp, src2Re_tmp);
+            v2sd ac = _mm_mul_pd(src1Re_tmp, src2Re_tmp);
+            v2sd dstRe_tmp = _mm_fmadd_pd_custom(src1Im_tmp, src2Im_tmp, ac);   // ac + bd
+            v2sd dstIm_tmp = _mm_fnmadd_pd_custom(src1Re_tmp, src2Im_tmp, bc);  // bc - ad
+            _mm_store_pd(dstRe + i, dstRe_tmp);
+            _mm_store_pd(dstIm + i, dstIm_tmp);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+            v2sd src1Re_tmp = _mm_loadu_pd(src1Re + i);
+            v2sd src1Im_tmp = _mm_loadu_pd(src1Im + i);
+            v2sd src2Re_tmp = _mm_loadu_pd(src2Re + i);
+            v2sd src2Im_tmp = _mm_loadu_pd(src2Im + i);
+            v2sd bc = _mm_mul_pd(src1Im_tmp, src2Re_tmp);
+            v2sd ac = _mm_mul_pd(src1Re_tmp, src2Re_tmp);
+            v2sd dstRe_tmp = _mm_fmadd_pd_custom(src1Im_tmp, src2Im_tmp, ac);   // ac + bd
+            v2sd dstIm_tmp = _mm_fnmadd_pd_custom(src1Re_tmp, src2Im_tmp, bc);  // bc - ad
+            _mm_storeu_pd(dstRe + i, dstRe_tmp);
+            _mm_storeu_pd(dstIm + i, dstIm_tmp);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dstRe[i] = src1Re[i] * src2Re[i] + src1Im[i] * src2Im[i];
+        dstIm[i] = src2Re[i] * src1Im[i] - src1Re[i] * src2Im[i];
+    }
+}
+
+SIMD_UTILS_API void cplxvecdiv128d(complex64_t *src1, complex64_t *src2, complex64_t *dst, int len)
+{
+    int stop_len = len / (SSE_LEN_DOUBLE);
+    stop_len = stop_len * SSE_LEN_DOUBLE;
+
+    int i;
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (i = 0; i < 2 * stop_len; i += SSE_LEN_DOUBLE) {
+            v2sd src1_tmp = _mm_load_pd((double *) (src1) + i);  // src1 = b0,a0 (little endian)
+            v2sd src2_tmp = _mm_load_pd((double *) (src2) + i);  // src2 = d0,c0
+            v2sd tmp1 = _mm_movedup_pd(src1_tmp);          // a0,a0
+            v2sd tmp2 = _mm_mul_pd(tmp1, src2_tmp);  // a0d0,a0c0
+            v2sd tmp3 = _mm_shuffle_pd(src2_tmp, src2_tmp, 1);           // c0,d0
+            v2sd tmp4 = _mm_unpackhi_pd(src1_tmp, src1_tmp);          // b0,b0
+            v2sd out = _mm_fmsubadd_pd_custom(tmp3, tmp4, tmp2);  // b0c0 - a0d0, a0c0 + b0d0
+            v2sd c2d2 = _mm_mul_pd(src2_tmp, src2_tmp);
+            c2d2 = _mm_add_pd(c2d2, _mm_shuffle_pd(c2d2, c2d2, 1));  // c0^2 + d0^2, c0^2 + d0^2
+            out = _mm_div_pd(out, c2d2);
+            _mm_store_pd((double *) (dst) + i, out);
+        }
+    } else {
+        for (i = 0; i < 2 * stop_len; i += SSE_LEN_DOUBLE) {
+            v2sd src1_tmp = _mm_loadu_pd((double *) (src1) + i);  // src1 = b0,a0 (little endian)
+            v2sd src2_tmp = _mm_loadu_pd((double *) (src2) + i);  // src2 = d0,c0
+            v2sd tmp1 = _mm_movedup_pd(src1_tmp);          // a0,a0
+            v2sd tmp2 = _mm_mul_pd(tmp1, src2_tmp);  // a0d0,a0c0
+            v2sd tmp3 = _mm_shuffle_pd(src2_tmp, src2_tmp, 1);           // c0,d0
+            v2sd tmp4 = _mm_unpackhi_pd(src1_tmp, src1_tmp);          // b0,b0
+            v2sd out = _mm_fmsubadd_pd_custom(tmp3, tmp4, tmp2);  // b0c0 - a0d0, a0c0 + b0d0
+            v2sd c2d2 = _mm_mul_pd(src2_tmp, src2_tmp);
+            c2d2 = _mm_add_pd(c2d2, _mm_shuffle_pd(c2d2, c2d2, 1));  // c0^2 + d0^2, c0^2 + d0^2
+            out = _mm_div_pd(out, c2d2);
+            _mm_storeu_pd((double *) (dst) + i, out);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        double c2d2 = src2[i].re * src2[i].re + src2[i].im * src2[i].im;
+        dst[i].re = (src1[i].re * src2[i].re + src1[i].im * src2[i].im) / c2d2;
+        dst[i].im = (src2[i].re * src1[i].im - src1[i].re * src2[i].im) / c2d2;
+    }
+}
+
+SIMD_UTILS_API void cplxvecdiv128d_split(double *src1Re, double *src1Im, double *src2Re, double *src2Im, double *dstRe, double *dstIm, int len)
+{
+    int stop_len = len / SSE_LEN_DOUBLE;
+    stop_len *= SSE_LEN_DOUBLE;
+
+    if (areAligned3((uintptr_t) (src1Re), (uintptr_t) (src1Im), (uintptr_t) (src2Re), SSE_LEN_BYTES) &&
+        areAligned3((uintptr_t) (src2Im), (uintptr_t) (dstRe), (uintptr_t) (dstIm), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+            v2sd src1Re_tmp = _mm_load_pd(src1Re + i);
+            v2sd src1Im_tmp = _mm_load_pd(src1Im + i);
+            v2sd src2Re_tmp = _mm_load_pd(src2Re + i);
+            v2sd src2Im_tmp = _mm_load_pd(src2Im + i);
+            v2sd bc = _mm_mul_pd(src1Im_tmp, src2Re_tmp);
+            v2sd ac = _mm_mul_pd(src1Re_tmp, src2Re_tmp);
+            v2sd dstRe_tmp = _mm_fmadd_pd_custom(src1Im_tmp, src2Im_tmp, ac);   // ac + bd
+            v2sd dstIm_tmp = _mm_fnmadd_pd_custom(src1Re_tmp, src2Im_tmp, bc);  // bc - ad
+            v2sd c2d2 = _mm_fmadd_pd_custom(src2Im_tmp, src2Im_tmp, _mm_mul_pd(src2Re_tmp, src2Re_tmp));
+            dstRe_tmp = _mm_div_pd(dstRe_tmp, c2d2);
+            dstIm_tmp = _mm_div_pd(dstIm_tmp, c2d2);
+            _mm_store_pd(dstRe + i, dstRe_tmp);
+            _mm_store_pd(dstIm + i, dstIm_tmp);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+            v2sd src1Re_tmp = _mm_loadu_pd(src1Re + i);
+            v2sd src1Im_tmp = _mm_loadu_pd(src1Im + i);
+            v2sd src2Re_tmp = _mm_loadu_pd(src2Re + i);
+            v2sd src2Im_tmp = _mm_loadu_pd(src2Im + i);
+            v2sd bc = _mm_mul_pd(src1Im_tmp, src2Re_tmp);
+            v2sd ac = _mm_mul_pd(src1Re_tmp, src2Re_tmp);
+            v2sd dstRe_tmp = _mm_fmadd_pd_custom(src1Im_tmp, src2Im_tmp, ac);   // ac + bd
+            v2sd dstIm_tmp = _mm_fnmadd_pd_custom(src1Re_tmp, src2Im_tmp, bc);  // bc - ad
+            v2sd c2d2 = _mm_fmadd_pd_custom(src2Im_tmp, src2Im_tmp, _mm_mul_pd(src2Re_tmp, src2Re_tmp));
+            dstRe_tmp = _mm_div_pd(dstRe_tmp, c2d2);
+            dstIm_tmp = _mm_div_pd(dstIm_tmp, c2d2);
+            _mm_storeu_pd(dstRe + i, dstRe_tmp);
+            _mm_storeu_pd(dstIm + i, dstIm_tmp);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        double c2d2 = src2Re[i] * src2Re[i] + src2Im[i] * src2Im[i];
+        dstRe[i] = (src1Re[i] * src2Re[i] + src1Im[i] * src2Im[i]) / c2d2;
+        dstIm[i] = (src2Re[i] * src1Im[i] - src1Re[i] * src2Im[i]) / c2d2;
+    }
+}
+
+// prefer using cplxconjvecmulXd if you also need to do a multiply
+SIMD_UTILS_API void cplxconj128d(complex64_t *src, complex64_t *dst, int len)
+{
+    int stop_len = len / SSE_LEN_DOUBLE;
+    stop_len *= SSE_LEN_DOUBLE;
+
+    __attribute__((aligned(SSE_LEN_BYTES))) int64_t conj_mask[SSE_LEN_DOUBLE] = {0, (int64_t) 0x8000000000000000};
+    v2sd conj_vec = _mm_load_pd((double *) conj_mask);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < 2 * stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd src_tmp = _mm_load_pd((double *) (src) + i);
+            v2sd src_tmp2 = _mm_load_pd((double *) (src) + i + SSE_LEN_DOUBLE);
+            _mm_store_pd((double *) (dst) + i, _mm_xor_pd(src_tmp, conj_vec));
+            _mm_store_pd((double *) (dst) + i + SSE_LEN_DOUBLE, _mm_xor_pd(src_tmp2, conj_vec));
+        }
+    } else {
+        for (int i = 0; i < 2 * stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd src_tmp = _mm_loadu_pd((double *) (src) + i);
+            v2sd src_tmp2 = _mm_loadu_pd((double *) (src) + i + SSE_LEN_DOUBLE);
+            _mm_storeu_pd((double *) (dst) + i, _mm_xor_pd(src_tmp, conj_vec));
+            _mm_storeu_pd((double *) (dst) + i + SSE_LEN_DOUBLE, _mm_xor_pd(src_tmp2, conj_vec));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i].re = src[i].re;
+        dst[i].im = -src[i].im;
+    }
+}
+
+SIMD_UTILS_API void magnitude128d_split(double *srcRe, double *srcIm, double *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_DOUBLE);
+    stop_len *= 2 * SSE_LEN_DOUBLE;
+
+    if (areAligned3((uintptr_t) (srcRe), (uintptr_t) (srcIm), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd re_tmp = _mm_load_pd(srcRe + i);
+            v2sd im_tmp = _mm_load_pd(srcIm + i);
+            v2sd re_tmp2 = _mm_load_pd(srcRe + i + SSE_LEN_DOUBLE);
+            v2sd im_tmp2 = _mm_load_pd(srcIm + i + SSE_LEN_DOUBLE);
+            v2sd dst_tmp = _mm_fmadd_pd_custom(im_tmp, im_tmp, _mm_mul_pd(re_tmp, re_tmp));
+            v2sd dst_tmp2 = _mm_fmadd_pd_custom(im_tmp2, im_tmp2, _mm_mul_pd(re_tmp2, re_tmp2));
+            _mm_store_pd(dst + i, _mm_sqrt_pd(dst_tmp));
+            _mm_store_pd(dst + i + SSE_LEN_DOUBLE, _mm_sqrt_pd(dst_tmp2));
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd re_tmp = _mm_loadu_pd(srcRe + i);
+            v2sd im_tmp = _mm_loadu_pd(srcIm + i);
+            v2sd re_tmp2 = _mm_loadu_pd(srcRe + i + SSE_LEN_DOUBLE);
+            v2sd im_tmp2 = _mm_loadu_pd(srcIm + i + SSE_LEN_DOUBLE);
+            v2sd dst_tmp = _mm_fmadd_pd_custom(im_tmp, im_tmp, _mm_mul_pd(re_tmp, re_tmp));
+            v2sd dst_tmp2 = _mm_fmadd_pd_custom(im_tmp2, im_tmp2, _mm_mul_pd(re_tmp2, re_tmp2));
+            _mm_storeu_pd(dst + i, _mm_sqrt_pd(dst_tmp));
+            _mm_storeu_pd(dst + i + SSE_LEN_DOUBLE, _mm_sqrt_pd(dst_tmp2));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = sqrt(srcRe[i] * srcRe[i] + srcIm[i] * srcIm[i]);
+    }
+}
+
+SIMD_UTILS_API void magnitude128d_interleaved(complex64_t *src, double *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_DOUBLE);
+    stop_len *= 2 * SSE_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sdx2 src_split = _mm_load2_pd((double *) (src + i));  // a0a1, b0b1
+            v2sdx2 src_split2 = _mm_load2_pd((double *) (src + i + SSE_LEN_DOUBLE));
+            v2sd dst_tmp = _mm_fmadd_pd_custom(src_split.val[1], src_split.val[1], _mm_mul_pd(src_split.val[0], src_split.val[0]));
+            v2sd dst_tmp2 = _mm_fmadd_pd_custom(src_split2.val[1], src_split2.val[1], _mm_mul_pd(src_split2.val[0], src_split2.val[0]));
+            _mm_store_pd(dst + i, _mm_sqrt_pd(dst_tmp));
+            _mm_store_pd(dst + i + SSE_LEN_DOUBLE, _mm_sqrt_pd(dst_tmp2));
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sdx2 src_split = _mm_load2u_pd((double *) (src + i));  // a0a1, b0b1
+            v2sdx2 src_split2 = _mm_load2u_pd((double *) (src + i + SSE_LEN_DOUBLE));
+            v2sd dst_tmp = _mm_fmadd_pd_custom(src_split.val[1], src_split.val[1], _mm_mul_pd(src_split.val[0], src_split.val[0]));
+            v2sd dst_tmp2 = _mm_fmadd_pd_custom(src_split2.val[1], src_split2.val[1], _mm_mul_pd(src_split2.val[0], src_split2.val[0]));
+            _mm_storeu_pd(dst + i, _mm_sqrt_pd(dst_tmp));
+            _mm_storeu_pd(dst + i + SSE_LEN_DOUBLE, _mm_sqrt_pd(dst_tmp2));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = sqrt(src[i].re * src[i].re + src[i].im * src[i].im);
+    }
+}
+
+SIMD_UTILS_API void powerspect128d_split(double *srcRe, double *srcIm, double *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_DOUBLE);
+    stop_len *= 2 * SSE_LEN_DOUBLE;
+
+    if (areAligned3((uintptr_t) (srcRe), (uintptr_t) (srcIm), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd re_tmp = _mm_load_pd(srcRe + i);
+            v2sd im_tmp = _mm_load_pd(srcIm + i);
+            v2sd re_tmp2 = _mm_load_pd(srcRe + i + SSE_LEN_DOUBLE);
+            v2sd im_tmp2 = _mm_load_pd(srcIm + i + SSE_LEN_DOUBLE);
+            v2sd dst_tmp = _mm_fmadd_pd_custom(im_tmp, im_tmp, _mm_mul_pd(re_tmp, re_tmp));
+            v2sd dst_tmp2 = _mm_fmadd_pd_custom(im_tmp2, im_tmp2, _mm_mul_pd(re_tmp2, re_tmp2));
+            _mm_store_pd(dst + i, dst_tmp);
+            _mm_store_pd(dst + i + SSE_LEN_DOUBLE, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd re_tmp = _mm_loadu_pd(srcRe + i);
+            v2sd im_tmp = _mm_loadu_pd(srcIm + i);
+            v2sd re_tmp2 = _mm_loadu_pd(srcRe + i + SSE_LEN_DOUBLE);
+            v2sd im_tmp2 = _mm_loadu_pd(srcIm + i + SSE_LEN_DOUBLE);
+            v2sd dst_tmp = _mm_fmadd_pd_custom(im_tmp, im_tmp, _mm_mul_pd(re_tmp, re_tmp));
+            v2sd dst_tmp2 = _mm_fmadd_pd_custom(im_tmp2, im_tmp2, _mm_mul_pd(re_tmp2, re_tmp2));
+            _mm_storeu_pd(dst + i, dst_tmp);
+            _mm_storeu_pd(dst + i + SSE_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = srcRe[i] * srcRe[i] + srcIm[i] * srcIm[i];
+    }
+}
+
+SIMD_UTILS_API void powerspect128d_interleaved(complex64_t *src, double *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_DOUBLE);
+    stop_len *= 2 * SSE_LEN_DOUBLE;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sdx2 src_split = _mm_load2_pd((double *) (src + i));  // a0a1, b0b1
+            v2sdx2 src_split2 = _mm_load2_pd((double *) (src + i + SSE_LEN_DOUBLE));
+            v2sd dst_tmp = _mm_fmadd_pd_custom(src_split.val[1], src_split.val[1], _mm_mul_pd(src_split.val[0], src_split.val[0]));
+            v2sd dst_tmp2 = _mm_fmadd_pd_custom(src_split2.val[1], src_split2.val[1], _mm_mul_pd(src_split2.val[0], src_split2.val[0]));
+            _mm_store_pd(dst + i, dst_tmp);
+            _mm_store_pd(dst + i + SSE_LEN_DOUBLE, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sdx2 src_split = _mm_load2u_pd((double *) (src + i));  // a0a1, b0b1
+            v2sdx2 src_split2 = _mm_load2u_pd((double *) (src + i + SSE_LEN_DOUBLE));
+            v2sd dst_tmp = _mm_fmadd_pd_custom(src_split.val[1], src_split.val[1], _mm_mul_pd(src_split.val[0], src_split.val[0]));
+            v2sd dst_tmp2 = _mm_fmadd_pd_custom(src_split2.val[1], src_split2.val[1], _mm_mul_pd(src_split2.val[0], src_split2.val[0]));
+            _mm_storeu_pd(dst + i, dst_tmp);
+            _mm_storeu_pd(dst + i + SSE_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src[i].re * src[i].re + src[i].im * src[i].im;
+    }
+}
+
+static inline void conv_block128d(conv64_t *conv)
+{
+    rfft128d(conv->plan, conv->buf, (complex64_t *) conv->work);
+    cplxvecmul128d((complex64_t *) conv->work, (complex64_t *) conv->spectrum, (complex64_t *) conv->out, conv->fft_len / 2 + 1);
+    irfft128d(conv->plan, (complex64_t *) conv->out, conv->out);
+}
+
+// returns len
+SIMD_UTILS_API int conv128d(conv64_t *conv, double *src, double *dst, int len)
+{
+    return conv_rund(conv, fir_kernel128d, conv_block128d, src, dst, len);
+}
+
+SIMD_UTILS_API void minmax128d(double *src, int len, double *min_value, double *max_value)
+{
+    int stop_len = (len - SSE_LEN_DOUBLE) / (2 * SSE_LEN_DOUBLE);
+    stop_len *= (2 * SSE_LEN_DOUBLE);
+    stop_len = (stop_len < 0) ? 0 : stop_len;
+
+    double min_s[SSE_LEN_DOUBLE] __attribute__((aligned(SSE_LEN_BYTES)));
+    double max_s[SSE_LEN_DOUBLE] __attribute__((aligned(SSE_LEN_BYTES)));
+    v2sd max_v, min_v, max_v2, min_v2;
+    v2sd src_tmp, src_tmp2;
+
+    double min_tmp = src[0];
+    double max_tmp = src[0];
+
+    if (len >= SSE_LEN_DOUBLE) {
+        if (isAligned((uintptr_t) (src), SSE_LEN_BYTES)) {
+            src_tmp = _mm_load_pd(src + 0);
+            max_v = src_tmp;
+            min_v = src_tmp;
+            max_v2 = src_tmp;
+            min_v2 = src_tmp;
+
+            for (int i = SSE_LEN_DOUBLE; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+                src_tmp = _mm_load_pd(src + i);
+                src_tmp2 = _mm_load_pd(src + i + SSE_LEN_DOUBLE);
+                max_v = _mm_max_pd(max_v, src_tmp);
+                min_v = _mm_min_pd(min_v, src_tmp);
+                max_v2 = _mm_max_pd(max_v2, src_tmp2);
+                min_v2 = _mm_min_pd(min_v2, src_tmp2);
+            }
+        } else {
+            src_tmp = _mm_loadu_pd(src + 0);
+            max_v = src_tmp;
+            min_v = src_tmp;
+            max_v2 = src_tmp;
+            min_v2 = src_tmp;
+
+            for (int i = SSE_LEN_DOUBLE; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+                src_tmp = _mm_loadu_pd(src + i);
+                src_tmp2 = _mm_loadu_pd(src + i + SSE_LEN_DOUBLE);
+                max_v = _mm_max_pd(max_v, src_tmp);
+                min_v = _mm_min_pd(min_v, src_tmp);
+                max_v2 = _mm_max_pd(max_v2, src_tmp2);
+                min_v2 = _mm_min_pd(min_v2, src_tmp2);
+            }
+        }
+
+        max_v = _mm_max_pd(max_v, max_v2);
+        min_v = _mm_min_pd(min_v, min_v2);
+
+        _mm_store_pd(max_s, max_v);
+        _mm_store_pd(min_s, min_v);
+
+        max_tmp = max_s[0];
+        min_tmp = min_s[0];
+        for (int i = 1; i < SSE_LEN_DOUBLE; i++) {
+            max_tmp = max_tmp > max_s[i] ? max_tmp : max_s[i];
+            min_tmp = min_tmp < min_s[i] ? min_tmp : min_s[i];
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        max_tmp = max_tmp > src[i] ? max_tmp : src[i];
+        min_tmp = min_tmp < src[i] ? min_tmp : src[i];
+    }
+
+    *max_value = max_tmp;
+    *min_value = min_tmp;
+}
+
+// exp(x - max) / sum of exp(x - max) : the largest element gives 1, so the sum cannot overflow
+SIMD_UTILS_API void softmax128d(double *src, double *dst, int len)
+{
+    int stop_len = len / SSE_LEN_DOUBLE;
+    stop_len *= SSE_LEN_DOUBLE;
+
+    __attribute__((aligned(SSE_LEN_BYTES))) double accumulate[SSE_LEN_DOUBLE];
+    double min_value, max_value, acc = 0.0;
+
+    if (len <= 0)
+        return;
+
+    minmax128d(src, len, &min_value, &max_value);
+    v2sd max_vec = _mm_set1_pd(max_value);
+    v2sd vec_acc = _mm_setzero_pd();
+
+    for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+        v2sd src_tmp = _mm_max_pd(_mm_sub_pd(_mm_loadu_pd(src + i), max_vec), *(v2sd *) _pd_exp_min);
+        v2sd dst_tmp = exp_pd(src_tmp);
+        vec_acc = _mm_add_pd(vec_acc, dst_tmp);
+        _mm_storeu_pd(dst + i, dst_tmp);
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = exp(src[i] - max_value);
+        acc += dst[i];
+    }
+    _mm_store_pd(accumulate, vec_acc);
+    for (int i = 0; i < SSE_LEN_DOUBLE; i++) {
+        acc += accumulate[i];
+    }
+
+    v2sd acc_vec = _mm_set1_pd(acc);
+    for (int i = 0; i < stop_len; i += SSE_LEN_DOUBLE) {
+        _mm_storeu_pd(dst + i, _mm_div_pd(_mm_loadu_pd(dst + i), acc_vec));
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] /= acc;
+    }
+}
+
+// first index of value in src, len if it is not found
+static inline int firsteq128d(double *src, int len, double value)
+{
+    int stop_len = len / (2 * SSE_LEN_DOUBLE);
+    stop_len *= (2 * SSE_LEN_DOUBLE);
+
+    v2sd value_v = _mm_set1_pd(value);
+    for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+        uint32_t mask = (uint32_t) _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(src + i), value_v));
+        mask |= (uint32_t) _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(src + i + SSE_LEN_DOUBLE), value_v)) << 2;
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+    for (int i = stop_len; i < len; i++) {
+        if (src[i] == value)
+            return i;
+    }
+    return len;
+}
+
+SIMD_UTILS_API void maxloc128d(double *src, double *max, int *idx, int len)
+{
+    minmaxloc_rund(src, len, minmax128d, firsteq128d, NULL, NULL, max, idx);
+}
+
+SIMD_UTILS_API void minloc128d(double *src, double *min, int *idx, int len)
+{
+    minmaxloc_rund(src, len, minmax128d, firsteq128d, min, idx, NULL, NULL);
+}
+
+SIMD_UTILS_API void minmaxloc128d(double *src, int len, double *min_value, int *min_idx, double *max_value, int *max_idx)
+{
+    minmaxloc_rund(src, len, minmax128d, firsteq128d, min_value, min_idx, max_value, max_idx);
+}
+
+SIMD_UTILS_API void maxevery128d(double *src1, double *src2, double *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_DOUBLE);
+    stop_len *= (2 * SSE_LEN_DOUBLE);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd src1_tmp = _mm_load_pd(src1 + i);
+            v2sd src2_tmp = _mm_load_pd(src2 + i);
+            v2sd src1_tmp2 = _mm_load_pd(src1 + i + SSE_LEN_DOUBLE);
+            v2sd src2_tmp2 = _mm_load_pd(src2 + i + SSE_LEN_DOUBLE);
+            v2sd dst_tmp = _mm_max_pd(src1_tmp, src2_tmp);
+            v2sd dst_tmp2 = _mm_max_pd(src1_tmp2, src2_tmp2);
+            _mm_store_pd(dst + i, dst_tmp);
+            _mm_store_pd(dst + i + SSE_LEN_DOUBLE, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd src1_tmp = _mm_loadu_pd(src1 + i);
+            v2sd src2_tmp = _mm_loadu_pd(src2 + i);
+            v2sd src1_tmp2 = _mm_loadu_pd(src1 + i + SSE_LEN_DOUBLE);
+            v2sd src2_tmp2 = _mm_loadu_pd(src2 + i + SSE_LEN_DOUBLE);
+            v2sd dst_tmp = _mm_max_pd(src1_tmp, src2_tmp);
+            v2sd dst_tmp2 = _mm_max_pd(src1_tmp2, src2_tmp2);
+            _mm_storeu_pd(dst + i, dst_tmp);
+            _mm_storeu_pd(dst + i + SSE_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src1[i] > src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void minevery128d(double *src1, double *src2, double *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_DOUBLE);
+    stop_len *= (2 * SSE_LEN_DOUBLE);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd src1_tmp = _mm_load_pd(src1 + i);
+            v2sd src2_tmp = _mm_load_pd(src2 + i);
+            v2sd src1_tmp2 = _mm_load_pd(src1 + i + SSE_LEN_DOUBLE);
+            v2sd src2_tmp2 = _mm_load_pd(src2 + i + SSE_LEN_DOUBLE);
+            v2sd dst_tmp = _mm_min_pd(src1_tmp, src2_tmp);
+            v2sd dst_tmp2 = _mm_min_pd(src1_tmp2, src2_tmp2);
+            _mm_store_pd(dst + i, dst_tmp);
+            _mm_store_pd(dst + i + SSE_LEN_DOUBLE, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd src1_tmp = _mm_loadu_pd(src1 + i);
+            v2sd src2_tmp = _mm_loadu_pd(src2 + i);
+            v2sd src1_tmp2 = _mm_loadu_pd(src1 + i + SSE_LEN_DOUBLE);
+            v2sd src2_tmp2 = _mm_loadu_pd(src2 + i + SSE_LEN_DOUBLE);
+            v2sd dst_tmp = _mm_min_pd(src1_tmp, src2_tmp);
+            v2sd dst_tmp2 = _mm_min_pd(src1_tmp2, src2_tmp2);
+            _mm_storeu_pd(dst + i, dst_tmp);
+            _mm_storeu_pd(dst + i + SSE_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src1[i] < src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void threshold128_gt_d(double *src, double *dst, int len, double value)
+{
+    const v2sd pval = _mm_set1_pd(value);
+
+    int stop_len = len / (2 * SSE_LEN_DOUBLE);
+    stop_len *= (2 * SSE_LEN_DOUBLE);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd src_tmp = _mm_load_pd(src + i);
+            v2sd src_tmp2 = _mm_load_pd(src + i + SSE_LEN_DOUBLE);
+            v2sd dst_tmp = _mm_min_pd(src_tmp, pval);
+            v2sd dst_tmp2 = _mm_min_pd(src_tmp2, pval);
+            _mm_store_pd(dst + i, dst_tmp);
+            _mm_store_pd(dst + i + SSE_LEN_DOUBLE, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd src_tmp = _mm_loadu_pd(src + i);
+            v2sd src_tmp2 = _mm_loadu_pd(src + i + SSE_LEN_DOUBLE);
+            v2sd dst_tmp = _mm_min_pd(src_tmp, pval);
+            v2sd dst_tmp2 = _mm_min_pd(src_tmp2, pval);
+            _mm_storeu_pd(dst + i, dst_tmp);
+            _mm_storeu_pd(dst + i + SSE_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src[i] < value ? src[i] : value;
+    }
+}
+
+SIMD_UTILS_API void threshold128_gtabs_d(double *src, double *dst, int len, double value)
+{
+    const v2sd pval = _mm_set1_pd(value);
+
+    int stop_len = len / (2 * SSE_LEN_DOUBLE);
+    stop_len *= (2 * SSE_LEN_DOUBLE);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd src_tmp = _mm_load_pd(src + i);
+            v2sd src_tmp2 = _mm_load_pd(src + i + SSE_LEN_DOUBLE);
+            v2sd src_sign = _mm_and_pd(src_tmp, *(v2sd *) _pd_negative_mask);  // extract sign
+            v2sd src_abs = _mm_and_pd(src_tmp, *(v2sd *) _pd_positive_mask);   // take absolute value
+            v2sd dst_tmp = _mm_xor_pd(_mm_min_pd(src_abs, pval), src_sign);
+            v2sd src_sign2 = _mm_and_pd(src_tmp2, *(v2sd *) _pd_negative_mask);  // extract sign
+            v2sd src_abs2 = _mm_and_pd(src_tmp2, *(v2sd *) _pd_positive_mask);   // take absolute value
+            v2sd dst_tmp2 = _mm_xor_pd(_mm_min_pd(src_abs2, pval), src_sign2);
+            _mm_store_pd(dst + i, dst_tmp);
+            _mm_store_pd(dst + i + SSE_LEN_DOUBLE, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd src_tmp = _mm_loadu_pd(src + i);
+            v2sd src_tmp2 = _mm_loadu_pd(src + i + SSE_LEN_DOUBLE);
+            v2sd src_sign = _mm_and_pd(src_tmp, *(v2sd *) _pd_negative_mask);  // extract sign
+            v2sd src_abs = _mm_and_pd(src_tmp, *(v2sd *) _pd_positive_mask);   // take absolute value
+            v2sd dst_tmp = _mm_xor_pd(_mm_min_pd(src_abs, pval), src_sign);
+            v2sd src_sign2 = _mm_and_pd(src_tmp2, *(v2sd *) _pd_negative_mask);  // extract sign
+            v2sd src_abs2 = _mm_and_pd(src_tmp2, *(v2sd *) _pd_positive_mask);   // take absolute value
+            v2sd dst_tmp2 = _mm_xor_pd(_mm_min_pd(src_abs2, pval), src_sign2);
+            _mm_storeu_pd(dst + i, dst_tmp);
+            _mm_storeu_pd(dst + i + SSE_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        if (src[i] >= 0.0) {
+            dst[i] = src[i] > value ? value : src[i];
+        } else {
+            dst[i] = src[i] < (-value) ? (-value) : src[i];
+        }
+    }
+}
+
+SIMD_UTILS_API void threshold128_lt_d(double *src, double *dst, int len, double value)
+{
+    const v2sd pval = _mm_set1_pd(value);
+
+    int stop_len = len / (2 * SSE_LEN_DOUBLE);
+    stop_len *= (2 * SSE_LEN_DOUBLE);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd src_tmp = _mm_load_pd(src + i);
+            v2sd src_tmp2 = _mm_load_pd(src + i + SSE_LEN_DOUBLE);
+            v2sd dst_tmp = _mm_max_pd(src_tmp, pval);
+            v2sd dst_tmp2 = _mm_max_pd(src_tmp2, pval);
+            _mm_store_pd(dst + i, dst_tmp);
+            _mm_store_pd(dst + i + SSE_LEN_DOUBLE, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd src_tmp = _mm_loadu_pd(src + i);
+            v2sd src_tmp2 = _mm_loadu_pd(src + i + SSE_LEN_DOUBLE);
+            v2sd dst_tmp = _mm_max_pd(src_tmp, pval);
+            v2sd dst_tmp2 = _mm_max_pd(src_tmp2, pval);
+            _mm_storeu_pd(dst + i, dst_tmp);
+            _mm_storeu_pd(dst + i + SSE_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src[i] > value ? src[i] : value;
+    }
+}
+
+SIMD_UTILS_API void threshold128_ltabs_d(double *src, double *dst, int len, double value)
+{
+    const v2sd pval = _mm_set1_pd(value);
+
+    int stop_len = len / (2 * SSE_LEN_DOUBLE);
+    stop_len *= (2 * SSE_LEN_DOUBLE);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd src_tmp = _mm_load_pd(src + i);
+            v2sd src_tmp2 = _mm_load_pd(src + i + SSE_LEN_DOUBLE);
+            v2sd src_sign = _mm_and_pd(src_tmp, *(v2sd *) _pd_negative_mask);  // extract sign
+            v2sd src_abs = _mm_and_pd(src_tmp, *(v2sd *) _pd_positive_mask);   // take absolute value
+            v2sd dst_tmp = _mm_xor_pd(_mm_max_pd(src_abs, pval), src_sign);
+            v2sd src_sign2 = _mm_and_pd(src_tmp2, *(v2sd *) _pd_negative_mask);  // extract sign
+            v2sd src_abs2 = _mm_and_pd(src_tmp2, *(v2sd *) _pd_positive_mask);   // take absolute value
+            v2sd dst_tmp2 = _mm_xor_pd(_mm_max_pd(src_abs2, pval), src_sign2);
+            _mm_store_pd(dst + i, dst_tmp);
+            _mm_store_pd(dst + i + SSE_LEN_DOUBLE, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd src_tmp = _mm_loadu_pd(src + i);
+            v2sd src_tmp2 = _mm_loadu_pd(src + i + SSE_LEN_DOUBLE);
+            v2sd src_sign = _mm_and_pd(src_tmp, *(v2sd *) _pd_negative_mask);  // extract sign
+            v2sd src_abs = _mm_and_pd(src_tmp, *(v2sd *) _pd_positive_mask);   // take absolute value
+            v2sd dst_tmp = _mm_xor_pd(_mm_max_pd(src_abs, pval), src_sign);
+            v2sd src_sign2 = _mm_and_pd(src_tmp2, *(v2sd *) _pd_negative_mask);  // extract sign
+            v2sd src_abs2 = _mm_and_pd(src_tmp2, *(v2sd *) _pd_positive_mask);   // take absolute value
+            v2sd dst_tmp2 = _mm_xor_pd(_mm_max_pd(src_abs2, pval), src_sign2);
+            _mm_storeu_pd(dst + i, dst_tmp);
+            _mm_storeu_pd(dst + i + SSE_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        if (src[i] >= 0.0) {
+            dst[i] = src[i] < value ? value : src[i];
+        } else {
+            dst[i] = src[i] > (-value) ? (-value) : src[i];
+        }
+    }
+}
+
+SIMD_UTILS_API void threshold128_ltval_gtval_d(double *src, double *dst, int len, double ltlevel, double ltvalue, double gtlevel, double gtvalue)
+{
+    const v2sd ltlevel_v = _mm_set1_pd(ltlevel);
+    const v2sd ltvalue_v = _mm_set1_pd(ltvalue);
+    const v2sd gtlevel_v = _mm_set1_pd(gtlevel);
+    const v2sd gtvalue_v = _mm_set1_pd(gtvalue);
+
+    int stop_len = len / (2 * SSE_LEN_DOUBLE);
+    stop_len *= (2 * SSE_LEN_DOUBLE);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd src_tmp = _mm_load_pd(src + i);
+            v2sd src_tmp2 = _mm_load_pd(src + i + SSE_LEN_DOUBLE);
+            v2sd lt_mask = _mm_cmplt_pd(src_tmp, ltlevel_v);
+            v2sd gt_mask = _mm_cmpgt_pd(src_tmp, gtlevel_v);
+            v2sd dst_tmp = _mm_blendv_pd(src_tmp, ltvalue_v, lt_mask);
+            dst_tmp = _mm_blendv_pd(dst_tmp, gtvalue_v, gt_mask);
+            v2sd lt_mask2 = _mm_cmplt_pd(src_tmp2, ltlevel_v);
+            v2sd gt_mask2 = _mm_cmpgt_pd(src_tmp2, gtlevel_v);
+            v2sd dst_tmp2 = _mm_blendv_pd(src_tmp2, ltvalue_v, lt_mask2);
+            dst_tmp2 = _mm_blendv_pd(dst_tmp2, gtvalue_v, gt_mask2);
+            _mm_store_pd(dst + i, dst_tmp);
+            _mm_store_pd(dst + i + SSE_LEN_DOUBLE, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd src_tmp = _mm_loadu_pd(src + i);
+            v2sd src_tmp2 = _mm_loadu_pd(src + i + SSE_LEN_DOUBLE);
+            v2sd lt_mask = _mm_cmplt_pd(src_tmp, ltlevel_v);
+            v2sd gt_mask = _mm_cmpgt_pd(src_tmp, gtlevel_v);
+            v2sd dst_tmp = _mm_blendv_pd(src_tmp, ltvalue_v, lt_mask);
+            dst_tmp = _mm_blendv_pd(dst_tmp, gtvalue_v, gt_mask);
+            v2sd lt_mask2 = _mm_cmplt_pd(src_tmp2, ltlevel_v);
+            v2sd gt_mask2 = _mm_cmpgt_pd(src_tmp2, gtlevel_v);
+            v2sd dst_tmp2 = _mm_blendv_pd(src_tmp2, ltvalue_v, lt_mask2);
+            dst_tmp2 = _mm_blendv_pd(dst_tmp2, gtvalue_v, gt_mask2);
+            _mm_storeu_pd(dst + i, dst_tmp);
+            _mm_storeu_pd(dst + i + SSE_LEN_DOUBLE, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        double tmp = src[i];
+        dst[i] = tmp < ltlevel ? ltvalue : tmp;
+        dst[i] = tmp > gtlevel ? gtvalue : dst[i];
+    }
+}
+
+SIMD_UTILS_API void sum128d(double *src, double *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_DOUBLE);
+    stop_len *= (2 * SSE_LEN_DOUBLE);
+
+    __attribute__((aligned(SSE_LEN_BYTES))) double accumulate[SSE_LEN_DOUBLE];
+    double tmp_acc = 0.0;
+    v2sd vec_acc1 = _mm_setzero_pd();  // initialize the vector accumulator
+    v2sd vec_acc2 = _mm_setzero_pd();  // initialize the vector accumulator
+
+    if (isAligned((uintptr_t) (src), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd vec_tmp1 = _mm_load_pd(src + i);
+            vec_acc1 = _mm_add_pd(vec_acc1, vec_tmp1);
+            v2sd vec_tmp2 = _mm_load_pd(src + i + SSE_LEN_DOUBLE);
+            vec_acc2 = _mm_add_pd(vec_acc2, vec_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd vec_tmp1 = _mm_loadu_pd(src + i);
+            vec_acc1 = _mm_add_pd(vec_acc1, vec_tmp1);
+            v2sd vec_tmp2 = _mm_loadu_pd(src + i + SSE_LEN_DOUBLE);
+            vec_acc2 = _mm_add_pd(vec_acc2, vec_tmp2);
+        }
+    }
+
+    vec_acc1 = _mm_add_pd(vec_acc1, vec_acc2);
+    _mm_store_pd(accumulate, vec_acc1);
+
+    for (int i = stop_len; i < len; i++) {
+        tmp_acc += src[i];
+    }
+
+    for (int i = 0; i < SSE_LEN_DOUBLE; i++) {
+        tmp_acc += accumulate[i];
+    }
+    *dst = tmp_acc;
+}
+
+SIMD_UTILS_API void mean128d(double *src, double *dst, int len)
+{
+    double coeff = 1.0 / ((double) len);
+    sum128d(src, dst, len);
+    *dst *= coeff;
+}
+
+SIMD_UTILS_API void dot128d(double *src1, double *src2, int len, double *dst)
+{
+    int stop_len = len / (2 * SSE_LEN_DOUBLE);
+    stop_len *= (2 * SSE_LEN_DOUBLE);
+
+    __attribute__((aligned(SSE_LEN_BYTES))) double accumulate[SSE_LEN_DOUBLE];
+    double tmp_acc = 0.0;
+    v2sd vec_acc1 = _mm_setzero_pd();  // initialize the vector accumulator
+    v2sd vec_acc2 = _mm_setzero_pd();  // initialize the vector accumulator
+
+    if (areAligned2((uintptr_t) (src1), (uintptr_t) (src2), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd vec_src1_tmp = _mm_load_pd(src1 + i);
+            v2sd vec_src1_tmp2 = _mm_load_pd(src1 + i + SSE_LEN_DOUBLE);
+            v2sd vec_src2_tmp = _mm_load_pd(src2 + i);
+            v2sd vec_src2_tmp2 = _mm_load_pd(src2 + i + SSE_LEN_DOUBLE);
+            vec_acc1 = _mm_fmadd_pd_custom(vec_src1_tmp, vec_src2_tmp, vec_acc1);
+            vec_acc2 = _mm_fmadd_pd_custom(vec_src1_tmp2, vec_src2_tmp2, vec_acc2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd vec_src1_tmp = _mm_loadu_pd(src1 + i);
+            v2sd vec_src1_tmp2 = _mm_loadu_pd(src1 + i + SSE_LEN_DOUBLE);
+            v2sd vec_src2_tmp = _mm_loadu_pd(src2 + i);
+            v2sd vec_src2_tmp2 = _mm_loadu_pd(src2 + i + SSE_LEN_DOUBLE);
+            vec_acc1 = _mm_fmadd_pd_custom(vec_src1_tmp, vec_src2_tmp, vec_acc1);
+            vec_acc2 = _mm_fmadd_pd_custom(vec_src1_tmp2, vec_src2_tmp2, vec_acc2);
+        }
+    }
+
+    vec_acc1 = _mm_add_pd(vec_acc1, vec_acc2);
+    _mm_store_pd(accumulate, vec_acc1);
+
+    for (int i = stop_len; i < len; i++) {
+        tmp_acc += src1[i] * src2[i];
+    }
+
+    for (int i = 0; i < SSE_LEN_DOUBLE; i++) {
+        tmp_acc += accumulate[i];
+    }
+    *dst = tmp_acc;
+}
+
+SIMD_UTILS_API void dotc128d(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst)
+{
+    int stop_len = len / (4 * SSE_LEN_DOUBLE);
+    stop_len *= (4 * SSE_LEN_DOUBLE);
+
+    v2sdx2 vec_acc1 = {{_mm_setzero_pd(), _mm_setzero_pd()}};  // initialize the vector accumulator
+    v2sdx2 vec_acc2 = {{_mm_setzero_pd(), _mm_setzero_pd()}};  // initialize the vector accumulator
+
+    complex64_t dst_tmp = {0.0, 0.0};
+    __attribute__((aligned(SSE_LEN_BYTES))) double accumulateRe[SSE_LEN_DOUBLE];
+    __attribute__((aligned(SSE_LEN_BYTES))) double accumulateIm[SSE_LEN_DOUBLE];
+
+    //  (ac -bd) + i(ad + bc)
+    if (areAligned2((uintptr_t) (src1), (uintptr_t) (src2), SSE_LEN_BYTES)) {
+        for (int i = 0; i < 2 * stop_len; i += 4 * SSE_LEN_DOUBLE) {
+            v2sdx2 src1_split = _mm_load2_pd((double *) (src1) + i);  // a0a1, b0b1
+            v2sdx2 src2_split = _mm_load2_pd((double *) (src2) + i);  // c0c1, d0d1
+            v2sdx2 src1_split2 = _mm_load2_pd((double *) (src1) + i + 2 * SSE_LEN_DOUBLE);
+            v2sdx2 src2_split2 = _mm_load2_pd((double *) (src2) + i + 2 * SSE_LEN_DOUBLE);
+            v2sd ac = _mm_mul_pd(src1_split.val[0], src2_split.val[0]);     // ac
+            v2sd ad = _mm_mul_pd(src1_split.val[0], src2_split.val[1]);     // ad
+            v2sd ac2 = _mm_mul_pd(src1_split2.val[0], src2_split2.val[0]);  // ac
+            v2sd ad2 = _mm_mul_pd(src1_split2.val[0], src2_split2.val[1]);  // ad
+            vec_acc1.val[0] = _mm_add_pd(vec_acc1.val[0], _mm_fnmadd_pd_custom(src1_split.val[1], src2_split.val[1], ac));
+            vec_acc1.val[1] = _mm_add_pd(vec_acc1.val[1], _mm_fmadd_pd_custom(src1_split.val[1], src2_split.val[0], ad));
+            vec_acc2.val[0] = _mm_add_pd(vec_acc2.val[0], _mm_fnmadd_pd_custom(src1_split2.val[1], src2_split2.val[1], ac2));
+            vec_acc2.val[1] = _mm_add_pd(vec_acc2.val[1], _mm_fmadd_pd_custom(src1_split2.val[1], src2_split2.val[0], ad2));
+        }
+    } else {
+        for (int i = 0; i < 2 * stop_len; i += 4 * SSE_LEN_DOUBLE) {
+            v2sdx2 src1_split = _mm_load2u_pd((double *) (src1) + i);  // a0a1, b0b1
+            v2sdx2 src2_split = _mm_load2u_pd((double *) (src2) + i);  // c0c1, d0d1
+            v2sdx2 src1_split2 = _mm_load2u_pd((double *) (src1) + i + 2 * SSE_LEN_DOUBLE);
+            v2sdx2 src2_split2 = _mm_load2u_pd((double *) (src2) + i + 2 * SSE_LEN_DOUBLE);
+            v2sd ac = _mm_mul_pd(src1_split.val[0], src2_split.val[0]);     // ac
+            v2sd ad = _mm_mul_pd(src1_split.val[0], src2_split.val[1]);     // ad
+            v2sd ac2 = _mm_mul_pd(src1_split2.val[0], src2_split2.val[0]);  // ac
+            v2sd ad2 = _mm_mul_pd(src1_split2.val[0], src2_split2.val[1]);  // ad
+            vec_acc1.val[0] = _mm_add_pd(vec_acc1.val[0], _mm_fnmadd_pd_custom(src1_split.val[1], src2_split.val[1], ac));
+            vec_acc1.val[1] = _mm_add_pd(vec_acc1.val[1], _mm_fmadd_pd_custom(src1_split.val[1], src2_split.val[0], ad));
+            vec_acc2.val[0] = _mm_add_pd(vec_acc2.val[0], _mm_fnmadd_pd_custom(src1_split2.val[1], src2_split2.val[1], ac2));
+            vec_acc2.val[1] = _mm_add_pd(vec_acc2.val[1], _mm_fmadd_pd_custom(src1_split2.val[1], src2_split2.val[0], ad2));
+        }
+    }
+
+    vec_acc1.val[0] = _mm_add_pd(vec_acc1.val[0], vec_acc2.val[0]);
+    vec_acc1.val[1] = _mm_add_pd(vec_acc1.val[1], vec_acc2.val[1]);
+    _mm_store_pd(accumulateRe, vec_acc1.val[0]);
+    _mm_store_pd(accumulateIm, vec_acc1.val[1]);
+
+    for (int i = stop_len; i < len; i++) {
+        dst_tmp.re += src1[i].re * src2[i].re - (src1[i].im * src2[i].im);
+        dst_tmp.im += src1[i].re * src2[i].im + (src2[i].re * src1[i].im);
+    }
+
+    for (int i = 0; i < SSE_LEN_DOUBLE; i++) {
+        dst_tmp.re += accumulateRe[i];
+        dst_tmp.im += accumulateIm[i];
+    }
+    dst->re = dst_tmp.re;
+    dst->im = dst_tmp.im;
+}
+
+// *acc + *cor += value, *cor gathers the rounding errors of the additions (TwoSum, see simd_utils_sum.h)
+static inline void kahan_add128d(v2sd *acc, v2sd *cor, v2sd value)
+{
+    v2sd t = _mm_add_pd(*acc, value);
+    v2sd bp = _mm_sub_pd(t, *acc);
+    v2sd err = _mm_add_pd(_mm_sub_pd(*acc, _mm_sub_pd(t, bp)), _mm_sub_pd(value, bp));
+    *cor = _mm_add_pd(*cor, err);
+    *acc = t;
+}
+
+SIMD_UTILS_API void sumkahan128d(double *src, double *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_DOUBLE);
+    stop_len *= (2 * SSE_LEN_DOUBLE);
+
+    __attribute__((aligned(SSE_LEN_BYTES))) double accumulate[2 * SSE_LEN_DOUBLE];
+    __attribute__((aligned(SSE_LEN_BYTES))) double correction[2 * SSE_LEN_DOUBLE];
+    double tmp_acc = 0.0;
+    double tmp_cor = 0.0;
+    v2sd vec_acc1 = _mm_setzero_pd();  // initialize the vector accumulator
+    v2sd vec_acc2 = _mm_setzero_pd();  // initialize the vector accumulator
+    v2sd vec_cor1 = _mm_setzero_pd();  // rounding errors of the accumulator
+    v2sd vec_cor2 = _mm_setzero_pd();  // rounding errors of the accumulator
+
+    if (isAligned((uintptr_t) (src), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            kahan_add128d(&vec_acc1, &vec_cor1, _mm_load_pd(src + i));
+            kahan_add128d(&vec_acc2, &vec_cor2, _mm_load_pd(src + i + SSE_LEN_DOUBLE));
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            kahan_add128d(&vec_acc1, &vec_cor1, _mm_loadu_pd(src + i));
+            kahan_add128d(&vec_acc2, &vec_cor2, _mm_loadu_pd(src + i + SSE_LEN_DOUBLE));
+        }
+    }
+
+    _mm_store_pd(accumulate, vec_acc1);
+    _mm_store_pd(accumulate + SSE_LEN_DOUBLE, vec_acc2);
+    _mm_store_pd(correction, vec_cor1);
+    _mm_store_pd(correction + SSE_LEN_DOUBLE, vec_cor2);
+    kahan_foldd(accumulate, correction, 2 * SSE_LEN_DOUBLE, &tmp_acc, &tmp_cor);
+
+    for (int i = stop_len; i < len; i++) {
+        kahan_addd(&tmp_acc, &tmp_cor, src[i]);
+    }
+
+    *dst = tmp_acc + tmp_cor;
+}
+
+SIMD_UTILS_API void meankahan128d(double *src, double *dst, int len)
+{
+    double coeff = 1.0 / ((double) len);
+    sumkahan128d(src, dst, len);
+    *dst *= coeff;
+}
+
+/* The rounding errors of the products are prod - src1 * src2 computed with a FMA,
+ * they are 0 without FMA (only the additions are compensated) */
+SIMD_UTILS_API void dotkahan128d(double *src1, double *src2, int len, double *dst)
+{
+    int stop_len = len / (2 * SSE_LEN_DOUBLE);
+    stop_len *= (2 * SSE_LEN_DOUBLE);
+
+    __attribute__((aligned(SSE_LEN_BYTES))) double accumulate[2 * SSE_LEN_DOUBLE];
+    __attribute__((aligned(SSE_LEN_BYTES))) double correction[2 * SSE_LEN_DOUBLE];
+    double tmp_acc = 0.0;
+    double tmp_cor = 0.0;
+    v2sd vec_acc1 = _mm_setzero_pd();  // initialize the vector accumulator
+    v2sd vec_acc2 = _mm_setzero_pd();  // initialize the vector accumulator
+    v2sd vec_cor1 = _mm_setzero_pd();  // rounding errors of the accumulator
+    v2sd vec_cor2 = _mm_setzero_pd();  // rounding errors of the accumulator
+
+    if (areAligned2((uintptr_t) (src1), (uintptr_t) (src2), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd vec_src1_tmp = _mm_load_pd(src1 + i);
+            v2sd vec_src1_tmp2 = _mm_load_pd(src1 + i + SSE_LEN_DOUBLE);
+            v2sd vec_src2_tmp = _mm_load_pd(src2 + i);
+            v2sd vec_src2_tmp2 = _mm_load_pd(src2 + i + SSE_LEN_DOUBLE);
+            v2sd prod = _mm_mul_pd(vec_src1_tmp, vec_src2_tmp);
+            v2sd prod2 = _mm_mul_pd(vec_src1_tmp2, vec_src2_tmp2);
+            kahan_add128d(&vec_acc1, &vec_cor1, prod);
+            kahan_add128d(&vec_acc2, &vec_cor2, prod2);
+            vec_cor1 = _mm_sub_pd(vec_cor1, _mm_fnmadd_pd_custom(vec_src1_tmp, vec_src2_tmp, prod));
+            vec_cor2 = _mm_sub_pd(vec_cor2, _mm_fnmadd_pd_custom(vec_src1_tmp2, vec_src2_tmp2, prod2));
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd vec_src1_tmp = _mm_loadu_pd(src1 + i);
+            v2sd vec_src1_tmp2 = _mm_loadu_pd(src1 + i + SSE_LEN_DOUBLE);
+            v2sd vec_src2_tmp = _mm_loadu_pd(src2 + i);
+            v2sd vec_src2_tmp2 = _mm_loadu_pd(src2 + i + SSE_LEN_DOUBLE);
+            v2sd prod = _mm_mul_pd(vec_src1_tmp, vec_src2_tmp);
+            v2sd prod2 = _mm_mul_pd(vec_src1_tmp2, vec_src2_tmp2);
+            kahan_add128d(&vec_acc1, &vec_cor1, prod);
+            kahan_add128d(&vec_acc2, &vec_cor2, prod2);
+            vec_cor1 = _mm_sub_pd(vec_cor1, _mm_fnmadd_pd_custom(vec_src1_tmp, vec_src2_tmp, prod));
+            vec_cor2 = _mm_sub_pd(vec_cor2, _mm_fnmadd_pd_custom(vec_src1_tmp2, vec_src2_tmp2, prod2));
+        }
+    }
+
+    _mm_store_pd(accumulate, vec_acc1);
+    _mm_store_pd(accumulate + SSE_LEN_DOUBLE, vec_acc2);
+    _mm_store_pd(correction, vec_cor1);
+    _mm_store_pd(correction + SSE_LEN_DOUBLE, vec_cor2);
+    kahan_foldd(accumulate, correction, 2 * SSE_LEN_DOUBLE, &tmp_acc, &tmp_cor);
+
+    for (int i = stop_len; i < len; i++) {
+        kahan_addd(&tmp_acc, &tmp_cor, src1[i] * src2[i]);
+    }
+
+    *dst = tmp_acc + tmp_cor;
+}
+
+SIMD_UTILS_API void dotckahan128d(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst)
+{
+    int stop_len = len / (4 * SSE_LEN_DOUBLE);
+    stop_len *= (4 * SSE_LEN_DOUBLE);
+
+    __attribute__((aligned(SSE_LEN_BYTES))) double accumulateRe[2 * SSE_LEN_DOUBLE];
+    __attribute__((aligned(SSE_LEN_BYTES))) double accumulateIm[2 * SSE_LEN_DOUBLE];
+    __attribute__((aligned(SSE_LEN_BYTES))) double correctionRe[2 * SSE_LEN_DOUBLE];
+    __attribute__((aligned(SSE_LEN_BYTES))) double correctionIm[2 * SSE_LEN_DOUBLE];
+    complex64_t dst_tmp = {0.0, 0.0};
+    complex64_t dst_cor = {0.0, 0.0};
+    v2sdx2 vec_acc1 = {{_mm_setzero_pd(), _mm_setzero_pd()}};  // initialize the vector accumulator
+    v2sdx2 vec_acc2 = {{_mm_setzero_pd(), _mm_setzero_pd()}};  // initialize the vector accumulator
+    v2sdx2 vec_cor1 = {{_mm_setzero_pd(), _mm_setzero_pd()}};  // rounding errors of the accumulator
+    v2sdx2 vec_cor2 = {{_mm_setzero_pd(), _mm_setzero_pd()}};  // rounding errors of the accumulator
+
+    //  (ac -bd) + i(ad + bc)
+    if (areAligned2((uintptr_t) (src1), (uintptr_t) (src2), SSE_LEN_BYTES)) {
+        for (int i = 0; i < 2 * stop_len; i += 4 * SSE_LEN_DOUBLE) {
+            v2sdx2 src1_split = _mm_load2_pd((double *) (src1) + i);  // a0a1, b0b1
+            v2sdx2 src2_split = _mm_load2_pd((double *) (src2) + i);  // c0c1, d0d1
+            v2sdx2 src1_split2 = _mm_load2_pd((double *) (src1) + i + 2 * SSE_LEN_DOUBLE);
+            v2sdx2 src2_split2 = _mm_load2_pd((double *) (src2) + i + 2 * SSE_LEN_DOUBLE);
+            v2sd ac = _mm_mul_pd(src1_split.val[0], src2_split.val[0]);     // ac
+            v2sd ad = _mm_mul_pd(src1_split.val[0], src2_split.val[1]);     // ad
+            v2sd ac2 = _mm_mul_pd(src1_split2.val[0], src2_split2.val[0]);  // ac
+            v2sd ad2 = _mm_mul_pd(src1_split2.val[0], src2_split2.val[1]);  // ad
+            kahan_add128d(&vec_acc1.val[0], &vec_cor1.val[0], _mm_fnmadd_pd_custom(src1_split.val[1], src2_split.val[1], ac));
+            kahan_add128d(&vec_acc1.val[1], &vec_cor1.val[1], _mm_fmadd_pd_custom(src1_split.val[1], src2_split.val[0], ad));
+            kahan_add128d(&vec_acc2.val[0], &vec_cor2.val[0], _mm_fnmadd_pd_custom(src1_split2.val[1], src2_split2.val[1], ac2));
+            kahan_add128d(&vec_acc2.val[1], &vec_cor2.val[1], _mm_fmadd_pd_custom(src1_split2.val[1], src2_split2.val[0], ad2));
+        }
+    } else {
+        for (int i = 0; i < 2 * stop_len; i += 4 * SSE_LEN_DOUBLE) {
+            v2sdx2 src1_split = _mm_load2u_pd((double *) (src1) + i);  // a0a1, b0b1
+            v2sdx2 src2_split = _mm_load2u_pd((double *) (src2) + i);  // c0c1, d0d1
+            v2sdx2 src1_split2 = _mm_load2u_pd((double *) (src1) + i + 2 * SSE_LEN_DOUBLE);
+            v2sdx2 src2_split2 = _mm_load2u_pd((double *) (src2) + i + 2 * SSE_LEN_DOUBLE);
+            v2sd ac = _mm_mul_pd(src1_split.val[0], src2_split.val[0]);     // ac
+            v2sd ad = _mm_mul_pd(src1_split.val[0], src2_split.val[1]);     // ad
+            v2sd ac2 = _mm_mul_pd(src1_split2.val[0], src2_split2.val[0]);  // ac
+            v2sd ad2 = _mm_mul_pd(src1_split2.val[0], src2_split2.val[1]);  // ad
+            kahan_add128d(&vec_acc1.val[0], &vec_cor1.val[0], _mm_fnmadd_pd_custom(src1_split.val[1], src2_split.val[1], ac));
+            kahan_add128d(&vec_acc1.val[1], &vec_cor1.val[1], _mm_fmadd_pd_custom(src1_split.val[1], src2_split.val[0], ad));
+            kahan_add128d(&vec_acc2.val[0], &vec_cor2.val[0], _mm_fnmadd_pd_custom(src1_split2.val[1], src2_split2.val[1], ac2));
+            kahan_add128d(&vec_acc2.val[1], &vec_cor2.val[1], _mm_fmadd_pd_custom(src1_split2.val[1], src2_split2.val[0], ad2));
+        }
+    }
+
+    _mm_store_pd(accumulateRe, vec_acc1.val[0]);
+    _mm_store_pd(accumulateRe + SSE_LEN_DOUBLE, vec_acc2.val[0]);
+    _mm_store_pd(accumulateIm, vec_acc1.val[1]);
+    _mm_store_pd(accumulateIm + SSE_LEN_DOUBLE, vec_acc2.val[1]);
+    _mm_store_pd(correctionRe, vec_cor1.val[0]);
+    _mm_store_pd(correctionRe + SSE_LEN_DOUBLE, vec_cor2.val[0]);
+    _mm_store_pd(correctionIm, vec_cor1.val[1]);
+    _mm_store_pd(correctionIm + SSE_LEN_DOUBLE, vec_cor2.val[1]);
+    kahan_foldd(accumulateRe, correctionRe, 2 * SSE_LEN_DOUBLE, &dst_tmp.re, &dst_cor.re);
+    kahan_foldd(accumulateIm, correctionIm, 2 * SSE_LEN_DOUBLE, &dst_tmp.im, &dst_cor.im);
+
+    for (int i = stop_len; i < len; i++) {
+        kahan_addd(&dst_tmp.re, &dst_cor.re, src1[i].re * src2[i].re - (src1[i].im * src2[i].im));
+        kahan_addd(&dst_tmp.im, &dst_cor.im, src1[i].re * src2[i].im + (src2[i].re * src1[i].im));
+    }
+
+    dst->re = dst_tmp.re + dst_cor.re;
+    dst->im = dst_tmp.im + dst_cor.im;
+}
+
+SIMD_UTILS_API void sumpairwise128d(double *src, double *dst, int len)
+{
+    *dst = sum_pairwised(src, len, sum128d);
+}
+
+SIMD_UTILS_API void meanpairwise128d(double *src, double *dst, int len)
+{
+    double coeff = 1.0 / ((double) len);
+    sumpairwise128d(src, dst, len);
+    *dst *= coeff;
+}
+
+SIMD_UTILS_API void dotpairwise128d(double *src1, double *src2, int len, double *dst)
+{
+    *dst = dot_pairwised(src1, src2, len, dot128d);
+}
+
+SIMD_UTILS_API void dotcpairwise128d(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst)
+{
+    *dst = dotc_pairwised(src1, src2, len, dotc128d);
+}
+
+// sums of the powers of (src[i] - shift), see simd_utils_moments.h
+static inline void centered_sums128d(double *src, int len, double shift, double *sums)
+{
+    int stop_len = len / (2 * SSE_LEN_DOUBLE);
+    stop_len *= (2 * SSE_LEN_DOUBLE);
+
+    __attribute__((aligned(SSE_LEN_BYTES))) double accumulate[4 * SSE_LEN_DOUBLE];
+    v2sd shift_vec = _mm_set1_pd(shift);
+    v2sd sum1_1 = _mm_setzero_pd(), sum1_2 = _mm_setzero_pd();  // d
+    v2sd sum2_1 = _mm_setzero_pd(), sum2_2 = _mm_setzero_pd();  // d^2
+    v2sd sum3_1 = _mm_setzero_pd(), sum3_2 = _mm_setzero_pd();  // d^3
+    v2sd sum4_1 = _mm_setzero_pd(), sum4_2 = _mm_setzero_pd();  // d^4
+
+    if (isAligned((uintptr_t) (src), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd d1 = _mm_sub_pd(_mm_load_pd(src + i), shift_vec);
+            v2sd d2 = _mm_sub_pd(_mm_load_pd(src + i + SSE_LEN_DOUBLE), shift_vec);
+            v2sd sq1 = _mm_mul_pd(d1, d1);
+            v2sd sq2 = _mm_mul_pd(d2, d2);
+            sum1_1 = _mm_add_pd(sum1_1, d1);
+            sum1_2 = _mm_add_pd(sum1_2, d2);
+            sum2_1 = _mm_add_pd(sum2_1, sq1);
+            sum2_2 = _mm_add_pd(sum2_2, sq2);
+            sum3_1 = _mm_fmadd_pd_custom(sq1, d1, sum3_1);
+            sum3_2 = _mm_fmadd_pd_custom(sq2, d2, sum3_2);
+            sum4_1 = _mm_fmadd_pd_custom(sq1, sq1, sum4_1);
+            sum4_2 = _mm_fmadd_pd_custom(sq2, sq2, sum4_2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+            v2sd d1 = _mm_sub_pd(_mm_loadu_pd(src + i), shift_vec);
+            v2sd d2 = _mm_sub_pd(_mm_loadu_pd(src + i + SSE_LEN_DOUBLE), shift_vec);
+            v2sd sq1 = _mm_mul_pd(d1, d1);
+            v2sd sq2 = _mm_mul_pd(d2, d2);
+            sum1_1 = _mm_add_pd(sum1_1, d1);
+            sum1_2 = _mm_add_pd(sum1_2, d2);
+            sum2_1 = _mm_add_pd(sum2_1, sq1);
+            sum2_2 = _mm_add_pd(sum2_2, sq2);
+            sum3_1 = _mm_fmadd_pd_custom(sq1, d1, sum3_1);
+            sum3_2 = _mm_fmadd_pd_custom(sq2, d2, sum3_2);
+            sum4_1 = _mm_fmadd_pd_custom(sq1, sq1, sum4_1);
+            sum4_2 = _mm_fmadd_pd_custom(sq2, sq2, sum4_2);
+        }
+    }
+
+    _mm_store_pd(accumulate, _mm_add_pd(sum1_1, sum1_2));
+    _mm_store_pd(accumulate + SSE_LEN_DOUBLE, _mm_add_pd(sum2_1, sum2_2));
+    _mm_store_pd(accumulate + 2 * SSE_LEN_DOUBLE, _mm_add_pd(sum3_1, sum3_2));
+    _mm_store_pd(accumulate + 3 * SSE_LEN_DOUBLE, _mm_add_pd(sum4_1, sum4_2));
+
+    for (int k = 0; k < 4; k++) {
+        sums[k] = 0.0;
+        for (int i = 0; i < SSE_LEN_DOUBLE; i++) {
+            sums[k] += (double) accumulate[k * SSE_LEN_DOUBLE + i];
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        double d = (double) (src[i] - shift);
+        double sq = d * d;
+        sums[0] += d;
+        sums[1] += sq;
+        sums[2] += sq * d;
+        sums[3] += sq * sq;
+    }
+}
+
+SIMD_UTILS_API void moments128d(double *src, int len, moments_t *m)
+{
+    moments_rund(src, len, sum128d, centered_sums128d, m);
+}
+
+// inclusive prefix sum of the lanes of x
+static inline v2sd prefix_lanes128d(v2sd x)
+{
+    return _mm_add_pd(x, _mm_castsi128_pd(_mm_slli_si128(_mm_castpd_si128(x), 8)));
+}
+
+// last lane of x in all the lanes
+static inline v2sd last_lane128d(v2sd x)
+{
+    return _mm_unpackhi_pd(x, x);
+}
+
+// lanes of x moved up by one, the first lane getting the last lane of prev
+static inline v2sd shift_lane128d(v2sd x, v2sd prev)
+{
+    return _mm_shuffle_pd(prev, x, 1);
+}
+
+// prefix sums of src (see simd_utils.h), exclusive when exclusive is set
+static inline void prefixsum128d_run(double *src, double *dst, int len, double *carry, int exclusive)
+{
+    int stop_len = len / (2 * SSE_LEN_DOUBLE);
+    stop_len *= (2 * SSE_LEN_DOUBLE);
+
+    v2sd carry_vec = _mm_set1_pd(carry ? *carry : 0.0);
+
+    // the carry only waits for one add per pair of vectors
+    for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+        v2sd a = prefix_lanes128d(_mm_loadu_pd(src + i));
+        v2sd b = prefix_lanes128d(_mm_loadu_pd(src + i + SSE_LEN_DOUBLE));
+        b = _mm_add_pd(b, last_lane128d(a));
+        v2sd last = last_lane128d(b);
+        a = _mm_add_pd(a, carry_vec);
+        b = _mm_add_pd(b, carry_vec);
+        if (exclusive) {
+            _mm_storeu_pd(dst + i, shift_lane128d(a, carry_vec));
+            _mm_storeu_pd(dst + i + SSE_LEN_DOUBLE, shift_lane128d(b, a));
+        } else {
+            _mm_storeu_pd(dst + i, a);
+            _mm_storeu_pd(dst + i + SSE_LEN_DOUBLE, b);
+        }
+        carry_vec = _mm_add_pd(carry_vec, last);
+    }
+
+    double carry_tmp = _mm_cvtsd_f64(carry_vec);
+    for (int i = stop_len; i < len; i++) {
+        double x = src[i];
+        if (exclusive) {
+            dst[i] = carry_tmp;
+            carry_tmp = carry_tmp + x;
+        } else {
+            carry_tmp = carry_tmp + x;
+            dst[i] = carry_tmp;
+        }
+    }
+
+    if (carry)
+        *carry = carry_tmp;
+}
+
+SIMD_UTILS_API void prefixsum128d(double *src, double *dst, int len, double *carry)
+{
+    prefixsum128d_run(src, dst, len, carry, 0);
+}
+
+SIMD_UTILS_API void prefixsum128d_excl(double *src, double *dst, int len, double *carry)
+{
+    prefixsum128d_run(src, dst, len, carry, 1);
+}
+
+SIMD_UTILS_API void diff128d(double *src, double *dst, int len, double *prev)
+{
+    int stop_len = len / (2 * SSE_LEN_DOUBLE);
+    stop_len *= (2 * SSE_LEN_DOUBLE);
+
+    double prev_tmp = prev ? *prev : 0.0;
+    double last = (len > 0) ? src[len - 1] : prev_tmp;  // before src is overwritten by dst
+    v2sd prev_vec = _mm_set1_pd(prev_tmp);
+
+    for (int i = 0; i < stop_len; i += 2 * SSE_LEN_DOUBLE) {
+        v2sd a = _mm_loadu_pd(src + i);
+        v2sd b = _mm_loadu_pd(src + i + SSE_LEN_DOUBLE);
+        _mm_storeu_pd(dst + i, _mm_sub_pd(a, shift_lane128d(a, prev_vec)));
+        _mm_storeu_pd(dst + i + SSE_LEN_DOUBLE, _mm_sub_pd(b, shift_lane128d(b, a)));
+        prev_vec = b;
+    }
+
+    if (stop_len > 0)
+        prev_tmp = _mm_cvtsd_f64(last_lane128d(prev_vec));
+    for (int i = stop_len; i < len; i++) {
+        double x = src[i];
+        dst[i] = x - prev_tmp;
+        prev_tmp = x;
+    }
+
+    if (prev)
+        *prev = last;
+}
+
+// bitonic sort of the lanes of x
+static inline v2sd sort_lanes128d(v2sd x)
+{
+    v2sd p;
+    p = _mm_shuffle_pd(x, x, 1);
+    x = _mm_blend_pd(_mm_min_pd(x, p), _mm_max_pd(x, p), 0x2);
+    return x;
+}
+
+// sorts the lanes of x, which are a bitonic sequence
+static inline v2sd sort_clean128d(v2sd x)
+{
+    v2sd p;
+    p = _mm_shuffle_pd(x, x, 1);
+    x = _mm_blend_pd(_mm_min_pd(x, p), _mm_max_pd(x, p), 0x2);
+    return x;
+}
+
+// merges the sorted vectors a and b, a getting the lowest half
+static inline void sort_merge2128d(v2sd *a, v2sd *b)
+{
+    v2sd rev = _mm_shuffle_pd(*b, *b, 1);
+    v2sd low = _mm_min_pd(*a, rev);
+    v2sd high = _mm_max_pd(*a, rev);
+    *a = sort_clean128d(low);
+    *b = sort_clean128d(high);
+}
+
+// merges the sorted sequences (a, b) and (c, d)
+static inline void sort_merge4128d(v2sd *a, v2sd *b, v2sd *c, v2sd *d)
+{
+    v2sd rev_c = _mm_shuffle_pd(*d, *d, 1);
+    v2sd rev_d = _mm_shuffle_pd(*c, *c, 1);
+    v2sd low0 = _mm_min_pd(*a, rev_c);
+    v2sd high0 = _mm_max_pd(*a, rev_c);
+    v2sd low1 = _mm_min_pd(*b, rev_d);
+    v2sd high1 = _mm_max_pd(*b, rev_d);
+    *a = sort_clean128d(_mm_min_pd(low0, low1));
+    *b = sort_clean128d(_mm_max_pd(low0, low1));
+    *c = sort_clean128d(_mm_min_pd(high0, high1));
+    *d = sort_clean128d(_mm_max_pd(high0, high1));
+}
+
+// sorts up to 4 vectors, padded with the largest value
+static inline void sort_small128d(double *src, int len)
+{
+    double tmp[4 * SSE_LEN_DOUBLE] __attribute__((aligned(SSE_LEN_BYTES)));
+
+    memcpy(tmp, src, len * sizeof(double));
+    for (int i = len; i < 4 * SSE_LEN_DOUBLE; i++) {
+        tmp[i] = INFINITY;
+    }
+
+    v2sd a = sort_lanes128d(_mm_loadu_pd(tmp));
+    if (len <= SSE_LEN_DOUBLE) {
+        _mm_storeu_pd(tmp, a);
+    } else if (len <= 2 * SSE_LEN_DOUBLE) {
+        v2sd b = sort_lanes128d(_mm_loadu_pd(tmp + SSE_LEN_DOUBLE));
+        sort_merge2128d(&a, &b);
+        _mm_storeu_pd(tmp, a);
+        _mm_storeu_pd(tmp + SSE_LEN_DOUBLE, b);
+    } else {
+        v2sd b = sort_lanes128d(_mm_loadu_pd(tmp + SSE_LEN_DOUBLE));
+        v2sd c = sort_lanes128d(_mm_loadu_pd(tmp + 2 * SSE_LEN_DOUBLE));
+        v2sd d = sort_lanes128d(_mm_loadu_pd(tmp + 3 * SSE_LEN_DOUBLE));
+        sort_merge2128d(&a, &b);
+        sort_merge2128d(&c, &d);
+        sort_merge4128d(&a, &b, &c, &d);
+        _mm_storeu_pd(tmp, a);
+        _mm_storeu_pd(tmp + SSE_LEN_DOUBLE, b);
+        _mm_storeu_pd(tmp + 2 * SSE_LEN_DOUBLE, c);
+        _mm_storeu_pd(tmp + 3 * SSE_LEN_DOUBLE, d);
+    }
+
+    memcpy(src, tmp, len * sizeof(double));
+}
+
+// packs the lanes of x lower than the pivot to [*left_w, ...) and the others to [..., *right_w)
+static inline void partition_store128d(double *src, v2sd x, v2sd pivot_vec, int *left_w, int *right_w)
+{
+    int mask = sort_double_mask(_mm_movemask_pd(_mm_cmplt_pd(x, pivot_vec)));
+    int nb_low = __builtin_popcount(mask) / 2;
+    v4si shuf = _mm_load_si128((v4si *) sort_shuffle4_lut[mask]);
+    v2sd packed = _mm_castsi128_pd(_mm_shuffle_epi8(_mm_castpd_si128(x), shuf));
+
+    // the full vector is stored on both ends (free space of a vector at least on each end)
+    _mm_storeu_pd(src + *left_w, packed);
+    _mm_storeu_pd(src + *right_w - SSE_LEN_DOUBLE, packed);
+    *left_w += nb_low;
+    *right_w -= SSE_LEN_DOUBLE - nb_low;
+}
+
+// number of elements lower than pivot, moved to the beginning of src (len >= 2 * SSE_LEN_DOUBLE)
+static inline int partition128d(double *src, int len, double pivot)
+{
+    v2sd pivot_vec = _mm_set1_pd(pivot);
+    v2sd first = _mm_loadu_pd(src);
+    v2sd last = _mm_loadu_pd(src + len - SSE_LEN_DOUBLE);
+    int left = SSE_LEN_DOUBLE, right = len - 2 * SSE_LEN_DOUBLE;  // next vectors read from each end
+    int left_w = 0, right_w = len;             // free space [left_w, left) and [right + SSE_LEN_DOUBLE, right_w)
+
+    while (left <= right) {
+        v2sd x;
+        if ((left - left_w) <= (right_w - right - SSE_LEN_DOUBLE)) {
+            x = _mm_loadu_pd(src + left);
+            left += SSE_LEN_DOUBLE;
+        } else {
+            x = _mm_loadu_pd(src + right);
+            right -= SSE_LEN_DOUBLE;
+        }
+        partition_store128d(src, x, pivot_vec, &left_w, &right_w);
+    }
+
+    // the last elements (less than a vector) with the first and the last vectors
+    double tmp[3 * SSE_LEN_DOUBLE];
+    int nb_tmp = right + SSE_LEN_DOUBLE - left;
+    memcpy(tmp, src + left, nb_tmp * sizeof(double));
+    _mm_storeu_pd(tmp + nb_tmp, first);
+    _mm_storeu_pd(tmp + nb_tmp + SSE_LEN_DOUBLE, last);
+    sort_partition_taild(src, tmp, nb_tmp + 2 * SSE_LEN_DOUBLE, pivot, &left_w, &right_w);
+    return left_w;
+}
+
+SIMD_UTILS_API void sort128d(double *src, int len)
+{
+    sort_rund(src, len, 4 * SSE_LEN_DOUBLE, partition128d, sort_small128d);
+}
@@ -120,7 +120,7 @@ static inline v4sf log2_ps(v4sf x)
 }
 
 
-static inline void log10128f(float *src, float *dst, int len)
+SIMD_UTILS_API void log10128f(float *src, float *dst, int len)
 {
     const v4sf invln10f = _mm_set1_ps((float) INVLN10);
 
@@ -128,9 +128,17 @@ static inline void log10128f(float *src, float *dst, int len)
     stop_len *= SSE_LEN_FLOAT;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
-            v4sf src_tmp = log_ps(_mm_load_ps(src + i));
-            _mm_store_ps(dst + i, _mm_mul_ps(src_tmp, invln10f));
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
+                v4sf src_tmp = log_ps(_mm_load_ps(src + i));
+                _mm_stream_ps(dst + i, _mm_mul_ps(src_tmp, invln10f));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
+                v4sf src_tmp = log_ps(_mm_load_ps(src + i));
+                _mm_store_ps(dst + i, _mm_mul_ps(src_tmp, invln10f));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
@@ -144,7 +152,7 @@ static inline void log10128f(float *src, float *dst, int len)
     }
 }
 
-static inline void log10128f_precise(float *src, float *dst, int len)
+SIMD_UTILS_API void log10128f_precise(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -166,7 +174,7 @@ static inline void log10128f_precise(float *src, float *dst, int len)
     }
 }
 
-static inline void log2128f(float *src, float *dst, int len)
+SIMD_UTILS_API void log2128f(float *src, float *dst, int len)
 {
     const v4sf invln2f = _mm_set1_ps((float) INVLN2);
 
@@ -174,9 +182,17 @@ static inline void log2128f(float *src, float *dst, int len)
     stop_len *= SSE_LEN_FLOAT;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
-            v4sf src_tmp = log_ps(_mm_load_ps(src + i));
-            _mm_store_ps(dst + i, _mm_mul_ps(src_tmp, invln2f));
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
+                v4sf src_tmp = log_ps(_mm_load_ps(src + i));
+                _mm_stream_ps(dst + i, _mm_mul_ps(src_tmp, invln2f));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
+                v4sf src_tmp = log_ps(_mm_load_ps(src + i));
+                _mm_store_ps(dst + i, _mm_mul_ps(src_tmp, invln2f));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
@@ -190,7 +206,7 @@ static inline void log2128f(float *src, float *dst, int len)
     }
 }
 
-static inline void log2128f_precise(float *src, float *dst, int len)
+SIMD_UTILS_API void log2128f_precise(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -212,14 +228,21 @@ static inline void log2128f_precise(float *src, float *dst, int len)
     }
 }
 
-static inline void ln128f(float *src, float *dst, int len)
+SIMD_UTILS_API void ln128f(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
-            _mm_store_ps(dst + i, log_ps(_mm_load_ps(src + i)));
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
+                _mm_stream_ps(dst + i, log_ps(_mm_load_ps(src + i)));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
+                _mm_store_ps(dst + i, log_ps(_mm_load_ps(src + i)));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
@@ -232,14 +255,21 @@ static inline void ln128f(float *src, float *dst, int len)
     }
 }
 
-static inline void exp128f(float *src, float *dst, int len)
+SIMD_UTILS_API void exp128f(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
-            _mm_store_ps(dst + i, exp_ps(_mm_load_ps(src + i)));
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
+                _mm_stream_ps(dst + i, exp_ps(_mm_load_ps(src + i)));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
+                _mm_store_ps(dst + i, exp_ps(_mm_load_ps(src + i)));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
@@ -307,7 +337,7 @@ static inline v4sf exp_ps_alternate(v4sf x)
 #endif //ARMV7
 
 
-static inline void exp128f_(float *src, float *dst, int len)
+SIMD_UTILS_API void exp128f_(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -330,7 +360,7 @@ static inline void exp128f_(float *src, float *dst, int len)
 /////////////// CBRT
 // Test, seems okay, see sse_mathfun
 #if 0
-static inline void frexpf128f(float *src, float *dst, int len)
+SIMD_UTILS_API void frexpf128f(float *src, float *dst, int len)
 {
     int stop_len = len / (SSE_LEN_FLOAT);
     stop_len *= (SSE_LEN_FLOAT);
@@ -359,7 +389,7 @@ static inline void frexpf128f(float *src, float *dst, int len)
     }
 }
 
-static inline void ldexp128f(float *src, int ex, float *dst, int len)
+SIMD_UTILS_API void ldexp128f(float *src, int ex, float *dst, int len)
 {
     int stop_len = len / (SSE_LEN_FLOAT);
     stop_len *= (SSE_LEN_FLOAT);
@@ -468,7 +498,7 @@ static inline v4sf cbrtf_ps(v4sf xx)
     return x;
 }
 
-static inline void cbrt128f(float *src, float *dst, int len)
+SIMD_UTILS_API void cbrt128f(float *src, float *dst, int len)
 {
     int stop_len = len / (SSE_LEN_FLOAT);
     stop_len *= (SSE_LEN_FLOAT);
@@ -499,19 +529,31 @@ static inline void cbrt128f(float *src, float *dst, int len)
 }
 /////
 
-static inline void fabs128f(float *src, float *dst, int len)
+SIMD_UTILS_API void fabs128f(float *src, float *dst, int len)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= (2 * SSE_LEN_FLOAT);
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
-            v4sf src_tmp = _mm_load_ps(src + i);
-            v4sf src_tmp2 = _mm_load_ps(src + i + SSE_LEN_FLOAT);
-            v4sf dst_tmp = _mm_and_ps(*(v4sf *) _ps_pos_sign_mask, src_tmp);
-            v4sf dst_tmp2 = _mm_and_ps(*(v4sf *) _ps_pos_sign_mask, src_tmp2);
-            _mm_store_ps(dst + i, dst_tmp);
-            _mm_store_ps(dst + i + SSE_LEN_FLOAT, dst_tmp2);
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
+                v4sf src_tmp = _mm_load_ps(src + i);
+                v4sf src_tmp2 = _mm_load_ps(src + i + SSE_LEN_FLOAT);
+                v4sf dst_tmp = _mm_and_ps(*(v4sf *) _ps_pos_sign_mask, src_tmp);
+                v4sf dst_tmp2 = _mm_and_ps(*(v4sf *) _ps_pos_sign_mask, src_tmp2);
+                _mm_stream_ps(dst + i, dst_tmp);
+                _mm_stream_ps(dst + i + SSE_LEN_FLOAT, dst_tmp2);
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
+                v4sf src_tmp = _mm_load_ps(src + i);
+                v4sf src_tmp2 = _mm_load_ps(src + i + SSE_LEN_FLOAT);
+                v4sf dst_tmp = _mm_and_ps(*(v4sf *) _ps_pos_sign_mask, src_tmp);
+                v4sf dst_tmp2 = _mm_and_ps(*(v4sf *) _ps_pos_sign_mask, src_tmp2);
+                _mm_store_ps(dst + i, dst_tmp);
+                _mm_store_ps(dst + i + SSE_LEN_FLOAT, dst_tmp2);
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
@@ -529,7 +571,7 @@ static inline void fabs128f(float *src, float *dst, int len)
     }
 }
 
-static inline void set128f(float *dst, float value, int len)
+SIMD_UTILS_API void set128f(float *dst, float value, int len)
 {
     const v4sf tmp = _mm_set1_ps(value);
 
@@ -537,8 +579,15 @@ static inline void set128f(float *dst, float value, int len)
     stop_len *= SSE_LEN_FLOAT;
 
     if (isAligned((uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
-            _mm_store_ps(dst + i, tmp);
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
+                _mm_stream_ps(dst + i, tmp);
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
+                _mm_store_ps(dst + i, tmp);
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
@@ -552,7 +601,7 @@ static inline void set128f(float *dst, float value, int len)
 }
 
 // Could be better to just use set(0)
-static inline void zero128f(float *dst, int len)
+SIMD_UTILS_API void zero128f(float *dst, int len)
 {
     const v4sf tmp = _mm_setzero_ps();
 
@@ -560,11 +609,16 @@ static inline void zero128f(float *dst, int len)
     stop_len *= SSE_LEN_FLOAT;
 
     if (isAligned((uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
-            _mm_store_ps(dst + i, tmp);
-            //_mm_stream_si128(src + i, (__m128i)tmp);
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
+                _mm_stream_ps(dst + i, tmp);
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
+                _mm_store_ps(dst + i, tmp);
+            }
         }
-        //_mm_sfence();
     } else {
         for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
             _mm_storeu_ps(dst + i, tmp);
@@ -576,17 +630,27 @@ static inline void zero128f(float *dst, int len)
     }
 }
 
-static inline void copy128f(float *src, float *dst, int len)
+SIMD_UTILS_API void copy128f(float *src, float *dst, int len)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= (2 * SSE_LEN_FLOAT);
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
-            v4sf src_tmp = _mm_load_ps(src + i);
-            v4sf src_tmp2 = _mm_load_ps(src + i + SSE_LEN_FLOAT);
-            _mm_store_ps(dst + i, src_tmp);
-            _mm_store_ps(dst + i + SSE_LEN_FLOAT, src_tmp2);
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
+                v4sf src_tmp = _mm_load_ps(src + i);
+                v4sf src_tmp2 = _mm_load_ps(src + i + SSE_LEN_FLOAT);
+                _mm_stream_ps(dst + i, src_tmp);
+                _mm_stream_ps(dst + i + SSE_LEN_FLOAT, src_tmp2);
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
+                v4sf src_tmp = _mm_load_ps(src + i);
+                v4sf src_tmp2 = _mm_load_ps(src + i + SSE_LEN_FLOAT);
+                _mm_store_ps(dst + i, src_tmp);
+                _mm_store_ps(dst + i + SSE_LEN_FLOAT, src_tmp2);
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
@@ -602,7 +666,7 @@ static inline void copy128f(float *src, float *dst, int len)
     }
 }
 
-static inline void add128f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void add128f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= (2 * SSE_LEN_FLOAT);
@@ -637,7 +701,7 @@ static inline void add128f(float *src1, float *src2, float *dst, int len)
 }
 
 
-static inline void mul128f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void mul128f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= (2 * SSE_LEN_FLOAT);
@@ -671,7 +735,7 @@ static inline void mul128f(float *src1, float *src2, float *dst, int len)
     }
 }
 
-static inline void sub128f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void sub128f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= (2 * SSE_LEN_FLOAT);
@@ -707,7 +771,7 @@ static inline void sub128f(float *src1, float *src2, float *dst, int len)
 
 // TODO : "Immediate add/mul?"
 //  No need for subc, just use addc(-value)
-static inline void addc128f(float *src, float value, float *dst, int len)
+SIMD_UTILS_API void addc128f(float *src, float value, float *dst, int len)
 {
     const v4sf tmp = _mm_set1_ps(value);
 
@@ -739,7 +803,7 @@ static inline void addc128f(float *src, float value, float *dst, int len)
     }
 }
 
-static inline void mulc128f(float *src, float value, float *dst, int len)
+SIMD_UTILS_API void mulc128f(float *src, float value, float *dst, int len)
 {
     const v4sf tmp = _mm_set1_ps(value);
 
@@ -771,7 +835,7 @@ static inline void mulc128f(float *src, float value, float *dst, int len)
     }
 }
 
-static inline void muladd128f(float *_a, float *_b, float *_c, float *dst, int len)
+SIMD_UTILS_API void muladd128f(float *_a, float *_b, float *_c, float *dst, int len)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= (2 * SSE_LEN_FLOAT);
@@ -810,7 +874,7 @@ static inline void muladd128f(float *_a, float *_b, float *_c, float *dst, int l
     }
 }
 
-static inline void mulcadd128f(float *_a, float _b, float *_c, float *dst, int len)
+SIMD_UTILS_API void mulcadd128f(float *_a, float _b, float *_c, float *dst, int len)
 {
     v4sf b = _mm_set1_ps(_b);
 
@@ -836,7 +900,7 @@ static inline void mulcadd128f(float *_a, float _b, float *_c, float *dst, int l
     }
 }
 
-static inline void mulcaddc128f(float *_a, float _b, float _c, float *dst, int len)
+SIMD_UTILS_API void mulcaddc128f(float *_a, float _b, float _c, float *dst, int len)
 {
     v4sf b = _mm_set1_ps(_b);
     v4sf c = _mm_set1_ps(_c);
@@ -861,7 +925,7 @@ static inline void mulcaddc128f(float *_a, float _b, float _c, float *dst, int l
     }
 }
 
-static inline void muladdc128f(float *_a, float *_b, float _c, float *dst, int len)
+SIMD_UTILS_API void muladdc128f(float *_a, float *_b, float _c, float *dst, int len)
 {
     v4sf c = _mm_set1_ps(_c);
 
@@ -888,7 +952,7 @@ static inline void muladdc128f(float *_a, float *_b, float _c, float *dst, int l
 }
 
 // warning: src2 should have no 0.0f values
-static inline void div128f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void div128f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -909,7 +973,7 @@ static inline void div128f(float *src1, float *src2, float *dst, int len)
 }
 
 // TODO : remove previous index dependency to become Out Of Order
-static inline void vectorSlope128f(float *dst, int len, float offset, float slope)
+SIMD_UTILS_API void vectorSlope128f(float *dst, int len, float offset, float slope)
 {
     v4sf coef = _mm_set_ps(3.0f * slope, 2.0f * slope, slope, 0.0f);
     v4sf slope8_vec = _mm_set1_ps(8.0f * slope);
@@ -951,7 +1015,7 @@ static inline void vectorSlope128f(float *dst, int len, float offset, float slop
     }
 }
 
-static inline void convertFloat32ToU8_128(float *src, uint8_t *dst, int len, int rounding_mode, int scale_factor)
+SIMD_UTILS_API void convertFloat32ToU8_128(float *src, uint8_t *dst, int len, int rounding_mode, int scale_factor)
 {
     int stop_len = len / (4 * SSE_LEN_FLOAT);
     stop_len *= (4 * SSE_LEN_FLOAT);
@@ -1100,7 +1164,7 @@ static inline void convertFloat32ToU8_128(float *src, uint8_t *dst, int len, int
     }
 }
 
-static inline void convertFloat32ToI16_128(float *src, int16_t *dst, int len, int rounding_mode, int scale_factor)
+SIMD_UTILS_API void convertFloat32ToI16_128(float *src, int16_t *dst, int len, int rounding_mode, int scale_factor)
 {
     int stop_len = len / (4 * SSE_LEN_FLOAT);
     stop_len *= (4 * SSE_LEN_FLOAT);
@@ -1252,7 +1316,7 @@ static inline void convertFloat32ToI16_128(float *src, int16_t *dst, int len, in
     }
 }
 
-static inline void convertFloat32ToU16_128(float *src, uint16_t *dst, int len, int rounding_mode, int scale_factor)
+SIMD_UTILS_API void convertFloat32ToU16_128(float *src, uint16_t *dst, int len, int rounding_mode, int scale_factor)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= (2 * SSE_LEN_FLOAT);
@@ -1353,7 +1417,7 @@ static inline void convertFloat32ToU16_128(float *src, uint16_t *dst, int len, i
     }
 }
 
-static inline void convertInt16ToFloat32_128(int16_t *src, float *dst, int len, int scale_factor)
+SIMD_UTILS_API void convertInt16ToFloat32_128(int16_t *src, float *dst, int len, int scale_factor)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= (2 * SSE_LEN_FLOAT);
@@ -1399,7 +1463,7 @@ static inline void convertInt16ToFloat32_128(int16_t *src, float *dst, int len,
 }
 
 // Allow for integer up to 24bits without overflow
-static inline void convertInt32ToFloat32_128(int32_t *src, float *dst, int len, int scale_factor)
+SIMD_UTILS_API void convertInt32ToFloat32_128(int32_t *src, float *dst, int len, int scale_factor)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= (2 * SSE_LEN_FLOAT);
@@ -1437,7 +1501,7 @@ static inline void convertInt32ToFloat32_128(int32_t *src, float *dst, int len,
 }
 
 // converts 32bits complex float to two arrays real and im
-static inline void cplxtoreal128f(complex32_t *src, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxtoreal128f(complex32_t *src, float *dstRe, float *dstIm, int len)
 {
     int stop_len = 2 * len / (4 * SSE_LEN_FLOAT);
     stop_len *= 4 * SSE_LEN_FLOAT;
@@ -1471,7 +1535,7 @@ static inline void cplxtoreal128f(complex32_t *src, float *dstRe, float *dstIm,
     }
 }
 
-static inline void realtocplx128f(float *srcRe, float *srcIm, complex32_t *dst, int len)
+SIMD_UTILS_API void realtocplx128f(float *srcRe, float *srcIm, complex32_t *dst, int len)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= 2 * SSE_LEN_FLOAT;
@@ -1509,7 +1573,7 @@ static inline void realtocplx128f(float *srcRe, float *srcIm, complex32_t *dst,
     }
 }
 
-static inline void convert128_64f32f(double *src, float *dst, int len)
+SIMD_UTILS_API void convert128_64f32f(double *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -1537,7 +1601,7 @@ static inline void convert128_64f32f(double *src, float *dst, int len)
 
 // prefer 2 unaligned loads instead of shuffles
 #if 1
-static inline void convert128_32f64f(float *src, double *dst, int len)
+SIMD_UTILS_API void convert128_32f64f(float *src, double *dst, int len)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= (2 * SSE_LEN_FLOAT);
@@ -1579,7 +1643,7 @@ static inline void convert128_32f64f(float *src, double *dst, int len)
     }
 }
 #else
-static inline void convert128_32f64f(float *src, double *dst, int len)
+SIMD_UTILS_API void convert128_32f64f(float *src, double *dst, int len)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= (2 * SSE_LEN_FLOAT);
@@ -1622,7 +1686,7 @@ static inline void convert128_32f64f(float *src, double *dst, int len)
 }
 #endif
 
-static inline void flip128f(float *src, float *dst, int len)
+SIMD_UTILS_API void flip128f(float *src, float *dst, int len)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= (2 * SSE_LEN_FLOAT);
@@ -1657,7 +1721,7 @@ static inline void flip128f(float *src, float *dst, int len)
     }
 }
 
-static inline void maxevery128f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void maxevery128f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= (2 * SSE_LEN_FLOAT);
@@ -1691,7 +1755,7 @@ static inline void maxevery128f(float *src1, float *src2, float *dst, int len)
     }
 }
 
-static inline void minevery128f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void minevery128f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= (2 * SSE_LEN_FLOAT);
@@ -1726,7 +1790,7 @@ static inline void minevery128f(float *src1, float *src2, float *dst, int len)
 }
 
 
-static inline void minmax128f(float *src, int len, float *min_value, float *max_value)
+SIMD_UTILS_API void minmax128f(float *src, int len, float *min_value, float *max_value)
 {
     int stop_len = (len - SSE_LEN_FLOAT) / (2 * SSE_LEN_FLOAT);
     stop_len *= (2 * SSE_LEN_FLOAT);
@@ -1776,11 +1840,11 @@ static inline void minmax128f(float *src, int len, float *min_value, float *max_
 
 #if 1
         v4sf max3 = _mm_shuffle_ps(max_v, max_v, _MM_SHUFFLE(0,1,2,3));
-        v4sf min3 = _mm_shuffle_ps(max_v, max_v, _MM_SHUFFLE(0,1,2,3));
+        v4sf min3 = _mm_shuffle_ps(min_v, min_v, _MM_SHUFFLE(0,1,2,3));
         v4sf max4 = _mm_max_ps(max3, max_v);
         v4sf min4 = _mm_min_ps(min3, min_v);
-        max3 = _mm_shuffle_ps(max4, max4, _MM_SHUFFLE(1,0,1,0));
-        min3 = _mm_shuffle_ps(min4, min4, _MM_SHUFFLE(1,0,1,0));
+        max3 = _mm_shuffle_ps(max4, max4, _MM_SHUFFLE(2,3,0,1));
+        min3 = _mm_shuffle_ps(min4, min4, _MM_SHUFFLE(2,3,0,1));
         max4 = _mm_max_ps(max3, max4);
         min4 = _mm_min_ps(min3, min4);
         _mm_store_ss(&max_tmp, max4);
@@ -1813,7 +1877,7 @@ static inline void minmax128f(float *src, int len, float *min_value, float *max_
 }
 
 
-static inline void threshold128_gt_f(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold128_gt_f(float *src, float *dst, int len, float value)
 {
     const v4sf tmp = _mm_set1_ps(value);
 
@@ -1847,7 +1911,7 @@ static inline void threshold128_gt_f(float *src, float *dst, int len, float valu
 
 // Alternate version
 #if 1
-static inline void threshold128_gtabs_f(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold128_gtabs_f(float *src, float *dst, int len, float value)
 {
     const v4sf pval = _mm_set1_ps(value);
 
@@ -1895,7 +1959,7 @@ static inline void threshold128_gtabs_f(float *src, float *dst, int len, float v
     }
 }
 #else
-static inline void threshold128_gtabs_f(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold128_gtabs_f(float *src, float *dst, int len, float value)
 {
     const v4sf pval = _mm_set1_ps(value);
     const v4sf mval = _mm_set1_ps(-value);
@@ -1949,7 +2013,7 @@ static inline void threshold128_gtabs_f(float *src, float *dst, int len, float v
 }
 #endif
 
-static inline void threshold128_lt_f(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold128_lt_f(float *src, float *dst, int len, float value)
 {
     const v4sf tmp = _mm_set1_ps(value);
 
@@ -1984,7 +2048,7 @@ static inline void threshold128_lt_f(float *src, float *dst, int len, float valu
 // Alternate version
 #if 1
 
-static inline void threshold128_ltabs_f(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold128_ltabs_f(float *src, float *dst, int len, float value)
 {
     const v4sf pval = _mm_set1_ps(value);
 
@@ -2032,7 +2096,7 @@ static inline void threshold128_ltabs_f(float *src, float *dst, int len, float v
     }
 }
 #else
-static inline void threshold128_ltabs_f(float *src, float *dst, int len, float value)
+SIMD_UTILS_API void threshold128_ltabs_f(float *src, float *dst, int len, float value)
 {
     const v4sf pval = _mm_set1_ps(value);
     const v4sf mval = _mm_set1_ps(-value);
@@ -2086,7 +2150,7 @@ static inline void threshold128_ltabs_f(float *src, float *dst, int len, float v
 }
 #endif
 
-static inline void threshold128_ltval_gtval_f(float *src, float *dst, int len, float ltlevel, float ltvalue, float gtlevel, float gtvalue)
+SIMD_UTILS_API void threshold128_ltval_gtval_f(float *src, float *dst, int len, float ltlevel, float ltvalue, float gtlevel, float gtvalue)
 {
     const v4sf ltlevel_v = _mm_set1_ps(ltlevel);
     const v4sf ltvalue_v = _mm_set1_ps(ltvalue);
@@ -2135,15 +2199,23 @@ static inline void threshold128_ltval_gtval_f(float *src, float *dst, int len, f
     }
 }
 
-static inline void sin128f(float *src, float *dst, int len)
+SIMD_UTILS_API void sin128f(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
-            v4sf src_tmp = _mm_load_ps(src + i);
-            _mm_store_ps(dst + i, sin_ps(src_tmp));
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
+                v4sf src_tmp = _mm_load_ps(src + i);
+                _mm_stream_ps(dst + i, sin_ps(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
+                v4sf src_tmp = _mm_load_ps(src + i);
+                _mm_store_ps(dst + i, sin_ps(src_tmp));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
@@ -2157,15 +2229,23 @@ static inline void sin128f(float *src, float *dst, int len)
     }
 }
 
-static inline void cos128f(float *src, float *dst, int len)
+SIMD_UTILS_API void cos128f(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
-            v4sf src_tmp = _mm_load_ps(src + i);
-            _mm_store_ps(dst + i, cos_ps(src_tmp));
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
+                v4sf src_tmp = _mm_load_ps(src + i);
+                _mm_stream_ps(dst + i, cos_ps(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
+                v4sf src_tmp = _mm_load_ps(src + i);
+                _mm_store_ps(dst + i, cos_ps(src_tmp));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
@@ -2179,7 +2259,7 @@ static inline void cos128f(float *src, float *dst, int len)
     }
 }
 
-static inline void sincos128f(float *src, float *dst_sin, float *dst_cos, int len)
+SIMD_UTILS_API void sincos128f(float *src, float *dst_sin, float *dst_cos, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -2210,7 +2290,7 @@ static inline void sincos128f(float *src, float *dst_sin, float *dst_cos, int le
 }
 
 // e^ix = cos(x) + i*sin(x)
-static inline void sincos128f_interleaved(float *src, complex32_t *dst, int len)
+SIMD_UTILS_API void sincos128f_interleaved(float *src, complex32_t *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -2255,7 +2335,7 @@ static inline v4sf coshf_ps(v4sf xx)
     return y;
 }
 
-static inline void cosh128f(float *src, float *dst, int len)
+SIMD_UTILS_API void cosh128f(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -2320,7 +2400,7 @@ static inline v4sf sinhf_ps(v4sf x)
     return (z);
 }
 
-static inline void sinh128f(float *src, float *dst, int len)
+SIMD_UTILS_API void sinh128f(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -2381,7 +2461,7 @@ static inline v4sf acoshf_ps(v4sf x)
     return z;
 }
 
-static inline void acosh128f(float *src, float *dst, int len)
+SIMD_UTILS_API void acosh128f(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -2436,7 +2516,7 @@ static inline v4sf asinhf_ps(v4sf xx)
     return z;
 }
 
-static inline void asinh128f(float *src, float *dst, int len)
+SIMD_UTILS_API void asinh128f(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -2496,7 +2576,7 @@ static inline v4sf atanhf_ps(v4sf x)
     return (z);
 }
 
-static inline void atanh128f(float *src, float *dst, int len)
+SIMD_UTILS_API void atanh128f(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -2557,7 +2637,7 @@ static inline v4sf atanf_ps(v4sf xx)
     return (y);
 }
 
-static inline void atan128f(float *src, float *dst, int len)
+SIMD_UTILS_API void atan128f(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -2625,7 +2705,7 @@ static inline v4sf atan2f_ps(v4sf y, v4sf x)
     return (z);
 }
 
-static inline void atan2128f(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void atan2128f(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -2646,7 +2726,7 @@ static inline void atan2128f(float *src1, float *src2, float *dst, int len)
 }
 
 
-static inline void atan2128f_interleaved(complex32_t *src, float *dst, int len)
+SIMD_UTILS_API void atan2128f_interleaved(complex32_t *src, float *dst, int len)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= 2 * SSE_LEN_FLOAT;
@@ -2718,7 +2798,7 @@ static inline v4sf asinf_ps(v4sf xx)
     return (z);
 }
 
-static inline void asin128f(float *src, float *dst, int len)
+SIMD_UTILS_API void asin128f(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -2778,7 +2858,7 @@ static inline v4sf tanhf_ps(v4sf xx)
     return (z);
 }
 
-static inline void tanh128f(float *src, float *dst, int len)
+SIMD_UTILS_API void tanh128f(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -2871,15 +2951,23 @@ static inline v4sf tanf_ps(v4sf xx)
     return (y);
 }
 
-static inline void tan128f(float *src, float *dst, int len)
+SIMD_UTILS_API void tan128f(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
-            v4sf src_tmp = _mm_load_ps(src + i);
-            _mm_store_ps(dst + i, tanf_ps(src_tmp));
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
+                v4sf src_tmp = _mm_load_ps(src + i);
+                _mm_stream_ps(dst + i, tanf_ps(src_tmp));
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
+                v4sf src_tmp = _mm_load_ps(src + i);
+                _mm_store_ps(dst + i, tanf_ps(src_tmp));
+            }
         }
     } else {
         for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
@@ -2893,7 +2981,7 @@ static inline void tan128f(float *src, float *dst, int len)
     }
 }
 
-static inline void tan128f_naive(float *src, float *dst, int len)
+SIMD_UTILS_API void tan128f_naive(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -2919,7 +3007,7 @@ static inline void tan128f_naive(float *src, float *dst, int len)
     }
 }
 
-static inline void magnitude128f_split(float *srcRe, float *srcIm, float *dst, int len)
+SIMD_UTILS_API void magnitude128f_split(float *srcRe, float *srcIm, float *dst, int len)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= (2 * SSE_LEN_FLOAT);
@@ -2961,7 +3049,7 @@ static inline void magnitude128f_split(float *srcRe, float *srcIm, float *dst, i
     }
 }
 
-static inline void powerspect128f_split(float *srcRe, float *srcIm, float *dst, int len)
+SIMD_UTILS_API void powerspect128f_split(float *srcRe, float *srcIm, float *dst, int len)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= (2 * SSE_LEN_FLOAT);
@@ -3001,7 +3089,7 @@ static inline void powerspect128f_split(float *srcRe, float *srcIm, float *dst,
 
 // Old version
 #if 0
-static inline void magnitude128f_interleaved(complex32_t *src, float *dst, int len)
+SIMD_UTILS_API void magnitude128f_interleaved(complex32_t *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -3034,7 +3122,7 @@ static inline void magnitude128f_interleaved(complex32_t *src, float *dst, int l
     }
 }
 
-static inline void powerspect128f_interleaved(complex32_t *src, float *dst, int len)
+SIMD_UTILS_API void powerspect128f_interleaved(complex32_t *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -3071,7 +3159,7 @@ static inline void powerspect128f_interleaved(complex32_t *src, float *dst, int
 
 // 10% faster on Atom? And on newer CPU?
 // On ARM 32bits, we could call vmla instead of mul + add
-static inline void magnitude128f_interleaved(complex32_t *src, float *dst, int len)
+SIMD_UTILS_API void magnitude128f_interleaved(complex32_t *src, float *dst, int len)
 {
     int stop_len = len / (4 * SSE_LEN_FLOAT);
     stop_len *= 4 * SSE_LEN_FLOAT;
@@ -3140,7 +3228,7 @@ static inline void magnitude128f_interleaved(complex32_t *src, float *dst, int l
     }
 }
 
-static inline void powerspect128f_interleaved(complex32_t *src, float *dst, int len)
+SIMD_UTILS_API void powerspect128f_interleaved(complex32_t *src, float *dst, int len)
 {
     int stop_len = len / (4 * SSE_LEN_FLOAT);
     stop_len *= 4 * SSE_LEN_FLOAT;
@@ -3200,7 +3288,7 @@ static inline void powerspect128f_interleaved(complex32_t *src, float *dst, int
 }
 #endif
 
-static inline void subcrev128f(float *src, float value, float *dst, int len)
+SIMD_UTILS_API void subcrev128f(float *src, float value, float *dst, int len)
 {
     const v4sf tmp = _mm_set1_ps(value);
 
@@ -3222,7 +3310,7 @@ static inline void subcrev128f(float *src, float value, float *dst, int len)
     }
 }
 
-static inline void sum128f(float *src, float *dst, int len)
+SIMD_UTILS_API void sum128f(float *src, float *dst, int len)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= (2 * SSE_LEN_FLOAT);
@@ -3259,80 +3347,14 @@ static inline void sum128f(float *src, float *dst, int len)
     *dst = tmp_acc;
 }
 
-static inline void mean128f(float *src, float *dst, int len)
+SIMD_UTILS_API void mean128f(float *src, float *dst, int len)
 {
     float coeff = 1.0f / ((float) len);
     sum128f(src, dst, len);
     *dst *= coeff;
 }
 
-
-static inline void sumkahan128f(float *src, float *dst, int len)
-{
-    int stop_len = len / (2 * SSE_LEN_FLOAT);
-    stop_len *= (2 * SSE_LEN_FLOAT);
-
-    __attribute__((aligned(SSE_LEN_BYTES))) float accumulate[SSE_LEN_FLOAT] = {0.0f, 0.0f, 0.0f, 0.0f};
-
-    float tmp_acc = 0.0f;
-    v4sf vec_acc1 = _mm_setzero_ps();  // initialize the vector accumulator
-    v4sf vec_acc2 = _mm_setzero_ps();  // initialize the vector accumulator
-    v4sf vec_cor1 = _mm_setzero_ps();  // initialize the vector accumulator
-    v4sf vec_cor2 = _mm_setzero_ps();  // initialize the vector accumulator
-
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
-            v4sf value1 = _mm_load_ps(src + i);
-            v4sf y1 = _mm_sub_ps(value1, vec_cor1);
-            v4sf t1 = _mm_add_ps(vec_acc1, y1);
-            vec_cor1 = _mm_sub_ps(t1, vec_acc1);
-            vec_cor1 = _mm_sub_ps(vec_cor1, y1);
-            vec_acc1 = t1;
-
-            v4sf value2 = _mm_load_ps(src + i + SSE_LEN_FLOAT);
-            v4sf y2 = _mm_sub_ps(value2, vec_cor2);
-            v4sf t2 = _mm_add_ps(vec_acc2, y2);
-            vec_cor2 = _mm_sub_ps(t2, vec_acc2);
-            vec_cor2 = _mm_sub_ps(vec_cor2, y2);
-            vec_acc2 = t2;
-        }
-    } else {
-        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
-            v4sf value1 = _mm_loadu_ps(src + i);
-            v4sf y1 = _mm_sub_ps(value1, vec_cor1);
-            v4sf t1 = _mm_add_ps(vec_acc1, y1);
-            vec_cor1 = _mm_sub_ps(t1, vec_acc1);
-            vec_cor1 = _mm_sub_ps(vec_cor1, y1);
-            vec_acc1 = t1;
-
-            v4sf value2 = _mm_loadu_ps(src + i + SSE_LEN_FLOAT);
-            v4sf y2 = _mm_sub_ps(value2, vec_cor2);
-            v4sf t2 = _mm_add_ps(vec_acc2, y2);
-            vec_cor2 = _mm_sub_ps(t2, vec_acc2);
-            vec_cor2 = _mm_sub_ps(vec_cor2, y2);
-            vec_acc2 = t2;
-        }
-    }
-    vec_acc1 = _mm_add_ps(vec_acc1, vec_acc2);
-    _mm_store_ps(accumulate, vec_acc1);
-
-    for (int i = stop_len; i < len; i++) {
-        tmp_acc += src[i];
-    }
-
-    tmp_acc = tmp_acc + accumulate[0] + accumulate[1] + accumulate[2] + accumulate[3];
-
-    *dst = tmp_acc;
-}
-
-static inline void meankahan128f(float *src, float *dst, int len)
-{
-    float coeff = 1.0f / ((float) len);
-    sumkahan128f(src, dst, len);
-    *dst *= coeff;
-}
-
-static inline void dot128f(float *src1, float *src2, int len, float *dst)
+SIMD_UTILS_API void dot128f(float *src1, float *src2, int len, float *dst)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= (2 * SSE_LEN_FLOAT);
@@ -3373,7 +3395,7 @@ static inline void dot128f(float *src1, float *src2, int len, float *dst)
     *dst = tmp_acc;
 }
 
-static inline void dotc128f(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst)
+SIMD_UTILS_API void dotc128f(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst)
 {
     int stop_len = len / (4 * SSE_LEN_FLOAT);
     stop_len *= (4 * SSE_LEN_FLOAT);
@@ -3451,151 +3473,1050 @@ static inline void dotc128f(complex32_t *src1, complex32_t *src2, int len, compl
     dst->im = dst_tmp.im;
 }
 
-static inline void sqrt128f(float *src, float *dst, int len)
+// *acc + *cor += value, *cor gathers the rounding errors of the additions (TwoSum, see simd_utils_sum.h)
+static inline void kahan_add128f(v4sf *acc, v4sf *cor, v4sf value)
+{
+    v4sf t = _mm_add_ps(*acc, value);
+    v4sf bp = _mm_sub_ps(t, *acc);
+    v4sf err = _mm_add_ps(_mm_sub_ps(*acc, _mm_sub_ps(t, bp)), _mm_sub_ps(value, bp));
+    *cor = _mm_add_ps(*cor, err);
+    *acc = t;
+}
+
+SIMD_UTILS_API void sumkahan128f(float *src, float *dst, int len)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= (2 * SSE_LEN_FLOAT);
 
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+    __attribute__((aligned(SSE_LEN_BYTES))) float accumulate[2 * SSE_LEN_FLOAT];
+    __attribute__((aligned(SSE_LEN_BYTES))) float correction[2 * SSE_LEN_FLOAT];
+    float tmp_acc = 0.0f;
+    float tmp_cor = 0.0f;
+    v4sf vec_acc1 = _mm_setzero_ps();  // initialize the vector accumulator
+    v4sf vec_acc2 = _mm_setzero_ps();  // initialize the vector accumulator
+    v4sf vec_cor1 = _mm_setzero_ps();  // rounding errors of the accumulator
+    v4sf vec_cor2 = _mm_setzero_ps();  // rounding errors of the accumulator
+
+    if (isAligned((uintptr_t) (src), SSE_LEN_BYTES)) {
         for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
-            v4sf src_tmp = _mm_load_ps(src + i);
-            v4sf src_tmp2 = _mm_load_ps(src + i + SSE_LEN_FLOAT);
-            v4sf dst_tmp = _mm_sqrt_ps(src_tmp);
-            v4sf dst_tmp2 = _mm_sqrt_ps(src_tmp2);
-            _mm_store_ps(dst + i, dst_tmp);
-            _mm_store_ps(dst + i + SSE_LEN_FLOAT, dst_tmp2);
+            kahan_add128f(&vec_acc1, &vec_cor1, _mm_load_ps(src + i));
+            kahan_add128f(&vec_acc2, &vec_cor2, _mm_load_ps(src + i + SSE_LEN_FLOAT));
         }
     } else {
         for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
-            v4sf src_tmp = _mm_loadu_ps(src + i);
-            v4sf src_tmp2 = _mm_loadu_ps(src + i + SSE_LEN_FLOAT);
-            v4sf dst_tmp = _mm_sqrt_ps(src_tmp);
-            v4sf dst_tmp2 = _mm_sqrt_ps(src_tmp2);
-            _mm_storeu_ps(dst + i, dst_tmp);
-            _mm_storeu_ps(dst + i + SSE_LEN_FLOAT, dst_tmp2);
+            kahan_add128f(&vec_acc1, &vec_cor1, _mm_loadu_ps(src + i));
+            kahan_add128f(&vec_acc2, &vec_cor2, _mm_loadu_ps(src + i + SSE_LEN_FLOAT));
         }
     }
 
+    _mm_store_ps(accumulate, vec_acc1);
+    _mm_store_ps(accumulate + SSE_LEN_FLOAT, vec_acc2);
+    _mm_store_ps(correction, vec_cor1);
+    _mm_store_ps(correction + SSE_LEN_FLOAT, vec_cor2);
+    kahan_foldf(accumulate, correction, 2 * SSE_LEN_FLOAT, &tmp_acc, &tmp_cor);
+
     for (int i = stop_len; i < len; i++) {
-        dst[i] = sqrtf(src[i]);
+        kahan_addf(&tmp_acc, &tmp_cor, src[i]);
     }
+
+    *dst = tmp_acc + tmp_cor;
 }
 
-//rounds away from zero like IPP, whereas SSE/AVx/AVX512 rounds to nearest even (IEEE-754)
-static inline void rint128f(float *src, float *dst, int len)
+SIMD_UTILS_API void meankahan128f(float *src, float *dst, int len)
+{
+    float coeff = 1.0f / ((float) len);
+    sumkahan128f(src, dst, len);
+    *dst *= coeff;
+}
+
+/* The rounding errors of the products are prod - src1 * src2 computed with a FMA,
+ * they are 0 without FMA (only the additions are compensated) */
+SIMD_UTILS_API void dotkahan128f(float *src1, float *src2, int len, float *dst)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= (2 * SSE_LEN_FLOAT);
 
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+    __attribute__((aligned(SSE_LEN_BYTES))) float accumulate[2 * SSE_LEN_FLOAT];
+    __attribute__((aligned(SSE_LEN_BYTES))) float correction[2 * SSE_LEN_FLOAT];
+    float tmp_acc = 0.0f;
+    float tmp_cor = 0.0f;
+    v4sf vec_acc1 = _mm_setzero_ps();  // initialize the vector accumulator
+    v4sf vec_acc2 = _mm_setzero_ps();  // initialize the vector accumulator
+    v4sf vec_cor1 = _mm_setzero_ps();  // rounding errors of the accumulator
+    v4sf vec_cor2 = _mm_setzero_ps();  // rounding errors of the accumulator
+
+    if (areAligned2((uintptr_t) (src1), (uintptr_t) (src2), SSE_LEN_BYTES)) {
         for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
-            v4sf src_tmp = _mm_load_ps(src + i);
-            v4sf src_tmp2 = _mm_load_ps(src + i + SSE_LEN_FLOAT);
-            v4sf dst_tmp = _mm_round_ps(src_tmp, ROUNDTONEAREST);
-            v4sf dst_tmp2 = _mm_round_ps(src_tmp2, ROUNDTONEAREST);
-            _mm_store_ps(dst + i, dst_tmp);
-            _mm_store_ps(dst + i + SSE_LEN_FLOAT, dst_tmp2);
+            v4sf vec_src1_tmp = _mm_load_ps(src1 + i);
+            v4sf vec_src1_tmp2 = _mm_load_ps(src1 + i + SSE_LEN_FLOAT);
+            v4sf vec_src2_tmp = _mm_load_ps(src2 + i);
+            v4sf vec_src2_tmp2 = _mm_load_ps(src2 + i + SSE_LEN_FLOAT);
+            v4sf prod = _mm_mul_ps(vec_src1_tmp, vec_src2_tmp);
+            v4sf prod2 = _mm_mul_ps(vec_src1_tmp2, vec_src2_tmp2);
+            kahan_add128f(&vec_acc1, &vec_cor1, prod);
+            kahan_add128f(&vec_acc2, &vec_cor2, prod2);
+            vec_cor1 = _mm_sub_ps(vec_cor1, _mm_fnmadd_ps_custom(vec_src1_tmp, vec_src2_tmp, prod));
+            vec_cor2 = _mm_sub_ps(vec_cor2, _mm_fnmadd_ps_custom(vec_src1_tmp2, vec_src2_tmp2, prod2));
         }
     } else {
         for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
-            v4sf src_tmp = _mm_loadu_ps(src + i);
-            v4sf src_tmp2 = _mm_loadu_ps(src + i + SSE_LEN_FLOAT);
-            v4sf dst_tmp = _mm_round_ps(src_tmp, ROUNDTONEAREST);
-            v4sf dst_tmp2 = _mm_round_ps(src_tmp2, ROUNDTONEAREST);
-            _mm_storeu_ps(dst + i, dst_tmp);
-            _mm_storeu_ps(dst + i + SSE_LEN_FLOAT, dst_tmp2);
+            v4sf vec_src1_tmp = _mm_loadu_ps(src1 + i);
+            v4sf vec_src1_tmp2 = _mm_loadu_ps(src1 + i + SSE_LEN_FLOAT);
+            v4sf vec_src2_tmp = _mm_loadu_ps(src2 + i);
+            v4sf vec_src2_tmp2 = _mm_loadu_ps(src2 + i + SSE_LEN_FLOAT);
+            v4sf prod = _mm_mul_ps(vec_src1_tmp, vec_src2_tmp);
+            v4sf prod2 = _mm_mul_ps(vec_src1_tmp2, vec_src2_tmp2);
+            kahan_add128f(&vec_acc1, &vec_cor1, prod);
+            kahan_add128f(&vec_acc2, &vec_cor2, prod2);
+            vec_cor1 = _mm_sub_ps(vec_cor1, _mm_fnmadd_ps_custom(vec_src1_tmp, vec_src2_tmp, prod));
+            vec_cor2 = _mm_sub_ps(vec_cor2, _mm_fnmadd_ps_custom(vec_src1_tmp2, vec_src2_tmp2, prod2));
         }
     }
 
+    _mm_store_ps(accumulate, vec_acc1);
+    _mm_store_ps(accumulate + SSE_LEN_FLOAT, vec_acc2);
+    _mm_store_ps(correction, vec_cor1);
+    _mm_store_ps(correction + SSE_LEN_FLOAT, vec_cor2);
+    kahan_foldf(accumulate, correction, 2 * SSE_LEN_FLOAT, &tmp_acc, &tmp_cor);
+
     for (int i = stop_len; i < len; i++) {
-        dst[i] = rintf(src[i]);
+        kahan_addf(&tmp_acc, &tmp_cor, src1[i] * src2[i]);
     }
+
+    *dst = tmp_acc + tmp_cor;
 }
 
-//rounds away from zero like IPP, whereas SSE/AVx/AVX512 rounds to nearest even (IEEE-754)
-static inline void round128f(float *src, float *dst, int len)
+SIMD_UTILS_API void dotckahan128f(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst)
 {
-    int stop_len = len / (2 * SSE_LEN_FLOAT);
-    stop_len *= (2 * SSE_LEN_FLOAT);
+    int stop_len = len / (4 * SSE_LEN_FLOAT);
+    stop_len *= (4 * SSE_LEN_FLOAT);
 
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
-            v4sf src_tmp = _mm_load_ps(src + i);
-            v4sf src_tmp2 = _mm_load_ps(src + i + SSE_LEN_FLOAT);
-            v4sf spe1 = _mm_and_ps(src_tmp, *(v4sf*)_ps_sign_mask);
-            spe1 = _mm_or_ps(spe1,*(v4sf*)_ps_mid_mask);
-            spe1 = _mm_add_ps(src_tmp, spe1);
-            v4sf spe2 = _mm_and_ps(src_tmp2, *(v4sf*)_ps_sign_mask);
-            spe2 = _mm_or_ps(spe2,*(v4sf*)_ps_mid_mask);
-            spe2 = _mm_add_ps(src_tmp2, spe2);
-            v4sf dst_tmp = _mm_round_ps(spe1, ROUNDTOZERO);
-            v4sf dst_tmp2 = _mm_round_ps(spe2, ROUNDTOZERO);
-            _mm_store_ps(dst + i, dst_tmp);
-            _mm_store_ps(dst + i + SSE_LEN_FLOAT, dst_tmp2);
+    __attribute__((aligned(SSE_LEN_BYTES))) float accumulateRe[2 * SSE_LEN_FLOAT];
+    __attribute__((aligned(SSE_LEN_BYTES))) float accumulateIm[2 * SSE_LEN_FLOAT];
+    __attribute__((aligned(SSE_LEN_BYTES))) float correctionRe[2 * SSE_LEN_FLOAT];
+    __attribute__((aligned(SSE_LEN_BYTES))) float correctionIm[2 * SSE_LEN_FLOAT];
+    complex32_t dst_tmp = {0.0f, 0.0f};
+    complex32_t dst_cor = {0.0f, 0.0f};
+    v4sfx2 vec_acc1 = {{_mm_setzero_ps(), _mm_setzero_ps()}};  // initialize the vector accumulator
+    v4sfx2 vec_acc2 = {{_mm_setzero_ps(), _mm_setzero_ps()}};  // initialize the vector accumulator
+    v4sfx2 vec_cor1 = {{_mm_setzero_ps(), _mm_setzero_ps()}};  // rounding errors of the accumulator
+    v4sfx2 vec_cor2 = {{_mm_setzero_ps(), _mm_setzero_ps()}};  // rounding errors of the accumulator
+
+    //  (ac -bd) + i(ad + bc)
+    if (areAligned2((uintptr_t) (src1), (uintptr_t) (src2), SSE_LEN_BYTES)) {
+        for (int i = 0; i < 2 * stop_len; i += 4 * SSE_LEN_FLOAT) {
+            v4sfx2 src1_split = _mm_load2_ps((float *) (src1) + i);  // a0a1, b0b1
+            v4sfx2 src2_split = _mm_load2_ps((float *) (src2) + i);  // c0c1, d0d1
+            v4sfx2 src1_split2 = _mm_load2_ps((float *) (src1) + i + 2 * SSE_LEN_FLOAT);
+            v4sfx2 src2_split2 = _mm_load2_ps((float *) (src2) + i + 2 * SSE_LEN_FLOAT);
+            v4sf ac = _mm_mul_ps(src1_split.val[0], src2_split.val[0]);     // ac
+            v4sf ad = _mm_mul_ps(src1_split.val[0], src2_split.val[1]);     // ad
+            v4sf ac2 = _mm_mul_ps(src1_split2.val[0], src2_split2.val[0]);  // ac
+            v4sf ad2 = _mm_mul_ps(src1_split2.val[0], src2_split2.val[1]);  // ad
+            kahan_add128f(&vec_acc1.val[0], &vec_cor1.val[0], _mm_fnmadd_ps_custom(src1_split.val[1], src2_split.val[1], ac));
+            kahan_add128f(&vec_acc1.val[1], &vec_cor1.val[1], _mm_fmadd_ps_custom(src1_split.val[1], src2_split.val[0], ad));
+            kahan_add128f(&vec_acc2.val[0], &vec_cor2.val[0], _mm_fnmadd_ps_custom(src1_split2.val[1], src2_split2.val[1], ac2));
+            kahan_add128f(&vec_acc2.val[1], &vec_cor2.val[1], _mm_fmadd_ps_custom(src1_split2.val[1], src2_split2.val[0], ad2));
         }
     } else {
-        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
-            v4sf src_tmp = _mm_loadu_ps(src + i);
-            v4sf src_tmp2 = _mm_loadu_ps(src + i + SSE_LEN_FLOAT);
-            v4sf spe1 = _mm_and_ps(src_tmp, *(v4sf*)_ps_sign_mask);
-            spe1 = _mm_or_ps(spe1,*(v4sf*)_ps_mid_mask);
-            spe1 = _mm_add_ps(src_tmp, spe1);
-            v4sf spe2 = _mm_and_ps(src_tmp2, *(v4sf*)_ps_sign_mask);
-            spe2 = _mm_or_ps(spe2,*(v4sf*)_ps_mid_mask);
-            spe2 = _mm_add_ps(src_tmp2, spe2);
-            v4sf dst_tmp = _mm_round_ps(spe1, ROUNDTOZERO);
-            v4sf dst_tmp2 = _mm_round_ps(spe2, ROUNDTOZERO);
-            _mm_storeu_ps(dst + i, dst_tmp);
-            _mm_storeu_ps(dst + i + SSE_LEN_FLOAT, dst_tmp2);
+        for (int i = 0; i < 2 * stop_len; i += 4 * SSE_LEN_FLOAT) {
+            v4sfx2 src1_split = _mm_load2u_ps((float *) (src1) + i);  // a0a1, b0b1
+            v4sfx2 src2_split = _mm_load2u_ps((float *) (src2) + i);  // c0c1, d0d1
+            v4sfx2 src1_split2 = _mm_load2u_ps((float *) (src1) + i + 2 * SSE_LEN_FLOAT);
+            v4sfx2 src2_split2 = _mm_load2u_ps((float *) (src2) + i + 2 * SSE_LEN_FLOAT);
+            v4sf ac = _mm_mul_ps(src1_split.val[0], src2_split.val[0]);     // ac
+            v4sf ad = _mm_mul_ps(src1_split.val[0], src2_split.val[1]);     // ad
+            v4sf ac2 = _mm_mul_ps(src1_split2.val[0], src2_split2.val[0]);  // ac
+            v4sf ad2 = _mm_mul_ps(src1_split2.val[0], src2_split2.val[1]);  // ad
+            kahan_add128f(&vec_acc1.val[0], &vec_cor1.val[0], _mm_fnmadd_ps_custom(src1_split.val[1], src2_split.val[1], ac));
+            kahan_add128f(&vec_acc1.val[1], &vec_cor1.val[1], _mm_fmadd_ps_custom(src1_split.val[1], src2_split.val[0], ad));
+            kahan_add128f(&vec_acc2.val[0], &vec_cor2.val[0], _mm_fnmadd_ps_custom(src1_split2.val[1], src2_split2.val[1], ac2));
+            kahan_add128f(&vec_acc2.val[1], &vec_cor2.val[1], _mm_fmadd_ps_custom(src1_split2.val[1], src2_split2.val[0], ad2));
         }
     }
 
+    _mm_store_ps(accumulateRe, vec_acc1.val[0]);
+    _mm_store_ps(accumulateRe + SSE_LEN_FLOAT, vec_acc2.val[0]);
+    _mm_store_ps(accumulateIm, vec_acc1.val[1]);
+    _mm_store_ps(accumulateIm + SSE_LEN_FLOAT, vec_acc2.val[1]);
+    _mm_store_ps(correctionRe, vec_cor1.val[0]);
+    _mm_store_ps(correctionRe + SSE_LEN_FLOAT, vec_cor2.val[0]);
+    _mm_store_ps(correctionIm, vec_cor1.val[1]);
+    _mm_store_ps(correctionIm + SSE_LEN_FLOAT, vec_cor2.val[1]);
+    kahan_foldf(accumulateRe, correctionRe, 2 * SSE_LEN_FLOAT, &dst_tmp.re, &dst_cor.re);
+    kahan_foldf(accumulateIm, correctionIm, 2 * SSE_LEN_FLOAT, &dst_tmp.im, &dst_cor.im);
+
     for (int i = stop_len; i < len; i++) {
-        dst[i] = roundf(src[i]);
+        kahan_addf(&dst_tmp.re, &dst_cor.re, src1[i].re * src2[i].re - (src1[i].im * src2[i].im));
+        kahan_addf(&dst_tmp.im, &dst_cor.im, src1[i].re * src2[i].im + (src2[i].re * src1[i].im));
     }
+
+    dst->re = dst_tmp.re + dst_cor.re;
+    dst->im = dst_tmp.im + dst_cor.im;
+}
+
+SIMD_UTILS_API void sumpairwise128f(float *src, float *dst, int len)
+{
+    *dst = sum_pairwisef(src, len, sum128f);
+}
+
+SIMD_UTILS_API void meanpairwise128f(float *src, float *dst, int len)
+{
+    float coeff = 1.0f / ((float) len);
+    sumpairwise128f(src, dst, len);
+    *dst *= coeff;
+}
+
+SIMD_UTILS_API void dotpairwise128f(float *src1, float *src2, int len, float *dst)
+{
+    *dst = dot_pairwisef(src1, src2, len, dot128f);
 }
 
-static inline void ceil128f(float *src, float *dst, int len)
+SIMD_UTILS_API void dotcpairwise128f(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst)
+{
+    *dst = dotc_pairwisef(src1, src2, len, dotc128f);
+}
+
+// sums of the powers of (src[i] - shift), see simd_utils_moments.h
+static inline void centered_sums128f(float *src, int len, float shift, double *sums)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= (2 * SSE_LEN_FLOAT);
 
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+    __attribute__((aligned(SSE_LEN_BYTES))) float accumulate[4 * SSE_LEN_FLOAT];
+    v4sf shift_vec = _mm_set1_ps(shift);
+    v4sf sum1_1 = _mm_setzero_ps(), sum1_2 = _mm_setzero_ps();  // d
+    v4sf sum2_1 = _mm_setzero_ps(), sum2_2 = _mm_setzero_ps();  // d^2
+    v4sf sum3_1 = _mm_setzero_ps(), sum3_2 = _mm_setzero_ps();  // d^3
+    v4sf sum4_1 = _mm_setzero_ps(), sum4_2 = _mm_setzero_ps();  // d^4
+
+    if (isAligned((uintptr_t) (src), SSE_LEN_BYTES)) {
         for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
-            v4sf src_tmp = _mm_load_ps(src + i);
-            v4sf src_tmp2 = _mm_load_ps(src + i + SSE_LEN_FLOAT);
-            v4sf dst_tmp = _mm_round_ps(src_tmp, ROUNDTOCEIL);
-            v4sf dst_tmp2 = _mm_round_ps(src_tmp2, ROUNDTOCEIL);
-            _mm_store_ps(dst + i, dst_tmp);
-            _mm_store_ps(dst + i + SSE_LEN_FLOAT, dst_tmp2);
+            v4sf d1 = _mm_sub_ps(_mm_load_ps(src + i), shift_vec);
+            v4sf d2 = _mm_sub_ps(_mm_load_ps(src + i + SSE_LEN_FLOAT), shift_vec);
+            v4sf sq1 = _mm_mul_ps(d1, d1);
+            v4sf sq2 = _mm_mul_ps(d2, d2);
+            sum1_1 = _mm_add_ps(sum1_1, d1);
+            sum1_2 = _mm_add_ps(sum1_2, d2);
+            sum2_1 = _mm_add_ps(sum2_1, sq1);
+            sum2_2 = _mm_add_ps(sum2_2, sq2);
+            sum3_1 = _mm_fmadd_ps_custom(sq1, d1, sum3_1);
+            sum3_2 = _mm_fmadd_ps_custom(sq2, d2, sum3_2);
+            sum4_1 = _mm_fmadd_ps_custom(sq1, sq1, sum4_1);
+            sum4_2 = _mm_fmadd_ps_custom(sq2, sq2, sum4_2);
         }
     } else {
         for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
-            v4sf src_tmp = _mm_loadu_ps(src + i);
-            v4sf src_tmp2 = _mm_loadu_ps(src + i + SSE_LEN_FLOAT);
-            v4sf dst_tmp = _mm_round_ps(src_tmp, ROUNDTOCEIL);
-            v4sf dst_tmp2 = _mm_round_ps(src_tmp2, ROUNDTOCEIL);
-            _mm_storeu_ps(dst + i, dst_tmp);
-            _mm_storeu_ps(dst + i + SSE_LEN_FLOAT, dst_tmp2);
+            v4sf d1 = _mm_sub_ps(_mm_loadu_ps(src + i), shift_vec);
+            v4sf d2 = _mm_sub_ps(_mm_loadu_ps(src + i + SSE_LEN_FLOAT), shift_vec);
+            v4sf sq1 = _mm_mul_ps(d1, d1);
+            v4sf sq2 = _mm_mul_ps(d2, d2);
+            sum1_1 = _mm_add_ps(sum1_1, d1);
+            sum1_2 = _mm_add_ps(sum1_2, d2);
+            sum2_1 = _mm_add_ps(sum2_1, sq1);
+            sum2_2 = _mm_add_ps(sum2_2, sq2);
+            sum3_1 = _mm_fmadd_ps_custom(sq1, d1, sum3_1);
+            sum3_2 = _mm_fmadd_ps_custom(sq2, d2, sum3_2);
+            sum4_1 = _mm_fmadd_ps_custom(sq1, sq1, sum4_1);
+            sum4_2 = _mm_fmadd_ps_custom(sq2, sq2, sum4_2);
+        }
+    }
+
+    _mm_store_ps(accumulate, _mm_add_ps(sum1_1, sum1_2));
+    _mm_store_ps(accumulate + SSE_LEN_FLOAT, _mm_add_ps(sum2_1, sum2_2));
+    _mm_store_ps(accumulate + 2 * SSE_LEN_FLOAT, _mm_add_ps(sum3_1, sum3_2));
+    _mm_store_ps(accumulate + 3 * SSE_LEN_FLOAT, _mm_add_ps(sum4_1, sum4_2));
+
+    for (int k = 0; k < 4; k++) {
+        sums[k] = 0.0;
+        for (int i = 0; i < SSE_LEN_FLOAT; i++) {
+            sums[k] += (double) accumulate[k * SSE_LEN_FLOAT + i];
         }
     }
 
     for (int i = stop_len; i < len; i++) {
-        dst[i] = ceilf(src[i]);
+        double d = (double) (src[i] - shift);
+        double sq = d * d;
+        sums[0] += d;
+        sums[1] += sq;
+        sums[2] += sq * d;
+        sums[3] += sq * sq;
     }
 }
 
-static inline void floor128f(float *src, float *dst, int len)
+SIMD_UTILS_API void moments128f(float *src, int len, moments_t *m)
 {
-    int stop_len = len / (2 * SSE_LEN_FLOAT);
-    stop_len *= (2 * SSE_LEN_FLOAT);
+    moments_runf(src, len, sum128f, centered_sums128f, m);
+}
 
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
-            v4sf src_tmp = _mm_load_ps(src + i);
-            v4sf src_tmp2 = _mm_load_ps(src + i + SSE_LEN_FLOAT);
-            v4sf dst_tmp = _mm_round_ps(src_tmp, ROUNDTOFLOOR);
-            v4sf dst_tmp2 = _mm_round_ps(src_tmp2, ROUNDTOFLOOR);
+// inclusive prefix sum of the lanes of x
+static inline v4sf prefix_lanes128f(v4sf x)
+{
+    x = _mm_add_ps(x, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 4)));
+    x = _mm_add_ps(x, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 8)));
+    return x;
+}
+
+// last lane of x in all the lanes
+static inline v4sf last_lane128f(v4sf x)
+{
+    return _mm_shuffle_ps(x, x, _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+// lanes of x moved up by one, the first lane getting the last lane of prev
+static inline v4sf shift_lane128f(v4sf x, v4sf prev)
+{
+    return _mm_castsi128_ps(_mm_alignr_epi8(_mm_castps_si128(x), _mm_castps_si128(prev), 12));
+}
+
+// prefix sums of src (see simd_utils.h), exclusive when exclusive is set
+static inline void prefixsum128f_run(float *src, float *dst, int len, float *carry, int exclusive)
+{
+    int stop_len = len / (2 * SSE_LEN_FLOAT);
+    stop_len *= (2 * SSE_LEN_FLOAT);
+
+    v4sf carry_vec = _mm_set1_ps(carry ? *carry : 0.0f);
+
+    // the carry only waits for one add per pair of vectors
+    for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
+        v4sf a = prefix_lanes128f(_mm_loadu_ps(src + i));
+        v4sf b = prefix_lanes128f(_mm_loadu_ps(src + i + SSE_LEN_FLOAT));
+        b = _mm_add_ps(b, last_lane128f(a));
+        v4sf last = last_lane128f(b);
+        a = _mm_add_ps(a, carry_vec);
+        b = _mm_add_ps(b, carry_vec);
+        if (exclusive) {
+            _mm_storeu_ps(dst + i, shift_lane128f(a, carry_vec));
+            _mm_storeu_ps(dst + i + SSE_LEN_FLOAT, shift_lane128f(b, a));
+        } else {
+            _mm_storeu_ps(dst + i, a);
+            _mm_storeu_ps(dst + i + SSE_LEN_FLOAT, b);
+        }
+        carry_vec = _mm_add_ps(carry_vec, last);
+    }
+
+    float carry_tmp = _mm_cvtss_f32(carry_vec);
+    for (int i = stop_len; i < len; i++) {
+        float x = src[i];
+        if (exclusive) {
+            dst[i] = carry_tmp;
+            carry_tmp = carry_tmp + x;
+        } else {
+            carry_tmp = carry_tmp + x;
+            dst[i] = carry_tmp;
+        }
+    }
+
+    if (carry)
+        *carry = carry_tmp;
+}
+
+SIMD_UTILS_API void prefixsum128f(float *src, float *dst, int len, float *carry)
+{
+    prefixsum128f_run(src, dst, len, carry, 0);
+}
+
+SIMD_UTILS_API void prefixsum128f_excl(float *src, float *dst, int len, float *carry)
+{
+    prefixsum128f_run(src, dst, len, carry, 1);
+}
+
+SIMD_UTILS_API void diff128f(float *src, float *dst, int len, float *prev)
+{
+    int stop_len = len / (2 * SSE_LEN_FLOAT);
+    stop_len *= (2 * SSE_LEN_FLOAT);
+
+    float prev_tmp = prev ? *prev : 0.0f;
+    float last = (len > 0) ? src[len - 1] : prev_tmp;  // before src is overwritten by dst
+    v4sf prev_vec = _mm_set1_ps(prev_tmp);
+
+    for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
+        v4sf a = _mm_loadu_ps(src + i);
+        v4sf b = _mm_loadu_ps(src + i + SSE_LEN_FLOAT);
+        _mm_storeu_ps(dst + i, _mm_sub_ps(a, shift_lane128f(a, prev_vec)));
+        _mm_storeu_ps(dst + i + SSE_LEN_FLOAT, _mm_sub_ps(b, shift_lane128f(b, a)));
+        prev_vec = b;
+    }
+
+    if (stop_len > 0)
+        prev_tmp = _mm_cvtss_f32(last_lane128f(prev_vec));
+    for (int i = stop_len; i < len; i++) {
+        float x = src[i];
+        dst[i] = x - prev_tmp;
+        prev_tmp = x;
+    }
+
+    if (prev)
+        *prev = last;
+}
+
+// bins of histogram128f, nb_bins outside of the bins (see simd_utils_hist.h)
+static inline void bins128f(float *src, int len, float low, float high, float scale, int nb_bins, int32_t *bins)
+{
+    int stop_len = len / SSE_LEN_FLOAT;
+    stop_len *= SSE_LEN_FLOAT;
+
+    v4sf low_vec = _mm_set1_ps(low);
+    v4sf high_vec = _mm_set1_ps(high);
+    v4sf scale_vec = _mm_set1_ps(scale);
+    v4si last_vec = _mm_set1_epi32(nb_bins - 1);
+    v4si out_vec = _mm_set1_epi32(nb_bins);
+
+    if (isAligned((uintptr_t) (src), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
+            v4sf x = _mm_load_ps(src + i);
+            v4sf in = _mm_and_ps(_mm_cmpge_ps(x, low_vec), _mm_cmple_ps(x, high_vec));
+            v4si bin = _mm_cvttps_epi32(_mm_mul_ps(_mm_sub_ps(x, low_vec), scale_vec));
+            bin = _mm_min_epi32(bin, last_vec);
+            _mm_store_si128((v4si *) (bins + i), _mm_blendv_epi8(out_vec, bin, _mm_castps_si128(in)));
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
+            v4sf x = _mm_loadu_ps(src + i);
+            v4sf in = _mm_and_ps(_mm_cmpge_ps(x, low_vec), _mm_cmple_ps(x, high_vec));
+            v4si bin = _mm_cvttps_epi32(_mm_mul_ps(_mm_sub_ps(x, low_vec), scale_vec));
+            bin = _mm_min_epi32(bin, last_vec);
+            _mm_store_si128((v4si *) (bins + i), _mm_blendv_epi8(out_vec, bin, _mm_castps_si128(in)));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        bins[i] = hist_binf(src[i], low, high, scale, nb_bins);
+    }
+}
+
+SIMD_UTILS_API void histogram128f(float *src, int len, float low, float high, int nb_bins, uint32_t *hist)
+{
+    hist_state_t st;
+    float scale = hist_scalef(low, high, nb_bins);
+
+    hist_begin(&st, hist, nb_bins);
+    for (int start = 0; start < len; start += HIST_BLOCK_LEN) {
+        int block_len = hist_block_len(len, start);
+        bins128f(src + start, block_len, low, high, scale, nb_bins, st.bins);
+        hist_count(&st, block_len);
+    }
+    hist_end(&st);
+}
+
+// bins of histogram128f_edges, binary search of all the lanes at once
+static inline void bins128f_edges(float *src, int len, float *edges, int nb_bins, int step, int32_t *bins)
+{
+    int stop_len = len / SSE_LEN_FLOAT;
+    stop_len *= SSE_LEN_FLOAT;
+
+    __attribute__((aligned(SSE_LEN_BYTES))) int32_t idx[SSE_LEN_INT32];
+    v4sf first_vec = _mm_set1_ps(edges[0]);
+    v4sf end_vec = _mm_set1_ps(edges[nb_bins]);
+    v4si last_vec = _mm_set1_epi32(nb_bins - 1);
+    v4si out_vec = _mm_set1_epi32(nb_bins);
+
+    if (isAligned((uintptr_t) (src), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
+            v4sf x = _mm_load_ps(src + i);
+            v4sf in = _mm_and_ps(_mm_cmpge_ps(x, first_vec), _mm_cmple_ps(x, end_vec));
+            v4si pos = _mm_setzero_si128();
+            for (int s = step; s > 0; s >>= 1) {
+                v4si cand = _mm_add_epi32(pos, _mm_set1_epi32(s));
+                v4si valid = _mm_cmpgt_epi32(out_vec, cand);  // cand < nb_bins
+                _mm_store_si128((v4si *) idx, _mm_min_epi32(cand, last_vec));
+                v4sf e = _mm_setr_ps(edges[idx[0]], edges[idx[1]], edges[idx[2]], edges[idx[3]]);
+                v4si take = _mm_and_si128(valid, _mm_castps_si128(_mm_cmple_ps(e, x)));
+                pos = _mm_blendv_epi8(pos, cand, take);
+            }
+            _mm_store_si128((v4si *) (bins + i), _mm_blendv_epi8(out_vec, pos, _mm_castps_si128(in)));
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += SSE_LEN_FLOAT) {
+            v4sf x = _mm_loadu_ps(src + i);
+            v4sf in = _mm_and_ps(_mm_cmpge_ps(x, first_vec), _mm_cmple_ps(x, end_vec));
+            v4si pos = _mm_setzero_si128();
+            for (int s = step; s > 0; s >>= 1) {
+                v4si cand = _mm_add_epi32(pos, _mm_set1_epi32(s));
+                v4si valid = _mm_cmpgt_epi32(out_vec, cand);  // cand < nb_bins
+                _mm_store_si128((v4si *) idx, _mm_min_epi32(cand, last_vec));
+                v4sf e = _mm_setr_ps(edges[idx[0]], edges[idx[1]], edges[idx[2]], edges[idx[3]]);
+                v4si take = _mm_and_si128(valid, _mm_castps_si128(_mm_cmple_ps(e, x)));
+                pos = _mm_blendv_epi8(pos, cand, take);
+            }
+            _mm_store_si128((v4si *) (bins + i), _mm_blendv_epi8(out_vec, pos, _mm_castps_si128(in)));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        bins[i] = hist_bin_edgesf(src[i], edges, nb_bins, step);
+    }
+}
+
+SIMD_UTILS_API void histogram128f_edges(float *src, int len, float *edges, int nb_bins, uint32_t *hist)
+{
+    hist_state_t st;
+    int step = hist_edges_step(nb_bins);
+
+    hist_begin(&st, hist, nb_bins);
+    for (int start = 0; start < len; start += HIST_BLOCK_LEN) {
+        int block_len = hist_block_len(len, start);
+        bins128f_edges(src + start, block_len, edges, nb_bins, step, st.bins);
+        hist_count(&st, block_len);
+    }
+    hist_end(&st);
+}
+
+// bitonic sort of the lanes of x
+static inline v4sf sort_lanes128f(v4sf x)
+{
+    v4sf p;
+    p = _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm_blend_ps(_mm_min_ps(x, p), _mm_max_ps(x, p), 0x6);
+    p = _mm_shuffle_ps(x, x, _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm_blend_ps(_mm_min_ps(x, p), _mm_max_ps(x, p), 0xC);
+    p = _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm_blend_ps(_mm_min_ps(x, p), _mm_max_ps(x, p), 0xA);
+    return x;
+}
+
+// sorts the lanes of x, which are a bitonic sequence
+static inline v4sf sort_clean128f(v4sf x)
+{
+    v4sf p;
+    p = _mm_shuffle_ps(x, x, _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm_blend_ps(_mm_min_ps(x, p), _mm_max_ps(x, p), 0xC);
+    p = _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm_blend_ps(_mm_min_ps(x, p), _mm_max_ps(x, p), 0xA);
+    return x;
+}
+
+// merges the sorted vectors a and b, a getting the lowest half
+static inline void sort_merge2128f(v4sf *a, v4sf *b)
+{
+    v4sf rev = _mm_shuffle_ps(*b, *b, _MM_SHUFFLE(0, 1, 2, 3));
+    v4sf low = _mm_min_ps(*a, rev);
+    v4sf high = _mm_max_ps(*a, rev);
+    *a = sort_clean128f(low);
+    *b = sort_clean128f(high);
+}
+
+// merges the sorted sequences (a, b) and (c, d)
+static inline void sort_merge4128f(v4sf *a, v4sf *b, v4sf *c, v4sf *d)
+{
+    v4sf rev_c = _mm_shuffle_ps(*d, *d, _MM_SHUFFLE(0, 1, 2, 3));
+    v4sf rev_d = _mm_shuffle_ps(*c, *c, _MM_SHUFFLE(0, 1, 2, 3));
+    v4sf low0 = _mm_min_ps(*a, rev_c);
+    v4sf high0 = _mm_max_ps(*a, rev_c);
+    v4sf low1 = _mm_min_ps(*b, rev_d);
+    v4sf high1 = _mm_max_ps(*b, rev_d);
+    *a = sort_clean128f(_mm_min_ps(low0, low1));
+    *b = sort_clean128f(_mm_max_ps(low0, low1));
+    *c = sort_clean128f(_mm_min_ps(high0, high1));
+    *d = sort_clean128f(_mm_max_ps(high0, high1));
+}
+
+// sorts up to 4 vectors, padded with the largest value
+static inline void sort_small128f(float *src, int len)
+{
+    float tmp[4 * SSE_LEN_FLOAT] __attribute__((aligned(SSE_LEN_BYTES)));
+
+    memcpy(tmp, src, len * sizeof(float));
+    for (int i = len; i < 4 * SSE_LEN_FLOAT; i++) {
+        tmp[i] = INFINITY;
+    }
+
+    v4sf a = sort_lanes128f(_mm_loadu_ps(tmp));
+    if (len <= SSE_LEN_FLOAT) {
+        _mm_storeu_ps(tmp, a);
+    } else if (len <= 2 * SSE_LEN_FLOAT) {
+        v4sf b = sort_lanes128f(_mm_loadu_ps(tmp + SSE_LEN_FLOAT));
+        sort_merge2128f(&a, &b);
+        _mm_storeu_ps(tmp, a);
+        _mm_storeu_ps(tmp + SSE_LEN_FLOAT, b);
+    } else {
+        v4sf b = sort_lanes128f(_mm_loadu_ps(tmp + SSE_LEN_FLOAT));
+        v4sf c = sort_lanes128f(_mm_loadu_ps(tmp + 2 * SSE_LEN_FLOAT));
+        v4sf d = sort_lanes128f(_mm_loadu_ps(tmp + 3 * SSE_LEN_FLOAT));
+        sort_merge2128f(&a, &b);
+        sort_merge2128f(&c, &d);
+        sort_merge4128f(&a, &b, &c, &d);
+        _mm_storeu_ps(tmp, a);
+        _mm_storeu_ps(tmp + SSE_LEN_FLOAT, b);
+        _mm_storeu_ps(tmp + 2 * SSE_LEN_FLOAT, c);
+        _mm_storeu_ps(tmp + 3 * SSE_LEN_FLOAT, d);
+    }
+
+    memcpy(src, tmp, len * sizeof(float));
+}
+
+// packs the lanes of x lower than the pivot to [*left_w, ...) and the others to [..., *right_w)
+static inline void partition_store128f(float *src, v4sf x, v4sf pivot_vec, int *left_w, int *right_w)
+{
+    int mask = _mm_movemask_ps(_mm_cmplt_ps(x, pivot_vec));
+    int nb_low = __builtin_popcount(mask);
+    v4si shuf = _mm_load_si128((v4si *) sort_shuffle4_lut[mask]);
+    v4sf packed = _mm_castsi128_ps(_mm_shuffle_epi8(_mm_castps_si128(x), shuf));
+
+    // the full vector is stored on both ends (free space of a vector at least on each end)
+    _mm_storeu_ps(src + *left_w, packed);
+    _mm_storeu_ps(src + *right_w - SSE_LEN_FLOAT, packed);
+    *left_w += nb_low;
+    *right_w -= SSE_LEN_FLOAT - nb_low;
+}
+
+// number of elements lower than pivot, moved to the beginning of src (len >= 2 * SSE_LEN_FLOAT)
+static inline int partition128f(float *src, int len, float pivot)
+{
+    v4sf pivot_vec = _mm_set1_ps(pivot);
+    v4sf first = _mm_loadu_ps(src);
+    v4sf last = _mm_loadu_ps(src + len - SSE_LEN_FLOAT);
+    int left = SSE_LEN_FLOAT, right = len - 2 * SSE_LEN_FLOAT;  // next vectors read from each end
+    int left_w = 0, right_w = len;             // free space [left_w, left) and [right + SSE_LEN_FLOAT, right_w)
+
+    while (left <= right) {
+        v4sf x;
+        if ((left - left_w) <= (right_w - right - SSE_LEN_FLOAT)) {
+            x = _mm_loadu_ps(src + left);
+            left += SSE_LEN_FLOAT;
+        } else {
+            x = _mm_loadu_ps(src + right);
+            right -= SSE_LEN_FLOAT;
+        }
+        partition_store128f(src, x, pivot_vec, &left_w, &right_w);
+    }
+
+    // the last elements (less than a vector) with the first and the last vectors
+    float tmp[3 * SSE_LEN_FLOAT];
+    int nb_tmp = right + SSE_LEN_FLOAT - left;
+    memcpy(tmp, src + left, nb_tmp * sizeof(float));
+    _mm_storeu_ps(tmp + nb_tmp, first);
+    _mm_storeu_ps(tmp + nb_tmp + SSE_LEN_FLOAT, last);
+    sort_partition_tailf(src, tmp, nb_tmp + 2 * SSE_LEN_FLOAT, pivot, &left_w, &right_w);
+    return left_w;
+}
+
+SIMD_UTILS_API void sort128f(float *src, int len)
+{
+    sort_runf(src, len, 4 * SSE_LEN_FLOAT, partition128f, sort_small128f);
+}
+
+// bitonic sort of the lanes of the keys k, with their values v
+static inline void sort_lanes128f_kv(v4sf *k, v4si *v)
+{
+    v4sf pk;
+    v4si pv;
+    v4sf lt, gt, take;
+    pk = _mm_shuffle_ps(*k, *k, _MM_SHUFFLE(2, 3, 0, 1));
+    pv = _mm_shuffle_epi32(*v, _MM_SHUFFLE(2, 3, 0, 1));
+    lt = _mm_cmplt_ps(pk, *k);
+    gt = _mm_cmpgt_ps(pk, *k);
+    take = _mm_blend_ps(lt, gt, 0x6);
+    *k = _mm_blendv_ps(*k, pk, take);
+    *v = _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(*v), _mm_castsi128_ps(pv), take));
+    pk = _mm_shuffle_ps(*k, *k, _MM_SHUFFLE(1, 0, 3, 2));
+    pv = _mm_shuffle_epi32(*v, _MM_SHUFFLE(1, 0, 3, 2));
+    lt = _mm_cmplt_ps(pk, *k);
+    gt = _mm_cmpgt_ps(pk, *k);
+    take = _mm_blend_ps(lt, gt, 0xC);
+    *k = _mm_blendv_ps(*k, pk, take);
+    *v = _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(*v), _mm_castsi128_ps(pv), take));
+    pk = _mm_shuffle_ps(*k, *k, _MM_SHUFFLE(2, 3, 0, 1));
+    pv = _mm_shuffle_epi32(*v, _MM_SHUFFLE(2, 3, 0, 1));
+    lt = _mm_cmplt_ps(pk, *k);
+    gt = _mm_cmpgt_ps(pk, *k);
+    take = _mm_blend_ps(lt, gt, 0xA);
+    *k = _mm_blendv_ps(*k, pk, take);
+    *v = _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(*v), _mm_castsi128_ps(pv), take));
+}
+
+// sorts the lanes of the keys k, which are a bitonic sequence, with their values v
+static inline void sort_clean128f_kv(v4sf *k, v4si *v)
+{
+    v4sf pk;
+    v4si pv;
+    v4sf lt, gt, take;
+    pk = _mm_shuffle_ps(*k, *k, _MM_SHUFFLE(1, 0, 3, 2));
+    pv = _mm_shuffle_epi32(*v, _MM_SHUFFLE(1, 0, 3, 2));
+    lt = _mm_cmplt_ps(pk, *k);
+    gt = _mm_cmpgt_ps(pk, *k);
+    take = _mm_blend_ps(lt, gt, 0xC);
+    *k = _mm_blendv_ps(*k, pk, take);
+    *v = _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(*v), _mm_castsi128_ps(pv), take));
+    pk = _mm_shuffle_ps(*k, *k, _MM_SHUFFLE(2, 3, 0, 1));
+    pv = _mm_shuffle_epi32(*v, _MM_SHUFFLE(2, 3, 0, 1));
+    lt = _mm_cmplt_ps(pk, *k);
+    gt = _mm_cmpgt_ps(pk, *k);
+    take = _mm_blend_ps(lt, gt, 0xA);
+    *k = _mm_blendv_ps(*k, pk, take);
+    *v = _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(*v), _mm_castsi128_ps(pv), take));
+}
+
+// low = min(a, b), high = max(a, b) of the keys, with their values
+static inline void sort_minmax128f_kv(v4sf ka, v4si va, v4sf kb, v4si vb, v4sf *k_low, v4si *v_low, v4sf *k_high, v4si *v_high)
+{
+    v4sf take = _mm_cmplt_ps(kb, ka);
+    *k_low = _mm_blendv_ps(ka, kb, take);
+    *v_low = _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(va), _mm_castsi128_ps(vb), take));
+    *k_high = _mm_blendv_ps(kb, ka, take);
+    *v_high = _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(vb), _mm_castsi128_ps(va), take));
+}
+
+// merges the sorted vectors a and b, a getting the lowest half
+static inline void sort_merge2128f_kv(v4sf *ka, v4si *va, v4sf *kb, v4si *vb)
+{
+    sort_minmax128f_kv(*ka, *va, _mm_shuffle_ps(*kb, *kb, _MM_SHUFFLE(0, 1, 2, 3)), _mm_shuffle_epi32(*vb, _MM_SHUFFLE(0, 1, 2, 3)), ka, va, kb, vb);
+    sort_clean128f_kv(ka, va);
+    sort_clean128f_kv(kb, vb);
+}
+
+// merges the sorted sequences (a, b) and (c, d)
+static inline void sort_merge4128f_kv(v4sf *ka, v4si *va, v4sf *kb, v4si *vb, v4sf *kc, v4si *vc, v4sf *kd, v4si *vd)
+{
+    v4sf k_low0, k_high0, k_low1, k_high1;
+    v4si v_low0, v_high0, v_low1, v_high1;
+    sort_minmax128f_kv(*ka, *va, _mm_shuffle_ps(*kd, *kd, _MM_SHUFFLE(0, 1, 2, 3)), _mm_shuffle_epi32(*vd, _MM_SHUFFLE(0, 1, 2, 3)), &k_low0, &v_low0, &k_high0, &v_high0);
+    sort_minmax128f_kv(*kb, *vb, _mm_shuffle_ps(*kc, *kc, _MM_SHUFFLE(0, 1, 2, 3)), _mm_shuffle_epi32(*vc, _MM_SHUFFLE(0, 1, 2, 3)), &k_low1, &v_low1, &k_high1, &v_high1);
+    sort_minmax128f_kv(k_low0, v_low0, k_low1, v_low1, ka, va, kb, vb);
+    sort_minmax128f_kv(k_high0, v_high0, k_high1, v_high1, kc, vc, kd, vd);
+    sort_clean128f_kv(ka, va);
+    sort_clean128f_kv(kb, vb);
+    sort_clean128f_kv(kc, vc);
+    sort_clean128f_kv(kd, vd);
+}
+
+// sorts up to 4 vectors, padded with +inf keys (insertion sort if there are +inf keys, which could be swapped with the padding)
+static inline void sort_small128f_kv(float *keys, int32_t *values, int len)
+{
+    float tmp_keys[4 * SSE_LEN_FLOAT] __attribute__((aligned(SSE_LEN_BYTES)));
+    int32_t tmp_values[4 * SSE_LEN_FLOAT] __attribute__((aligned(SSE_LEN_BYTES)));
+
+    for (int i = 0; i < len; i++) {
+        if (keys[i] == INFINITY) {
+            insertion_sortf_kv(keys, values, len);
+            return;
+        }
+    }
+    memcpy(tmp_keys, keys, len * sizeof(float));
+    memcpy(tmp_values, values, len * sizeof(int32_t));
+    for (int i = len; i < 4 * SSE_LEN_FLOAT; i++) {
+        tmp_keys[i] = INFINITY;
+        tmp_values[i] = 0;
+    }
+
+    v4sf ka = _mm_loadu_ps(tmp_keys), kb, kc, kd;
+    v4si va = _mm_loadu_si128((v4si *) (tmp_values)), vb, vc, vd;
+    sort_lanes128f_kv(&ka, &va);
+    if (len > SSE_LEN_FLOAT) {
+        kb = _mm_loadu_ps(tmp_keys + SSE_LEN_FLOAT);
+        vb = _mm_loadu_si128((v4si *) (tmp_values + SSE_LEN_FLOAT));
+        sort_lanes128f_kv(&kb, &vb);
+        sort_merge2128f_kv(&ka, &va, &kb, &vb);
+        _mm_storeu_ps(tmp_keys + SSE_LEN_FLOAT, kb);
+        _mm_storeu_si128((v4si *) (tmp_values + SSE_LEN_FLOAT), vb);
+    }
+    if (len > 2 * SSE_LEN_FLOAT) {
+        kc = _mm_loadu_ps(tmp_keys + 2 * SSE_LEN_FLOAT);
+        vc = _mm_loadu_si128((v4si *) (tmp_values + 2 * SSE_LEN_FLOAT));
+        kd = _mm_loadu_ps(tmp_keys + 3 * SSE_LEN_FLOAT);
+        vd = _mm_loadu_si128((v4si *) (tmp_values + 3 * SSE_LEN_FLOAT));
+        sort_lanes128f_kv(&kc, &vc);
+        sort_lanes128f_kv(&kd, &vd);
+        sort_merge2128f_kv(&kc, &vc, &kd, &vd);
+        sort_merge4128f_kv(&ka, &va, &kb, &vb, &kc, &vc, &kd, &vd);
+        _mm_storeu_ps(tmp_keys + SSE_LEN_FLOAT, kb);
+        _mm_storeu_si128((v4si *) (tmp_values + SSE_LEN_FLOAT), vb);
+        _mm_storeu_ps(tmp_keys + 2 * SSE_LEN_FLOAT, kc);
+        _mm_storeu_si128((v4si *) (tmp_values + 2 * SSE_LEN_FLOAT), vc);
+        _mm_storeu_ps(tmp_keys + 3 * SSE_LEN_FLOAT, kd);
+        _mm_storeu_si128((v4si *) (tmp_values + 3 * SSE_LEN_FLOAT), vd);
+    }
+    _mm_storeu_ps(tmp_keys, ka);
+    _mm_storeu_si128((v4si *) (tmp_values), va);
+
+    memcpy(keys, tmp_keys, len * sizeof(float));
+    memcpy(values, tmp_values, len * sizeof(int32_t));
+}
+
+// packs the keys lower than the pivot (with their values) to [*left_w, ...) and the others to [..., *right_w)
+static inline void partition_store128f_kv(float *keys, int32_t *values, v4sf k, v4si v, v4sf pivot_vec, int *left_w, int *right_w)
+{
+    int mask = _mm_movemask_ps(_mm_cmplt_ps(k, pivot_vec));
+    int nb_low = __builtin_popcount(mask);
+    v4si shuf = _mm_load_si128((v4si *) sort_shuffle4_lut[mask]);
+    v4sf packed_k = _mm_castsi128_ps(_mm_shuffle_epi8(_mm_castps_si128(k), shuf));
+    v4si packed_v = _mm_shuffle_epi8(v, shuf);
+
+    _mm_storeu_ps(keys + *left_w, packed_k);
+    _mm_storeu_si128((v4si *) (values + *left_w), packed_v);
+    _mm_storeu_ps(keys + *right_w - SSE_LEN_FLOAT, packed_k);
+    _mm_storeu_si128((v4si *) (values + *right_w - SSE_LEN_FLOAT), packed_v);
+    *left_w += nb_low;
+    *right_w -= SSE_LEN_FLOAT - nb_low;
+}
+
+// number of keys lower than pivot, moved to the beginning of keys with their values (len >= 2 * SSE_LEN_FLOAT)
+static inline int partition128f_kv(float *keys, int32_t *values, int len, float pivot)
+{
+    v4sf pivot_vec = _mm_set1_ps(pivot);
+    v4sf first_k = _mm_loadu_ps(keys);
+    v4si first_v = _mm_loadu_si128((v4si *) (values));
+    v4sf last_k = _mm_loadu_ps(keys + len - SSE_LEN_FLOAT);
+    v4si last_v = _mm_loadu_si128((v4si *) (values + len - SSE_LEN_FLOAT));
+    int left = SSE_LEN_FLOAT, right = len - 2 * SSE_LEN_FLOAT;  // next vectors read from each end
+    int left_w = 0, right_w = len;             // free space [left_w, left) and [right + SSE_LEN_FLOAT, right_w)
+
+    while (left <= right) {
+        v4sf k;
+        v4si v;
+        if ((left - left_w) <= (right_w - right - SSE_LEN_FLOAT)) {
+            k = _mm_loadu_ps(keys + left);
+            v = _mm_loadu_si128((v4si *) (values + left));
+            left += SSE_LEN_FLOAT;
+        } else {
+            k = _mm_loadu_ps(keys + right);
+            v = _mm_loadu_si128((v4si *) (values + right));
+            right -= SSE_LEN_FLOAT;
+        }
+        partition_store128f_kv(keys, values, k, v, pivot_vec, &left_w, &right_w);
+    }
+
+    // the last elements (less than a vector) with the first and the last vectors
+    float tmp_keys[3 * SSE_LEN_FLOAT];
+    int32_t tmp_values[3 * SSE_LEN_FLOAT];
+    int nb_tmp = right + SSE_LEN_FLOAT - left;
+    memcpy(tmp_keys, keys + left, nb_tmp * sizeof(float));
+    memcpy(tmp_values, values + left, nb_tmp * sizeof(int32_t));
+    _mm_storeu_ps(tmp_keys + nb_tmp, first_k);
+    _mm_storeu_si128((v4si *) (tmp_values + nb_tmp), first_v);
+    _mm_storeu_ps(tmp_keys + nb_tmp + SSE_LEN_FLOAT, last_k);
+    _mm_storeu_si128((v4si *) (tmp_values + nb_tmp + SSE_LEN_FLOAT), last_v);
+    sort_partition_tailf_kv(keys, values, tmp_keys, tmp_values, nb_tmp + 2 * SSE_LEN_FLOAT, pivot, &left_w, &right_w);
+    return left_w;
+}
+
+SIMD_UTILS_API void sort128f_kv(float *keys, int32_t *values, int len)
+{
+    sort_runf_kv(keys, values, len, 4 * SSE_LEN_FLOAT, partition128f_kv, sort_small128f_kv);
+}
+
+// indices of the elements of src greater than threshold (see simd_utils_topk.h)
+static inline int filter_gt128f(float *src, int len, float threshold, int32_t *idx)
+{
+    int stop_len = len / (2 * SSE_LEN_FLOAT);
+    stop_len *= (2 * SSE_LEN_FLOAT);
+    v4sf thr = _mm_set1_ps(threshold);
+    int nb = 0;
+
+    for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
+        v4sf x0 = _mm_loadu_ps(src + i);
+        v4sf x1 = _mm_loadu_ps(src + i + SSE_LEN_FLOAT);
+        uint32_t mask = (uint32_t) _mm_movemask_ps(_mm_cmpgt_ps(x0, thr)) | ((uint32_t) _mm_movemask_ps(_mm_cmpgt_ps(x1, thr)) << SSE_LEN_FLOAT);
+        while (mask) {
+            idx[nb++] = i + __builtin_ctz(mask);
+            mask &= mask - 1;
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        if (src[i] > threshold)
+            idx[nb++] = i;
+    }
+    return nb;
+}
+
+// indices of the elements of src lower than threshold (see simd_utils_topk.h)
+static inline int filter_lt128f(float *src, int len, float threshold, int32_t *idx)
+{
+    int stop_len = len / (2 * SSE_LEN_FLOAT);
+    stop_len *= (2 * SSE_LEN_FLOAT);
+    v4sf thr = _mm_set1_ps(threshold);
+    int nb = 0;
+
+    for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
+        v4sf x0 = _mm_loadu_ps(src + i);
+        v4sf x1 = _mm_loadu_ps(src + i + SSE_LEN_FLOAT);
+        uint32_t mask = (uint32_t) _mm_movemask_ps(_mm_cmplt_ps(x0, thr)) | ((uint32_t) _mm_movemask_ps(_mm_cmplt_ps(x1, thr)) << SSE_LEN_FLOAT);
+        while (mask) {
+            idx[nb++] = i + __builtin_ctz(mask);
+            mask &= mask - 1;
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        if (src[i] < threshold)
+            idx[nb++] = i;
+    }
+    return nb;
+}
+
+SIMD_UTILS_API void topk128f(float *src, int len, int k, float *dst, int32_t *idx)
+{
+    topk_runf(src, len, k, dst, idx, 1, filter_gt128f);
+}
+
+SIMD_UTILS_API void bottomk128f(float *src, int len, int k, float *dst, int32_t *idx)
+{
+    topk_runf(src, len, k, dst, idx, 0, filter_lt128f);
+}
+
+SIMD_UTILS_API void partialsort128f(float *src, int len, int k)
+{
+    partialsort_runf(src, len, k, 4 * SSE_LEN_FLOAT, partition128f, sort_small128f);
+}
+
+SIMD_UTILS_API void sqrt128f(float *src, float *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_FLOAT);
+    stop_len *= (2 * SSE_LEN_FLOAT);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        if (simd_use_stream(len, sizeof(float))) {
+            for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
+                v4sf src_tmp = _mm_load_ps(src + i);
+                v4sf src_tmp2 = _mm_load_ps(src + i + SSE_LEN_FLOAT);
+                v4sf dst_tmp = _mm_sqrt_ps(src_tmp);
+                v4sf dst_tmp2 = _mm_sqrt_ps(src_tmp2);
+                _mm_stream_ps(dst + i, dst_tmp);
+                _mm_stream_ps(dst + i + SSE_LEN_FLOAT, dst_tmp2);
+            }
+            _mm_sfence();
+        } else {
+            for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
+                v4sf src_tmp = _mm_load_ps(src + i);
+                v4sf src_tmp2 = _mm_load_ps(src + i + SSE_LEN_FLOAT);
+                v4sf dst_tmp = _mm_sqrt_ps(src_tmp);
+                v4sf dst_tmp2 = _mm_sqrt_ps(src_tmp2);
+                _mm_store_ps(dst + i, dst_tmp);
+                _mm_store_ps(dst + i + SSE_LEN_FLOAT, dst_tmp2);
+            }
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
+            v4sf src_tmp = _mm_loadu_ps(src + i);
+            v4sf src_tmp2 = _mm_loadu_ps(src + i + SSE_LEN_FLOAT);
+            v4sf dst_tmp = _mm_sqrt_ps(src_tmp);
+            v4sf dst_tmp2 = _mm_sqrt_ps(src_tmp2);
+            _mm_storeu_ps(dst + i, dst_tmp);
+            _mm_storeu_ps(dst + i + SSE_LEN_FLOAT, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = sqrtf(src[i]);
+    }
+}
+
+//rounds away from zero like IPP, whereas SSE/AVx/AVX512 rounds to nearest even (IEEE-754)
+SIMD_UTILS_API void rint128f(float *src, float *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_FLOAT);
+    stop_len *= (2 * SSE_LEN_FLOAT);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
+            v4sf src_tmp = _mm_load_ps(src + i);
+            v4sf src_tmp2 = _mm_load_ps(src + i + SSE_LEN_FLOAT);
+            v4sf dst_tmp = _mm_round_ps(src_tmp, ROUNDTONEAREST);
+            v4sf dst_tmp2 = _mm_round_ps(src_tmp2, ROUNDTONEAREST);
+            _mm_store_ps(dst + i, dst_tmp);
+            _mm_store_ps(dst + i + SSE_LEN_FLOAT, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
+            v4sf src_tmp = _mm_loadu_ps(src + i);
+            v4sf src_tmp2 = _mm_loadu_ps(src + i + SSE_LEN_FLOAT);
+            v4sf dst_tmp = _mm_round_ps(src_tmp, ROUNDTONEAREST);
+            v4sf dst_tmp2 = _mm_round_ps(src_tmp2, ROUNDTONEAREST);
+            _mm_storeu_ps(dst + i, dst_tmp);
+            _mm_storeu_ps(dst + i + SSE_LEN_FLOAT, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = rintf(src[i]);
+    }
+}
+
+//rounds away from zero like IPP, whereas SSE/AVx/AVX512 rounds to nearest even (IEEE-754)
+SIMD_UTILS_API void round128f(float *src, float *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_FLOAT);
+    stop_len *= (2 * SSE_LEN_FLOAT);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
+            v4sf src_tmp = _mm_load_ps(src + i);
+            v4sf src_tmp2 = _mm_load_ps(src + i + SSE_LEN_FLOAT);
+            v4sf spe1 = _mm_and_ps(src_tmp, *(v4sf*)_ps_sign_mask);
+            spe1 = _mm_or_ps(spe1,*(v4sf*)_ps_mid_mask);
+            spe1 = _mm_add_ps(src_tmp, spe1);
+            v4sf spe2 = _mm_and_ps(src_tmp2, *(v4sf*)_ps_sign_mask);
+            spe2 = _mm_or_ps(spe2,*(v4sf*)_ps_mid_mask);
+            spe2 = _mm_add_ps(src_tmp2, spe2);
+            v4sf dst_tmp = _mm_round_ps(spe1, ROUNDTOZERO);
+            v4sf dst_tmp2 = _mm_round_ps(spe2, ROUNDTOZERO);
+            _mm_store_ps(dst + i, dst_tmp);
+            _mm_store_ps(dst + i + SSE_LEN_FLOAT, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
+            v4sf src_tmp = _mm_loadu_ps(src + i);
+            v4sf src_tmp2 = _mm_loadu_ps(src + i + SSE_LEN_FLOAT);
+            v4sf spe1 = _mm_and_ps(src_tmp, *(v4sf*)_ps_sign_mask);
+            spe1 = _mm_or_ps(spe1,*(v4sf*)_ps_mid_mask);
+            spe1 = _mm_add_ps(src_tmp, spe1);
+            v4sf spe2 = _mm_and_ps(src_tmp2, *(v4sf*)_ps_sign_mask);
+            spe2 = _mm_or_ps(spe2,*(v4sf*)_ps_mid_mask);
+            spe2 = _mm_add_ps(src_tmp2, spe2);
+            v4sf dst_tmp = _mm_round_ps(spe1, ROUNDTOZERO);
+            v4sf dst_tmp2 = _mm_round_ps(spe2, ROUNDTOZERO);
+            _mm_storeu_ps(dst + i, dst_tmp);
+            _mm_storeu_ps(dst + i + SSE_LEN_FLOAT, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = roundf(src[i]);
+    }
+}
+
+SIMD_UTILS_API void ceil128f(float *src, float *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_FLOAT);
+    stop_len *= (2 * SSE_LEN_FLOAT);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
+            v4sf src_tmp = _mm_load_ps(src + i);
+            v4sf src_tmp2 = _mm_load_ps(src + i + SSE_LEN_FLOAT);
+            v4sf dst_tmp = _mm_round_ps(src_tmp, ROUNDTOCEIL);
+            v4sf dst_tmp2 = _mm_round_ps(src_tmp2, ROUNDTOCEIL);
+            _mm_store_ps(dst + i, dst_tmp);
+            _mm_store_ps(dst + i + SSE_LEN_FLOAT, dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
+            v4sf src_tmp = _mm_loadu_ps(src + i);
+            v4sf src_tmp2 = _mm_loadu_ps(src + i + SSE_LEN_FLOAT);
+            v4sf dst_tmp = _mm_round_ps(src_tmp, ROUNDTOCEIL);
+            v4sf dst_tmp2 = _mm_round_ps(src_tmp2, ROUNDTOCEIL);
+            _mm_storeu_ps(dst + i, dst_tmp);
+            _mm_storeu_ps(dst + i + SSE_LEN_FLOAT, dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = ceilf(src[i]);
+    }
+}
+
+SIMD_UTILS_API void floor128f(float *src, float *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_FLOAT);
+    stop_len *= (2 * SSE_LEN_FLOAT);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
+            v4sf src_tmp = _mm_load_ps(src + i);
+            v4sf src_tmp2 = _mm_load_ps(src + i + SSE_LEN_FLOAT);
+            v4sf dst_tmp = _mm_round_ps(src_tmp, ROUNDTOFLOOR);
+            v4sf dst_tmp2 = _mm_round_ps(src_tmp2, ROUNDTOFLOOR);
             _mm_store_ps(dst + i, dst_tmp);
             _mm_store_ps(dst + i + SSE_LEN_FLOAT, dst_tmp2);
         }
@@ -3615,7 +4536,7 @@ static inline void floor128f(float *src, float *dst, int len)
     }
 }
 
-static inline void trunc128f(float *src, float *dst, int len)
+SIMD_UTILS_API void trunc128f(float *src, float *dst, int len)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= (2 * SSE_LEN_FLOAT);
@@ -3648,7 +4569,7 @@ static inline void trunc128f(float *src, float *dst, int len)
 // Old version
 #if 0 
 // (a + ib )/ (c + id) => (ac + bd)/(c2+d2) + i(bc -ad)/(c2+d2)
-static inline void cplxvecdiv128f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxvecdiv128f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
 
 {
     int stop_len = len / (SSE_LEN_FLOAT);  //(len << 1) >> 2;
@@ -3695,7 +4616,7 @@ static inline void cplxvecdiv128f(complex32_t *src1, complex32_t *src2, complex3
     }
 }
 
-static inline void cplxvecmul128f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxvecmul128f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
 {
     int stop_len = len / (SSE_LEN_FLOAT);  //(len << 1) >> 2;
     stop_len = stop_len * SSE_LEN_FLOAT;   //stop_len << 2;
@@ -3731,7 +4652,7 @@ static inline void cplxvecmul128f(complex32_t *src1, complex32_t *src2, complex3
     }
 }
 #else
-static inline void cplxvecdiv128f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxvecdiv128f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
 {
     int stop_len = len / (4 * SSE_LEN_FLOAT);
     stop_len *= 4 * SSE_LEN_FLOAT;
@@ -3805,7 +4726,7 @@ static inline void cplxvecdiv128f(complex32_t *src1, complex32_t *src2, complex3
     }
 }
 
-static inline void cplxvecmul128f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxvecmul128f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
 {
     int stop_len = len / (4 * SSE_LEN_FLOAT);
     stop_len *= 4 * SSE_LEN_FLOAT;
@@ -3859,7 +4780,7 @@ static inline void cplxvecmul128f(complex32_t *src1, complex32_t *src2, complex3
 }
 #endif
 
-static inline void cplxvecmul128f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxvecmul128f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
 {
     int stop_len = len / (SSE_LEN_FLOAT);
     stop_len = stop_len * SSE_LEN_FLOAT;
@@ -3899,7 +4820,7 @@ static inline void cplxvecmul128f_split(float *src1Re, float *src1Im, float *src
     }
 }
 
-static inline void cplxvecdiv128f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxvecdiv128f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= 2 * SSE_LEN_FLOAT;
@@ -3987,7 +4908,7 @@ static inline void cplxvecdiv128f_split(float *src1Re, float *src1Im, float *src
 // Old version
 #if 0
 // out = a * conj(b)
-static inline void cplxconjvecmul128f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxconjvecmul128f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
 {
     int stop_len = len / (SSE_LEN_FLOAT);  //(len << 1) >> 2;
     stop_len = stop_len * SSE_LEN_FLOAT;   //stop_len << 2;
@@ -4028,7 +4949,7 @@ static inline void cplxconjvecmul128f(complex32_t *src1, complex32_t *src2, comp
 
 #else
 
-static inline void cplxconjvecmul128f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxconjvecmul128f(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
 {
     int stop_len = len / (4 * SSE_LEN_FLOAT);
     stop_len *= (4 * SSE_LEN_FLOAT);
@@ -4089,7 +5010,7 @@ static inline void cplxconjvecmul128f(complex32_t *src1, complex32_t *src2, comp
 // Yconj = c - id
 // Z = (ac + bd) + i*(-ad + bc)
 // less precise than the _precise (with double) version
-static inline void cplxconjvecmul128f_kahan(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxconjvecmul128f_kahan(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
 {
     int stop_len = len / (SSE_LEN_FLOAT);  //(len << 1) >> 2;
     stop_len = stop_len * SSE_LEN_FLOAT;   // stop_len << 2;
@@ -4135,7 +5056,7 @@ static inline void cplxconjvecmul128f_kahan(complex32_t *src1, complex32_t *src2
 
 // Switch to double precision
 // Work in progress
-static inline void cplxconjvecmul128f_precise(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxconjvecmul128f_precise(complex32_t *src1, complex32_t *src2, complex32_t *dst, int len)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= (2 * SSE_LEN_FLOAT);
@@ -4223,7 +5144,7 @@ static inline void cplxconjvecmul128f_precise(complex32_t *src1, complex32_t *sr
     }
 }
 
-static inline void cplxconjvecmul128f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxconjvecmul128f_split(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
 {
     int stop_len = len / (SSE_LEN_FLOAT);
     stop_len = stop_len * SSE_LEN_FLOAT;
@@ -4271,7 +5192,7 @@ static inline void cplxconjvecmul128f_split(float *src1Re, float *src1Im, float
 //  Z = (ac + bd) + i*(-ad + bc)
 // RN = round to nearest
 //  Less precise than the 64bit double version
-static inline void cplxconjvecmul128f_split_kahan(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxconjvecmul128f_split_kahan(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
 {
     int stop_len = len / (SSE_LEN_FLOAT);
     stop_len = stop_len * SSE_LEN_FLOAT;
@@ -4326,7 +5247,7 @@ static inline void cplxconjvecmul128f_split_kahan(float *src1Re, float *src1Im,
 }
 
 // switch to double precision for the computation
-static inline void cplxconjvecmul128f_split_precise(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
+SIMD_UTILS_API void cplxconjvecmul128f_split_precise(float *src1Re, float *src1Im, float *src2Re, float *src2Im, float *dstRe, float *dstIm, int len)
 {
     int stop_len = len / (SSE_LEN_FLOAT);
     stop_len = stop_len * SSE_LEN_FLOAT;
@@ -4414,7 +5335,7 @@ static inline void cplxconjvecmul128f_split_precise(float *src1Re, float *src1Im
 }
 
 // prefer using cplxconjvecmulXf if you also need to do a multiply
-static inline void cplxconj128f(complex32_t *src, complex32_t *dst, int len)
+SIMD_UTILS_API void cplxconj128f(complex32_t *src, complex32_t *dst, int len)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);  //(len << 1) >> 2;
     stop_len *= 2 * SSE_LEN_FLOAT;             // stop_len << 2;
@@ -4448,7 +5369,7 @@ static inline void cplxconj128f(complex32_t *src, complex32_t *dst, int len)
     }
 }
 
-static inline void sigmoid128f(float *src, float *dst, int len)
+SIMD_UTILS_API void sigmoid128f(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -4473,7 +5394,7 @@ static inline void sigmoid128f(float *src, float *dst, int len)
 }
 
 // Alternate sigmoid version with tanh => slower?
-static inline void sigmoid128f_(float *src, float *dst, int len)
+SIMD_UTILS_API void sigmoid128f_(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -4498,7 +5419,7 @@ static inline void sigmoid128f_(float *src, float *dst, int len)
 }
 
 
-static inline void PRelu128f(float *src, float *dst, float alpha, int len)
+SIMD_UTILS_API void PRelu128f(float *src, float *dst, float alpha, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -4533,7 +5454,7 @@ static inline void PRelu128f(float *src, float *dst, float alpha, int len)
 }
 
 // to be improved
-static inline void softmax128f(float *src, float *dst, int len)
+SIMD_UTILS_API void softmax128f(float *src, float *dst, int len)
 {
     int stop_len = len / (SSE_LEN_FLOAT);
     stop_len *= (SSE_LEN_FLOAT);
@@ -4592,7 +5513,7 @@ static inline void softmax128f(float *src, float *dst, int len)
 }
 
 // to be improved
-static inline void softmax128f_dualacc(float *src, float *dst, int len)
+SIMD_UTILS_API void softmax128f_dualacc(float *src, float *dst, int len)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= (2 * SSE_LEN_FLOAT);
@@ -4663,7 +5584,7 @@ static inline void softmax128f_dualacc(float *src, float *dst, int len)
     }
 }
 
-static inline void pol2cart2D128f(float *r, float *theta, float *x, float *y, int len)
+SIMD_UTILS_API void pol2cart2D128f(float *r, float *theta, float *x, float *y, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -4703,7 +5624,7 @@ static inline void pol2cart2D128f(float *r, float *theta, float *x, float *y, in
     }
 }
 
-static inline void cart2pol2D128f(float *x, float *y, float *r, float *theta, int len)
+SIMD_UTILS_API void cart2pol2D128f(float *x, float *y, float *r, float *theta, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -4739,7 +5660,7 @@ static inline void cart2pol2D128f(float *x, float *y, float *r, float *theta, in
     }
 }
 
-static inline void modf128f(float *src, float *integer, float *remainder, int len)
+SIMD_UTILS_API void modf128f(float *src, float *integer, float *remainder, int len)
 {
     int stop_len = len / (2 * SSE_LEN_FLOAT);
     stop_len *= (2 * SSE_LEN_FLOAT);
@@ -4786,7 +5707,7 @@ static inline v4sf pow_ps(v4sf x, v4sf y)
     return ret;
 }
 
-static inline void pow128f(float *x, float *y, float *dst, int len)
+SIMD_UTILS_API void pow128f(float *x, float *y, float *dst, int len)
 {
     int stop_len = len / (2* SSE_LEN_FLOAT);
     stop_len *= ( 2*SSE_LEN_FLOAT);
@@ -4820,7 +5741,7 @@ static inline void pow128f(float *x, float *y, float *dst, int len)
     }
 }
 
-static inline void pow128f_precise(float *x, float *y, float *dst, int len)
+SIMD_UTILS_API void pow128f_precise(float *x, float *y, float *dst, int len)
 {
     int stop_len = len / (SSE_LEN_FLOAT);
     stop_len *= ( SSE_LEN_FLOAT);
@@ -4859,13 +5780,13 @@ static inline void pow128f_precise(float *x, float *y, float *dst, int len)
 }
 
 
-static inline void powcplx128f(complex32_t *x, complex32_t *y, complex32_t *dst, int len)
+SIMD_UTILS_API void powcplx128f(complex32_t *x, complex32_t *y, complex32_t *dst, int len)
 {
     int stop_len = len / (2* SSE_LEN_FLOAT);
     stop_len *= ( 2*SSE_LEN_FLOAT);
 
     if (areAligned3((uintptr_t) (x), (uintptr_t) (y), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
+        for (int i = 0; i < 2 * stop_len; i += 2 * SSE_LEN_FLOAT) {
             v4sfx2 x_tmp = _mm_load2_ps((float const *) (x) + i);
             v4sfx2 y_tmp = _mm_load2_ps((float const *) (y) + i);
             v4sf x_tmp_re2 = _mm_mul_ps(x_tmp.val[0], x_tmp.val[0]);
@@ -4888,7 +5809,7 @@ static inline void powcplx128f(complex32_t *x, complex32_t *y, complex32_t *dst,
             _mm_store2_ps((float*)(dst) + i, dst_tmp);
         }
     } else {
-        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
+        for (int i = 0; i < 2 * stop_len; i += 2 * SSE_LEN_FLOAT) {
             v4sfx2 x_tmp = _mm_load2u_ps((float const *) (x) + i);
             v4sfx2 y_tmp = _mm_load2u_ps((float const *) (y) + i);
             v4sf x_tmp_re2 = _mm_mul_ps(x_tmp.val[0], x_tmp.val[0]);
@@ -4930,4 +5851,541 @@ static inline void powcplx128f(complex32_t *x, complex32_t *y, complex32_t *dst,
 		dst[i].re = ex * cosylogx;
 		dst[i].im = ex * sinylogx;
     }
-}
\ No newline at end of file
+}
+
+// Applies one stage of a pipeline on a block (in may be equal to out).
+// offset is the position of the block in the whole array, used for the array operands
+SIMD_UTILS_API void pipeline_apply128f(const pipeline_op_t *op, float *in, float *out, int offset, int len)
+{
+    switch (op->op) {
+    case PipeMulC:
+        mulc128f(in, op->value, out, len);
+        break;
+    case PipeAddC:
+        addc128f(in, op->value, out, len);
+        break;
+    case PipeMul:
+        mul128f(in, op->src + offset, out, len);
+        break;
+    case PipeAdd:
+        add128f(in, op->src + offset, out, len);
+        break;
+    case PipeSub:
+        sub128f(in, op->src + offset, out, len);
+        break;
+    case PipeDiv:
+        div128f(in, op->src + offset, out, len);
+        break;
+    case PipeThresholdGt:
+        threshold128_gt_f(in, out, len, op->value);
+        break;
+    case PipeThresholdLt:
+        threshold128_lt_f(in, out, len, op->value);
+        break;
+    case PipeFabs:
+        fabs128f(in, out, len);
+        break;
+    case PipeSqrt:
+        sqrt128f(in, out, len);
+        break;
+    case PipeExp:
+        exp128f(in, out, len);
+        break;
+    case PipeLn:
+        ln128f(in, out, len);
+        break;
+    case PipeLog10:
+        log10128f(in, out, len);
+        break;
+    case PipeLog2:
+        log2128f(in, out, len);
+        break;
+    case PipeCbrt:
+        cbrt128f(in, out, len);
+        break;
+    case PipeSin:
+        sin128f(in, out, len);
+        break;
+    case PipeCos:
+        cos128f(in, out, len);
+        break;
+    case PipeTan:
+        tan128f(in, out, len);
+        break;
+    case PipeTanh:
+        tanh128f(in, out, len);
+        break;
+    case PipeAtan:
+        atan128f(in, out, len);
+        break;
+    case PipeSigmoid:
+        sigmoid128f(in, out, len);
+        break;
+    default:
+        if (in != out)
+            copy128f(in, out, len);
+        break;
+    }
+}
+
+/* Applies the chain of operations ops[0] ... ops[nb_ops - 1] on src, block by block,
+ * so that each block stays in L1 cache between two operations */
+SIMD_UTILS_API void pipeline128f(float *src, float *dst, int len, const pipeline_op_t *ops, int nb_ops)
+{
+    if (nb_ops <= 0) {
+        if (src != dst)
+            copy128f(src, dst, len);
+        return;
+    }
+
+    for (int i = 0; i < len; i += PIPELINE_BLOCK_FLOAT) {
+        int block_len = ((len - i) < PIPELINE_BLOCK_FLOAT) ? (len - i) : PIPELINE_BLOCK_FLOAT;
+        pipeline_apply128f(&ops[0], src + i, dst + i, i, block_len);
+        for (int k = 1; k < nb_ops; k++) {
+            pipeline_apply128f(&ops[k], dst + i, dst + i, i, block_len);
+        }
+    }
+}
+
+// Same as pipeline128f followed by a sum, without writing the intermediate array
+SIMD_UTILS_API void pipeline128f_sum(float *src, float *dst, int len, const pipeline_op_t *ops, int nb_ops)
+{
+    __attribute__((aligned(SSE_LEN_BYTES))) float block[PIPELINE_BLOCK_FLOAT];
+    double acc = 0.0;
+
+    for (int i = 0; i < len; i += PIPELINE_BLOCK_FLOAT) {
+        int block_len = ((len - i) < PIPELINE_BLOCK_FLOAT) ? (len - i) : PIPELINE_BLOCK_FLOAT;
+        float *in = src + i;
+        float block_sum;
+        for (int k = 0; k < nb_ops; k++) {
+            pipeline_apply128f(&ops[k], in, block, i, block_len);
+            in = block;
+        }
+        sum128f(in, &block_sum, block_len);
+        acc += (double) block_sum;
+    }
+
+    *dst = (float) acc;
+}
+
+/* FFT (see simd_utils_fft.h) */
+
+// radix-4 butterfly on SSE_LEN_FLOAT points x[idx + r*n4], y = Y0re, Y0im, w1*Y1re, w1*Y1im, ...
+static inline void fft_radix4_128f(const float *xr, const float *xi, int idx, int n4, const v4sf *w, v4sf *y)
+{
+    v4sf ar = _mm_loadu_ps(xr + idx), ai = _mm_loadu_ps(xi + idx);
+    v4sf br = _mm_loadu_ps(xr + idx + n4), bi = _mm_loadu_ps(xi + idx + n4);
+    v4sf cr = _mm_loadu_ps(xr + idx + 2 * n4), ci = _mm_loadu_ps(xi + idx + 2 * n4);
+    v4sf dr = _mm_loadu_ps(xr + idx + 3 * n4), di = _mm_loadu_ps(xi + idx + 3 * n4);
+    v4sf apcr = _mm_add_ps(ar, cr), apci = _mm_add_ps(ai, ci);
+    v4sf amcr = _mm_sub_ps(ar, cr), amci = _mm_sub_ps(ai, ci);
+    v4sf bpdr = _mm_add_ps(br, dr), bpdi = _mm_add_ps(bi, di);
+    v4sf jbmdr = _mm_sub_ps(bi, di), jbmdi = _mm_sub_ps(dr, br);  // -j * (b - d)
+    v4sf t1r = _mm_add_ps(amcr, jbmdr), t1i = _mm_add_ps(amci, jbmdi);
+    v4sf t2r = _mm_sub_ps(apcr, bpdr), t2i = _mm_sub_ps(apci, bpdi);
+    v4sf t3r = _mm_sub_ps(amcr, jbmdr), t3i = _mm_sub_ps(amci, jbmdi);
+    y[0] = _mm_add_ps(apcr, bpdr);
+    y[1] = _mm_add_ps(apci, bpdi);
+    y[2] = _mm_fnmadd_ps_custom(t1i, w[1], _mm_mul_ps(t1r, w[0]));
+    y[3] = _mm_fmadd_ps_custom(t1r, w[1], _mm_mul_ps(t1i, w[0]));
+    y[4] = _mm_fnmadd_ps_custom(t2i, w[3], _mm_mul_ps(t2r, w[2]));
+    y[5] = _mm_fmadd_ps_custom(t2r, w[3], _mm_mul_ps(t2i, w[2]));
+    y[6] = _mm_fnmadd_ps_custom(t3i, w[5], _mm_mul_ps(t3r, w[4]));
+    y[7] = _mm_fmadd_ps_custom(t3r, w[5], _mm_mul_ps(t3i, w[4]));
+}
+
+// dst[4i + r] = yr[i]
+static inline void fft_store4_s1_128f(float *dst, v4sf y0, v4sf y1, v4sf y2, v4sf y3)
+{
+    _MM_TRANSPOSE4_PS(y0, y1, y2, y3);
+    _mm_storeu_ps(dst, y0);
+    _mm_storeu_ps(dst + SSE_LEN_FLOAT, y1);
+    _mm_storeu_ps(dst + 2 * SSE_LEN_FLOAT, y2);
+    _mm_storeu_ps(dst + 3 * SSE_LEN_FLOAT, y3);
+}
+
+
+static inline v4sf fft_reverse128f(v4sf a)
+{
+    return _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 1, 2, 3));
+}
+
+static inline void fft_radix4_stage128f(const fft_plan32_t *plan, int s, const float *xr, const float *xi, float *yr, float *yi)
+{
+    int n4 = plan->n / 4;
+    v4sf w[6], y[8];
+
+    if (s >= SSE_LEN_FLOAT) {
+        const float *tw = fft_stage_twf(plan, s);
+        for (int p = 0; p < n4 / s; p++) {
+            for (int r = 0; r < 6; r++)
+                w[r] = _mm_set1_ps(tw[6 * p + r]);
+            for (int q = 0; q < s; q += SSE_LEN_FLOAT) {
+                int out = q + 4 * s * p;
+                fft_radix4_128f(xr, xi, q + s * p, n4, w, y);
+                for (int r = 0; r < 4; r++) {
+                    _mm_storeu_ps(yr + out + r * s, y[2 * r]);
+                    _mm_storeu_ps(yi + out + r * s, y[2 * r + 1]);
+                }
+            }
+        }
+    } else {
+        // strides smaller than a vector : twiddles per point, the 4 outputs are interleaved by chunks of s
+        const float *twx = plan->twx + ((s == 1) ? 0 : 6 * n4);
+        for (int idx = 0; idx < n4; idx += SSE_LEN_FLOAT) {
+            for (int r = 0; r < 6; r++)
+                w[r] = _mm_loadu_ps(twx + r * n4 + idx);
+            fft_radix4_128f(xr, xi, idx, n4, w, y);
+            for (int r = 0; r < 2; r++)
+                fft_store4_s1_128f((r ? yi : yr) + 4 * idx, y[r], y[2 + r], y[4 + r], y[6 + r]);
+        }
+    }
+}
+
+// last stage when log2(n) is odd, stride n/2 and no twiddles
+static inline void fft_radix2_stage128f(int n, const float *xr, const float *xi, float *yr, float *yi)
+{
+    int n2 = n / 2;
+    for (int q = 0; q < n2; q += SSE_LEN_FLOAT) {
+        v4sf ar = _mm_loadu_ps(xr + q), ai = _mm_loadu_ps(xi + q);
+        v4sf br = _mm_loadu_ps(xr + q + n2), bi = _mm_loadu_ps(xi + q + n2);
+        _mm_storeu_ps(yr + q, _mm_add_ps(ar, br));
+        _mm_storeu_ps(yi + q, _mm_add_ps(ai, bi));
+        _mm_storeu_ps(yr + q + n2, _mm_sub_ps(ar, br));
+        _mm_storeu_ps(yi + q + n2, _mm_sub_ps(ai, bi));
+    }
+}
+
+static inline void fft_split_core128f(const fft_plan32_t *plan, float *srcRe, float *srcIm, float *dstRe, float *dstIm)
+{
+    int n = plan->n;
+    if ((n / 4) < SSE_LEN_FLOAT) {
+        fft_split_coref_C(plan, srcRe, srcIm, dstRe, dstIm);
+        return;
+    }
+
+    int nb_stages = plan->log2n / 2 + (plan->log2n & 1);
+    float *xr = srcRe, *xi = srcIm;
+    int s = 1;
+    for (int stage = 0; stage < nb_stages; stage++) {
+        float *yr = fft_stage_outf(plan, stage, nb_stages, dstRe);
+        float *yi = (yr == dstRe) ? dstIm : yr + n;
+        if (s < n / 2 || !(plan->log2n & 1)) {
+            fft_radix4_stage128f(plan, s, xr, xi, yr, yi);
+            s *= 4;
+        } else {
+            fft_radix2_stage128f(n, xr, xi, yr, yi);
+        }
+        xr = yr;
+        xi = yi;
+    }
+}
+
+SIMD_UTILS_API void fft128f_split(fft_plan32_t *plan, float *srcRe, float *srcIm, float *dstRe, float *dstIm)
+{
+    fft_split_core128f(plan, srcRe, srcIm, dstRe, dstIm);
+}
+
+SIMD_UTILS_API void ifft128f_split(fft_plan32_t *plan, float *srcRe, float *srcIm, float *dstRe, float *dstIm)
+{
+    fft_split_core128f(plan, srcIm, srcRe, dstIm, dstRe);
+}
+
+SIMD_UTILS_API void fft128f(fft_plan32_t *plan, complex32_t *src, complex32_t *dst)
+{
+    float *re = plan->work + 4 * plan->n;
+    float *im = re + plan->n;
+    cplxtoreal128f(src, re, im, plan->n);
+    fft_split_core128f(plan, re, im, re, im);
+    realtocplx128f(re, im, dst, plan->n);
+}
+
+SIMD_UTILS_API void ifft128f(fft_plan32_t *plan, complex32_t *src, complex32_t *dst)
+{
+    float *re = plan->work + 4 * plan->n;
+    float *im = re + plan->n;
+    cplxtoreal128f(src, re, im, plan->n);
+    fft_split_core128f(plan, im, re, im, re);
+    realtocplx128f(re, im, dst, plan->n);
+}
+
+// src has plan->real_n points, dst the plan->real_n / 2 + 1 first bins
+SIMD_UTILS_API void rfft128f(fft_plan32_t *plan, float *src, complex32_t *dst)
+{
+    int n = plan->n;
+    float *re = plan->work + 4 * n;
+    float *im = re + n;
+    cplxtoreal128f((complex32_t *) src, re, im, n);
+    fft_split_core128f(plan, re, im, re, im);
+
+    v4sf half = _mm_set1_ps(0.5f);
+    int k = 1;
+    for (; (k + SSE_LEN_FLOAT) <= n; k += SSE_LEN_FLOAT) {
+        v4sf a = _mm_loadu_ps(re + k), b = _mm_loadu_ps(im + k);
+        v4sf c = fft_reverse128f(_mm_loadu_ps(re + n - k - SSE_LEN_FLOAT + 1));
+        v4sf d = fft_reverse128f(_mm_loadu_ps(im + n - k - SSE_LEN_FLOAT + 1));
+        v4sf wr = _mm_loadu_ps(plan->rtw + k), wi = _mm_loadu_ps(plan->rtw + n + k);
+        v4sf hs = _mm_add_ps(a, c), hd = _mm_sub_ps(b, d);
+        v4sf fr = _mm_add_ps(b, d), fi = _mm_sub_ps(c, a);
+        v4sfx2 out;
+        out.val[0] = _mm_mul_ps(half, _mm_fnmadd_ps_custom(wi, fi, _mm_fmadd_ps_custom(wr, fr, hs)));
+        out.val[1] = _mm_mul_ps(half, _mm_fmadd_ps_custom(wi, fr, _mm_fmadd_ps_custom(wr, fi, hd)));
+        _mm_store2u_ps((float *) (dst + k), out);
+    }
+    rfft_postf_C(plan, re, im, dst, k);
+}
+
+// src has the plan->real_n / 2 + 1 first bins, dst plan->real_n points, not normalized
+SIMD_UTILS_API void irfft128f(fft_plan32_t *plan, complex32_t *src, float *dst)
+{
+    int n = plan->n;
+    float *re = plan->work + 4 * n;
+    float *im = re + n;
+
+    int k = 0;
+    for (; (k + SSE_LEN_FLOAT) <= n; k += SSE_LEN_FLOAT) {
+        v4sfx2 x = _mm_load2u_ps((float *) (src + k));
+        v4sfx2 xc = _mm_load2u_ps((float *) (src + n - k - SSE_LEN_FLOAT + 1));
+        v4sf c = fft_reverse128f(xc.val[0]), d = fft_reverse128f(xc.val[1]);
+        v4sf wr = _mm_loadu_ps(plan->rtw + k), wi = _mm_loadu_ps(plan->rtw + n + k);
+        v4sf amc = _mm_sub_ps(x.val[0], c), bpd = _mm_add_ps(x.val[1], d);
+        v4sf zr = _mm_fnmadd_ps_custom(bpd, wr, _mm_add_ps(x.val[0], c));
+        v4sf zi = _mm_fmadd_ps_custom(amc, wr, _mm_sub_ps(x.val[1], d));
+        _mm_storeu_ps(re + k, _mm_fmadd_ps_custom(amc, wi, zr));
+        _mm_storeu_ps(im + k, _mm_fmadd_ps_custom(bpd, wi, zi));
+    }
+    irfft_pref_C(plan, src, re, im, k);
+
+    fft_split_core128f(plan, im, re, im, re);
+    realtocplx128f(re, im, (complex32_t *) dst, n);
+}
+
+/* FIR filters (see simd_utils_fir.h) */
+
+// dst[i] = (dst[i] if accumulate) + sum_m taps[m] * src[i + m]
+// 8 vectors of outputs per pass on the taps, enough independent FMAs to hide their latency
+static inline void fir_kernel128f(const float *taps, int nb_taps, const float *src, float *dst, int len, int accumulate)
+{
+    int i = 0;
+    for (; (i + 8 * SSE_LEN_FLOAT) <= len; i += 8 * SSE_LEN_FLOAT) {
+        v4sf acc[8];
+        for (int k = 0; k < 8; k++)
+            acc[k] = accumulate ? _mm_loadu_ps(dst + i + k * SSE_LEN_FLOAT) : _mm_setzero_ps();
+        const float *s = src + i;
+        for (int m = 0; m < nb_taps; m++) {
+            v4sf tap = _mm_set1_ps(taps[m]);
+            acc[0] = _mm_fmadd_ps_custom(tap, _mm_loadu_ps(s + m), acc[0]);
+            acc[1] = _mm_fmadd_ps_custom(tap, _mm_loadu_ps(s + m + SSE_LEN_FLOAT), acc[1]);
+            acc[2] = _mm_fmadd_ps_custom(tap, _mm_loadu_ps(s + m + 2 * SSE_LEN_FLOAT), acc[2]);
+            acc[3] = _mm_fmadd_ps_custom(tap, _mm_loadu_ps(s + m + 3 * SSE_LEN_FLOAT), acc[3]);
+            acc[4] = _mm_fmadd_ps_custom(tap, _mm_loadu_ps(s + m + 4 * SSE_LEN_FLOAT), acc[4]);
+            acc[5] = _mm_fmadd_ps_custom(tap, _mm_loadu_ps(s + m + 5 * SSE_LEN_FLOAT), acc[5]);
+            acc[6] = _mm_fmadd_ps_custom(tap, _mm_loadu_ps(s + m + 6 * SSE_LEN_FLOAT), acc[6]);
+            acc[7] = _mm_fmadd_ps_custom(tap, _mm_loadu_ps(s + m + 7 * SSE_LEN_FLOAT), acc[7]);
+        }
+        for (int k = 0; k < 8; k++)
+            _mm_storeu_ps(dst + i + k * SSE_LEN_FLOAT, acc[k]);
+    }
+
+    for (; (i + SSE_LEN_FLOAT) <= len; i += SSE_LEN_FLOAT) {
+        v4sf acc = accumulate ? _mm_loadu_ps(dst + i) : _mm_setzero_ps();
+        for (int m = 0; m < nb_taps; m++)
+            acc = _mm_fmadd_ps_custom(_mm_set1_ps(taps[m]), _mm_loadu_ps(src + i + m), acc);
+        _mm_storeu_ps(dst + i, acc);
+    }
+
+    if (i < len)
+        fir_kernelf_C(taps, nb_taps, src + i, dst + i, len - i, accumulate);
+}
+
+// complex taps (real parts then imaginary parts) on interleaved complex samples
+static inline void fir_kernel128f_cplx(const float *taps, int nb_taps, const float *src, float *dst, int len, int accumulate)
+{
+    const float *taps_im = taps + nb_taps;
+    int i = 0;
+    // dst = sum taps_re * src + j * sum taps_im * src
+    for (; (i + SSE_LEN_FLOAT) <= len; i += SSE_LEN_FLOAT) {
+        v4sf re0 = _mm_setzero_ps(), re1 = _mm_setzero_ps();
+        v4sf im0 = _mm_setzero_ps(), im1 = _mm_setzero_ps();
+        const float *s = src + 2 * i;
+        for (int m = 0; m < nb_taps; m++) {
+            v4sf tap_re = _mm_set1_ps(taps[m]);
+            v4sf tap_im = _mm_set1_ps(taps_im[m]);
+            v4sf s0 = _mm_loadu_ps(s + 2 * m);
+            v4sf s1 = _mm_loadu_ps(s + 2 * m + SSE_LEN_FLOAT);
+            re0 = _mm_fmadd_ps_custom(tap_re, s0, re0);
+            re1 = _mm_fmadd_ps_custom(tap_re, s1, re1);
+            im0 = _mm_fmadd_ps_custom(tap_im, s0, im0);
+            im1 = _mm_fmadd_ps_custom(tap_im, s1, im1);
+        }
+        v4sf out0 = _mm_addsub_ps(re0, _mm_shuffle_ps(im0, im0, _MM_SHUFFLE(2, 3, 0, 1)));
+        v4sf out1 = _mm_addsub_ps(re1, _mm_shuffle_ps(im1, im1, _MM_SHUFFLE(2, 3, 0, 1)));
+        if (accumulate) {
+            out0 = _mm_add_ps(out0, _mm_loadu_ps(dst + 2 * i));
+            out1 = _mm_add_ps(out1, _mm_loadu_ps(dst + 2 * i + SSE_LEN_FLOAT));
+        }
+        _mm_storeu_ps(dst + 2 * i, out0);
+        _mm_storeu_ps(dst + 2 * i + SSE_LEN_FLOAT, out1);
+    }
+
+    if (i < len)
+        fir_kernelf_cplx_C(taps, nb_taps, src + 2 * i, dst + 2 * i, len - i, accumulate);
+}
+
+// returns the number of outputs, -1 if fir is a complex filter
+SIMD_UTILS_API int fir128f(fir32_t *fir, float *src, float *dst, int len)
+{
+    if (fir->cplx)
+        return -1;
+    return fir_runf(fir, fir_kernel128f, src, NULL, dst, NULL, len);
+}
+
+SIMD_UTILS_API int fir128f_cplx(fir32_t *fir, complex32_t *src, complex32_t *dst, int len)
+{
+    if (!fir->cplx)
+        return -1;
+    return fir_runf(fir, fir_kernel128f_cplx, (float *) src, NULL, (float *) dst, NULL, len);
+}
+
+SIMD_UTILS_API int fir128f_split(fir32_t *fir, float *srcRe, float *srcIm, float *dstRe, float *dstIm, int len)
+{
+    if (!fir->cplx)
+        return -1;
+    return fir_runf(fir, fir_kernel128f_cplx, srcRe, srcIm, dstRe, dstIm, len);
+}
+
+/* IIR filters (see simd_utils_iir.h) */
+
+// channels c0 to c0 + SSE_LEN_FLOAT - 1, filtered in lockstep
+static inline void iir_lanes128f(iir32_t *iir, int c0, const float *src, float *dst, int len)
+{
+    int C = iir->nb_channels;
+    int S = iir->stride;
+    for (int i = 0; i < len; i++) {
+        v4sf x = _mm_loadu_ps(src + (size_t) i * C + c0);
+        for (int s = 0; s < iir->nb_stages; s++) {
+            const float *c = iir->coefs + (size_t) s * 5 * S + c0;
+            float *z = iir->state + (size_t) s * 2 * S + c0;
+            v4sf y = _mm_fmadd_ps_custom(_mm_load_ps(c), x, _mm_load_ps(z));
+            v4sf z1 = _mm_fmadd_ps_custom(_mm_load_ps(c + S), x, _mm_load_ps(z + S));
+            v4sf z2 = _mm_mul_ps(_mm_load_ps(c + 2 * S), x);
+            _mm_store_ps(z, _mm_fnmadd_ps_custom(_mm_load_ps(c + 3 * S), y, z1));
+            _mm_store_ps(z + S, _mm_fnmadd_ps_custom(_mm_load_ps(c + 4 * S), y, z2));
+            x = y;
+        }
+        _mm_storeu_ps(dst + (size_t) i * C + c0, x);
+    }
+}
+
+/* one channel in the block state space form, blocks of SSE_LEN_FLOAT frames,
+ * every stage of a block before the next block */
+static inline void iir_ss_kernel128f(iir32_t *iir, int channel, const float *src, float *dst, int len)
+{
+    int C = iir->stride;
+    int i = 0;
+    for (; (i + SSE_LEN_FLOAT) <= len; i += SSE_LEN_FLOAT) {
+        for (int s = 0; s < iir->nb_stages; s++) {
+            const float *x = (s ? dst : src) + i;
+            const float *m = iir32_ss(iir, s, channel);
+            const float *z = iir->state + (size_t) s * 2 * C + channel;
+            float x1 = x[SSE_LEN_FLOAT - 1], x2 = x[SSE_LEN_FLOAT - 2];
+            // D * x, by columns
+            v4sf acc0 = _mm_mul_ps(_mm_load_ps(m), _mm_set1_ps(x[0]));
+            v4sf acc1 = _mm_mul_ps(_mm_load_ps(m + IIR_SS_LEN), _mm_set1_ps(x[1]));
+            for (int j = 2; j < SSE_LEN_FLOAT; j += 2) {
+                acc0 = _mm_fmadd_ps_custom(_mm_load_ps(m + j * IIR_SS_LEN), _mm_set1_ps(x[j]), acc0);
+                acc1 = _mm_fmadd_ps_custom(_mm_load_ps(m + (j + 1) * IIR_SS_LEN), _mm_set1_ps(x[j + 1]), acc1);
+            }
+            // + c1 * z1 + c2 * z2
+            v4sf y = _mm_fmadd_ps_custom(_mm_load_ps(m + IIR_SS_LEN * IIR_SS_LEN), _mm_set1_ps(z[0]), _mm_add_ps(acc0, acc1));
+            y = _mm_fmadd_ps_custom(_mm_load_ps(m + (IIR_SS_LEN + 1) * IIR_SS_LEN), _mm_set1_ps(z[C]), y);
+            _mm_storeu_ps(dst + i, y);
+            iir_ss_update(iir, s, channel, x1, x2, dst[i + SSE_LEN_FLOAT - 1], dst[i + SSE_LEN_FLOAT - 2]);
+        }
+    }
+
+    if (i < len) {
+        for (int s = 0; s < iir->nb_stages; s++)
+            iir_biquadf_C(iir, s, channel, (s ? dst : src) + i, dst + i, len - i, 1);
+    }
+}
+
+/* len frames of nb_channels interleaved channels, src and dst can be the same array.
+ * Groups of channels are filtered in lockstep, the remaining ones (or a single
+ * channel) in the block state space form. */
+SIMD_UTILS_API void iir128f(iir32_t *iir, float *src, float *dst, int len)
+{
+    int C = iir->nb_channels;
+    int c = 0;
+    if (C > 1) {
+        for (; (c + SSE_LEN_FLOAT) <= C; c += SSE_LEN_FLOAT)
+            iir_lanes128f(iir, c, src, dst, len);
+    }
+    for (; c < C; c++)
+        iir_ss_runf(iir, iir_ss_kernel128f, c, src, dst, len);
+}
+
+/* Convolutions (see simd_utils_conv.h) */
+
+static inline void conv_block128f(conv32_t *conv)
+{
+    if (conv->cplx) {
+        fft128f(conv->plan, (complex32_t *) conv->buf, (complex32_t *) conv->work);
+        cplxvecmul128f((complex32_t *) conv->work, (complex32_t *) conv->spectrum, (complex32_t *) conv->out, conv->fft_len);
+        ifft128f(conv->plan, (complex32_t *) conv->out, (complex32_t *) conv->out);
+    } else {
+        rfft128f(conv->plan, conv->buf, (complex32_t *) conv->work);
+        cplxvecmul128f((complex32_t *) conv->work, (complex32_t *) conv->spectrum, (complex32_t *) conv->out, conv->fft_len / 2 + 1);
+        irfft128f(conv->plan, (complex32_t *) conv->out, conv->out);
+    }
+}
+
+// returns len, -1 if conv is a complex convolution
+SIMD_UTILS_API int conv128f(conv32_t *conv, float *src, float *dst, int len)
+{
+    if (conv->cplx)
+        return -1;
+    return conv_runf(conv, fir_kernel128f, conv_block128f, src, dst, len);
+}
+
+SIMD_UTILS_API int conv128f_cplx(conv32_t *conv, complex32_t *src, complex32_t *dst, int len)
+{
+    if (!conv->cplx)
+        return -1;
+    return conv_runf(conv, fir_kernel128f_cplx, conv_block128f, (float *) src, (float *) dst, len);
+}
+
+// first index of value in src, len if it is not found
+static inline int firsteq128f(float *src, int len, float value)
+{
+    int stop_len = len / (2 * SSE_LEN_FLOAT);
+    stop_len *= (2 * SSE_LEN_FLOAT);
+
+    v4sf value_v = _mm_set1_ps(value);
+    for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
+        uint32_t mask = (uint32_t) _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(src + i), value_v));
+        mask |= (uint32_t) _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(src + i + SSE_LEN_FLOAT), value_v)) << 4;
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+    for (int i = stop_len; i < len; i++) {
+        if (src[i] == value)
+            return i;
+    }
+    return len;
+}
+
+SIMD_UTILS_API void maxloc128f(float *src, float *max, int *idx, int len)
+{
+    minmaxloc_runf(src, len, minmax128f, firsteq128f, NULL, NULL, max, idx);
+}
+
+SIMD_UTILS_API void minloc128f(float *src, float *min, int *idx, int len)
+{
+    minmaxloc_runf(src, len, minmax128f, firsteq128f, min, idx, NULL, NULL);
+}
+
+SIMD_UTILS_API void minmaxloc128f(float *src, int len, float *min_value, int *min_idx, float *max_value, int *max_idx)
+{
+    minmaxloc_runf(src, len, minmax128f, firsteq128f, min_value, min_idx, max_value, max_idx);
+}
@@ -14,7 +14,7 @@
 #include "sse2neon_wrapper.h"
 #endif
 
-static inline void add128s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+SIMD_UTILS_API void add128s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
 {
     int stop_len = len / SSE_LEN_INT32;
     stop_len *= SSE_LEN_INT32;
@@ -37,7 +37,7 @@ static inline void add128s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
 }
 
 // Works only for Integers stored on 32bits smaller than 16bits
-static inline void mul128s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+SIMD_UTILS_API void mul128s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
 {
     int stop_len = len / (2 * SSE_LEN_INT32);
     stop_len *= (2 * SSE_LEN_INT32);
@@ -71,7 +71,7 @@ static inline void mul128s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
     }
 }
 
-static inline void sub128s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+SIMD_UTILS_API void sub128s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
 {
     int stop_len = len / SSE_LEN_INT32;
     stop_len *= SSE_LEN_INT32;
@@ -93,7 +93,7 @@ static inline void sub128s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
     }
 }
 
-static inline void addc128s(int32_t *src, int32_t value, int32_t *dst, int len)
+SIMD_UTILS_API void addc128s(int32_t *src, int32_t value, int32_t *dst, int len)
 {
     int stop_len = len / SSE_LEN_INT32;
     stop_len *= SSE_LEN_INT32;
@@ -115,7 +115,7 @@ static inline void addc128s(int32_t *src, int32_t value, int32_t *dst, int len)
     }
 }
 
-static inline void vectorSlope128s(int *dst, int len, int offset, int slope)
+SIMD_UTILS_API void vectorSlope128s(int *dst, int len, int offset, int slope)
 {
     v4si coef = _mm_set_epi32(3 * slope, 2 * slope, slope, 0);
     v4si slope8_vec = _mm_set1_epi32(8 * slope);
@@ -157,7 +157,7 @@ static inline void vectorSlope128s(int *dst, int len, int offset, int slope)
     }
 }
 
-static inline void sum128s(int32_t *src, int32_t *dst, int len)
+SIMD_UTILS_API void sum128s(int32_t *src, int32_t *dst, int len)
 {
     int stop_len = len / (2 * SSE_LEN_INT32);
     stop_len *= (2 * SSE_LEN_INT32);
@@ -196,7 +196,7 @@ static inline void sum128s(int32_t *src, int32_t *dst, int len)
 
 // Experimental
 
-static inline void copy128s(int32_t *src, int32_t *dst, int len)
+SIMD_UTILS_API void copy128s(int32_t *src, int32_t *dst, int len)
 {
     int stop_len = len / SSE_LEN_INT32;
     stop_len *= SSE_LEN_INT32;
@@ -216,7 +216,7 @@ static inline void copy128s(int32_t *src, int32_t *dst, int len)
     }
 }
 
-static inline void copy128s_2(int32_t *src, int32_t *dst, int len)
+SIMD_UTILS_API void copy128s_2(int32_t *src, int32_t *dst, int len)
 {
     int stop_len = len / (2 * SSE_LEN_INT32);
     stop_len *= (2 * SSE_LEN_INT32);
@@ -241,19 +241,25 @@ static inline void copy128s_2(int32_t *src, int32_t *dst, int len)
     }
 }
 
-static inline void fast_copy128s(int32_t *src, int32_t *dst, int len)
+SIMD_UTILS_API void fast_copy128s(int32_t *src, int32_t *dst, int len)
 {
+    // the streaming loads and stores need aligned pointers
+    if (!areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        copy128s(src, dst, len);
+        return;
+    }
+
     int stop_len = len / SSE_LEN_INT32;
     stop_len *= SSE_LEN_INT32;
 
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-      for (int i = 0; i < stop_len; i += SSE_LEN_INT32) {
-          _mm_stream_si128((__m128i *) (dst + i), _mm_stream_load_si128((__m128i *) (src + i)));
-      }
-      _mm_mfence();
-    } else {
-      stop_len = 0;
+#ifdef OMP
+#pragma omp parallel for schedule(auto)
+#endif
+    for (int i = 0; i < stop_len; i += SSE_LEN_INT32) {
+        __m128i tmp1 = _mm_stream_load_si128((__m128i *) (src + i));
+        _mm_stream_si128((__m128i *) (dst + i), tmp1);
     }
+    _mm_sfence();
 
     for (int i = stop_len; i < len; i++) {
         dst[i] = src[i];
@@ -261,48 +267,58 @@ static inline void fast_copy128s(int32_t *src, int32_t *dst, int len)
 }
 
 
-static inline void fast_copy128s_2(int32_t *src, int32_t *dst, int len)
+SIMD_UTILS_API void fast_copy128s_2(int32_t *src, int32_t *dst, int len)
 {
+    // the streaming loads and stores need aligned pointers
+    if (!areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        copy128s(src, dst, len);
+        return;
+    }
+
     int stop_len = len / (2 * SSE_LEN_INT32);
     stop_len *= (2 * SSE_LEN_INT32);
 
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-      for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
-          __m128i tmp1 = _mm_stream_load_si128((__m128i *) (src + i));
-          __m128i tmp2 = _mm_stream_load_si128((__m128i *) (src + i + SSE_LEN_INT32));
-          _mm_stream_si128((__m128i *) (dst + i), tmp1);
-          _mm_stream_si128((__m128i *) (dst + i + SSE_LEN_INT32), tmp2);
-      }
-      _mm_mfence();
-    } else {
-      stop_len = 0;
+#ifdef OMP
+#pragma omp parallel for schedule(auto)
+#endif
+    for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
+        __m128i tmp1 = _mm_stream_load_si128((__m128i *) (src + i));
+        __m128i tmp2 = _mm_stream_load_si128((__m128i *) (src + i + SSE_LEN_INT32));
+        _mm_stream_si128((__m128i *) (dst + i), tmp1);
+        _mm_stream_si128((__m128i *) (dst + i + SSE_LEN_INT32), tmp2);
     }
-    
+    _mm_sfence();
+
     for (int i = stop_len; i < len; i++) {
         dst[i] = src[i];
     }
 }
 
-static inline void fast_copy128s_4(int32_t *src, int32_t *dst, int len)
+SIMD_UTILS_API void fast_copy128s_4(int32_t *src, int32_t *dst, int len)
 {
+    // the streaming loads and stores need aligned pointers
+    if (!areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        copy128s(src, dst, len);
+        return;
+    }
+
     int stop_len = len / (4 * SSE_LEN_INT32);
     stop_len *= (4 * SSE_LEN_INT32);
 
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-      for (int i = 0; i < stop_len; i += 4 * SSE_LEN_INT32) {
-          __m128i tmp1 = _mm_stream_load_si128((__m128i *) (src + i));
-          __m128i tmp2 = _mm_stream_load_si128((__m128i *) (src + i + SSE_LEN_INT32));
-          __m128i tmp3 = _mm_stream_load_si128((__m128i *) (src + i + 2 * SSE_LEN_INT32));
-          __m128i tmp4 = _mm_stream_load_si128((__m128i *) (src + i + 3 * SSE_LEN_INT32));
-          _mm_stream_si128((__m128i *) (dst + i), tmp1);
-          _mm_stream_si128((__m128i *) (dst + i + SSE_LEN_INT32), tmp2);
-          _mm_stream_si128((__m128i *) (dst + i + 2 * SSE_LEN_INT32), tmp3);
-          _mm_stream_si128((__m128i *) (dst + i + 3 * SSE_LEN_INT32), tmp4);
-      }
-      _mm_mfence();
-    } else {
-      stop_len = 0;
+#ifdef OMP
+#pragma omp parallel for schedule(auto)
+#endif
+    for (int i = 0; i < stop_len; i += 4 * SSE_LEN_INT32) {
+        __m128i tmp1 = _mm_stream_load_si128((__m128i *) (src + i));
+        __m128i tmp2 = _mm_stream_load_si128((__m128i *) (src + i + SSE_LEN_INT32));
+        __m128i tmp3 = _mm_stream_load_si128((__m128i *) (src + i + 2 * SSE_LEN_INT32));
+        __m128i tmp4 = _mm_stream_load_si128((__m128i *) (src + i + 3 * SSE_LEN_INT32));
+        _mm_stream_si128((__m128i *) (dst + i), tmp1);
+        _mm_stream_si128((__m128i *) (dst + i + SSE_LEN_INT32), tmp2);
+        _mm_stream_si128((__m128i *) (dst + i + 2 * SSE_LEN_INT32), tmp3);
+        _mm_stream_si128((__m128i *) (dst + i + 3 * SSE_LEN_INT32), tmp4);
     }
+    _mm_sfence();
 
     for (int i = stop_len; i < len; i++) {
         dst[i] = src[i];
@@ -372,7 +388,7 @@ static inline __m128i _mm_absdiff_epi8(__m128i a, __m128i b)
 #endif
 }
 
-static inline void absdiff16s_128s(int16_t *src1, int16_t *src2, int16_t *dst, int len)
+SIMD_UTILS_API void absdiff16s_128s(int16_t *src1, int16_t *src2, int16_t *dst, int len)
 {
     int stop_len = len / SSE_LEN_INT16;
     stop_len *= SSE_LEN_INT16;
@@ -397,161 +413,172 @@ static inline void absdiff16s_128s(int16_t *src1, int16_t *src2, int16_t *dst, i
     }
 }
 
-/*
-static inline void print8i(__m128i v)
-{
-    int16_t *p = (int16_t *) &v;
-#ifndef __SSE2__
-    _mm_empty();
-#endif
-    printf("[%d, %d, %d, %d,%d, %d, %d, %d]", p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7]);
-}*/
-
-static inline void powerspect16s_128s_interleaved(complex16s_t *src, int32_t *dst, int len)
+SIMD_UTILS_API void addsat16s_128s(int16_t *src1, int16_t *src2, int16_t *dst, int len)
 {
-    int stop_len = len / SSE_LEN_INT32;
-    stop_len *= SSE_LEN_INT32;
+    int stop_len = len / (2 * SSE_LEN_INT16);
+    stop_len *= (2 * SSE_LEN_INT16);
 
-    int j = 0;
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += SSE_LEN_INT32) {
-            __m128i reim = _mm_load_si128((__m128i *) ((const int16_t *) src + j));
-            // print8i(reim); printf("\n");
-            _mm_store_si128((__m128i *) (dst + i), _mm_madd_epi16(reim, reim));
-            j += SSE_LEN_INT16;
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT16) {
+            v4si a = _mm_load_si128((__m128i *) (src1 + i));
+            v4si b = _mm_load_si128((__m128i *) (src2 + i));
+            v4si a2 = _mm_load_si128((__m128i *) (src1 + i + SSE_LEN_INT16));
+            v4si b2 = _mm_load_si128((__m128i *) (src2 + i + SSE_LEN_INT16));
+            v4si res = _mm_adds_epi16(a, b);
+            v4si res2 = _mm_adds_epi16(a2, b2);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT16), res2);
         }
     } else {
-        for (int i = 0; i < stop_len; i += SSE_LEN_INT32) {
-            __m128i reim = _mm_loadu_si128((__m128i *) ((const int16_t *) src + j));
-            _mm_storeu_si128((__m128i *) (dst + i), _mm_madd_epi16(reim, reim));
-            j += SSE_LEN_INT16;
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT16) {
+            v4si a = _mm_loadu_si128((__m128i *) (src1 + i));
+            v4si b = _mm_loadu_si128((__m128i *) (src2 + i));
+            v4si a2 = _mm_loadu_si128((__m128i *) (src1 + i + SSE_LEN_INT16));
+            v4si b2 = _mm_loadu_si128((__m128i *) (src2 + i + SSE_LEN_INT16));
+            v4si res = _mm_adds_epi16(a, b);
+            v4si res2 = _mm_adds_epi16(a2, b2);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT16), res2);
         }
     }
 
     for (int i = stop_len; i < len; i++) {
-        dst[i] = (int32_t) src[i].re * (int32_t) src[i].re + (int32_t) src[i].im * (int32_t) src[i].im;
+        int32_t tmp = (int32_t) src1[i] + (int32_t) src2[i];
+        dst[i] = (int16_t) (tmp > INT16_MAX ? INT16_MAX : (tmp < INT16_MIN ? INT16_MIN : tmp));
     }
 }
 
-// Works with positive scale_factor (divides final value)
-static inline void sum16s32s128(int16_t *src, int len, int32_t *dst, int scale_factor)
+SIMD_UTILS_API void subsat16s_128s(int16_t *src1, int16_t *src2, int16_t *dst, int len)
 {
-    int stop_len = len / (4 * SSE_LEN_INT16);
-    stop_len *= (4 * SSE_LEN_INT16);
-
-    __attribute__((aligned(SSE_LEN_BYTES))) int32_t accumulate[SSE_LEN_INT32];
-    int32_t tmp_acc = 0;
-    int16_t scale = 1 << scale_factor;
-    v4si one = _mm_set1_epi16(1);
-    v4si vec_acc1 = _mm_setzero_si128();  // initialize the vector accumulator
-    v4si vec_acc2 = _mm_setzero_si128();  // initialize the vector accumulator
+    int stop_len = len / (2 * SSE_LEN_INT16);
+    stop_len *= (2 * SSE_LEN_INT16);
 
-    if (isAligned((uintptr_t) (src), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 4 * SSE_LEN_INT16) {
-            v4si vec_src_tmp = _mm_load_si128((__m128i *) ((const int16_t *) src + i));
-            v4si vec_src_tmp2 = _mm_load_si128((__m128i *) ((const int16_t *) src + i + SSE_LEN_INT16));
-            v4si vec_src_tmp3 = _mm_load_si128((__m128i *) ((const int16_t *) src + i + 2 * SSE_LEN_INT16));
-            v4si vec_src_tmp4 = _mm_load_si128((__m128i *) ((const int16_t *) src + i + 3 * SSE_LEN_INT16));
-            vec_src_tmp = _mm_madd_epi16(vec_src_tmp, one);
-            vec_src_tmp2 = _mm_madd_epi16(vec_src_tmp2, one);
-            vec_src_tmp3 = _mm_madd_epi16(vec_src_tmp3, one);
-            vec_src_tmp4 = _mm_madd_epi16(vec_src_tmp4, one);
-            vec_src_tmp = _mm_add_epi32(vec_src_tmp, vec_src_tmp2);
-            vec_src_tmp3 = _mm_add_epi32(vec_src_tmp3, vec_src_tmp4);
-            vec_acc1 = _mm_add_epi32(vec_src_tmp, vec_acc1);
-            vec_acc2 = _mm_add_epi32(vec_src_tmp3, vec_acc2);
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT16) {
+            v4si a = _mm_load_si128((__m128i *) (src1 + i));
+            v4si b = _mm_load_si128((__m128i *) (src2 + i));
+            v4si a2 = _mm_load_si128((__m128i *) (src1 + i + SSE_LEN_INT16));
+            v4si b2 = _mm_load_si128((__m128i *) (src2 + i + SSE_LEN_INT16));
+            v4si res = _mm_subs_epi16(a, b);
+            v4si res2 = _mm_subs_epi16(a2, b2);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT16), res2);
         }
     } else {
-        for (int i = 0; i < stop_len; i += 4 * SSE_LEN_INT16) {
-            v4si vec_src_tmp = _mm_loadu_si128((__m128i *) ((const int16_t *) src + i));
-            v4si vec_src_tmp2 = _mm_loadu_si128((__m128i *) ((const int16_t *) src + i + SSE_LEN_INT16));
-            v4si vec_src_tmp3 = _mm_loadu_si128((__m128i *) ((const int16_t *) src + i + 2 * SSE_LEN_INT16));
-            v4si vec_src_tmp4 = _mm_loadu_si128((__m128i *) ((const int16_t *) src + i + 3 * SSE_LEN_INT16));
-            vec_src_tmp = _mm_madd_epi16(vec_src_tmp, one);
-            vec_src_tmp2 = _mm_madd_epi16(vec_src_tmp2, one);
-            vec_src_tmp3 = _mm_madd_epi16(vec_src_tmp3, one);
-            vec_src_tmp4 = _mm_madd_epi16(vec_src_tmp4, one);
-            vec_src_tmp = _mm_add_epi32(vec_src_tmp, vec_src_tmp2);
-            vec_src_tmp3 = _mm_add_epi32(vec_src_tmp3, vec_src_tmp4);
-            vec_acc1 = _mm_add_epi32(vec_src_tmp, vec_acc1);
-            vec_acc2 = _mm_add_epi32(vec_src_tmp3, vec_acc2);
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT16) {
+            v4si a = _mm_loadu_si128((__m128i *) (src1 + i));
+            v4si b = _mm_loadu_si128((__m128i *) (src2 + i));
+            v4si a2 = _mm_loadu_si128((__m128i *) (src1 + i + SSE_LEN_INT16));
+            v4si b2 = _mm_loadu_si128((__m128i *) (src2 + i + SSE_LEN_INT16));
+            v4si res = _mm_subs_epi16(a, b);
+            v4si res2 = _mm_subs_epi16(a2, b2);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT16), res2);
         }
     }
 
-    vec_acc1 = _mm_add_epi32(vec_acc1, vec_acc2);
-    _mm_store_si128((__m128i *) accumulate, vec_acc1);
-
     for (int i = stop_len; i < len; i++) {
-        tmp_acc += (int32_t) src[i];
+        int32_t tmp = (int32_t) src1[i] - (int32_t) src2[i];
+        dst[i] = (int16_t) (tmp > INT16_MAX ? INT16_MAX : (tmp < INT16_MIN ? INT16_MIN : tmp));
     }
-
-    tmp_acc = tmp_acc + accumulate[0] + accumulate[1] + accumulate[2] + accumulate[3];
-
-    tmp_acc /= scale;
-    *dst = tmp_acc;
 }
 
-static inline void flip128s(int32_t *src, int32_t *dst, int len)
+// high 16 bits of the 32 bits products
+SIMD_UTILS_API void mulhi16s_128s(int16_t *src1, int16_t *src2, int16_t *dst, int len)
 {
-    int stop_len = len / (2 * SSE_LEN_INT32);
-    stop_len *= (2 * SSE_LEN_INT32);
+    int stop_len = len / (2 * SSE_LEN_INT16);
+    stop_len *= (2 * SSE_LEN_INT16);
 
-    int mini = ((len - 1) < (2 * SSE_LEN_INT32)) ? (len - 1) : (2 * SSE_LEN_INT32);
-    for (int i = 0; i < mini; i++) {
-        dst[len - i - 1] = src[i];
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT16) {
+            v4si a = _mm_load_si128((__m128i *) (src1 + i));
+            v4si b = _mm_load_si128((__m128i *) (src2 + i));
+            v4si a2 = _mm_load_si128((__m128i *) (src1 + i + SSE_LEN_INT16));
+            v4si b2 = _mm_load_si128((__m128i *) (src2 + i + SSE_LEN_INT16));
+            v4si res = _mm_mulhi_epi16(a, b);
+            v4si res2 = _mm_mulhi_epi16(a2, b2);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT16), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT16) {
+            v4si a = _mm_loadu_si128((__m128i *) (src1 + i));
+            v4si b = _mm_loadu_si128((__m128i *) (src2 + i));
+            v4si a2 = _mm_loadu_si128((__m128i *) (src1 + i + SSE_LEN_INT16));
+            v4si b2 = _mm_loadu_si128((__m128i *) (src2 + i + SSE_LEN_INT16));
+            v4si res = _mm_mulhi_epi16(a, b);
+            v4si res2 = _mm_mulhi_epi16(a2, b2);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT16), res2);
+        }
     }
 
-    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst + len - SSE_LEN_INT32), SSE_LEN_BYTES)) {
-        for (int i = 2 * SSE_LEN_INT32; i < stop_len; i += 2 * SSE_LEN_INT32) {
-            v4si src_tmp = _mm_load_si128((__m128i *) ((const int32_t *) src + i));  // load a,b,c,d
-            v4si src_tmp2 = _mm_load_si128((__m128i *) ((const int32_t *) src + i + SSE_LEN_INT32));
-            v4si src_tmp_slip = _mm_shuffle_epi32(src_tmp, IMM8_FLIP_VEC);  // rotate vec from abcd to bcba
-            v4si src_tmp_slip2 = _mm_shuffle_epi32(src_tmp2, IMM8_FLIP_VEC);
-            _mm_store_si128((__m128i *) (dst + len - i - SSE_LEN_INT32), src_tmp_slip);  // store the flipped vector
-            _mm_store_si128((__m128i *) (dst + len - i - 2 * SSE_LEN_INT32), src_tmp_slip2);
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = (int16_t) (((int32_t) src1[i] * (int32_t) src2[i]) >> 16);
+    }
+}
+
+// Q15 product rounded to nearest, (-1) * (-1) wraps to -1 as with pmulhrsw
+SIMD_UTILS_API void mulhrs16s_128s(int16_t *src1, int16_t *src2, int16_t *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_INT16);
+    stop_len *= (2 * SSE_LEN_INT16);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT16) {
+            v4si a = _mm_load_si128((__m128i *) (src1 + i));
+            v4si b = _mm_load_si128((__m128i *) (src2 + i));
+            v4si a2 = _mm_load_si128((__m128i *) (src1 + i + SSE_LEN_INT16));
+            v4si b2 = _mm_load_si128((__m128i *) (src2 + i + SSE_LEN_INT16));
+            v4si res = _mm_mulhrs_epi16(a, b);
+            v4si res2 = _mm_mulhrs_epi16(a2, b2);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT16), res2);
         }
     } else {
-        for (int i = 2 * SSE_LEN_INT32; i < stop_len; i += 2 * SSE_LEN_INT32) {
-            v4si src_tmp = _mm_loadu_si128((__m128i *) (src + i));  // load a,b,c,d
-            v4si src_tmp2 = _mm_loadu_si128((__m128i *) (src + i + SSE_LEN_INT32));
-            v4si src_tmp_slip = _mm_shuffle_epi32(src_tmp, IMM8_FLIP_VEC);  // rotate vec from abcd to bcba
-            v4si src_tmp_slip2 = _mm_shuffle_epi32(src_tmp2, IMM8_FLIP_VEC);
-            _mm_storeu_si128((__m128i *) (dst + len - i - SSE_LEN_INT32), src_tmp_slip);  // store the flipped vector
-            _mm_storeu_si128((__m128i *) (dst + len - i - 2 * SSE_LEN_INT32), src_tmp_slip2);
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT16) {
+            v4si a = _mm_loadu_si128((__m128i *) (src1 + i));
+            v4si b = _mm_loadu_si128((__m128i *) (src2 + i));
+            v4si a2 = _mm_loadu_si128((__m128i *) (src1 + i + SSE_LEN_INT16));
+            v4si b2 = _mm_loadu_si128((__m128i *) (src2 + i + SSE_LEN_INT16));
+            v4si res = _mm_mulhrs_epi16(a, b);
+            v4si res2 = _mm_mulhrs_epi16(a2, b2);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT16), res2);
         }
     }
 
     for (int i = stop_len; i < len; i++) {
-        dst[len - i - 1] = src[i];
+        dst[i] = (int16_t) ((((int32_t) src1[i] * (int32_t) src2[i] >> 14) + 1) >> 1);
     }
 }
 
-static inline void maxevery128s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+SIMD_UTILS_API void maxevery16s_128s(int16_t *src1, int16_t *src2, int16_t *dst, int len)
 {
-    int stop_len = len / (2 * SSE_LEN_INT32);
-    stop_len *= (2 * SSE_LEN_INT32);
+    int stop_len = len / (2 * SSE_LEN_INT16);
+    stop_len *= (2 * SSE_LEN_INT16);
 
     if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
-            v4si src1_tmp = _mm_load_si128((__m128i *) ((const int32_t *) src1 + i));
-            v4si src2_tmp = _mm_load_si128((__m128i *) ((const int32_t *) src2 + i));
-            v4si src1_tmp2 = _mm_load_si128((__m128i *) ((const int32_t *) src1 + i + SSE_LEN_INT32));
-            v4si src2_tmp2 = _mm_load_si128((__m128i *) ((const int32_t *) src2 + i + SSE_LEN_INT32));
-            v4si max1 = _mm_max_epi32(src1_tmp, src2_tmp);
-            v4si max2 = _mm_max_epi32(src1_tmp2, src2_tmp2);
-            _mm_store_si128((__m128i *) (dst + i), max1);
-            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT32), max2);
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT16) {
+            v4si a = _mm_load_si128((__m128i *) (src1 + i));
+            v4si b = _mm_load_si128((__m128i *) (src2 + i));
+            v4si a2 = _mm_load_si128((__m128i *) (src1 + i + SSE_LEN_INT16));
+            v4si b2 = _mm_load_si128((__m128i *) (src2 + i + SSE_LEN_INT16));
+            v4si res = _mm_max_epi16(a, b);
+            v4si res2 = _mm_max_epi16(a2, b2);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT16), res2);
         }
     } else {
-        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
-            v4si src1_tmp = _mm_loadu_si128((__m128i *) (src1 + i));
-            v4si src2_tmp = _mm_loadu_si128((__m128i *) (src2 + i));
-            v4si src1_tmp2 = _mm_loadu_si128((__m128i *) (src1 + i + SSE_LEN_INT32));
-            v4si src2_tmp2 = _mm_loadu_si128((__m128i *) (src2 + i + SSE_LEN_INT32));
-            v4si max1 = _mm_max_epi32(src1_tmp, src2_tmp);
-            v4si max2 = _mm_max_epi32(src1_tmp2, src2_tmp2);
-            _mm_storeu_si128((__m128i *) (dst + i), max1);
-            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT32), max2);
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT16) {
+            v4si a = _mm_loadu_si128((__m128i *) (src1 + i));
+            v4si b = _mm_loadu_si128((__m128i *) (src2 + i));
+            v4si a2 = _mm_loadu_si128((__m128i *) (src1 + i + SSE_LEN_INT16));
+            v4si b2 = _mm_loadu_si128((__m128i *) (src2 + i + SSE_LEN_INT16));
+            v4si res = _mm_max_epi16(a, b);
+            v4si res2 = _mm_max_epi16(a2, b2);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT16), res2);
         }
     }
 
@@ -560,32 +587,32 @@ static inline void maxevery128s(int32_t *src1, int32_t *src2, int32_t *dst, int
     }
 }
 
-static inline void minevery128s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+SIMD_UTILS_API void minevery16s_128s(int16_t *src1, int16_t *src2, int16_t *dst, int len)
 {
-    int stop_len = len / (2 * SSE_LEN_INT32);
-    stop_len *= (2 * SSE_LEN_INT32);
+    int stop_len = len / (2 * SSE_LEN_INT16);
+    stop_len *= (2 * SSE_LEN_INT16);
 
     if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
-            v4si src1_tmp = _mm_load_si128((__m128i *) ((const int32_t *) src1 + i));
-            v4si src2_tmp = _mm_load_si128((__m128i *) ((const int32_t *) src2 + i));
-            v4si src1_tmp2 = _mm_load_si128((__m128i *) ((const int32_t *) src1 + i + SSE_LEN_INT32));
-            v4si src2_tmp2 = _mm_load_si128((__m128i *) ((const int32_t *) src2 + i + SSE_LEN_INT32));
-            v4si min1 = _mm_min_epi32(src1_tmp, src2_tmp);
-            v4si min2 = _mm_min_epi32(src1_tmp2, src2_tmp2);
-            _mm_store_si128((__m128i *) (dst + i), min1);
-            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT32), min2);
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT16) {
+            v4si a = _mm_load_si128((__m128i *) (src1 + i));
+            v4si b = _mm_load_si128((__m128i *) (src2 + i));
+            v4si a2 = _mm_load_si128((__m128i *) (src1 + i + SSE_LEN_INT16));
+            v4si b2 = _mm_load_si128((__m128i *) (src2 + i + SSE_LEN_INT16));
+            v4si res = _mm_min_epi16(a, b);
+            v4si res2 = _mm_min_epi16(a2, b2);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT16), res2);
         }
     } else {
-        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
-            v4si src1_tmp = _mm_loadu_si128((__m128i *) (src1 + i));
-            v4si src2_tmp = _mm_loadu_si128((__m128i *) (src2 + i));
-            v4si src1_tmp2 = _mm_loadu_si128((__m128i *) (src1 + i + SSE_LEN_INT32));
-            v4si src2_tmp2 = _mm_loadu_si128((__m128i *) (src2 + i + SSE_LEN_INT32));
-            v4si min1 = _mm_min_epi32(src1_tmp, src2_tmp);
-            v4si min2 = _mm_min_epi32(src1_tmp2, src2_tmp2);
-            _mm_storeu_si128((__m128i *) (dst + i), min1);
-            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT32), min2);
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT16) {
+            v4si a = _mm_loadu_si128((__m128i *) (src1 + i));
+            v4si b = _mm_loadu_si128((__m128i *) (src2 + i));
+            v4si a2 = _mm_loadu_si128((__m128i *) (src1 + i + SSE_LEN_INT16));
+            v4si b2 = _mm_loadu_si128((__m128i *) (src2 + i + SSE_LEN_INT16));
+            v4si res = _mm_min_epi16(a, b);
+            v4si res2 = _mm_min_epi16(a2, b2);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT16), res2);
         }
     }
 
@@ -594,103 +621,63 @@ static inline void minevery128s(int32_t *src1, int32_t *src2, int32_t *dst, int
     }
 }
 
-static inline void minmax128s(int32_t *src, int len, int32_t *min_value, int32_t *max_value)
+// saturated, abs(-32768) is 32767
+SIMD_UTILS_API void abs16s_128s(int16_t *src, int16_t *dst, int len)
 {
-    int stop_len = (len - SSE_LEN_INT32) / (2 * SSE_LEN_INT32);
-    stop_len *= (2 * SSE_LEN_INT32);
-    stop_len = (stop_len < 0) ? 0 : stop_len;
-
-    int32_t min_s[SSE_LEN_INT32] __attribute__((aligned(SSE_LEN_BYTES)));
-    int32_t max_s[SSE_LEN_INT32] __attribute__((aligned(SSE_LEN_BYTES)));
-    v4si max_v, min_v, max_v2, min_v2;
-    v4si src_tmp, src_tmp2;
-
-    int32_t min_tmp = src[0];
-    int32_t max_tmp = src[0];
+    const v4si zero = _mm_setzero_si128();
 
-    if (len >= SSE_LEN_INT32) {
-        if (isAligned((uintptr_t) (src), SSE_LEN_BYTES)) {
-            src_tmp = _mm_load_si128((__m128i *) ((const int32_t *) src + 0));
-            max_v = src_tmp;
-            min_v = src_tmp;
-            max_v2 = src_tmp;
-            min_v2 = src_tmp;
-
-            for (int i = SSE_LEN_INT32; i < stop_len; i += 2 * SSE_LEN_INT32) {
-                src_tmp = _mm_load_si128((__m128i *) ((const int32_t *) src + i));
-                src_tmp2 = _mm_load_si128((__m128i *) ((const int32_t *) src + i + SSE_LEN_INT32));
-                max_v = _mm_max_epi32(max_v, src_tmp);
-                min_v = _mm_min_epi32(min_v, src_tmp);
-                max_v2 = _mm_max_epi32(max_v2, src_tmp2);
-                min_v2 = _mm_min_epi32(min_v2, src_tmp2);
-            }
-        } else {
-            src_tmp = _mm_loadu_si128((__m128i *) (src + 0));
-            max_v = src_tmp;
-            min_v = src_tmp;
-            max_v2 = src_tmp;
-            min_v2 = src_tmp;
+    int stop_len = len / (2 * SSE_LEN_INT16);
+    stop_len *= (2 * SSE_LEN_INT16);
 
-            for (int i = SSE_LEN_INT32; i < stop_len; i += 2 * SSE_LEN_INT32) {
-                src_tmp = _mm_loadu_si128((__m128i *) ((const int32_t *) src + i));
-                src_tmp2 = _mm_loadu_si128((__m128i *) ((const int32_t *) src + i + SSE_LEN_INT32));
-                max_v = _mm_max_epi32(max_v, src_tmp);
-                min_v = _mm_min_epi32(min_v, src_tmp);
-                max_v2 = _mm_max_epi32(max_v2, src_tmp2);
-                min_v2 = _mm_min_epi32(min_v2, src_tmp2);
-            }
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT16) {
+            v4si a = _mm_load_si128((__m128i *) (src + i));
+            v4si a2 = _mm_load_si128((__m128i *) (src + i + SSE_LEN_INT16));
+            v4si res = _mm_max_epi16(a, _mm_subs_epi16(zero, a));
+            v4si res2 = _mm_max_epi16(a2, _mm_subs_epi16(zero, a2));
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT16), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT16) {
+            v4si a = _mm_loadu_si128((__m128i *) (src + i));
+            v4si a2 = _mm_loadu_si128((__m128i *) (src + i + SSE_LEN_INT16));
+            v4si res = _mm_max_epi16(a, _mm_subs_epi16(zero, a));
+            v4si res2 = _mm_max_epi16(a2, _mm_subs_epi16(zero, a2));
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT16), res2);
         }
-
-        max_v = _mm_max_epi32(max_v, max_v2);
-        min_v = _mm_min_epi32(min_v, min_v2);
-
-        _mm_store_si128((__m128i *) (max_s), max_v);
-        _mm_store_si128((__m128i *) (min_s), min_v);
-
-        max_tmp = max_s[0];
-        max_tmp = max_tmp > max_s[1] ? max_tmp : max_s[1];
-        max_tmp = max_tmp > max_s[2] ? max_tmp : max_s[2];
-        max_tmp = max_tmp > max_s[3] ? max_tmp : max_s[3];
-
-        min_tmp = min_s[0];
-        min_tmp = min_tmp < min_s[1] ? min_tmp : min_s[1];
-        min_tmp = min_tmp < min_s[2] ? min_tmp : min_s[2];
-        min_tmp = min_tmp < min_s[3] ? min_tmp : min_s[3];
     }
 
     for (int i = stop_len; i < len; i++) {
-        max_tmp = max_tmp > src[i] ? max_tmp : src[i];
-        min_tmp = min_tmp < src[i] ? min_tmp : src[i];
+        dst[i] = src[i] == INT16_MIN ? INT16_MAX : (int16_t) abs(src[i]);
     }
-
-    *max_value = max_tmp;
-    *min_value = min_tmp;
 }
 
-static inline void threshold128_gt_s(int32_t *src, int32_t *dst, int len, int32_t value)
+SIMD_UTILS_API void threshold_gt16s_128s(int16_t *src, int16_t *dst, int len, int16_t value)
 {
-    const v4si tmp = _mm_set1_epi32(value);
+    const v4si val = _mm_set1_epi16(value);
 
-    int stop_len = len / (2 * SSE_LEN_INT32);
-    stop_len *= (2 * SSE_LEN_INT32);
+    int stop_len = len / (2 * SSE_LEN_INT16);
+    stop_len *= (2 * SSE_LEN_INT16);
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
-            v4si src_tmp = _mm_load_si128((__m128i *) (src + i));
-            v4si src_tmp2 = _mm_load_si128((__m128i *) (src + i + SSE_LEN_INT32));
-            v4si dst_tmp = _mm_min_epi32(src_tmp, tmp);
-            v4si dst_tmp2 = _mm_min_epi32(src_tmp2, tmp);
-            _mm_store_si128((__m128i *) (dst + i), dst_tmp);
-            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT32), dst_tmp2);
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT16) {
+            v4si a = _mm_load_si128((__m128i *) (src + i));
+            v4si a2 = _mm_load_si128((__m128i *) (src + i + SSE_LEN_INT16));
+            v4si res = _mm_min_epi16(a, val);
+            v4si res2 = _mm_min_epi16(a2, val);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT16), res2);
         }
     } else {
-        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
-            v4si src_tmp = _mm_loadu_si128((__m128i *) (src + i));
-            v4si src_tmp2 = _mm_loadu_si128((__m128i *) (src + i + SSE_LEN_INT32));
-            v4si dst_tmp = _mm_min_epi32(src_tmp, tmp);
-            v4si dst_tmp2 = _mm_min_epi32(src_tmp2, tmp);
-            _mm_storeu_si128((__m128i *) (dst + i), dst_tmp);
-            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT32), dst_tmp2);
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT16) {
+            v4si a = _mm_loadu_si128((__m128i *) (src + i));
+            v4si a2 = _mm_loadu_si128((__m128i *) (src + i + SSE_LEN_INT16));
+            v4si res = _mm_min_epi16(a, val);
+            v4si res2 = _mm_min_epi16(a2, val);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT16), res2);
         }
     }
 
@@ -699,189 +686,2015 @@ static inline void threshold128_gt_s(int32_t *src, int32_t *dst, int len, int32_
     }
 }
 
-
-static inline void threshold128_gtabs_s(int32_t *src, int32_t *dst, int len, int32_t value)
+SIMD_UTILS_API void threshold_lt16s_128s(int16_t *src, int16_t *dst, int len, int16_t value)
 {
-    const v4si pval = _mm_set1_epi32(value);
-    const v4si mval = _mm_set1_epi32(-value);
+    const v4si val = _mm_set1_epi16(value);
 
-    int stop_len = len / (2 * SSE_LEN_INT32);
-    stop_len *= (2 * SSE_LEN_INT32);
+    int stop_len = len / (2 * SSE_LEN_INT16);
+    stop_len *= (2 * SSE_LEN_INT16);
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
-            v4si src_tmp = _mm_load_si128((__m128i *) (src + i));
-            v4si src_tmp2 = _mm_load_si128((__m128i *) (src + i + SSE_LEN_INT32));
-            v4si src_abs = _mm_abs_epi32(src_tmp);
-            v4si src_abs2 = _mm_abs_epi32(src_tmp2);
-            v4si eqmask = _mm_cmpeq_epi32(src_abs, src_tmp);  // if A = abs(A), then A is >= 0 (mask 0xFFFFFFFF)
-            v4si eqmask2 = _mm_cmpeq_epi32(src_abs2, src_tmp2);
-            v4si min = _mm_min_epi32(src_tmp, pval);
-            v4si min2 = _mm_min_epi32(src_tmp2, pval);
-            v4si max = _mm_max_epi32(src_tmp, mval);
-            v4si max2 = _mm_max_epi32(src_tmp2, mval);
-            v4si dst_tmp = _mm_blendv_epi8(max, min, eqmask);
-            v4si dst_tmp2 = _mm_blendv_epi8(max2, min2, eqmask2);
-            _mm_store_si128((__m128i *) (dst + i), dst_tmp);
-            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT32), dst_tmp2);
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT16) {
+            v4si a = _mm_load_si128((__m128i *) (src + i));
+            v4si a2 = _mm_load_si128((__m128i *) (src + i + SSE_LEN_INT16));
+            v4si res = _mm_max_epi16(a, val);
+            v4si res2 = _mm_max_epi16(a2, val);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT16), res2);
         }
     } else {
-        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
-            v4si src_tmp = _mm_loadu_si128((__m128i *) (src + i));
-            v4si src_tmp2 = _mm_loadu_si128((__m128i *) (src + i + SSE_LEN_INT32));
-            v4si src_abs = _mm_abs_epi32(src_tmp);
-            v4si src_abs2 = _mm_abs_epi32(src_tmp2);
-            v4si eqmask = _mm_cmpeq_epi32(src_abs, src_tmp);  // if A = abs(A), then A is >= 0 (mask 0xFFFFFFFF)
-            v4si eqmask2 = _mm_cmpeq_epi32(src_abs2, src_tmp2);
-            v4si min = _mm_min_epi32(src_tmp, pval);
-            v4si min2 = _mm_min_epi32(src_tmp2, pval);
-            v4si max = _mm_max_epi32(src_tmp, mval);
-            v4si max2 = _mm_max_epi32(src_tmp2, mval);
-            v4si dst_tmp = _mm_blendv_epi8(max, min, eqmask);
-            v4si dst_tmp2 = _mm_blendv_epi8(max2, min2, eqmask2);
-            _mm_storeu_si128((__m128i *) (dst + i), dst_tmp);
-            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT32), dst_tmp2);
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT16) {
+            v4si a = _mm_loadu_si128((__m128i *) (src + i));
+            v4si a2 = _mm_loadu_si128((__m128i *) (src + i + SSE_LEN_INT16));
+            v4si res = _mm_max_epi16(a, val);
+            v4si res2 = _mm_max_epi16(a2, val);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT16), res2);
         }
     }
 
     for (int i = stop_len; i < len; i++) {
-        if (src[i] >= 0) {
-            dst[i] = src[i] > value ? value : src[i];
-        } else {
-            dst[i] = src[i] < (-value) ? (-value) : src[i];
+        dst[i] = src[i] > value ? src[i] : value;
+    }
+}
+
+SIMD_UTILS_API void addsatu8_128(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_INT8);
+    stop_len *= (2 * SSE_LEN_INT8);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT8) {
+            v4si a = _mm_load_si128((__m128i *) (src1 + i));
+            v4si b = _mm_load_si128((__m128i *) (src2 + i));
+            v4si a2 = _mm_load_si128((__m128i *) (src1 + i + SSE_LEN_INT8));
+            v4si b2 = _mm_load_si128((__m128i *) (src2 + i + SSE_LEN_INT8));
+            v4si res = _mm_adds_epu8(a, b);
+            v4si res2 = _mm_adds_epu8(a2, b2);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT8), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT8) {
+            v4si a = _mm_loadu_si128((__m128i *) (src1 + i));
+            v4si b = _mm_loadu_si128((__m128i *) (src2 + i));
+            v4si a2 = _mm_loadu_si128((__m128i *) (src1 + i + SSE_LEN_INT8));
+            v4si b2 = _mm_loadu_si128((__m128i *) (src2 + i + SSE_LEN_INT8));
+            v4si res = _mm_adds_epu8(a, b);
+            v4si res2 = _mm_adds_epu8(a2, b2);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT8), res2);
         }
     }
+
+    for (int i = stop_len; i < len; i++) {
+        int tmp = (int) src1[i] + (int) src2[i];
+        dst[i] = (uint8_t) (tmp > UINT8_MAX ? UINT8_MAX : (tmp < 0 ? 0 : tmp));
+    }
 }
 
-static inline void threshold128_lt_s(int32_t *src, int32_t *dst, int len, int32_t value)
+SIMD_UTILS_API void subsatu8_128(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len)
 {
-    const v4si tmp = _mm_set1_epi32(value);
+    int stop_len = len / (2 * SSE_LEN_INT8);
+    stop_len *= (2 * SSE_LEN_INT8);
 
-    int stop_len = len / (2 * SSE_LEN_INT32);
-    stop_len *= (2 * SSE_LEN_INT32);
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT8) {
+            v4si a = _mm_load_si128((__m128i *) (src1 + i));
+            v4si b = _mm_load_si128((__m128i *) (src2 + i));
+            v4si a2 = _mm_load_si128((__m128i *) (src1 + i + SSE_LEN_INT8));
+            v4si b2 = _mm_load_si128((__m128i *) (src2 + i + SSE_LEN_INT8));
+            v4si res = _mm_subs_epu8(a, b);
+            v4si res2 = _mm_subs_epu8(a2, b2);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT8), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT8) {
+            v4si a = _mm_loadu_si128((__m128i *) (src1 + i));
+            v4si b = _mm_loadu_si128((__m128i *) (src2 + i));
+            v4si a2 = _mm_loadu_si128((__m128i *) (src1 + i + SSE_LEN_INT8));
+            v4si b2 = _mm_loadu_si128((__m128i *) (src2 + i + SSE_LEN_INT8));
+            v4si res = _mm_subs_epu8(a, b);
+            v4si res2 = _mm_subs_epu8(a2, b2);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT8), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        int tmp = (int) src1[i] - (int) src2[i];
+        dst[i] = (uint8_t) (tmp > UINT8_MAX ? UINT8_MAX : (tmp < 0 ? 0 : tmp));
+    }
+}
+
+// one of the two saturated differences is 0
+SIMD_UTILS_API void absdiffu8_128(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_INT8);
+    stop_len *= (2 * SSE_LEN_INT8);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT8) {
+            v4si a = _mm_load_si128((__m128i *) (src1 + i));
+            v4si b = _mm_load_si128((__m128i *) (src2 + i));
+            v4si a2 = _mm_load_si128((__m128i *) (src1 + i + SSE_LEN_INT8));
+            v4si b2 = _mm_load_si128((__m128i *) (src2 + i + SSE_LEN_INT8));
+            v4si res = _mm_or_si128(_mm_subs_epu8(a, b), _mm_subs_epu8(b, a));
+            v4si res2 = _mm_or_si128(_mm_subs_epu8(a2, b2), _mm_subs_epu8(b2, a2));
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT8), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT8) {
+            v4si a = _mm_loadu_si128((__m128i *) (src1 + i));
+            v4si b = _mm_loadu_si128((__m128i *) (src2 + i));
+            v4si a2 = _mm_loadu_si128((__m128i *) (src1 + i + SSE_LEN_INT8));
+            v4si b2 = _mm_loadu_si128((__m128i *) (src2 + i + SSE_LEN_INT8));
+            v4si res = _mm_or_si128(_mm_subs_epu8(a, b), _mm_subs_epu8(b, a));
+            v4si res2 = _mm_or_si128(_mm_subs_epu8(a2, b2), _mm_subs_epu8(b2, a2));
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT8), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src1[i] > src2[i] ? src1[i] - src2[i] : src2[i] - src1[i];
+    }
+}
+
+SIMD_UTILS_API void maxeveryu8_128(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_INT8);
+    stop_len *= (2 * SSE_LEN_INT8);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT8) {
+            v4si a = _mm_load_si128((__m128i *) (src1 + i));
+            v4si b = _mm_load_si128((__m128i *) (src2 + i));
+            v4si a2 = _mm_load_si128((__m128i *) (src1 + i + SSE_LEN_INT8));
+            v4si b2 = _mm_load_si128((__m128i *) (src2 + i + SSE_LEN_INT8));
+            v4si res = _mm_max_epu8(a, b);
+            v4si res2 = _mm_max_epu8(a2, b2);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT8), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT8) {
+            v4si a = _mm_loadu_si128((__m128i *) (src1 + i));
+            v4si b = _mm_loadu_si128((__m128i *) (src2 + i));
+            v4si a2 = _mm_loadu_si128((__m128i *) (src1 + i + SSE_LEN_INT8));
+            v4si b2 = _mm_loadu_si128((__m128i *) (src2 + i + SSE_LEN_INT8));
+            v4si res = _mm_max_epu8(a, b);
+            v4si res2 = _mm_max_epu8(a2, b2);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT8), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src1[i] > src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void mineveryu8_128(uint8_t *src1, uint8_t *src2, uint8_t *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_INT8);
+    stop_len *= (2 * SSE_LEN_INT8);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT8) {
+            v4si a = _mm_load_si128((__m128i *) (src1 + i));
+            v4si b = _mm_load_si128((__m128i *) (src2 + i));
+            v4si a2 = _mm_load_si128((__m128i *) (src1 + i + SSE_LEN_INT8));
+            v4si b2 = _mm_load_si128((__m128i *) (src2 + i + SSE_LEN_INT8));
+            v4si res = _mm_min_epu8(a, b);
+            v4si res2 = _mm_min_epu8(a2, b2);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT8), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT8) {
+            v4si a = _mm_loadu_si128((__m128i *) (src1 + i));
+            v4si b = _mm_loadu_si128((__m128i *) (src2 + i));
+            v4si a2 = _mm_loadu_si128((__m128i *) (src1 + i + SSE_LEN_INT8));
+            v4si b2 = _mm_loadu_si128((__m128i *) (src2 + i + SSE_LEN_INT8));
+            v4si res = _mm_min_epu8(a, b);
+            v4si res2 = _mm_min_epu8(a2, b2);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT8), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src1[i] < src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void threshold_gtu8_128(uint8_t *src, uint8_t *dst, int len, uint8_t value)
+{
+    const v4si val = _mm_set1_epi8((char) value);
+
+    int stop_len = len / (2 * SSE_LEN_INT8);
+    stop_len *= (2 * SSE_LEN_INT8);
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
-            v4si src_tmp = _mm_load_si128((__m128i *) (src + i));
-            v4si src_tmp2 = _mm_load_si128((__m128i *) (src + i + SSE_LEN_INT32));
-            v4si dst_tmp = _mm_max_epi32(src_tmp, tmp);
-            v4si dst_tmp2 = _mm_max_epi32(src_tmp2, tmp);
-            _mm_store_si128((__m128i *) (dst + i), dst_tmp);
-            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT32), dst_tmp2);
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT8) {
+            v4si a = _mm_load_si128((__m128i *) (src + i));
+            v4si a2 = _mm_load_si128((__m128i *) (src + i + SSE_LEN_INT8));
+            v4si res = _mm_min_epu8(a, val);
+            v4si res2 = _mm_min_epu8(a2, val);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT8), res2);
         }
     } else {
-        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
-            v4si src_tmp = _mm_loadu_si128((__m128i *) (src + i));
-            v4si src_tmp2 = _mm_loadu_si128((__m128i *) (src + i + SSE_LEN_INT32));
-            v4si dst_tmp = _mm_max_epi32(src_tmp, tmp);
-            v4si dst_tmp2 = _mm_max_epi32(src_tmp2, tmp);
-            _mm_storeu_si128((__m128i *) (dst + i), dst_tmp);
-            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT32), dst_tmp2);
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT8) {
+            v4si a = _mm_loadu_si128((__m128i *) (src + i));
+            v4si a2 = _mm_loadu_si128((__m128i *) (src + i + SSE_LEN_INT8));
+            v4si res = _mm_min_epu8(a, val);
+            v4si res2 = _mm_min_epu8(a2, val);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT8), res2);
         }
     }
 
     for (int i = stop_len; i < len; i++) {
-        dst[i] = src[i] > value ? src[i] : value;
+        dst[i] = src[i] < value ? src[i] : value;
     }
 }
 
-static inline void threshold128_ltabs_s(int32_t *src, int32_t *dst, int len, int32_t value)
+SIMD_UTILS_API void threshold_ltu8_128(uint8_t *src, uint8_t *dst, int len, uint8_t value)
 {
-    const v4si pval = _mm_set1_epi32(value);
-    const v4si mval = _mm_set1_epi32(-value);
+    const v4si val = _mm_set1_epi8((char) value);
 
-    int stop_len = len / (2 * SSE_LEN_INT32);
-    stop_len *= (2 * SSE_LEN_INT32);
+    int stop_len = len / (2 * SSE_LEN_INT8);
+    stop_len *= (2 * SSE_LEN_INT8);
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
-            v4si src_tmp = _mm_load_si128((__m128i *) (src + i));
-            v4si src_tmp2 = _mm_load_si128((__m128i *) (src + i + SSE_LEN_INT32));
-            v4si src_abs = _mm_abs_epi32(src_tmp);
-            v4si src_abs2 = _mm_abs_epi32(src_tmp2);
-            v4si eqmask = _mm_cmpeq_epi32(src_abs, src_tmp);  // if A = abs(A), then A is >= 0 (mask 0xFFFFFFFF)
-            v4si eqmask2 = _mm_cmpeq_epi32(src_abs2, src_tmp2);
-            v4si max = _mm_max_epi32(src_tmp, pval);
-            v4si max2 = _mm_max_epi32(src_tmp2, pval);
-            v4si min = _mm_min_epi32(src_tmp, mval);
-            v4si min2 = _mm_min_epi32(src_tmp2, mval);
-            v4si dst_tmp = _mm_blendv_epi8(min, max, eqmask);
-            v4si dst_tmp2 = _mm_blendv_epi8(min2, max2, eqmask2);
-            _mm_store_si128((__m128i *) (dst + i), dst_tmp);
-            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT32), dst_tmp2);
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT8) {
+            v4si a = _mm_load_si128((__m128i *) (src + i));
+            v4si a2 = _mm_load_si128((__m128i *) (src + i + SSE_LEN_INT8));
+            v4si res = _mm_max_epu8(a, val);
+            v4si res2 = _mm_max_epu8(a2, val);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT8), res2);
         }
     } else {
-        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
-            v4si src_tmp = _mm_loadu_si128((__m128i *) (src + i));
-            v4si src_tmp2 = _mm_loadu_si128((__m128i *) (src + i + SSE_LEN_INT32));
-            v4si src_abs = _mm_abs_epi32(src_tmp);
-            v4si src_abs2 = _mm_abs_epi32(src_tmp2);
-            v4si eqmask = _mm_cmpeq_epi32(src_abs, src_tmp);  // if A = abs(A), then A is >= 0 (mask 0xFFFFFFFF)
-            v4si eqmask2 = _mm_cmpeq_epi32(src_abs2, src_tmp2);
-            v4si max = _mm_max_epi32(src_tmp, pval);
-            v4si max2 = _mm_max_epi32(src_tmp2, pval);
-            v4si min = _mm_min_epi32(src_tmp, mval);
-            v4si min2 = _mm_min_epi32(src_tmp2, mval);
-            v4si dst_tmp = _mm_blendv_epi8(min, max, eqmask);
-            v4si dst_tmp2 = _mm_blendv_epi8(min2, max2, eqmask2);
-            _mm_storeu_si128((__m128i *) (dst + i), dst_tmp);
-            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT32), dst_tmp2);
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT8) {
+            v4si a = _mm_loadu_si128((__m128i *) (src + i));
+            v4si a2 = _mm_loadu_si128((__m128i *) (src + i + SSE_LEN_INT8));
+            v4si res = _mm_max_epu8(a, val);
+            v4si res2 = _mm_max_epu8(a2, val);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT8), res2);
         }
     }
 
     for (int i = stop_len; i < len; i++) {
-        if (src[i] >= 0) {
-            dst[i] = src[i] < value ? value : src[i];
-        } else {
-            dst[i] = src[i] > (-value) ? (-value) : src[i];
+        dst[i] = src[i] > value ? src[i] : value;
+    }
+}
+
+// src >> scale_factor saturated to [0, 255]
+SIMD_UTILS_API void convertInt16ToU8_128(int16_t *src, uint8_t *dst, int len, int scale_factor)
+{
+    int stop_len = len / SSE_LEN_INT8;
+    stop_len *= SSE_LEN_INT8;
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += SSE_LEN_INT8) {
+            v4si a = _mm_load_si128((__m128i *) (src + i));
+            v4si a2 = _mm_load_si128((__m128i *) (src + i + SSE_LEN_INT16));
+            v4si res = _mm_packus_epi16(_mm_srai_epi16(a, scale_factor), _mm_srai_epi16(a2, scale_factor));
+            _mm_store_si128((__m128i *) (dst + i), res);
         }
+    } else {
+        for (int i = 0; i < stop_len; i += SSE_LEN_INT8) {
+            v4si a = _mm_loadu_si128((__m128i *) (src + i));
+            v4si a2 = _mm_loadu_si128((__m128i *) (src + i + SSE_LEN_INT16));
+            v4si res = _mm_packus_epi16(_mm_srai_epi16(a, scale_factor), _mm_srai_epi16(a2, scale_factor));
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        int16_t tmp = (int16_t) (src[i] >> scale_factor);
+        dst[i] = (uint8_t) (tmp > UINT8_MAX ? UINT8_MAX : (tmp < 0 ? 0 : tmp));
     }
 }
 
-static inline void threshold128_ltval_gtval_s(int32_t *src, int32_t *dst, int len, int32_t ltlevel, int32_t ltvalue, int32_t gtlevel, int32_t gtvalue)
+// src << scale_factor, scale_factor up to 7
+SIMD_UTILS_API void convertU8ToInt16_128(uint8_t *src, int16_t *dst, int len, int scale_factor)
 {
-    const v4si ltlevel_v = _mm_set1_epi32(ltlevel);
-    const v4si ltvalue_v = _mm_set1_epi32(ltvalue);
-    const v4si gtlevel_v = _mm_set1_epi32(gtlevel);
-    const v4si gtvalue_v = _mm_set1_epi32(gtvalue);
+    const v4si zero = _mm_setzero_si128();
 
-    int stop_len = len / (2 * SSE_LEN_FLOAT);
-    stop_len *= (2 * SSE_LEN_FLOAT);
+    int stop_len = len / SSE_LEN_INT8;
+    stop_len *= SSE_LEN_INT8;
 
     if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
-        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
-            v4si src_tmp = _mm_load_si128((__m128i *) (src + i));
-            v4si src_tmp2 = _mm_load_si128((__m128i *) (src + i + SSE_LEN_FLOAT));
-            v4si lt_mask = _mm_cmplt_epi32(src_tmp, ltlevel_v);
-            v4si gt_mask = _mm_cmpgt_epi32(src_tmp, gtlevel_v);
-            v4si dst_tmp = _mm_blendv_epi8(src_tmp, ltvalue_v, lt_mask);
-            dst_tmp = _mm_blendv_epi8(dst_tmp, gtvalue_v, gt_mask);
-            _mm_store_si128((__m128i *) (dst + i), dst_tmp);
-            v4si lt_mask2 = _mm_cmplt_epi32(src_tmp2, ltlevel_v);
-            v4si gt_mask2 = _mm_cmpgt_epi32(src_tmp2, gtlevel_v);
-            v4si dst_tmp2 = _mm_blendv_epi8(src_tmp2, ltvalue_v, lt_mask2);
-            dst_tmp2 = _mm_blendv_epi8(dst_tmp2, gtvalue_v, gt_mask2);
-            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_FLOAT), dst_tmp2);
+        for (int i = 0; i < stop_len; i += SSE_LEN_INT8) {
+            v4si a = _mm_load_si128((__m128i *) (src + i));
+            v4si res = _mm_slli_epi16(_mm_unpacklo_epi8(a, zero), scale_factor);
+            v4si res2 = _mm_slli_epi16(_mm_unpackhi_epi8(a, zero), scale_factor);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT16), res2);
         }
     } else {
-        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
-            v4si src_tmp = _mm_loadu_si128((__m128i *) (src + i));
-            v4si src_tmp2 = _mm_loadu_si128((__m128i *) (src + i + SSE_LEN_FLOAT));
-            v4si lt_mask = _mm_cmplt_epi32(src_tmp, ltlevel_v);
-            v4si gt_mask = _mm_cmpgt_epi32(src_tmp, gtlevel_v);
-            v4si dst_tmp = _mm_blendv_epi8(src_tmp, ltvalue_v, lt_mask);
-            dst_tmp = _mm_blendv_epi8(dst_tmp, gtvalue_v, gt_mask);
-            _mm_storeu_si128((__m128i *) (dst + i), dst_tmp);
-            v4si lt_mask2 = _mm_cmplt_epi32(src_tmp2, ltlevel_v);
-            v4si gt_mask2 = _mm_cmpgt_epi32(src_tmp2, gtlevel_v);
-            v4si dst_tmp2 = _mm_blendv_epi8(src_tmp2, ltvalue_v, lt_mask2);
-            dst_tmp2 = _mm_blendv_epi8(dst_tmp2, gtvalue_v, gt_mask2);
-            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_FLOAT), dst_tmp2);
+        for (int i = 0; i < stop_len; i += SSE_LEN_INT8) {
+            v4si a = _mm_loadu_si128((__m128i *) (src + i));
+            v4si res = _mm_slli_epi16(_mm_unpacklo_epi8(a, zero), scale_factor);
+            v4si res2 = _mm_slli_epi16(_mm_unpackhi_epi8(a, zero), scale_factor);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT16), res2);
         }
     }
 
     for (int i = stop_len; i < len; i++) {
-        dst[i] = src[i] < ltlevel ? ltvalue : src[i];
-        dst[i] = src[i] > gtlevel ? gtvalue : dst[i];
+        dst[i] = (int16_t) (src[i] << scale_factor);
+    }
+}
+
+SIMD_UTILS_API void add64s_128s(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_INT64);
+    stop_len *= (2 * SSE_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            v2sid a = _mm_load_si128((__m128i *) (src1 + i));
+            v2sid b = _mm_load_si128((__m128i *) (src2 + i));
+            v2sid a2 = _mm_load_si128((__m128i *) (src1 + i + SSE_LEN_INT64));
+            v2sid b2 = _mm_load_si128((__m128i *) (src2 + i + SSE_LEN_INT64));
+            v2sid res = _mm_add_epi64(a, b);
+            v2sid res2 = _mm_add_epi64(a2, b2);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            v2sid a = _mm_loadu_si128((__m128i *) (src1 + i));
+            v2sid b = _mm_loadu_si128((__m128i *) (src2 + i));
+            v2sid a2 = _mm_loadu_si128((__m128i *) (src1 + i + SSE_LEN_INT64));
+            v2sid b2 = _mm_loadu_si128((__m128i *) (src2 + i + SSE_LEN_INT64));
+            v2sid res = _mm_add_epi64(a, b);
+            v2sid res2 = _mm_add_epi64(a2, b2);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = (int64_t) ((uint64_t) src1[i] + (uint64_t) src2[i]);
+    }
+}
+
+SIMD_UTILS_API void sub64s_128s(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_INT64);
+    stop_len *= (2 * SSE_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            v2sid a = _mm_load_si128((__m128i *) (src1 + i));
+            v2sid b = _mm_load_si128((__m128i *) (src2 + i));
+            v2sid a2 = _mm_load_si128((__m128i *) (src1 + i + SSE_LEN_INT64));
+            v2sid b2 = _mm_load_si128((__m128i *) (src2 + i + SSE_LEN_INT64));
+            v2sid res = _mm_sub_epi64(a, b);
+            v2sid res2 = _mm_sub_epi64(a2, b2);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            v2sid a = _mm_loadu_si128((__m128i *) (src1 + i));
+            v2sid b = _mm_loadu_si128((__m128i *) (src2 + i));
+            v2sid a2 = _mm_loadu_si128((__m128i *) (src1 + i + SSE_LEN_INT64));
+            v2sid b2 = _mm_loadu_si128((__m128i *) (src2 + i + SSE_LEN_INT64));
+            v2sid res = _mm_sub_epi64(a, b);
+            v2sid res2 = _mm_sub_epi64(a2, b2);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = (int64_t) ((uint64_t) src1[i] - (uint64_t) src2[i]);
+    }
+}
+
+// low 64 bits of the products
+SIMD_UTILS_API void mul64s_128s(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_INT64);
+    stop_len *= (2 * SSE_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            v2sid a = _mm_load_si128((__m128i *) (src1 + i));
+            v2sid b = _mm_load_si128((__m128i *) (src2 + i));
+            v2sid a2 = _mm_load_si128((__m128i *) (src1 + i + SSE_LEN_INT64));
+            v2sid b2 = _mm_load_si128((__m128i *) (src2 + i + SSE_LEN_INT64));
+            v2sid res = _mm_mullo_epi64_custom(a, b);
+            v2sid res2 = _mm_mullo_epi64_custom(a2, b2);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            v2sid a = _mm_loadu_si128((__m128i *) (src1 + i));
+            v2sid b = _mm_loadu_si128((__m128i *) (src2 + i));
+            v2sid a2 = _mm_loadu_si128((__m128i *) (src1 + i + SSE_LEN_INT64));
+            v2sid b2 = _mm_loadu_si128((__m128i *) (src2 + i + SSE_LEN_INT64));
+            v2sid res = _mm_mullo_epi64_custom(a, b);
+            v2sid res2 = _mm_mullo_epi64_custom(a2, b2);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = (int64_t) ((uint64_t) src1[i] * (uint64_t) src2[i]);
+    }
+}
+
+SIMD_UTILS_API void sum64s_128s(int64_t *src, int64_t *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_INT64);
+    stop_len *= (2 * SSE_LEN_INT64);
+
+    __attribute__((aligned(SSE_LEN_BYTES))) int64_t accumulate[SSE_LEN_INT64];
+    int64_t tmp_acc = 0;
+    v2sid vec_acc1 = _mm_setzero_si128();
+    v2sid vec_acc2 = _mm_setzero_si128();
+
+    if (isAligned((uintptr_t) (src), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            vec_acc1 = _mm_add_epi64(vec_acc1, _mm_load_si128((__m128i *) (src + i)));
+            vec_acc2 = _mm_add_epi64(vec_acc2, _mm_load_si128((__m128i *) (src + i + SSE_LEN_INT64)));
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            vec_acc1 = _mm_add_epi64(vec_acc1, _mm_loadu_si128((__m128i *) (src + i)));
+            vec_acc2 = _mm_add_epi64(vec_acc2, _mm_loadu_si128((__m128i *) (src + i + SSE_LEN_INT64)));
+        }
+    }
+    _mm_store_si128((__m128i *) accumulate, _mm_add_epi64(vec_acc1, vec_acc2));
+
+    for (int i = stop_len; i < len; i++) {
+        tmp_acc += src[i];
+    }
+
+    for (int i = 0; i < SSE_LEN_INT64; i++) {
+        tmp_acc += accumulate[i];
     }
+
+    *dst = tmp_acc;
+}
+
+SIMD_UTILS_API void maxevery64s_128s(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_INT64);
+    stop_len *= (2 * SSE_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            v2sid a = _mm_load_si128((__m128i *) (src1 + i));
+            v2sid b = _mm_load_si128((__m128i *) (src2 + i));
+            v2sid a2 = _mm_load_si128((__m128i *) (src1 + i + SSE_LEN_INT64));
+            v2sid b2 = _mm_load_si128((__m128i *) (src2 + i + SSE_LEN_INT64));
+            v2sid res = _mm_max_epi64_custom(a, b);
+            v2sid res2 = _mm_max_epi64_custom(a2, b2);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            v2sid a = _mm_loadu_si128((__m128i *) (src1 + i));
+            v2sid b = _mm_loadu_si128((__m128i *) (src2 + i));
+            v2sid a2 = _mm_loadu_si128((__m128i *) (src1 + i + SSE_LEN_INT64));
+            v2sid b2 = _mm_loadu_si128((__m128i *) (src2 + i + SSE_LEN_INT64));
+            v2sid res = _mm_max_epi64_custom(a, b);
+            v2sid res2 = _mm_max_epi64_custom(a2, b2);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src1[i] > src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void minevery64s_128s(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_INT64);
+    stop_len *= (2 * SSE_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            v2sid a = _mm_load_si128((__m128i *) (src1 + i));
+            v2sid b = _mm_load_si128((__m128i *) (src2 + i));
+            v2sid a2 = _mm_load_si128((__m128i *) (src1 + i + SSE_LEN_INT64));
+            v2sid b2 = _mm_load_si128((__m128i *) (src2 + i + SSE_LEN_INT64));
+            v2sid res = _mm_min_epi64_custom(a, b);
+            v2sid res2 = _mm_min_epi64_custom(a2, b2);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            v2sid a = _mm_loadu_si128((__m128i *) (src1 + i));
+            v2sid b = _mm_loadu_si128((__m128i *) (src2 + i));
+            v2sid a2 = _mm_loadu_si128((__m128i *) (src1 + i + SSE_LEN_INT64));
+            v2sid b2 = _mm_loadu_si128((__m128i *) (src2 + i + SSE_LEN_INT64));
+            v2sid res = _mm_min_epi64_custom(a, b);
+            v2sid res2 = _mm_min_epi64_custom(a2, b2);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src1[i] < src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void maxeveryu64_128(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_INT64);
+    stop_len *= (2 * SSE_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            v2sid a = _mm_load_si128((__m128i *) (src1 + i));
+            v2sid b = _mm_load_si128((__m128i *) (src2 + i));
+            v2sid a2 = _mm_load_si128((__m128i *) (src1 + i + SSE_LEN_INT64));
+            v2sid b2 = _mm_load_si128((__m128i *) (src2 + i + SSE_LEN_INT64));
+            v2sid res = _mm_max_epu64_custom(a, b);
+            v2sid res2 = _mm_max_epu64_custom(a2, b2);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            v2sid a = _mm_loadu_si128((__m128i *) (src1 + i));
+            v2sid b = _mm_loadu_si128((__m128i *) (src2 + i));
+            v2sid a2 = _mm_loadu_si128((__m128i *) (src1 + i + SSE_LEN_INT64));
+            v2sid b2 = _mm_loadu_si128((__m128i *) (src2 + i + SSE_LEN_INT64));
+            v2sid res = _mm_max_epu64_custom(a, b);
+            v2sid res2 = _mm_max_epu64_custom(a2, b2);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src1[i] > src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void mineveryu64_128(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_INT64);
+    stop_len *= (2 * SSE_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            v2sid a = _mm_load_si128((__m128i *) (src1 + i));
+            v2sid b = _mm_load_si128((__m128i *) (src2 + i));
+            v2sid a2 = _mm_load_si128((__m128i *) (src1 + i + SSE_LEN_INT64));
+            v2sid b2 = _mm_load_si128((__m128i *) (src2 + i + SSE_LEN_INT64));
+            v2sid res = _mm_min_epu64_custom(a, b);
+            v2sid res2 = _mm_min_epu64_custom(a2, b2);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            v2sid a = _mm_loadu_si128((__m128i *) (src1 + i));
+            v2sid b = _mm_loadu_si128((__m128i *) (src2 + i));
+            v2sid a2 = _mm_loadu_si128((__m128i *) (src1 + i + SSE_LEN_INT64));
+            v2sid b2 = _mm_loadu_si128((__m128i *) (src2 + i + SSE_LEN_INT64));
+            v2sid res = _mm_min_epu64_custom(a, b);
+            v2sid res2 = _mm_min_epu64_custom(a2, b2);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src1[i] < src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void minmax64s_128s(int64_t *src, int len, int64_t *min_value, int64_t *max_value)
+{
+    if (len <= 0)
+        return;
+
+    int stop_len = len / SSE_LEN_INT64;
+    stop_len *= SSE_LEN_INT64;
+
+    __attribute__((aligned(SSE_LEN_BYTES))) int64_t max_f[SSE_LEN_INT64];
+    __attribute__((aligned(SSE_LEN_BYTES))) int64_t min_f[SSE_LEN_INT64];
+    int64_t max_tmp = src[0];
+    int64_t min_tmp = src[0];
+    v2sid max_v = _mm_set1_epi64x((int64_t) src[0]);
+    v2sid min_v = max_v;
+
+    if (isAligned((uintptr_t) (src), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += SSE_LEN_INT64) {
+            v2sid a = _mm_load_si128((__m128i *) (src + i));
+            max_v = _mm_max_epi64_custom(max_v, a);
+            min_v = _mm_min_epi64_custom(min_v, a);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += SSE_LEN_INT64) {
+            v2sid a = _mm_loadu_si128((__m128i *) (src + i));
+            max_v = _mm_max_epi64_custom(max_v, a);
+            min_v = _mm_min_epi64_custom(min_v, a);
+        }
+    }
+    _mm_store_si128((__m128i *) max_f, max_v);
+    _mm_store_si128((__m128i *) min_f, min_v);
+
+    for (int i = 0; i < SSE_LEN_INT64; i++) {
+        max_tmp = max_f[i] > max_tmp ? max_f[i] : max_tmp;
+        min_tmp = min_f[i] < min_tmp ? min_f[i] : min_tmp;
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        max_tmp = src[i] > max_tmp ? src[i] : max_tmp;
+        min_tmp = src[i] < min_tmp ? src[i] : min_tmp;
+    }
+
+    *max_value = max_tmp;
+    *min_value = min_tmp;
+}
+
+SIMD_UTILS_API void minmaxu64_128(uint64_t *src, int len, uint64_t *min_value, uint64_t *max_value)
+{
+    if (len <= 0)
+        return;
+
+    int stop_len = len / SSE_LEN_INT64;
+    stop_len *= SSE_LEN_INT64;
+
+    __attribute__((aligned(SSE_LEN_BYTES))) uint64_t max_f[SSE_LEN_INT64];
+    __attribute__((aligned(SSE_LEN_BYTES))) uint64_t min_f[SSE_LEN_INT64];
+    uint64_t max_tmp = src[0];
+    uint64_t min_tmp = src[0];
+    v2sid max_v = _mm_set1_epi64x((int64_t) src[0]);
+    v2sid min_v = max_v;
+
+    if (isAligned((uintptr_t) (src), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += SSE_LEN_INT64) {
+            v2sid a = _mm_load_si128((__m128i *) (src + i));
+            max_v = _mm_max_epu64_custom(max_v, a);
+            min_v = _mm_min_epu64_custom(min_v, a);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += SSE_LEN_INT64) {
+            v2sid a = _mm_loadu_si128((__m128i *) (src + i));
+            max_v = _mm_max_epu64_custom(max_v, a);
+            min_v = _mm_min_epu64_custom(min_v, a);
+        }
+    }
+    _mm_store_si128((__m128i *) max_f, max_v);
+    _mm_store_si128((__m128i *) min_f, min_v);
+
+    for (int i = 0; i < SSE_LEN_INT64; i++) {
+        max_tmp = max_f[i] > max_tmp ? max_f[i] : max_tmp;
+        min_tmp = min_f[i] < min_tmp ? min_f[i] : min_tmp;
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        max_tmp = src[i] > max_tmp ? src[i] : max_tmp;
+        min_tmp = src[i] < min_tmp ? src[i] : min_tmp;
+    }
+
+    *max_value = max_tmp;
+    *min_value = min_tmp;
+}
+
+// dst is all ones where the comparison holds, 0 elsewhere
+SIMD_UTILS_API void cmpeq64s_128s(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_INT64);
+    stop_len *= (2 * SSE_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            v2sid a = _mm_load_si128((__m128i *) (src1 + i));
+            v2sid b = _mm_load_si128((__m128i *) (src2 + i));
+            v2sid a2 = _mm_load_si128((__m128i *) (src1 + i + SSE_LEN_INT64));
+            v2sid b2 = _mm_load_si128((__m128i *) (src2 + i + SSE_LEN_INT64));
+            v2sid res = _mm_cmpeq_epi64(a, b);
+            v2sid res2 = _mm_cmpeq_epi64(a2, b2);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            v2sid a = _mm_loadu_si128((__m128i *) (src1 + i));
+            v2sid b = _mm_loadu_si128((__m128i *) (src2 + i));
+            v2sid a2 = _mm_loadu_si128((__m128i *) (src1 + i + SSE_LEN_INT64));
+            v2sid b2 = _mm_loadu_si128((__m128i *) (src2 + i + SSE_LEN_INT64));
+            v2sid res = _mm_cmpeq_epi64(a, b);
+            v2sid res2 = _mm_cmpeq_epi64(a2, b2);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src1[i] == src2[i] ? -1 : 0;
+    }
+}
+
+SIMD_UTILS_API void cmpgt64s_128s(int64_t *src1, int64_t *src2, int64_t *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_INT64);
+    stop_len *= (2 * SSE_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            v2sid a = _mm_load_si128((__m128i *) (src1 + i));
+            v2sid b = _mm_load_si128((__m128i *) (src2 + i));
+            v2sid a2 = _mm_load_si128((__m128i *) (src1 + i + SSE_LEN_INT64));
+            v2sid b2 = _mm_load_si128((__m128i *) (src2 + i + SSE_LEN_INT64));
+            v2sid res = _mm_cmpgt_epi64(a, b);
+            v2sid res2 = _mm_cmpgt_epi64(a2, b2);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            v2sid a = _mm_loadu_si128((__m128i *) (src1 + i));
+            v2sid b = _mm_loadu_si128((__m128i *) (src2 + i));
+            v2sid a2 = _mm_loadu_si128((__m128i *) (src1 + i + SSE_LEN_INT64));
+            v2sid b2 = _mm_loadu_si128((__m128i *) (src2 + i + SSE_LEN_INT64));
+            v2sid res = _mm_cmpgt_epi64(a, b);
+            v2sid res2 = _mm_cmpgt_epi64(a2, b2);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src1[i] > src2[i] ? -1 : 0;
+    }
+}
+
+SIMD_UTILS_API void cmpgtu64_128(uint64_t *src1, uint64_t *src2, uint64_t *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_INT64);
+    stop_len *= (2 * SSE_LEN_INT64);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            v2sid a = _mm_load_si128((__m128i *) (src1 + i));
+            v2sid b = _mm_load_si128((__m128i *) (src2 + i));
+            v2sid a2 = _mm_load_si128((__m128i *) (src1 + i + SSE_LEN_INT64));
+            v2sid b2 = _mm_load_si128((__m128i *) (src2 + i + SSE_LEN_INT64));
+            v2sid res = _mm_cmpgt_epu64_custom(a, b);
+            v2sid res2 = _mm_cmpgt_epu64_custom(a2, b2);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            v2sid a = _mm_loadu_si128((__m128i *) (src1 + i));
+            v2sid b = _mm_loadu_si128((__m128i *) (src2 + i));
+            v2sid a2 = _mm_loadu_si128((__m128i *) (src1 + i + SSE_LEN_INT64));
+            v2sid b2 = _mm_loadu_si128((__m128i *) (src2 + i + SSE_LEN_INT64));
+            v2sid res = _mm_cmpgt_epu64_custom(a, b);
+            v2sid res2 = _mm_cmpgt_epu64_custom(a2, b2);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src1[i] > src2[i] ? UINT64_MAX : 0;
+    }
+}
+
+// shift in [0, 63]
+SIMD_UTILS_API void sll64s_128s(int64_t *src, int64_t *dst, int len, int shift)
+{
+    int stop_len = len / (2 * SSE_LEN_INT64);
+    stop_len *= (2 * SSE_LEN_INT64);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            v2sid a = _mm_load_si128((__m128i *) (src + i));
+            v2sid a2 = _mm_load_si128((__m128i *) (src + i + SSE_LEN_INT64));
+            v2sid res = _mm_slli_epi64(a, shift);
+            v2sid res2 = _mm_slli_epi64(a2, shift);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            v2sid a = _mm_loadu_si128((__m128i *) (src + i));
+            v2sid a2 = _mm_loadu_si128((__m128i *) (src + i + SSE_LEN_INT64));
+            v2sid res = _mm_slli_epi64(a, shift);
+            v2sid res2 = _mm_slli_epi64(a2, shift);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = (int64_t) ((uint64_t) src[i] << shift);
+    }
+}
+
+SIMD_UTILS_API void sra64s_128s(int64_t *src, int64_t *dst, int len, int shift)
+{
+    int stop_len = len / (2 * SSE_LEN_INT64);
+    stop_len *= (2 * SSE_LEN_INT64);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            v2sid a = _mm_load_si128((__m128i *) (src + i));
+            v2sid a2 = _mm_load_si128((__m128i *) (src + i + SSE_LEN_INT64));
+            v2sid res = _mm_srai_epi64_custom(a, shift);
+            v2sid res2 = _mm_srai_epi64_custom(a2, shift);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            v2sid a = _mm_loadu_si128((__m128i *) (src + i));
+            v2sid a2 = _mm_loadu_si128((__m128i *) (src + i + SSE_LEN_INT64));
+            v2sid res = _mm_srai_epi64_custom(a, shift);
+            v2sid res2 = _mm_srai_epi64_custom(a2, shift);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src[i] >> shift;
+    }
+}
+
+SIMD_UTILS_API void srlu64_128(uint64_t *src, uint64_t *dst, int len, int shift)
+{
+    int stop_len = len / (2 * SSE_LEN_INT64);
+    stop_len *= (2 * SSE_LEN_INT64);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            v2sid a = _mm_load_si128((__m128i *) (src + i));
+            v2sid a2 = _mm_load_si128((__m128i *) (src + i + SSE_LEN_INT64));
+            v2sid res = _mm_srli_epi64(a, shift);
+            v2sid res2 = _mm_srli_epi64(a2, shift);
+            _mm_store_si128((__m128i *) (dst + i), res);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT64), res2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT64) {
+            v2sid a = _mm_loadu_si128((__m128i *) (src + i));
+            v2sid a2 = _mm_loadu_si128((__m128i *) (src + i + SSE_LEN_INT64));
+            v2sid res = _mm_srli_epi64(a, shift);
+            v2sid res2 = _mm_srli_epi64(a2, shift);
+            _mm_storeu_si128((__m128i *) (dst + i), res);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT64), res2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src[i] >> shift;
+    }
+}
+
+/*
+static inline void print8i(__m128i v)
+{
+    int16_t *p = (int16_t *) &v;
+#ifndef __SSE2__
+    _mm_empty();
+#endif
+    printf("[%d, %d, %d, %d,%d, %d, %d, %d]", p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7]);
+}*/
+
+SIMD_UTILS_API void powerspect16s_128s_interleaved(complex16s_t *src, int32_t *dst, int len)
+{
+    int stop_len = len / SSE_LEN_INT32;
+    stop_len *= SSE_LEN_INT32;
+
+    int j = 0;
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += SSE_LEN_INT32) {
+            __m128i reim = _mm_load_si128((__m128i *) ((const int16_t *) src + j));
+            // print8i(reim); printf("\n");
+            _mm_store_si128((__m128i *) (dst + i), _mm_madd_epi16(reim, reim));
+            j += SSE_LEN_INT16;
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += SSE_LEN_INT32) {
+            __m128i reim = _mm_loadu_si128((__m128i *) ((const int16_t *) src + j));
+            _mm_storeu_si128((__m128i *) (dst + i), _mm_madd_epi16(reim, reim));
+            j += SSE_LEN_INT16;
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = (int32_t) src[i].re * (int32_t) src[i].re + (int32_t) src[i].im * (int32_t) src[i].im;
+    }
+}
+
+// Works with positive scale_factor (divides final value)
+SIMD_UTILS_API void sum16s32s128(int16_t *src, int len, int32_t *dst, int scale_factor)
+{
+    int stop_len = len / (4 * SSE_LEN_INT16);
+    stop_len *= (4 * SSE_LEN_INT16);
+
+    __attribute__((aligned(SSE_LEN_BYTES))) int32_t accumulate[SSE_LEN_INT32];
+    int32_t tmp_acc = 0;
+    int16_t scale = 1 << scale_factor;
+    v4si one = _mm_set1_epi16(1);
+    v4si vec_acc1 = _mm_setzero_si128();  // initialize the vector accumulator
+    v4si vec_acc2 = _mm_setzero_si128();  // initialize the vector accumulator
+
+    if (isAligned((uintptr_t) (src), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 4 * SSE_LEN_INT16) {
+            v4si vec_src_tmp = _mm_load_si128((__m128i *) ((const int16_t *) src + i));
+            v4si vec_src_tmp2 = _mm_load_si128((__m128i *) ((const int16_t *) src + i + SSE_LEN_INT16));
+            v4si vec_src_tmp3 = _mm_load_si128((__m128i *) ((const int16_t *) src + i + 2 * SSE_LEN_INT16));
+            v4si vec_src_tmp4 = _mm_load_si128((__m128i *) ((const int16_t *) src + i + 3 * SSE_LEN_INT16));
+            vec_src_tmp = _mm_madd_epi16(vec_src_tmp, one);
+            vec_src_tmp2 = _mm_madd_epi16(vec_src_tmp2, one);
+            vec_src_tmp3 = _mm_madd_epi16(vec_src_tmp3, one);
+            vec_src_tmp4 = _mm_madd_epi16(vec_src_tmp4, one);
+            vec_src_tmp = _mm_add_epi32(vec_src_tmp, vec_src_tmp2);
+            vec_src_tmp3 = _mm_add_epi32(vec_src_tmp3, vec_src_tmp4);
+            vec_acc1 = _mm_add_epi32(vec_src_tmp, vec_acc1);
+            vec_acc2 = _mm_add_epi32(vec_src_tmp3, vec_acc2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 4 * SSE_LEN_INT16) {
+            v4si vec_src_tmp = _mm_loadu_si128((__m128i *) ((const int16_t *) src + i));
+            v4si vec_src_tmp2 = _mm_loadu_si128((__m128i *) ((const int16_t *) src + i + SSE_LEN_INT16));
+            v4si vec_src_tmp3 = _mm_loadu_si128((__m128i *) ((const int16_t *) src + i + 2 * SSE_LEN_INT16));
+            v4si vec_src_tmp4 = _mm_loadu_si128((__m128i *) ((const int16_t *) src + i + 3 * SSE_LEN_INT16));
+            vec_src_tmp = _mm_madd_epi16(vec_src_tmp, one);
+            vec_src_tmp2 = _mm_madd_epi16(vec_src_tmp2, one);
+            vec_src_tmp3 = _mm_madd_epi16(vec_src_tmp3, one);
+            vec_src_tmp4 = _mm_madd_epi16(vec_src_tmp4, one);
+            vec_src_tmp = _mm_add_epi32(vec_src_tmp, vec_src_tmp2);
+            vec_src_tmp3 = _mm_add_epi32(vec_src_tmp3, vec_src_tmp4);
+            vec_acc1 = _mm_add_epi32(vec_src_tmp, vec_acc1);
+            vec_acc2 = _mm_add_epi32(vec_src_tmp3, vec_acc2);
+        }
+    }
+
+    vec_acc1 = _mm_add_epi32(vec_acc1, vec_acc2);
+    _mm_store_si128((__m128i *) accumulate, vec_acc1);
+
+    for (int i = stop_len; i < len; i++) {
+        tmp_acc += (int32_t) src[i];
+    }
+
+    tmp_acc = tmp_acc + accumulate[0] + accumulate[1] + accumulate[2] + accumulate[3];
+
+    tmp_acc /= scale;
+    *dst = tmp_acc;
+}
+
+SIMD_UTILS_API void flip128s(int32_t *src, int32_t *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_INT32);
+    stop_len *= (2 * SSE_LEN_INT32);
+
+    int mini = ((len - 1) < (2 * SSE_LEN_INT32)) ? (len - 1) : (2 * SSE_LEN_INT32);
+    for (int i = 0; i < mini; i++) {
+        dst[len - i - 1] = src[i];
+    }
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst + len - SSE_LEN_INT32), SSE_LEN_BYTES)) {
+        for (int i = 2 * SSE_LEN_INT32; i < stop_len; i += 2 * SSE_LEN_INT32) {
+            v4si src_tmp = _mm_load_si128((__m128i *) ((const int32_t *) src + i));  // load a,b,c,d
+            v4si src_tmp2 = _mm_load_si128((__m128i *) ((const int32_t *) src + i + SSE_LEN_INT32));
+            v4si src_tmp_slip = _mm_shuffle_epi32(src_tmp, IMM8_FLIP_VEC);  // rotate vec from abcd to bcba
+            v4si src_tmp_slip2 = _mm_shuffle_epi32(src_tmp2, IMM8_FLIP_VEC);
+            _mm_store_si128((__m128i *) (dst + len - i - SSE_LEN_INT32), src_tmp_slip);  // store the flipped vector
+            _mm_store_si128((__m128i *) (dst + len - i - 2 * SSE_LEN_INT32), src_tmp_slip2);
+        }
+    } else {
+        for (int i = 2 * SSE_LEN_INT32; i < stop_len; i += 2 * SSE_LEN_INT32) {
+            v4si src_tmp = _mm_loadu_si128((__m128i *) (src + i));  // load a,b,c,d
+            v4si src_tmp2 = _mm_loadu_si128((__m128i *) (src + i + SSE_LEN_INT32));
+            v4si src_tmp_slip = _mm_shuffle_epi32(src_tmp, IMM8_FLIP_VEC);  // rotate vec from abcd to bcba
+            v4si src_tmp_slip2 = _mm_shuffle_epi32(src_tmp2, IMM8_FLIP_VEC);
+            _mm_storeu_si128((__m128i *) (dst + len - i - SSE_LEN_INT32), src_tmp_slip);  // store the flipped vector
+            _mm_storeu_si128((__m128i *) (dst + len - i - 2 * SSE_LEN_INT32), src_tmp_slip2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[len - i - 1] = src[i];
+    }
+}
+
+SIMD_UTILS_API void maxevery128s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_INT32);
+    stop_len *= (2 * SSE_LEN_INT32);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
+            v4si src1_tmp = _mm_load_si128((__m128i *) ((const int32_t *) src1 + i));
+            v4si src2_tmp = _mm_load_si128((__m128i *) ((const int32_t *) src2 + i));
+            v4si src1_tmp2 = _mm_load_si128((__m128i *) ((const int32_t *) src1 + i + SSE_LEN_INT32));
+            v4si src2_tmp2 = _mm_load_si128((__m128i *) ((const int32_t *) src2 + i + SSE_LEN_INT32));
+            v4si max1 = _mm_max_epi32(src1_tmp, src2_tmp);
+            v4si max2 = _mm_max_epi32(src1_tmp2, src2_tmp2);
+            _mm_store_si128((__m128i *) (dst + i), max1);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT32), max2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
+            v4si src1_tmp = _mm_loadu_si128((__m128i *) (src1 + i));
+            v4si src2_tmp = _mm_loadu_si128((__m128i *) (src2 + i));
+            v4si src1_tmp2 = _mm_loadu_si128((__m128i *) (src1 + i + SSE_LEN_INT32));
+            v4si src2_tmp2 = _mm_loadu_si128((__m128i *) (src2 + i + SSE_LEN_INT32));
+            v4si max1 = _mm_max_epi32(src1_tmp, src2_tmp);
+            v4si max2 = _mm_max_epi32(src1_tmp2, src2_tmp2);
+            _mm_storeu_si128((__m128i *) (dst + i), max1);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT32), max2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src1[i] > src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void minevery128s(int32_t *src1, int32_t *src2, int32_t *dst, int len)
+{
+    int stop_len = len / (2 * SSE_LEN_INT32);
+    stop_len *= (2 * SSE_LEN_INT32);
+
+    if (areAligned3((uintptr_t) (src1), (uintptr_t) (src2), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
+            v4si src1_tmp = _mm_load_si128((__m128i *) ((const int32_t *) src1 + i));
+            v4si src2_tmp = _mm_load_si128((__m128i *) ((const int32_t *) src2 + i));
+            v4si src1_tmp2 = _mm_load_si128((__m128i *) ((const int32_t *) src1 + i + SSE_LEN_INT32));
+            v4si src2_tmp2 = _mm_load_si128((__m128i *) ((const int32_t *) src2 + i + SSE_LEN_INT32));
+            v4si min1 = _mm_min_epi32(src1_tmp, src2_tmp);
+            v4si min2 = _mm_min_epi32(src1_tmp2, src2_tmp2);
+            _mm_store_si128((__m128i *) (dst + i), min1);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT32), min2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
+            v4si src1_tmp = _mm_loadu_si128((__m128i *) (src1 + i));
+            v4si src2_tmp = _mm_loadu_si128((__m128i *) (src2 + i));
+            v4si src1_tmp2 = _mm_loadu_si128((__m128i *) (src1 + i + SSE_LEN_INT32));
+            v4si src2_tmp2 = _mm_loadu_si128((__m128i *) (src2 + i + SSE_LEN_INT32));
+            v4si min1 = _mm_min_epi32(src1_tmp, src2_tmp);
+            v4si min2 = _mm_min_epi32(src1_tmp2, src2_tmp2);
+            _mm_storeu_si128((__m128i *) (dst + i), min1);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT32), min2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src1[i] < src2[i] ? src1[i] : src2[i];
+    }
+}
+
+SIMD_UTILS_API void minmax128s(int32_t *src, int len, int32_t *min_value, int32_t *max_value)
+{
+    int stop_len = (len - SSE_LEN_INT32) / (2 * SSE_LEN_INT32);
+    stop_len *= (2 * SSE_LEN_INT32);
+    stop_len = (stop_len < 0) ? 0 : stop_len;
+
+    int32_t min_s[SSE_LEN_INT32] __attribute__((aligned(SSE_LEN_BYTES)));
+    int32_t max_s[SSE_LEN_INT32] __attribute__((aligned(SSE_LEN_BYTES)));
+    v4si max_v, min_v, max_v2, min_v2;
+    v4si src_tmp, src_tmp2;
+
+    int32_t min_tmp = src[0];
+    int32_t max_tmp = src[0];
+
+    if (len >= SSE_LEN_INT32) {
+        if (isAligned((uintptr_t) (src), SSE_LEN_BYTES)) {
+            src_tmp = _mm_load_si128((__m128i *) ((const int32_t *) src + 0));
+            max_v = src_tmp;
+            min_v = src_tmp;
+            max_v2 = src_tmp;
+            min_v2 = src_tmp;
+
+            for (int i = SSE_LEN_INT32; i < stop_len; i += 2 * SSE_LEN_INT32) {
+                src_tmp = _mm_load_si128((__m128i *) ((const int32_t *) src + i));
+                src_tmp2 = _mm_load_si128((__m128i *) ((const int32_t *) src + i + SSE_LEN_INT32));
+                max_v = _mm_max_epi32(max_v, src_tmp);
+                min_v = _mm_min_epi32(min_v, src_tmp);
+                max_v2 = _mm_max_epi32(max_v2, src_tmp2);
+                min_v2 = _mm_min_epi32(min_v2, src_tmp2);
+            }
+        } else {
+            src_tmp = _mm_loadu_si128((__m128i *) (src + 0));
+            max_v = src_tmp;
+            min_v = src_tmp;
+            max_v2 = src_tmp;
+            min_v2 = src_tmp;
+
+            for (int i = SSE_LEN_INT32; i < stop_len; i += 2 * SSE_LEN_INT32) {
+                src_tmp = _mm_loadu_si128((__m128i *) ((const int32_t *) src + i));
+                src_tmp2 = _mm_loadu_si128((__m128i *) ((const int32_t *) src + i + SSE_LEN_INT32));
+                max_v = _mm_max_epi32(max_v, src_tmp);
+                min_v = _mm_min_epi32(min_v, src_tmp);
+                max_v2 = _mm_max_epi32(max_v2, src_tmp2);
+                min_v2 = _mm_min_epi32(min_v2, src_tmp2);
+            }
+        }
+
+        max_v = _mm_max_epi32(max_v, max_v2);
+        min_v = _mm_min_epi32(min_v, min_v2);
+
+        _mm_store_si128((__m128i *) (max_s), max_v);
+        _mm_store_si128((__m128i *) (min_s), min_v);
+
+        max_tmp = max_s[0];
+        max_tmp = max_tmp > max_s[1] ? max_tmp : max_s[1];
+        max_tmp = max_tmp > max_s[2] ? max_tmp : max_s[2];
+        max_tmp = max_tmp > max_s[3] ? max_tmp : max_s[3];
+
+        min_tmp = min_s[0];
+        min_tmp = min_tmp < min_s[1] ? min_tmp : min_s[1];
+        min_tmp = min_tmp < min_s[2] ? min_tmp : min_s[2];
+        min_tmp = min_tmp < min_s[3] ? min_tmp : min_s[3];
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        max_tmp = max_tmp > src[i] ? max_tmp : src[i];
+        min_tmp = min_tmp < src[i] ? min_tmp : src[i];
+    }
+
+    *max_value = max_tmp;
+    *min_value = min_tmp;
+}
+
+SIMD_UTILS_API void threshold128_gt_s(int32_t *src, int32_t *dst, int len, int32_t value)
+{
+    const v4si tmp = _mm_set1_epi32(value);
+
+    int stop_len = len / (2 * SSE_LEN_INT32);
+    stop_len *= (2 * SSE_LEN_INT32);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
+            v4si src_tmp = _mm_load_si128((__m128i *) (src + i));
+            v4si src_tmp2 = _mm_load_si128((__m128i *) (src + i + SSE_LEN_INT32));
+            v4si dst_tmp = _mm_min_epi32(src_tmp, tmp);
+            v4si dst_tmp2 = _mm_min_epi32(src_tmp2, tmp);
+            _mm_store_si128((__m128i *) (dst + i), dst_tmp);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT32), dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
+            v4si src_tmp = _mm_loadu_si128((__m128i *) (src + i));
+            v4si src_tmp2 = _mm_loadu_si128((__m128i *) (src + i + SSE_LEN_INT32));
+            v4si dst_tmp = _mm_min_epi32(src_tmp, tmp);
+            v4si dst_tmp2 = _mm_min_epi32(src_tmp2, tmp);
+            _mm_storeu_si128((__m128i *) (dst + i), dst_tmp);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT32), dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src[i] < value ? src[i] : value;
+    }
+}
+
+
+SIMD_UTILS_API void threshold128_gtabs_s(int32_t *src, int32_t *dst, int len, int32_t value)
+{
+    const v4si pval = _mm_set1_epi32(value);
+    const v4si mval = _mm_set1_epi32(-value);
+
+    int stop_len = len / (2 * SSE_LEN_INT32);
+    stop_len *= (2 * SSE_LEN_INT32);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
+            v4si src_tmp = _mm_load_si128((__m128i *) (src + i));
+            v4si src_tmp2 = _mm_load_si128((__m128i *) (src + i + SSE_LEN_INT32));
+            v4si src_abs = _mm_abs_epi32(src_tmp);
+            v4si src_abs2 = _mm_abs_epi32(src_tmp2);
+            v4si eqmask = _mm_cmpeq_epi32(src_abs, src_tmp);  // if A = abs(A), then A is >= 0 (mask 0xFFFFFFFF)
+            v4si eqmask2 = _mm_cmpeq_epi32(src_abs2, src_tmp2);
+            v4si min = _mm_min_epi32(src_tmp, pval);
+            v4si min2 = _mm_min_epi32(src_tmp2, pval);
+            v4si max = _mm_max_epi32(src_tmp, mval);
+            v4si max2 = _mm_max_epi32(src_tmp2, mval);
+            v4si dst_tmp = _mm_blendv_epi8(max, min, eqmask);
+            v4si dst_tmp2 = _mm_blendv_epi8(max2, min2, eqmask2);
+            _mm_store_si128((__m128i *) (dst + i), dst_tmp);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT32), dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
+            v4si src_tmp = _mm_loadu_si128((__m128i *) (src + i));
+            v4si src_tmp2 = _mm_loadu_si128((__m128i *) (src + i + SSE_LEN_INT32));
+            v4si src_abs = _mm_abs_epi32(src_tmp);
+            v4si src_abs2 = _mm_abs_epi32(src_tmp2);
+            v4si eqmask = _mm_cmpeq_epi32(src_abs, src_tmp);  // if A = abs(A), then A is >= 0 (mask 0xFFFFFFFF)
+            v4si eqmask2 = _mm_cmpeq_epi32(src_abs2, src_tmp2);
+            v4si min = _mm_min_epi32(src_tmp, pval);
+            v4si min2 = _mm_min_epi32(src_tmp2, pval);
+            v4si max = _mm_max_epi32(src_tmp, mval);
+            v4si max2 = _mm_max_epi32(src_tmp2, mval);
+            v4si dst_tmp = _mm_blendv_epi8(max, min, eqmask);
+            v4si dst_tmp2 = _mm_blendv_epi8(max2, min2, eqmask2);
+            _mm_storeu_si128((__m128i *) (dst + i), dst_tmp);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT32), dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        if (src[i] >= 0) {
+            dst[i] = src[i] > value ? value : src[i];
+        } else {
+            dst[i] = src[i] < (-value) ? (-value) : src[i];
+        }
+    }
+}
+
+SIMD_UTILS_API void threshold128_lt_s(int32_t *src, int32_t *dst, int len, int32_t value)
+{
+    const v4si tmp = _mm_set1_epi32(value);
+
+    int stop_len = len / (2 * SSE_LEN_INT32);
+    stop_len *= (2 * SSE_LEN_INT32);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
+            v4si src_tmp = _mm_load_si128((__m128i *) (src + i));
+            v4si src_tmp2 = _mm_load_si128((__m128i *) (src + i + SSE_LEN_INT32));
+            v4si dst_tmp = _mm_max_epi32(src_tmp, tmp);
+            v4si dst_tmp2 = _mm_max_epi32(src_tmp2, tmp);
+            _mm_store_si128((__m128i *) (dst + i), dst_tmp);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT32), dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
+            v4si src_tmp = _mm_loadu_si128((__m128i *) (src + i));
+            v4si src_tmp2 = _mm_loadu_si128((__m128i *) (src + i + SSE_LEN_INT32));
+            v4si dst_tmp = _mm_max_epi32(src_tmp, tmp);
+            v4si dst_tmp2 = _mm_max_epi32(src_tmp2, tmp);
+            _mm_storeu_si128((__m128i *) (dst + i), dst_tmp);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT32), dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src[i] > value ? src[i] : value;
+    }
+}
+
+SIMD_UTILS_API void threshold128_ltabs_s(int32_t *src, int32_t *dst, int len, int32_t value)
+{
+    const v4si pval = _mm_set1_epi32(value);
+    const v4si mval = _mm_set1_epi32(-value);
+
+    int stop_len = len / (2 * SSE_LEN_INT32);
+    stop_len *= (2 * SSE_LEN_INT32);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
+            v4si src_tmp = _mm_load_si128((__m128i *) (src + i));
+            v4si src_tmp2 = _mm_load_si128((__m128i *) (src + i + SSE_LEN_INT32));
+            v4si src_abs = _mm_abs_epi32(src_tmp);
+            v4si src_abs2 = _mm_abs_epi32(src_tmp2);
+            v4si eqmask = _mm_cmpeq_epi32(src_abs, src_tmp);  // if A = abs(A), then A is >= 0 (mask 0xFFFFFFFF)
+            v4si eqmask2 = _mm_cmpeq_epi32(src_abs2, src_tmp2);
+            v4si max = _mm_max_epi32(src_tmp, pval);
+            v4si max2 = _mm_max_epi32(src_tmp2, pval);
+            v4si min = _mm_min_epi32(src_tmp, mval);
+            v4si min2 = _mm_min_epi32(src_tmp2, mval);
+            v4si dst_tmp = _mm_blendv_epi8(min, max, eqmask);
+            v4si dst_tmp2 = _mm_blendv_epi8(min2, max2, eqmask2);
+            _mm_store_si128((__m128i *) (dst + i), dst_tmp);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_INT32), dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
+            v4si src_tmp = _mm_loadu_si128((__m128i *) (src + i));
+            v4si src_tmp2 = _mm_loadu_si128((__m128i *) (src + i + SSE_LEN_INT32));
+            v4si src_abs = _mm_abs_epi32(src_tmp);
+            v4si src_abs2 = _mm_abs_epi32(src_tmp2);
+            v4si eqmask = _mm_cmpeq_epi32(src_abs, src_tmp);  // if A = abs(A), then A is >= 0 (mask 0xFFFFFFFF)
+            v4si eqmask2 = _mm_cmpeq_epi32(src_abs2, src_tmp2);
+            v4si max = _mm_max_epi32(src_tmp, pval);
+            v4si max2 = _mm_max_epi32(src_tmp2, pval);
+            v4si min = _mm_min_epi32(src_tmp, mval);
+            v4si min2 = _mm_min_epi32(src_tmp2, mval);
+            v4si dst_tmp = _mm_blendv_epi8(min, max, eqmask);
+            v4si dst_tmp2 = _mm_blendv_epi8(min2, max2, eqmask2);
+            _mm_storeu_si128((__m128i *) (dst + i), dst_tmp);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT32), dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        if (src[i] >= 0) {
+            dst[i] = src[i] < value ? value : src[i];
+        } else {
+            dst[i] = src[i] > (-value) ? (-value) : src[i];
+        }
+    }
+}
+
+SIMD_UTILS_API void threshold128_ltval_gtval_s(int32_t *src, int32_t *dst, int len, int32_t ltlevel, int32_t ltvalue, int32_t gtlevel, int32_t gtvalue)
+{
+    const v4si ltlevel_v = _mm_set1_epi32(ltlevel);
+    const v4si ltvalue_v = _mm_set1_epi32(ltvalue);
+    const v4si gtlevel_v = _mm_set1_epi32(gtlevel);
+    const v4si gtvalue_v = _mm_set1_epi32(gtvalue);
+
+    int stop_len = len / (2 * SSE_LEN_FLOAT);
+    stop_len *= (2 * SSE_LEN_FLOAT);
+
+    if (areAligned2((uintptr_t) (src), (uintptr_t) (dst), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
+            v4si src_tmp = _mm_load_si128((__m128i *) (src + i));
+            v4si src_tmp2 = _mm_load_si128((__m128i *) (src + i + SSE_LEN_FLOAT));
+            v4si lt_mask = _mm_cmplt_epi32(src_tmp, ltlevel_v);
+            v4si gt_mask = _mm_cmpgt_epi32(src_tmp, gtlevel_v);
+            v4si dst_tmp = _mm_blendv_epi8(src_tmp, ltvalue_v, lt_mask);
+            dst_tmp = _mm_blendv_epi8(dst_tmp, gtvalue_v, gt_mask);
+            _mm_store_si128((__m128i *) (dst + i), dst_tmp);
+            v4si lt_mask2 = _mm_cmplt_epi32(src_tmp2, ltlevel_v);
+            v4si gt_mask2 = _mm_cmpgt_epi32(src_tmp2, gtlevel_v);
+            v4si dst_tmp2 = _mm_blendv_epi8(src_tmp2, ltvalue_v, lt_mask2);
+            dst_tmp2 = _mm_blendv_epi8(dst_tmp2, gtvalue_v, gt_mask2);
+            _mm_store_si128((__m128i *) (dst + i + SSE_LEN_FLOAT), dst_tmp2);
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += 2 * SSE_LEN_FLOAT) {
+            v4si src_tmp = _mm_loadu_si128((__m128i *) (src + i));
+            v4si src_tmp2 = _mm_loadu_si128((__m128i *) (src + i + SSE_LEN_FLOAT));
+            v4si lt_mask = _mm_cmplt_epi32(src_tmp, ltlevel_v);
+            v4si gt_mask = _mm_cmpgt_epi32(src_tmp, gtlevel_v);
+            v4si dst_tmp = _mm_blendv_epi8(src_tmp, ltvalue_v, lt_mask);
+            dst_tmp = _mm_blendv_epi8(dst_tmp, gtvalue_v, gt_mask);
+            _mm_storeu_si128((__m128i *) (dst + i), dst_tmp);
+            v4si lt_mask2 = _mm_cmplt_epi32(src_tmp2, ltlevel_v);
+            v4si gt_mask2 = _mm_cmpgt_epi32(src_tmp2, gtlevel_v);
+            v4si dst_tmp2 = _mm_blendv_epi8(src_tmp2, ltvalue_v, lt_mask2);
+            dst_tmp2 = _mm_blendv_epi8(dst_tmp2, gtvalue_v, gt_mask2);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_FLOAT), dst_tmp2);
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        dst[i] = src[i] < ltlevel ? ltvalue : src[i];
+        dst[i] = src[i] > gtlevel ? gtvalue : dst[i];
+    }
+}
+
+// first index of value in src, len if it is not found
+static inline int firsteq128s(int32_t *src, int len, int32_t value)
+{
+    int stop_len = len / (2 * SSE_LEN_INT32);
+    stop_len *= (2 * SSE_LEN_INT32);
+
+    v4si value_v = _mm_set1_epi32(value);
+    for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
+        uint32_t mask = (uint32_t) _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_loadu_si128((__m128i *) (src + i)), value_v)));
+        mask |= (uint32_t) _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_loadu_si128((__m128i *) (src + i + SSE_LEN_INT32)), value_v))) << 4;
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+    for (int i = stop_len; i < len; i++) {
+        if (src[i] == value)
+            return i;
+    }
+    return len;
+}
+
+SIMD_UTILS_API void maxloc128s(int32_t *src, int32_t *max, int *idx, int len)
+{
+    minmaxloc_runs(src, len, minmax128s, firsteq128s, NULL, NULL, max, idx);
+}
+
+SIMD_UTILS_API void minloc128s(int32_t *src, int32_t *min, int *idx, int len)
+{
+    minmaxloc_runs(src, len, minmax128s, firsteq128s, min, idx, NULL, NULL);
+}
+
+SIMD_UTILS_API void minmaxloc128s(int32_t *src, int len, int32_t *min_value, int *min_idx, int32_t *max_value, int *max_idx)
+{
+    minmaxloc_runs(src, len, minmax128s, firsteq128s, min_value, min_idx, max_value, max_idx);
+}
+
+SIMD_UTILS_API void minmax16s_128s(int16_t *src, int len, int16_t *min_value, int16_t *max_value)
+{
+    int stop_len = (len - SSE_LEN_INT16) / (2 * SSE_LEN_INT16);
+    stop_len *= (2 * SSE_LEN_INT16);
+    stop_len = (stop_len < 0) ? 0 : stop_len;
+
+    int16_t min_s[SSE_LEN_INT16] __attribute__((aligned(SSE_LEN_BYTES)));
+    int16_t max_s[SSE_LEN_INT16] __attribute__((aligned(SSE_LEN_BYTES)));
+    __m128i max_v, min_v, max_v2, min_v2;
+    __m128i src_tmp, src_tmp2;
+
+    int16_t min_tmp = src[0];
+    int16_t max_tmp = src[0];
+
+    if (len >= SSE_LEN_INT16) {
+        if (isAligned((uintptr_t) (src), SSE_LEN_BYTES)) {
+            src_tmp = _mm_load_si128((__m128i *) (src + 0));
+            max_v = src_tmp;
+            min_v = src_tmp;
+            max_v2 = src_tmp;
+            min_v2 = src_tmp;
+
+            for (int i = SSE_LEN_INT16; i < stop_len; i += 2 * SSE_LEN_INT16) {
+                src_tmp = _mm_load_si128((__m128i *) (src + i));
+                src_tmp2 = _mm_load_si128((__m128i *) (src + i + SSE_LEN_INT16));
+                max_v = _mm_max_epi16(max_v, src_tmp);
+                min_v = _mm_min_epi16(min_v, src_tmp);
+                max_v2 = _mm_max_epi16(max_v2, src_tmp2);
+                min_v2 = _mm_min_epi16(min_v2, src_tmp2);
+            }
+        } else {
+            src_tmp = _mm_loadu_si128((__m128i *) (src + 0));
+            max_v = src_tmp;
+            min_v = src_tmp;
+            max_v2 = src_tmp;
+            min_v2 = src_tmp;
+
+            for (int i = SSE_LEN_INT16; i < stop_len; i += 2 * SSE_LEN_INT16) {
+                src_tmp = _mm_loadu_si128((__m128i *) (src + i));
+                src_tmp2 = _mm_loadu_si128((__m128i *) (src + i + SSE_LEN_INT16));
+                max_v = _mm_max_epi16(max_v, src_tmp);
+                min_v = _mm_min_epi16(min_v, src_tmp);
+                max_v2 = _mm_max_epi16(max_v2, src_tmp2);
+                min_v2 = _mm_min_epi16(min_v2, src_tmp2);
+            }
+        }
+
+        max_v = _mm_max_epi16(max_v, max_v2);
+        min_v = _mm_min_epi16(min_v, min_v2);
+
+        _mm_store_si128((__m128i *) (max_s), max_v);
+        _mm_store_si128((__m128i *) (min_s), min_v);
+
+        max_tmp = max_s[0];
+        min_tmp = min_s[0];
+        for (int i = 1; i < SSE_LEN_INT16; i++) {
+            max_tmp = max_tmp > max_s[i] ? max_tmp : max_s[i];
+            min_tmp = min_tmp < min_s[i] ? min_tmp : min_s[i];
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        max_tmp = max_tmp > src[i] ? max_tmp : src[i];
+        min_tmp = min_tmp < src[i] ? min_tmp : src[i];
+    }
+
+    *max_value = max_tmp;
+    *min_value = min_tmp;
+}
+
+// first index of value in src, len if it is not found
+static inline int firsteq16s_128s(int16_t *src, int len, int16_t value)
+{
+    int stop_len = len / (2 * SSE_LEN_INT16);
+    stop_len *= (2 * SSE_LEN_INT16);
+
+    __m128i value_v = _mm_set1_epi16(value);
+    for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT16) {
+        uint32_t mask = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_loadu_si128((__m128i *) (src + i)), value_v));
+        mask |= (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_loadu_si128((__m128i *) (src + i + SSE_LEN_INT16)), value_v)) << 16;
+        if (mask)
+            return i + (__builtin_ctz(mask) >> 1);
+    }
+    for (int i = stop_len; i < len; i++) {
+        if (src[i] == value)
+            return i;
+    }
+    return len;
+}
+
+SIMD_UTILS_API void maxloc16s_128s(int16_t *src, int16_t *max, int *idx, int len)
+{
+    minmaxloc_run16s(src, len, minmax16s_128s, firsteq16s_128s, NULL, NULL, max, idx);
+}
+
+SIMD_UTILS_API void minloc16s_128s(int16_t *src, int16_t *min, int *idx, int len)
+{
+    minmaxloc_run16s(src, len, minmax16s_128s, firsteq16s_128s, min, idx, NULL, NULL);
+}
+
+SIMD_UTILS_API void minmaxloc16s_128s(int16_t *src, int len, int16_t *min_value, int *min_idx, int16_t *max_value, int *max_idx)
+{
+    minmaxloc_run16s(src, len, minmax16s_128s, firsteq16s_128s, min_value, min_idx, max_value, max_idx);
+}
+
+// bins of histogram128s and histogram16s_128s, nb_bins outside of the bins (see simd_utils_hist.h)
+static inline v4si hist_bin128s(v4si x, v4si low_vec, __m128i shift, v4si last_vec, v4si out_vec)
+{
+    v4si bin = _mm_sra_epi32(_mm_sub_epi32(x, low_vec), shift);  // negative below low
+    v4si in = _mm_cmpeq_epi32(_mm_min_epu32(bin, last_vec), bin);          // 0 <= bin <= nb_bins - 1
+    return _mm_blendv_epi8(out_vec, bin, in);
+}
+
+static inline void bins128s(int32_t *src, int len, int32_t low, int shift, int nb_bins, int32_t *bins)
+{
+    int stop_len = len / SSE_LEN_INT32;
+    stop_len *= SSE_LEN_INT32;
+
+    v4si low_vec = _mm_set1_epi32(low);
+    __m128i shift_vec = _mm_cvtsi32_si128(shift);
+    v4si last_vec = _mm_set1_epi32(nb_bins - 1);
+    v4si out_vec = _mm_set1_epi32(nb_bins);
+
+    if (isAligned((uintptr_t) (src), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += SSE_LEN_INT32) {
+            v4si x = _mm_load_si128((v4si *) (src + i));
+            _mm_store_si128((v4si *) (bins + i), hist_bin128s(x, low_vec, shift_vec, last_vec, out_vec));
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += SSE_LEN_INT32) {
+            v4si x = _mm_loadu_si128((v4si *) (src + i));
+            _mm_store_si128((v4si *) (bins + i), hist_bin128s(x, low_vec, shift_vec, last_vec, out_vec));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        bins[i] = hist_bini(src[i], low, shift, nb_bins);
+    }
+}
+
+SIMD_UTILS_API void histogram128s(int32_t *src, int len, int32_t low, int shift, int nb_bins, uint32_t *hist)
+{
+    hist_state_t st;
+
+    hist_begin(&st, hist, nb_bins);
+    for (int start = 0; start < len; start += HIST_BLOCK_LEN) {
+        int block_len = hist_block_len(len, start);
+        bins128s(src + start, block_len, low, shift, nb_bins, st.bins);
+        hist_count(&st, block_len);
+    }
+    hist_end(&st);
+}
+
+static inline void bins16s_128s(int16_t *src, int len, int32_t low, int shift, int nb_bins, int32_t *bins)
+{
+    int stop_len = len / SSE_LEN_INT16;
+    stop_len *= SSE_LEN_INT16;
+
+    v4si low_vec = _mm_set1_epi32(low);
+    __m128i shift_vec = _mm_cvtsi32_si128(shift);
+    v4si last_vec = _mm_set1_epi32(nb_bins - 1);
+    v4si out_vec = _mm_set1_epi32(nb_bins);
+
+    if (isAligned((uintptr_t) (src), SSE_LEN_BYTES)) {
+        for (int i = 0; i < stop_len; i += SSE_LEN_INT16) {
+            v4si x = _mm_load_si128((v4si *) (src + i));
+            _mm_store_si128((v4si *) (bins + i), hist_bin128s(_mm_cvtepi16_epi32(x), low_vec, shift_vec, last_vec, out_vec));
+            _mm_store_si128((v4si *) (bins + i + SSE_LEN_INT32), hist_bin128s(_mm_cvtepi16_epi32(_mm_srli_si128(x, 8)), low_vec, shift_vec, last_vec, out_vec));
+        }
+    } else {
+        for (int i = 0; i < stop_len; i += SSE_LEN_INT16) {
+            v4si x = _mm_loadu_si128((v4si *) (src + i));
+            _mm_store_si128((v4si *) (bins + i), hist_bin128s(_mm_cvtepi16_epi32(x), low_vec, shift_vec, last_vec, out_vec));
+            _mm_store_si128((v4si *) (bins + i + SSE_LEN_INT32), hist_bin128s(_mm_cvtepi16_epi32(_mm_srli_si128(x, 8)), low_vec, shift_vec, last_vec, out_vec));
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        bins[i] = hist_bini((int32_t) src[i], low, shift, nb_bins);
+    }
+}
+
+SIMD_UTILS_API void histogram16s_128s(int16_t *src, int len, int16_t low, int shift, int nb_bins, uint32_t *hist)
+{
+    hist_state_t st;
+
+    hist_begin(&st, hist, nb_bins);
+    for (int start = 0; start < len; start += HIST_BLOCK_LEN) {
+        int block_len = hist_block_len(len, start);
+        bins16s_128s(src + start, block_len, (int32_t) low, shift, nb_bins, st.bins);
+        hist_count(&st, block_len);
+    }
+    hist_end(&st);
+}
+
+// the values are the bins, only the sub-histograms are needed
+SIMD_UTILS_API void histogramu8_128(uint8_t *src, int len, uint32_t *hist)
+{
+    hist_count_u8(src, len, hist);
+}
+
+// inclusive prefix sum of the lanes of x
+static inline v4si prefix_lanes128s(v4si x)
+{
+    x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+    x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+    return x;
+}
+
+// last lane of x in all the lanes
+static inline v4si last_lane128s(v4si x)
+{
+    return _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+// lanes of x moved up by one, the first lane getting the last lane of prev
+static inline v4si shift_lane128s(v4si x, v4si prev)
+{
+    return _mm_alignr_epi8(x, prev, 12);
+}
+
+// prefix sums of src (see simd_utils.h), exclusive when exclusive is set
+static inline void prefixsum128s_run(int32_t *src, int32_t *dst, int len, int32_t *carry, int exclusive)
+{
+    int stop_len = len / (2 * SSE_LEN_INT32);
+    stop_len *= (2 * SSE_LEN_INT32);
+
+    v4si carry_vec = _mm_set1_epi32(carry ? *carry : 0);
+
+    // the carry only waits for one add per pair of vectors
+    for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
+        v4si a = prefix_lanes128s(_mm_loadu_si128((v4si *) (src + i)));
+        v4si b = prefix_lanes128s(_mm_loadu_si128((v4si *) (src + i + SSE_LEN_INT32)));
+        b = _mm_add_epi32(b, last_lane128s(a));
+        v4si last = last_lane128s(b);
+        a = _mm_add_epi32(a, carry_vec);
+        b = _mm_add_epi32(b, carry_vec);
+        if (exclusive) {
+            _mm_storeu_si128((v4si *) (dst + i), shift_lane128s(a, carry_vec));
+            _mm_storeu_si128((v4si *) (dst + i + SSE_LEN_INT32), shift_lane128s(b, a));
+        } else {
+            _mm_storeu_si128((v4si *) (dst + i), a);
+            _mm_storeu_si128((v4si *) (dst + i + SSE_LEN_INT32), b);
+        }
+        carry_vec = _mm_add_epi32(carry_vec, last);
+    }
+
+    int32_t carry_tmp = _mm_cvtsi128_si32(carry_vec);
+    for (int i = stop_len; i < len; i++) {
+        int32_t x = src[i];
+        if (exclusive) {
+            dst[i] = carry_tmp;
+            carry_tmp = (int32_t) ((uint32_t) carry_tmp + (uint32_t) x);
+        } else {
+            carry_tmp = (int32_t) ((uint32_t) carry_tmp + (uint32_t) x);
+            dst[i] = carry_tmp;
+        }
+    }
+
+    if (carry)
+        *carry = carry_tmp;
+}
+
+SIMD_UTILS_API void prefixsum128s(int32_t *src, int32_t *dst, int len, int32_t *carry)
+{
+    prefixsum128s_run(src, dst, len, carry, 0);
+}
+
+SIMD_UTILS_API void prefixsum128s_excl(int32_t *src, int32_t *dst, int len, int32_t *carry)
+{
+    prefixsum128s_run(src, dst, len, carry, 1);
+}
+
+SIMD_UTILS_API void diff128s(int32_t *src, int32_t *dst, int len, int32_t *prev)
+{
+    int stop_len = len / (2 * SSE_LEN_INT32);
+    stop_len *= (2 * SSE_LEN_INT32);
+
+    int32_t prev_tmp = prev ? *prev : 0;
+    int32_t last = (len > 0) ? src[len - 1] : prev_tmp;  // before src is overwritten by dst
+    v4si prev_vec = _mm_set1_epi32(prev_tmp);
+
+    for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
+        v4si a = _mm_loadu_si128((v4si *) (src + i));
+        v4si b = _mm_loadu_si128((v4si *) (src + i + SSE_LEN_INT32));
+        _mm_storeu_si128((v4si *) (dst + i), _mm_sub_epi32(a, shift_lane128s(a, prev_vec)));
+        _mm_storeu_si128((v4si *) (dst + i + SSE_LEN_INT32), _mm_sub_epi32(b, shift_lane128s(b, a)));
+        prev_vec = b;
+    }
+
+    if (stop_len > 0)
+        prev_tmp = _mm_cvtsi128_si32(last_lane128s(prev_vec));
+    for (int i = stop_len; i < len; i++) {
+        int32_t x = src[i];
+        dst[i] = (int32_t) ((uint32_t) x - (uint32_t) prev_tmp);
+        prev_tmp = x;
+    }
+
+    if (prev)
+        *prev = last;
+}
+
+// inclusive prefix sum of the lanes of x
+static inline __m128i prefix_lanes16s_128s(__m128i x)
+{
+    x = _mm_add_epi16(x, _mm_slli_si128(x, 2));
+    x = _mm_add_epi16(x, _mm_slli_si128(x, 4));
+    x = _mm_add_epi16(x, _mm_slli_si128(x, 8));
+    return x;
+}
+
+// last lane of x in all the lanes
+static inline __m128i last_lane16s_128s(__m128i x)
+{
+    __m128i tmp = _mm_shufflehi_epi16(x, _MM_SHUFFLE(3, 3, 3, 3));
+    return _mm_unpackhi_epi64(tmp, tmp);
+}
+
+// lanes of x moved up by one, the first lane getting the last lane of prev
+static inline __m128i shift_lane16s_128s(__m128i x, __m128i prev)
+{
+    return _mm_alignr_epi8(x, prev, 14);
+}
+
+// prefix sums of src (see simd_utils.h), exclusive when exclusive is set
+static inline void prefixsum16s_128s_run(int16_t *src, int16_t *dst, int len, int16_t *carry, int exclusive)
+{
+    int stop_len = len / (2 * SSE_LEN_INT16);
+    stop_len *= (2 * SSE_LEN_INT16);
+
+    __m128i carry_vec = _mm_set1_epi16(carry ? *carry : 0);
+
+    // the carry only waits for one add per pair of vectors
+    for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT16) {
+        __m128i a = prefix_lanes16s_128s(_mm_loadu_si128((__m128i *) (src + i)));
+        __m128i b = prefix_lanes16s_128s(_mm_loadu_si128((__m128i *) (src + i + SSE_LEN_INT16)));
+        b = _mm_add_epi16(b, last_lane16s_128s(a));
+        __m128i last = last_lane16s_128s(b);
+        a = _mm_add_epi16(a, carry_vec);
+        b = _mm_add_epi16(b, carry_vec);
+        if (exclusive) {
+            _mm_storeu_si128((__m128i *) (dst + i), shift_lane16s_128s(a, carry_vec));
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT16), shift_lane16s_128s(b, a));
+        } else {
+            _mm_storeu_si128((__m128i *) (dst + i), a);
+            _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT16), b);
+        }
+        carry_vec = _mm_add_epi16(carry_vec, last);
+    }
+
+    int16_t carry_tmp = (int16_t) _mm_cvtsi128_si32(carry_vec);
+    for (int i = stop_len; i < len; i++) {
+        int16_t x = src[i];
+        if (exclusive) {
+            dst[i] = carry_tmp;
+            carry_tmp = (int16_t) (carry_tmp + x);
+        } else {
+            carry_tmp = (int16_t) (carry_tmp + x);
+            dst[i] = carry_tmp;
+        }
+    }
+
+    if (carry)
+        *carry = carry_tmp;
+}
+
+SIMD_UTILS_API void prefixsum16s_128s(int16_t *src, int16_t *dst, int len, int16_t *carry)
+{
+    prefixsum16s_128s_run(src, dst, len, carry, 0);
+}
+
+SIMD_UTILS_API void prefixsum16s_128s_excl(int16_t *src, int16_t *dst, int len, int16_t *carry)
+{
+    prefixsum16s_128s_run(src, dst, len, carry, 1);
+}
+
+SIMD_UTILS_API void diff16s_128s(int16_t *src, int16_t *dst, int len, int16_t *prev)
+{
+    int stop_len = len / (2 * SSE_LEN_INT16);
+    stop_len *= (2 * SSE_LEN_INT16);
+
+    int16_t prev_tmp = prev ? *prev : 0;
+    int16_t last = (len > 0) ? src[len - 1] : prev_tmp;  // before src is overwritten by dst
+    __m128i prev_vec = _mm_set1_epi16(prev_tmp);
+
+    for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT16) {
+        __m128i a = _mm_loadu_si128((__m128i *) (src + i));
+        __m128i b = _mm_loadu_si128((__m128i *) (src + i + SSE_LEN_INT16));
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_sub_epi16(a, shift_lane16s_128s(a, prev_vec)));
+        _mm_storeu_si128((__m128i *) (dst + i + SSE_LEN_INT16), _mm_sub_epi16(b, shift_lane16s_128s(b, a)));
+        prev_vec = b;
+    }
+
+    if (stop_len > 0)
+        prev_tmp = (int16_t) _mm_cvtsi128_si32(last_lane16s_128s(prev_vec));
+    for (int i = stop_len; i < len; i++) {
+        int16_t x = src[i];
+        dst[i] = (int16_t) (x - prev_tmp);
+        prev_tmp = x;
+    }
+
+    if (prev)
+        *prev = last;
+}
+
+// bitonic sort of the lanes of x
+static inline v4si sort_lanes128s(v4si x)
+{
+    v4si p;
+    p = _mm_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm_blend_epi16(_mm_min_epi32(x, p), _mm_max_epi32(x, p), 0x3C);
+    p = _mm_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm_blend_epi16(_mm_min_epi32(x, p), _mm_max_epi32(x, p), 0xF0);
+    p = _mm_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm_blend_epi16(_mm_min_epi32(x, p), _mm_max_epi32(x, p), 0xCC);
+    return x;
+}
+
+// sorts the lanes of x, which are a bitonic sequence
+static inline v4si sort_clean128s(v4si x)
+{
+    v4si p;
+    p = _mm_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm_blend_epi16(_mm_min_epi32(x, p), _mm_max_epi32(x, p), 0xF0);
+    p = _mm_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm_blend_epi16(_mm_min_epi32(x, p), _mm_max_epi32(x, p), 0xCC);
+    return x;
+}
+
+// merges the sorted vectors a and b, a getting the lowest half
+static inline void sort_merge2128s(v4si *a, v4si *b)
+{
+    v4si rev = _mm_shuffle_epi32(*b, _MM_SHUFFLE(0, 1, 2, 3));
+    v4si low = _mm_min_epi32(*a, rev);
+    v4si high = _mm_max_epi32(*a, rev);
+    *a = sort_clean128s(low);
+    *b = sort_clean128s(high);
+}
+
+// merges the sorted sequences (a, b) and (c, d)
+static inline void sort_merge4128s(v4si *a, v4si *b, v4si *c, v4si *d)
+{
+    v4si rev_c = _mm_shuffle_epi32(*d, _MM_SHUFFLE(0, 1, 2, 3));
+    v4si rev_d = _mm_shuffle_epi32(*c, _MM_SHUFFLE(0, 1, 2, 3));
+    v4si low0 = _mm_min_epi32(*a, rev_c);
+    v4si high0 = _mm_max_epi32(*a, rev_c);
+    v4si low1 = _mm_min_epi32(*b, rev_d);
+    v4si high1 = _mm_max_epi32(*b, rev_d);
+    *a = sort_clean128s(_mm_min_epi32(low0, low1));
+    *b = sort_clean128s(_mm_max_epi32(low0, low1));
+    *c = sort_clean128s(_mm_min_epi32(high0, high1));
+    *d = sort_clean128s(_mm_max_epi32(high0, high1));
+}
+
+// sorts up to 4 vectors, padded with the largest value
+static inline void sort_small128s(int32_t *src, int len)
+{
+    int32_t tmp[4 * SSE_LEN_INT32] __attribute__((aligned(SSE_LEN_BYTES)));
+
+    memcpy(tmp, src, len * sizeof(int32_t));
+    for (int i = len; i < 4 * SSE_LEN_INT32; i++) {
+        tmp[i] = INT32_MAX;
+    }
+
+    v4si a = sort_lanes128s(_mm_loadu_si128((v4si *) (tmp)));
+    if (len <= SSE_LEN_INT32) {
+        _mm_storeu_si128((v4si *) (tmp), a);
+    } else if (len <= 2 * SSE_LEN_INT32) {
+        v4si b = sort_lanes128s(_mm_loadu_si128((v4si *) (tmp + SSE_LEN_INT32)));
+        sort_merge2128s(&a, &b);
+        _mm_storeu_si128((v4si *) (tmp), a);
+        _mm_storeu_si128((v4si *) (tmp + SSE_LEN_INT32), b);
+    } else {
+        v4si b = sort_lanes128s(_mm_loadu_si128((v4si *) (tmp + SSE_LEN_INT32)));
+        v4si c = sort_lanes128s(_mm_loadu_si128((v4si *) (tmp + 2 * SSE_LEN_INT32)));
+        v4si d = sort_lanes128s(_mm_loadu_si128((v4si *) (tmp + 3 * SSE_LEN_INT32)));
+        sort_merge2128s(&a, &b);
+        sort_merge2128s(&c, &d);
+        sort_merge4128s(&a, &b, &c, &d);
+        _mm_storeu_si128((v4si *) (tmp), a);
+        _mm_storeu_si128((v4si *) (tmp + SSE_LEN_INT32), b);
+        _mm_storeu_si128((v4si *) (tmp + 2 * SSE_LEN_INT32), c);
+        _mm_storeu_si128((v4si *) (tmp + 3 * SSE_LEN_INT32), d);
+    }
+
+    memcpy(src, tmp, len * sizeof(int32_t));
+}
+
+// packs the lanes of x lower than the pivot to [*left_w, ...) and the others to [..., *right_w)
+static inline void partition_store128s(int32_t *src, v4si x, v4si pivot_vec, int *left_w, int *right_w)
+{
+    int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(x, pivot_vec)));
+    int nb_low = __builtin_popcount(mask);
+    v4si shuf = _mm_load_si128((v4si *) sort_shuffle4_lut[mask]);
+    v4si packed = _mm_shuffle_epi8(x, shuf);
+
+    // the full vector is stored on both ends (free space of a vector at least on each end)
+    _mm_storeu_si128((v4si *) (src + *left_w), packed);
+    _mm_storeu_si128((v4si *) (src + *right_w - SSE_LEN_INT32), packed);
+    *left_w += nb_low;
+    *right_w -= SSE_LEN_INT32 - nb_low;
+}
+
+// number of elements lower than pivot, moved to the beginning of src (len >= 2 * SSE_LEN_INT32)
+static inline int partition128s(int32_t *src, int len, int32_t pivot)
+{
+    v4si pivot_vec = _mm_set1_epi32(pivot);
+    v4si first = _mm_loadu_si128((v4si *) (src));
+    v4si last = _mm_loadu_si128((v4si *) (src + len - SSE_LEN_INT32));
+    int left = SSE_LEN_INT32, right = len - 2 * SSE_LEN_INT32;  // next vectors read from each end
+    int left_w = 0, right_w = len;             // free space [left_w, left) and [right + SSE_LEN_INT32, right_w)
+
+    while (left <= right) {
+        v4si x;
+        if ((left - left_w) <= (right_w - right - SSE_LEN_INT32)) {
+            x = _mm_loadu_si128((v4si *) (src + left));
+            left += SSE_LEN_INT32;
+        } else {
+            x = _mm_loadu_si128((v4si *) (src + right));
+            right -= SSE_LEN_INT32;
+        }
+        partition_store128s(src, x, pivot_vec, &left_w, &right_w);
+    }
+
+    // the last elements (less than a vector) with the first and the last vectors
+    int32_t tmp[3 * SSE_LEN_INT32];
+    int nb_tmp = right + SSE_LEN_INT32 - left;
+    memcpy(tmp, src + left, nb_tmp * sizeof(int32_t));
+    _mm_storeu_si128((v4si *) (tmp + nb_tmp), first);
+    _mm_storeu_si128((v4si *) (tmp + nb_tmp + SSE_LEN_INT32), last);
+    sort_partition_tails(src, tmp, nb_tmp + 2 * SSE_LEN_INT32, pivot, &left_w, &right_w);
+    return left_w;
+}
+
+SIMD_UTILS_API void sort128s(int32_t *src, int len)
+{
+    sort_runs(src, len, 4 * SSE_LEN_INT32, partition128s, sort_small128s);
+}
+
+// indices of the elements of src greater than threshold (see simd_utils_topk.h)
+static inline int filter_gt128s(int32_t *src, int len, int32_t threshold, int32_t *idx)
+{
+    int stop_len = len / (2 * SSE_LEN_INT32);
+    stop_len *= (2 * SSE_LEN_INT32);
+    v4si thr = _mm_set1_epi32(threshold);
+    int nb = 0;
+
+    for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
+        v4si x0 = _mm_loadu_si128((v4si *) (src + i));
+        v4si x1 = _mm_loadu_si128((v4si *) (src + i + SSE_LEN_INT32));
+        uint32_t mask = (uint32_t) _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(x0, thr))) | ((uint32_t) _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(x1, thr))) << SSE_LEN_INT32);
+        while (mask) {
+            idx[nb++] = i + __builtin_ctz(mask);
+            mask &= mask - 1;
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        if (src[i] > threshold)
+            idx[nb++] = i;
+    }
+    return nb;
+}
+
+// indices of the elements of src lower than threshold (see simd_utils_topk.h)
+static inline int filter_lt128s(int32_t *src, int len, int32_t threshold, int32_t *idx)
+{
+    int stop_len = len / (2 * SSE_LEN_INT32);
+    stop_len *= (2 * SSE_LEN_INT32);
+    v4si thr = _mm_set1_epi32(threshold);
+    int nb = 0;
+
+    for (int i = 0; i < stop_len; i += 2 * SSE_LEN_INT32) {
+        v4si x0 = _mm_loadu_si128((v4si *) (src + i));
+        v4si x1 = _mm_loadu_si128((v4si *) (src + i + SSE_LEN_INT32));
+        uint32_t mask = (uint32_t) _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(x0, thr))) | ((uint32_t) _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(x1, thr))) << SSE_LEN_INT32);
+        while (mask) {
+            idx[nb++] = i + __builtin_ctz(mask);
+            mask &= mask - 1;
+        }
+    }
+
+    for (int i = stop_len; i < len; i++) {
+        if (src[i] < threshold)
+            idx[nb++] = i;
+    }
+    return nb;
+}
+
+SIMD_UTILS_API void topk128s(int32_t *src, int len, int k, int32_t *dst, int32_t *idx)
+{
+    topk_runs(src, len, k, dst, idx, 1, filter_gt128s);
+}
+
+SIMD_UTILS_API void bottomk128s(int32_t *src, int len, int k, int32_t *dst, int32_t *idx)
+{
+    topk_runs(src, len, k, dst, idx, 0, filter_lt128s);
+}
+
+SIMD_UTILS_API void partialsort128s(int32_t *src, int len, int k)
+{
+    partialsort_runs(src, len, k, 4 * SSE_LEN_INT32, partition128s, sort_small128s);
 }
@@ -17,7 +17,7 @@
 #include <math.h>
 #include <string.h>
 
-size_t strnlen_s_128(const char *s, size_t maxlen) {
+SIMD_UTILS_API size_t strnlen_s_128(const char *s, size_t maxlen) {
     if (s == NULL)
         return 0;
 
@@ -51,7 +51,7 @@ size_t strnlen_s_128(const char *s, size_t maxlen) {
         }
     }
 
-    for (int i = stop_len; i < maxlen; i++) {
+    for (size_t i = stop_len; i < maxlen; i++) {
 		if (s[i] == '\0') {
             return i;
         }
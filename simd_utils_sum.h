@@ -0,0 +1,156 @@
+/*
+ * Project : SIMD_Utils
+ * Version : 0.2.6
+ * Author  : JishinMaster
+ * Licence : BSD-2
+ */
+
+#pragma once
+
+/* Compensated (sumkahanXf, dotkahanXf, dotckahanXf) and pairwise (sumpairwiseXf,
+ * dotpairwiseXf, dotcpairwiseXf) reductions, and their double versions.
+ *
+ * The compensated kernels of the backends add each vector to their accumulators with the
+ * TwoSum of Knuth, which gives the exact rounding error of the addition without any
+ * comparison (the branchless form of the Neumaier summation) : the errors are gathered in
+ * correction vectors, added back once at the end. With FMA, the dot products also gather
+ * the rounding errors of the products. The error of the result does not grow with len.
+ *
+ * The pairwise reductions split the array in halves down to blocks of PAIRWISE_BLOCK_LEN
+ * elements, reduced by the plain kernels of the backends (each lane of their accumulators
+ * adds a few hundred elements at most), and add the results of the halves : the error grows
+ * with log2(len / PAIRWISE_BLOCK_LEN) instead of len, at the speed of the plain kernels.
+ *
+ * The blocks start on multiples of PAIRWISE_BLOCK_LEN, so they keep the alignment of src.
+ */
+
+#ifndef PAIRWISE_BLOCK_LEN
+#define PAIRWISE_BLOCK_LEN 2048
+#endif
+
+typedef void (*sumf_kernel_t)(float *src, float *dst, int len);
+typedef void (*sumd_kernel_t)(double *src, double *dst, int len);
+typedef void (*dotf_kernel_t)(float *src1, float *src2, int len, float *dst);
+typedef void (*dotd_kernel_t)(double *src1, double *src2, int len, double *dst);
+typedef void (*dotcf_kernel_t)(complex32_t *src1, complex32_t *src2, int len, complex32_t *dst);
+typedef void (*dotcd_kernel_t)(complex64_t *src1, complex64_t *src2, int len, complex64_t *dst);
+
+// *sum + *cor += value, *cor gathers the rounding error of the addition (TwoSum)
+static inline void kahan_addf(float *sum, float *cor, float value)
+{
+    float t = *sum + value;
+    float bp = t - *sum;
+    *cor += (*sum - (t - bp)) + (value - bp);
+    *sum = t;
+}
+
+static inline void kahan_addd(double *sum, double *cor, double value)
+{
+    double t = *sum + value;
+    double bp = t - *sum;
+    *cor += (*sum - (t - bp)) + (value - bp);
+    *sum = t;
+}
+
+// adds the n lanes of the accumulators acc and of their corrections cor to *sum + *cor
+static inline void kahan_foldf(const float *acc, const float *cor, int n, float *sum, float *cor_sum)
+{
+    for (int i = 0; i < n; i++) {
+        kahan_addf(sum, cor_sum, acc[i]);
+        *cor_sum += cor[i];
+    }
+}
+
+static inline void kahan_foldd(const double *acc, const double *cor, int n, double *sum, double *cor_sum)
+{
+    for (int i = 0; i < n; i++) {
+        kahan_addd(sum, cor_sum, acc[i]);
+        *cor_sum += cor[i];
+    }
+}
+
+// length of the first half of a pairwise reduction of len > PAIRWISE_BLOCK_LEN elements
+static inline int pairwise_half(int len)
+{
+    return ((len / PAIRWISE_BLOCK_LEN + 1) / 2) * PAIRWISE_BLOCK_LEN;
+}
+
+static inline float sum_pairwisef(float *src, int len, sumf_kernel_t sum)
+{
+    if (len <= PAIRWISE_BLOCK_LEN) {
+        float tmp = 0.0f;
+        if (len > 0)
+            sum(src, &tmp, len);
+        return tmp;
+    }
+    int half = pairwise_half(len);
+    return sum_pairwisef(src, half, sum) + sum_pairwisef(src + half, len - half, sum);
+}
+
+static inline double sum_pairwised(double *src, int len, sumd_kernel_t sum)
+{
+    if (len <= PAIRWISE_BLOCK_LEN) {
+        double tmp = 0.0;
+        if (len > 0)
+            sum(src, &tmp, len);
+        return tmp;
+    }
+    int half = pairwise_half(len);
+    return sum_pairwised(src, half, sum) + sum_pairwised(src + half, len - half, sum);
+}
+
+static inline float dot_pairwisef(float *src1, float *src2, int len, dotf_kernel_t dot)
+{
+    if (len <= PAIRWISE_BLOCK_LEN) {
+        float tmp = 0.0f;
+        if (len > 0)
+            dot(src1, src2, len, &tmp);
+        return tmp;
+    }
+    int half = pairwise_half(len);
+    return dot_pairwisef(src1, src2, half, dot) + dot_pairwisef(src1 + half, src2 + half, len - half, dot);
+}
+
+static inline double dot_pairwised(double *src1, double *src2, int len, dotd_kernel_t dot)
+{
+    if (len <= PAIRWISE_BLOCK_LEN) {
+        double tmp = 0.0;
+        if (len > 0)
+            dot(src1, src2, len, &tmp);
+        return tmp;
+    }
+    int half = pairwise_half(len);
+    return dot_pairwised(src1, src2, half, dot) + dot_pairwised(src1 + half, src2 + half, len - half, dot);
+}
+
+static inline complex32_t dotc_pairwisef(complex32_t *src1, complex32_t *src2, int len, dotcf_kernel_t dotc)
+{
+    complex32_t tmp = {0.0f, 0.0f};
+    if (len <= PAIRWISE_BLOCK_LEN) {
+        if (len > 0)
+            dotc(src1, src2, len, &tmp);
+        return tmp;
+    }
+    int half = pairwise_half(len);
+    complex32_t lo = dotc_pairwisef(src1, src2, half, dotc);
+    complex32_t hi = dotc_pairwisef(src1 + half, src2 + half, len - half, dotc);
+    tmp.re = lo.re + hi.re;
+    tmp.im = lo.im + hi.im;
+    return tmp;
+}
+
+static inline complex64_t dotc_pairwised(complex64_t *src1, complex64_t *src2, int len, dotcd_kernel_t dotc)
+{
+    complex64_t tmp = {0.0, 0.0};
+    if (len <= PAIRWISE_BLOCK_LEN) {
+        if (len > 0)
+            dotc(src1, src2, len, &tmp);
+        return tmp;
+    }
+    int half = pairwise_half(len);
+    complex64_t lo = dotc_pairwised(src1, src2, half, dotc);
+    complex64_t hi = dotc_pairwised(src1 + half, src2 + half, len - half, dotc);
+    tmp.re = lo.re + hi.re;
+    tmp.im = lo.im + hi.im;
+    return tmp;
+}
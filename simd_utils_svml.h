@@ -8,7 +8,7 @@
 #pragma once
 
 #ifdef SSE
-static inline void sin128f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void sin128f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -30,7 +30,7 @@ static inline void sin128f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void cos128f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void cos128f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -52,7 +52,7 @@ static inline void cos128f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void sincos128f_svml(float *src, float *dst_sin, float *dst_cos, int len)
+SIMD_UTILS_API void sincos128f_svml(float *src, float *dst_sin, float *dst_cos, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -82,7 +82,7 @@ static inline void sincos128f_svml(float *src, float *dst_sin, float *dst_cos, i
     }
 }
 
-static inline void sincos128d_svml(double *src, double *dst_sin, double *dst_cos, int len)
+SIMD_UTILS_API void sincos128d_svml(double *src, double *dst_sin, double *dst_cos, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -113,7 +113,7 @@ static inline void sincos128d_svml(double *src, double *dst_sin, double *dst_cos
     }
 }
 
-static inline void exp128f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void exp128f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -133,7 +133,7 @@ static inline void exp128f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void exp128d_svml(double *src, double *dst, int len)
+SIMD_UTILS_API void exp128d_svml(double *src, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -155,7 +155,7 @@ static inline void exp128d_svml(double *src, double *dst, int len)
     }
 }
 
-static inline void ln128f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void ln128f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -175,7 +175,7 @@ static inline void ln128f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void ln128d_svml(double *src, double *dst, int len)
+SIMD_UTILS_API void ln128d_svml(double *src, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -197,7 +197,7 @@ static inline void ln128d_svml(double *src, double *dst, int len)
     }
 }
 
-static inline void log2128f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void log2128f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -217,7 +217,7 @@ static inline void log2128f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void log10128f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void log10128f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -237,7 +237,7 @@ static inline void log10128f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void atan128f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void atan128f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -259,7 +259,7 @@ static inline void atan128f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void atan128d_svml(double *src, double *dst, int len)
+SIMD_UTILS_API void atan128d_svml(double *src, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -281,7 +281,7 @@ static inline void atan128d_svml(double *src, double *dst, int len)
     }
 }
 
-static inline void atan2128f_svml(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void atan2128f_svml(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -301,7 +301,7 @@ static inline void atan2128f_svml(float *src1, float *src2, float *dst, int len)
     }
 }
 
-static inline void atan2128d_svml(double *src1, double *src2, double *dst, int len)
+SIMD_UTILS_API void atan2128d_svml(double *src1, double *src2, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -321,7 +321,7 @@ static inline void atan2128d_svml(double *src1, double *src2, double *dst, int l
     }
 }
 
-static inline void asin128f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void asin128f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -343,7 +343,7 @@ static inline void asin128f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void asin128d_svml(double *src, double *dst, int len)
+SIMD_UTILS_API void asin128d_svml(double *src, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -365,7 +365,7 @@ static inline void asin128d_svml(double *src, double *dst, int len)
     }
 }
 
-static inline void tan128f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void tan128f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -387,7 +387,7 @@ static inline void tan128f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void tan128d_svml(double *src, double *dst, int len)
+SIMD_UTILS_API void tan128d_svml(double *src, double *dst, int len)
 {
     int stop_len = len / SSE_LEN_DOUBLE;
     stop_len *= SSE_LEN_DOUBLE;
@@ -409,7 +409,7 @@ static inline void tan128d_svml(double *src, double *dst, int len)
     }
 }
 
-static inline void atanh128f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void atanh128f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -431,7 +431,7 @@ static inline void atanh128f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void acosh128f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void acosh128f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -453,7 +453,7 @@ static inline void acosh128f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void asinh128f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void asinh128f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -475,7 +475,7 @@ static inline void asinh128f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void sinh128f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void sinh128f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -497,7 +497,7 @@ static inline void sinh128f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void cosh128f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void cosh128f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -519,7 +519,7 @@ static inline void cosh128f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void tanh128f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void tanh128f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / SSE_LEN_FLOAT;
     stop_len *= SSE_LEN_FLOAT;
@@ -541,7 +541,7 @@ static inline void tanh128f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void cbrt128f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void cbrt128f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / (SSE_LEN_FLOAT);
     stop_len *= (SSE_LEN_FLOAT);
@@ -568,7 +568,7 @@ static inline void cbrt128f_svml(float *src, float *dst, int len)
 
 #ifdef AVX
 
-static inline void sin256f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void sin256f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -590,7 +590,7 @@ static inline void sin256f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void cos256f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void cos256f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -612,7 +612,7 @@ static inline void cos256f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void sincos256f_svml(float *src, float *dst_sin, float *dst_cos, int len)
+SIMD_UTILS_API void sincos256f_svml(float *src, float *dst_sin, float *dst_cos, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -642,7 +642,7 @@ static inline void sincos256f_svml(float *src, float *dst_sin, float *dst_cos, i
     }
 }
 
-static inline void sincos256d_svml(double *src, double *dst_sin, double *dst_cos, int len)
+SIMD_UTILS_API void sincos256d_svml(double *src, double *dst_sin, double *dst_cos, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -673,7 +673,7 @@ static inline void sincos256d_svml(double *src, double *dst_sin, double *dst_cos
     }
 }
 
-static inline void exp256f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void exp256f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -693,7 +693,7 @@ static inline void exp256f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void exp256d_svml(double *src, double *dst, int len)
+SIMD_UTILS_API void exp256d_svml(double *src, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -715,7 +715,7 @@ static inline void exp256d_svml(double *src, double *dst, int len)
     }
 }
 
-static inline void ln256f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void ln256f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -735,7 +735,7 @@ static inline void ln256f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void ln256d_svml(double *src, double *dst, int len)
+SIMD_UTILS_API void ln256d_svml(double *src, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -757,7 +757,7 @@ static inline void ln256d_svml(double *src, double *dst, int len)
     }
 }
 
-static inline void log2256f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void log2256f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -777,7 +777,7 @@ static inline void log2256f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void log10256f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void log10256f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -797,7 +797,7 @@ static inline void log10256f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void atan256f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void atan256f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -819,7 +819,7 @@ static inline void atan256f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void atan256d_svml(double *src, double *dst, int len)
+SIMD_UTILS_API void atan256d_svml(double *src, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -841,7 +841,7 @@ static inline void atan256d_svml(double *src, double *dst, int len)
     }
 }
 
-static inline void atan2256f_svml(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void atan2256f_svml(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -861,7 +861,7 @@ static inline void atan2256f_svml(float *src1, float *src2, float *dst, int len)
     }
 }
 
-static inline void atan2256d_svml(double *src1, double *src2, double *dst, int len)
+SIMD_UTILS_API void atan2256d_svml(double *src1, double *src2, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -881,7 +881,7 @@ static inline void atan2256d_svml(double *src1, double *src2, double *dst, int l
     }
 }
 
-static inline void asin256f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void asin256f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -903,7 +903,7 @@ static inline void asin256f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void asin256d_svml(double *src, double *dst, int len)
+SIMD_UTILS_API void asin256d_svml(double *src, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -925,7 +925,7 @@ static inline void asin256d_svml(double *src, double *dst, int len)
     }
 }
 
-static inline void tan256f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void tan256f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -947,7 +947,7 @@ static inline void tan256f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void tan256d_svml(double *src, double *dst, int len)
+SIMD_UTILS_API void tan256d_svml(double *src, double *dst, int len)
 {
     int stop_len = len / AVX_LEN_DOUBLE;
     stop_len *= AVX_LEN_DOUBLE;
@@ -969,7 +969,7 @@ static inline void tan256d_svml(double *src, double *dst, int len)
     }
 }
 
-static inline void atanh256f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void atanh256f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -991,7 +991,7 @@ static inline void atanh256f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void acosh256f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void acosh256f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -1013,7 +1013,7 @@ static inline void acosh256f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void asinh256f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void asinh256f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -1035,7 +1035,7 @@ static inline void asinh256f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void sinh256f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void sinh256f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -1057,7 +1057,7 @@ static inline void sinh256f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void cosh256f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void cosh256f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -1079,7 +1079,7 @@ static inline void cosh256f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void tanh256f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void tanh256f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX_LEN_FLOAT;
     stop_len *= AVX_LEN_FLOAT;
@@ -1101,7 +1101,7 @@ static inline void tanh256f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void cbrt256f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void cbrt256f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / (AVX_LEN_FLOAT);
     stop_len *= (AVX_LEN_FLOAT);
@@ -1128,7 +1128,7 @@ static inline void cbrt256f_svml(float *src, float *dst, int len)
 
 #ifdef AVX512
 
-static inline void sin512f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void sin512f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1150,7 +1150,7 @@ static inline void sin512f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void cos512f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void cos512f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1172,7 +1172,7 @@ static inline void cos512f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void sincos512f_svml(float *src, float *dst_sin, float *dst_cos, int len)
+SIMD_UTILS_API void sincos512f_svml(float *src, float *dst_sin, float *dst_cos, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1202,7 +1202,7 @@ static inline void sincos512f_svml(float *src, float *dst_sin, float *dst_cos, i
     }
 }
 
-static inline void sincos512d_svml(double *src, double *dst_sin, double *dst_cos, int len)
+SIMD_UTILS_API void sincos512d_svml(double *src, double *dst_sin, double *dst_cos, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -1233,7 +1233,7 @@ static inline void sincos512d_svml(double *src, double *dst_sin, double *dst_cos
     }
 }
 
-static inline void exp512f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void exp512f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1253,7 +1253,7 @@ static inline void exp512f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void exp512d_svml(double *src, double *dst, int len)
+SIMD_UTILS_API void exp512d_svml(double *src, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -1275,7 +1275,7 @@ static inline void exp512d_svml(double *src, double *dst, int len)
     }
 }
 
-static inline void ln512f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void ln512f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1295,7 +1295,7 @@ static inline void ln512f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void ln512d_svml(double *src, double *dst, int len)
+SIMD_UTILS_API void ln512d_svml(double *src, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -1317,7 +1317,7 @@ static inline void ln512d_svml(double *src, double *dst, int len)
     }
 }
 
-static inline void log2512f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void log2512f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1337,7 +1337,7 @@ static inline void log2512f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void log10512f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void log10512f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1357,7 +1357,7 @@ static inline void log10512f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void atan512f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void atan512f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1379,7 +1379,7 @@ static inline void atan512f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void atan512d_svml(double *src, double *dst, int len)
+SIMD_UTILS_API void atan512d_svml(double *src, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -1401,7 +1401,7 @@ static inline void atan512d_svml(double *src, double *dst, int len)
     }
 }
 
-static inline void atan2512f_svml(float *src1, float *src2, float *dst, int len)
+SIMD_UTILS_API void atan2512f_svml(float *src1, float *src2, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1421,7 +1421,7 @@ static inline void atan2512f_svml(float *src1, float *src2, float *dst, int len)
     }
 }
 
-static inline void atan2512d_svml(double *src1, double *src2, double *dst, int len)
+SIMD_UTILS_API void atan2512d_svml(double *src1, double *src2, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -1441,7 +1441,7 @@ static inline void atan2512d_svml(double *src1, double *src2, double *dst, int l
     }
 }
 
-static inline void asin512f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void asin512f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1463,7 +1463,7 @@ static inline void asin512f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void asin512d_svml(double *src, double *dst, int len)
+SIMD_UTILS_API void asin512d_svml(double *src, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -1485,7 +1485,7 @@ static inline void asin512d_svml(double *src, double *dst, int len)
     }
 }
 
-static inline void tan512f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void tan512f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1507,7 +1507,7 @@ static inline void tan512f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void tan512d_svml(double *src, double *dst, int len)
+SIMD_UTILS_API void tan512d_svml(double *src, double *dst, int len)
 {
     int stop_len = len / AVX512_LEN_DOUBLE;
     stop_len *= AVX512_LEN_DOUBLE;
@@ -1529,7 +1529,7 @@ static inline void tan512d_svml(double *src, double *dst, int len)
     }
 }
 
-static inline void atanh512f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void atanh512f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1551,7 +1551,7 @@ static inline void atanh512f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void acosh512f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void acosh512f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1573,7 +1573,7 @@ static inline void acosh512f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void asinh512f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void asinh512f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1595,7 +1595,7 @@ static inline void asinh512f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void sinh512f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void sinh512f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1617,7 +1617,7 @@ static inline void sinh512f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void cosh512f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void cosh512f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1639,7 +1639,7 @@ static inline void cosh512f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void tanh512f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void tanh512f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / AVX512_LEN_FLOAT;
     stop_len *= AVX512_LEN_FLOAT;
@@ -1661,7 +1661,7 @@ static inline void tanh512f_svml(float *src, float *dst, int len)
     }
 }
 
-static inline void cbrt512f_svml(float *src, float *dst, int len)
+SIMD_UTILS_API void cbrt512f_svml(float *src, float *dst, int len)
 {
     int stop_len = len / (AVX512_LEN_FLOAT);
     stop_len *= (AVX512_LEN_FLOAT);
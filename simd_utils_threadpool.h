@@ -0,0 +1,706 @@
+/*
+ * Project : SIMD_Utils
+ * Version : 0.2.6
+ * Author  : JishinMaster
+ * Licence : BSD-2
+ */
+
+#pragma once
+
+/* Persistent thread pool, enabled with -DTHREADPOOL (link with -lpthread).
+ *
+ * Unlike the OMP paths, the threads are created once (threadpool_init) and
+ * wait for work by spinning a short time before sleeping, so that splitting a
+ * kernel costs a few microseconds instead of an OpenMP region.
+ * Each job is cut into one range per thread. A thread takes grain sized chunks
+ * from its own range with an atomic fetch_add, then steals chunks from the
+ * ranges of the other threads the same way, so no lock is taken on the work path.
+ * The calling thread takes part in the work as thread 0.
+ *
+ * The pool runs one job at a time. A call made while another job is running
+ * (from another application thread, or from a task) does not wait for the pool :
+ * it runs the whole job on the calling thread instead.
+ * threadpool_init and threadpool_destroy must not race with the other calls.
+ *
+ * The pool is a static object : each translation unit including simd_utils.h
+ * with THREADPOOL has its own pool.
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#ifndef THREADPOOL_MAX_THREADS
+#define THREADPOOL_MAX_THREADS 64
+#endif
+
+// number of polling iterations before a waiting thread goes to sleep
+#ifndef THREADPOOL_SPIN
+#define THREADPOOL_SPIN 20000
+#endif
+
+/* Minimum number of elements per thread before splitting a call.
+ * Memory bound kernels (add, mul, copy, ...) need larger chunks than
+ * compute bound ones (exp, sincos, atan2, ...) to amortize the dispatch. */
+#define THREADPOOL_MIN_LEN_MEMORY 32768
+#define THREADPOOL_MIN_LEN_COMPUTE 4096
+
+// chunk boundaries are kept on 64 elements, so that aligned arrays give aligned chunks
+#define THREADPOOL_ALIGN_ELT 64
+
+typedef void (*threadpool_task_t)(void *arg, int start, int end);
+
+typedef struct {
+    int next;
+    int end;
+    char pad[64 - 2 * sizeof(int)];  // one range per cache line
+} threadpool_range_t;
+
+typedef struct {
+    threadpool_range_t ranges[THREADPOOL_MAX_THREADS] __attribute__((aligned(64)));
+    pthread_t threads[THREADPOOL_MAX_THREADS];
+    int nb_threads;  // including the calling thread
+    threadpool_task_t task;
+    void *arg;
+    int grain;
+    unsigned int generation;  // incremented for each job
+    int pending;              // worker threads still running the current job
+    int sleeping;
+    int stop;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    pthread_mutex_t submit;  // held by the thread which owns the current job
+} threadpool_t;
+
+static threadpool_t simd_threadpool = {.nb_threads = 0};
+
+static inline void threadpool_cpu_relax(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ volatile("yield" ::
+                         : "memory");
+#endif
+}
+
+// polls with pause, yielding the CPU from time to time in case threads outnumber cores
+static inline void threadpool_wait_step(int spin)
+{
+    if ((spin & 255) == 255)
+        sched_yield();
+    else
+        threadpool_cpu_relax();
+}
+
+static inline void threadpool_run_chunks(threadpool_t *pool, int self)
+{
+    int nb_threads = pool->nb_threads;
+    int grain = pool->grain;
+
+    for (int k = 0; k < nb_threads; k++) {
+        threadpool_range_t *range = &pool->ranges[(self + k) % nb_threads];
+        for (;;) {
+            int start = __atomic_fetch_add(&range->next, grain, __ATOMIC_RELAXED);
+            if (start >= range->end)
+                break;
+            int end = start + grain;
+            if (end > range->end)
+                end = range->end;
+            pool->task(pool->arg, start, end);
+        }
+    }
+}
+
+static inline void *threadpool_worker(void *arg)
+{
+    threadpool_t *pool = &simd_threadpool;
+    int self = (int) (intptr_t) arg;
+    unsigned int seen = 0;
+
+    for (;;) {
+        unsigned int generation;
+        int spin = 0;
+
+        while ((generation = __atomic_load_n(&pool->generation, __ATOMIC_ACQUIRE)) == seen) {
+            if (__atomic_load_n(&pool->stop, __ATOMIC_ACQUIRE))
+                return NULL;
+            if (spin < THREADPOOL_SPIN) {
+                threadpool_wait_step(spin);
+                spin++;
+                continue;
+            }
+            pthread_mutex_lock(&pool->mutex);
+            __atomic_add_fetch(&pool->sleeping, 1, __ATOMIC_SEQ_CST);
+            while ((__atomic_load_n(&pool->generation, __ATOMIC_SEQ_CST) == seen) &&
+                   !__atomic_load_n(&pool->stop, __ATOMIC_SEQ_CST)) {
+                pthread_cond_wait(&pool->cond, &pool->mutex);
+            }
+            __atomic_sub_fetch(&pool->sleeping, 1, __ATOMIC_SEQ_CST);
+            pthread_mutex_unlock(&pool->mutex);
+            spin = 0;
+        }
+
+        seen = generation;
+        threadpool_run_chunks(pool, self);
+        __atomic_sub_fetch(&pool->pending, 1, __ATOMIC_RELEASE);
+    }
+}
+
+/* Starts nb_threads - 1 worker threads (the caller being the last one).
+ * nb_threads <= 0 uses the number of online CPUs.
+ * Returns the number of threads of the pool. */
+static inline int threadpool_init(int nb_threads)
+{
+    threadpool_t *pool = &simd_threadpool;
+
+    if (pool->nb_threads > 0)
+        return pool->nb_threads;
+
+    if (nb_threads <= 0)
+        nb_threads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+    if (nb_threads < 1)
+        nb_threads = 1;
+    if (nb_threads > THREADPOOL_MAX_THREADS)
+        nb_threads = THREADPOOL_MAX_THREADS;
+
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_cond_init(&pool->cond, NULL);
+    pthread_mutex_init(&pool->submit, NULL);
+    pool->generation = 0;
+    pool->pending = 0;
+    pool->sleeping = 0;
+    pool->stop = 0;
+    pool->nb_threads = 1;
+
+    for (int i = 1; i < nb_threads; i++) {
+        if (pthread_create(&pool->threads[i], NULL, threadpool_worker, (void *) (intptr_t) i) != 0)
+            break;
+        pool->nb_threads++;
+    }
+
+    return pool->nb_threads;
+}
+
+static inline void threadpool_destroy(void)
+{
+    threadpool_t *pool = &simd_threadpool;
+
+    if (pool->nb_threads == 0)
+        return;
+
+    pthread_mutex_lock(&pool->mutex);
+    __atomic_store_n(&pool->stop, 1, __ATOMIC_SEQ_CST);
+    pthread_cond_broadcast(&pool->cond);
+    pthread_mutex_unlock(&pool->mutex);
+
+    for (int i = 1; i < pool->nb_threads; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    pthread_cond_destroy(&pool->cond);
+    pthread_mutex_destroy(&pool->mutex);
+    pthread_mutex_destroy(&pool->submit);
+    pool->nb_threads = 0;
+}
+
+static inline int threadpool_nb_threads(void)
+{
+    return (simd_threadpool.nb_threads > 0) ? simd_threadpool.nb_threads : 1;
+}
+
+/* Calls task(arg, start, end) on chunks covering [0, len).
+ * The call is not split if the pool is not started, if each thread would get
+ * less than min_len elements, or if the pool is busy with the job of another caller
+ * (task(arg, 0, len) then runs on the calling thread). */
+static inline void threadpool_parallel_for(threadpool_task_t task, void *arg, int len, int min_len)
+{
+    threadpool_t *pool = &simd_threadpool;
+    int nb_threads = pool->nb_threads;
+
+    if (len <= 0)
+        return;
+
+    if ((nb_threads <= 1) || (len < 2 * min_len)) {
+        task(arg, 0, len);
+        return;
+    }
+
+    // ranges, task and pending are shared by all the callers
+    if (pthread_mutex_trylock(&pool->submit) != 0) {
+        task(arg, 0, len);
+        return;
+    }
+
+    if (nb_threads > len / min_len)
+        nb_threads = len / min_len;
+
+    // each range is cut in a few chunks so that late threads can be helped
+    int range_len = (len + nb_threads - 1) / nb_threads;
+    range_len = ((range_len + THREADPOOL_ALIGN_ELT - 1) / THREADPOOL_ALIGN_ELT) * THREADPOOL_ALIGN_ELT;
+    int grain = range_len / 4;
+    grain = ((grain + THREADPOOL_ALIGN_ELT - 1) / THREADPOOL_ALIGN_ELT) * THREADPOOL_ALIGN_ELT;
+
+    for (int i = 0; i < pool->nb_threads; i++) {
+        int start = i * range_len;
+        int end = start + range_len;
+        if (i >= nb_threads)
+            start = end = len;  // threads left without range only steal
+        if (start > len)
+            start = len;
+        if (end > len)
+            end = len;
+        pool->ranges[i].next = start;
+        pool->ranges[i].end = end;
+    }
+
+    pool->task = task;
+    pool->arg = arg;
+    pool->grain = grain;
+    __atomic_store_n(&pool->pending, pool->nb_threads - 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&pool->generation, 1, __ATOMIC_SEQ_CST);
+
+    if (__atomic_load_n(&pool->sleeping, __ATOMIC_SEQ_CST) > 0) {
+        pthread_mutex_lock(&pool->mutex);
+        pthread_cond_broadcast(&pool->cond);
+        pthread_mutex_unlock(&pool->mutex);
+    }
+
+    threadpool_run_chunks(pool, 0);
+
+    for (int spin = 0; __atomic_load_n(&pool->pending, __ATOMIC_ACQUIRE) > 0; spin++) {
+        threadpool_wait_step(spin);
+    }
+
+    pthread_mutex_unlock(&pool->submit);
+}
+
+////////// Kernel wrappers //////////
+// e.g threadpool_binaryf(add256f, src1, src2, dst, len, THREADPOOL_MIN_LEN_MEMORY);
+
+typedef struct {
+    void (*unaryf)(float *, float *, int);
+    void (*binaryf)(float *, float *, float *, int);
+    void (*sincosf)(float *, float *, float *, int);
+    void (*unaryd)(double *, double *, int);
+    void (*binaryd)(double *, double *, double *, int);
+    void (*sincosd)(double *, double *, double *, int);
+    void *src1;
+    void *src2;
+    void *dst1;
+    void *dst2;
+} threadpool_kernel_t;
+
+static inline void threadpool_unaryf_task(void *arg, int start, int end)
+{
+    threadpool_kernel_t *k = (threadpool_kernel_t *) arg;
+    k->unaryf((float *) k->src1 + start, (float *) k->dst1 + start, end - start);
+}
+
+static inline void threadpool_binaryf_task(void *arg, int start, int end)
+{
+    threadpool_kernel_t *k = (threadpool_kernel_t *) arg;
+    k->binaryf((float *) k->src1 + start, (float *) k->src2 + start, (float *) k->dst1 + start, end - start);
+}
+
+static inline void threadpool_sincosf_task(void *arg, int start, int end)
+{
+    threadpool_kernel_t *k = (threadpool_kernel_t *) arg;
+    k->sincosf((float *) k->src1 + start, (float *) k->dst1 + start, (float *) k->dst2 + start, end - start);
+}
+
+static inline void threadpool_unaryd_task(void *arg, int start, int end)
+{
+    threadpool_kernel_t *k = (threadpool_kernel_t *) arg;
+    k->unaryd((double *) k->src1 + start, (double *) k->dst1 + start, end - start);
+}
+
+static inline void threadpool_binaryd_task(void *arg, int start, int end)
+{
+    threadpool_kernel_t *k = (threadpool_kernel_t *) arg;
+    k->binaryd((double *) k->src1 + start, (double *) k->src2 + start, (double *) k->dst1 + start, end - start);
+}
+
+static inline void threadpool_sincosd_task(void *arg, int start, int end)
+{
+    threadpool_kernel_t *k = (threadpool_kernel_t *) arg;
+    k->sincosd((double *) k->src1 + start, (double *) k->dst1 + start, (double *) k->dst2 + start, end - start);
+}
+
+// kernels such as exp256f, sqrt512f, log10128f
+static inline void threadpool_unaryf(void (*kernel)(float *, float *, int), float *src, float *dst, int len, int min_len)
+{
+    threadpool_kernel_t k = {0};
+    k.unaryf = kernel;
+    k.src1 = src;
+    k.dst1 = dst;
+    threadpool_parallel_for(threadpool_unaryf_task, &k, len, min_len);
+}
+
+// kernels such as add256f, mul512f, atan2128f
+static inline void threadpool_binaryf(void (*kernel)(float *, float *, float *, int), float *src1, float *src2, float *dst, int len, int min_len)
+{
+    threadpool_kernel_t k = {0};
+    k.binaryf = kernel;
+    k.src1 = src1;
+    k.src2 = src2;
+    k.dst1 = dst;
+    threadpool_parallel_for(threadpool_binaryf_task, &k, len, min_len);
+}
+
+// sincos256f, sincos512f, ...
+static inline void threadpool_sincosf(void (*kernel)(float *, float *, float *, int), float *src, float *dst_sin, float *dst_cos, int len, int min_len)
+{
+    threadpool_kernel_t k = {0};
+    k.sincosf = kernel;
+    k.src1 = src;
+    k.dst1 = dst_sin;
+    k.dst2 = dst_cos;
+    threadpool_parallel_for(threadpool_sincosf_task, &k, len, min_len);
+}
+
+static inline void threadpool_unaryd(void (*kernel)(double *, double *, int), double *src, double *dst, int len, int min_len)
+{
+    threadpool_kernel_t k = {0};
+    k.unaryd = kernel;
+    k.src1 = src;
+    k.dst1 = dst;
+    threadpool_parallel_for(threadpool_unaryd_task, &k, len, min_len);
+}
+
+static inline void threadpool_binaryd(void (*kernel)(double *, double *, double *, int), double *src1, double *src2, double *dst, int len, int min_len)
+{
+    threadpool_kernel_t k = {0};
+    k.binaryd = kernel;
+    k.src1 = src1;
+    k.src2 = src2;
+    k.dst1 = dst;
+    threadpool_parallel_for(threadpool_binaryd_task, &k, len, min_len);
+}
+
+static inline void threadpool_sincosd(void (*kernel)(double *, double *, double *, int), double *src, double *dst_sin, double *dst_cos, int len, int min_len)
+{
+    threadpool_kernel_t k = {0};
+    k.sincosd = kernel;
+    k.src1 = src;
+    k.dst1 = dst_sin;
+    k.dst2 = dst_cos;
+    threadpool_parallel_for(threadpool_sincosd_task, &k, len, min_len);
+}
+
+////////// Reductions //////////
+/* Each chunk is reduced on its own and merged into the result under a lock, so the
+ * rounding of the result depends on the order in which the chunks end.
+ * e.g moments_init(&m); threadpool_momentsf(moments512f, src, len, &m, THREADPOOL_MIN_LEN_MEMORY); */
+
+typedef struct {
+    void (*momentsf)(float *, int, moments_t *);
+    void (*momentsd)(double *, int, moments_t *);
+    void *src;
+    moments_t *m;
+    pthread_mutex_t lock;
+} threadpool_reduce_t;
+
+static inline void threadpool_momentsf_task(void *arg, int start, int end)
+{
+    threadpool_reduce_t *r = (threadpool_reduce_t *) arg;
+    moments_t chunk;
+    moments_init(&chunk);
+    r->momentsf((float *) r->src + start, end - start, &chunk);
+    pthread_mutex_lock(&r->lock);
+    moments_merge(r->m, &chunk);
+    pthread_mutex_unlock(&r->lock);
+}
+
+static inline void threadpool_momentsd_task(void *arg, int start, int end)
+{
+    threadpool_reduce_t *r = (threadpool_reduce_t *) arg;
+    moments_t chunk;
+    moments_init(&chunk);
+    r->momentsd((double *) r->src + start, end - start, &chunk);
+    pthread_mutex_lock(&r->lock);
+    moments_merge(r->m, &chunk);
+    pthread_mutex_unlock(&r->lock);
+}
+
+// moments256f, moments512f, ..., the moments of src are merged into m
+static inline void threadpool_momentsf(void (*kernel)(float *, int, moments_t *), float *src, int len, moments_t *m, int min_len)
+{
+    threadpool_reduce_t r = {0};
+    r.momentsf = kernel;
+    r.src = src;
+    r.m = m;
+    pthread_mutex_init(&r.lock, NULL);
+    threadpool_parallel_for(threadpool_momentsf_task, &r, len, min_len);
+    pthread_mutex_destroy(&r.lock);
+}
+
+static inline void threadpool_momentsd(void (*kernel)(double *, int, moments_t *), double *src, int len, moments_t *m, int min_len)
+{
+    threadpool_reduce_t r = {0};
+    r.momentsd = kernel;
+    r.src = src;
+    r.m = m;
+    pthread_mutex_init(&r.lock, NULL);
+    threadpool_parallel_for(threadpool_momentsd_task, &r, len, min_len);
+    pthread_mutex_destroy(&r.lock);
+}
+
+////////// Scans //////////
+/* Two pass prefix sums : the array is cut in a few blocks per thread. The first pass computes
+ * the total of each block (scanned by pieces of THREADPOOL_SCAN_TMP_LEN elements into a buffer
+ * staying in the cache, so that dst is written once), the carries of the blocks are summed,
+ * then the second pass scans each block from its carry into dst.
+ * The kernel can be inclusive or exclusive, carry is the one of the kernels (NULL for 0).
+ * e.g threadpool_prefixsumf(prefixsum512f, src, dst, len, NULL, THREADPOOL_MIN_LEN_MEMORY); */
+
+#define THREADPOOL_SCAN_MAX_BLOCKS (4 * THREADPOOL_MAX_THREADS)
+#define THREADPOOL_SCAN_TMP_LEN 1024
+
+typedef struct {
+    void (*prefixsumf)(float *, float *, int, float *);
+    void (*prefixsumd)(double *, double *, int, double *);
+    void (*prefixsums)(int32_t *, int32_t *, int, int32_t *);
+    void (*prefixsum16s)(int16_t *, int16_t *, int, int16_t *);
+    void *src;
+    void *dst;
+    int len;
+    int block_len;
+    int nb_blocks;
+    int pass;
+    union {  // totals of the blocks after the first pass, carries before the second
+        float f[THREADPOOL_SCAN_MAX_BLOCKS];
+        double d[THREADPOOL_SCAN_MAX_BLOCKS];
+        int32_t s[THREADPOOL_SCAN_MAX_BLOCKS];
+        int16_t s16[THREADPOOL_SCAN_MAX_BLOCKS];
+    } carries;
+} threadpool_scan_t;
+
+// 0 if the scan is not worth splitting
+static inline int threadpool_scan_begin(threadpool_scan_t *r, int len, int min_len)
+{
+    int nb_threads = threadpool_nb_threads();
+    if ((nb_threads <= 1) || (len < 2 * min_len))
+        return 0;
+
+    int nb_blocks = 4 * nb_threads;
+    if (nb_blocks > THREADPOOL_SCAN_MAX_BLOCKS)
+        nb_blocks = THREADPOOL_SCAN_MAX_BLOCKS;
+    int block_len = (len + nb_blocks - 1) / nb_blocks;
+    block_len = ((block_len + THREADPOOL_ALIGN_ELT - 1) / THREADPOOL_ALIGN_ELT) * THREADPOOL_ALIGN_ELT;
+
+    r->len = len;
+    r->block_len = block_len;
+    r->nb_blocks = (len + block_len - 1) / block_len;
+    r->pass = 0;
+    return 1;
+}
+
+// each block is done by the chunk holding its start, whatever the chunks of the pool
+static inline int threadpool_scan_first_block(threadpool_scan_t *r, int start)
+{
+    return (start + r->block_len - 1) / r->block_len;
+}
+
+static inline int threadpool_scan_block_len(threadpool_scan_t *r, int b)
+{
+    int block_len = r->len - b * r->block_len;
+    return (block_len < r->block_len) ? block_len : r->block_len;
+}
+
+static inline void threadpool_prefixsumf_task(void *arg, int start, int end)
+{
+    threadpool_scan_t *r = (threadpool_scan_t *) arg;
+    float *src = (float *) r->src;
+    float *dst = (float *) r->dst;
+
+    for (int b = threadpool_scan_first_block(r, start); b * r->block_len < end; b++) {
+        int block_start = b * r->block_len;
+        int block_len = threadpool_scan_block_len(r, b);
+        if (r->pass == 0) {
+            float tmp[THREADPOOL_SCAN_TMP_LEN] __attribute__((aligned(64)));
+            float total = 0.0f;
+            for (int i = 0; i < block_len; i += THREADPOOL_SCAN_TMP_LEN) {
+                int tmp_len = ((block_len - i) < THREADPOOL_SCAN_TMP_LEN) ? (block_len - i) : THREADPOOL_SCAN_TMP_LEN;
+                r->prefixsumf(src + block_start + i, tmp, tmp_len, &total);
+            }
+            r->carries.f[b] = total;
+        } else {
+            r->prefixsumf(src + block_start, dst + block_start, block_len, &r->carries.f[b]);
+        }
+    }
+}
+
+// prefixsum256f, prefixsum512f_excl, ...
+static inline void threadpool_prefixsumf(void (*kernel)(float *, float *, int, float *), float *src, float *dst, int len, float *carry, int min_len)
+{
+    threadpool_scan_t r = {0};
+    if (!threadpool_scan_begin(&r, len, min_len)) {
+        kernel(src, dst, len, carry);
+        return;
+    }
+    r.prefixsumf = kernel;
+    r.src = src;
+    r.dst = dst;
+    threadpool_parallel_for(threadpool_prefixsumf_task, &r, len, min_len);
+
+    float carry_tmp = carry ? *carry : 0.0f;
+    for (int b = 0; b < r.nb_blocks; b++) {
+        float total = r.carries.f[b];
+        r.carries.f[b] = carry_tmp;
+        carry_tmp = carry_tmp + total;
+    }
+
+    r.pass = 1;
+    threadpool_parallel_for(threadpool_prefixsumf_task, &r, len, min_len);
+    if (carry)
+        *carry = carry_tmp;
+}
+
+static inline void threadpool_prefixsumd_task(void *arg, int start, int end)
+{
+    threadpool_scan_t *r = (threadpool_scan_t *) arg;
+    double *src = (double *) r->src;
+    double *dst = (double *) r->dst;
+
+    for (int b = threadpool_scan_first_block(r, start); b * r->block_len < end; b++) {
+        int block_start = b * r->block_len;
+        int block_len = threadpool_scan_block_len(r, b);
+        if (r->pass == 0) {
+            double tmp[THREADPOOL_SCAN_TMP_LEN] __attribute__((aligned(64)));
+            double total = 0.0;
+            for (int i = 0; i < block_len; i += THREADPOOL_SCAN_TMP_LEN) {
+                int tmp_len = ((block_len - i) < THREADPOOL_SCAN_TMP_LEN) ? (block_len - i) : THREADPOOL_SCAN_TMP_LEN;
+                r->prefixsumd(src + block_start + i, tmp, tmp_len, &total);
+            }
+            r->carries.d[b] = total;
+        } else {
+            r->prefixsumd(src + block_start, dst + block_start, block_len, &r->carries.d[b]);
+        }
+    }
+}
+
+// prefixsum256d, prefixsum512d_excl, ...
+static inline void threadpool_prefixsumd(void (*kernel)(double *, double *, int, double *), double *src, double *dst, int len, double *carry, int min_len)
+{
+    threadpool_scan_t r = {0};
+    if (!threadpool_scan_begin(&r, len, min_len)) {
+        kernel(src, dst, len, carry);
+        return;
+    }
+    r.prefixsumd = kernel;
+    r.src = src;
+    r.dst = dst;
+    threadpool_parallel_for(threadpool_prefixsumd_task, &r, len, min_len);
+
+    double carry_tmp = carry ? *carry : 0.0;
+    for (int b = 0; b < r.nb_blocks; b++) {
+        double total = r.carries.d[b];
+        r.carries.d[b] = carry_tmp;
+        carry_tmp = carry_tmp + total;
+    }
+
+    r.pass = 1;
+    threadpool_parallel_for(threadpool_prefixsumd_task, &r, len, min_len);
+    if (carry)
+        *carry = carry_tmp;
+}
+
+static inline void threadpool_prefixsums_task(void *arg, int start, int end)
+{
+    threadpool_scan_t *r = (threadpool_scan_t *) arg;
+    int32_t *src = (int32_t *) r->src;
+    int32_t *dst = (int32_t *) r->dst;
+
+    for (int b = threadpool_scan_first_block(r, start); b * r->block_len < end; b++) {
+        int block_start = b * r->block_len;
+        int block_len = threadpool_scan_block_len(r, b);
+        if (r->pass == 0) {
+            int32_t tmp[THREADPOOL_SCAN_TMP_LEN] __attribute__((aligned(64)));
+            int32_t total = 0;
+            for (int i = 0; i < block_len; i += THREADPOOL_SCAN_TMP_LEN) {
+                int tmp_len = ((block_len - i) < THREADPOOL_SCAN_TMP_LEN) ? (block_len - i) : THREADPOOL_SCAN_TMP_LEN;
+                r->prefixsums(src + block_start + i, tmp, tmp_len, &total);
+            }
+            r->carries.s[b] = total;
+        } else {
+            r->prefixsums(src + block_start, dst + block_start, block_len, &r->carries.s[b]);
+        }
+    }
+}
+
+// prefixsum256s, prefixsum512s_excl, ...
+static inline void threadpool_prefixsums(void (*kernel)(int32_t *, int32_t *, int, int32_t *), int32_t *src, int32_t *dst, int len, int32_t *carry, int min_len)
+{
+    threadpool_scan_t r = {0};
+    if (!threadpool_scan_begin(&r, len, min_len)) {
+        kernel(src, dst, len, carry);
+        return;
+    }
+    r.prefixsums = kernel;
+    r.src = src;
+    r.dst = dst;
+    threadpool_parallel_for(threadpool_prefixsums_task, &r, len, min_len);
+
+    int32_t carry_tmp = carry ? *carry : 0;
+    for (int b = 0; b < r.nb_blocks; b++) {
+        int32_t total = r.carries.s[b];
+        r.carries.s[b] = carry_tmp;
+        carry_tmp = (int32_t) ((uint32_t) carry_tmp + (uint32_t) total);
+    }
+
+    r.pass = 1;
+    threadpool_parallel_for(threadpool_prefixsums_task, &r, len, min_len);
+    if (carry)
+        *carry = carry_tmp;
+}
+
+static inline void threadpool_prefixsum16s_task(void *arg, int start, int end)
+{
+    threadpool_scan_t *r = (threadpool_scan_t *) arg;
+    int16_t *src = (int16_t *) r->src;
+    int16_t *dst = (int16_t *) r->dst;
+
+    for (int b = threadpool_scan_first_block(r, start); b * r->block_len < end; b++) {
+        int block_start = b * r->block_len;
+        int block_len = threadpool_scan_block_len(r, b);
+        if (r->pass == 0) {
+            int16_t tmp[THREADPOOL_SCAN_TMP_LEN] __attribute__((aligned(64)));
+            int16_t total = 0;
+            for (int i = 0; i < block_len; i += THREADPOOL_SCAN_TMP_LEN) {
+                int tmp_len = ((block_len - i) < THREADPOOL_SCAN_TMP_LEN) ? (block_len - i) : THREADPOOL_SCAN_TMP_LEN;
+                r->prefixsum16s(src + block_start + i, tmp, tmp_len, &total);
+            }
+            r->carries.s16[b] = total;
+        } else {
+            r->prefixsum16s(src + block_start, dst + block_start, block_len, &r->carries.s16[b]);
+        }
+    }
+}
+
+// prefixsum16s_256s, prefixsum16s_512s_excl, ...
+static inline void threadpool_prefixsum16s(void (*kernel)(int16_t *, int16_t *, int, int16_t *), int16_t *src, int16_t *dst, int len, int16_t *carry, int min_len)
+{
+    threadpool_scan_t r = {0};
+    if (!threadpool_scan_begin(&r, len, min_len)) {
+        kernel(src, dst, len, carry);
+        return;
+    }
+    r.prefixsum16s = kernel;
+    r.src = src;
+    r.dst = dst;
+    threadpool_parallel_for(threadpool_prefixsum16s_task, &r, len, min_len);
+
+    int16_t carry_tmp = carry ? *carry : 0;
+    for (int b = 0; b < r.nb_blocks; b++) {
+        int16_t total = r.carries.s16[b];
+        r.carries.s16[b] = carry_tmp;
+        carry_tmp = (int16_t) (carry_tmp + total);
+    }
+
+    r.pass = 1;
+    threadpool_parallel_for(threadpool_prefixsum16s_task, &r, len, min_len);
+    if (carry)
+        *carry = carry_tmp;
+}
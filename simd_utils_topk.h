@@ -0,0 +1,208 @@
+/*
+ * Project : SIMD_Utils
+ * Version : 0.2.6
+ * Author  : JishinMaster
+ * Licence : BSD-2
+ */
+
+#pragma once
+
+/* Largest and smallest k elements with their indices (topkXf, bottomkXf, topkXs, bottomkXs).
+ *
+ * The k best elements seen so far are kept in a binary heap stored in dst and idx, the worst
+ * of them at the root : it is the threshold an element should beat to enter the heap. Once the
+ * heap is filled with the first k elements, the array is read by blocks of TOPK_BLOCK_LEN
+ * elements by the filter kernels of the backends, which only return the indices of the elements
+ * beating the threshold (a compare and a mask test per vector in most cases). These candidates
+ * are then checked again against the threshold, which rises while they enter the heap. With
+ * k much lower than len, few elements beat the threshold after the first blocks, and the array
+ * is read at the speed of the compares.
+ *
+ * dst and idx get the k elements sorted from the best (largest for topk, smallest for bottomk),
+ * equal elements sorted by index : the element of lowest index is kept among equal elements
+ * as with the C versions. Only len elements are returned if k > len. NaNs are not supported.
+ */
+
+#ifndef TOPK_BLOCK_LEN
+#define TOPK_BLOCK_LEN 1024
+#endif
+
+// indices i < len with src[i] > threshold (src[i] < threshold for the lt kernels), returns their number
+typedef int (*filterf_kernel_t)(float *src, int len, float threshold, int32_t *idx);
+typedef int (*filters_kernel_t)(int32_t *src, int len, int32_t threshold, int32_t *idx);
+
+static inline int filter_gtf(float *src, int len, float threshold, int32_t *idx)
+{
+    int nb = 0;
+    for (int i = 0; i < len; i++) {
+        if (src[i] > threshold)
+            idx[nb++] = i;
+    }
+    return nb;
+}
+
+static inline int filter_ltf(float *src, int len, float threshold, int32_t *idx)
+{
+    int nb = 0;
+    for (int i = 0; i < len; i++) {
+        if (src[i] < threshold)
+            idx[nb++] = i;
+    }
+    return nb;
+}
+
+// (va, ia) should be after (vb, ib) in the output
+static inline int topk_worsef(float va, int32_t ia, float vb, int32_t ib, int largest)
+{
+    if (va == vb)
+        return ia > ib;
+    return largest ? (va < vb) : (va > vb);
+}
+
+static inline void topk_swapf(float *dst, int32_t *idx, int a, int b)
+{
+    float v = dst[a];
+    int32_t i = idx[a];
+    dst[a] = dst[b];
+    idx[a] = idx[b];
+    dst[b] = v;
+    idx[b] = i;
+}
+
+// restores the heap below root (the worst element at the root)
+static inline void topk_siftf(float *dst, int32_t *idx, int root, int len, int largest)
+{
+    for (int child = 2 * root + 1; child < len; child = 2 * root + 1) {
+        if ((child + 1 < len) && topk_worsef(dst[child + 1], idx[child + 1], dst[child], idx[child], largest))
+            child++;
+        if (!topk_worsef(dst[child], idx[child], dst[root], idx[root], largest))
+            return;
+        topk_swapf(dst, idx, root, child);
+        root = child;
+    }
+}
+
+static inline void topk_runf(float *src, int len, int k, float *dst, int32_t *idx, int largest, filterf_kernel_t filter)
+{
+    int32_t cand[TOPK_BLOCK_LEN];
+
+    if (k > len)
+        k = len;
+    if (k <= 0)
+        return;
+
+    for (int i = 0; i < k; i++) {
+        dst[i] = src[i];
+        idx[i] = i;
+    }
+    for (int root = k / 2 - 1; root >= 0; root--)
+        topk_siftf(dst, idx, root, k, largest);
+
+    for (int start = k; start < len; start += TOPK_BLOCK_LEN) {
+        int block_len = ((len - start) < TOPK_BLOCK_LEN) ? (len - start) : TOPK_BLOCK_LEN;
+        int nb_cand = filter(src + start, block_len, dst[0], cand);
+        for (int c = 0; c < nb_cand; c++) {
+            int i = start + cand[c];
+            // the threshold may have risen since the filter, equal elements of higher index are worse
+            if (largest ? (src[i] > dst[0]) : (src[i] < dst[0])) {
+                dst[0] = src[i];
+                idx[0] = i;
+                topk_siftf(dst, idx, 0, k, largest);
+            }
+        }
+    }
+
+    // heapsort, the worst elements are moved to the end
+    for (int end = k - 1; end > 0; end--) {
+        topk_swapf(dst, idx, 0, end);
+        topk_siftf(dst, idx, 0, end, largest);
+    }
+}
+
+static inline int filter_gts(int32_t *src, int len, int32_t threshold, int32_t *idx)
+{
+    int nb = 0;
+    for (int i = 0; i < len; i++) {
+        if (src[i] > threshold)
+            idx[nb++] = i;
+    }
+    return nb;
+}
+
+static inline int filter_lts(int32_t *src, int len, int32_t threshold, int32_t *idx)
+{
+    int nb = 0;
+    for (int i = 0; i < len; i++) {
+        if (src[i] < threshold)
+            idx[nb++] = i;
+    }
+    return nb;
+}
+
+// (va, ia) should be after (vb, ib) in the output
+static inline int topk_worses(int32_t va, int32_t ia, int32_t vb, int32_t ib, int largest)
+{
+    if (va == vb)
+        return ia > ib;
+    return largest ? (va < vb) : (va > vb);
+}
+
+static inline void topk_swaps(int32_t *dst, int32_t *idx, int a, int b)
+{
+    int32_t v = dst[a];
+    int32_t i = idx[a];
+    dst[a] = dst[b];
+    idx[a] = idx[b];
+    dst[b] = v;
+    idx[b] = i;
+}
+
+// restores the heap below root (the worst element at the root)
+static inline void topk_sifts(int32_t *dst, int32_t *idx, int root, int len, int largest)
+{
+    for (int child = 2 * root + 1; child < len; child = 2 * root + 1) {
+        if ((child + 1 < len) && topk_worses(dst[child + 1], idx[child + 1], dst[child], idx[child], largest))
+            child++;
+        if (!topk_worses(dst[child], idx[child], dst[root], idx[root], largest))
+            return;
+        topk_swaps(dst, idx, root, child);
+        root = child;
+    }
+}
+
+static inline void topk_runs(int32_t *src, int len, int k, int32_t *dst, int32_t *idx, int largest, filters_kernel_t filter)
+{
+    int32_t cand[TOPK_BLOCK_LEN];
+
+    if (k > len)
+        k = len;
+    if (k <= 0)
+        return;
+
+    for (int i = 0; i < k; i++) {
+        dst[i] = src[i];
+        idx[i] = i;
+    }
+    for (int root = k / 2 - 1; root >= 0; root--)
+        topk_sifts(dst, idx, root, k, largest);
+
+    for (int start = k; start < len; start += TOPK_BLOCK_LEN) {
+        int block_len = ((len - start) < TOPK_BLOCK_LEN) ? (len - start) : TOPK_BLOCK_LEN;
+        int nb_cand = filter(src + start, block_len, dst[0], cand);
+        for (int c = 0; c < nb_cand; c++) {
+            int i = start + cand[c];
+            // the threshold may have risen since the filter, equal elements of higher index are worse
+            if (largest ? (src[i] > dst[0]) : (src[i] < dst[0])) {
+                dst[0] = src[i];
+                idx[0] = i;
+                topk_sifts(dst, idx, 0, k, largest);
+            }
+        }
+    }
+
+    // heapsort, the worst elements are moved to the end
+    for (int end = k - 1; end > 0; end--) {
+        topk_swaps(dst, idx, 0, end);
+        topk_sifts(dst, idx, 0, end, largest);
+    }
+}
@@ -0,0 +1,176 @@
+/*
+ * Project : SIMD_Utils
+ * Version : 0.2.6
+ * Author  : JishinMaster
+ * Licence : BSD-2
+ */
+
+#pragma once
+
+/* Types of the public API, shared by simd_utils_constants.h and simd_utils_api.h */
+
+#include <stddef.h>
+#include <stdint.h>
+
+// threshold of simd_set_stream_threshold disabling the non temporal stores
+#define SIMD_STREAM_NEVER ((size_t) -1)
+
+typedef struct {
+	int16_t re;
+	int16_t im;
+} complex16s_t;
+
+typedef struct {
+	int32_t re;
+	int32_t im;
+} complex32s_t;
+
+typedef struct {
+	float re;
+	float im;
+} complex32_t;
+
+typedef struct {
+	double re;
+	double im;
+} complex64_t;
+
+typedef enum {
+    RndZero,
+    RndNear,
+    RndFinancial,
+} FloatRoundingMode;
+
+typedef  struct {
+	int16_t x;
+	int16_t y;
+} point_t;
+
+typedef struct {
+	point_t* modified_points;
+	int counter;
+} modified_t;
+
+// Operations available in a pipeline (pipelineXf, pipelineXf_sum)
+typedef enum {
+    PipeMulC,         // x * value
+    PipeAddC,         // x + value
+    PipeMul,          // x * src[i]
+    PipeAdd,          // x + src[i]
+    PipeSub,          // x - src[i]
+    PipeDiv,          // x / src[i]
+    PipeThresholdGt,  // min(x, value)
+    PipeThresholdLt,  // max(x, value)
+    PipeFabs,
+    PipeSqrt,
+    PipeExp,
+    PipeLn,
+    PipeLog10,
+    PipeLog2,
+    PipeCbrt,
+    PipeSin,
+    PipeCos,
+    PipeTan,
+    PipeTanh,
+    PipeAtan,
+    PipeSigmoid,
+} PipelineOpType;
+
+typedef struct {
+    PipelineOpType op;
+    float value;  // scalar operand (PipeMulC, PipeAddC, PipeThresholdGt/Lt)
+    float *src;   // array operand (PipeMul, PipeAdd, PipeSub, PipeDiv), should not alias dst
+} pipeline_op_t;
+
+// Backends selected at runtime with DISPATCH (simd_utils_dispatch_init)
+typedef enum {
+    SimdIsaSSE = 1,
+    SimdIsaAVX2 = 2,
+    SimdIsaAVX512 = 3,
+} SimdIsa;
+
+/* Plans of the FFTs (fftXf, rfftXf, ...), created by fft_plan32_create/rfft_plan32_create
+ * and released by fft_plan32_destroy (fft_plan64_* for doubles, see simd_utils_fft.h) */
+typedef struct {
+    int n;        // number of complex points of the transform (power of 2)
+    int real_n;   // number of real points of rfft/irfft (2 * n), 0 for a complex plan
+    int log2n;
+    float *tw;    // twiddles of the radix-4 stages, 6 per butterfly (w1, w2, w3)
+    float *twx;   // twiddles of the first two stages, expanded per point (stride 1 and 4)
+    float *rtw;   // W_(2n)^k for k < n (re then im), rfft/irfft only
+    float *work;  // 6 * n floats, ping-pong buffers and split copy of the input
+} fft_plan32_t;
+
+typedef struct {
+    int n;
+    int real_n;
+    int log2n;
+    double *tw;
+    double *twx;
+    double *rtw;
+    double *work;
+} fft_plan64_t;
+
+/* FIR filters (firXf, firXf_cplx, firXf_split), created by fir32_create/fir32_create_cplx
+ * and released by fir32_destroy (see simd_utils_fir.h) */
+typedef struct {
+    int nb_taps;
+    int phase_len;  // taps per polyphase branch
+    int up;         // interpolation factor
+    int down;       // decimation factor
+    int cplx;       // complex taps and samples
+    int buf_len;    // number of samples in buf
+    float *taps;    // reversed taps of each branch (real parts then imaginary parts for complex filters)
+    float *buf;     // delay line then the pending input samples
+    float *work;    // phases of the input (decimation) or output of a branch (interpolation)
+    float *out;     // output block of the split functions
+} fir32_t;
+
+/* Biquad cascades (iirXf), created by iir32_create and released by iir32_destroy
+ * (see simd_utils_iir.h). Arrays indexed by channel are contiguous so that a
+ * vector of channels is loaded at once. */
+typedef struct {
+    int nb_stages;
+    int nb_channels;
+    int stride;    // nb_channels rounded up to a vector of AVX512 (padding channels are zeros)
+    float *coefs;  // b0, b1, b2, a1, a2 of each stage : coefs[(stage * 5 + k) * stride + channel]
+    float *state;  // z1, z2 of each stage : state[(stage * 2 + k) * stride + channel]
+    float *ss;     // block state space matrices of each stage and channel (single channel kernels)
+    float *work;   // one channel of the input, deinterleaved
+} iir32_t;
+
+/* Streaming convolutions and cross-correlations (convXf, convXf_cplx, convXd), created by
+ * conv32_create/xcorr32_create (conv64_* for doubles) and released by conv32_destroy
+ * (see simd_utils_conv.h) */
+typedef struct {
+    int len;             // length of the kernel
+    int cplx;            // complex kernel and samples
+    int fft_len;         // size of the overlap-save FFTs, 0 for the direct form
+    float *taps;         // reversed kernel (direct form, real parts then imaginary parts for complex)
+    float *spectrum;     // FFT of the kernel divided by fft_len (overlap-save)
+    float *buf;          // last len - 1 inputs then the block being filtered
+    float *work;         // spectrum of a block
+    float *out;          // product of the spectra, then the filtered block
+    fft_plan32_t *plan;  // overlap-save
+} conv32_t;
+
+typedef struct {
+    int len;
+    int fft_len;
+    double *taps;
+    double *spectrum;
+    double *buf;
+    double *work;
+    double *out;
+    fft_plan64_t *plan;
+} conv64_t;
+
+/* Moments of an array (momentsXf, momentsXd), initialized by moments_init, merged by
+ * moments_merge and read by moments_mean, moments_variance, ... (see simd_utils_moments.h) */
+typedef struct {
+    double n;     // number of elements
+    double mean;
+    double m2;    // sum of (x - mean)^2
+    double m3;    // sum of (x - mean)^3
+    double m4;    // sum of (x - mean)^4
+} moments_t;